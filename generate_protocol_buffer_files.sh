@@ -2,17 +2,37 @@
 
 echo "Generating objects detection files..."
 cd src/objects_detection/
-protoc --cpp_out=./ detector_model.proto detections.proto
-protoc --python_out=../../tools/objects_detection/ detector_model.proto detections.proto
+protoc --cpp_out=./ detector_model.proto detections.proto compiled_detector_model.proto
+protoc --python_out=../../tools/objects_detection/ detector_model.proto detections.proto compiled_detector_model.proto
 
-# FIXME add the ground plane and calibration protocol buffer models
-echo "(Ground plane and video input files not yet handled by this script)"
+# all the C++ and python files must be generated by the same protoc version,
+# since they are all used with the same protobuf library (3.21)
+echo "Generating video input, ground plane and stixels files..."
 cd ../..
 cd src/video_input/calibration
 protoc --cpp_out=./ calibration.proto
+protoc --python_out=../../../tools/stixels_evaluation/ calibration.proto
+
+cd ../../..
+cd src/stereo_matching/ground_plane
+protoc --cpp_out=./ plane3d.proto
+protoc --python_out=../../../tools/stixels_evaluation/ plane3d.proto
+
+cd ../../..
+cd src/stereo_matching/stixels
+protoc -I. -I../ground_plane --cpp_out=./ ground_top_and_bottom.proto stixels.proto
+protoc -I. -I../ground_plane --python_out=../../../tools/stixels_evaluation/ ground_top_and_bottom.proto stixels.proto
+# plane3d.pb.h lives in the ground_plane directory
+sed -i 's|#include "plane3d.pb.h"|#include "../ground_plane/plane3d.pb.h"|' stixels.pb.h
 
 cd ../../..
 cd src/helpers/data
 protoc --cpp_out=./ DataSequenceHeader.proto
+protoc --python_out=../../../tools/data_sequence/ DataSequenceHeader.proto
+
+cd ../../..
+cd src/tests/data_sequence
+protoc --cpp_out=./ TestData.proto
+protoc --python_out=../../../tools/data_sequence/ TestData.proto
 
 echo "End of game. Have a nice day!"
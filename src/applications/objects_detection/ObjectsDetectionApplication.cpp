@@ -22,6 +22,7 @@
 
 #include "objects_detection/ObjectsDetectorFactory.hpp"
 #include "objects_detection/AbstractObjectsDetector.hpp"
+#include "objects_detection/IntegralChannelsDetector.hpp"
 
 #include "objects_tracking/ObjectsTrackerFactory.hpp"
 #include "objects_tracking/AbstractObjectsTracker.hpp"
@@ -43,6 +44,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/thread.hpp>
+#include <boost/bind.hpp>
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
@@ -56,6 +58,7 @@
 #include <fstream>
 #include <ctime>
 #include <cstdlib>
+#include <map>
 
 
 namespace
@@ -97,6 +100,10 @@ ObjectsDetectionApplication::ObjectsDetectionApplication()
       should_save_detections(false),
       use_ground_plane_only(false),
       should_process_folder(false),
+      use_pipelined_frames(false),
+      pipeline_queue_depth(2),
+      num_batch_detectors(1),
+      batch_threads_per_detector(0),
       additional_border(0),
       stixels_computation_period(1)
 {
@@ -156,6 +163,27 @@ program_options::options_description ObjectsDetectionApplication::get_args_optio
              program_options::value<bool>()->default_value(false),
              "if true, no status information will be printed at run time (use this for speed benchmarking)")
 
+            ("pipelined_frames",
+             program_options::value<bool>()->default_value(false),
+             "if true, the reading of the next frame, the objects detection on the current frame "
+             "and the tracking/recording of the previous frame run concurrently. "
+             "Improves the throughput on offline sequences (requires gui.disabled)")
+
+            ("pipeline_queue_depth",
+             program_options::value<int>()->default_value(2),
+             "when using pipelined_frames, maximum number of frames waiting between two stages of the pipeline")
+
+            ("batch_detectors",
+             program_options::value<int>()->default_value(1),
+             "when using process_folder, number of images processed concurrently, each one by its own objects detector "
+             "(the model is read only once). Improves the images per second on multi-core machines "
+             "for offline evaluation (requires gui.disabled, incompatible with objects_detector.compiled_cascades_file)")
+
+            ("batch_threads_per_detector",
+             program_options::value<int>()->default_value(0),
+             "when using batch_detectors, number of OpenMP threads used by each detector. "
+             "0 splits the available cores among the detectors")
+
             ;
 
     return desc;
@@ -221,6 +249,59 @@ void ObjectsDetectionApplication::setup_problem(const program_options::variables
 
     additional_border = get_option_value<int>(options, "additional_border");
 
+    use_pipelined_frames = get_option_value<bool>(options, "pipelined_frames");
+    pipeline_queue_depth = get_option_value<int>(options, "pipeline_queue_depth");
+
+    if(use_pipelined_frames and (get_option_value<bool>(options, "gui.disabled") == false))
+    {
+        // the user interface draws the objects detector state, which changes while the gui draws the previous frame
+        throw std::invalid_argument("pipelined_frames requires gui.disabled to be true");
+    }
+
+    if(use_pipelined_frames and (pipeline_queue_depth <= 0))
+    {
+        throw std::invalid_argument("pipeline_queue_depth should be a positive number");
+    }
+
+    num_batch_detectors = get_option_value<int>(options, "batch_detectors");
+    batch_threads_per_detector = get_option_value<int>(options, "batch_threads_per_detector");
+
+    if(num_batch_detectors <= 0)
+    {
+        throw std::invalid_argument("batch_detectors should be a positive number");
+    }
+
+    if(num_batch_detectors > 1)
+    {
+        if(should_process_folder == false)
+        {
+            throw std::invalid_argument("batch_detectors > 1 requires the process_folder option");
+        }
+
+        if(get_option_value<bool>(options, "gui.disabled") == false)
+        {
+            throw std::invalid_argument("batch_detectors > 1 requires gui.disabled to be true");
+        }
+
+        if(use_pipelined_frames)
+        {
+            throw std::invalid_argument("batch_detectors > 1 and pipelined_frames are incompatible options. Choose one.");
+        }
+
+        if((options.count("objects_detector.compiled_cascades_file") > 0)
+           and (get_option_value<string>(options, "objects_detector.compiled_cascades_file").empty() == false))
+        {
+            // each detector would read and write the same file, concurrently
+            throw std::invalid_argument("batch_detectors > 1 and objects_detector.compiled_cascades_file "
+                                        "are incompatible options. Choose one.");
+        }
+
+        if(batch_threads_per_detector <= 0)
+        {
+            batch_threads_per_detector = std::max(1, omp_get_max_threads() / num_batch_detectors);
+        }
+    }
+
     // instanciate the different processing modules --
     if(should_process_folder)
     {
@@ -232,7 +313,22 @@ void ObjectsDetectionApplication::setup_problem(const program_options::variables
         video_input_p.reset(VideoInputFactory::new_instance(options));
     }
 
-    objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options));
+    if(num_batch_detectors > 1)
+    {
+        // the model is read once, and shared among all the detectors
+        const boost::shared_ptr<const SharedDetectorModel> model_p = ObjectsDetectorFactory::new_shared_model(options);
+        objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options, *model_p));
+
+        for(int i=1; i < num_batch_detectors; i+=1)
+        {
+            additional_batch_objects_detectors.push_back(
+                        boost::shared_ptr<AbstractObjectsDetector>(ObjectsDetectorFactory::new_instance(options, *model_p)));
+        }
+    }
+    else
+    {
+        objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options));
+    }
 
     if(not objects_detector_p)
     {
@@ -266,6 +362,22 @@ void ObjectsDetectionApplication::setup_problem(const program_options::variables
     }
 
     objects_tracker_p.reset(ObjectsTrackerFactory::new_instance(options));
+
+    if((num_batch_detectors > 1) and objects_tracker_p)
+    {
+        throw std::invalid_argument("batch_detectors > 1 processes independent images, "
+                                    "it cannot be used with an objects tracker");
+    }
+
+    if(use_pipelined_frames and objects_tracker_p
+       and (options.count("objects_detector.full_search_period") > 0)
+       and (get_option_value<int>(options, "objects_detector.full_search_period") > 1))
+    {
+        // the pipelined frames are detected before the tracker has processed the previous frame
+        throw std::invalid_argument("objects_detector.full_search_period > 1 (tracking guided detection) "
+                                    "and pipelined_frames are incompatible options. Choose one.");
+    }
+
     return;
 }
 
@@ -325,6 +437,90 @@ void stixel_world_compute_thread(shared_ptr<AbstractStixelWorldEstimator> stixel
 }
 
 
+double ObjectsDetectionApplication::compute_objects_detections(
+        const AbstractVideoInput::input_image_view_t &input_view,
+        const AbstractVideoInput::input_image_view_t &left_view,
+        const AbstractVideoInput::input_image_view_t &right_view,
+        int &stixels_period_counter)
+{
+    double objects_detector_compute_time = 0;
+
+    objects_detector_p->set_image(input_view);
+
+    if(stixel_world_estimator_p and (stixels_period_counter == stixels_computation_period))
+    {
+        // make sure previous computation finished --
+        //stixel_world_estimator_thread.join();
+        stixels_period_counter = 0;
+
+        // set the input for stixels and objects detection --
+        AbstractVideoInput::input_image_view_t
+                stixels_left_view(left_view), stixels_right_view(right_view);
+        stixel_world_estimator_p->set_rectified_images_pair(stixels_left_view, stixels_right_view);
+
+        // make sure computation finished before retrieving the results
+        stixel_world_compute_ended_barrier.wait();
+
+        objects_detector_p->set_ground_plane_corridor(stixel_world_estimator_p->get_ground_plane_corridor());
+
+        if(not use_ground_plane_only)
+        {
+            objects_detector_p->set_stixels(stixel_world_estimator_p->get_stixels());
+        }
+
+
+        // launch stixels estimation in a thread, compute the objects detection --
+        {
+            {
+                // launch the stixel world computation (and wait if last one has not yet finished)
+                stixel_world_compute_start_barrier.wait();
+                // at this point stixel_world_estimator_p->compute() is being called
+                // inside stixel_world_compute_thread
+            }
+
+            { // the gpu computation runs in parallel with the stixel world estimation
+                const double start_objects_detector_compute_wall_time = omp_get_wtime();
+                objects_detector_p->compute();
+                objects_detector_compute_time = omp_get_wtime() - start_objects_detector_compute_wall_time;
+            }
+        } // end of "pragma omp sections"
+
+    } // end of "if should launch stixels world estimation"
+    else
+    {
+        const double start_objects_detector_compute_wall_time = omp_get_wtime();
+        objects_detector_p->compute();
+        objects_detector_compute_time = omp_get_wtime() - start_objects_detector_compute_wall_time;
+    }
+
+    stixels_period_counter += 1;
+    return objects_detector_compute_time;
+}
+
+
+void ObjectsDetectionApplication::print_computation_time_per_scale() const
+{
+    const IntegralChannelsDetector *integral_channels_detector_p =
+            dynamic_cast<const IntegralChannelsDetector *>(objects_detector_p.get());
+    if(integral_channels_detector_p == NULL)
+    {
+        return;
+    }
+
+    const std::vector<double> &computation_time_per_scale =
+            integral_channels_detector_p->get_computation_time_per_scale();
+
+    printf("Objects detection time per scale in the last frame [ms]:");
+    for(size_t scale_index = 0; scale_index < computation_time_per_scale.size(); scale_index += 1)
+    {
+        printf(" %.2lf", computation_time_per_scale[scale_index]*1000);
+    }
+    printf("\n");
+
+    return;
+}
+
+
 void ObjectsDetectionApplication::main_loop()
 {
 
@@ -335,6 +531,13 @@ void ObjectsDetectionApplication::main_loop()
                "No information will be printed until all the frames have been processed.\n");
     }
 
+    if(num_batch_detectors > 1)
+    {
+        const int num_images = batch_main_loop();
+        printf("Processed a total of %i input images\n", num_images);
+        return;
+    }
+
     int num_iterations = 0;
     //const int num_iterations_for_timing = 10, num_iterations_for_processing_timing = 50;
     const int num_iterations_for_timing = 500, num_iterations_for_processing_timing = 250;
@@ -352,9 +555,6 @@ void ObjectsDetectionApplication::main_loop()
         video_input_is_available = video_input_p->next_frame();
     }
     
-    stixels_t stixels_from_previous_frame;
-    ground_plane_corridor_t ground_corridor_from_previous_frame;
-
     int stixels_period_counter = stixels_computation_period; // start by considering the stixels of the first frame
 
 
@@ -387,6 +587,12 @@ void ObjectsDetectionApplication::main_loop()
 
     bool end_of_game = false;
 
+    if(use_pipelined_frames and video_input_is_available)
+    {
+        num_iterations = pipelined_main_loop(stixels_period_counter, cumulated_objects_detector_compute_time);
+        video_input_is_available = false; // all the frames were processed
+    }
+
     while(video_input_is_available and (not end_of_game))
     {
 
@@ -407,64 +613,25 @@ void ObjectsDetectionApplication::main_loop()
         // we start measuring the time before uploading the data to the GPU
         const double start_processing_wall_time = omp_get_wtime();
 
-        objects_detector_p->set_image(input_view);
-
-        if(stixel_world_estimator_p and (stixels_period_counter == stixels_computation_period))
-        {
-            // make sure previous computation finished --
-            //stixel_world_estimator_thread.join();
-            stixels_period_counter = 0;
-
-            // set the input for stixels and objects detection --
-            AbstractVideoInput::input_image_view_t
-                    left_view(video_input_p->get_left_image()),
-                    right_view(video_input_p->get_right_image());
-
-            stixel_world_estimator_p->set_rectified_images_pair(left_view, right_view);
-
-            // make sure computation finished before retrieving the results
-            stixel_world_compute_ended_barrier.wait();
-
-            ground_corridor_from_previous_frame = stixel_world_estimator_p->get_ground_plane_corridor();
-            objects_detector_p->set_ground_plane_corridor(ground_corridor_from_previous_frame);
-
-            if(not use_ground_plane_only)
-            {
-                stixels_from_previous_frame = stixel_world_estimator_p->get_stixels();
-                objects_detector_p->set_stixels(stixels_from_previous_frame);
-            }
-
-
-            // launch stixels estimation in a thread, compute the objects detection --
-            {
-                {
-                    // launch the stixel world computation (and wait if last one has not yet finished)
-                    stixel_world_compute_start_barrier.wait();
-                    // at this point stixel_world_estimator_p->compute() is being called
-                    // inside stixel_world_compute_thread
-                }
-
-                { // the gpu computation runs in parallel with the stixel world estimation
-                    const double start_objects_detector_compute_wall_time = omp_get_wtime();
-                    objects_detector_p->compute();
-                    cumulated_objects_detector_compute_time += omp_get_wtime() - start_objects_detector_compute_wall_time;
-                }
-            } // end of "pragma omp sections"
-
-        } // end of "if should launch stixels world estimation"
-        else
+        AbstractVideoInput::input_image_view_t left_view, right_view;
+        if(stixel_world_estimator_p)
         {
-            const double start_objects_detector_compute_wall_time = omp_get_wtime();
-            objects_detector_p->compute();
-            cumulated_objects_detector_compute_time += omp_get_wtime() - start_objects_detector_compute_wall_time;
+            left_view = video_input_p->get_left_image();
+            right_view = video_input_p->get_right_image();
         }
 
+        cumulated_objects_detector_compute_time +=
+                compute_objects_detections(input_view, left_view, right_view, stixels_period_counter);
+
 
         // tracking --
         if(true and objects_tracker_p)
         {
             objects_tracker_p->set_detections(objects_detector_p->get_detections());
             objects_tracker_p->compute();
+
+            // tracking guided detection on the next frame
+            objects_detector_p->set_predicted_regions(objects_tracker_p->get_predicted_regions());
         }
 
         cumulated_processing_time += omp_get_wtime() - start_processing_wall_time;
@@ -478,7 +645,6 @@ void ObjectsDetectionApplication::main_loop()
         end_of_game = update_gui();
 
         num_iterations += 1;
-        stixels_period_counter += 1;
 
         if(should_print and ((num_iterations % num_iterations_for_timing) == 0))
         {
@@ -500,6 +666,11 @@ void ObjectsDetectionApplication::main_loop()
                    num_iterations / cumulated_objects_detector_compute_time , num_iterations );
         }
 
+        if(should_print and ((num_iterations % num_iterations_for_processing_timing) == 0))
+        {
+            print_computation_time_per_scale();
+        }
+
         // retrieve next rectified input stereo pair
         if(should_process_folder)
         {
@@ -525,27 +696,428 @@ void ObjectsDetectionApplication::main_loop()
 }
 
 
-void ObjectsDetectionApplication::record_detections()
+/// detections of one image, waiting to be recorded in the input order
+struct BatchResult
 {
-    typedef AbstractObjectsDetector::detections_t detections_t;
-    typedef AbstractObjectsDetector::detection_t detection_t;
+    std::string image_name;
+    std::vector<Detection2d> detections;
+};
 
-    if(detections_data_sequence_p == false)
+
+struct ObjectsDetectionApplication::BatchState
+{
+    boost::mutex mutex;
+    boost::condition_variable result_available;
+
+    int next_image_index, num_running_workers;
+
+    /// results indexed by the image index
+    std::map<int, BatchResult> results;
+
+    /// set by the first worker that raised an exception, raised again in the main thread
+    boost::exception_ptr exception;
+};
+
+
+int ObjectsDetectionApplication::batch_main_loop()
+{
+    const bool should_print = not silent_mode;
+    const int num_images_for_timing = 500;
+
+    std::vector<AbstractObjectsDetector *> objects_detectors;
+    objects_detectors.push_back(objects_detector_p.get());
+    for(size_t i=0; i < additional_batch_objects_detectors.size(); i+=1)
     {
-        // first invocation, need to create the data_sequence file first
-        const string filename = (get_recording_path() / "detections.data_sequence").string();
+        objects_detectors.push_back(additional_batch_objects_detectors[i].get());
+    }
 
-        DetectionsDataSequence::attributes_t attributes;
-        attributes.insert(std::make_pair("created_by", "ObjectsDetectionApplication"));
+    printf("Processing the images folder using %i detectors, each one using %i threads\n",
+           static_cast<int>(objects_detectors.size()), batch_threads_per_detector);
 
-        detections_data_sequence_p.reset(new DetectionsDataSequence(filename, attributes));
+    BatchState state;
+    state.next_image_index = 0;
+    state.num_running_workers = objects_detectors.size();
 
-        log_info() << "Created recording file " << filename << std::endl;
+    const double batch_start_wall_time = omp_get_wtime();
+    double start_wall_time = batch_start_wall_time;
+
+    boost::thread_group workers;
+    for(size_t i=0; i < objects_detectors.size(); i+=1)
+    {
+        workers.create_thread(boost::bind(&ObjectsDetectionApplication::batch_detection_worker, this,
+                                          boost::ref(state), boost::ref(*objects_detectors[i])));
     }
 
-    assert(static_cast<bool>(detections_data_sequence_p) == true);
+    // the main thread records the detections, in the input order --
+    int num_recorded_images = 0;
+    {
+        boost::mutex::scoped_lock lock(state.mutex);
+        while(true)
+        {
+            std::map<int, BatchResult>::iterator result_it = state.results.find(num_recorded_images);
+            if(state.exception or
+               ((result_it == state.results.end()) and (state.num_running_workers == 0)))
+            {
+                break; // error, or all the images were processed
+            }
+
+            if(result_it == state.results.end())
+            {
+                state.result_available.wait(lock);
+                continue;
+            }
+
+            BatchResult result;
+            std::swap(result, result_it->second);
+            state.results.erase(result_it);
+
+            lock.unlock();
+            if(should_save_detections)
+            {
+                record_detections(result.detections, result.image_name);
+            }
+            num_recorded_images += 1;
 
-    detections_t the_detections;
+            if(should_print and ((num_recorded_images % num_images_for_timing) == 0))
+            {
+                printf("Average throughput %.2lf [images/s] (in the last %i images)\n",
+                       num_images_for_timing / (omp_get_wtime() - start_wall_time), num_images_for_timing);
+                start_wall_time = omp_get_wtime(); // we reset timer
+            }
+            lock.lock();
+        } // end of "while images to record"
+    }
+
+    workers.join_all();
+
+    if(state.exception)
+    {
+        boost::rethrow_exception(state.exception);
+    }
+
+    const double batch_wall_time = omp_get_wtime() - batch_start_wall_time;
+    if((num_recorded_images > 0) and (batch_wall_time > 0))
+    {
+        printf("Batch throughput %.2lf [images/s] (%i images in %.1lf seconds)\n",
+               num_recorded_images / batch_wall_time, num_recorded_images, batch_wall_time);
+    }
+
+    return num_recorded_images;
+}
+
+
+void ObjectsDetectionApplication::batch_detection_worker(BatchState &state, AbstractObjectsDetector &objects_detector)
+{
+    // the OpenMP number of threads is a per thread setting
+    omp_set_num_threads(batch_threads_per_detector);
+
+    try
+    {
+        AddBorderFunctor add_border(additional_border);
+        ImagesFromDirectory::input_image_t image;
+
+        while(true)
+        {
+            int image_index = 0;
+            BatchResult result;
+            std::string image_path;
+            {
+                boost::mutex::scoped_lock lock(state.mutex);
+                if(state.exception or (directory_input_p->next_image_path() == false))
+                {
+                    break;
+                }
+
+                image_index = state.next_image_index;
+                state.next_image_index += 1;
+                image_path = directory_input_p->get_image_path();
+                result.image_name = directory_input_p->get_image_name();
+            }
+
+            AbstractVideoInput::input_image_view_t input_view = open_image(image_path, image);
+            input_view = add_border(input_view);
+
+            objects_detector.set_image(input_view);
+            objects_detector.compute();
+            result.detections = objects_detector.get_detections();
+
+            {
+                boost::mutex::scoped_lock lock(state.mutex);
+                std::swap(state.results[image_index], result);
+            }
+            state.result_available.notify_one();
+        } // end of "while images to process"
+    }
+    catch(...)
+    {
+        boost::mutex::scoped_lock lock(state.mutex);
+        if(not state.exception)
+        {
+            state.exception = boost::current_exception();
+        }
+    }
+
+    {
+        boost::mutex::scoped_lock lock(state.mutex);
+        state.num_running_workers -= 1;
+    }
+    state.result_available.notify_one();
+
+    return;
+}
+
+
+ObjectsDetectionApplication::PipelineQueues::PipelineQueues(const size_t queue_depth)
+    : empty_frames(2*queue_depth + 3), read_frames(queue_depth), detected_frames(queue_depth)
+{
+    // each stage holds at most one frame, the queues hold the rest
+    for(size_t i=0; i < (2*queue_depth + 3); i+=1)
+    {
+        empty_frames.push(pipeline_frame_p_t(new PipelineFrame()));
+    }
+    return;
+}
+
+
+void ObjectsDetectionApplication::PipelineQueues::close()
+{
+    empty_frames.close();
+    read_frames.close();
+    detected_frames.close();
+    return;
+}
+
+
+/// the first frame must be already available in the video input
+int ObjectsDetectionApplication::pipelined_main_loop(int &stixels_period_counter,
+                                                     double &cumulated_objects_detector_compute_time)
+{
+    const bool should_print = not silent_mode;
+    const int num_iterations_for_timing = 500;
+
+    PipelineQueues queues(pipeline_queue_depth);
+    pipeline_exception = boost::exception_ptr();
+
+    // the objects detector only runs in the detection stage thread,
+    // the stixel world estimation keeps running in its own thread (see stixel_world_compute_thread)
+    boost::thread
+            read_frames_thread(&ObjectsDetectionApplication::read_frames_stage, this, boost::ref(queues)),
+            detect_objects_thread(&ObjectsDetectionApplication::detect_objects_stage, this,
+                                  boost::ref(queues), boost::ref(stixels_period_counter));
+
+    // tracking, recording and user interface run in the main thread --
+    int num_frames = 0;
+    double
+            cumulated_latency = 0, max_latency = 0,
+            cumulated_latency_since_last_print = 0;
+    const double pipeline_start_wall_time = omp_get_wtime();
+    double start_wall_time = pipeline_start_wall_time;
+
+    // an exception in this stage must also stop the other stages,
+    // the stage threads are always joined before leaving this function
+    try
+    {
+        bool end_of_game = false;
+        pipeline_frame_p_t frame_p;
+        while((end_of_game == false) and queues.detected_frames.pop(frame_p) and frame_p)
+        {
+            PipelineFrame &frame = *frame_p;
+
+            AbstractObjectsDetector::detections_t &the_detections = frame.detections;
+            if(objects_tracker_p)
+            {
+                objects_tracker_p->set_detections(frame.detections);
+                objects_tracker_p->compute();
+            }
+
+            if(should_save_detections)
+            {
+                if(objects_tracker_p)
+                {
+                    record_detections(objects_tracker_p->get_current_detections(), frame.image_name);
+                }
+                else
+                {
+                    record_detections(the_detections, frame.image_name);
+                }
+            }
+
+            end_of_game = update_gui();
+
+            const double latency = omp_get_wtime() - frame.read_start_wall_time;
+            cumulated_latency += latency;
+            cumulated_latency_since_last_print += latency;
+            max_latency = std::max(max_latency, latency);
+            cumulated_objects_detector_compute_time += frame.objects_detector_compute_time;
+            num_frames += 1;
+
+            // the frame is recycled by the reading stage
+            queues.empty_frames.push(frame_p);
+
+            if(should_print and ((num_frames % num_iterations_for_timing) == 0))
+            {
+                printf("Average pipeline throughput %.4lf [Hz], average frame latency %.1lf [ms] "
+                       "(in the last %i iterations)\n",
+                       num_iterations_for_timing / (omp_get_wtime() - start_wall_time),
+                       1000*cumulated_latency_since_last_print / num_iterations_for_timing,
+                       num_iterations_for_timing);
+                start_wall_time = omp_get_wtime(); // we reset timer
+                cumulated_latency_since_last_print = 0;
+            }
+        } // end of "while frames and not end of game"
+    }
+    catch(...)
+    {
+        set_pipeline_exception(queues);
+    }
+
+    const double pipeline_wall_time = omp_get_wtime() - pipeline_start_wall_time;
+
+    // stop the stages (if end of game was reached before the end of the video input)
+    queues.close();
+    read_frames_thread.join();
+    detect_objects_thread.join();
+
+    if(pipeline_exception)
+    {
+        boost::rethrow_exception(pipeline_exception);
+    }
+
+    if((num_frames > 0) and (pipeline_wall_time > 0))
+    {
+        printf("Pipelined frames throughput %.2lf [Hz], "
+               "frame latency (read to recorded) %.1lf [ms] on average, %.1lf [ms] at most\n",
+               num_frames / pipeline_wall_time,
+               1000*cumulated_latency / num_frames, 1000*max_latency);
+    }
+
+    return num_frames;
+}
+
+
+void ObjectsDetectionApplication::set_pipeline_exception(PipelineQueues &queues)
+{
+    {
+        boost::mutex::scoped_lock lock(pipeline_exception_mutex);
+        if(not pipeline_exception)
+        {
+            // closing the queues may raise exceptions in the other stages, we only keep the original one
+            pipeline_exception = boost::current_exception();
+        }
+    }
+
+    queues.close();
+    return;
+}
+
+
+void ObjectsDetectionApplication::read_frames_stage(PipelineQueues &queues)
+{
+    try
+    {
+        AddBorderFunctor add_border(additional_border);
+
+        bool video_input_is_available = true; // the first frame is read by main_loop
+        pipeline_frame_p_t frame_p;
+        while(video_input_is_available and queues.empty_frames.pop(frame_p))
+        {
+            PipelineFrame &frame = *frame_p;
+            frame.read_start_wall_time = omp_get_wtime();
+
+            AbstractVideoInput::input_image_view_t input_view;
+            if(should_process_folder)
+            {
+                input_view = directory_input_p->get_image();
+                frame.image_name = directory_input_p->get_image_name();
+            }
+            else
+            {
+                input_view = video_input_p->get_left_image();
+                frame.image_name = boost::str(boost::format("frame_%i") % this->get_current_frame_number());
+            }
+
+            input_view = add_border(input_view);
+
+            // the images are only reallocated when their size changes
+            frame.input_image.recreate(input_view.dimensions());
+            boost::gil::copy_pixels(input_view, boost::gil::view(frame.input_image));
+
+            if(stixel_world_estimator_p)
+            {
+                const AbstractVideoInput::input_image_view_t
+                        left_view(video_input_p->get_left_image()),
+                        right_view(video_input_p->get_right_image());
+                frame.left_image.recreate(left_view.dimensions());
+                frame.right_image.recreate(right_view.dimensions());
+                boost::gil::copy_pixels(left_view, boost::gil::view(frame.left_image));
+                boost::gil::copy_pixels(right_view, boost::gil::view(frame.right_image));
+            }
+
+            // blocks while the detection stage is pipeline_queue_depth frames behind
+            if(queues.read_frames.push(frame_p) == false)
+            {
+                return; // the pipeline was stopped
+            }
+
+            // retrieve next rectified input stereo pair
+            if(should_process_folder)
+            {
+                video_input_is_available = directory_input_p->next_frame();
+            }
+            else
+            {
+                video_input_is_available = video_input_p->next_frame();
+            }
+        } // end of "while video input is available"
+
+        queues.read_frames.push(pipeline_frame_p_t()); // indicates the end of the video input
+    }
+    catch(...)
+    {
+        set_pipeline_exception(queues);
+    }
+
+    return;
+}
+
+
+void ObjectsDetectionApplication::detect_objects_stage(PipelineQueues &queues, int &stixels_period_counter)
+{
+    try
+    {
+        pipeline_frame_p_t frame_p;
+        while(queues.read_frames.pop(frame_p) and frame_p)
+        {
+            PipelineFrame &frame = *frame_p;
+
+            frame.objects_detector_compute_time =
+                    compute_objects_detections(boost::gil::const_view(frame.input_image),
+                                               boost::gil::const_view(frame.left_image),
+                                               boost::gil::const_view(frame.right_image),
+                                               stixels_period_counter);
+
+            frame.detections = objects_detector_p->get_detections();
+
+            if(queues.detected_frames.push(frame_p) == false)
+            {
+                return; // the pipeline was stopped
+            }
+        } // end of "while frames to process"
+
+        queues.detected_frames.push(pipeline_frame_p_t()); // indicates the end of the video input
+    }
+    catch(...)
+    {
+        set_pipeline_exception(queues);
+    }
+
+    return;
+}
+
+
+void ObjectsDetectionApplication::record_detections()
+{
+    AbstractObjectsDetector::detections_t the_detections;
 
     if(objects_tracker_p)
     {
@@ -556,8 +1128,6 @@ void ObjectsDetectionApplication::record_detections()
         the_detections = objects_detector_p->get_detections();
     }
 
-    DetectionsDataSequence::data_type detections_data;
-
     string image_name;
     if(should_process_folder)
     {
@@ -568,6 +1138,36 @@ void ObjectsDetectionApplication::record_detections()
         image_name = boost::str(boost::format("frame_%i") % this->get_current_frame_number());
     }
 
+    record_detections(the_detections, image_name);
+    return;
+}
+
+
+void ObjectsDetectionApplication::record_detections(const std::vector<Detection2d> &the_detections,
+                                                    const std::string &image_name)
+{
+    typedef AbstractObjectsDetector::detection_t detection_t;
+
+    if(detections_data_sequence_p == false)
+    {
+        // first invocation, need to create the data_sequence file first
+        const string filename = (get_recording_path() / "detections.data_sequence").string();
+
+        DetectionsDataSequence::attributes_t attributes;
+        attributes.insert(std::make_pair("created_by", "ObjectsDetectionApplication"));
+
+        detections_data_sequence_p.reset(new DetectionsDataSequence(filename, attributes));
+        // the file writing is done in a background thread, to avoid slowing down the processing loop
+        detections_data_sequence_p->enable_asynchronous_writes();
+        detections_data_sequence_p->enable_index_footer(); // allows random access when reading the recording
+
+        log_info() << "Created recording file " << filename << std::endl;
+    }
+
+    assert(static_cast<bool>(detections_data_sequence_p) == true);
+
+    DetectionsDataSequence::data_type detections_data;
+
     detections_data.set_image_name(image_name);
 
     BOOST_FOREACH(const detection_t &detection, the_detections)
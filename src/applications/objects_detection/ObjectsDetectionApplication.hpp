@@ -5,14 +5,20 @@
 #include "applications/BaseApplication.hpp"
 
 #include "video_input/AbstractVideoInput.hpp"
+#include "objects_detection/Detection2d.hpp"
+
+#include "helpers/BoundedQueue.hpp"
 
 
 #include <boost/program_options.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/exception_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <string>
+#include <vector>
 
 namespace doppia_protobuf {
 class Detections;
@@ -74,7 +80,79 @@ protected:
 
     void main_loop();
 
+    /// set the input image (and the stixels estimated on the previous frames), and compute the detections
+    /// @returns the objects detector compute time, in seconds
+    double compute_objects_detections(const AbstractVideoInput::input_image_view_t &input_view,
+                                      const AbstractVideoInput::input_image_view_t &left_view,
+                                      const AbstractVideoInput::input_image_view_t &right_view,
+                                      int &stixels_period_counter);
+
+    /// prints the time spent on each scale of the last frame (only for the cpu channels detectors)
+    void print_computation_time_per_scale() const;
+
+    /// pipelined frames processing --
+    /// frames N+1 (reading and preprocessing), N (stixels and objects detection)
+    /// and N-1 (tracking, recording and user interface) are processed concurrently
+    /// @{
+
+    /// copy of the input images of one frame (the video input buffers are overwritten by the next frame)
+    struct PipelineFrame
+    {
+        AbstractVideoInput::input_image_t input_image, left_image, right_image;
+        std::string image_name;
+        std::vector<Detection2d> detections;
+
+        /// wall time when the frame reading started, used to measure the per frame latency
+        double read_start_wall_time;
+        double objects_detector_compute_time;
+    };
+
+    typedef shared_ptr<PipelineFrame> pipeline_frame_p_t;
+    typedef BoundedQueue<pipeline_frame_p_t> frames_queue_t;
+
+    /// the empty frames are recycled, the pipeline never allocates more than
+    /// 2*pipeline_queue_depth + 3 frames
+    struct PipelineQueues
+    {
+        PipelineQueues(const size_t queue_depth);
+        frames_queue_t empty_frames, read_frames, detected_frames;
+
+        /// stops all the stages
+        void close();
+    };
+
+    bool use_pipelined_frames;
+    int pipeline_queue_depth;
+
+    /// set by the first stage that raised an exception, raised again in the main thread
+    boost::exception_ptr pipeline_exception;
+    boost::mutex pipeline_exception_mutex;
+
+    /// keeps the current exception, unless another stage already set one, and stops the pipeline
+    void set_pipeline_exception(PipelineQueues &queues);
+
+    /// @returns the number of processed frames
+    int pipelined_main_loop(int &stixels_period_counter, double &cumulated_objects_detector_compute_time);
+    void read_frames_stage(PipelineQueues &queues);
+    void detect_objects_stage(PipelineQueues &queues, int &stixels_period_counter);
+    /// @}
+
+    /// batch processing of process_folder --
+    /// num_batch_detectors detectors (sharing the same model) process as many images concurrently,
+    /// each one using batch_threads_per_detector OpenMP threads. The detections are recorded in the input order.
+    /// @{
+    int num_batch_detectors, batch_threads_per_detector;
+    std::vector< boost::shared_ptr<AbstractObjectsDetector> > additional_batch_objects_detectors;
+
+    struct BatchState;
+
+    /// @returns the number of processed images
+    int batch_main_loop();
+    void batch_detection_worker(BatchState &state, AbstractObjectsDetector &objects_detector);
+    /// @}
+
     void record_detections();
+    void record_detections(const std::vector<Detection2d> &the_detections, const std::string &image_name);
 
     scoped_ptr<DetectionsDataSequence> detections_data_sequence_p;
     bool should_save_detections, use_ground_plane_only, should_process_folder, silent_mode;
@@ -25,6 +25,7 @@
 
 #include "objects_tracking/AbstractObjectsTracker.hpp"
 #include "objects_tracking/DummyObjectsTracker.hpp"
+#include "objects_tracking/IndexedObjectsTracker.hpp"
 
 #include "helpers/data/DataSequence.hpp"
 #include "objects_detection/detections.pb.h"
@@ -408,8 +409,10 @@ void ObjectsDetectionGui::draw_detections()
 
 
 
+/// TracksType is DummyObjectsTracker::tracks_t or IndexedObjectsTracker::tracks_t
+template<typename TracksType>
 void draw_the_tracks(
-        const DummyObjectsTracker::tracks_t &tracks,
+        const TracksType &tracks,
         float &max_detection_score,
         const int additional_border,
         std::map<int, float> &track_id_to_hue,
@@ -540,14 +543,25 @@ void ObjectsDetectionGui::draw_tracks()
     {
         const DummyObjectsTracker * dummy_objects_tracker_p = \
                 dynamic_cast<const DummyObjectsTracker *>(application.objects_tracker_p.get());
+        const IndexedObjectsTracker * indexed_objects_tracker_p = \
+                dynamic_cast<const IndexedObjectsTracker *>(application.objects_tracker_p.get());
 
-        if(dummy_objects_tracker_p != NULL)
+        if((dummy_objects_tracker_p != NULL) or (indexed_objects_tracker_p != NULL))
         {
-            const DummyObjectsTracker::tracks_t &tracks = dummy_objects_tracker_p->get_tracks();
-            draw_the_tracks(tracks,
-                            max_detection_score, application.additional_border,
-                            track_id_to_hue,
-                            screen_left_view);
+            if(dummy_objects_tracker_p != NULL)
+            {
+                draw_the_tracks(dummy_objects_tracker_p->get_tracks(),
+                                max_detection_score, application.additional_border,
+                                track_id_to_hue,
+                                screen_left_view);
+            }
+            else
+            {
+                draw_the_tracks(indexed_objects_tracker_p->get_tracks(),
+                                max_detection_score, application.additional_border,
+                                track_id_to_hue,
+                                screen_left_view);
+            }
 
             // draw ground truth
             for(size_t i=0; i < ground_truth_detections.size(); i+=1)
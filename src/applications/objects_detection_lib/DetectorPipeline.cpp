@@ -0,0 +1,682 @@
+#include "DetectorPipeline.hpp"
+
+#include "ObjectsDetectionLibGui.hpp"
+
+#include "video_input/preprocessing/AddBorderFunctor.hpp"
+
+#include "objects_detection/AbstractObjectsDetector.hpp"
+#include "objects_detection/ObjectsDetectorFactory.hpp"
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+#include "video_input/MetricCamera.hpp"
+#else // not defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+#include "video_input/MetricStereoCamera.hpp"
+#include "video_input/MetricCamera.hpp"
+#include "video_input/calibration/StereoCameraCalibration.hpp"
+#include "stereo_matching/stixels/StixelWorldEstimatorFactory.hpp"
+#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+
+#include "helpers/get_option_value.hpp"
+#include "helpers/replace_environment_variables.hpp"
+
+#include <boost/foreach.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <omp.h>
+
+#include <cstdio>
+#include <stdexcept>
+
+namespace
+{
+
+/// the OpenMP number of threads is a per thread setting,
+/// this helper sets it for the current scope (of the current thread) only
+class ScopedNumThreads
+{
+public:
+    ScopedNumThreads(const int num_threads)
+        : previous_num_threads(omp_get_max_threads()), changed(num_threads > 0)
+    {
+        if(changed)
+        {
+            omp_set_num_threads(num_threads);
+        }
+        return;
+    }
+
+    ~ScopedNumThreads()
+    {
+        if(changed)
+        {
+            omp_set_num_threads(previous_num_threads);
+        }
+        return;
+    }
+
+protected:
+    const int previous_num_threads;
+    const bool changed;
+};
+
+} // end of anonymous namespace
+
+
+namespace objects_detection {
+
+using namespace std;
+using namespace boost;
+using namespace doppia;
+
+
+DetectorPipeline::DetectorPipeline(const boost::program_options::variables_map &options_,
+                                   const bool use_ground_plane, const bool use_stixels,
+                                   const shared_model_p_t model_p,
+                                   const int num_threads_)
+    : options(options_),
+      num_threads(num_threads_),
+      ground_plane_prior_pitch(0), ground_plane_prior_roll(0), ground_plane_prior_height(1.0),
+      first_frame(true),
+      should_use_ground_plane(use_ground_plane), should_use_stixels(use_stixels),
+      compute_barrier(2),
+      stop_compute_async_thread(false)
+{
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+
+    if(use_stixels)
+    {
+        throw std::runtime_error("Stixels computation not available in monocular mode");
+    }
+
+    if(use_ground_plane)
+    {
+        throw std::invalid_argument("When using ground plane, DetectorPipeline expects to receive "
+                                    "a non-empty calibration shared pointer");
+    }
+
+    init_detector(model_p);
+
+#else // not monocular
+
+    init_detector(model_p);
+
+    if(use_ground_plane or use_stixels)
+    {
+        boost::filesystem::path calibration_filename =
+                get_option_value<std::string>(options, "video_input.calibration_filename");
+
+        calibration_filename = replace_environment_variables(calibration_filename);
+
+        stereo_calibration_p.reset(new StereoCameraCalibration(calibration_filename.string()));
+        stereo_camera_p.reset(new MetricStereoCamera(*stereo_calibration_p));
+
+        read_ground_plane_prior();
+    }
+
+#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+    return;
+}
+
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+
+DetectorPipeline::DetectorPipeline(const boost::program_options::variables_map &options_,
+                                   boost::shared_ptr<doppia::CameraCalibration> calibration_p,
+                                   const bool use_ground_plane,
+                                   const shared_model_p_t model_p,
+                                   const int num_threads_)
+    : options(options_),
+      num_threads(num_threads_),
+      ground_plane_prior_pitch(0), ground_plane_prior_roll(0), ground_plane_prior_height(1.0),
+      first_frame(true),
+      should_use_ground_plane(use_ground_plane), should_use_stixels(false),
+      compute_barrier(2),
+      stop_compute_async_thread(false)
+{
+    init_detector(model_p);
+
+    if(use_ground_plane)
+    {
+        if(not calibration_p)
+        {
+            throw std::invalid_argument("When using ground plane, DetectorPipeline expects to receive "
+                                        "a non-empty calibration shared pointer");
+        }
+
+        camera_calibration_p = calibration_p;
+        metric_camera_p.reset(new MetricCamera(*camera_calibration_p));
+
+        read_ground_plane_prior();
+
+        const bool print_parameters_details = true;
+        if(print_parameters_details)
+        {
+            printf("camera focal x,y == (%.3f, %.3f)\n",
+                   metric_camera_p->get_calibration().get_focal_length_x(),
+                   metric_camera_p->get_calibration().get_focal_length_y() );
+        }
+    }
+
+    return;
+}
+
+#else // not monocular
+
+DetectorPipeline::DetectorPipeline(const boost::program_options::variables_map &options_,
+                                   boost::shared_ptr<doppia::StereoCameraCalibration> input_stereo_calibration_p,
+                                   const bool use_ground_plane, const bool use_stixels,
+                                   const shared_model_p_t model_p,
+                                   const int num_threads_)
+    : options(options_),
+      num_threads(num_threads_),
+      ground_plane_prior_pitch(0), ground_plane_prior_roll(0), ground_plane_prior_height(1.0),
+      first_frame(true),
+      should_use_ground_plane(use_ground_plane), should_use_stixels(use_stixels),
+      compute_barrier(2),
+      stop_compute_async_thread(false)
+{
+    init_detector(model_p);
+
+    if(use_ground_plane or use_stixels)
+    {
+        if(not input_stereo_calibration_p)
+        {
+            throw std::invalid_argument("DetectorPipeline expects to receive a non-empty stereo calibration shared pointer");
+        }
+
+        stereo_calibration_p = input_stereo_calibration_p;
+        stereo_camera_p.reset(new MetricStereoCamera(*stereo_calibration_p));
+
+        read_ground_plane_prior();
+
+        const bool print_parameters_details = true;
+        if(print_parameters_details)
+        {
+            printf("stereo baseline == %.3f\n", stereo_camera_p->get_calibration().get_baseline() );
+            printf("left/right camera focal x,y == (%.3f, %.3f)/(%.3f, %.3f)\n",
+                   stereo_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_x(),
+                   stereo_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_y(),
+                   stereo_camera_p->get_calibration().get_right_camera_calibration().get_focal_length_x(),
+                   stereo_camera_p->get_calibration().get_right_camera_calibration().get_focal_length_y() );
+        }
+
+        // StixelWorldEstimatorFactory requires the input image dimensions,
+        // stixel_world_estimator_p will only be set at the first call of set_rectified_stereo_images_pair
+    }
+
+    return;
+}
+
+#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+
+
+DetectorPipeline::~DetectorPipeline()
+{
+    if(compute_async_thread.joinable())
+    {
+        // the worker thread reaches the barrier once the current computation (if any) is done
+        stop_compute_async_thread = true;
+        compute_barrier.wait();
+        compute_async_thread.join();
+    }
+
+    return;
+}
+
+
+void DetectorPipeline::init_detector(const shared_model_p_t model_p)
+{
+    const int additional_border = get_option_value<int>(options, "video_input.additional_border");
+
+    if(additional_border > 0)
+    {
+        add_border_p.reset(new AddBorderFunctor(additional_border));
+    }
+
+    if(model_p)
+    {
+        // the model is shared with the other pipelines
+        objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options, *model_p));
+    }
+    else
+    {
+        objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options));
+    }
+
+    return;
+}
+
+
+void DetectorPipeline::read_ground_plane_prior()
+{
+    ground_plane_prior_height = get_option_value<float>(options, "video_input.camera_height");
+    ground_plane_prior_pitch = get_option_value<float>(options, "video_input.camera_pitch");
+    ground_plane_prior_roll = get_option_value<float>(options, "video_input.camera_roll");
+
+    const bool print_parameters_details = true;
+    if(print_parameters_details)
+    {
+        printf("Camera height == %.4f\n", ground_plane_prior_height);
+        printf("Camera pitch == %.4f\n", ground_plane_prior_pitch);
+    }
+
+    return;
+}
+
+
+void DetectorPipeline::set_monocular_image(input_image_const_view_t &input_view)
+{
+    if(first_frame and input_view.size() == 0)
+    {
+        throw std::runtime_error("objects_detection::set_monocular_image received an image of size 0,0");
+    }
+
+    if(stixel_world_estimator_p)
+    {
+        throw std::runtime_error("Indicated that would stereo features, but provided only a monocular input.");
+    }
+
+    if(add_border_p)
+    {
+        // add the borders (for Markus and Angelos)
+        input_image_const_view_t the_input_view = (*add_border_p)(input_view);
+        input_dimensions = the_input_view.dimensions();
+        objects_detector_p->set_image(the_input_view);
+    }
+    else
+    {
+        input_dimensions = input_view.dimensions();
+        objects_detector_p->set_image(input_view);
+    }
+
+    if(first_frame)
+    {
+#if defined(OBJECTS_DETECTION_WITH_UI_LIB)
+        boost::shared_ptr<doppia::MetricStereoCamera> stereo_camera_p; // left empty for monocular case
+        gui_p.reset(new ObjectsDetectionLibGui(input_view.width(), input_view.height(), stereo_camera_p,
+                                               objects_detector_p, stixel_world_estimator_p));
+#endif
+    }
+
+    if(gui_p)
+    {
+        gui_p->set_monocular_input(input_view);
+    }
+
+    // first frame is set to false in compute()
+    return;
+}
+
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+void DetectorPipeline::set_rectified_stereo_images_pair(input_image_const_view_t &, input_image_const_view_t &)
+{
+    throw std::runtime_error("set_rectified_stereo_images_pair(...) not implemented in "
+                             "the monocular objects detection library");
+    return;
+}
+
+#else // MONOCULAR_OBJECTS_DETECTION_LIB is not defined
+
+void DetectorPipeline::set_rectified_stereo_images_pair(input_image_const_view_t &input_left_view,
+                                                        input_image_const_view_t &input_right_view)
+{
+    input_image_const_view_t left_view, right_view;
+
+    if(input_left_view.dimensions() != input_right_view.dimensions())
+    {
+        printf("left width, height == %zi, %zi\n", input_left_view.width(), input_left_view.height());
+        printf("right width, height == %zi, %zi\n", input_right_view.width(), input_right_view.height());
+        throw std::invalid_argument("Input left and right images do not have the same dimensions");
+    }
+
+    if(first_frame and input_left_view.size() == 0)
+    {
+        throw std::runtime_error("objects_detection::set_rectified_stereo_images_pair received "
+                                 "a left image of size 0,0");
+    }
+
+    if(first_frame and input_right_view.size() == 0)
+    {
+        throw std::runtime_error("objects_detection::set_rectified_stereo_images_pair received "
+                                 "a right image of size 0,0");
+    }
+
+    const bool copy_input_images = true; // just to be safe
+    if(copy_input_images)
+    {
+        // lazy re-allocation
+        left_image.recreate(input_left_view.dimensions());
+        right_image.recreate(input_right_view.dimensions());
+
+        boost::gil::copy_pixels(input_left_view, boost::gil::view(left_image));
+        boost::gil::copy_pixels(input_right_view, boost::gil::view(right_image));
+
+        left_view = boost::gil::const_view(left_image);
+        right_view = boost::gil::const_view(right_image);
+    }
+    else
+    {
+        left_view = input_left_view;
+        right_view = input_right_view;
+    }
+
+    input_dimensions = left_view.dimensions();
+
+    if(first_frame)
+    {
+        printf("first frame for set_rectified_stereo_images_pair\n");
+        if(not stixel_world_estimator_p and (should_use_stixels or should_use_ground_plane))
+        {
+            stixel_world_estimator_p.reset(
+                        StixelWorldEstimatorFactory::new_instance(options,
+                                                                  left_view.dimensions(),
+                                                                  *stereo_camera_p,
+                                                                  ground_plane_prior_pitch,
+                                                                  ground_plane_prior_roll,
+                                                                  ground_plane_prior_height));
+        }
+
+        // in the first frame we will not output any detection, that starts in the second frame
+        if(stixel_world_estimator_p)
+        {
+            stixel_world_estimator_p->set_rectified_images_pair(left_view, right_view);
+        }
+
+        // must set the image in the objects detector too, so it knows right away about the image size
+        objects_detector_p->set_image(left_view);
+
+#if defined(OBJECTS_DETECTION_WITH_UI_LIB)
+        gui_p.reset(new ObjectsDetectionLibGui(left_view.width(), left_view.height(), stereo_camera_p,
+                                               objects_detector_p, stixel_world_estimator_p));
+#endif
+    }
+    else
+    {
+        // set the input for stixels and objects detection --
+        if(stixel_world_estimator_p)
+        {
+            stixel_world_estimator_p->set_rectified_images_pair(left_view, right_view);
+            ground_corridor_from_previous_frame = stixel_world_estimator_p->get_ground_plane_corridor();
+            objects_detector_p->set_ground_plane_corridor(ground_corridor_from_previous_frame);
+
+            if(should_use_stixels)
+            {
+                stixels_from_previous_frame = stixel_world_estimator_p->get_stixels();
+                objects_detector_p->set_stixels(stixels_from_previous_frame);
+            }
+        }
+
+        objects_detector_p->set_image(left_view);
+    }
+
+    if(gui_p)
+    {
+        gui_p->set_left_input(left_view);
+        gui_p->set_right_input(right_view);
+    }
+
+    // first frame is set to false in compute()
+    return;
+}
+#endif // MONOCULAR_OBJECTS_DETECTION_LIB is defined or not
+
+
+void DetectorPipeline::compute()
+{
+    if(compute_async_thread.joinable())
+    {
+        throw std::runtime_error("DetectorPipeline::compute cannot be mixed with compute_async");
+    }
+
+    const ScopedNumThreads scoped_num_threads(num_threads);
+    compute_implementation();
+    return;
+}
+
+
+void DetectorPipeline::compute_implementation()
+{
+    if(first_frame and stixel_world_estimator_p)
+    {
+        printf("first frame for compute\n");
+        stixel_world_estimator_p->compute();
+    }
+    else if(stixel_world_estimator_p)
+    {
+        // launch stixels estimation in a thread, compute the objects detection --
+#pragma omp sections
+        {
+#pragma omp section
+            {
+                stixel_world_estimator_p->compute();
+            }
+#pragma omp section
+            { // the gpu computation runs in parallel with the stixel world estimation
+                objects_detector_p->compute();
+            }
+        } // end of "pragma omp sections"
+    }
+    else
+    {
+        objects_detector_p->compute();
+    }
+
+    if(gui_p)
+    {
+        gui_p->update();
+    }
+
+    first_frame = false;
+    return;
+}
+
+
+void DetectorPipeline::compute_async_thread_function()
+{
+    // this thread is the "thread pool" of this pipeline,
+    // its OpenMP parallel regions use num_threads threads
+    if(num_threads > 0)
+    {
+        omp_set_num_threads(num_threads);
+    }
+
+    while(true)
+    {
+        compute_barrier.wait(); // waiting for compute_async to launch a new computation
+
+        if(stop_compute_async_thread)
+        {
+            break;
+        }
+
+        try
+        {
+            compute_implementation();
+
+            // we keep ground plane and stixels synchronized with the detections
+            if(stixel_world_estimator_p)
+            {
+#if not defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+                async_ground_plane = stixel_world_estimator_p->get_ground_plane();
+                async_stixels = stixel_world_estimator_p->get_stixels();
+#endif
+            }
+            detections_promise.set_value(objects_detector_p->get_detections());
+        }
+        catch(...)
+        {
+            // the exception is raised again by get_detections
+            detections_promise.set_exception(boost::current_exception());
+        }
+    } // end of "while not stopped"
+
+    return;
+}
+
+
+void DetectorPipeline::compute_async()
+{
+    if(compute_async_thread.joinable() == false)
+    {
+        // thread is not running
+        printf("Launching async computation thread\n");
+
+        compute_async_thread = boost::thread(&DetectorPipeline::compute_async_thread_function, this);
+    }
+    else if(compute_async_detections.is_ready() == false)
+    {
+        throw std::runtime_error("DetectorPipeline::compute_async was called before "
+                                 "the previous computation finished (see detections_are_ready)");
+    }
+
+    // new promise, new future
+    {
+        detections_promise = boost::promise<detections_t>();
+        compute_async_detections = detections_promise.get_future();
+    }
+    compute_barrier.wait(); // at this point, the computation is launched
+
+    return;
+}
+
+
+bool DetectorPipeline::detections_are_ready()
+{
+    if(compute_async_thread.joinable() == false)
+    {
+        throw std::runtime_error("compute_async() should be called at least once before calling detections_are_ready()");
+    }
+
+    return compute_async_detections.is_ready();
+}
+
+
+void DetectorPipeline::shift_detections(detections_t &detections) const
+{
+    const int additional_border = add_border_p->additional_border;
+
+    BOOST_FOREACH(detection_t &detection, detections)
+    {
+        detection_t::rectangle_t &bb = detection.bounding_box;
+        bb.max_corner().x(bb.max_corner().x() - additional_border);
+        bb.max_corner().y(bb.max_corner().y() - additional_border);
+        bb.min_corner().x(bb.min_corner().x() - additional_border);
+        bb.min_corner().y(bb.min_corner().y() - additional_border);
+    }
+    return;
+}
+
+
+const detections_t DetectorPipeline::get_detections_implementation()
+{
+    if(compute_async_thread.joinable())
+    { // using compute_async
+
+        if(not detections_are_ready())
+        {
+            throw std::runtime_error("objects_detection::get_detections() was called, but detections_are_ready() is false. "
+                                     "Should check that detections are ready before calling get_detections()");
+        }
+
+        return compute_async_detections.get();
+    }
+    else
+    { // using blocking api
+
+        return objects_detector_p->get_detections();
+    }
+}
+
+
+const detections_t DetectorPipeline::get_detections()
+{
+    if(add_border_p)
+    {
+        detections_t the_detections = get_detections_implementation();
+        shift_detections(the_detections);
+        return the_detections;
+    }
+    else
+    {
+        return get_detections_implementation();
+    }
+}
+
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+const ground_plane_t DetectorPipeline::get_ground_plane()
+{
+    throw std::runtime_error("get_ground_plane() not implemented in "
+                             "the monocular objects detection library");
+    return ground_plane_t();
+}
+
+const stixels_t DetectorPipeline::get_stixels()
+{
+    throw std::runtime_error("get_stixels() not implemented in "
+                             "the monocular objects detection library");
+    return stixels_t();
+}
+
+#else // MONOCULAR_OBJECTS_DETECTION_LIB is not defined
+
+const ground_plane_t DetectorPipeline::get_ground_plane()
+{
+    if(stixel_world_estimator_p)
+    {
+        if(compute_async_thread.joinable())
+        { // using compute_async
+
+            if(not detections_are_ready())
+            {
+                throw std::runtime_error("objects_detection::get_ground_plane() was called, but detections_are_ready() is false. "
+                                         "Should check that detections computation is ready before calling get_ground_plane()");
+            }
+
+            return async_ground_plane;
+        }
+        else
+        { // using blocking api
+
+            return stixel_world_estimator_p->get_ground_plane();
+        }
+    }
+    else
+    {
+        throw std::runtime_error("Cannot (yet) call get_ground_plane when using monocular images only");
+    }
+}
+
+
+const stixels_t DetectorPipeline::get_stixels()
+{
+    if(stixel_world_estimator_p)
+    {
+        if(compute_async_thread.joinable())
+        { // using compute_async
+
+            if(not detections_are_ready())
+            {
+                throw std::runtime_error("objects_detection::get_stixels() was called, but detections_are_ready() is false. "
+                                         "Should check that detections computation is ready before calling get_stixels()");
+            }
+
+            return async_stixels;
+        }
+        else
+        { // using blocking api
+
+            return stixel_world_estimator_p->get_stixels();
+        }
+    }
+    else
+    {
+        throw std::runtime_error("Cannot call get_stixels when using monocular images only");
+    }
+}
+#endif // MONOCULAR_OBJECTS_DETECTION_LIB is defined or not
+
+
+} // end of namespace objects_detection
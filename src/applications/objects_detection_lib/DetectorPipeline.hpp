@@ -0,0 +1,151 @@
+#ifndef OBJECTS_DETECTION_DETECTORPIPELINE_HPP
+#define OBJECTS_DETECTION_DETECTORPIPELINE_HPP
+
+#include "objects_detection_lib.hpp"
+
+#include "stereo_matching/stixels/AbstractStixelWorldEstimator.hpp"
+
+#include <boost/program_options/variables_map.hpp>
+#include <boost/gil/image.hpp>
+#include <boost/gil/typedefs.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/thread.hpp>
+
+namespace doppia {
+// forward declarations
+class AbstractObjectsDetector;
+class AddBorderFunctor;
+class MetricCamera;
+class MetricStereoCamera;
+struct SharedDetectorModel;
+}
+
+namespace objects_detection {
+
+// forward declaration
+class ObjectsDetectionLibGui;
+
+/// One objects detection pipeline: the objects detector, the (optional) stixel world estimator
+/// and the worker thread used by compute_async.
+///
+/// Multiple pipelines can run concurrently in the same process (e.g. one per camera).
+/// To keep a single copy of the detector model in memory, read it once via
+/// doppia::ObjectsDetectorFactory::new_shared_model and give it to each pipeline.
+/// Each pipeline computation uses num_threads OpenMP threads (all the available ones by default),
+/// so that N pipelines can split the cpu cores between them.
+///
+/// Pipelines sharing the same options should leave objects_detector.compiled_cascades_file empty,
+/// or use one file per pipeline.
+///
+/// The objects_detection free functions (see objects_detection_lib.hpp) use a default pipeline.
+/// The methods have the same semantic as their free functions counterparts.
+class DetectorPipeline: private boost::noncopyable
+{
+public:
+
+    typedef boost::shared_ptr<const doppia::SharedDetectorModel> shared_model_p_t;
+
+    /// when using the stereo library and use_ground_plane or use_stixels is true,
+    /// the stereo calibration is read from the video_input.calibration_filename option
+    /// @param model_p if empty, the model is read from the objects_detector.model option
+    /// @param num_threads zero (or less) uses the OpenMP default number of threads
+    DetectorPipeline(const boost::program_options::variables_map &options,
+                     const bool use_ground_plane = false, const bool use_stixels = false,
+                     const shared_model_p_t model_p = shared_model_p_t(),
+                     const int num_threads = 0);
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+    DetectorPipeline(const boost::program_options::variables_map &options,
+                     boost::shared_ptr<doppia::CameraCalibration> calibration_p,
+                     const bool use_ground_plane = false,
+                     const shared_model_p_t model_p = shared_model_p_t(),
+                     const int num_threads = 0);
+#else
+    /// the camera calibration is given directly, the video_input.calibration_filename option is not used
+    DetectorPipeline(const boost::program_options::variables_map &options,
+                     boost::shared_ptr<doppia::StereoCameraCalibration> stereo_calibration_p,
+                     const bool use_ground_plane = false, const bool use_stixels = false,
+                     const shared_model_p_t model_p = shared_model_p_t(),
+                     const int num_threads = 0);
+#endif
+
+    /// waits for the running compute_async computation (if any) and stops the worker thread
+    ~DetectorPipeline();
+
+    void set_monocular_image(input_image_const_view_t &input_image);
+    void set_rectified_stereo_images_pair(input_image_const_view_t &left, input_image_const_view_t &right);
+
+    void compute();
+    void compute_async();
+
+    bool detections_are_ready();
+    const detections_t get_detections();
+    const ground_plane_t get_ground_plane();
+    const stixels_t get_stixels();
+
+protected:
+
+    const boost::program_options::variables_map options;
+    const int num_threads;
+
+    boost::scoped_ptr<doppia::AddBorderFunctor> add_border_p;
+
+    boost::shared_ptr<doppia::AbstractObjectsDetector> objects_detector_p;
+    boost::shared_ptr<doppia::AbstractStixelWorldEstimator> stixel_world_estimator_p;
+
+    boost::scoped_ptr<ObjectsDetectionLibGui> gui_p;
+
+    stixels_t stixels_from_previous_frame;
+
+    typedef doppia::AbstractStixelWorldEstimator::ground_plane_corridor_t ground_plane_corridor_t;
+    ground_plane_corridor_t ground_corridor_from_previous_frame;
+
+    boost::gil::rgb8_image_t::point_t input_dimensions;
+
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+    boost::shared_ptr<doppia::CameraCalibration> camera_calibration_p;
+    boost::shared_ptr<doppia::MetricCamera> metric_camera_p;
+#else  // not monocular
+    boost::shared_ptr<doppia::StereoCameraCalibration> stereo_calibration_p;
+    boost::shared_ptr<doppia::MetricStereoCamera> stereo_camera_p;
+
+    boost::gil::rgb8_image_t left_image, right_image;
+#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+
+    float
+    ground_plane_prior_pitch, // [radians]
+    ground_plane_prior_roll, // [radians]
+    ground_plane_prior_height; // [meters]
+
+    bool
+    first_frame,
+    should_use_ground_plane, // used to enable ground plane usage in monocular case
+    should_use_stixels;
+
+    void init_detector(const shared_model_p_t model_p);
+    void read_ground_plane_prior();
+
+    /// compute_async state --
+    /// @{
+    boost::barrier compute_barrier; // only two threads are involved in this barrier
+    bool stop_compute_async_thread;
+
+    boost::promise<detections_t> detections_promise;
+    boost::unique_future<detections_t> compute_async_detections;
+    ground_plane_t async_ground_plane;
+    stixels_t async_stixels;
+    boost::thread compute_async_thread;
+
+    void compute_async_thread_function();
+    /// @}
+
+    void compute_implementation();
+    const detections_t get_detections_implementation();
+    void shift_detections(detections_t &detections) const;
+};
+
+} // end namespace objects_detection
+
+#endif // OBJECTS_DETECTION_DETECTORPIPELINE_HPP
@@ -1,4 +1,5 @@
 #include "objects_detection_lib.hpp"
+#include "DetectorPipeline.hpp"
 
 #include "video_input/preprocessing/AddBorderFunctor.hpp"
 
@@ -52,44 +53,23 @@ using namespace std;
 using namespace boost;
 using namespace doppia;
 
-scoped_ptr<AddBorderFunctor> add_border_p;
-
-shared_ptr<AbstractObjectsDetector> objects_detector_p;
-shared_ptr<AbstractStixelWorldEstimator> stixel_world_estimator_p;
-
-scoped_ptr<ObjectsDetectionLibGui> gui_p;
+/// the pipeline used by the free functions,
+/// applications processing multiple streams should use DetectorPipeline instances directly
+scoped_ptr<DetectorPipeline> default_pipeline_p;
 
 typedef DataSequence<doppia_protobuf::Detections> DetectionsDataSequence;
 scoped_ptr<DetectionsDataSequence> detections_data_sequence_p;
 
-stixels_t stixels_from_previous_frame;
-
-typedef AbstractStixelWorldEstimator::ground_plane_corridor_t ground_plane_corridor_t;
-ground_plane_corridor_t ground_corridor_from_previous_frame;
-
-/// options are stored for the delayed StixelWorldEstimator instanciation
-boost::program_options::variables_map options;
-
-boost::gil::rgb8_image_t::point_t input_dimensions;
 
-#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
-shared_ptr<CameraCalibration> camera_calibration_p;
-shared_ptr<MetricCamera> metric_camera_p;
-#else  // not monocular
-shared_ptr<StereoCameraCalibration> stereo_calibration_p;
-shared_ptr<MetricStereoCamera> stereo_camera_p;
-float
-ground_plane_prior_pitch = 0, // [radians]
-ground_plane_prior_roll = 0, // [radians]
-ground_plane_prior_height = 1.0; // [meters]
-
-boost::gil::rgb8_image_t left_image, right_image;
-#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+DetectorPipeline &get_default_pipeline()
+{
+    if(default_pipeline_p == false)
+    {
+        throw std::runtime_error("objects_detection::init_objects_detection(...) should be called first");
+    }
 
-bool
-first_frame = true,
-should_use_ground_plane = false, // used to enable ground plane usage in monocular case
-should_use_stixels = false;
+    return *default_pipeline_p;
+}
 
 
 void get_options_description(boost::program_options::options_description &desc)
@@ -179,374 +159,81 @@ boost::program_options::variables_map parse_configuration_file(const boost::file
 
 
 
-void init_objects_detection(const boost::filesystem::path configuration_filepath,
-                            const bool use_ground_plane, const bool use_stixels)
+void setup_logging()
 {
-    const boost::program_options::variables_map options = parse_configuration_file(configuration_filepath);
+    logging::get_log().clear(); // we reset previously existing options
 
-    init_objects_detection(options, use_ground_plane, use_stixels);
+    // set our own stdout rules and set cout as console stream --
+    logging::LogRuleSet rules_for_stdout;
+    rules_for_stdout.add_rule(logging::ErrorMessage, "*"); // we only print errors
+
+    rules_for_stdout.add_rule(logging::WarningMessage, "*"); // also print warnings
+
+    logging::get_log().set_console_stream(std::cout, rules_for_stdout);
     return;
 }
 
 
-void init_objects_detection(const boost::program_options::variables_map input_options,
+void init_objects_detection(const boost::filesystem::path configuration_filepath,
                             const bool use_ground_plane, const bool use_stixels)
 {
+    const boost::program_options::variables_map options = parse_configuration_file(configuration_filepath);
 
-#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
-
-    if(use_stixels)
-    {
-        throw std::runtime_error("Stixels computation not available in monocular mode");
-    }
-
-    boost::shared_ptr<doppia::CameraCalibration> calibration_p;
-    init_objects_detection(input_options, calibration_p, use_ground_plane);
-
-#else // not monocular
-    boost::shared_ptr<doppia::StereoCameraCalibration> stereo_calibration_p;
-
-    if(use_ground_plane or use_stixels)
-    {
-
-        boost::filesystem::path calibration_filename =
-                get_option_value<std::string>(input_options, "video_input.calibration_filename");
-
-        calibration_filename = replace_environment_variables(calibration_filename);
-
-        stereo_calibration_p.reset(new StereoCameraCalibration(calibration_filename.string()));
-
-    }
-
-    init_objects_detection(input_options, stereo_calibration_p, use_ground_plane, use_stixels);
-
-#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
+    init_objects_detection(options, use_ground_plane, use_stixels);
     return;
 }
 
 
 void init_objects_detection(const boost::program_options::variables_map input_options,
-                            boost::shared_ptr<doppia::StereoCameraCalibration> input_stereo_calibration_p,
                             const bool use_ground_plane, const bool use_stixels)
 {
+    setup_logging();
 
-    options = input_options; // we store the options for future use
-
-    // setup the logging
-    {
-        logging::get_log().clear(); // we reset previously existing options
-
-        // set our own stdout rules and set cout as console stream --
-        logging::LogRuleSet rules_for_stdout;
-        rules_for_stdout.add_rule(logging::ErrorMessage, "*"); // we only print errors
-
-        rules_for_stdout.add_rule(logging::WarningMessage, "*"); // also print warnings
-
-        logging::get_log().set_console_stream(std::cout, rules_for_stdout);
-
-        //logging::log(logging::ErrorMessage, "objects_detection") << "Test error message" << std::endl;
-    }
-
-
-    const int additional_border = get_option_value<int>(options, "video_input.additional_border");
-
-    if(additional_border > 0)
-    {
-        add_border_p.reset(new AddBorderFunctor(additional_border));
-    }
-
-
-    objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options));
-
-    if(use_ground_plane or use_stixels)
-    {
-        should_use_stixels = use_stixels;
-
-#if not defined(MONOCULAR_OBJECTS_DETECTION_LIB)
-
-        if(not input_stereo_calibration_p)
-        {
-            throw std::invalid_argument("init_objects_detection expects to receive a non-empty stereo calibration shared pointer");
-        }
-
-        stereo_calibration_p = input_stereo_calibration_p;
-        stereo_camera_p.reset(new MetricStereoCamera(*stereo_calibration_p));
-
-        ground_plane_prior_height = get_option_value<float>(options, "video_input.camera_height");
-        ground_plane_prior_pitch = get_option_value<float>(options, "video_input.camera_pitch");
-        ground_plane_prior_roll = get_option_value<float>(options, "video_input.camera_roll");
-
-        const bool print_parameters_details = true;
-
-        if(print_parameters_details)
-        {
-            printf("Camera height == %.4f\n", ground_plane_prior_height);
-            printf("Camera pitch == %.4f\n", ground_plane_prior_pitch);
-
-            printf("stereo baseline == %.3f\n", stereo_camera_p->get_calibration().get_baseline() );
-            printf("left/right camera focal x,y == (%.3f, %.3f)/(%.3f, %.3f)\n",
-                   stereo_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_x(),
-                   stereo_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_y(),
-                   stereo_camera_p->get_calibration().get_right_camera_calibration().get_focal_length_x(),
-                   stereo_camera_p->get_calibration().get_right_camera_calibration().get_focal_length_y() );
-        }
-
-        // StixelWorldEstimatorFactory requires the input image dimensions,
-        // stixel_world_estimator_p will only be set at the first call of set_rectified_stereo_images_pair
-#endif
-
-        // FIXME should have a specialized ground plane only case
-    }
-
+    default_pipeline_p.reset(); // the previous pipeline (if any) stops its worker thread first
+    default_pipeline_p.reset(new DetectorPipeline(input_options, use_ground_plane, use_stixels));
     return;
 }
 
 
-
+#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
 void init_objects_detection(const boost::program_options::variables_map input_options,
                             boost::shared_ptr<doppia::CameraCalibration> calibration_p,
                             const bool use_ground_plane)
 {
+    setup_logging();
 
-    options = input_options; // we store the options for future use
-
-    // setup the logging
-    {
-        logging::get_log().clear(); // we reset previously existing options
-
-        // set our own stdout rules and set cout as console stream --
-        logging::LogRuleSet rules_for_stdout;
-        rules_for_stdout.add_rule(logging::ErrorMessage, "*"); // we only print errors
-
-        rules_for_stdout.add_rule(logging::WarningMessage, "*"); // also print warnings
-
-        logging::get_log().set_console_stream(std::cout, rules_for_stdout);
-
-        //logging::log(logging::ErrorMessage, "objects_detection") << "Test error message" << std::endl;
-    }
-
-
-    const int additional_border = get_option_value<int>(options, "video_input.additional_border");
-
-    if(additional_border > 0)
-    {
-        add_border_p.reset(new AddBorderFunctor(additional_border));
-    }
-
-
-    objects_detector_p.reset(ObjectsDetectorFactory::new_instance(options));
-
-    should_use_stixels = false;
-
-    if(use_ground_plane)
-    {
-
-        if(not calibration_p)
-        {
-            throw std::invalid_argument("When using ground plane, init_objects_detection expects to receive a non-empty calibration shared pointer");
-        }
-
-
-        camera_calibration_p = calibration_p;
-        metric_camera_p.reset(new MetricCamera(*camera_calibration_p));
-
-        ground_plane_prior_height = get_option_value<float>(options, "video_input.camera_height");
-        ground_plane_prior_pitch = get_option_value<float>(options, "video_input.camera_pitch");
-        ground_plane_prior_roll = get_option_value<float>(options, "video_input.camera_roll");
-
-        const bool print_parameters_details = true;
-
-        if(print_parameters_details)
-        {
-            printf("Camera height == %.4f\n", ground_plane_prior_height);
-            printf("Camera pitch == %.4f\n", ground_plane_prior_pitch);
-
-             printf("camera focal x,y == (%.3f, %.3f)\n",
-                   metric_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_x(),
-                   metric_camera_p->get_calibration().get_left_camera_calibration().get_focal_length_y() );
-        }
-
-    }
-
+    default_pipeline_p.reset();
+    default_pipeline_p.reset(new DetectorPipeline(input_options, calibration_p, use_ground_plane));
     return;
 }
 
-
-
-
-void set_monocular_image(input_image_const_view_t &input_view)
+#else // not monocular
+void init_objects_detection(const boost::program_options::variables_map input_options,
+                            boost::shared_ptr<doppia::StereoCameraCalibration> input_stereo_calibration_p,
+                            const bool use_ground_plane, const bool use_stixels)
 {
-    if(first_frame and input_view.size() == 0)
-    {
-        throw std::runtime_error("objects_detection::set_monocular_image received an image of size 0,0");
-    }
-
-    if(stixel_world_estimator_p)
-    {
-        throw std::runtime_error("Indicated that would stereo features, but provided only a monocular input.");
-    }
-
-    if(add_border_p)
-    {
-        // add the borders (for Markus and Angelos)
-        input_image_const_view_t the_input_view = (*add_border_p)(input_view);
-        input_dimensions = the_input_view.dimensions();
-        objects_detector_p->set_image(the_input_view);
-    }
-    else
-    {
-        input_dimensions = input_view.dimensions();
-        objects_detector_p->set_image(input_view);
-    }
-
-    if(first_frame)
-    {
-#if defined(OBJECTS_DETECTION_WITH_UI_LIB)
-        boost::shared_ptr<doppia::MetricStereoCamera> stereo_camera_p; // left empty for monocular case
-        gui_p.reset(new ObjectsDetectionLibGui(input_view.width(), input_view.height(), stereo_camera_p,
-                                               objects_detector_p, stixel_world_estimator_p));
-#endif
-    }
-
-    if(gui_p)
-    {
-        gui_p->set_monocular_input(input_view);
-    }
+    setup_logging();
 
-    // first frame is set to false in compute()
+    default_pipeline_p.reset();
+    default_pipeline_p.reset(new DetectorPipeline(input_options, input_stereo_calibration_p,
+                                                  use_ground_plane, use_stixels));
     return;
 }
+#endif // defined(MONOCULAR_OBJECTS_DETECTION_LIB)
 
 
-#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
-void set_rectified_stereo_images_pair(input_image_const_view_t &left_view, input_image_const_view_t &right_view)
+void set_monocular_image(input_image_const_view_t &input_view)
 {
-    throw std::runtime_error("set_rectified_stereo_images_pair(...) not implemented in "
-                             "the monocular objects detection library");
+    get_default_pipeline().set_monocular_image(input_view);
     return;
 }
 
-#else // MONOCULAR_OBJECTS_DETECTION_LIB is not defined
-
 
-void set_rectified_stereo_images_pair(input_image_const_view_t &input_left_view,
-                                      input_image_const_view_t &input_right_view)
+void set_rectified_stereo_images_pair(input_image_const_view_t &left_view, input_image_const_view_t &right_view)
 {
-
-    if(false and (not stereo_camera_p)) // we may not use the stereo at all, even if we receive stereo input
-    {
-        throw std::runtime_error("set_rectified_stereo_images_pair called but no stereo camera has been set, "
-                                 "please double-check your objects_detection::init_objects_detection(...) call");
-    }
-
-
-    input_image_const_view_t left_view, right_view;
-
-    if(input_left_view.dimensions() != input_right_view.dimensions())
-    {
-        printf("left width, height == %zi, %zi\n", input_left_view.width(), input_left_view.height());
-        printf("right width, height == %zi, %zi\n", input_right_view.width(), input_right_view.height());
-        throw std::invalid_argument("Input left and right images do not have the same dimensions");
-    }
-
-    if(first_frame and input_left_view.size() == 0)
-    {
-        throw std::runtime_error("objects_detection::set_rectified_stereo_images_pair received "
-                                 "a left image of size 0,0");
-    }
-
-    if(first_frame and input_right_view.size() == 0)
-    {
-        throw std::runtime_error("objects_detection::set_rectified_stereo_images_pair received "
-                                 "a right image of size 0,0");
-    }
-
-    const bool copy_input_images = true; // just to be safe
-    if(copy_input_images)
-    {
-        // lazy re-allocation
-        left_image.recreate(input_left_view.dimensions());
-        right_image.recreate(input_right_view.dimensions());
-
-        boost::gil::copy_pixels(input_left_view, boost::gil::view(left_image));
-        boost::gil::copy_pixels(input_right_view, boost::gil::view(right_image));
-
-        left_view = boost::gil::const_view(left_image);
-        right_view = boost::gil::const_view(right_image);
-
-        //boost::gil::png_write_view("right_view.png", right_view);
-        //throw std::runtime_error("created right_view.png");
-    }
-    else
-    {
-        left_view = input_left_view;
-        right_view = input_right_view;
-    }
-
-    input_dimensions = left_view.dimensions();
-
-    if(first_frame)
-    {
-        printf("first frame for set_rectified_stereo_images_pair\n");
-        if(not stixel_world_estimator_p and (should_use_stixels or should_use_ground_plane))
-        {
-            stixel_world_estimator_p.reset(
-                        StixelWorldEstimatorFactory::new_instance(options,
-                                                                  left_view.dimensions(),
-                                                                  *stereo_camera_p,
-                                                                  ground_plane_prior_pitch,
-                                                                  ground_plane_prior_roll,
-                                                                  ground_plane_prior_height));
-        }
-
-
-        // in the first frame we will not output any detection, that starts in the second frame
-        if(stixel_world_estimator_p)
-        {
-            stixel_world_estimator_p->set_rectified_images_pair(left_view, right_view);
-        }
-
-        // must set the image in the objects detector too, so it knows right away about the image size
-        objects_detector_p->set_image(left_view);
-
-#if defined(OBJECTS_DETECTION_WITH_UI_LIB)
-        gui_p.reset(new ObjectsDetectionLibGui(left_view.width(), left_view.height(), stereo_camera_p,
-                                               objects_detector_p, stixel_world_estimator_p));
-#endif
-
-    }
-    else
-    {
-        // set the input for stixels and objects detection --
-        if(stixel_world_estimator_p)
-        {
-            stixel_world_estimator_p->set_rectified_images_pair(left_view, right_view);
-            ground_corridor_from_previous_frame = stixel_world_estimator_p->get_ground_plane_corridor();
-            objects_detector_p->set_ground_plane_corridor(ground_corridor_from_previous_frame);
-
-            if(should_use_stixels)
-            {
-                stixels_from_previous_frame = stixel_world_estimator_p->get_stixels();
-                objects_detector_p->set_stixels(stixels_from_previous_frame);
-            }
-        }
-
-        objects_detector_p->set_image(left_view);
-    }
-
-
-    if(gui_p)
-    {
-        gui_p->set_left_input(left_view);
-        gui_p->set_right_input(right_view);
-    }
-
-
-    // first frame is set to false in compute()
+    get_default_pipeline().set_rectified_stereo_images_pair(left_view, right_view);
     return;
 }
-#endif // MONOCULAR_OBJECTS_DETECTION_LIB is defined or not
-
 
 
 /// pseudo distance is related to distance, but not in meters (more something like 1/(meters*focal_length))
@@ -813,80 +500,7 @@ void set_ground_plane_estimate(const GroundPlane &ground_plane)
 /// blocking call to compute the detections
 void compute()
 {
-    // if(thread_launched) raise exception, cannot mix both operation modes
-
-    if(first_frame and stixel_world_estimator_p)
-    {
-        printf("first frame for compute\n");
-        stixel_world_estimator_p->compute();
-    }
-    else if(stixel_world_estimator_p)
-    {
-        // launch stixels estimation in a thread, compute the objects detection --
-#pragma omp sections
-        {
-#pragma omp section
-            {
-                stixel_world_estimator_p->compute();
-            }
-#pragma omp section
-            { // the gpu computation runs in parallel with the stixel world estimation
-                //const double start_objects_detector_compute_wall_time = omp_get_wtime();
-                objects_detector_p->compute();
-                //cumulated_objects_detector_compute_time += omp_get_wtime() - start_objects_detector_compute_wall_time;
-            }
-        } // end of "pragma omp sections"
-    }
-    else
-    {
-        //const double start_objects_detector_compute_wall_time = omp_get_wtime();
-        objects_detector_p->compute();
-        //cumulated_objects_detector_compute_time += omp_get_wtime() - start_objects_detector_compute_wall_time;
-    }
-
-    if(gui_p)
-    {
-        gui_p->update();
-    }
-
-    first_frame = false;
-    return;
-}
-
-
-boost::barrier compute_barrier(2); // only two threads are involved in this barrier
-
-boost::promise<detections_t> detections_promise;
-boost::unique_future<detections_t> compute_async_detections;
-ground_plane_t async_ground_plane;
-stixels_t async_stixels;
-boost::thread compute_async_thread;
-
-
-void compute_async_thread_function()
-{
-    //printf("Entering into compute_async_thread_function infinite loop\n");
-    while(true) // FIXME is this a good idea ?
-    {
-        {
-            compute_barrier.wait(); // waiting for compute_async to launch a new computation
-            //printf("Computation async sent 'true' to the compute condition\n");
-        }
-
-        // call the global method
-        compute();
-
-        // we keep ground plane and stixels synchronized with the detections
-        if(stixel_world_estimator_p)
-        {
-#if not defined(MONOCULAR_OBJECTS_DETECTION_LIB)
-            async_ground_plane = stixel_world_estimator_p->get_ground_plane();
-            async_stixels = stixel_world_estimator_p->get_stixels();
-#endif
-        }
-        detections_promise.set_value(objects_detector_p->get_detections());
-    }
-
+    get_default_pipeline().compute();
     return;
 }
 
@@ -894,24 +508,7 @@ void compute_async_thread_function()
 /// non-blocking call to launch the detections, pool detections_are_ready to check for new results
 void compute_async()
 {
-    if(compute_async_thread.joinable() == false)
-    {
-        // thread is not running
-        printf("Launching async computation thread\n");
-
-        // launch thread
-        compute_async_thread = boost::thread(compute_async_thread_function);
-
-    } // end of "if compute async thread is not yet running"
-
-    // new promise, new future
-    {
-        detections_promise = boost::promise<detections_t>();
-        compute_async_detections = detections_promise.get_future();
-    }
-    compute_barrier.wait(); // at this point, the computation is launched
-
-    //printf("Exiting compute_async\n");
+    get_default_pipeline().compute_async();
     return;
 }
 
@@ -919,146 +516,28 @@ void compute_async()
 /// returns true if the detection task launched with compute_async has finished
 bool detections_are_ready()
 {
-    if(compute_async_thread.joinable() == false)
-    {
-
-        throw std::runtime_error("compute_async() should be called at least once before calling detections_are_ready()");
-    }
-
-    return compute_async_detections.is_ready();
-}
-
-
-void shift_detections(detections_t &detections)
-{
-    const int additional_border = add_border_p->additional_border;
-
-    BOOST_FOREACH(detection_t &detection, detections)
-    {
-        detection_t::rectangle_t &bb = detection.bounding_box;
-        bb.max_corner().x(bb.max_corner().x() - additional_border);
-        bb.max_corner().y(bb.max_corner().y() - additional_border);
-        bb.min_corner().x(bb.min_corner().x() - additional_border);
-        bb.min_corner().y(bb.min_corner().y() - additional_border);
-    }
-    return;
-}
-
-/// returns a copy of the current detections, should not be called if detections_are_ready returns false
-const detections_t get_detections_implementation()
-{
-    if(compute_async_thread.joinable())
-    { // using compute_async
-
-        if(not detections_are_ready())
-        {
-            throw std::runtime_error("objects_detection::get_detections() was called, but detections_are_ready() is false. "
-                                     "Should check that detections are ready before calling get_detections()");
-        }
-
-        return compute_async_detections.get();
-    }
-    else
-    { // using blocking api
-
-        return objects_detector_p->get_detections();
-    }
+    return get_default_pipeline().detections_are_ready();
 }
 
 
 /// returns a copy of the current detections, should not be called if detections_are_ready returns false
 const detections_t get_detections()
 {
-    if(add_border_p)
-    {
-        detections_t the_detections = get_detections_implementation();
-        shift_detections(the_detections);
-        return the_detections;
-    }
-    else
-    {
-        return get_detections_implementation();
-    }
+    return get_default_pipeline().get_detections();
 }
 
 
-#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
 const ground_plane_t get_ground_plane()
 {
-    throw std::runtime_error("get_ground_plane() not implemented in "
-                             "the monocular objects detection library");
-    return ground_plane_t();
+    return get_default_pipeline().get_ground_plane();
 }
 
-#else // MONOCULAR_OBJECTS_DETECTION_LIB is not defined
-const ground_plane_t get_ground_plane()
-{
-
-    if(stixel_world_estimator_p)
-    {
-        if(compute_async_thread.joinable())
-        { // using compute_async
-
-            if(not detections_are_ready())
-            {
-                throw std::runtime_error("objects_detection::get_ground_plane() was called, but detections_are_ready() is false. "
-                                         "Should check that detections computation is ready before calling get_ground_plane()");
-            }
-
-            return async_ground_plane;
-        }
-        else
-        { // using blocking api
-
-            return stixel_world_estimator_p->get_ground_plane();
-        }
-    }
-    else
-    {
-        throw std::runtime_error("Cannot (yet) call get_ground_plane when using monocular images only");
-    }
-}
-#endif // MONOCULAR_OBJECTS_DETECTION_LIB is defined or not
 
-
-#if defined(MONOCULAR_OBJECTS_DETECTION_LIB)
 const stixels_t get_stixels()
 {
-    throw std::runtime_error("get_stixels() not implemented in "
-                             "the monocular objects detection library");
-    return stixels_t();
+    return get_default_pipeline().get_stixels();
 }
 
-#else // MONOCULAR_OBJECTS_DETECTION_LIB is not defined
-const stixels_t get_stixels()
-{
-
-    if(stixel_world_estimator_p)
-    {
-        if(compute_async_thread.joinable())
-        { // using compute_async
-
-            if(not detections_are_ready())
-            {
-                throw std::runtime_error("objects_detection::get_ground_plane() was called, but detections_are_ready() is false. "
-                                         "Should check that detections computation is ready before calling get_ground_plane()");
-            }
-
-            return async_stixels;
-        }
-        else
-        { // using blocking api
-
-            return stixel_world_estimator_p->get_stixels();
-        }
-    }
-    else
-    {
-        throw std::runtime_error("Cannot call get_stixels when using monocular images only");
-    }
-}
-#endif // MONOCULAR_OBJECTS_DETECTION_LIB is defined or not
-
 
 void record_detections(const boost::filesystem::path &image_path,
                        const detections_t &the_detections,
@@ -1091,6 +570,9 @@ void record_detections(const boost::filesystem::path &image_path,
         attributes.insert(std::make_pair("created_by", "ObjectsDetectionApplication"));
 
         detections_data_sequence_p.reset(new DetectionsDataSequence(recording_path, attributes));
+        // the file writing is done in a background thread, to avoid slowing down the processing loop
+        detections_data_sequence_p->enable_asynchronous_writes();
+        detections_data_sequence_p->enable_index_footer(); // allows random access when reading the recording
 
         printf("\nCreated recording file %s\n\n", recording_path.c_str());
     }
@@ -37,6 +37,10 @@ typedef doppia::stixels_t stixels_t;
 
 typedef boost::gil::rgb8c_view_t input_image_const_view_t;
 
+// The functions below operate on a single (process wide) pipeline,
+// to run multiple pipelines concurrently (e.g. one per camera) use DetectorPipeline instances instead
+// (see DetectorPipeline.hpp)
+
 /// Initialization functions
 /// @{
 void init_objects_detection(const boost::filesystem::path configuration_filepath,
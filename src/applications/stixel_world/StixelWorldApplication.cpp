@@ -335,6 +335,9 @@ void StixelWorldApplication::record_stixels()
         attributes.insert(std::make_pair("created_by", "StixelWorldApplication"));
 
         stixels_data_sequence_p.reset(new StixelsDataSequence(filename, attributes));
+        // the file writing is done in a background thread, to avoid slowing down the processing loop
+        stixels_data_sequence_p->enable_asynchronous_writes();
+        stixels_data_sequence_p->enable_index_footer(); // allows random access when reading the recording
 
         log_info() << "Created recording file " << filename << std::endl;
     }
@@ -0,0 +1,100 @@
+#ifndef BOUNDEDQUEUE_HPP
+#define BOUNDEDQUEUE_HPP
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <deque>
+#include <stdexcept>
+
+namespace doppia {
+
+/// First-in first-out queue shared between a producer thread and a consumer thread.
+/// push blocks while the queue is full (back-pressure on the producer),
+/// pop blocks while the queue is empty.
+/// Once closed, push and pop return false instead of blocking (pop still returns the queued elements),
+/// this is used to stop the threads of a pipeline.
+template<typename T>
+class BoundedQueue: private boost::noncopyable
+{
+public:
+
+    BoundedQueue(const size_t max_size_)
+        : max_size(max_size_), is_closed(false)
+    {
+        if(max_size == 0)
+        {
+            throw std::invalid_argument("BoundedQueue max_size should be at least one");
+        }
+        return;
+    }
+
+    /// @returns false if the queue was closed (the element is not queued)
+    bool push(const T &element)
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        while((elements.size() >= max_size) and (is_closed == false))
+        {
+            not_full.wait(lock);
+        }
+
+        if(is_closed)
+        {
+            return false;
+        }
+
+        elements.push_back(element);
+        not_empty.notify_one();
+        return true;
+    }
+
+    /// @returns false if the queue is closed and empty (element is not set)
+    bool pop(T &element)
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        while(elements.empty() and (is_closed == false))
+        {
+            not_empty.wait(lock);
+        }
+
+        if(elements.empty())
+        {
+            return false;
+        }
+
+        element = elements.front();
+        elements.pop_front();
+        not_full.notify_one();
+        return true;
+    }
+
+    /// wakes up all the waiting threads
+    void close()
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        is_closed = true;
+        not_full.notify_all();
+        not_empty.notify_all();
+        return;
+    }
+
+    size_t size() const
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        return elements.size();
+    }
+
+protected:
+
+    const size_t max_size;
+    bool is_closed;
+    std::deque<T> elements;
+
+    mutable boost::mutex mutex;
+    boost::condition_variable not_full, not_empty;
+};
+
+} // end of namespace doppia
+
+#endif // BOUNDEDQUEUE_HPP
@@ -2,6 +2,8 @@
 #define DATASEQUENCE_HPP
 
 #include "DataSequenceHeader.pb.h"
+#include "DataSequenceAsyncWriter.hpp"
+#include "DataSequenceIndex.hpp"
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
@@ -13,6 +15,8 @@
 #include <fstream>
 #include <string>
 #include <map>
+#include <vector>
+#include <climits>
 
 #include <stdexcept>
 #include <utility> // std::make_pair
@@ -33,7 +37,14 @@ namespace doppia
 ///
 /// @see http://code.google.com/p/protobuf/
 /// @see http://code.google.com/apis/protocolbuffers/docs/techniques.html#large-data
+///
+/// In read mode the file is memory mapped,
+/// the messages can be read sequentially, at random (read_at) or in parallel (for_each_in_parallel).
+/// Random access is O(1) when the file has an index footer (see enable_index_footer),
+/// otherwise the index is built on first use, by jumping from one message size to the next.
+///
 /// @see DataSequenceHeader.proto
+/// @see DataSequenceIndex.hpp
 template<typename DataType>
 class DataSequence
 {
@@ -41,6 +52,7 @@ public:
 
     typedef DataType data_type;
     typedef std::map<std::string, std::string> attributes_t;
+    typedef DataSequenceAsyncWriter::OverflowPolicy overflow_policy_t;
 
     /// defaults to read mode
     DataSequence(std::string filename);
@@ -57,6 +69,18 @@ public:
     /// Read the new message
     void read(DataType &data);
 
+    /// Read the message number message_index (starting from zero), does not change the read() position
+    void read_at(const size_t message_index, DataType &data);
+
+    /// @returns the number of messages in the file (read mode only)
+    size_t get_num_messages();
+
+    /// Calls functor(message_index, data) for every message of the file.
+    /// The file is split in contiguous chunks, one per OpenMP thread,
+    /// so the functor is called concurrently and should not throw.
+    template<typename Functor>
+    void for_each_in_parallel(Functor &functor);
+
     /// Write one more message into the file
     void write(const DataType &data);
 
@@ -67,8 +91,26 @@ public:
     void operator<<(const DataType &data);
 
     /// flush all pending data to disk
+    /// in asynchronous mode, blocks until all the messages written before this call are in the file
     void flush();
 
+    /// Only valid in write mode.
+    /// After this call, write only serializes the message,
+    /// the file writing is done (in large blocks) by a background thread.
+    /// Use this when recording from a real time loop.
+    /// @param max_queued_messages when reached, the overflow_policy decides if write blocks or drops the message
+    void enable_asynchronous_writes(const size_t max_queued_messages = 256,
+                                    const overflow_policy_t overflow_policy = DataSequenceAsyncWriter::BlockOnOverflow);
+
+    /// @returns the number of messages dropped by write in asynchronous mode
+    boost::uint64_t get_num_dropped_messages() const;
+
+    /// Only valid in write mode.
+    /// An index of the messages offsets is appended to the file when the DataSequence is destroyed,
+    /// to allow O(1) random access when reading.
+    /// Readers older than the index footer will fail on the last (index) message.
+    void enable_index_footer();
+
 protected:
 
     void init(std::string filename, std::ios::openmode mode, const attributes_t &attributes);
@@ -79,12 +121,33 @@ protected:
     attributes_t attributes;
     boost::scoped_ptr<std::fstream> file_stream_p;
 
-    boost::scoped_ptr<google::protobuf::io::ZeroCopyInputStream> input_stream_p;
-    boost::scoped_ptr<google::protobuf::io::CodedInputStream> input_coded_stream_p;
+    /// read mode --
+    /// @{
+    boost::scoped_ptr<MemoryMappedFile> mapped_file_p;
+    boost::uint64_t first_message_offset, read_offset, data_end_offset;
+    data_sequence_offsets_t messages_offsets;
+    bool messages_offsets_are_ready;
+
+    void build_messages_offsets();
+
+    /// parses the message that starts at the given byte offset, thread safe
+    /// @returns false if the message could not be parsed
+    bool parse_message_at(const boost::uint64_t offset, DataType &data) const;
+    /// @}
 
     boost::scoped_ptr<google::protobuf::io::ZeroCopyOutputStream> output_stream_p;
     boost::scoped_ptr<google::protobuf::io::CodedOutputStream> output_coded_stream_p;
 
+    boost::scoped_ptr<DataSequenceAsyncWriter> async_writer_p;
+
+    /// write mode index --
+    /// @{
+    bool should_write_index_footer;
+    boost::uint64_t next_message_offset;
+    data_sequence_offsets_t written_messages_offsets;
+
+    void add_written_message_offset(const boost::uint64_t message_offset, const boost::uint64_t message_size);
+    /// @}
 };
 
 
@@ -131,6 +194,13 @@ void DataSequence<DataType>::init(std::string filename, std::ios::openmode mode,
     // compatible with the version of the headers we compiled against.
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
+    first_message_offset = 0;
+    read_offset = 0;
+    data_end_offset = 0;
+    messages_offsets_are_ready = false;
+    should_write_index_footer = false;
+    next_message_offset = 0;
+
 
     // open the file --
     if(mode == std::ios::in)
@@ -145,13 +215,7 @@ void DataSequence<DataType>::init(std::string filename, std::ios::openmode mode,
             throw std::runtime_error("Could not find the indicated DataSequence file");
         }
 
-        file_stream_p.reset(new std::fstream(filename.c_str(), ios::in | ios::binary));
-
-        using google::protobuf::io::IstreamInputStream;
-        using google::protobuf::io::CodedInputStream;
-
-        input_stream_p.reset(new IstreamInputStream(file_stream_p.get()));
-        input_coded_stream_p.reset(new CodedInputStream(input_stream_p.get()));
+        mapped_file_p.reset(new MemoryMappedFile(filename));
 
         read_header();
     }
@@ -181,24 +245,24 @@ void DataSequence<DataType>::read_header()
 {
     using doppia_protobuf::DataSequenceHeader;
 
-    assert(input_stream_p);
+    assert(mapped_file_p);
 
-    DataSequenceHeader header;
+    const boost::uint8_t *data = mapped_file_p->data();
+    const boost::uint64_t file_size = mapped_file_p->size();
 
-    boost::uint64_t size;
-    bool success = input_coded_stream_p->ReadLittleEndian64(&size);
+    DataSequenceHeader header;
 
-    const bool use_zero_copy_stream = false;
-    if(use_zero_copy_stream)
+    bool success = (file_size >= sizeof(boost::uint64_t));
+    if(success)
     {
-        success &=
-                header.ParseFromBoundedZeroCopyStream(input_stream_p.get(), static_cast<int>(size));
-    }
-    else
-    { // work around
-        std::string buffer;
-        input_coded_stream_p->ReadString(&buffer, size);
-        success &= header.ParseFromString(buffer);
+        const boost::uint64_t size = read_data_sequence_message_size(data);
+        success = (size <= file_size - sizeof(boost::uint64_t)) and (size <= INT_MAX);
+        if(success)
+        {
+            google::protobuf::io::ArrayInputStream header_stream(data + sizeof(boost::uint64_t), static_cast<int>(size));
+            success = header.ParseFromZeroCopyStream(&header_stream);
+            first_message_offset = sizeof(boost::uint64_t) + size;
+        }
     }
 
     if (success == false)
@@ -216,6 +280,15 @@ void DataSequence<DataType>::read_header()
         attributes.insert(std::make_pair(attribute.name(), attribute.value()));
     }
 
+    // the index footer (if any) delimits the messages data
+    messages_offsets_are_ready = read_data_sequence_index(data, file_size, first_message_offset,
+                                                          messages_offsets, data_end_offset);
+    if(messages_offsets_are_ready == false)
+    {
+        data_end_offset = file_size;
+    }
+    read_offset = first_message_offset;
+
     return;
 }
 
@@ -235,7 +308,7 @@ void DataSequence<DataType>::write_header()
         attribute_p->set_name(attribute.first);
         attribute_p->set_value(attribute.second);
     }
-    boost::uint64_t size = header.ByteSize();
+    boost::uint64_t size = header.ByteSizeLong();
     output_coded_stream_p->WriteLittleEndian64(size);
     //const bool success = header.SerializeToZeroCopyStream(output_stream_p.get());
     const bool success = header.SerializeToCodedStream(output_coded_stream_p.get());
@@ -245,6 +318,8 @@ void DataSequence<DataType>::write_header()
         throw std::runtime_error("Failed to write the DataSequenceHeader");
     }
 
+    next_message_offset = sizeof(boost::uint64_t) + size;
+
     return;
 }
 
@@ -254,24 +329,87 @@ DataSequence<DataType>::~DataSequence()
 {
     // file manipulation objects are interlinked,
     // so the destruction needs to be in a specific order
-    input_coded_stream_p.reset();
-    input_stream_p.reset();
+    async_writer_p.reset(); // writes the pending messages
 
     output_coded_stream_p.reset();
     output_stream_p.reset();
 
-    file_stream_p->close();
-    file_stream_p.reset();
+    if(file_stream_p)
+    {
+        if(should_write_index_footer)
+        {
+            write_data_sequence_index(*file_stream_p, written_messages_offsets);
+        }
+
+        file_stream_p->close();
+        file_stream_p.reset();
+    }
+
+    mapped_file_p.reset();
     return;
 }
 
 template<typename DataType>
 void DataSequence<DataType>::flush()
 {
+    if(async_writer_p)
+    {
+        async_writer_p->flush();
+    }
+    else
+    {
+        file_stream_p->flush();
+    }
+    return;
+}
+
+
+template<typename DataType>
+void DataSequence<DataType>::enable_asynchronous_writes(const size_t max_queued_messages,
+                                                        const overflow_policy_t overflow_policy)
+{
+    if(not output_coded_stream_p)
+    {
+        if(async_writer_p)
+        {
+            throw std::runtime_error("DataSequence<DataType>::enable_asynchronous_writes was already called");
+        }
+        throw std::runtime_error("DataSequence<DataType>::enable_asynchronous_writes is only valid in write mode");
+    }
+
+    // the coded stream buffers data, destroying it pushes the buffered data into the file stream
+    output_coded_stream_p.reset();
+    output_stream_p.reset();
     file_stream_p->flush();
+
+    async_writer_p.reset(new DataSequenceAsyncWriter(*file_stream_p, max_queued_messages, overflow_policy));
+    return;
+}
+
+
+template<typename DataType>
+void DataSequence<DataType>::enable_index_footer()
+{
+    if(not file_stream_p)
+    {
+        throw std::runtime_error("DataSequence<DataType>::enable_index_footer is only valid in write mode");
+    }
+
+    should_write_index_footer = true;
     return;
 }
 
+
+template<typename DataType>
+boost::uint64_t DataSequence<DataType>::get_num_dropped_messages() const
+{
+    if(async_writer_p)
+    {
+        return async_writer_p->get_num_dropped_messages();
+    }
+    return 0;
+}
+
 template<typename DataType>
 const typename DataSequence<DataType>::attributes_t & DataSequence<DataType>::get_attributes()
 {
@@ -289,31 +427,130 @@ void DataSequence<DataType>::operator>>(DataType &data)
 template<typename DataType>
 void DataSequence<DataType>::read(DataType &data)
 {
-    boost::uint64_t size;
-    const bool read_size_success = input_coded_stream_p->ReadLittleEndian64(&size);
+    if(not mapped_file_p)
+    {
+        throw std::runtime_error("DataSequence<DataType>::read is only valid in read mode");
+    }
 
     bool read_data_success = false;
+    boost::uint64_t size = 0;
+    if(read_offset + sizeof(boost::uint64_t) <= data_end_offset)
+    {
+        size = read_data_sequence_message_size(mapped_file_p->data() + read_offset);
+        read_data_success = (size <= data_end_offset - read_offset - sizeof(boost::uint64_t))
+                and parse_message_at(read_offset, data);
+    }
 
-    const bool use_zero_copy_stream = false;
-    if(use_zero_copy_stream)
+    if (read_data_success == false)
     {
-        read_data_success =
-                    data.ParseFromBoundedZeroCopyStream(input_stream_p.get(), static_cast<int>(size));
+        throw std::runtime_error("Failed to read a data message during DataSequence<DataType>::read");
     }
-    else
-    { // work around
-        std::string buffer;
-        input_coded_stream_p->ReadString(&buffer, size);
-        read_data_success = data.ParseFromString(buffer);
+
+    read_offset += sizeof(boost::uint64_t) + size;
+    return;
+}
+
+
+template<typename DataType>
+bool DataSequence<DataType>::parse_message_at(const boost::uint64_t offset, DataType &data) const
+{
+    const boost::uint8_t *message_data = mapped_file_p->data() + offset;
+    const boost::uint64_t size = read_data_sequence_message_size(message_data);
+    if(size > INT_MAX)
+    {
+        return false;
+    }
+
+    // one stream per message, so that files larger than the protobuf streams limits can be read
+    google::protobuf::io::ArrayInputStream message_stream(message_data + sizeof(boost::uint64_t),
+                                                          static_cast<int>(size));
+    return data.ParseFromZeroCopyStream(&message_stream);
+}
+
+
+template<typename DataType>
+void DataSequence<DataType>::build_messages_offsets()
+{
+    if(not mapped_file_p)
+    {
+        throw std::runtime_error("DataSequence<DataType> random access is only valid in read mode");
     }
 
-    if (read_size_success == false or read_data_success == false)
+    if(messages_offsets_are_ready == false)
     {
-        throw std::runtime_error("Failed to read a data message during DataSequence<DataType>::read");
+        scan_data_sequence_offsets(mapped_file_p->data(), data_end_offset, first_message_offset, messages_offsets);
+        messages_offsets_are_ready = true;
     }
+
     return;
 }
 
+
+template<typename DataType>
+size_t DataSequence<DataType>::get_num_messages()
+{
+    build_messages_offsets();
+    return messages_offsets.size();
+}
+
+
+template<typename DataType>
+void DataSequence<DataType>::read_at(const size_t message_index, DataType &data)
+{
+    build_messages_offsets();
+
+    if(message_index >= messages_offsets.size())
+    {
+        throw std::out_of_range("DataSequence<DataType>::read_at received an index beyond the last message");
+    }
+
+    if(parse_message_at(messages_offsets[message_index], data) == false)
+    {
+        throw std::runtime_error("Failed to read a data message during DataSequence<DataType>::read_at");
+    }
+
+    return;
+}
+
+
+template<typename DataType>
+template<typename Functor>
+void DataSequence<DataType>::for_each_in_parallel(Functor &functor)
+{
+    build_messages_offsets();
+
+    const int num_messages = static_cast<int>(messages_offsets.size());
+    int num_failed_messages = 0;
+
+#pragma omp parallel
+    {
+        DataType data;
+
+        // static schedule, each thread reads a contiguous part of the file
+#pragma omp for schedule(static) reduction(+:num_failed_messages)
+        for(int message_index = 0; message_index < num_messages; message_index += 1)
+        {
+            data.Clear();
+            if(parse_message_at(messages_offsets[message_index], data))
+            {
+                functor(static_cast<size_t>(message_index), data);
+            }
+            else
+            {
+                num_failed_messages += 1;
+            }
+        } // end of "for each message"
+    } // end of "omp parallel"
+
+    if(num_failed_messages > 0)
+    {
+        throw std::runtime_error("Failed to read some data messages during DataSequence<DataType>::for_each_in_parallel");
+    }
+
+    return;
+}
+
+
 template<typename DataType>
 void DataSequence<DataType>::operator<<(const DataType &data)
 {
@@ -325,7 +562,35 @@ void DataSequence<DataType>::operator<<(const DataType &data)
 template<typename DataType>
 void DataSequence<DataType>::write(const DataType &data)
 {
-    boost::uint64_t size = data.ByteSize();
+    boost::uint64_t size = data.ByteSizeLong();
+    const boost::uint64_t message_offset = next_message_offset;
+
+    if(async_writer_p)
+    {
+        // same format as the synchronous case, but serialized in memory
+        std::string *serialized_data_p = new std::string();
+        bool success = false;
+        {
+            google::protobuf::io::StringOutputStream string_stream(serialized_data_p);
+            google::protobuf::io::CodedOutputStream coded_stream(&string_stream);
+            coded_stream.WriteLittleEndian64(size);
+            success = data.SerializeToCodedStream(&coded_stream) and (coded_stream.HadError() == false);
+        }
+
+        if(success == false)
+        {
+            delete serialized_data_p;
+            throw std::runtime_error("Failed to serialize a data message during DataSequence<DataType>::write");
+        }
+
+        // the writer takes ownership
+        if(async_writer_p->push(serialized_data_p))
+        {
+            add_written_message_offset(message_offset, size);
+        }
+        return;
+    }
+
     output_coded_stream_p->WriteLittleEndian64(size);
     //const bool success = data.SerializeToZeroCopyStream(output_stream_p.get());
     //const bool success = data.SerializeToOstream(file_stream_p.get());
@@ -336,6 +601,20 @@ void DataSequence<DataType>::write(const DataType &data)
         throw std::runtime_error("Failed to write a data message during DataSequence<DataType>::write");
     }
 
+    add_written_message_offset(message_offset, size);
+    return;
+}
+
+
+template<typename DataType>
+void DataSequence<DataType>::add_written_message_offset(const boost::uint64_t message_offset,
+                                                       const boost::uint64_t message_size)
+{
+    if(should_write_index_footer)
+    {
+        written_messages_offsets.push_back(message_offset);
+    }
+    next_message_offset = message_offset + sizeof(boost::uint64_t) + message_size;
     return;
 }
 
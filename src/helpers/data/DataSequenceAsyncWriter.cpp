@@ -0,0 +1,168 @@
+#include "DataSequenceAsyncWriter.hpp"
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <stdexcept>
+
+namespace doppia
+{
+
+namespace
+{
+/// the writer thread checks the queue at least this often,
+/// so that push does not need to wake it up (no system call on the producer side)
+const boost::posix_time::milliseconds writer_thread_polling_period(5);
+} // end of anonymous namespace
+
+
+DataSequenceAsyncWriter::DataSequenceAsyncWriter(std::ostream &output_stream_,
+                                                 const size_t max_queued_messages,
+                                                 const OverflowPolicy overflow_policy_,
+                                                 const size_t batch_size_in_bytes_)
+    : output_stream(output_stream_),
+      overflow_policy(overflow_policy_),
+      batch_size_in_bytes(batch_size_in_bytes_),
+      messages_queue(max_queued_messages),
+      num_pushed_messages(0), num_written_messages(0), num_dropped_messages(0),
+      stop_requested(false), had_write_error(false)
+{
+    if(max_queued_messages == 0)
+    {
+        throw std::invalid_argument("DataSequenceAsyncWriter requires max_queued_messages > 0");
+    }
+
+    writer_thread = boost::thread(boost::bind(&DataSequenceAsyncWriter::writer_thread_function, this));
+    return;
+}
+
+
+DataSequenceAsyncWriter::~DataSequenceAsyncWriter()
+{
+    stop_requested = true;
+    messages_pushed_condition.notify_one();
+    writer_thread.join();
+
+    // the writer thread only stops once the queue is empty, this is just for safety
+    std::string *message_p = NULL;
+    while(messages_queue.pop(message_p))
+    {
+        delete message_p;
+    }
+    return;
+}
+
+
+void DataSequenceAsyncWriter::check_write_error() const
+{
+    if(had_write_error)
+    {
+        throw std::runtime_error("DataSequenceAsyncWriter failed to write to the output stream");
+    }
+    return;
+}
+
+
+bool DataSequenceAsyncWriter::push(std::string *serialized_message_p)
+{
+    check_write_error();
+
+    if(overflow_policy == DropOnOverflow)
+    {
+        if(messages_queue.push(serialized_message_p) == false)
+        {
+            delete serialized_message_p;
+            num_dropped_messages += 1;
+            return false;
+        }
+    }
+    else
+    { // BlockOnOverflow
+        while(messages_queue.push(serialized_message_p) == false)
+        {
+            boost::mutex::scoped_lock lock(mutex);
+            messages_written_condition.timed_wait(lock, writer_thread_polling_period);
+        }
+    }
+
+    num_pushed_messages += 1;
+    return true;
+}
+
+
+void DataSequenceAsyncWriter::flush()
+{
+    const boost::uint64_t num_messages_to_write = num_pushed_messages;
+
+    messages_pushed_condition.notify_one();
+    {
+        boost::mutex::scoped_lock lock(mutex);
+        while(num_written_messages < num_messages_to_write)
+        {
+            messages_written_condition.timed_wait(lock, writer_thread_polling_period);
+        }
+    }
+
+    check_write_error();
+    return;
+}
+
+
+boost::uint64_t DataSequenceAsyncWriter::get_num_dropped_messages() const
+{
+    return num_dropped_messages;
+}
+
+
+void DataSequenceAsyncWriter::writer_thread_function()
+{
+    std::string batch;
+    batch.reserve(batch_size_in_bytes);
+
+    while(true)
+    {
+        boost::uint64_t num_batch_messages = 0;
+        std::string *message_p = NULL;
+        while((batch.size() < batch_size_in_bytes) and messages_queue.pop(message_p))
+        {
+            batch.append(*message_p);
+            delete message_p;
+            num_batch_messages += 1;
+        }
+
+        if(num_batch_messages > 0)
+        {
+            if(had_write_error == false)
+            {
+                output_stream.write(batch.data(), batch.size());
+                output_stream.flush();
+                had_write_error = output_stream.fail();
+            }
+            batch.clear();
+
+            {
+                // after a write error the messages are discarded,
+                // but still counted as written so that flush does not wait forever
+                boost::mutex::scoped_lock lock(mutex);
+                num_written_messages += num_batch_messages;
+            }
+            messages_written_condition.notify_all();
+            continue;
+        }
+
+        // stop_requested is set after the last push,
+        // the queue is checked again since a message may have arrived after the pop loop
+        if(stop_requested and (messages_queue.read_available() == 0))
+        {
+            break;
+        }
+
+        boost::mutex::scoped_lock lock(mutex);
+        messages_pushed_condition.timed_wait(lock, writer_thread_polling_period);
+    } // end of "while not stop requested"
+
+    return;
+}
+
+
+} // end of namespace doppia
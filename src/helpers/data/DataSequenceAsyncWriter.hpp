@@ -0,0 +1,77 @@
+#ifndef DATASEQUENCEASYNCWRITER_HPP
+#define DATASEQUENCEASYNCWRITER_HPP
+
+#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <ostream>
+#include <string>
+
+namespace doppia
+{
+
+/// Writes already serialized DataSequence messages from a background thread.
+///
+/// The producer (one single thread) only pushes a pointer into a lock-free queue,
+/// the background thread concatenates the queued messages and writes them in large blocks.
+/// This allows to record data from a real time loop without adding jitter due to the disk access.
+/// @see DataSequence::enable_asynchronous_writes
+class DataSequenceAsyncWriter: private boost::noncopyable
+{
+public:
+
+    /// what push does when max_queued_messages are waiting to be written
+    enum OverflowPolicy
+    {
+        BlockOnOverflow, ///< wait until the background thread writes some messages (no data loss)
+        DropOnOverflow ///< drop the new message (the producer never waits)
+    };
+
+    /// the output_stream must outlive this writer and should not be used by anyone else in the mean time
+    DataSequenceAsyncWriter(std::ostream &output_stream,
+                            const size_t max_queued_messages,
+                            const OverflowPolicy overflow_policy,
+                            const size_t batch_size_in_bytes = 1 << 20);
+
+    /// writes all the pending messages, then stops the background thread
+    ~DataSequenceAsyncWriter();
+
+    /// takes ownership of serialized_message_p (allocated with new)
+    /// @returns false if the message was dropped
+    bool push(std::string *serialized_message_p);
+
+    /// blocks until all the messages pushed before this call are written
+    /// and the output stream is flushed (data handed to the operating system)
+    void flush();
+
+    boost::uint64_t get_num_dropped_messages() const;
+
+protected:
+
+    std::ostream &output_stream;
+    const OverflowPolicy overflow_policy;
+    const size_t batch_size_in_bytes;
+
+    boost::lockfree::spsc_queue<std::string *> messages_queue;
+
+    /// num_pushed_messages is only modified by the producer, num_written_messages by the writer thread
+    boost::atomic<boost::uint64_t> num_pushed_messages, num_written_messages, num_dropped_messages;
+    boost::atomic<bool> stop_requested, had_write_error;
+
+    boost::mutex mutex;
+    boost::condition_variable messages_pushed_condition, messages_written_condition;
+
+    boost::thread writer_thread;
+
+    void writer_thread_function();
+    void check_write_error() const;
+};
+
+} // end of namespace doppia
+
+#endif // DATASEQUENCEASYNCWRITER_HPP
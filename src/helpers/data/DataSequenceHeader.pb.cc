@@ -1,614 +1,616 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: DataSequenceHeader.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "DataSequenceHeader.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
-
-namespace {
-
-const ::google::protobuf::Descriptor* DataSequenceAttribute_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DataSequenceAttribute_reflection_ = NULL;
-const ::google::protobuf::Descriptor* DataSequenceHeader_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DataSequenceHeader_reflection_ = NULL;
-
-}  // namespace
+PROTOBUF_PRAGMA_INIT_SEG
 
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-void protobuf_AssignDesc_DataSequenceHeader_2eproto() {
-  protobuf_AddDesc_DataSequenceHeader_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "DataSequenceHeader.proto");
-  GOOGLE_CHECK(file != NULL);
-  DataSequenceAttribute_descriptor_ = file->message_type(0);
-  static const int DataSequenceAttribute_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceAttribute, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceAttribute, value_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR DataSequenceAttribute::DataSequenceAttribute(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct DataSequenceAttributeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DataSequenceAttributeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DataSequenceAttributeDefaultTypeInternal() {}
+  union {
+    DataSequenceAttribute _instance;
   };
-  DataSequenceAttribute_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DataSequenceAttribute_descriptor_,
-      DataSequenceAttribute::default_instance_,
-      DataSequenceAttribute_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceAttribute, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceAttribute, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DataSequenceAttribute));
-  DataSequenceHeader_descriptor_ = file->message_type(1);
-  static const int DataSequenceHeader_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceHeader, attributes_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataSequenceAttributeDefaultTypeInternal _DataSequenceAttribute_default_instance_;
+PROTOBUF_CONSTEXPR DataSequenceHeader::DataSequenceHeader(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.attributes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DataSequenceHeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DataSequenceHeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DataSequenceHeaderDefaultTypeInternal() {}
+  union {
+    DataSequenceHeader _instance;
   };
-  DataSequenceHeader_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DataSequenceHeader_descriptor_,
-      DataSequenceHeader::default_instance_,
-      DataSequenceHeader_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceHeader, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DataSequenceHeader, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DataSequenceHeader));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_DataSequenceHeader_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DataSequenceAttribute_descriptor_, &DataSequenceAttribute::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DataSequenceHeader_descriptor_, &DataSequenceHeader::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_DataSequenceHeader_2eproto() {
-  delete DataSequenceAttribute::default_instance_;
-  delete DataSequenceAttribute_reflection_;
-  delete DataSequenceHeader::default_instance_;
-  delete DataSequenceHeader_reflection_;
-}
-
-void protobuf_AddDesc_DataSequenceHeader_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\030DataSequenceHeader.proto\022\017doppia_proto"
-    "buf\"4\n\025DataSequenceAttribute\022\014\n\004name\030\001 \002"
-    "(\t\022\r\n\005value\030\002 \002(\t\"P\n\022DataSequenceHeader\022"
-    ":\n\nattributes\030\003 \003(\0132&.doppia_protobuf.Da"
-    "taSequenceAttribute", 179);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "DataSequenceHeader.proto", &protobuf_RegisterTypes);
-  DataSequenceAttribute::default_instance_ = new DataSequenceAttribute();
-  DataSequenceHeader::default_instance_ = new DataSequenceHeader();
-  DataSequenceAttribute::default_instance_->InitAsDefaultInstance();
-  DataSequenceHeader::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_DataSequenceHeader_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_DataSequenceHeader_2eproto {
-  StaticDescriptorInitializer_DataSequenceHeader_2eproto() {
-    protobuf_AddDesc_DataSequenceHeader_2eproto();
-  }
-} static_descriptor_initializer_DataSequenceHeader_2eproto_;
-
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataSequenceHeaderDefaultTypeInternal _DataSequenceHeader_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_DataSequenceHeader_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_DataSequenceHeader_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_DataSequenceHeader_2eproto = nullptr;
+
+const uint32_t TableStruct_DataSequenceHeader_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceAttribute, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceAttribute, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceAttribute, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceAttribute, _impl_.value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceHeader, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DataSequenceHeader, _impl_.attributes_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::doppia_protobuf::DataSequenceAttribute)},
+  { 10, -1, -1, sizeof(::doppia_protobuf::DataSequenceHeader)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_DataSequenceAttribute_default_instance_._instance,
+  &::doppia_protobuf::_DataSequenceHeader_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_DataSequenceHeader_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\030DataSequenceHeader.proto\022\017doppia_proto"
+  "buf\"4\n\025DataSequenceAttribute\022\014\n\004name\030\001 \002"
+  "(\t\022\r\n\005value\030\002 \002(\t\"P\n\022DataSequenceHeader\022"
+  ":\n\nattributes\030\003 \003(\0132&.doppia_protobuf.Da"
+  "taSequenceAttribute"
+  ;
+static ::_pbi::once_flag descriptor_table_DataSequenceHeader_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_DataSequenceHeader_2eproto = {
+    false, false, 179, descriptor_table_protodef_DataSequenceHeader_2eproto,
+    "DataSequenceHeader.proto",
+    &descriptor_table_DataSequenceHeader_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_DataSequenceHeader_2eproto::offsets,
+    file_level_metadata_DataSequenceHeader_2eproto, file_level_enum_descriptors_DataSequenceHeader_2eproto,
+    file_level_service_descriptors_DataSequenceHeader_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_DataSequenceHeader_2eproto_getter() {
+  return &descriptor_table_DataSequenceHeader_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_DataSequenceHeader_2eproto(&descriptor_table_DataSequenceHeader_2eproto);
+namespace doppia_protobuf {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int DataSequenceAttribute::kNameFieldNumber;
-const int DataSequenceAttribute::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-DataSequenceAttribute::DataSequenceAttribute()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class DataSequenceAttribute::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DataSequenceAttribute>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void DataSequenceAttribute::InitAsDefaultInstance() {
+DataSequenceAttribute::DataSequenceAttribute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.DataSequenceAttribute)
 }
-
 DataSequenceAttribute::DataSequenceAttribute(const DataSequenceAttribute& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DataSequenceAttribute::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DataSequenceAttribute* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.DataSequenceAttribute)
+}
+
+inline void DataSequenceAttribute::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.value_){}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 DataSequenceAttribute::~DataSequenceAttribute() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.DataSequenceAttribute)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DataSequenceAttribute::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
-  }
-  if (this != default_instance_) {
-  }
+inline void DataSequenceAttribute::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  _impl_.value_.Destroy();
 }
 
 void DataSequenceAttribute::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DataSequenceAttribute::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DataSequenceAttribute_descriptor_;
-}
-
-const DataSequenceAttribute& DataSequenceAttribute::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_DataSequenceHeader_2eproto();  return *default_instance_;
-}
-
-DataSequenceAttribute* DataSequenceAttribute::default_instance_ = NULL;
-
-DataSequenceAttribute* DataSequenceAttribute::New() const {
-  return new DataSequenceAttribute;
+  _impl_._cached_size_.Set(size);
 }
 
 void DataSequenceAttribute::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.DataSequenceAttribute)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
     }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool DataSequenceAttribute::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* DataSequenceAttribute::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_value;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.DataSequenceAttribute.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string value = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_value()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->value().data(), this->value().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.DataSequenceAttribute.value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void DataSequenceAttribute::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DataSequenceAttribute::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.DataSequenceAttribute)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-  
-  // required string value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->value(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.DataSequenceAttribute.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
-}
 
-::google::protobuf::uint8* DataSequenceAttribute::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-  
   // required string value = 2;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->value(), target);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.DataSequenceAttribute.value");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_value(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.DataSequenceAttribute)
   return target;
 }
 
-int DataSequenceAttribute::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t DataSequenceAttribute::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.DataSequenceAttribute)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
     // required string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
-    
-    // required string value = 2;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->value());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_value()) {
+    // required string value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t DataSequenceAttribute::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.DataSequenceAttribute)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string name = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required string value = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
 
-void DataSequenceAttribute::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DataSequenceAttribute* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DataSequenceAttribute*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DataSequenceAttribute::MergeFrom(const DataSequenceAttribute& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DataSequenceAttribute::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DataSequenceAttribute::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DataSequenceAttribute::GetClassData() const { return &_class_data_; }
+
+
+void DataSequenceAttribute::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DataSequenceAttribute*>(&to_msg);
+  auto& from = static_cast<const DataSequenceAttribute&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.DataSequenceAttribute)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DataSequenceAttribute::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DataSequenceAttribute::CopyFrom(const DataSequenceAttribute& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.DataSequenceAttribute)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DataSequenceAttribute::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void DataSequenceAttribute::Swap(DataSequenceAttribute* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DataSequenceAttribute::InternalSwap(DataSequenceAttribute* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata DataSequenceAttribute::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DataSequenceAttribute_descriptor_;
-  metadata.reflection = DataSequenceAttribute_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DataSequenceAttribute::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_DataSequenceHeader_2eproto_getter, &descriptor_table_DataSequenceHeader_2eproto_once,
+      file_level_metadata_DataSequenceHeader_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int DataSequenceHeader::kAttributesFieldNumber;
-#endif  // !_MSC_VER
+class DataSequenceHeader::_Internal {
+ public:
+};
 
-DataSequenceHeader::DataSequenceHeader()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+DataSequenceHeader::DataSequenceHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.DataSequenceHeader)
 }
-
-void DataSequenceHeader::InitAsDefaultInstance() {
-}
-
 DataSequenceHeader::DataSequenceHeader(const DataSequenceHeader& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void DataSequenceHeader::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DataSequenceHeader* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attributes_){from._impl_.attributes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.DataSequenceHeader)
+}
+
+inline void DataSequenceHeader::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.attributes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DataSequenceHeader::~DataSequenceHeader() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.DataSequenceHeader)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void DataSequenceHeader::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void DataSequenceHeader::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.attributes_.~RepeatedPtrField();
 }
 
 void DataSequenceHeader::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* DataSequenceHeader::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DataSequenceHeader_descriptor_;
-}
-
-const DataSequenceHeader& DataSequenceHeader::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_DataSequenceHeader_2eproto();  return *default_instance_;
-}
-
-DataSequenceHeader* DataSequenceHeader::default_instance_ = NULL;
-
-DataSequenceHeader* DataSequenceHeader::New() const {
-  return new DataSequenceHeader;
+  _impl_._cached_size_.Set(size);
 }
 
 void DataSequenceHeader::Clear() {
-  attributes_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.DataSequenceHeader)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.attributes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool DataSequenceHeader::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* DataSequenceHeader::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_attributes:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_attributes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_attributes;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_attributes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DataSequenceHeader::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.DataSequenceHeader)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void DataSequenceHeader::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
-  for (int i = 0; i < this->attributes_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->attributes(i), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_attributes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_attributes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* DataSequenceHeader::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
-  for (int i = 0; i < this->attributes_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->attributes(i), target);
-  }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.DataSequenceHeader)
   return target;
 }
 
-int DataSequenceHeader::ByteSize() const {
-  int total_size = 0;
-  
+size_t DataSequenceHeader::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.DataSequenceHeader)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
-  total_size += 1 * this->attributes_size();
-  for (int i = 0; i < this->attributes_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->attributes(i));
-  }
-  
-  if (!unknown_fields().empty()) {
+  total_size += 1UL * this->_internal_attributes_size();
+  for (const auto& msg : this->_impl_.attributes_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void DataSequenceHeader::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DataSequenceHeader* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DataSequenceHeader*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DataSequenceHeader::MergeFrom(const DataSequenceHeader& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  attributes_.MergeFrom(from.attributes_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DataSequenceHeader::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DataSequenceHeader::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DataSequenceHeader::GetClassData() const { return &_class_data_; }
 
-void DataSequenceHeader::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void DataSequenceHeader::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DataSequenceHeader*>(&to_msg);
+  auto& from = static_cast<const DataSequenceHeader&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.DataSequenceHeader)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.attributes_.MergeFrom(from._impl_.attributes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DataSequenceHeader::CopyFrom(const DataSequenceHeader& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.DataSequenceHeader)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DataSequenceHeader::IsInitialized() const {
-  
-  for (int i = 0; i < attributes_size(); i++) {
-    if (!this->attributes(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.attributes_))
+    return false;
   return true;
 }
 
-void DataSequenceHeader::Swap(DataSequenceHeader* other) {
-  if (other != this) {
-    attributes_.Swap(&other->attributes_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void DataSequenceHeader::InternalSwap(DataSequenceHeader* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.attributes_.InternalSwap(&other->_impl_.attributes_);
 }
 
-::google::protobuf::Metadata DataSequenceHeader::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DataSequenceHeader_descriptor_;
-  metadata.reflection = DataSequenceHeader_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata DataSequenceHeader::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_DataSequenceHeader_2eproto_getter, &descriptor_table_DataSequenceHeader_2eproto_once,
+      file_level_metadata_DataSequenceHeader_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::DataSequenceAttribute*
+Arena::CreateMaybeMessage< ::doppia_protobuf::DataSequenceAttribute >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::DataSequenceAttribute >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::DataSequenceHeader*
+Arena::CreateMaybeMessage< ::doppia_protobuf::DataSequenceHeader >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::DataSequenceHeader >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
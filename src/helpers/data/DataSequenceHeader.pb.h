@@ -1,346 +1,560 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: DataSequenceHeader.proto
 
-#ifndef PROTOBUF_DataSequenceHeader_2eproto__INCLUDED
-#define PROTOBUF_DataSequenceHeader_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_DataSequenceHeader_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_DataSequenceHeader_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_DataSequenceHeader_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_DataSequenceHeader_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_DataSequenceHeader_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_DataSequenceHeader_2eproto();
-void protobuf_AssignDesc_DataSequenceHeader_2eproto();
-void protobuf_ShutdownFile_DataSequenceHeader_2eproto();
-
 class DataSequenceAttribute;
+struct DataSequenceAttributeDefaultTypeInternal;
+extern DataSequenceAttributeDefaultTypeInternal _DataSequenceAttribute_default_instance_;
 class DataSequenceHeader;
+struct DataSequenceHeaderDefaultTypeInternal;
+extern DataSequenceHeaderDefaultTypeInternal _DataSequenceHeader_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::DataSequenceAttribute* Arena::CreateMaybeMessage<::doppia_protobuf::DataSequenceAttribute>(Arena*);
+template<> ::doppia_protobuf::DataSequenceHeader* Arena::CreateMaybeMessage<::doppia_protobuf::DataSequenceHeader>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
 // ===================================================================
 
-class DataSequenceAttribute : public ::google::protobuf::Message {
+class DataSequenceAttribute final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.DataSequenceAttribute) */ {
  public:
-  DataSequenceAttribute();
-  virtual ~DataSequenceAttribute();
-  
+  inline DataSequenceAttribute() : DataSequenceAttribute(nullptr) {}
+  ~DataSequenceAttribute() override;
+  explicit PROTOBUF_CONSTEXPR DataSequenceAttribute(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   DataSequenceAttribute(const DataSequenceAttribute& from);
-  
+  DataSequenceAttribute(DataSequenceAttribute&& from) noexcept
+    : DataSequenceAttribute() {
+    *this = ::std::move(from);
+  }
+
   inline DataSequenceAttribute& operator=(const DataSequenceAttribute& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DataSequenceAttribute& operator=(DataSequenceAttribute&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DataSequenceAttribute& default_instance();
-  
-  void Swap(DataSequenceAttribute* other);
-  
+  static const DataSequenceAttribute& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DataSequenceAttribute* internal_default_instance() {
+    return reinterpret_cast<const DataSequenceAttribute*>(
+               &_DataSequenceAttribute_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(DataSequenceAttribute& a, DataSequenceAttribute& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DataSequenceAttribute* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DataSequenceAttribute* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  DataSequenceAttribute* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  DataSequenceAttribute* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DataSequenceAttribute>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DataSequenceAttribute& from);
-  void MergeFrom(const DataSequenceAttribute& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DataSequenceAttribute& from) {
+    DataSequenceAttribute::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DataSequenceAttribute* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.DataSequenceAttribute";
+  }
+  protected:
+  explicit DataSequenceAttribute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kValueFieldNumber = 2,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
   // required string value = 2;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 2;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const char* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.DataSequenceAttribute)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_value();
-  inline void clear_has_value();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* name_;
-  ::std::string* value_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_DataSequenceHeader_2eproto();
-  friend void protobuf_AssignDesc_DataSequenceHeader_2eproto();
-  friend void protobuf_ShutdownFile_DataSequenceHeader_2eproto();
-  
-  void InitAsDefaultInstance();
-  static DataSequenceAttribute* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_DataSequenceHeader_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DataSequenceHeader : public ::google::protobuf::Message {
+class DataSequenceHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.DataSequenceHeader) */ {
  public:
-  DataSequenceHeader();
-  virtual ~DataSequenceHeader();
-  
+  inline DataSequenceHeader() : DataSequenceHeader(nullptr) {}
+  ~DataSequenceHeader() override;
+  explicit PROTOBUF_CONSTEXPR DataSequenceHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   DataSequenceHeader(const DataSequenceHeader& from);
-  
+  DataSequenceHeader(DataSequenceHeader&& from) noexcept
+    : DataSequenceHeader() {
+    *this = ::std::move(from);
+  }
+
   inline DataSequenceHeader& operator=(const DataSequenceHeader& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline DataSequenceHeader& operator=(DataSequenceHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const DataSequenceHeader& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DataSequenceHeader& default_instance();
-  
-  void Swap(DataSequenceHeader* other);
-  
+  static inline const DataSequenceHeader* internal_default_instance() {
+    return reinterpret_cast<const DataSequenceHeader*>(
+               &_DataSequenceHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(DataSequenceHeader& a, DataSequenceHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DataSequenceHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DataSequenceHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  DataSequenceHeader* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  DataSequenceHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DataSequenceHeader>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DataSequenceHeader& from);
-  void MergeFrom(const DataSequenceHeader& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DataSequenceHeader& from) {
+    DataSequenceHeader::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DataSequenceHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.DataSequenceHeader";
+  }
+  protected:
+  explicit DataSequenceHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kAttributesFieldNumber = 3,
+  };
   // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
-  inline int attributes_size() const;
-  inline void clear_attributes();
-  static const int kAttributesFieldNumber = 3;
-  inline const ::doppia_protobuf::DataSequenceAttribute& attributes(int index) const;
-  inline ::doppia_protobuf::DataSequenceAttribute* mutable_attributes(int index);
-  inline ::doppia_protobuf::DataSequenceAttribute* add_attributes();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >&
-      attributes() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >*
+  int attributes_size() const;
+  private:
+  int _internal_attributes_size() const;
+  public:
+  void clear_attributes();
+  ::doppia_protobuf::DataSequenceAttribute* mutable_attributes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >*
       mutable_attributes();
-  
+  private:
+  const ::doppia_protobuf::DataSequenceAttribute& _internal_attributes(int index) const;
+  ::doppia_protobuf::DataSequenceAttribute* _internal_add_attributes();
+  public:
+  const ::doppia_protobuf::DataSequenceAttribute& attributes(int index) const;
+  ::doppia_protobuf::DataSequenceAttribute* add_attributes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >&
+      attributes() const;
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.DataSequenceHeader)
  private:
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute > attributes_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_DataSequenceHeader_2eproto();
-  friend void protobuf_AssignDesc_DataSequenceHeader_2eproto();
-  friend void protobuf_ShutdownFile_DataSequenceHeader_2eproto();
-  
-  void InitAsDefaultInstance();
-  static DataSequenceHeader* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute > attributes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_DataSequenceHeader_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // DataSequenceAttribute
 
 // required string name = 1;
+inline bool DataSequenceAttribute::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool DataSequenceAttribute::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_name();
 }
-inline void DataSequenceAttribute::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline void DataSequenceAttribute::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void DataSequenceAttribute::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline const std::string& DataSequenceAttribute::name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DataSequenceAttribute.name)
+  return _internal_name();
 }
-inline void DataSequenceAttribute::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DataSequenceAttribute::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DataSequenceAttribute.name)
 }
-inline const ::std::string& DataSequenceAttribute::name() const {
-  return *name_;
+inline std::string* DataSequenceAttribute::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DataSequenceAttribute.name)
+  return _s;
 }
-inline void DataSequenceAttribute::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline const std::string& DataSequenceAttribute::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void DataSequenceAttribute::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
+inline void DataSequenceAttribute::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline void DataSequenceAttribute::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
+inline std::string* DataSequenceAttribute::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DataSequenceAttribute::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+inline std::string* DataSequenceAttribute::release_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DataSequenceAttribute.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  return name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* DataSequenceAttribute::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void DataSequenceAttribute::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DataSequenceAttribute.name)
 }
 
 // required string value = 2;
+inline bool DataSequenceAttribute::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool DataSequenceAttribute::has_value() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_value();
 }
-inline void DataSequenceAttribute::set_has_value() {
-  _has_bits_[0] |= 0x00000002u;
+inline void DataSequenceAttribute::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void DataSequenceAttribute::clear_has_value() {
-  _has_bits_[0] &= ~0x00000002u;
+inline const std::string& DataSequenceAttribute::value() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DataSequenceAttribute.value)
+  return _internal_value();
 }
-inline void DataSequenceAttribute::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
-  }
-  clear_has_value();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DataSequenceAttribute::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DataSequenceAttribute.value)
 }
-inline const ::std::string& DataSequenceAttribute::value() const {
-  return *value_;
+inline std::string* DataSequenceAttribute::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DataSequenceAttribute.value)
+  return _s;
 }
-inline void DataSequenceAttribute::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline const std::string& DataSequenceAttribute::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void DataSequenceAttribute::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(value);
+inline void DataSequenceAttribute::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline void DataSequenceAttribute::set_value(const char* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
-  }
-  value_->assign(reinterpret_cast<const char*>(value), size);
+inline std::string* DataSequenceAttribute::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline ::std::string* DataSequenceAttribute::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+inline std::string* DataSequenceAttribute::release_value() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DataSequenceAttribute.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
-  return value_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* DataSequenceAttribute::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void DataSequenceAttribute::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DataSequenceAttribute.value)
 }
 
 // -------------------------------------------------------------------
@@ -348,44 +562,56 @@ inline ::std::string* DataSequenceAttribute::release_value() {
 // DataSequenceHeader
 
 // repeated .doppia_protobuf.DataSequenceAttribute attributes = 3;
+inline int DataSequenceHeader::_internal_attributes_size() const {
+  return _impl_.attributes_.size();
+}
 inline int DataSequenceHeader::attributes_size() const {
-  return attributes_.size();
+  return _internal_attributes_size();
 }
 inline void DataSequenceHeader::clear_attributes() {
-  attributes_.Clear();
+  _impl_.attributes_.Clear();
+}
+inline ::doppia_protobuf::DataSequenceAttribute* DataSequenceHeader::mutable_attributes(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DataSequenceHeader.attributes)
+  return _impl_.attributes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >*
+DataSequenceHeader::mutable_attributes() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.DataSequenceHeader.attributes)
+  return &_impl_.attributes_;
+}
+inline const ::doppia_protobuf::DataSequenceAttribute& DataSequenceHeader::_internal_attributes(int index) const {
+  return _impl_.attributes_.Get(index);
 }
 inline const ::doppia_protobuf::DataSequenceAttribute& DataSequenceHeader::attributes(int index) const {
-  return attributes_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DataSequenceHeader.attributes)
+  return _internal_attributes(index);
 }
-inline ::doppia_protobuf::DataSequenceAttribute* DataSequenceHeader::mutable_attributes(int index) {
-  return attributes_.Mutable(index);
+inline ::doppia_protobuf::DataSequenceAttribute* DataSequenceHeader::_internal_add_attributes() {
+  return _impl_.attributes_.Add();
 }
 inline ::doppia_protobuf::DataSequenceAttribute* DataSequenceHeader::add_attributes() {
-  return attributes_.Add();
+  ::doppia_protobuf::DataSequenceAttribute* _add = _internal_add_attributes();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.DataSequenceHeader.attributes)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >&
 DataSequenceHeader::attributes() const {
-  return attributes_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DataSequenceAttribute >*
-DataSequenceHeader::mutable_attributes() {
-  return &attributes_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.DataSequenceHeader.attributes)
+  return _impl_.attributes_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_DataSequenceHeader_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_DataSequenceHeader_2eproto
@@ -0,0 +1,188 @@
+#include "DataSequenceIndex.hpp"
+
+#include <google/protobuf/io/coded_stream.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <stdexcept>
+
+namespace doppia
+{
+
+namespace
+{
+
+const char index_magic[] = "DSINDEX1";
+const size_t index_magic_size = 8;
+const size_t uint64_size = sizeof(boost::uint64_t);
+
+boost::uint64_t read_little_endian64(const boost::uint8_t *data)
+{
+    google::protobuf::uint64 value;
+    google::protobuf::io::CodedInputStream::ReadLittleEndian64FromArray(data, &value);
+    return value;
+}
+
+void write_little_endian64(std::ostream &output_stream, const boost::uint64_t value)
+{
+    google::protobuf::uint8 buffer[uint64_size];
+    google::protobuf::io::CodedOutputStream::WriteLittleEndian64ToArray(value, buffer);
+    output_stream.write(reinterpret_cast<const char *>(buffer), uint64_size);
+    return;
+}
+
+} // end of anonymous namespace
+
+
+MemoryMappedFile::MemoryMappedFile(const std::string &filename)
+    : file_descriptor(-1), mapped_data_p(MAP_FAILED), file_size(0)
+{
+    file_descriptor = ::open(filename.c_str(), O_RDONLY);
+    if(file_descriptor < 0)
+    {
+        throw std::runtime_error("MemoryMappedFile failed to open the file " + filename);
+    }
+
+    struct stat file_status;
+    if((::fstat(file_descriptor, &file_status) != 0) or (file_status.st_size == 0))
+    {
+        ::close(file_descriptor);
+        throw std::runtime_error("MemoryMappedFile failed to get the size of (or received an empty) file " + filename);
+    }
+    file_size = file_status.st_size;
+
+    mapped_data_p = ::mmap(NULL, file_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+    if(mapped_data_p == MAP_FAILED)
+    {
+        ::close(file_descriptor);
+        throw std::runtime_error("MemoryMappedFile failed to map the file " + filename);
+    }
+
+    // DataSequence files are mostly read front to back
+    ::madvise(mapped_data_p, file_size, MADV_SEQUENTIAL);
+    return;
+}
+
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    ::munmap(mapped_data_p, file_size);
+    ::close(file_descriptor);
+    return;
+}
+
+
+const boost::uint8_t *MemoryMappedFile::data() const
+{
+    return static_cast<const boost::uint8_t *>(mapped_data_p);
+}
+
+
+boost::uint64_t MemoryMappedFile::size() const
+{
+    return file_size;
+}
+
+
+void write_data_sequence_index(std::ostream &output_stream, const data_sequence_offsets_t &messages_offsets)
+{
+    for(size_t i=0; i < messages_offsets.size(); i+=1)
+    {
+        write_little_endian64(output_stream, messages_offsets[i]);
+    }
+
+    write_little_endian64(output_stream, messages_offsets.size());
+    output_stream.write(index_magic, index_magic_size);
+    return;
+}
+
+
+bool read_data_sequence_index(const boost::uint8_t *data, const boost::uint64_t data_size,
+                              const boost::uint64_t first_message_offset,
+                              data_sequence_offsets_t &messages_offsets, boost::uint64_t &data_end_offset)
+{
+    const boost::uint64_t footer_size = uint64_size + index_magic_size;
+    if(data_size < first_message_offset + footer_size)
+    {
+        return false;
+    }
+
+    if(std::memcmp(data + data_size - index_magic_size, index_magic, index_magic_size) != 0)
+    {
+        return false;
+    }
+
+    const boost::uint64_t num_messages = read_little_endian64(data + data_size - footer_size);
+    if(num_messages > (data_size - first_message_offset - footer_size) / uint64_size)
+    {
+        return false; // not a valid index
+    }
+
+    const boost::uint64_t index_offset = data_size - footer_size - num_messages*uint64_size;
+
+    data_sequence_offsets_t offsets(num_messages);
+    for(size_t i=0; i < num_messages; i+=1)
+    {
+        offsets[i] = read_little_endian64(data + index_offset + i*uint64_size);
+    }
+
+    // a message whose content ends with the magic bytes could be mistaken for an index,
+    // so we check that the first and last offsets are consistent with the messages sizes
+    if(num_messages == 0)
+    {
+        if(index_offset != first_message_offset)
+        {
+            return false;
+        }
+    }
+    else
+    {
+        const boost::uint64_t last_offset = offsets.back();
+        if((offsets.front() != first_message_offset)
+           or (last_offset + uint64_size > index_offset)
+           or (last_offset + uint64_size + read_little_endian64(data + last_offset) != index_offset))
+        {
+            return false;
+        }
+    }
+
+    messages_offsets.swap(offsets);
+    data_end_offset = index_offset;
+    return true;
+}
+
+
+boost::uint64_t scan_data_sequence_offsets(const boost::uint8_t *data, const boost::uint64_t data_end_offset,
+                                           const boost::uint64_t first_message_offset,
+                                           data_sequence_offsets_t &messages_offsets)
+{
+    messages_offsets.clear();
+
+    boost::uint64_t offset = first_message_offset;
+    while(offset + uint64_size <= data_end_offset)
+    {
+        const boost::uint64_t message_size = read_little_endian64(data + offset);
+        if(message_size > data_end_offset - offset - uint64_size)
+        {
+            break; // truncated message
+        }
+
+        messages_offsets.push_back(offset);
+        offset += uint64_size + message_size;
+    }
+
+    return offset;
+}
+
+
+boost::uint64_t read_data_sequence_message_size(const boost::uint8_t *data)
+{
+    return read_little_endian64(data);
+}
+
+
+} // end of namespace doppia
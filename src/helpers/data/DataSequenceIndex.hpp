@@ -0,0 +1,59 @@
+#ifndef DATASEQUENCEINDEX_HPP
+#define DATASEQUENCEINDEX_HPP
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace doppia
+{
+
+/// Read only memory mapping of a complete file, used by DataSequence in read mode
+class MemoryMappedFile: private boost::noncopyable
+{
+public:
+    MemoryMappedFile(const std::string &filename);
+    ~MemoryMappedFile();
+
+    const boost::uint8_t *data() const;
+    boost::uint64_t size() const;
+
+protected:
+    int file_descriptor;
+    void *mapped_data_p;
+    boost::uint64_t file_size;
+};
+
+
+/// The optional DataSequence index footer is placed after the last message:
+/// the byte offset of each message (little endian 64 bits each), the number of messages (little endian 64 bits)
+/// and 8 magic bytes.
+/// Files without index footer remain valid DataSequence files (the index is then built by scanning the file).
+/// @see tools/data_sequence/data_sequence.py for the python mirror
+typedef std::vector<boost::uint64_t> data_sequence_offsets_t;
+
+void write_data_sequence_index(std::ostream &output_stream, const data_sequence_offsets_t &messages_offsets);
+
+/// @param first_message_offset is the byte offset of the first message (just after the header)
+/// @returns true if the file has a valid index footer,
+/// in that case sets the messages_offsets and the data_end_offset (where the index footer starts)
+bool read_data_sequence_index(const boost::uint8_t *data, const boost::uint64_t data_size,
+                              const boost::uint64_t first_message_offset,
+                              data_sequence_offsets_t &messages_offsets, boost::uint64_t &data_end_offset);
+
+/// Builds the messages offsets by jumping from one message size to the next (no message is parsed).
+/// A truncated last message (e.g. interrupted recording) is ignored.
+/// @returns the offset where the last complete message ends
+boost::uint64_t scan_data_sequence_offsets(const boost::uint8_t *data, const boost::uint64_t data_end_offset,
+                                           const boost::uint64_t first_message_offset,
+                                           data_sequence_offsets_t &messages_offsets);
+
+/// reads the little endian 64 bits size that precedes each DataSequence message
+boost::uint64_t read_data_sequence_message_size(const boost::uint8_t *data);
+
+} // end of namespace doppia
+
+#endif // DATASEQUENCEINDEX_HPP
@@ -14,6 +14,9 @@
 #if not defined(__host__)
 #define __host__
 #endif
+#if not defined(__align__)
+#define __align__(n) __attribute__((aligned(n)))
+#endif
 #endif // defined(USE_GPU)
 
 namespace doppia {
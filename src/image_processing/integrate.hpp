@@ -1,9 +1,19 @@
 #ifndef INTEGRATE_HPP
 #define INTEGRATE_HPP
 
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <emmintrin.h>
+
 #include <algorithm>
 #include <stdexcept>
 
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
 /// Helper function that integrates an image
 /// We assume the inputs are 2d multi_array views
 /// code based on http://en.wikipedia.org/wiki/Summed_area_table
@@ -16,13 +26,9 @@ namespace doppia {
 // Templated function integrated in the header because I could not make the .cpp instanciation work
 // FIXME should move this to a separate helper file ?
 
-/// Helper function that integrates an image
-/// We assume the inputs are 2d multi_array views
-/// code based on http://en.wikipedia.org/wiki/Summed_area_table
 template<typename ChannelView, typename IntegralChannelView>
-void integrate(const ChannelView &channel, IntegralChannelView &integral_channel)
+void check_integrate_arguments(const ChannelView &channel, IntegralChannelView &integral_channel)
 {
-
     if((channel.num_dimensions() != 2) or (integral_channel.num_dimensions() != 2))
     {
         throw std::invalid_argument("integral(...) expected to receive 2 dimensional multi_array views");
@@ -35,6 +41,17 @@ void integrate(const ChannelView &channel, IntegralChannelView &integral_channel
                                     "integral_channel should of size channel + 1 (on both dimensions)");
     }
 
+    return;
+}
+
+
+/// Original scalar implementation, works for any element type
+/// kept as reference for testing
+template<typename ChannelView, typename IntegralChannelView>
+void integrate_v0(const ChannelView &channel, IntegralChannelView &integral_channel)
+{
+    check_integrate_arguments(channel, integral_channel);
+
     // first row of the integral_channel, is set to zero
     {
         typename IntegralChannelView::reference integral_channel_row = integral_channel[0];
@@ -67,6 +84,206 @@ void integrate(const ChannelView &channel, IntegralChannelView &integral_channel
 }
 
 
+/// computes the prefix sum of four uint32 values, adds row_sum and the previous integral row,
+/// returns the new row_sum (broadcasted in the four values)
+inline
+__m128i integrate_four_values(__m128i values, const __m128i row_sum,
+                              const boost::uint32_t *previous_integral_row, boost::uint32_t *integral_row)
+{
+    values = _mm_add_epi32(values, _mm_slli_si128(values, 4));
+    values = _mm_add_epi32(values, _mm_slli_si128(values, 8));
+    values = _mm_add_epi32(values, row_sum);
+
+    const __m128i previous_values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(previous_integral_row));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(integral_row), _mm_add_epi32(values, previous_values));
+
+    return _mm_shuffle_epi32(values, _MM_SHUFFLE(3, 3, 3, 3));
+}
+
+
+template<typename ChannelElement>
+inline
+void integrate_row_tail(const ChannelElement *channel_row, size_t col, const size_t num_columns,
+                        boost::uint32_t row_sum,
+                        const boost::uint32_t *previous_integral_row, boost::uint32_t *integral_row)
+{
+    for(; col < num_columns; col+=1)
+    {
+        row_sum += channel_row[col];
+        integral_row[col + 1] = previous_integral_row[col + 1] + row_sum;
+    }
+    return;
+}
+
+
+/// integral_row[col + 1] = previous_integral_row[col + 1] + sum(channel_row[0 ... col])
+/// (integral_row and previous_integral_row have num_columns + 1 elements)
+inline
+void integrate_row(const boost::uint16_t *channel_row, const size_t num_columns,
+                   const boost::uint32_t *previous_integral_row, boost::uint32_t *integral_row)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i row_sum = zero;
+
+    integral_row[0] = 0;
+    size_t col = 0;
+    for(; (col + 8) <= num_columns; col+=8)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(channel_row + col));
+        row_sum = integrate_four_values(_mm_unpacklo_epi16(values, zero), row_sum,
+                                        previous_integral_row + col + 1, integral_row + col + 1);
+        row_sum = integrate_four_values(_mm_unpackhi_epi16(values, zero), row_sum,
+                                        previous_integral_row + col + 5, integral_row + col + 5);
+    }
+
+    integrate_row_tail(channel_row, col, num_columns, _mm_cvtsi128_si32(row_sum),
+                       previous_integral_row, integral_row);
+    return;
+}
+
+
+/// uint8_t version of integrate_row
+inline
+void integrate_row(const boost::uint8_t *channel_row, const size_t num_columns,
+                   const boost::uint32_t *previous_integral_row, boost::uint32_t *integral_row)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i row_sum = zero;
+
+    integral_row[0] = 0;
+    size_t col = 0;
+    for(; (col + 8) <= num_columns; col+=8)
+    {
+        const __m128i values = _mm_unpacklo_epi8(
+                                   _mm_loadl_epi64(reinterpret_cast<const __m128i *>(channel_row + col)), zero);
+        row_sum = integrate_four_values(_mm_unpacklo_epi16(values, zero), row_sum,
+                                        previous_integral_row + col + 1, integral_row + col + 1);
+        row_sum = integrate_four_values(_mm_unpackhi_epi16(values, zero), row_sum,
+                                        previous_integral_row + col + 5, integral_row + col + 5);
+    }
+
+    integrate_row_tail(channel_row, col, num_columns, _mm_cvtsi128_si32(row_sum),
+                       previous_integral_row, integral_row);
+    return;
+}
+
+
+/// SSE2 implementation, for uint8_t or uint16_t channels with uint32_t integrals
+/// and with contiguous rows
+template<typename ChannelView, typename IntegralChannelView>
+void integrate_v1(const ChannelView &channel, IntegralChannelView &integral_channel)
+{
+    const size_t
+            num_rows = channel.shape()[0],
+            num_columns = channel.shape()[1];
+
+    boost::uint32_t *integral_row_zero = &integral_channel[0][0];
+    std::fill(integral_row_zero, integral_row_zero + num_columns + 1, 0);
+
+    // FIXME hardcoded parameter
+    // below ~512x512 pixels the single pass version is faster than the threads overhead
+    const size_t min_num_elements_for_parallel_integration = 512*512;
+
+    bool use_parallel_integration = (num_rows*num_columns) >= min_num_elements_for_parallel_integration;
+#if defined(_OPENMP)
+    // integrate is usually called once per channel, inside a parallel loop
+    use_parallel_integration = use_parallel_integration
+            and (omp_in_parallel() == false) and (omp_get_max_threads() > 1);
+#else
+    use_parallel_integration = false;
+#endif
+
+    if(use_parallel_integration == false)
+    {
+        // single pass, each integral row is computed from the previous one
+        for(size_t row=1; row <= num_rows; row+=1)
+        {
+            integrate_row(&channel[row - 1][0], num_columns,
+                          &integral_channel[row - 1][0], &integral_channel[row][0]);
+        }
+        return;
+    }
+
+    // two passes, first the horizontal prefix sums on row blocks, then the vertical accumulation
+    // (the integral row zero is used as previous row, since it is all zeros)
+#pragma omp parallel for schedule(static)
+    for(int row=1; row <= static_cast<int>(num_rows); row+=1)
+    {
+        integrate_row(&channel[row - 1][0], num_columns,
+                      integral_row_zero, &integral_channel[row][0]);
+    }
+
+    // each thread accumulates a block of columns, at least a cache line wide
+    const int columns_block_size = 64, num_columns_blocks = (num_columns + columns_block_size) / columns_block_size;
+#pragma omp parallel for schedule(static)
+    for(int block_index=0; block_index < num_columns_blocks; block_index+=1)
+    {
+        const size_t
+                first_col = block_index*columns_block_size,
+                end_col = std::min(num_columns + 1, first_col + columns_block_size);
+        for(size_t row=2; row <= num_rows; row+=1)
+        {
+            const boost::uint32_t *previous_integral_row = &integral_channel[row - 1][0];
+            boost::uint32_t *integral_row = &integral_channel[row][0];
+            for(size_t col=first_col; col < end_col; col+=1)
+            {
+                integral_row[col] += previous_integral_row[col];
+            }
+        }
+    } // end of "for each block of columns"
+
+    return;
+}
+
+
+template<typename ChannelView, typename IntegralChannelView>
+void integrate_dispatch(const ChannelView &channel, IntegralChannelView &integral_channel,
+                        const boost::true_type /*has_sse_version*/)
+{
+    const bool contiguous_rows = (channel.strides()[1] == 1) and (integral_channel.strides()[1] == 1);
+    if(contiguous_rows and (channel.shape()[0] > 0) and (channel.shape()[1] > 0))
+    {
+        integrate_v1(channel, integral_channel);
+    }
+    else
+    {
+        integrate_v0(channel, integral_channel);
+    }
+    return;
+}
+
+
+template<typename ChannelView, typename IntegralChannelView>
+void integrate_dispatch(const ChannelView &channel, IntegralChannelView &integral_channel,
+                        const boost::false_type /*has_sse_version*/)
+{
+    integrate_v0(channel, integral_channel);
+    return;
+}
+
+
+/// Helper function that integrates an image
+/// We assume the inputs are 2d multi_array views
+/// code based on http://en.wikipedia.org/wiki/Summed_area_table
+/// uint8_t and uint16_t channels with uint32_t integral use an SSE2 version (same results),
+/// other types use the original scalar version
+template<typename ChannelView, typename IntegralChannelView>
+void integrate(const ChannelView &channel, IntegralChannelView &integral_channel)
+{
+    check_integrate_arguments(channel, integral_channel);
+
+    typedef typename ChannelView::element channel_element_t;
+    typedef typename IntegralChannelView::element integral_channel_element_t;
+    typedef boost::integral_constant<
+            bool,
+            (boost::is_same<channel_element_t, boost::uint8_t>::value
+             or boost::is_same<channel_element_t, boost::uint16_t>::value)
+            and boost::is_same<integral_channel_element_t, boost::uint32_t>::value> has_sse_version_t;
+
+    integrate_dispatch(channel, integral_channel, has_sse_version_t());
+    return;
+}
+
 
 } // end of namespace doppia
 
@@ -164,6 +164,12 @@ void AbstractObjectsDetector::set_ground_plane_corridor(const ground_plane_corri
     return;
 }
 
+void AbstractObjectsDetector::set_predicted_regions(const predicted_regions_t &/*regions*/)
+{
+    // default implementation simply disregards the predicted regions
+    return;
+}
+
 /*void AbstractObjectsDetector::set_search_range(const detector_search_ranges_t &range)
 {
     search_ranges = range; // simple copy
@@ -29,6 +29,21 @@ public:
 
     typedef std::vector<int> ground_plane_corridor_t;
 
+    /// area where an object is expected on the current frame (e.g. predicted by an objects tracker)
+    struct PredictedRegion
+    {
+        /// expected object bounding box (same coordinates as the detections)
+        detection_t::rectangle_t bounding_box;
+
+        /// expected error of the bounding box center, in pixels
+        float position_uncertainty;
+
+        /// expected relative error of the bounding box height (e.g. 0.1 == +-10%)
+        float scale_uncertainty;
+    };
+
+    typedef std::vector<PredictedRegion> predicted_regions_t;
+
 public:
 
     static boost::program_options::options_description get_args_options();
@@ -39,6 +54,11 @@ public:
     virtual void set_image(const boost::gil::rgb8c_view_t &input_image) = 0;
     virtual void set_stixels(const stixels_t &stixels);
     virtual void set_ground_plane_corridor(const ground_plane_corridor_t &corridor);
+
+    /// tracking guided detection, the predicted regions are searched on every frame,
+    /// the rest of the image may be searched less often (see objects_detector.full_search_period).
+    /// The default implementation disregards the predicted regions (all the image is searched)
+    virtual void set_predicted_regions(const predicted_regions_t &regions);
     virtual void compute() = 0;
 
     /// overwrites the values computed during set_image
@@ -66,6 +66,62 @@ BaseIntegralChannelsDetector ::get_args_options()
              "how many scales search around the stixel scale ? The number of scales evaluated is 2*margin. "
              "For values <= 0, all scales will be evaluated. ")
 
+            ("objects_detector.min_evaluated_stages",
+             value<int>()->default_value(3001),
+             "minimum number of cascade stages evaluated on a candidate window to accept it as a detection (cpu only). "
+             "Partial detections at the image borders skip the stages whose features fall outside of the image. "
+             "Use 0 to accept all windows above the score threshold.")
+
+            ("objects_detector.parallel_scales",
+             value<bool>()->default_value(true),
+             "compute the small scales concurrently, one scale per thread (cpu only). "
+             "The large scales are still computed one after the other, using multiple threads per scale.")
+
+            ("objects_detector.integer_features",
+             value<bool>()->default_value(true),
+             "compare the features and the nodes thresholds as integers (in integral channels units) "
+             "instead of floats (cpu only). Both provide the same detections, except for very large images, "
+             "where the float values loose precision.")
+
+            ("objects_detector.single_pass_integral_channels",
+             value<bool>()->default_value(false),
+             "compute the integral channels in a single pass over horizontal strips of the image (cpu only). "
+             "Faster, but a few percent of the channels values slightly differ from the default computation.")
+
+            ("objects_detector.compiled_cascades_file",
+             value<std::string>()->default_value(""),
+             "file used to store the compiled (rescaled and packed) cascades used by the window-major methods (cpu only). "
+             "If the file exists the cascades are loaded from it, else it is created after compiling them. "
+             "Leave empty to compile the cascades in memory only.")
+
+            ("objects_detector.channels_pyramid_real_scales_per_octave",
+             value<int>()->default_value(0),
+             "number of scales per octave where the integral channels are computed from the rescaled input image, "
+             "the channels of the scales in between are approximated from the nearest larger computed scale (cpu only). "
+             "Fewer real scales are faster but less accurate. "
+             "Use 0 to compute the integral channels of every scale.")
+
+            ("objects_detector.streaming_nms_buffer_size",
+             value<int>()->default_value(0),
+             "when positive, the raw detections of each scale are filtered as soon as the scale is computed, "
+             "and a greedy non maximal suppression reduces them each time more than this number are buffered "
+             "(per concurrent task when using parallel_scales, cpu only). "
+             "Bounds the raw detections memory when using low score thresholds, "
+             "but the final detections may slightly differ from a single suppression over all the scales. "
+             "Requires the greedy or greedy_indexed non_maximal_suppression_method. "
+             "Use 0 to suppress all the raw detections at once.")
+
+            ("objects_detector.streaming_nms_max_detections",
+             value<int>()->default_value(1000),
+             "maximum number of detections kept (highest scores first) after each streaming non maximal suppression")
+
+            ("objects_detector.full_search_period",
+             value<int>()->default_value(1),
+             "tracking guided detection, when the objects tracker provides predicted regions, "
+             "the full image is searched only once every N frames, "
+             "the other frames only search the windows around the predicted regions (cpu only). "
+             "Use 1 to search the full image on every frame.")
+
             ;
 
     return desc;
@@ -480,6 +536,17 @@ void BaseIntegralChannelsDetector::compute_extra_data_per_scale(
 } // end of BaseIntegralChannelsDetector::compute_extra_data_per_scale
 
 
+std::vector<float> BaseIntegralChannelsDetector::get_channels_scaling_exponents() const
+{
+    if(cascade_model_p == false)
+    {
+        throw std::runtime_error("BaseIntegralChannelsDetector::get_channels_scaling_exponents "
+                                 "requires a cascade model");
+    }
+    return cascade_model_p->get_channels_scaling_exponents();
+}
+
+
 
 void BaseIntegralChannelsDetector::check_extra_data_per_scale()
 {
@@ -84,6 +84,10 @@ protected:
 
     virtual void compute_extra_data_per_scale(const size_t input_width, const size_t input_height);
 
+    /// exponents used to approximate the integral channels of nearby scales,
+    /// @see SoftCascadeOverIntegralChannelsModel::get_channels_scaling_exponents
+    virtual std::vector<float> get_channels_scaling_exponents() const;
+
     /// helper function that validates the internal consistency of the extra_data_per_scale
     void check_extra_data_per_scale();
 
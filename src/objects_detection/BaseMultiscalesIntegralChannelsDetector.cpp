@@ -224,4 +224,11 @@ void BaseMultiscalesIntegralChannelsDetector::compute_scaled_detection_cascades(
 }
 
 
+std::vector<float> BaseMultiscalesIntegralChannelsDetector::get_channels_scaling_exponents() const
+{
+    return detector_model_p->get_detectors().front().get_channels_scaling_exponents();
+}
+
+
+
 } // end of namespace doppia
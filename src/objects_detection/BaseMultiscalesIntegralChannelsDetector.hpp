@@ -32,6 +32,9 @@ protected:
     /// (since we will be shifting the actual scales)
     void compute_scaled_detection_cascades();
 
+    /// all the models use the same channels, we use the exponents of the first one
+    std::vector<float> get_channels_scaling_exponents() const;
+
 };
 
 
@@ -0,0 +1,370 @@
+#include "CompiledSoftCascadeOverIntegralChannels.hpp"
+
+#include "compiled_detector_model.pb.h"
+
+#include "helpers/Log.hpp"
+
+#include <boost/foreach.hpp>
+#include <boost/format.hpp>
+
+#include <fstream>
+#include <stdexcept>
+#include <limits>
+#include <cstring>
+#include <cmath>
+
+
+namespace
+{
+
+std::ostream & log_info()
+{
+    return  logging::log(logging::InfoMessage, "CompiledSoftCascadeOverIntegralChannels");
+}
+
+std::ostream & log_debug()
+{
+    return  logging::log(logging::DebugMessage, "CompiledSoftCascadeOverIntegralChannels");
+}
+
+std::ostream & log_error()
+{
+    return  logging::log(logging::ErrorMessage, "CompiledSoftCascadeOverIntegralChannels");
+}
+
+
+/// FNV-1a hash, 64 bits version
+void add_to_checksum(boost::uint64_t &checksum, const boost::uint32_t value)
+{
+    for(int byte_index=0; byte_index < 4; byte_index +=1)
+    {
+        checksum ^= (value >> (8*byte_index)) & 0xFF;
+        checksum *= 1099511628211ULL;
+    }
+    return;
+}
+
+
+void add_to_checksum(boost::uint64_t &checksum, const float value)
+{
+    boost::uint32_t value_bits;
+    std::memcpy(&value_bits, &value, sizeof(value_bits));
+    add_to_checksum(checksum, value_bits);
+    return;
+}
+
+
+void add_to_checksum(boost::uint64_t &checksum, const doppia::IntegralChannelsFeature &feature,
+                     const float feature_threshold)
+{
+    add_to_checksum(checksum, static_cast<boost::uint32_t>(feature.channel_index));
+    add_to_checksum(checksum, static_cast<boost::uint32_t>(feature.box.min_corner().x()));
+    add_to_checksum(checksum, static_cast<boost::uint32_t>(feature.box.min_corner().y()));
+    add_to_checksum(checksum, static_cast<boost::uint32_t>(feature.box.max_corner().x()));
+    add_to_checksum(checksum, static_cast<boost::uint32_t>(feature.box.max_corner().y()));
+    add_to_checksum(checksum, feature_threshold);
+    return;
+}
+
+const boost::uint64_t checksum_initial_value = 14695981039346656037ULL;
+
+} // end of anonymous namespace
+
+
+namespace doppia {
+
+typedef CompiledSoftCascadeOverIntegralChannels::fast_stages_t fast_stages_t;
+typedef CompiledSoftCascadeOverIntegralChannels::stump_stages_t stump_stages_t;
+
+
+CompiledSoftCascadeOverIntegralChannels::CompiledSoftCascadeOverIntegralChannels(const fast_stages_t &stages)
+    : use_stumps(false)
+{
+    const size_t num_nodes = stages.size()*get_nodes_per_stage();
+    nodes_channel_index.reserve(num_nodes);
+    nodes_min_x.reserve(num_nodes);
+    nodes_min_y.reserve(num_nodes);
+    nodes_max_x.reserve(num_nodes);
+    nodes_max_y.reserve(num_nodes);
+    nodes_threshold.reserve(num_nodes);
+    leaves_weights.reserve(stages.size()*4);
+    cascade_thresholds.reserve(stages.size());
+
+    BOOST_FOREACH(const fast_stages_t::value_type &stage, stages)
+    {
+        const Level2DecisionTreeWithWeights &weak_classifier = stage.weak_classifier;
+
+        add_node(weak_classifier.level1_node.feature, weak_classifier.level1_node.feature_threshold);
+        add_node(weak_classifier.level2_true_node.feature, weak_classifier.level2_true_node.feature_threshold);
+        add_node(weak_classifier.level2_false_node.feature, weak_classifier.level2_false_node.feature_threshold);
+
+        leaves_weights.push_back(weak_classifier.level2_true_node.weight_true_leaf);
+        leaves_weights.push_back(weak_classifier.level2_true_node.weight_false_leaf);
+        leaves_weights.push_back(weak_classifier.level2_false_node.weight_true_leaf);
+        leaves_weights.push_back(weak_classifier.level2_false_node.weight_false_leaf);
+
+        cascade_thresholds.push_back(stage.cascade_threshold);
+    } // end of "for each stage"
+
+    source_checksum = compute_checksum(stages);
+    return;
+}
+
+
+CompiledSoftCascadeOverIntegralChannels::CompiledSoftCascadeOverIntegralChannels(const stump_stages_t &stages)
+    : use_stumps(true)
+{
+    const size_t num_nodes = stages.size()*get_nodes_per_stage();
+    nodes_channel_index.reserve(num_nodes);
+    nodes_min_x.reserve(num_nodes);
+    nodes_min_y.reserve(num_nodes);
+    nodes_max_x.reserve(num_nodes);
+    nodes_max_y.reserve(num_nodes);
+    nodes_threshold.reserve(num_nodes);
+    leaves_weights.reserve(stages.size()*2);
+    cascade_thresholds.reserve(stages.size());
+
+    BOOST_FOREACH(const stump_stages_t::value_type &stage, stages)
+    {
+        const DecisionStumpWithWeights &weak_classifier = stage.weak_classifier;
+
+        add_node(weak_classifier.feature, weak_classifier.feature_threshold);
+        leaves_weights.push_back(weak_classifier.weight_true_leaf);
+        leaves_weights.push_back(weak_classifier.weight_false_leaf);
+
+        cascade_thresholds.push_back(stage.cascade_threshold);
+    } // end of "for each stage"
+
+    source_checksum = compute_checksum(stages);
+    return;
+}
+
+
+CompiledSoftCascadeOverIntegralChannels::CompiledSoftCascadeOverIntegralChannels(
+        const doppia_protobuf::CompiledSoftCascade &compiled_cascade)
+    : use_stumps(compiled_cascade.use_stumps()),
+      source_checksum(compiled_cascade.source_checksum())
+{
+    const int
+            num_stages = compiled_cascade.cascade_thresholds_size(),
+            num_nodes = num_stages*get_nodes_per_stage();
+
+    if((compiled_cascade.nodes_channel_index_size() != num_nodes)
+       or (compiled_cascade.nodes_min_x_size() != num_nodes)
+       or (compiled_cascade.nodes_min_y_size() != num_nodes)
+       or (compiled_cascade.nodes_max_x_size() != num_nodes)
+       or (compiled_cascade.nodes_max_y_size() != num_nodes)
+       or (compiled_cascade.nodes_threshold_size() != num_nodes)
+       or (compiled_cascade.leaves_weights_size() != (num_stages*(use_stumps? 2 : 4))))
+    {
+        throw std::invalid_argument("CompiledSoftCascadeOverIntegralChannels received "
+                                    "a CompiledSoftCascade message with inconsistent sizes");
+    }
+
+    for(int node_index=0; node_index < num_nodes; node_index+=1)
+    {
+        IntegralChannelsFeature feature;
+        feature.channel_index = compiled_cascade.nodes_channel_index(node_index);
+        feature.box.min_corner().x(compiled_cascade.nodes_min_x(node_index));
+        feature.box.min_corner().y(compiled_cascade.nodes_min_y(node_index));
+        feature.box.max_corner().x(compiled_cascade.nodes_max_x(node_index));
+        feature.box.max_corner().y(compiled_cascade.nodes_max_y(node_index));
+
+        add_node(feature, 0);
+        nodes_threshold.back() = compiled_cascade.nodes_threshold(node_index);
+    }
+
+    leaves_weights.assign(compiled_cascade.leaves_weights().begin(), compiled_cascade.leaves_weights().end());
+    cascade_thresholds.assign(compiled_cascade.cascade_thresholds().begin(),
+                              compiled_cascade.cascade_thresholds().end());
+    return;
+}
+
+
+CompiledSoftCascadeOverIntegralChannels::~CompiledSoftCascadeOverIntegralChannels()
+{
+    // nothing to do here
+    return;
+}
+
+
+void CompiledSoftCascadeOverIntegralChannels::add_node(const IntegralChannelsFeature &feature,
+                                                       const float feature_threshold)
+{
+    nodes_channel_index.push_back(feature.channel_index);
+    nodes_min_x.push_back(feature.box.min_corner().x());
+    nodes_min_y.push_back(feature.box.min_corner().y());
+    nodes_max_x.push_back(feature.box.max_corner().x());
+    nodes_max_y.push_back(feature.box.max_corner().y());
+    nodes_threshold.push_back(get_integer_threshold(feature_threshold));
+    return;
+}
+
+
+void CompiledSoftCascadeOverIntegralChannels::to_protobuf(
+        const float relative_scale,
+        const size_t detection_window_width, const size_t detection_window_height,
+        doppia_protobuf::CompiledSoftCascade &compiled_cascade) const
+{
+    compiled_cascade.Clear();
+    compiled_cascade.set_relative_scale(relative_scale);
+    compiled_cascade.set_detection_window_width(detection_window_width);
+    compiled_cascade.set_detection_window_height(detection_window_height);
+    compiled_cascade.set_use_stumps(use_stumps);
+    compiled_cascade.set_source_checksum(source_checksum);
+
+    for(size_t node_index=0; node_index < nodes_threshold.size(); node_index+=1)
+    {
+        compiled_cascade.add_nodes_channel_index(nodes_channel_index[node_index]);
+        compiled_cascade.add_nodes_min_x(nodes_min_x[node_index]);
+        compiled_cascade.add_nodes_min_y(nodes_min_y[node_index]);
+        compiled_cascade.add_nodes_max_x(nodes_max_x[node_index]);
+        compiled_cascade.add_nodes_max_y(nodes_max_y[node_index]);
+        compiled_cascade.add_nodes_threshold(nodes_threshold[node_index]);
+    }
+
+    BOOST_FOREACH(const float weight, leaves_weights)
+    {
+        compiled_cascade.add_leaves_weights(weight);
+    }
+
+    BOOST_FOREACH(const float threshold, cascade_thresholds)
+    {
+        compiled_cascade.add_cascade_thresholds(threshold);
+    }
+
+    return;
+}
+
+
+boost::int32_t CompiledSoftCascadeOverIntegralChannels::get_integer_threshold(const float feature_threshold)
+{
+    const double integer_threshold = std::ceil(static_cast<double>(feature_threshold));
+
+    if(integer_threshold <= (std::numeric_limits<boost::int32_t>::min() + 1))
+    {
+        return std::numeric_limits<boost::int32_t>::min() + 1;
+    }
+    else if(integer_threshold >= std::numeric_limits<boost::int32_t>::max())
+    {
+        return std::numeric_limits<boost::int32_t>::max();
+    }
+
+    return static_cast<boost::int32_t>(integer_threshold);
+}
+
+
+size_t CompiledSoftCascadeOverIntegralChannels::get_num_stages() const
+{
+    return cascade_thresholds.size();
+}
+
+
+int CompiledSoftCascadeOverIntegralChannels::get_nodes_per_stage() const
+{
+    return use_stumps? 1 : 3;
+}
+
+
+bool CompiledSoftCascadeOverIntegralChannels::get_use_stumps() const
+{
+    return use_stumps;
+}
+
+
+boost::uint64_t CompiledSoftCascadeOverIntegralChannels::get_source_checksum() const
+{
+    return source_checksum;
+}
+
+
+size_t CompiledSoftCascadeOverIntegralChannels::get_memory_size() const
+{
+    const size_t num_nodes = nodes_threshold.size();
+    return num_nodes*(sizeof(boost::uint8_t) + 4*sizeof(boost::int16_t) + sizeof(boost::int32_t))
+            + (leaves_weights.size() + cascade_thresholds.size())*sizeof(float);
+}
+
+
+boost::uint64_t CompiledSoftCascadeOverIntegralChannels::compute_checksum(const fast_stages_t &stages)
+{
+    boost::uint64_t checksum = checksum_initial_value;
+
+    BOOST_FOREACH(const fast_stages_t::value_type &stage, stages)
+    {
+        const Level2DecisionTreeWithWeights &weak_classifier = stage.weak_classifier;
+        add_to_checksum(checksum, weak_classifier.level1_node.feature, weak_classifier.level1_node.feature_threshold);
+        add_to_checksum(checksum, weak_classifier.level2_true_node.feature,
+                        weak_classifier.level2_true_node.feature_threshold);
+        add_to_checksum(checksum, weak_classifier.level2_true_node.weight_true_leaf);
+        add_to_checksum(checksum, weak_classifier.level2_true_node.weight_false_leaf);
+        add_to_checksum(checksum, weak_classifier.level2_false_node.feature,
+                        weak_classifier.level2_false_node.feature_threshold);
+        add_to_checksum(checksum, weak_classifier.level2_false_node.weight_true_leaf);
+        add_to_checksum(checksum, weak_classifier.level2_false_node.weight_false_leaf);
+        add_to_checksum(checksum, stage.cascade_threshold);
+    }
+
+    return checksum;
+}
+
+
+boost::uint64_t CompiledSoftCascadeOverIntegralChannels::compute_checksum(const stump_stages_t &stages)
+{
+    boost::uint64_t checksum = checksum_initial_value;
+
+    BOOST_FOREACH(const stump_stages_t::value_type &stage, stages)
+    {
+        const DecisionStumpWithWeights &weak_classifier = stage.weak_classifier;
+        add_to_checksum(checksum, weak_classifier.feature, weak_classifier.feature_threshold);
+        add_to_checksum(checksum, weak_classifier.weight_true_leaf);
+        add_to_checksum(checksum, weak_classifier.weight_false_leaf);
+        add_to_checksum(checksum, stage.cascade_threshold);
+    }
+
+    return checksum;
+}
+
+
+bool read_compiled_soft_cascades(const std::string &filename,
+                                 doppia_protobuf::CompiledSoftCascadesModel &compiled_cascades)
+{
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+    std::fstream input_stream(filename.c_str(), std::ios::in | std::ios::binary);
+    if(input_stream.is_open() == false)
+    {
+        return false;
+    }
+
+    const bool success = compiled_cascades.ParseFromIstream(&input_stream);
+    if(success == false)
+    {
+        log_error() << "Failed to parse the compiled cascades file " << filename << std::endl;
+        compiled_cascades.Clear();
+        return false;
+    }
+
+    log_info() << boost::str(boost::format("Read %i compiled cascades from %s")
+                             % compiled_cascades.cascades_size() % filename) << std::endl;
+    return true;
+}
+
+
+void write_compiled_soft_cascades(const std::string &filename,
+                                  const doppia_protobuf::CompiledSoftCascadesModel &compiled_cascades)
+{
+    std::fstream output_stream(filename.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+    if(compiled_cascades.SerializeToOstream(&output_stream) == false)
+    {
+        log_error() << "Failed to write the compiled cascades file " << filename << std::endl;
+        throw std::runtime_error("Failed to write the compiled cascades file");
+    }
+
+    log_debug() << boost::str(boost::format("Wrote %i compiled cascades into %s")
+                              % compiled_cascades.cascades_size() % filename) << std::endl;
+    return;
+}
+
+
+} // end of namespace doppia
@@ -0,0 +1,103 @@
+#ifndef BICLOP_COMPILEDSOFTCASCADEOVERINTEGRALCHANNELS_HPP
+#define BICLOP_COMPILEDSOFTCASCADEOVERINTEGRALCHANNELS_HPP
+
+#include "SoftCascadeOverIntegralChannelsModel.hpp"
+
+#include <boost/cstdint.hpp>
+
+#include <vector>
+#include <string>
+
+// forward declaration
+namespace doppia_protobuf {
+class CompiledSoftCascade;
+class CompiledSoftCascadesModel;
+}
+
+namespace doppia {
+
+/// Packed version of a (rescaled) soft cascade, used by the CPU detectors.
+/// The nodes data is stored as structure of arrays (one array per field, nodes_per_stage nodes per stage),
+/// so that a 2000 stages cascade stays mostly cache resident while scanning the image rows.
+///
+/// The features boxes are stored as int16 offsets with respect to the detection window top-left corner,
+/// the nodes thresholds are stored in integral channels units:
+/// since the features values are integers (sums of channel values),
+/// (feature_value >= feature_threshold) is equivalent to (feature_value >= ceil(feature_threshold)).
+///
+/// A compiled cascade depends on the detection scale but not on the input image size,
+/// it can be saved and loaded (see compiled_detector_model.proto).
+/// @see SoftCascadeWindowsTileEvaluator
+class CompiledSoftCascadeOverIntegralChannels
+{
+public:
+
+    typedef SoftCascadeOverIntegralChannelsModel::fast_stages_t fast_stages_t;
+    typedef SoftCascadeOverIntegralChannelsModel::stump_stages_t stump_stages_t;
+
+    CompiledSoftCascadeOverIntegralChannels(const fast_stages_t &stages);
+    CompiledSoftCascadeOverIntegralChannels(const stump_stages_t &stages);
+    CompiledSoftCascadeOverIntegralChannels(const doppia_protobuf::CompiledSoftCascade &compiled_cascade);
+    ~CompiledSoftCascadeOverIntegralChannels();
+
+    /// the relative scale and detection window size are only stored to identify the cascade
+    void to_protobuf(const float relative_scale,
+                     const size_t detection_window_width, const size_t detection_window_height,
+                     doppia_protobuf::CompiledSoftCascade &compiled_cascade) const;
+
+    size_t get_num_stages() const;
+
+    /// 1 for stumps, 3 for level2 decision trees (level1, level2 true and level2 false nodes)
+    int get_nodes_per_stage() const;
+    bool get_use_stumps() const;
+
+    /// checksum of the stages used to build this compiled cascade
+    boost::uint64_t get_source_checksum() const;
+
+    /// memory used by the cascade data, in bytes
+    size_t get_memory_size() const;
+
+    /// smallest integer threshold t such that (value >= t) == (value >= feature_threshold), for any integer value
+    /// (t is kept above the int32 minimum, so that t - 1 does not overflow)
+    static boost::int32_t get_integer_threshold(const float feature_threshold);
+
+    /// checksums used to validate the loaded compiled cascades
+    static boost::uint64_t compute_checksum(const fast_stages_t &stages);
+    static boost::uint64_t compute_checksum(const stump_stages_t &stages);
+
+public:
+
+    /// node index is stage_index*nodes_per_stage + node_index_in_stage
+    ///@{
+    std::vector<boost::uint8_t> nodes_channel_index;
+    std::vector<boost::int16_t> nodes_min_x, nodes_min_y, nodes_max_x, nodes_max_y;
+    std::vector<boost::int32_t> nodes_threshold;
+    ///@}
+
+    /// for each stage, the true and false leaves weights of each level2 node (of the single node for stumps)
+    std::vector<float> leaves_weights;
+
+    /// if (strong_classifier_score < cascade_threshold) answer is "not this class"
+    std::vector<float> cascade_thresholds;
+
+protected:
+
+    bool use_stumps;
+    boost::uint64_t source_checksum;
+
+    void add_node(const IntegralChannelsFeature &feature, const float feature_threshold);
+};
+
+
+/// Read a CompiledSoftCascadesModel file (binary protocol buffer format),
+/// returns false if the file could not be read
+bool read_compiled_soft_cascades(const std::string &filename,
+                                 doppia_protobuf::CompiledSoftCascadesModel &compiled_cascades);
+
+/// Write a CompiledSoftCascadesModel file (binary protocol buffer format)
+void write_compiled_soft_cascades(const std::string &filename,
+                                  const doppia_protobuf::CompiledSoftCascadesModel &compiled_cascades);
+
+} // end of namespace doppia
+
+#endif // BICLOP_COMPILEDSOFTCASCADEOVERINTEGRALCHANNELS_HPP
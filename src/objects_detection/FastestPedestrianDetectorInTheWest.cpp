@@ -261,16 +261,20 @@ void FastestPedestrianDetectorInTheWest::compute_detections_at_specific_scale(
                 stages_left_in_the_row,
                 stages_left,
                 detections_scores,
+                num_evaluated_stages,
                 integral_channels,
                 scale_one_detection_window_size,
                 original_search_range.detection_window_scale,
                 detections, non_rescaled_detections_p,
                 cascade_stages,
                 score_threshold,
+                min_evaluated_stages,
                 extra_data_per_scale[scale_index],
                 print_stages,
                 print_cascade_statistics,
-                save_score_image);
+                save_score_image,
+                true, // use the detector model cascade
+                use_integer_features);
 
 #if defined(TESTING)
     // store some key values for testing via DetectorsComparisonTestApplication
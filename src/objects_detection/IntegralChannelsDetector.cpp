@@ -1,10 +1,15 @@
 #include "IntegralChannelsDetector.hpp"
 
 #include "non_maximal_suppression/AbstractNonMaximalSuppression.hpp"
+#include "non_maximal_suppression/GreedyNonMaximalSuppression.hpp"
+#include "non_maximal_suppression/IndexedGreedyNonMaximalSuppression.hpp"
 #include "integral_channels/IntegralChannelsForPedestrians.hpp"
 #include "SoftCascadeOverIntegralChannelsModel.hpp"
 
 #include "SlidingIntegralFeature.hpp"
+#include "SoftCascadeWindowsTileEvaluator.hpp"
+#include "CompiledSoftCascadeOverIntegralChannels.hpp"
+#include "compiled_detector_model.pb.h"
 
 #if defined(TESTING)
 #include "BaseVeryFastIntegralChannelsDetector.hpp"
@@ -24,9 +29,15 @@
 
 #include <boost/format.hpp>
 #include <boost/foreach.hpp>
+#include <boost/math/special_functions/round.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <omp.h>
 
 #include <limits>
 #include <cmath>
+#include <cstdlib>
+#include <algorithm>
 
 namespace
 {
@@ -64,6 +75,9 @@ typedef IntegralChannelsDetector::detection_window_size_t detection_window_size_
 typedef IntegralChannelsDetector::detections_scores_t detections_scores_t;
 typedef IntegralChannelsDetector::stages_left_t stages_left_t;
 typedef IntegralChannelsDetector::stages_left_in_the_row_t stages_left_in_the_row_t;
+typedef IntegralChannelsDetector::num_evaluated_stages_t num_evaluated_stages_t;
+typedef IntegralChannelsDetector::windows_rows_per_column_t windows_rows_per_column_t;
+typedef IntegralChannelsDetector::rows_mask_t rows_mask_t;
 
 typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
 
@@ -78,14 +92,70 @@ IntegralChannelsDetector::IntegralChannelsDetector(
         const float score_threshold,
         const int additional_border)
     : BaseIntegralChannelsDetector(options, cascade_model_p, non_maximal_suppression_p,
-                                   score_threshold, additional_border)
+                                   score_threshold, additional_border),
+      channels_pyramid_real_scales_per_octave(
+          get_option_value<int>(options, "objects_detector.channels_pyramid_real_scales_per_octave")),
+      streaming_nms_buffer_size(
+          (non_maximal_suppression_p == false)? 0 :
+                                                get_option_value<int>(options, "objects_detector.streaming_nms_buffer_size")),
+      streaming_nms_max_detections(get_option_value<int>(options, "objects_detector.streaming_nms_max_detections")),
+      use_single_pass_integral_channels(
+          get_option_value<bool>(options, "objects_detector.single_pass_integral_channels")),
+      use_integer_features(get_option_value<bool>(options, "objects_detector.integer_features")),
+      compiled_cascades_file_path(get_option_value<string>(options, "objects_detector.compiled_cascades_file")),
+      min_evaluated_stages(get_option_value<int>(options, "objects_detector.min_evaluated_stages")),
+      full_search_period(get_option_value<int>(options, "objects_detector.full_search_period"))
 {
 
 
     max_score_last_frame = score_threshold * 2;
+    use_window_major_evaluation = false;
+    compiled_cascades_file_was_read = false;
+    ground_plane_skipped_rows_fraction = 0;
+
+    if(full_search_period <= 0)
+    {
+        throw std::invalid_argument("objects_detector.full_search_period should be a positive number");
+    }
+    frames_since_full_search = full_search_period; // the first frame is fully searched
+    predicted_regions_were_set = false;
+    stixels_windows_rows_were_computed = false;
+
+    streaming_nms_minimal_overlap_threshold = 0;
+    if(streaming_nms_buffer_size > 0)
+    {
+        // the streamed suppression uses IndexedGreedyNonMaximalSuppression,
+        // which provides the same results as GreedyNonMaximalSuppression, but not as the other methods
+        const bool is_greedy_non_maximal_suppression =
+                (dynamic_cast<GreedyNonMaximalSuppression *>(non_maximal_suppression_p.get()) != NULL)
+                or (dynamic_cast<IndexedGreedyNonMaximalSuppression *>(non_maximal_suppression_p.get()) != NULL);
+        if(is_greedy_non_maximal_suppression == false)
+        {
+            throw std::invalid_argument("objects_detector.streaming_nms_buffer_size > 0 requires "
+                                        "objects_detector.non_maximal_suppression_method greedy or greedy_indexed");
+        }
+
+        // same overlap criterion as the greedy non maximal suppression used at the end of compute()
+        streaming_nms_minimal_overlap_threshold =
+                get_option_value<float>(options, "objects_detector.minimal_overlap_threshold");
+
+        if(streaming_nms_max_detections <= 0)
+        {
+            throw std::invalid_argument("objects_detector.streaming_nms_max_detections should be positive");
+        }
+    }
+
+    use_parallel_scales = get_option_value<bool>(options, "objects_detector.parallel_scales");
+#if defined(TESTING) or defined(BOOTSTRAPPING_LIB)
+    // testing and bootstrapping store per scale information inside the detector (or in global variables),
+    // we need to compute one scale after the other
+    use_parallel_scales = false;
+#endif
 
     // create the integral channels computer
     integral_channels_computer_p.reset(new IntegralChannelsForPedestrians());
+    integral_channels_computer_p->set_single_pass_computation(use_single_pass_integral_channels);
+    input_image_index = 0;
 
     return;
 }
@@ -98,12 +168,167 @@ IntegralChannelsDetector::~IntegralChannelsDetector()
 }
 
 
+IntegralChannelsDetector::ComputedIntegralChannelsKey::ComputedIntegralChannelsKey()
+    : input_image_index(0), scaled_input_image_size(0, 0)
+{
+    // nothing to do here
+    return;
+}
+
+
+void IntegralChannelsDetector::set_window_major_evaluation(const bool use_window_major_evaluation_)
+{
+    use_window_major_evaluation = use_window_major_evaluation_;
+
+    if(use_window_major_evaluation and (compiled_cascade_per_scale.size() != detection_cascade_per_scale.size()))
+    {
+        // set_image was already called
+        compile_detection_cascades();
+    }
+    return;
+}
+
+
+void IntegralChannelsDetector::compile_detection_cascades()
+{
+    compiled_cascade_per_scale.clear();
+
+    if(use_window_major_evaluation == false)
+    {
+        // the stage-major evaluation uses directly the cascade stages
+        return;
+    }
+
+    if((compiled_cascades_file_path.empty() == false) and (compiled_cascades_file_was_read == false))
+    {
+        read_compiled_cascades_file();
+        compiled_cascades_file_was_read = true;
+    }
+
+    const size_t num_scales = detection_cascade_per_scale.size();
+    size_t num_compiled_cascades = 0;
+    compiled_cascade_per_scale.reserve(num_scales);
+    for(size_t scale_index=0; scale_index < num_scales; scale_index+=1)
+    {
+        const bool use_stumps = (detection_stump_cascade_per_scale.empty() == false)
+                and (detection_stump_cascade_per_scale[scale_index].empty() == false);
+
+        const boost::uint64_t checksum =
+                use_stumps?
+                    CompiledSoftCascadeOverIntegralChannels::compute_checksum(
+                        detection_stump_cascade_per_scale[scale_index]) :
+                    CompiledSoftCascadeOverIntegralChannels::compute_checksum(
+                        detection_cascade_per_scale[scale_index]);
+
+        std::map<boost::uint64_t, CompiledCascadeEntry>::iterator entry_it = compiled_cascades_cache.find(checksum);
+        if((entry_it == compiled_cascades_cache.end()) or (entry_it->second.cascade_p->get_use_stumps() != use_stumps))
+        {
+            CompiledCascadeEntry entry;
+            if(use_stumps)
+            {
+                entry.cascade_p.reset(
+                            new CompiledSoftCascadeOverIntegralChannels(detection_stump_cascade_per_scale[scale_index]));
+            }
+            else
+            {
+                entry.cascade_p.reset(
+                            new CompiledSoftCascadeOverIntegralChannels(detection_cascade_per_scale[scale_index]));
+            }
+            entry.relative_scale = detector_cascade_relative_scale_per_scale[scale_index];
+            entry.detection_window_size = detection_window_size_per_scale[scale_index];
+
+            entry_it = compiled_cascades_cache.insert(std::make_pair(checksum, entry)).first;
+            num_compiled_cascades += 1;
+        }
+
+        compiled_cascade_per_scale.push_back(entry_it->second.cascade_p);
+    } // end of "for each scale"
+
+    if(num_compiled_cascades > 0)
+    {
+        size_t memory_size = 0;
+        BOOST_FOREACH(const boost::shared_ptr<const CompiledSoftCascadeOverIntegralChannels> &cascade_p,
+                      compiled_cascade_per_scale)
+        {
+            memory_size += cascade_p->get_memory_size();
+        }
+
+        log_debug() << boost::str(boost::format(
+                                      "Compiled %i cascades (%i cached), %.1f KiB per scale on average")
+                                  % num_compiled_cascades
+                                  % compiled_cascades_cache.size()
+                                  % (memory_size / (1024.0f*std::max<size_t>(1, num_scales)))) << std::endl;
+
+        if(compiled_cascades_file_path.empty() == false)
+        {
+            save_compiled_cascades_file();
+        }
+    }
+
+    return;
+}
+
+
+void IntegralChannelsDetector::read_compiled_cascades_file()
+{
+    doppia_protobuf::CompiledSoftCascadesModel compiled_cascades;
+    if(read_compiled_soft_cascades(compiled_cascades_file_path, compiled_cascades) == false)
+    {
+        // the file will be created after compiling the cascades
+        return;
+    }
+
+    for(int index=0; index < compiled_cascades.cascades_size(); index+=1)
+    {
+        const doppia_protobuf::CompiledSoftCascade &compiled_cascade = compiled_cascades.cascades(index);
+
+        CompiledCascadeEntry entry;
+        entry.cascade_p.reset(new CompiledSoftCascadeOverIntegralChannels(compiled_cascade));
+        entry.relative_scale = compiled_cascade.relative_scale();
+        entry.detection_window_size.x(compiled_cascade.detection_window_width());
+        entry.detection_window_size.y(compiled_cascade.detection_window_height());
+
+        // cascades compiled from another model will never be used,
+        // since their source checksum will not match
+        compiled_cascades_cache.insert(std::make_pair(compiled_cascade.source_checksum(), entry));
+    }
+
+    return;
+}
+
+
+void IntegralChannelsDetector::save_compiled_cascades_file() const
+{
+    doppia_protobuf::CompiledSoftCascadesModel compiled_cascades;
+
+    typedef std::map<boost::uint64_t, CompiledCascadeEntry>::value_type cache_entry_t;
+    BOOST_FOREACH(const cache_entry_t &cache_entry, compiled_cascades_cache)
+    {
+        const CompiledCascadeEntry &entry = cache_entry.second;
+        entry.cascade_p->to_protobuf(entry.relative_scale,
+                                     entry.detection_window_size.x(), entry.detection_window_size.y(),
+                                     *compiled_cascades.add_cascades());
+    }
+
+    write_compiled_soft_cascades(compiled_cascades_file_path, compiled_cascades);
+    return;
+}
+
+
+const std::vector<double> &IntegralChannelsDetector::get_computation_time_per_scale() const
+{
+    return computation_time_per_scale;
+}
+
+
 void IntegralChannelsDetector::set_image(const boost::gil::rgb8c_view_t &input_view_)
 {
     const bool input_dimensions_changed = (input_image.dimensions() != input_view_.dimensions());
     input_image.recreate(input_view_.dimensions());
     input_view = gil::const_view(input_image);
     gil::copy_pixels(input_view_, gil::view(input_image));
+    // the integral channels computed for the previous image cannot be reused anymore
+    input_image_index += 1;
 
 
     // set default search range --
@@ -118,9 +343,15 @@ void IntegralChannelsDetector::set_image(const boost::gil::rgb8c_view_t &input_v
 
         // update the detection cascades
         compute_scaled_detection_cascades();
+        compile_detection_cascades();
 
         // update additional, input size dependent, data
         compute_extra_data_per_scale(input_view.width(), input_view.height());
+
+        // the stixels and ground plane masks of the previous input size are not valid anymore
+        stixels_windows_rows_per_scale.clear();
+        ground_plane_rows_mask_per_scale.clear();
+        ground_plane_rows_mask_corridor.clear();
     } // end of "set default search range"
 
 
@@ -137,14 +368,348 @@ void IntegralChannelsDetector::set_image(const boost::gil::rgb8c_view_t &input_v
         stages_left_in_the_row.resize(max_y);
         stages_left.resize(boost::extents[max_y][max_x]);
         detections_scores.resize(boost::extents[max_y][max_x]);
+        num_evaluated_stages.resize(boost::extents[max_y][max_x]);
+    }
+
+    return;
+}
+
+
+void IntegralChannelsDetector::set_stixels(const stixels_t &stixels)
+{
+    BaseIntegralChannelsDetector::set_stixels(stixels);
+    compute_stixels_windows_rows();
+    return;
+}
+
+
+void IntegralChannelsDetector::compute_stixels_windows_rows()
+{
+    using boost::math::iround;
+
+    stixels_windows_rows_per_scale.clear();
+
+    if(estimated_stixels.empty() or search_ranges.empty())
+    {
+        // nothing to do here
+        return;
+    }
+
+    assert(extra_data_per_scale.size() == search_ranges.size());
+
+    const size_t num_scales = search_ranges.size();
+    const int
+            shrinking_factor = IntegralChannelsForPedestrians::get_shrinking_factor(),
+            num_stixels = estimated_stixels.size(),
+            border = std::max(0, additional_border);
+
+    // the object is assumed to be centered in the detection window
+    const float object_to_detection_window_height_ratio = get_object_to_detection_window_height_ratio();
+
+    // scales sorted by detection window height, used to define the stixels_scales_margin
+    std::vector<size_t> scale_indices(num_scales), scale_rank(num_scales);
+    std::vector<float> sorted_window_heights(num_scales);
+    {
+        for(size_t scale_index=0; scale_index < num_scales; scale_index+=1)
+        {
+            scale_indices[scale_index] = scale_index;
+        }
+
+        std::sort(scale_indices.begin(), scale_indices.end(), SearchRangeScaleComparator(search_ranges));
+
+        for(size_t rank=0; rank < num_scales; rank+=1)
+        {
+            const size_t scale_index = scale_indices[rank];
+            scale_rank[scale_index] = rank;
+            sorted_window_heights[rank] = extra_data_per_scale[scale_index].scaled_detection_window_size.y();
+        }
+    }
+
+    const bool use_stixel_scale_range = (stixels_scales_margin > 0);
+
+    float
+            windows_count_original = 0,
+            windows_count_updated = 0;
+
+    stixels_windows_rows_per_scale.resize(num_scales);
+    for(size_t scale_index=0; scale_index < num_scales; scale_index+=1)
+    {
+        const ScaleData &scale_data = extra_data_per_scale[scale_index];
+        const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
+        windows_rows_per_column_t &windows_rows_per_column = stixels_windows_rows_per_scale[scale_index];
+
+        if((scaled_search_range.max_x == 0) or (scaled_search_range.max_y == 0))
+        {
+            // nothing to do here
+            continue;
+        }
+
+        const float
+                input_to_channel_scale = scaled_search_range.range_scaling,
+                input_to_channel_scale_x = scaled_search_range.range_scaling*scaled_search_range.range_ratio;
+        const int
+                // input columns covered by one integral channels column
+                columns_per_channel_column = std::max(1, iround(1.0f/input_to_channel_scale_x)),
+                half_window_width = scale_data.scaled_detection_window_size.x() / 2,
+                num_columns = scale_data.scaled_input_image_size.x() / shrinking_factor + 1;
+
+        windows_rows_per_column.resize(num_columns);
+        for(int col=0; col < num_columns; col+=1)
+        {
+            // the stixels under the center of the detection window
+            const int
+                    window_center_x = iround(col/input_to_channel_scale_x) + half_window_width - border,
+                    first_stixel_index = std::max(0, std::min(num_stixels - 1, window_center_x - columns_per_channel_column/2)),
+                    last_stixel_index = std::min(num_stixels, first_stixel_index + columns_per_channel_column);
+
+            Stixel aggregated_stixel = estimated_stixels[first_stixel_index];
+            bool all_occluded = (aggregated_stixel.type == Stixel::Occluded);
+            for(int stixel_index = first_stixel_index + 1; stixel_index < last_stixel_index; stixel_index += 1)
+            {
+                const Stixel &t_stixel = estimated_stixels[stixel_index];
+                all_occluded &= (t_stixel.type == Stixel::Occluded);
+                aggregated_stixel.top_y = std::min(aggregated_stixel.top_y, t_stixel.top_y);
+                aggregated_stixel.bottom_y = std::max(aggregated_stixel.bottom_y, t_stixel.bottom_y);
+            } // end of "for each stixel covered by the channel column"
+
+            const int
+                    stixel_center_y = (aggregated_stixel.top_y + aggregated_stixel.bottom_y) / 2 + border,
+                    stixel_height = aggregated_stixel.bottom_y - aggregated_stixel.top_y,
+                    detection_height = stixel_height*object_to_detection_window_height_ratio,
+                    detection_top_y = stixel_center_y - detection_height/2;
+
+            IntegralChannelsDetector::WindowsRowsRange &rows_range = windows_rows_per_column[col];
+
+            bool scale_is_in_the_stixel_range = true;
+            if(use_stixel_scale_range)
+            {
+                // the reference scale is the one with the closest detection window height
+                size_t reference_rank =
+                        std::lower_bound(sorted_window_heights.begin(), sorted_window_heights.end(),
+                                         static_cast<float>(detection_height)) - sorted_window_heights.begin();
+                if(reference_rank == num_scales)
+                {
+                    reference_rank = num_scales - 1;
+                }
+                else if((reference_rank > 0) and (detection_height > 0)
+                        and ((detection_height / sorted_window_heights[reference_rank - 1])
+                             < (sorted_window_heights[reference_rank] / detection_height)))
+                {
+                    reference_rank -= 1;
+                }
+
+                const int rank_delta = static_cast<int>(scale_rank[scale_index]) - static_cast<int>(reference_rank);
+                scale_is_in_the_stixel_range = (std::abs(rank_delta) <= stixels_scales_margin);
+            }
+
+            if(scale_is_in_the_stixel_range == false)
+            {
+                rows_range.min_y = 1;
+                rows_range.max_y = 0;
+                continue;
+            }
+
+            if(all_occluded)
+            {
+                // the bottom of the stixel is constrained, but the top is not (will use only ground plane top constraints)
+                rows_range.min_y = 0;
+            }
+            else
+            {
+                rows_range.min_y = std::max(0, static_cast<int>(
+                                                std::floor((detection_top_y - stixels_vertical_margin)*input_to_channel_scale)));
+            }
+
+            rows_range.max_y = std::ceil((detection_top_y + stixels_vertical_margin)*input_to_channel_scale);
+
+        } // end of "for each integral channels column"
+
+        // count the searched windows, for statistics
+        const stride_t &stride = scale_data.stride;
+        for(size_t col=scaled_search_range.min_x; col < scaled_search_range.max_x; col+=stride.x())
+        {
+            const IntegralChannelsDetector::WindowsRowsRange &rows_range =
+                    windows_rows_per_column[std::min<size_t>(col, num_columns - 1)];
+            for(size_t y=scaled_search_range.min_y; y < scaled_search_range.max_y; y+=stride.y())
+            {
+                windows_count_original += 1;
+                const int row = y;
+                if((row >= rows_range.min_y) and (row <= rows_range.max_y))
+                {
+                    windows_count_updated += 1;
+                }
+            } // end of "for each row"
+        } // end of "for each column"
+
+    } // end of "for each scale"
+
+    if(stixels_windows_rows_were_computed == false)
+    {
+        log_info() << str(format("The stixels keep %.1f%% of the candidate windows, "
+                                 "expected speed gain == %.2fx (num windows original/updated)")
+                          % (100*windows_count_updated / (windows_count_original + 1))
+                          % (windows_count_original / (windows_count_updated + 1))) << std::endl;
+    }
+
+    stixels_windows_rows_were_computed = true;
+    return;
+}
+
+float IntegralChannelsDetector::get_object_to_detection_window_height_ratio() const
+{
+    float object_to_detection_window_height_ratio = 1.0f;
+    if(model_window_to_object_window_converter_p)
+    {
+        detections_t scale_one_detections(1);
+        detection_t::rectangle_t &box = scale_one_detections.front().bounding_box;
+        box.min_corner().x(0);
+        box.min_corner().y(0);
+        box.max_corner().x(scale_one_detection_window_size.x());
+        box.max_corner().y(scale_one_detection_window_size.y());
+
+        (*model_window_to_object_window_converter_p)(scale_one_detections);
+
+        const detection_t::rectangle_t &object_box = scale_one_detections.front().bounding_box;
+        const float object_height = object_box.max_corner().y() - object_box.min_corner().y();
+        if(object_height > 0)
+        {
+            object_to_detection_window_height_ratio = scale_one_detection_window_size.y() / object_height;
+        }
+    }
+
+    return object_to_detection_window_height_ratio;
+}
+
+
+void IntegralChannelsDetector::set_predicted_regions(const predicted_regions_t &regions)
+{
+    predicted_regions = regions;
+    predicted_regions_were_set = true;
+    return;
+}
+
+
+void IntegralChannelsDetector::compute_predicted_windows_rows()
+{
+    using boost::math::iround;
+
+    predicted_windows_rows_per_scale.clear();
+    predicted_regions_scales_mask.clear();
+
+    if(search_ranges.empty())
+    {
+        // nothing to do here
+        return;
     }
 
+    assert(extra_data_per_scale.size() == search_ranges.size());
+
+    const size_t num_scales = search_ranges.size();
+    const int shrinking_factor = IntegralChannelsForPedestrians::get_shrinking_factor();
+    const float object_to_detection_window_height_ratio = get_object_to_detection_window_height_ratio();
+
+    predicted_windows_rows_per_scale.resize(num_scales);
+    predicted_regions_scales_mask.resize(num_scales, false);
+
+    for(size_t scale_index=0; scale_index < num_scales; scale_index+=1)
+    {
+        const ScaleData &scale_data = extra_data_per_scale[scale_index];
+        const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
+        windows_rows_per_column_t &windows_rows_per_column = predicted_windows_rows_per_scale[scale_index];
+
+        if((scaled_search_range.max_x == 0) or (scaled_search_range.max_y == 0))
+        {
+            // nothing to do here
+            continue;
+        }
+
+        const float
+                input_to_channel_scale = scaled_search_range.range_scaling,
+                input_to_channel_scale_x = scaled_search_range.range_scaling*scaled_search_range.range_ratio,
+                window_width = scale_data.scaled_detection_window_size.x(),
+                window_height = scale_data.scaled_detection_window_size.y();
+        const int num_columns = scale_data.scaled_input_image_size.x() / shrinking_factor + 1;
+
+        // max_y < min_y indicates that no row is searched
+        IntegralChannelsDetector::WindowsRowsRange empty_rows_range;
+        empty_rows_range.min_y = 1;
+        empty_rows_range.max_y = 0;
+        windows_rows_per_column.assign(num_columns, empty_rows_range);
+
+        BOOST_FOREACH(const PredictedRegion &region, predicted_regions)
+        {
+            const detection_t::rectangle_t &box = region.bounding_box;
+            const float
+                    region_height = box.max_corner().y() - box.min_corner().y(),
+                    expected_window_height = region_height*object_to_detection_window_height_ratio,
+                    max_height_ratio = 1 + std::max(0.0f, region.scale_uncertainty);
+
+            if((expected_window_height <= 0)
+               or (window_height > expected_window_height*max_height_ratio)
+               or (window_height*max_height_ratio < expected_window_height))
+            {
+                // this scale does not match the predicted region
+                continue;
+            }
+
+            // the detection window center should be inside the region position uncertainty
+            const float
+                    uncertainty = std::max(0.0f, region.position_uncertainty),
+                    center_x = (box.min_corner().x() + box.max_corner().x()) / 2.0f,
+                    center_y = (box.min_corner().y() + box.max_corner().y()) / 2.0f;
+            const int
+                    min_col = std::max(0, static_cast<int>(
+                                           std::floor((center_x - uncertainty - window_width/2)*input_to_channel_scale_x))),
+                    max_col = std::min(num_columns - 1, static_cast<int>(
+                                           std::ceil((center_x + uncertainty - window_width/2)*input_to_channel_scale_x))),
+                    min_y = std::max(0, static_cast<int>(
+                                         std::floor((center_y - uncertainty - window_height/2)*input_to_channel_scale))),
+                    max_y = std::ceil((center_y + uncertainty - window_height/2)*input_to_channel_scale);
+
+            for(int col = min_col; col <= max_col; col += 1)
+            {
+                // a single rows range per column, overlapping regions are merged
+                IntegralChannelsDetector::WindowsRowsRange &rows_range = windows_rows_per_column[col];
+                if(rows_range.max_y < rows_range.min_y)
+                {
+                    rows_range.min_y = min_y;
+                    rows_range.max_y = max_y;
+                }
+                else
+                {
+                    rows_range.min_y = std::min(rows_range.min_y, min_y);
+                    rows_range.max_y = std::max(rows_range.max_y, max_y);
+                }
+            } // end of "for each column around the predicted region"
+        } // end of "for each predicted region"
+
+        const bool use_stixels =
+                (scale_index < stixels_windows_rows_per_scale.size())
+                and (stixels_windows_rows_per_scale[scale_index].empty() == false);
+
+        for(int col=0; col < num_columns; col+=1)
+        {
+            IntegralChannelsDetector::WindowsRowsRange &rows_range = windows_rows_per_column[col];
+            if(use_stixels)
+            {
+                const windows_rows_per_column_t &stixels_windows_rows = stixels_windows_rows_per_scale[scale_index];
+                const IntegralChannelsDetector::WindowsRowsRange &stixels_rows_range =
+                        stixels_windows_rows[std::min<size_t>(col, stixels_windows_rows.size() - 1)];
+                rows_range.min_y = std::max(rows_range.min_y, stixels_rows_range.min_y);
+                rows_range.max_y = std::min(rows_range.max_y, stixels_rows_range.max_y);
+            }
+
+            if(rows_range.min_y <= rows_range.max_y)
+            {
+                predicted_regions_scales_mask[scale_index] = true;
+            }
+        } // end of "for each integral channels column"
+
+    } // end of "for each scale"
+
     return;
 }
 
-// FIXME complete hack, using global variables !
-boost::multi_array<int, 2> num_weak_classifiers;
-size_t current_y;
 
 // useful for debugging (see also SlidingIntegralFeature.hpp)
 const bool print_each_feature_value = false;
@@ -281,6 +846,23 @@ bool compute_cascade_stage_on_row(
 
 
 
+/// (feature_value >= feature_threshold), evaluated either using floats (as the original code)
+/// or using integers, with the feature threshold converted to integral channels units
+inline
+bool evaluate_node(SlidingIntegralFeature &feature, const SimpleDecisionStump &node,
+                   const boost::int32_t integer_threshold, const bool use_integer_features)
+{
+    if(use_integer_features)
+    {
+        return feature.get_integer_value() >= integer_threshold;
+    }
+    else
+    {
+        return node(feature.get_value());
+    }
+}
+
+
 /// @return true if there are still detections left (unresolved) in the row
 inline
 bool compute_cascade_stage_on_row(
@@ -290,8 +872,10 @@ bool compute_cascade_stage_on_row(
         const size_t row_index,
         const int xstride,
         const bool use_the_detector_model_cascade,
+        const bool use_integer_features,
         detections_scores_t::reference &detections_scores,
-        stages_left_t::reference &stages_left)
+        stages_left_t::reference &stages_left,
+        num_evaluated_stages_t::reference &num_evaluated_stages)
 {
     bool detections_left_unresolved = false;
 
@@ -301,6 +885,8 @@ bool compute_cascade_stage_on_row(
     SlidingIntegralFeature
             the_feature(weak_classifier.feature,
                         integral_channels, row_index, start_col, xstride);
+    const boost::int32_t integer_threshold =
+            CompiledSoftCascadeOverIntegralChannels::get_integer_threshold(weak_classifier.feature_threshold);
 
     // we expect search_range.max_x to protect us of reading out of the bounds the image row
     // for each element in row check if score is already too high
@@ -316,10 +902,12 @@ bool compute_cascade_stage_on_row(
 
         detections_scores_t::element &detection_score = detections_scores[col];
 
-        num_weak_classifiers[current_y][col] += 1; // FIXME complete hack
+        num_evaluated_stages[col] += 1;
 
         // update the detection score --
-        detection_score += weak_classifier(the_feature.get_value());
+        detection_score +=
+                evaluate_node(the_feature, weak_classifier, integer_threshold, use_integer_features)?
+                    weak_classifier.weight_true_leaf : weak_classifier.weight_false_leaf;
 
         if(use_the_detector_model_cascade and detection_score < stage.cascade_threshold)
         {
@@ -357,8 +945,10 @@ bool compute_cascade_stage_on_row(
         const size_t row_index,
         const int xstride,
         const bool use_the_detector_model_cascade,
+        const bool use_integer_features,
         detections_scores_t::reference &detections_scores,
-        stages_left_t::reference &stages_left)
+        stages_left_t::reference &stages_left,
+        num_evaluated_stages_t::reference &num_evaluated_stages)
 {
 
     const bool print_cascade_scores = false; // just for debugging
@@ -375,6 +965,17 @@ bool compute_cascade_stage_on_row(
             level2_false_feature(weak_classifier.level2_false_node.feature,
                                  integral_channels, row_index, start_col, xstride);
 
+    const DecisionStumpWithWeights
+            &level2_true_node = weak_classifier.level2_true_node,
+            &level2_false_node = weak_classifier.level2_false_node;
+    const boost::int32_t
+            level1_threshold = CompiledSoftCascadeOverIntegralChannels::get_integer_threshold(
+                                   weak_classifier.level1_node.feature_threshold),
+            level2_true_threshold = CompiledSoftCascadeOverIntegralChannels::get_integer_threshold(
+                                        level2_true_node.feature_threshold),
+            level2_false_threshold = CompiledSoftCascadeOverIntegralChannels::get_integer_threshold(
+                                         level2_false_node.feature_threshold);
+
     // we expect search_range.max_x to protect us of reading out of the bounds the image row
     // for each element in row check if score is already too high
     for(size_t col=start_col; col < search_range.max_x;
@@ -389,7 +990,7 @@ bool compute_cascade_stage_on_row(
 
         detections_scores_t::element &detection_score = detections_scores[col];
 
-        num_weak_classifiers[current_y][col] += 1; // FIXME complete hack
+        num_evaluated_stages[col] += 1;
 
         if(print_each_feature_value)
         { // useful for debugging
@@ -397,14 +998,18 @@ bool compute_cascade_stage_on_row(
         }
 
         // level 1 nodes return a boolean value,
-        // level 2 nodes return directly the float value to add to the score
-        if( weak_classifier.level1_node(level1_feature.get_value()) == true)
+        // level 2 nodes select the float value to add to the score
+        if(evaluate_node(level1_feature, weak_classifier.level1_node, level1_threshold, use_integer_features))
         {
-            detection_score += weak_classifier.level2_true_node(level2_true_feature.get_value());
+            detection_score +=
+                    evaluate_node(level2_true_feature, level2_true_node, level2_true_threshold, use_integer_features)?
+                        level2_true_node.weight_true_leaf : level2_true_node.weight_false_leaf;
         }
         else
         {
-            detection_score += weak_classifier.level2_false_node(level2_false_feature.get_value());
+            detection_score +=
+                    evaluate_node(level2_false_feature, level2_false_node, level2_false_threshold, use_integer_features)?
+                        level2_false_node.weight_true_leaf : level2_false_node.weight_false_leaf;
         }
 
         // (16,16) is the INRIA training positive pedestrians position
@@ -476,11 +1081,15 @@ size_t current_detector_index = 0;
 #endif
 
 
+/// collect the detections with score above the threshold,
+/// ignoring the windows where less than min_evaluated_stages stages where evaluated
 void collect_the_detections(
         const ScaleData &scale_data,
         const detection_window_size_t &original_detection_window_size,
         const detections_scores_t &detections_scores,
+        const num_evaluated_stages_t &num_evaluated_stages,
         const float detection_score_threshold,
+        const int min_evaluated_stages,
         detections_t &detections,
         detections_t *non_rescaled_detections_p)
 {
@@ -497,15 +1106,14 @@ void collect_the_detections(
     for(uint16_t row=search_range.min_y; row < search_range.max_y; row += stride.y())
     {
         detections_scores_t::const_reference scores_row = detections_scores[row];
+        num_evaluated_stages_t::const_reference num_evaluated_stages_row = num_evaluated_stages[row];
         for(uint16_t col=search_range.min_x; col < search_range.max_x; col += stride.x())
         {
             const detections_scores_t::element &detection_score = scores_row[col];
 
             // >= to be consistent with Markus's code
             if(detection_score >= detection_score_threshold
-               //and (num_weak_classifiers[row][col] > 300) // FIXME complete hack
-               and (num_weak_classifiers[row][col] > 3000) // FIXME complete hack
-               )
+               and (num_evaluated_stages_row[col] >= min_evaluated_stages))
             { // we got a detection, yey !
 
                 add_detection(col, row, detection_score, scale_data, detections);
@@ -542,26 +1150,262 @@ void collect_the_detections(
 }
 
 
-template<typename CascadeStageType>
-void compute_detections_at_specific_scale_impl(
-        stages_left_in_the_row_t &stages_left_in_the_row,
-        stages_left_t &stages_left,
-        detections_scores_t &detections_scores,
-        const integral_channels_t &integral_channels,
-        const detection_window_size_t &original_detection_window_size,
-        const float original_detection_window_scale,
-        detections_t &detections, detections_t *non_rescaled_detections_p,
-        const CascadeStageType &cascade_stages,
-        const float score_threshold,
+/// collect the detections inside the search range,
+/// and (if use_partial_detectors is true) in the areas where the detection window gets out of the input image
+void collect_the_detections(
         const ScaleData &scale_data,
-        const bool print_stages,
-        const bool print_cascade_statistics,
-        const bool save_score_image,
-        const bool use_the_detector_model_cascade)
+        const detection_window_size_t &original_detection_window_size,
+        const integral_channels_t &integral_channels,
+        const detections_scores_t &detections_scores,
+        const num_evaluated_stages_t &num_evaluated_stages,
+        const float detection_score_threshold,
+        const int min_evaluated_stages,
+        const bool use_partial_detectors,
+        detections_t &detections,
+        detections_t *non_rescaled_detections_p)
 {
+    collect_the_detections(scale_data, original_detection_window_size,
+                           detections_scores, num_evaluated_stages,
+                           detection_score_threshold, min_evaluated_stages,
+                           detections, non_rescaled_detections_p);
 
-    typedef typename CascadeStageType::value_type cascade_stage_t;
-    const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
+    if(use_partial_detectors)
+    {
+        ScaleData scale_data_fixed = scale_data;
+
+        const size_t
+                max_row = integral_channels.shape()[1],
+                max_col = integral_channels.shape()[2];
+        scale_data_fixed.scaled_search_range.max_y = max_row;
+        scale_data_fixed.scaled_search_range.max_x = max_col;
+
+        collect_the_detections(scale_data_fixed, original_detection_window_size,
+                               detections_scores, num_evaluated_stages,
+                               detection_score_threshold, min_evaluated_stages,
+                               detections, non_rescaled_detections_p);
+    }
+
+    return;
+}
+
+
+/// helper method for debugging
+void save_detections_scores_image(const detections_scores_t &detections_scores,
+                                  const DetectorSearchRange &scaled_search_range,
+                                  const float original_detection_window_scale)
+{
+    cv::Mat scores_mat(
+                //detections_scores.shape()[0], detections_scores.shape()[1],
+                scaled_search_range.max_y, scaled_search_range.max_x,
+                CV_32FC1, const_cast<detections_scores_t::element *>(detections_scores.origin()),
+                detections_scores.strides()[0]*sizeof(detections_scores_t::element));
+
+    cv::Mat normalized_scores;
+    double min_score, max_score;
+    cv::minMaxLoc(scores_mat, &min_score, &max_score);
+    cv::normalize(scores_mat, normalized_scores, 255, 0, cv::NORM_MINMAX);
+
+    const string filename = str(format("scores_at_%.2f.png") % original_detection_window_scale);
+    cv::imwrite(filename, normalized_scores);
+    log_info() << "Created debug file " << filename << std::endl;
+    log_info() << str(format("Scores in %s are in the range (min, max) == (%.3f, %.3f)")
+                      % filename % min_score % max_score) << std::endl;
+
+    if(false and min_score > 0)
+    {
+        throw std::runtime_error("Min score should be 0 sometimes. Something is fishy in this test.");
+    }
+
+    return;
+}
+
+
+/// set to zero the number of evaluated stages over the area used at the current scale,
+/// that is the search range plus the rows and columns used for partial detections
+void reset_num_evaluated_stages(const DetectorSearchRange &scaled_search_range,
+                                const integral_channels_t &integral_channels,
+                                const detections_scores_t &detections_scores,
+                                num_evaluated_stages_t &num_evaluated_stages)
+{
+    if((num_evaluated_stages.shape()[0] != detections_scores.shape()[0])
+       or (num_evaluated_stages.shape()[1] != detections_scores.shape()[1]))
+    {
+        num_evaluated_stages.resize(boost::extents[detections_scores.shape()[0]][detections_scores.shape()[1]]);
+    }
+
+    const size_t
+            max_row = std::min<size_t>(integral_channels.shape()[1], num_evaluated_stages.shape()[0]),
+            max_col = std::min<size_t>(integral_channels.shape()[2], num_evaluated_stages.shape()[1]);
+
+    for(size_t y=scaled_search_range.min_y; y < max_row; y+=1)
+    {
+        num_evaluated_stages_t::reference num_evaluated_stages_row = num_evaluated_stages[y];
+        std::fill(num_evaluated_stages_row.begin() + scaled_search_range.min_x,
+                  num_evaluated_stages_row.begin() + max_col, 0);
+    }
+
+    return;
+}
+
+
+/// the windows placed outside of the rows allowed by the stixels (or by the ground plane corridor)
+/// are marked as resolved before evaluating any cascade stage
+/// (num_evaluated_stages == -1 indicates a window that was not searched)
+void skip_the_windows_outside_of_the_search_masks(
+        const windows_rows_per_column_t *stixels_windows_rows_p,
+        const rows_mask_t *ground_plane_rows_mask_p,
+        const DetectorSearchRange &scaled_search_range,
+        const stride_t &actual_stride,
+        const integral_channels_t &integral_channels,
+        stages_left_in_the_row_t &stages_left_in_the_row,
+        stages_left_t &stages_left,
+        num_evaluated_stages_t &num_evaluated_stages)
+{
+    const bool
+            use_stixels = (stixels_windows_rows_p != NULL) and (stixels_windows_rows_p->empty() == false),
+            use_ground_plane = (ground_plane_rows_mask_p != NULL) and (ground_plane_rows_mask_p->empty() == false);
+
+    if((use_stixels == false) and (use_ground_plane == false))
+    {
+        // nothing to do here
+        return;
+    }
+
+    const size_t
+            max_row = std::min<size_t>(integral_channels.shape()[1], stages_left.shape()[0]),
+            max_col = std::min<size_t>(integral_channels.shape()[2], stages_left.shape()[1]),
+            ystride = actual_stride.y();
+
+#pragma omp parallel for
+    for(size_t y=scaled_search_range.min_y; y < max_row; y+=ystride)
+    {
+        stages_left_t::reference stages_left_row = stages_left[y];
+        num_evaluated_stages_t::reference num_evaluated_stages_row = num_evaluated_stages[y];
+        const int row = y;
+
+        const bool row_fits_the_ground_plane =
+                (use_ground_plane == false)
+                or (*ground_plane_rows_mask_p)[std::min(y, ground_plane_rows_mask_p->size() - 1)];
+
+        bool windows_left_in_the_row = false;
+        for(size_t col=scaled_search_range.min_x; col < max_col; col+=actual_stride.x())
+        {
+            bool window_fits_the_stixels = true;
+            if(use_stixels)
+            {
+                const windows_rows_per_column_t &windows_rows_per_column = *stixels_windows_rows_p;
+                const IntegralChannelsDetector::WindowsRowsRange &rows_range =
+                        windows_rows_per_column[std::min(col, windows_rows_per_column.size() - 1)];
+                window_fits_the_stixels = (row >= rows_range.min_y) and (row <= rows_range.max_y);
+            }
+
+            if((row_fits_the_ground_plane == false) or (window_fits_the_stixels == false))
+            {
+                stages_left_row[col] = false;
+                num_evaluated_stages_row[col] = -1;
+            }
+            else
+            {
+                windows_left_in_the_row = true;
+            }
+        } // end of "for each column"
+
+        if(windows_left_in_the_row == false)
+        {
+            stages_left_in_the_row[y] = false;
+        }
+    } // end of "for each row"
+
+    return;
+}
+
+
+/// compute one cascade stage on the rows below the search range,
+/// where the detection window gets out of the input image (partial detections)
+template<typename CascadeStageType>
+void compute_cascade_stage_on_bottom_rows(
+        const DetectorSearchRange &scaled_search_range,
+        const stride_t &actual_stride,
+        const CascadeStageType &stage, const size_t stage_index,
+        const integral_channels_t &integral_channels,
+        const bool use_the_detector_model_cascade,
+        const bool use_integer_features,
+        stages_left_in_the_row_t &stages_left_in_the_row,
+        stages_left_t &stages_left,
+        detections_scores_t &detections_scores,
+        num_evaluated_stages_t &num_evaluated_stages)
+{
+    const size_t
+            max_row = integral_channels.shape()[1],
+            max_col = integral_channels.shape()[2];
+
+    DetectorSearchRange search_range_fixed_max_x = scaled_search_range;
+    search_range_fixed_max_x.max_x = max_col - stage.get_bounding_box().max_corner().x();
+
+    //printf("stages_left_in_the_row.size() == %zi, max_row == %zi\n",
+    //       stages_left_in_the_row.size(), max_row);
+    //printf("scaled_search_range.max_y == %zi\n", scaled_search_range.max_y);
+
+#pragma omp parallel for
+    for(size_t y=scaled_search_range.max_y; y < max_row; y+=actual_stride.y())
+    {
+        if(stages_left_in_the_row[y] == false)
+        {
+            // we can safely skip this row
+            continue;
+        }
+
+        const size_t bottom_y = y + stage.get_bounding_box().max_corner().y();
+        if(bottom_y < max_row)
+        {
+            detections_scores_t::reference detections_scores_row = detections_scores[y];
+            stages_left_t::reference stages_left_row = stages_left[y];
+            num_evaluated_stages_t::reference num_evaluated_stages_row = num_evaluated_stages[y];
+
+            const bool stages_left = \
+                    compute_cascade_stage_on_row(
+                        search_range_fixed_max_x, stage, stage_index, integral_channels,
+                        y, actual_stride.x(), use_the_detector_model_cascade, use_integer_features,
+                        detections_scores_row, stages_left_row, num_evaluated_stages_row);
+
+            stages_left_in_the_row[y] = stages_left;
+        }
+        else
+        {
+            // we simply skip this stage
+        }
+
+    } // end of "for each row at the bottom of search range"
+
+    return;
+}
+
+
+template<typename CascadeStageType>
+void compute_detections_at_specific_scale_impl(
+        stages_left_in_the_row_t &stages_left_in_the_row,
+        stages_left_t &stages_left,
+        detections_scores_t &detections_scores,
+        num_evaluated_stages_t &num_evaluated_stages,
+        const integral_channels_t &integral_channels,
+        const detection_window_size_t &original_detection_window_size,
+        const float original_detection_window_scale,
+        detections_t &detections, detections_t *non_rescaled_detections_p,
+        const CascadeStageType &cascade_stages,
+        const float score_threshold,
+        const int min_evaluated_stages,
+        const ScaleData &scale_data,
+        const windows_rows_per_column_t *stixels_windows_rows_p,
+        const rows_mask_t *ground_plane_rows_mask_p,
+        const bool print_stages,
+        const bool print_cascade_statistics,
+        const bool save_score_image,
+        const bool use_the_detector_model_cascade,
+        const bool use_integer_features)
+{
+
+    typedef typename CascadeStageType::value_type cascade_stage_t;
+    const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
     const stride_t &actual_stride = scale_data.stride;
 
     if((scaled_search_range.max_y == 0) or (scaled_search_range.max_x == 0))
@@ -574,11 +1418,12 @@ void compute_detections_at_specific_scale_impl(
     fill(stages_left, true);
     fill(detections_scores, 0.0f);
 
-    if(num_weak_classifiers.size() != detections_scores.size() )
-    {
-        num_weak_classifiers.resize(boost::extents[detections_scores.shape()[0]][detections_scores.shape()[1]]);
-    }
-    fill(num_weak_classifiers, 0);
+    reset_num_evaluated_stages(scaled_search_range, integral_channels, detections_scores, num_evaluated_stages);
+
+    skip_the_windows_outside_of_the_search_masks(stixels_windows_rows_p, ground_plane_rows_mask_p,
+                                                 scaled_search_range, actual_stride,
+                                                 integral_channels,
+                                                 stages_left_in_the_row, stages_left, num_evaluated_stages);
 
 
 #if not defined(NDEBUG)
@@ -613,13 +1458,13 @@ void compute_detections_at_specific_scale_impl(
 
             detections_scores_t::reference detections_scores_row = detections_scores[y];
             stages_left_t::reference stages_left_row = stages_left[y];
-            current_y = y; // FIXME complete hack
+            num_evaluated_stages_t::reference num_evaluated_stages_row = num_evaluated_stages[y];
 
             const bool stages_left = \
                     compute_cascade_stage_on_row(
                         scaled_search_range, stage, stage_index, integral_channels,
-                        y, actual_stride.x(), use_the_detector_model_cascade,
-                        detections_scores_row, stages_left_row);
+                        y, actual_stride.x(), use_the_detector_model_cascade, use_integer_features,
+                        detections_scores_row, stages_left_row, num_evaluated_stages_row);
 
             stages_left_in_the_row[y] = stages_left;
 
@@ -631,48 +1476,11 @@ void compute_detections_at_specific_scale_impl(
         {
             // we will also search in areas where the detection window gets out of the input image
             max_row = integral_channels.shape()[1];
-            const size_t max_col = integral_channels.shape()[2];
-
-            DetectorSearchRange search_range_fixed_max_x = scaled_search_range;
-            search_range_fixed_max_x.max_x = max_col - stage.get_bounding_box().max_corner().x();
-
-            //printf("stages_left_in_the_row.size() == %zi, max_row == %zi\n",
-            //       stages_left_in_the_row.size(), max_row);
-            //printf("scaled_search_range.max_y == %zi\n", scaled_search_range.max_y);
-
-#pragma omp parallel for
-            for(size_t y=scaled_search_range.max_y; y < max_row; y+=actual_stride.y())
-            {
-                if(stages_left_in_the_row[y] == false)
-                {
-                    // we can safely skip this row
-                    continue;
-                }
-
-                const size_t bottom_y = y + stage.get_bounding_box().max_corner().y();
-                if(bottom_y < max_row)
-                {
-                    detections_scores_t::reference detections_scores_row = detections_scores[y];
-                    stages_left_t::reference stages_left_row = stages_left[y];
-                    current_y = y; // FIXME complete hack
-
-                    const bool stages_left = \
-                            compute_cascade_stage_on_row(
-                                search_range_fixed_max_x, stage, stage_index, integral_channels,
-                                y, actual_stride.x(), use_the_detector_model_cascade,
-                                detections_scores_row, stages_left_row);
-
-                    stages_left_in_the_row[y] = stages_left;
-                }
-                else
-                {
-                    // we simply skip this stage
-                }
-
-            } // end of "for each row at the bottom of search range"
-
-
 
+            compute_cascade_stage_on_bottom_rows(
+                        scaled_search_range, actual_stride, stage, stage_index, integral_channels,
+                        use_the_detector_model_cascade, use_integer_features,
+                        stages_left_in_the_row, stages_left, detections_scores, num_evaluated_stages);
         } // end of "if use partial detectors"
 
         int num_rows_left = 0;
@@ -732,62 +1540,230 @@ void compute_detections_at_specific_scale_impl(
 
     if(stage_index == cascade_stages.size())
     { // at least one detection reached the last detection stage
-
-
         collect_the_detections(scale_data, original_detection_window_size,
-                               detections_scores, score_threshold,
+                               integral_channels, detections_scores, num_evaluated_stages,
+                               score_threshold, min_evaluated_stages,
+                               use_partial_detectors,
                                detections, non_rescaled_detections_p);
+    }
 
-        if(use_partial_detectors)
-        {
-            ScaleData scale_data_fixed = scale_data;
+    if(save_score_image)
+    {
+        save_detections_scores_image(detections_scores, scaled_search_range, original_detection_window_scale);
+    }
 
-            const size_t
-                    max_row = integral_channels.shape()[1],
-                    max_col = integral_channels.shape()[2];
-            scale_data_fixed.scaled_search_range.max_y = max_row;
-            scale_data_fixed.scaled_search_range.max_x = max_col;
+    return;
+} // end of compute_detections_at_specific_scale_impl
 
-            collect_the_detections(scale_data_fixed, original_detection_window_size,
-                                   detections_scores, score_threshold,
-                                   detections, non_rescaled_detections_p);
-        }
+
+/// Window-major variant of compute_detections_at_specific_scale_impl,
+/// each candidate window goes through the whole cascade before moving to the next one
+/// (using SoftCascadeWindowsTileEvaluator), instead of sweeping each stage over all the rows.
+/// The rows at the bottom of the search range (partial detections) are still computed stage-major,
+/// so that the obtained scores and detections are identical to compute_detections_at_specific_scale_impl.
+/// compiled_cascade_p must correspond to cascade_stages, if NULL the stages are compiled on the fly.
+template<typename CascadeStageType>
+void compute_detections_at_specific_scale_window_major_impl(
+        stages_left_in_the_row_t &stages_left_in_the_row,
+        stages_left_t &stages_left,
+        detections_scores_t &detections_scores,
+        num_evaluated_stages_t &num_evaluated_stages,
+        const integral_channels_t &integral_channels,
+        const detection_window_size_t &original_detection_window_size,
+        const float original_detection_window_scale,
+        detections_t &detections, detections_t *non_rescaled_detections_p,
+        const CascadeStageType &cascade_stages,
+        const CompiledSoftCascadeOverIntegralChannels *compiled_cascade_p,
+        const float score_threshold,
+        const int min_evaluated_stages,
+        const ScaleData &scale_data,
+        const windows_rows_per_column_t *stixels_windows_rows_p,
+        const rows_mask_t *ground_plane_rows_mask_p,
+        const bool print_stages,
+        const bool print_cascade_statistics,
+        const bool save_score_image,
+        const bool use_the_detector_model_cascade,
+        const bool use_integer_features)
+{
+
+    const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
+    const stride_t &actual_stride = scale_data.stride;
+
+    if((scaled_search_range.max_y == 0) or (scaled_search_range.max_x == 0))
+    {
+        // nothing to do here
+        return;
     }
 
-    if(save_score_image)
+    std::fill(stages_left_in_the_row.begin(), stages_left_in_the_row.end(), true);
+    fill(stages_left, true);
+    fill(detections_scores, 0.0f);
+
+    reset_num_evaluated_stages(scaled_search_range, integral_channels, detections_scores, num_evaluated_stages);
+
+    skip_the_windows_outside_of_the_search_masks(stixels_windows_rows_p, ground_plane_rows_mask_p,
+                                                 scaled_search_range, actual_stride,
+                                                 integral_channels,
+                                                 stages_left_in_the_row, stages_left, num_evaluated_stages);
+
+#if not defined(NDEBUG)
+    const size_t input_view_height = integral_channels.shape()[1];
+    assert(scaled_search_range.max_y < input_view_height);
+#endif
+
+#if defined(TESTING)
+    // the scores trajectories are only recorded by the stage-major evaluation
+    scores_trajectories.resize(
+                boost::extents[scaled_search_range.max_y][scaled_search_range.max_x][cascade_stages.size()]);
+#endif
+
+    // FIXME hardcoded parameter (same as compute_detections_at_specific_scale_impl)
+    const bool use_partial_detectors = true; // will try to detect objects that are partially outside of the image frame
+
+    const size_t num_stages = cascade_stages.size();
+    const int xstride = actual_stride.x();
+    const int tile_size = SoftCascadeWindowsTileEvaluator::tile_size;
+
+    boost::scoped_ptr<const CompiledSoftCascadeOverIntegralChannels> own_compiled_cascade_p;
+    if(compiled_cascade_p == NULL)
     {
-        cv::Mat scores_mat(
-                    //detections_scores.shape()[0], detections_scores.shape()[1],
-                    scaled_search_range.max_y, scaled_search_range.max_x,
-                    CV_32FC1, detections_scores.origin(),
-                    detections_scores.strides()[0]*sizeof(detections_scores_t::element));
+        own_compiled_cascade_p.reset(new CompiledSoftCascadeOverIntegralChannels(cascade_stages));
+        compiled_cascade_p = own_compiled_cascade_p.get();
+    }
+
+    const SoftCascadeWindowsTileEvaluator tile_evaluator(*compiled_cascade_p, integral_channels,
+                                                         use_the_detector_model_cascade);
 
-        cv::Mat normalized_scores;
-        double min_score, max_score;
-        cv::minMaxLoc(scores_mat, &min_score, &max_score);
-        cv::normalize(scores_mat, normalized_scores, 255, 0, cv::NORM_MINMAX);
+    // for each row of the search range, after how many stages all windows are resolved ?
+    std::vector<size_t> stages_left_until(scaled_search_range.max_y, 0);
+
+    // we process each row in parallel, each row is processed window-major, tile by tile
+#pragma omp parallel for schedule(dynamic)
+    for(size_t y=scaled_search_range.min_y; y < scaled_search_range.max_y; y+=actual_stride.y())
+    {
+        detections_scores_t::reference detections_scores_row = detections_scores[y];
+        stages_left_t::const_reference stages_left_row = stages_left[y];
+        num_evaluated_stages_t::reference num_evaluated_stages_row = num_evaluated_stages[y];
 
-        const string filename = str(format("scores_at_%.2f.png") % original_detection_window_scale);
-        cv::imwrite(filename, normalized_scores);
-        log_info() << "Created debug file " << filename << std::endl;
-        log_info() << str(format("Scores in %s are in the range (min, max) == (%.3f, %.3f)")
-                          % filename % min_score % max_score) << std::endl;
+        float tile_scores[tile_size];
+        int tile_num_stages[tile_size];
+        size_t row_stages_left_until = 0;
 
-        if(false and min_score > 0)
+        if(stages_left_in_the_row[y] == false)
         {
-            throw std::runtime_error("Min score should be 0 sometimes. Something is fishy in this test.");
+            // all the windows of this row were skipped (see skip_the_windows_outside_of_the_stixels)
+            stages_left_until[y] = 0;
+            continue;
+        }
+
+        size_t col=scaled_search_range.min_x;
+        while(col < scaled_search_range.max_x)
+        {
+            if(stages_left_row[col] == false)
+            {
+                // this window is not searched
+                col += xstride;
+                continue;
+            }
+
+            // the tile only covers consecutive windows that should be searched
+            int num_windows = 1;
+            while((num_windows < tile_size)
+                  and ((col + num_windows*xstride) < scaled_search_range.max_x)
+                  and stages_left_row[col + num_windows*xstride])
+            {
+                num_windows += 1;
+            }
+
+            const size_t tile_stages_left_until =
+                    tile_evaluator(y, col, xstride, num_windows, tile_scores, tile_num_stages);
+            row_stages_left_until = std::max(row_stages_left_until, tile_stages_left_until);
+
+            for(int i=0; i < num_windows; i+=1)
+            {
+                detections_scores_row[col + i*xstride] = tile_scores[i];
+                num_evaluated_stages_row[col + i*xstride] = tile_num_stages[i];
+            }
+
+            col += num_windows*xstride;
+        } // end of "for each tile in the row"
+
+        stages_left_until[y] = row_stages_left_until;
+    } // end of "for each row in search range"
+
+
+    // the rows at the bottom are computed stage-major,
+    // we replicate the early stop behaviour of compute_detections_at_specific_scale_impl
+    size_t stage_index = 0;
+    for(; stage_index < num_stages; stage_index += 1)
+    {
+        size_t max_row = scaled_search_range.max_y;
+        if(use_partial_detectors)
+        {
+            // we will also search in areas where the detection window gets out of the input image
+            max_row = integral_channels.shape()[1];
+
+            compute_cascade_stage_on_bottom_rows(
+                        scaled_search_range, actual_stride, cascade_stages[stage_index], stage_index,
+                        integral_channels, use_the_detector_model_cascade, use_integer_features,
+                        stages_left_in_the_row, stages_left, detections_scores, num_evaluated_stages);
+        }
+
+        int num_rows_left = 0;
+        for(size_t y=scaled_search_range.min_y; y < max_row; y+=actual_stride.y())
+        {
+            const bool row_has_stages_left =
+                    (y < scaled_search_range.max_y)? (stage_index < stages_left_until[y]) : stages_left_in_the_row[y];
+            if(row_has_stages_left)
+            {
+                num_rows_left += 1;
+            }
+        }
+
+        if(num_rows_left == 0)
+        {
+            break;
         }
+    } // end of "for each cascade stage"
+
+
+    // keep stages_left_in_the_row consistent with compute_detections_at_specific_scale_impl
+    for(size_t y=scaled_search_range.min_y; y < scaled_search_range.max_y; y+=actual_stride.y())
+    {
+        stages_left_in_the_row[y] = (stage_index < stages_left_until[y]);
+    }
+
+    if(print_stages or print_cascade_statistics)
+    {
+        log_info() << str(format("Finished all detections of scale %.3f  at cascade stage %i out of %i (window-major)")
+                          % original_detection_window_scale
+                          % stage_index
+                          % num_stages) << std::endl;
+    }
+
+    if(stage_index == num_stages)
+    { // at least one detection reached the last detection stage
+        collect_the_detections(scale_data, original_detection_window_size,
+                               integral_channels, detections_scores, num_evaluated_stages,
+                               score_threshold, min_evaluated_stages,
+                               use_partial_detectors,
+                               detections, non_rescaled_detections_p);
+    }
 
-    } // end of "if save_score_image"
+    if(save_score_image)
+    {
+        save_detections_scores_image(detections_scores, scaled_search_range, original_detection_window_scale);
+    }
 
     return;
-} // end of compute_detections_at_specific_scale_impl
+} // end of compute_detections_at_specific_scale_window_major_impl
 
 
 void compute_detections_at_specific_scale(
         IntegralChannelsDetector::stages_left_in_the_row_t &stages_left_in_the_row,
         IntegralChannelsDetector::stages_left_t &stages_left,
         IntegralChannelsDetector::detections_scores_t &detections_scores,
+        IntegralChannelsDetector::num_evaluated_stages_t &num_evaluated_stages,
         const IntegralChannelsForPedestrians::integral_channels_t &integral_channels,
         const IntegralChannelsDetector::detection_window_size_t &detection_window_size,
         const float original_detection_window_scale,
@@ -795,27 +1771,77 @@ void compute_detections_at_specific_scale(
         IntegralChannelsDetector::detections_t *non_rescaled_detections_p,
         const IntegralChannelsDetector::cascade_stages_t &cascade_stages,
         const float score_threshold,
+        const int min_evaluated_stages,
         const ScaleData &scale_data,
         const bool print_stages,
         const bool print_cascade_statistics,
         const bool save_score_image,
-        const bool use_the_detector_model_cascade)
+        const bool use_the_detector_model_cascade,
+        const bool use_integer_features)
 {
     compute_detections_at_specific_scale_impl(
                 stages_left_in_the_row,
                 stages_left,
                 detections_scores,
+                num_evaluated_stages,
                 integral_channels,
                 detection_window_size,
                 original_detection_window_scale,
                 detections, non_rescaled_detections_p,
                 cascade_stages,
                 score_threshold,
+                min_evaluated_stages,
                 scale_data,
+                NULL, NULL, // no stixels, nor ground plane information
                 print_stages,
                 print_cascade_statistics,
                 save_score_image,
-                use_the_detector_model_cascade);
+                use_the_detector_model_cascade,
+                use_integer_features);
+    return;
+}
+
+
+void compute_detections_at_specific_scale_window_major(
+        IntegralChannelsDetector::stages_left_in_the_row_t &stages_left_in_the_row,
+        IntegralChannelsDetector::stages_left_t &stages_left,
+        IntegralChannelsDetector::detections_scores_t &detections_scores,
+        IntegralChannelsDetector::num_evaluated_stages_t &num_evaluated_stages,
+        const IntegralChannelsForPedestrians::integral_channels_t &integral_channels,
+        const IntegralChannelsDetector::detection_window_size_t &detection_window_size,
+        const float original_detection_window_scale,
+        IntegralChannelsDetector::detections_t &detections,
+        IntegralChannelsDetector::detections_t *non_rescaled_detections_p,
+        const IntegralChannelsDetector::cascade_stages_t &cascade_stages,
+        const float score_threshold,
+        const int min_evaluated_stages,
+        const ScaleData &scale_data,
+        const bool print_stages,
+        const bool print_cascade_statistics,
+        const bool save_score_image,
+        const bool use_the_detector_model_cascade,
+        const bool use_integer_features)
+{
+    compute_detections_at_specific_scale_window_major_impl(
+                stages_left_in_the_row,
+                stages_left,
+                detections_scores,
+                num_evaluated_stages,
+                integral_channels,
+                detection_window_size,
+                original_detection_window_scale,
+                detections, non_rescaled_detections_p,
+                cascade_stages,
+                NULL, // compiled on the fly
+                score_threshold,
+                min_evaluated_stages,
+                scale_data,
+                NULL, NULL, // no stixels, nor ground plane information
+                print_stages,
+                print_cascade_statistics,
+                save_score_image,
+                use_the_detector_model_cascade,
+                use_integer_features);
     return;
 }
 
@@ -824,8 +1850,27 @@ const IntegralChannelsForPedestrians::integral_channels_t &
 IntegralChannelsDetector::resize_input_and_compute_integral_channels(const size_t search_range_index,
                                                                      const bool first_call)
 {
+    return resize_input_and_compute_integral_channels(search_range_index,
+                                                      *integral_channels_computer_p, computed_integral_channels_key,
+                                                      first_call);
+}
 
-    IntegralChannelsForPedestrians &integral_channels_computer = *integral_channels_computer_p;
+
+/// computed_integral_channels_key indicates which input image and scaled size
+/// the integral_channels_computer currently holds (scales might have been skipped in between)
+const IntegralChannelsForPedestrians::integral_channels_t &
+IntegralChannelsDetector::resize_input_and_compute_integral_channels(
+        const size_t search_range_index,
+        IntegralChannelsForPedestrians &integral_channels_computer,
+        ComputedIntegralChannelsKey &computed_integral_channels_key,
+        const bool first_call)
+{
+
+    if(channels_pyramid_p)
+    {
+        // already computed by compute_channels_pyramid
+        return channels_pyramid_p->get_integral_channels(search_range_index);
+    }
 
     // rescale the image --
     cv::Mat scaled_input;
@@ -843,29 +1888,21 @@ IntegralChannelsDetector::resize_input_and_compute_integral_channels(const size_
                         << scaled_input_image_size.x() << ", " << scaled_input_image_size.y() << std::endl;
         }
 
-        if(search_range_index > 0)
-        { // if not on the first DetectorSearchRange
-            // (when search_range_index ==0 we assume a new picture is being treated)
-
-            const image_size_t &previous_image_size = extra_data_per_scale[search_range_index - 1].scaled_input_image_size;
-
-            //printf("%zi =?= %zi; %zi =?= %zi\n",
-            //        scaled_input_image_size.x(), previous_image_size.x(),
-            //        scaled_input_image_size.y(), previous_image_size.y());
-
-            if((scaled_input_image_size.x() == previous_image_size.x())
-               and (scaled_input_image_size.y() == previous_image_size.y()))
+        // we cannot rely on search_range_index - 1 being the last computed scale,
+        // scales without any window to evaluate are skipped (ground plane corridor, predicted regions)
+        if((computed_integral_channels_key.input_image_index == input_image_index)
+           and (scaled_input_image_size.x() == computed_integral_channels_key.scaled_input_image_size.x())
+           and (scaled_input_image_size.y() == computed_integral_channels_key.scaled_input_image_size.y()))
+        {
+            if(first_call)
             {
-                if(first_call)
-                {
-                    log_debug() << "Skipped integral channels computation for search range index "
-                                << search_range_index
-                                << " (since redundant with previous computed one)"<< std::endl;
-                }
-                // current required scale, match the one already computed in the integral_channels_computer
-                // no need to recompute the integral_channels, we provide the current result
-                return integral_channels_computer.get_integral_channels();
+                log_debug() << "Skipped integral channels computation for search range index "
+                            << search_range_index
+                            << " (since redundant with previous computed one)"<< std::endl;
             }
+            // current required scale, match the one already computed in the integral_channels_computer
+            // no need to recompute the integral_channels, we provide the current result
+            return integral_channels_computer.get_integral_channels();
         }
 
         const gil::opencv::ipl_image_wrapper input_ipl = gil::opencv::create_ipl_image(input_view);
@@ -894,6 +1931,10 @@ IntegralChannelsDetector::resize_input_and_compute_integral_channels(const size_
         integral_channels_computer.set_image(scaled_input_view);
         integral_channels_computer.compute();
 
+        computed_integral_channels_key.input_image_index = input_image_index;
+        computed_integral_channels_key.scaled_input_image_size =
+                extra_data_per_scale[search_range_index].scaled_input_image_size;
+
         const bool save_integral_channels = false;
         if(save_integral_channels
            and (scaled_input_view.height() > 100))
@@ -918,12 +1959,34 @@ size_t IntegralChannelsDetector::get_input_width() const
 
 size_t IntegralChannelsDetector::get_input_height() const
 {
-    return input_view.height();
+    return input_view.height();
+}
+
+
+void IntegralChannelsDetector::compute_detections_at_specific_scale(
+        const size_t search_range_index,
+        const bool save_score_image,
+        const bool first_call)
+{
+    compute_detections_at_specific_scale(search_range_index,
+                                         *integral_channels_computer_p, computed_integral_channels_key,
+                                         stages_left_in_the_row, stages_left,
+                                         detections_scores, num_evaluated_stages,
+                                         detections,
+                                         save_score_image, first_call);
+    return;
 }
 
 
 void IntegralChannelsDetector::compute_detections_at_specific_scale(
         const size_t search_range_index,
+        IntegralChannelsForPedestrians &integral_channels_computer,
+        ComputedIntegralChannelsKey &computed_integral_channels_key,
+        stages_left_in_the_row_t &stages_left_in_the_row,
+        stages_left_t &stages_left,
+        detections_scores_t &detections_scores,
+        num_evaluated_stages_t &num_evaluated_stages,
+        detections_t &detections,
         const bool save_score_image,
         const bool first_call)
 {
@@ -932,14 +1995,55 @@ void IntegralChannelsDetector::compute_detections_at_specific_scale(
             print_stages = false,
             print_cascade_statistics = false;
 
+    const windows_rows_per_column_t *stixels_windows_rows_p = NULL;
+    const rows_mask_t *ground_plane_rows_mask_p = NULL;
+    if(stixels_windows_rows_per_scale.empty() == false)
+    {
+        // when stixels are available, filter_detections only uses the corridor for the occluded stixels
+        stixels_windows_rows_p = &stixels_windows_rows_per_scale[search_range_index];
+    }
+    else if(ground_plane_rows_mask_per_scale.empty() == false)
+    {
+        ground_plane_rows_mask_p = &ground_plane_rows_mask_per_scale[search_range_index];
+
+        const rows_mask_t &rows_mask = *ground_plane_rows_mask_p;
+        const size_t min_y = std::min<size_t>(rows_mask.size(),
+                                              extra_data_per_scale[search_range_index].scaled_search_range.min_y);
+        if(std::find(rows_mask.begin() + min_y, rows_mask.end(), true) == rows_mask.end())
+        {
+            // no window of this scale fits the ground plane corridor,
+            // we do not even compute the integral channels
+            return;
+        }
+    }
+
+    if(predicted_windows_rows_per_scale.empty() == false)
+    {
+        if(predicted_regions_scales_mask[search_range_index] == false)
+        {
+            // no predicted region at this scale, we do not even compute the integral channels
+            // (the next scale of the same size will see, via computed_integral_channels_key,
+            // that the computer still holds the channels of an older scale)
+            return;
+        }
+
+        // the predicted windows rows already include the stixels constraints
+        stixels_windows_rows_p = &predicted_windows_rows_per_scale[search_range_index];
+    }
+
     const integral_channels_t &integral_channels =
-            resize_input_and_compute_integral_channels(search_range_index, first_call);
+            resize_input_and_compute_integral_channels(search_range_index,
+                                                       integral_channels_computer, computed_integral_channels_key,
+                                                       first_call);
 
     const DetectorSearchRange &original_search_range = search_ranges[search_range_index];
     const cascade_stages_t &cascade_stages = detection_cascade_per_scale[search_range_index];
     const stump_cascade_stages_t &stump_cascade_stages = detection_stump_cascade_per_scale[search_range_index];
     const detection_window_size_t &detection_window_size = detection_window_size_per_scale[search_range_index];
     const ScaleData &scale_data = extra_data_per_scale[search_range_index];
+    const CompiledSoftCascadeOverIntegralChannels *compiled_cascade_p =
+            (search_range_index < compiled_cascade_per_scale.size())?
+                compiled_cascade_per_scale[search_range_index].get() : NULL;
 
     // run the cascade classifier and collect the detections --
 #if defined(BOOTSTRAPPING_LIB)
@@ -962,40 +2066,104 @@ void IntegralChannelsDetector::compute_detections_at_specific_scale(
 
     if((detection_stump_cascade_per_scale.empty() == false) and (stump_cascade_stages.empty() == false))
     { // stumps model
-        doppia::compute_detections_at_specific_scale_impl(
-                    stages_left_in_the_row,
-                    stages_left,
-                    detections_scores,
-                    integral_channels,
-                    detection_window_size,
-                    original_search_range.detection_window_scale, // at original scale
-                    detections, non_rescaled_detections_p,
-                    stump_cascade_stages, // we use stumps
-                    score_threshold,
-                    scale_data,
-                    print_stages,
-                    print_cascade_statistics,
-                    save_score_image,
-                    use_the_detector_model_cascade);
+        if(use_window_major_evaluation)
+        {
+            doppia::compute_detections_at_specific_scale_window_major_impl(
+                        stages_left_in_the_row,
+                        stages_left,
+                        detections_scores,
+                        num_evaluated_stages,
+                        integral_channels,
+                        detection_window_size,
+                        original_search_range.detection_window_scale, // at original scale
+                        detections, non_rescaled_detections_p,
+                        stump_cascade_stages, // we use stumps
+                        compiled_cascade_p,
+                        score_threshold,
+                        min_evaluated_stages,
+                        scale_data,
+                        stixels_windows_rows_p,
+                        ground_plane_rows_mask_p,
+                        print_stages,
+                        print_cascade_statistics,
+                        save_score_image,
+                        use_the_detector_model_cascade,
+                        use_integer_features);
+        }
+        else
+        {
+            doppia::compute_detections_at_specific_scale_impl(
+                        stages_left_in_the_row,
+                        stages_left,
+                        detections_scores,
+                        num_evaluated_stages,
+                        integral_channels,
+                        detection_window_size,
+                        original_search_range.detection_window_scale, // at original scale
+                        detections, non_rescaled_detections_p,
+                        stump_cascade_stages, // we use stumps
+                        score_threshold,
+                        min_evaluated_stages,
+                        scale_data,
+                        stixels_windows_rows_p,
+                        ground_plane_rows_mask_p,
+                        print_stages,
+                        print_cascade_statistics,
+                        save_score_image,
+                        use_the_detector_model_cascade,
+                        use_integer_features);
+        }
     }
     else
     {
         // level2 decision trees model
-        doppia::compute_detections_at_specific_scale_impl(
-                    stages_left_in_the_row,
-                    stages_left,
-                    detections_scores,
-                    integral_channels,
-                    detection_window_size,
-                    original_search_range.detection_window_scale, // at original scale
-                    detections, non_rescaled_detections_p,
-                    cascade_stages,
-                    score_threshold,
-                    scale_data,
-                    print_stages,
-                    print_cascade_statistics,
-                    save_score_image,
-                    use_the_detector_model_cascade);
+        if(use_window_major_evaluation)
+        {
+            doppia::compute_detections_at_specific_scale_window_major_impl(
+                        stages_left_in_the_row,
+                        stages_left,
+                        detections_scores,
+                        num_evaluated_stages,
+                        integral_channels,
+                        detection_window_size,
+                        original_search_range.detection_window_scale, // at original scale
+                        detections, non_rescaled_detections_p,
+                        cascade_stages,
+                        compiled_cascade_p,
+                        score_threshold,
+                        min_evaluated_stages,
+                        scale_data,
+                        stixels_windows_rows_p,
+                        ground_plane_rows_mask_p,
+                        print_stages,
+                        print_cascade_statistics,
+                        save_score_image,
+                        use_the_detector_model_cascade,
+                        use_integer_features);
+        }
+        else
+        {
+            doppia::compute_detections_at_specific_scale_impl(
+                        stages_left_in_the_row,
+                        stages_left,
+                        detections_scores,
+                        num_evaluated_stages,
+                        integral_channels,
+                        detection_window_size,
+                        original_search_range.detection_window_scale, // at original scale
+                        detections, non_rescaled_detections_p,
+                        cascade_stages,
+                        score_threshold,
+                        min_evaluated_stages,
+                        scale_data,
+                        stixels_windows_rows_p,
+                        ground_plane_rows_mask_p,
+                        print_stages,
+                        print_cascade_statistics,
+                        save_score_image,
+                        use_the_detector_model_cascade,
+                        use_integer_features);
+        }
     }
 
 #if defined(TESTING)
@@ -1011,30 +2179,16 @@ void IntegralChannelsDetector::compute_detections_at_specific_scale(
 }
 
 
-/// filter a detection based on the ground plane constraints
-/// @returns true if the detection should be accepted, also returns an updated score
+/// @returns true if a box with the given top and bottom rows (without the additional border)
+/// fits the ground plane corridor, used both to filter the detections and to build the rows masks
 inline
-bool filter_detection(const AbstractObjectsDetector::detection_t &detection,
-                      const AbstractObjectsDetector::ground_plane_corridor_t &ground_plane_corridor,
-                      const int vertical_margin,
-                      const int additional_border,
-                      float &score)
+bool fits_the_ground_plane_corridor(const int top_y, const int bottom_y,
+                                    const AbstractObjectsDetector::ground_plane_corridor_t &ground_plane_corridor,
+                                    const int vertical_margin)
 {
-
-    if(ground_plane_corridor.empty())
-    {
-        // no information, every detection is valid
-        score = detection.score;
-        return true;
-    }
-
-
-    const detection_t::rectangle_t &box = detection.bounding_box;
     const int max_y = ground_plane_corridor.size() - 1;
 
     const int
-            bottom_y = std::max(0, box.max_corner().y() - additional_border),
-            top_y = std::max(0, box.min_corner().y() - additional_border),
             min_bottom_y = std::min(max_y, std::max(0, bottom_y - vertical_margin)),
             max_bottom_y = std::min(max_y, bottom_y + vertical_margin);
     int
@@ -1054,12 +2208,40 @@ bool filter_detection(const AbstractObjectsDetector::detection_t &detection,
     if(min_top_y > 0) // both values are well defined
     {
         should_be_accepted = (top_y >= min_top_y) and (top_y <= max_top_y);
+    }
+
+    return should_be_accepted;
+}
+
+
+/// filter a detection based on the ground plane constraints
+/// @returns true if the detection should be accepted, also returns an updated score
+inline
+bool filter_detection(const AbstractObjectsDetector::detection_t &detection,
+                      const AbstractObjectsDetector::ground_plane_corridor_t &ground_plane_corridor,
+                      const int vertical_margin,
+                      const int additional_border,
+                      float &score)
+{
 
-        // for now, we do nothing to the scores
+    if(ground_plane_corridor.empty())
+    {
+        // no information, every detection is valid
         score = detection.score;
+        return true;
     }
 
-    return should_be_accepted;
+
+    const detection_t::rectangle_t &box = detection.bounding_box;
+
+    const int
+            bottom_y = std::max(0, box.max_corner().y() - additional_border),
+            top_y = std::max(0, box.min_corner().y() - additional_border);
+
+    // for now, we do nothing to the scores
+    score = detection.score;
+
+    return fits_the_ground_plane_corridor(top_y, bottom_y, ground_plane_corridor, vertical_margin);
 }
 
 
@@ -1243,6 +2425,130 @@ void filter_detections(AbstractObjectsDetector::detections_t &detections,
 }
 
 
+void IntegralChannelsDetector::set_ground_plane_corridor(const ground_plane_corridor_t &corridor)
+{
+    BaseIntegralChannelsDetector::set_ground_plane_corridor(corridor);
+
+    // the ground plane estimate is noisy from one frame to the next,
+    // small changes are absorbed by the vertical margin and do not require new masks
+    const int max_corridor_change = 2; // [pixels]
+
+    bool corridor_changed = (ground_plane_rows_mask_corridor.size() != estimated_ground_plane_corridor.size())
+            or ground_plane_rows_mask_per_scale.empty();
+    for(size_t v=0; (corridor_changed == false) and (v < estimated_ground_plane_corridor.size()); v+=1)
+    {
+        const int
+                previous_top_v = ground_plane_rows_mask_corridor[v],
+                top_v = estimated_ground_plane_corridor[v];
+        // -1 indicates rows above the horizon
+        corridor_changed = ((previous_top_v < 0) != (top_v < 0))
+                or (std::abs(top_v - previous_top_v) > max_corridor_change);
+    }
+
+    if(corridor_changed)
+    {
+        ground_plane_rows_mask_corridor = estimated_ground_plane_corridor;
+        compute_ground_plane_rows_mask();
+    }
+
+    return;
+}
+
+
+void IntegralChannelsDetector::compute_ground_plane_rows_mask()
+{
+    using boost::math::iround;
+
+    ground_plane_rows_mask_per_scale.clear();
+
+    if(ground_plane_rows_mask_corridor.empty() or search_ranges.empty())
+    {
+        // nothing to do here
+        return;
+    }
+
+    assert(extra_data_per_scale.size() == search_ranges.size());
+
+    const size_t num_scales = search_ranges.size();
+    const int shrinking_factor = IntegralChannelsForPedestrians::get_shrinking_factor();
+
+    size_t
+            num_rows = 0,
+            num_skipped_rows = 0,
+            num_skipped_scales = 0;
+
+    ground_plane_rows_mask_per_scale.resize(num_scales);
+    for(size_t scale_index=0; scale_index < num_scales; scale_index+=1)
+    {
+        const ScaleData &scale_data = extra_data_per_scale[scale_index];
+        const DetectorSearchRange &scaled_search_range = scale_data.scaled_search_range;
+        rows_mask_t &rows_mask = ground_plane_rows_mask_per_scale[scale_index];
+
+        const size_t num_channel_rows = scale_data.scaled_input_image_size.y() / shrinking_factor + 1;
+        rows_mask.resize(num_channel_rows);
+
+        // the detections go through the model window to object window conversion before being filtered,
+        // we apply the same conversion to a window placed at the image top
+        int window_top_y = 0, window_bottom_y = std::max<int>(1, scale_data.scaled_detection_window_size.y());
+        if(resize_detection_windows and model_window_to_object_window_converter_p)
+        {
+            detections_t window_detections(1);
+            detection_t::rectangle_t &box = window_detections.front().bounding_box;
+            box.min_corner().x(0);
+            box.min_corner().y(0);
+            box.max_corner().x(std::max<int>(1, scale_data.scaled_detection_window_size.x()));
+            box.max_corner().y(window_bottom_y);
+
+            (*model_window_to_object_window_converter_p)(window_detections);
+
+            window_top_y = box.min_corner().y();
+            window_bottom_y = box.max_corner().y();
+        }
+
+        bool scale_has_rows = false;
+        for(size_t row=0; row < num_channel_rows; row+=1)
+        {
+            // same mapping as add_detection
+            const int
+                    input_row = iround(row/scaled_search_range.range_scaling),
+                    top_y = std::max(0, input_row + window_top_y - additional_border),
+                    bottom_y = std::max(0, input_row + window_bottom_y - additional_border);
+
+            rows_mask[row] = fits_the_ground_plane_corridor(top_y, bottom_y,
+                                                            ground_plane_rows_mask_corridor,
+                                                            stixels_vertical_margin);
+
+            if(row >= scaled_search_range.min_y)
+            {
+                num_rows += 1;
+                if(rows_mask[row])
+                {
+                    scale_has_rows = true;
+                }
+                else
+                {
+                    num_skipped_rows += 1;
+                }
+            }
+        } // end of "for each integral channels row"
+
+        if(scale_has_rows == false)
+        {
+            num_skipped_scales += 1;
+        }
+
+    } // end of "for each scale"
+
+    ground_plane_skipped_rows_fraction = static_cast<float>(num_skipped_rows) / std::max<size_t>(1, num_rows);
+
+    log_debug() << str(format("Updated the ground plane rows masks, "
+                              "%.1f%% of the (row, scale) pairs are skipped, %i scales out of %i are fully skipped")
+                       % (100*ground_plane_skipped_rows_fraction)
+                       % num_skipped_scales % num_scales) << std::endl;
+    return;
+}
+
+
 void IntegralChannelsDetector::compute()
 {
     detections.clear();
@@ -1255,13 +2561,66 @@ void IntegralChannelsDetector::compute()
     assert(integral_channels_computer_p);
     assert(search_ranges.size() == detection_cascade_per_scale.size());
 
-    // for each range search
-    for(size_t search_range_index=0; search_range_index < search_ranges.size(); search_range_index +=1)
+    computation_time_per_scale.resize(search_ranges.size());
+    std::fill(computation_time_per_scale.begin(), computation_time_per_scale.end(), 0);
+
+    // tracking guided detection, only the predicted regions are searched between the full searches --
+    const bool search_the_full_image =
+            (predicted_regions_were_set == false) or (frames_since_full_search + 1 >= full_search_period);
+    if(search_the_full_image)
     {
-        compute_detections_at_specific_scale(search_range_index,
-                                             save_score_image, first_call);
+        frames_since_full_search = 0;
+        predicted_windows_rows_per_scale.clear();
+        predicted_regions_scales_mask.clear();
+    }
+    else
+    {
+        frames_since_full_search += 1;
+        compute_predicted_windows_rows();
 
-    } // end of "for each search range"
+        log_debug() << str(format("Searching only around %i predicted regions (%i out of %i scales)")
+                           % predicted_regions.size()
+                           % std::count(predicted_regions_scales_mask.begin(), predicted_regions_scales_mask.end(), true)
+                           % search_ranges.size()) << std::endl;
+    }
+    predicted_regions_were_set = false; // the regions must be set again before each frame
+
+    const double scales_start_wall_time = omp_get_wtime();
+    if(channels_pyramid_real_scales_per_octave > 0)
+    {
+        compute_channels_pyramid();
+    }
+
+    if(use_parallel_scales and (save_score_image == false))
+    {
+        compute_detections_at_all_scales_in_parallel(save_score_image, first_call);
+    }
+    else
+    {
+        // for each range search
+        for(size_t search_range_index=0; search_range_index < search_ranges.size(); search_range_index +=1)
+        {
+            const double start_wall_time = omp_get_wtime();
+            const size_t num_previous_detections = detections.size();
+            compute_detections_at_specific_scale(search_range_index,
+                                                 save_score_image, first_call);
+            if(streaming_nms_buffer_size > 0)
+            {
+                stream_raw_detections(detections, num_previous_detections);
+            }
+            computation_time_per_scale[search_range_index] = omp_get_wtime() - start_wall_time;
+
+        } // end of "for each search range"
+    }
+    const double scales_wall_time = omp_get_wtime() - scales_start_wall_time;
+
+    if((ground_plane_rows_mask_per_scale.empty() == false) and stixels_windows_rows_per_scale.empty())
+    {
+        log_debug() << str(format("All scales computed in %.3f [ms], "
+                                  "the ground plane corridor skipped %.1f%% of the (row, scale) pairs")
+                           % (scales_wall_time*1000)
+                           % (100*ground_plane_skipped_rows_fraction)) << std::endl;
+    }
 
 
     if(save_score_image)
@@ -1280,11 +2639,265 @@ void IntegralChannelsDetector::compute()
 
 
 
+void IntegralChannelsDetector::compute_channels_pyramid()
+{
+    if(channels_pyramid_p == false)
+    {
+        // created here, since the (multiscales) models are only available once the detector is fully constructed
+        channels_pyramid_p.reset(new IntegralChannelsPyramid(channels_pyramid_real_scales_per_octave,
+                                                             get_channels_scaling_exponents()));
+    }
+
+    std::vector<IntegralChannelsPyramid::input_size_t> scaled_input_sizes(search_ranges.size());
+    for(size_t search_range_index=0; search_range_index < search_ranges.size(); search_range_index +=1)
+    {
+        const image_size_t &scaled_input_image_size = extra_data_per_scale[search_range_index].scaled_input_image_size;
+        scaled_input_sizes[search_range_index] =
+                IntegralChannelsPyramid::input_size_t(scaled_input_image_size.x(), scaled_input_image_size.y());
+    }
+
+    // only reallocates the pyramid levels when the scales or the input size change
+    channels_pyramid_p->set_scales(scaled_input_sizes);
+    channels_pyramid_p->compute(input_view);
+    return;
+}
+
+
+void IntegralChannelsDetector::stream_raw_detections(detections_t &detections,
+                                                     const size_t first_new_detection_index) const
+{
+    if(first_new_detection_index < detections.size())
+    {
+        // the previous detections were already resized and filtered
+        detections_t new_detections(detections.begin() + first_new_detection_index, detections.end());
+        detections.resize(first_new_detection_index);
+
+        // windows size adjustment should be done before non-maximal suppression
+        if(this->resize_detection_windows)
+        {
+            (*model_window_to_object_window_converter_p)(new_detections);
+        }
+
+        filter_detections(new_detections,
+                          estimated_stixels, estimated_ground_plane_corridor,
+                          stixels_vertical_margin, additional_border);
+
+        detections.insert(detections.end(), new_detections.begin(), new_detections.end());
+    }
+
+    if(detections.size() > static_cast<size_t>(streaming_nms_buffer_size))
+    {
+        // the suppression object is cheap to create, and each thread needs its own
+        IndexedGreedyNonMaximalSuppression non_maximal_suppression(streaming_nms_minimal_overlap_threshold);
+        non_maximal_suppression.set_detections(detections);
+        non_maximal_suppression.compute();
+
+        // the maximal detections are sorted by decreasing score
+        const detections_t &maximal_detections = non_maximal_suppression.get_detections();
+        const size_t num_kept_detections =
+                std::min<size_t>(maximal_detections.size(), streaming_nms_max_detections);
+        detections.assign(maximal_detections.begin(), maximal_detections.begin() + num_kept_detections);
+    }
+
+    return;
+}
+
+
+/// scales sharing the same input image size are computed together,
+/// since they share the same integral channels
+struct ScalesTask
+{
+    size_t begin_scale_index, end_scale_index;
+
+    /// estimated cost of the task (number of pixels in the rescaled input images)
+    size_t cost;
+};
+
+
+/// helper functor used to sort the tasks indices by decreasing cost
+class TaskIndexHasLargerCost
+{
+public:
+    TaskIndexHasLargerCost(const std::vector<ScalesTask> &tasks_)
+        : tasks(tasks_)
+    {
+        // nothing to do here
+        return;
+    }
+
+    bool operator()(const size_t a, const size_t b) const
+    {
+        return tasks[a].cost > tasks[b].cost;
+    }
+
+protected:
+    const std::vector<ScalesTask> &tasks;
+};
+
+
+void IntegralChannelsDetector::compute_detections_at_all_scales_in_parallel(
+        const bool save_score_image,
+        const bool first_call)
+{
+    // group the scales in tasks --
+    std::vector<ScalesTask> tasks;
+    size_t total_cost = 0;
+    for(size_t search_range_index=0; search_range_index < search_ranges.size(); search_range_index +=1)
+    {
+        const image_size_t &scaled_input_image_size = extra_data_per_scale[search_range_index].scaled_input_image_size;
+        const size_t cost = scaled_input_image_size.x() * scaled_input_image_size.y();
+        total_cost += cost;
+
+        if(tasks.empty() == false)
+        {
+            const image_size_t &previous_image_size =
+                    extra_data_per_scale[search_range_index - 1].scaled_input_image_size;
+            if((scaled_input_image_size.x() == previous_image_size.x())
+               and (scaled_input_image_size.y() == previous_image_size.y()))
+            {
+                // same integral channels as the previous scale
+                tasks.back().end_scale_index += 1;
+                tasks.back().cost += cost;
+                continue;
+            }
+        }
+
+        ScalesTask task;
+        task.begin_scale_index = search_range_index;
+        task.end_scale_index = search_range_index + 1;
+        task.cost = cost;
+        tasks.push_back(task);
+    } // end of "for each search range"
+
+    const int num_threads = omp_get_max_threads();
+    const size_t max_concurrent_task_cost = total_cost / std::max(1, num_threads);
+
+    // the detections of each task are merged at the end, in the scales order
+    std::vector<detections_t> detections_per_task(tasks.size());
+
+    // large tasks are computed one after the other, using all threads inside each scale --
+    std::vector<size_t> concurrent_tasks_indices;
+    for(size_t task_index = 0; task_index < tasks.size(); task_index += 1)
+    {
+        const ScalesTask &task = tasks[task_index];
+        if((num_threads > 1) and (task.cost <= max_concurrent_task_cost))
+        {
+            concurrent_tasks_indices.push_back(task_index);
+            continue;
+        }
+
+        for(size_t search_range_index=task.begin_scale_index;
+            search_range_index < task.end_scale_index;
+            search_range_index +=1)
+        {
+            const double start_wall_time = omp_get_wtime();
+            const size_t num_previous_detections = detections_per_task[task_index].size();
+            compute_detections_at_specific_scale(search_range_index,
+                                                 *integral_channels_computer_p, computed_integral_channels_key,
+                                                 stages_left_in_the_row, stages_left,
+                                                 detections_scores, num_evaluated_stages,
+                                                 detections_per_task[task_index],
+                                                 save_score_image, first_call);
+            if(streaming_nms_buffer_size > 0)
+            {
+                stream_raw_detections(detections_per_task[task_index], num_previous_detections);
+            }
+            computation_time_per_scale[search_range_index] = omp_get_wtime() - start_wall_time;
+        }
+    } // end of "for each task"
+
+    // small tasks are computed concurrently, largest first --
+    std::stable_sort(concurrent_tasks_indices.begin(), concurrent_tasks_indices.end(),
+                     TaskIndexHasLargerCost(tasks));
+
+    while(per_thread_scratch_buffers.size() < static_cast<size_t>(num_threads))
+    {
+        per_thread_scratch_buffers.push_back(boost::shared_ptr<ScaleScratchBuffers>(new ScaleScratchBuffers()));
+        per_thread_scratch_buffers.back()->integral_channels_computer.set_single_pass_computation(
+                    use_single_pass_integral_channels);
+    }
+
+    // since each task is much smaller than the whole frame, dynamic scheduling balances the load
+#pragma omp parallel for schedule(dynamic, 1)
+    for(size_t i=0; i < concurrent_tasks_indices.size(); i+=1)
+    {
+        const size_t task_index = concurrent_tasks_indices[i];
+        const ScalesTask &task = tasks[task_index];
+        ScaleScratchBuffers &buffers = *per_thread_scratch_buffers[omp_get_thread_num()];
+
+        // the buffers only grow, they will quickly fit the largest concurrent task
+        const image_size_t &scaled_input_image_size =
+                extra_data_per_scale[task.begin_scale_index].scaled_input_image_size;
+        if((buffers.detections_scores.shape()[0] < scaled_input_image_size.y())
+           or (buffers.detections_scores.shape()[1] < scaled_input_image_size.x()))
+        {
+            const size_t
+                    max_y = std::max<size_t>(buffers.detections_scores.shape()[0], scaled_input_image_size.y()),
+                    max_x = std::max<size_t>(buffers.detections_scores.shape()[1], scaled_input_image_size.x());
+            buffers.stages_left_in_the_row.resize(max_y);
+            buffers.stages_left.resize(boost::extents[max_y][max_x]);
+            buffers.detections_scores.resize(boost::extents[max_y][max_x]);
+            buffers.num_evaluated_stages.resize(boost::extents[max_y][max_x]);
+        }
+
+        for(size_t search_range_index=task.begin_scale_index;
+            search_range_index < task.end_scale_index;
+            search_range_index +=1)
+        {
+            const double start_wall_time = omp_get_wtime();
+            // first_call is only used to print debug messages, we avoid printing from multiple threads
+            const bool concurrent_first_call = false;
+            const size_t num_previous_detections = detections_per_task[task_index].size();
+            compute_detections_at_specific_scale(search_range_index,
+                                                 buffers.integral_channels_computer,
+                                                 buffers.computed_integral_channels_key,
+                                                 buffers.stages_left_in_the_row, buffers.stages_left,
+                                                 buffers.detections_scores, buffers.num_evaluated_stages,
+                                                 detections_per_task[task_index],
+                                                 save_score_image, concurrent_first_call);
+            if(streaming_nms_buffer_size > 0)
+            {
+                // the suppression runs while the other threads are still evaluating their scales
+                stream_raw_detections(detections_per_task[task_index], num_previous_detections);
+            }
+            computation_time_per_scale[search_range_index] = omp_get_wtime() - start_wall_time;
+        }
+    } // end of "for each concurrent task"
+
+    // merge the detections --
+    for(size_t task_index = 0; task_index < tasks.size(); task_index += 1)
+    {
+        detections.insert(detections.end(),
+                          detections_per_task[task_index].begin(), detections_per_task[task_index].end());
+    }
+
+    if(first_call)
+    {
+        log_debug() << str(format("Computing %i scales in %i tasks, %i of them concurrently (using %i threads)")
+                           % search_ranges.size() % tasks.size()
+                           % concurrent_tasks_indices.size() % num_threads) << std::endl;
+    }
+
+    return;
+}
+
+
+
 void IntegralChannelsDetector::process_raw_detections()
 {
 
     const size_t num_raw_detections = detections.size();
 
+    if(streaming_nms_buffer_size > 0)
+    {
+        // the detections were already resized, filtered (and partially suppressed) by stream_raw_detections
+        log_info() << "number of detections (before non maximal suppression)  on this frame == "
+                   << num_raw_detections << " (after streaming suppression)" << std::endl;
+
+        compute_non_maximal_suppresion();
+        return;
+    }
+
     // windows size adjustment should be done before non-maximal suppression
     if(this->resize_detection_windows)
     {
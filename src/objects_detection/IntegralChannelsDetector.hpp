@@ -4,7 +4,9 @@
 #include "BaseIntegralChannelsDetector.hpp"
 
 #include "SoftCascadeOverIntegralChannelsModel.hpp"
+#include "CompiledSoftCascadeOverIntegralChannels.hpp"
 #include "integral_channels/IntegralChannelsForPedestrians.hpp"
+#include "integral_channels/IntegralChannelsPyramid.hpp"
 
 
 #include <boost/gil/typedefs.hpp>
@@ -17,6 +19,8 @@
 #include <boost/cstdint.hpp>
 
 #include <vector>
+#include <map>
+#include <string>
 
 namespace doppia {
 // forward declaration
@@ -45,6 +49,22 @@ public:
     typedef std::vector<boost::uint8_t> stages_left_in_the_row_t;
     typedef boost::multi_array<boost::uint8_t, 2> stages_left_t;
 
+    /// number of cascade stages evaluated on each candidate window
+    typedef boost::multi_array<int, 2> num_evaluated_stages_t;
+
+    /// rows [min_y, max_y] where the top-left corner of a detection window may be placed,
+    /// for one column of the integral channels (max_y < min_y means that no row is searched)
+    struct WindowsRowsRange
+    {
+        int min_y, max_y;
+    };
+
+    /// one range per integral channels column
+    typedef std::vector<WindowsRowsRange> windows_rows_per_column_t;
+
+    /// one flag per integral channels row, true if the windows with their top on this row should be searched
+    typedef std::vector<boost::uint8_t> rows_mask_t;
+
     IntegralChannelsDetector(
             const boost::program_options::variables_map &options,
             boost::shared_ptr<SoftCascadeOverIntegralChannelsModel> cascade_model_p,
@@ -54,17 +74,124 @@ public:
     ~IntegralChannelsDetector();
 
     void set_image(const boost::gil::rgb8c_view_t &input_image);
+
+    /// besides storing the stixels (used when filtering the detections),
+    /// restricts the cascade evaluation to the windows consistent with the stixels
+    void set_stixels(const stixels_t &stixels);
+
+    /// besides updating the search ranges (see BaseIntegralChannelsDetector),
+    /// skips the rows and scales that cannot contain detections consistent with the corridor
+    void set_ground_plane_corridor(const ground_plane_corridor_t &corridor);
+
+    /// the predicted regions are only used on the frames that are not fully searched
+    /// (see objects_detector.full_search_period), they must be set again before each compute()
+    void set_predicted_regions(const predicted_regions_t &regions);
+
     void compute();
 
+    /// when true, each detection window runs through the whole cascade before moving to the next one
+    /// (see SoftCascadeWindowsTileEvaluator), instead of running each stage over all the windows.
+    /// Both modes provide the exact same detections.
+    /// The window-major mode runs from the compiled cascades (see CompiledSoftCascadeOverIntegralChannels)
+    void set_window_major_evaluation(const bool use_window_major_evaluation);
+
+    /// wall time (in seconds) spent on each scale (resizing, integral channels and cascade evaluation)
+    /// during the last call to compute()
+    const std::vector<double> &get_computation_time_per_scale() const;
+
 protected:
 
+    /// identifies the integral channels currently held by an integral channels computer,
+    /// they can only be reused for the same input image and the same scaled input size
+    struct ComputedIntegralChannelsKey
+    {
+        ComputedIntegralChannelsKey();
+
+        /// zero means "no integral channels computed yet"
+        size_t input_image_index;
+        image_size_t scaled_input_image_size;
+    };
+
+    /// buffers used to evaluate the detector at one scale,
+    /// when computing multiple scales concurrently each thread uses its own set
+    struct ScaleScratchBuffers
+    {
+        IntegralChannelsForPedestrians integral_channels_computer;
+        ComputedIntegralChannelsKey computed_integral_channels_key;
+        stages_left_in_the_row_t stages_left_in_the_row;
+        stages_left_t stages_left;
+        detections_scores_t detections_scores;
+        num_evaluated_stages_t num_evaluated_stages;
+    };
+
     boost::scoped_ptr<IntegralChannelsForPedestrians> integral_channels_computer_p;
+    ComputedIntegralChannelsKey computed_integral_channels_key;
+
+    /// incremented each time set_image is called
+    size_t input_image_index;
+
+    /// when channels_pyramid_real_scales_per_octave > 0, the integral channels of all the scales
+    /// are computed at once (before evaluating the cascades), approximating the scales in between the real ones
+    const int channels_pyramid_real_scales_per_octave;
+    boost::scoped_ptr<IntegralChannelsPyramid> channels_pyramid_p;
+
+    void compute_channels_pyramid();
+
+    /// when streaming_nms_buffer_size > 0, the detections of each scale are resized and filtered
+    /// right after computing the scale, and the buffered detections are reduced via non maximal suppression
+    /// each time they exceed streaming_nms_buffer_size (keeping at most streaming_nms_max_detections)
+    const int streaming_nms_buffer_size, streaming_nms_max_detections;
+    float streaming_nms_minimal_overlap_threshold;
+
+    /// process the detections starting at first_new_detection_index (the ones of the last computed scale),
+    /// thread safe, each thread uses its own detections vector
+    void stream_raw_detections(detections_t &detections, const size_t first_new_detection_index) const;
 
     boost::gil::rgb8_image_t input_image;
     boost::gil::rgb8c_view_t input_view;
 
     float max_score_last_frame;
 
+    bool use_window_major_evaluation;
+
+    /// see IntegralChannelsForPedestrians::set_single_pass_computation
+    const bool use_single_pass_integral_channels;
+
+    /// compare the features values and thresholds as integers (in integral channels units) instead of floats,
+    /// the window-major evaluation always uses integers
+    const bool use_integer_features;
+
+    /// compiled cascade and the (first) scale it was compiled for
+    struct CompiledCascadeEntry
+    {
+        boost::shared_ptr<const CompiledSoftCascadeOverIntegralChannels> cascade_p;
+        float relative_scale;
+        detection_window_size_t detection_window_size;
+    };
+
+    /// compiled cascades indexed by their source checksum,
+    /// reused across scales and input size changes (the rescaled cascades do not depend on the input size)
+    std::map<boost::uint64_t, CompiledCascadeEntry> compiled_cascades_cache;
+
+    /// for each scale, the compiled version of detection_cascade_per_scale (or detection_stump_cascade_per_scale),
+    /// only filled when using the window-major evaluation
+    std::vector< boost::shared_ptr<const CompiledSoftCascadeOverIntegralChannels> > compiled_cascade_per_scale;
+
+    /// file used to load and save the compiled cascades, empty if not used
+    const std::string compiled_cascades_file_path;
+    bool compiled_cascades_file_was_read;
+
+    /// updates compiled_cascade_per_scale,
+    /// (re)compiles only the cascades that are not yet in compiled_cascades_cache
+    void compile_detection_cascades();
+    void read_compiled_cascades_file();
+    void save_compiled_cascades_file() const;
+
+    /// should we compute the small scales concurrently ?
+    bool use_parallel_scales;
+    std::vector< boost::shared_ptr<ScaleScratchBuffers> > per_thread_scratch_buffers;
+    std::vector<double> computation_time_per_scale;
+
     /// are there cascade stages left to be executed on this pixel ?
     stages_left_t stages_left;
 
@@ -74,16 +201,100 @@ protected:
     /// pixel wise detections scores
     detections_scores_t detections_scores;
 
+    /// pixel wise number of evaluated cascade stages,
+    /// each detector instance has its own buffer, each row is only written by one thread
+    num_evaluated_stages_t num_evaluated_stages;
+
+    /// candidate windows where less stages were evaluated are not considered as detections
+    /// (partial detections at the image borders skip the stages that fall outside of the image)
+    const int min_evaluated_stages;
+
+    /// for each scale, the rows where the detection windows are searched (for each column),
+    /// empty when no stixels are available (all the search range is used)
+    std::vector<windows_rows_per_column_t> stixels_windows_rows_per_scale;
+
+    /// updates stixels_windows_rows_per_scale using the estimated_stixels,
+    /// mirrors GpuVeryFastIntegralChannelsDetector::set_gpu_stixels
+    void compute_stixels_windows_rows();
+
+    /// the stixels windows statistics are only printed once per detector
+    bool stixels_windows_rows_were_computed;
+
+    /// for each scale, the rows where the windows fit the ground plane corridor
+    /// (same criterion as filter_detections), empty when no corridor is available
+    std::vector<rows_mask_t> ground_plane_rows_mask_per_scale;
+
+    /// corridor used to compute ground_plane_rows_mask_per_scale,
+    /// the masks are only recomputed when the corridor changes significantly
+    ground_plane_corridor_t ground_plane_rows_mask_corridor;
+
+    /// fraction of the (row, scale) pairs skipped thanks to ground_plane_rows_mask_per_scale
+    float ground_plane_skipped_rows_fraction;
+
+    void compute_ground_plane_rows_mask();
+
+    /// the full image is searched once every full_search_period frames,
+    /// the other frames only search around the predicted regions (when available)
+    const int full_search_period;
+    int frames_since_full_search;
+    bool predicted_regions_were_set;
+    predicted_regions_t predicted_regions;
+
+    /// for each scale, the rows searched around the predicted regions (for each column),
+    /// already intersected with stixels_windows_rows_per_scale.
+    /// Empty when the current frame is fully searched
+    std::vector<windows_rows_per_column_t> predicted_windows_rows_per_scale;
+
+    /// for each scale, true if at least one window is searched around the predicted regions
+    std::vector<boost::uint8_t> predicted_regions_scales_mask;
+
+    /// updates predicted_windows_rows_per_scale and predicted_regions_scales_mask,
+    /// the windows whose center is inside the position uncertainty of a predicted region,
+    /// and whose height is inside its scale uncertainty, are searched
+    void compute_predicted_windows_rows();
+
+    /// ratio between the detection window height and the object height (from the model object window)
+    float get_object_to_detection_window_height_ratio() const;
+
     void compute_detections_at_specific_scale(
             const size_t search_range_index,
             const bool save_score_image = false,
             const bool first_call = false);
 
+    /// same as above, but using the provided buffers instead of the detector members
+    void compute_detections_at_specific_scale(
+            const size_t search_range_index,
+            IntegralChannelsForPedestrians &integral_channels_computer,
+            ComputedIntegralChannelsKey &computed_integral_channels_key,
+            stages_left_in_the_row_t &stages_left_in_the_row,
+            stages_left_t &stages_left,
+            detections_scores_t &detections_scores,
+            num_evaluated_stages_t &num_evaluated_stages,
+            detections_t &detections,
+            const bool save_score_image,
+            const bool first_call);
+
+    /// Scales that would dominate the computation time are computed one after the other,
+    /// each one using all the threads (one image row per thread),
+    /// the remaining scales are computed concurrently (one scales task per thread, largest tasks first).
+    /// Provides the same detections (in the same order) as computing the scales one after the other.
+    void compute_detections_at_all_scales_in_parallel(
+            const bool save_score_image,
+            const bool first_call);
+
 
     const IntegralChannelsForPedestrians::integral_channels_t &
     resize_input_and_compute_integral_channels(const size_t search_range_index,
                                                const bool first_call = false);
 
+    /// the integral channels held by integral_channels_computer are reused
+    /// only when computed_integral_channels_key matches the current input image and scale
+    const IntegralChannelsForPedestrians::integral_channels_t &
+    resize_input_and_compute_integral_channels(const size_t search_range_index,
+                                               IntegralChannelsForPedestrians &integral_channels_computer,
+                                               ComputedIntegralChannelsKey &computed_integral_channels_key,
+                                               const bool first_call);
+
     size_t get_input_width() const;
     size_t get_input_height() const;
 
@@ -128,6 +339,29 @@ void compute_detections_at_specific_scale(
         IntegralChannelsDetector::stages_left_in_the_row_t &stages_left_in_the_row,
         IntegralChannelsDetector::stages_left_t &stages_left,
         IntegralChannelsDetector::detections_scores_t &detections_scores,
+        IntegralChannelsDetector::num_evaluated_stages_t &num_evaluated_stages,
+        const IntegralChannelsForPedestrians::integral_channels_t &integral_channels,
+        const IntegralChannelsDetector::detection_window_size_t &detection_window_size,
+        const float original_detection_window_scale,
+        IntegralChannelsDetector::detections_t &detections,
+        IntegralChannelsDetector::detections_t *non_rescaled_detections_p,
+        const IntegralChannelsDetector::cascade_stages_t &cascade_stages,
+        const float score_threshold,
+        const int min_evaluated_stages,
+        const ScaleData &scale_data,
+        const bool print_stages,
+        const bool print_cascade_statistics,
+        const bool save_score_image,
+        const bool use_the_detector_model_cascade = true, // FIXME move this parameter
+        const bool use_integer_features = true);
+
+/// same as compute_detections_at_specific_scale, but evaluates the cascade window-major,
+/// a tile of neighbouring windows at a time (using SIMD instructions when available)
+void compute_detections_at_specific_scale_window_major(
+        IntegralChannelsDetector::stages_left_in_the_row_t &stages_left_in_the_row,
+        IntegralChannelsDetector::stages_left_t &stages_left,
+        IntegralChannelsDetector::detections_scores_t &detections_scores,
+        IntegralChannelsDetector::num_evaluated_stages_t &num_evaluated_stages,
         const IntegralChannelsForPedestrians::integral_channels_t &integral_channels,
         const IntegralChannelsDetector::detection_window_size_t &detection_window_size,
         const float original_detection_window_scale,
@@ -135,11 +369,13 @@ void compute_detections_at_specific_scale(
         IntegralChannelsDetector::detections_t *non_rescaled_detections_p,
         const IntegralChannelsDetector::cascade_stages_t &cascade_stages,
         const float score_threshold,
+        const int min_evaluated_stages,
         const ScaleData &scale_data,
         const bool print_stages,
         const bool print_cascade_statistics,
         const bool save_score_image,
-        const bool use_the_detector_model_cascade = true); // FIXME move this parameter
+        const bool use_the_detector_model_cascade = true,
+        const bool use_integer_features = true);
 
 
 
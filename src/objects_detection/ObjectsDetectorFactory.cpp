@@ -82,6 +82,7 @@ ObjectsDetectorFactory::get_args_options()
              "detection methods: \n"\
              "\tcpu_linear_svm: sliding window linear svm over integral channels\n" \
              "\tcpu_channel: P. Dollar 2009 Integral Channel Features\n" \
+             "\tcpu_channel_window_major: same as cpu_channel, but evaluates the cascade one window tile at a time (SIMD)\n" \
              "\tgpu_channel: GPU implementation of gpu_channel\n" \
              "\tcpu_fpdw, cpu_fpdw_v2: P. Dollar 2010 Fastest pedestrian detector in the West\n" \
              "\tgpu_fpdw: GPU implementation of cpu_fpdw_v2\n" \
@@ -98,6 +99,7 @@ ObjectsDetectorFactory::get_args_options()
             ("objects_detector.non_maximal_suppression_method", value<string>()->default_value("greedy"),
              "Indicate which method to use for non-maximal suppression. Options are:\n"\
              "\tgreedy\n" \
+             "\tgreedy_indexed (same results as greedy, faster for large numbers of detections)\n" \
              "\tnone\n" )
 
             ("objects_detector.ignore_soft_cascade", value<bool>()->default_value(false),
@@ -256,10 +258,9 @@ void add_cascade_offset(
 }
 
 
-AbstractObjectsDetector*
-new_single_scale_detector_instance(const variables_map &options,
-                                   boost::shared_ptr<doppia_protobuf::DetectorModel> detector_model_data_p,
-                                   boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p)
+boost::shared_ptr<SoftCascadeOverIntegralChannelsModel>
+new_single_scale_model(const variables_map &options,
+                       boost::shared_ptr<doppia_protobuf::DetectorModel> detector_model_data_p)
 {
 
     if((detector_model_data_p.get() != NULL) and (detector_model_data_p->has_soft_cascade_model()))
@@ -279,15 +280,28 @@ new_single_scale_detector_instance(const variables_map &options,
 
 
     boost::shared_ptr<SoftCascadeOverIntegralChannelsModel> cascade_model_p;
+    if(detector_model_data_p)
+    {
+        cascade_model_p.reset(new SoftCascadeOverIntegralChannelsModel(*detector_model_data_p));
+    }
+
+    return cascade_model_p;
+}
+
+
+AbstractObjectsDetector*
+new_single_scale_detector_instance(const variables_map &options,
+                                   boost::shared_ptr<doppia_protobuf::DetectorModel> detector_model_data_p,
+                                   boost::shared_ptr<SoftCascadeOverIntegralChannelsModel> cascade_model_p,
+                                   boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p)
+{
     float score_threshold = get_option_value<float>(options, "objects_detector.score_threshold");
 
     const bool ignore_cascade = get_option_value<bool>(options, "objects_detector.ignore_soft_cascade");
 
-    if(detector_model_data_p)
+    if(cascade_model_p)
     {
-        cascade_model_p.reset(new SoftCascadeOverIntegralChannelsModel(*detector_model_data_p));
-
-        if((ignore_cascade == false) and cascade_model_p and cascade_model_p->has_soft_cascade())
+        if((ignore_cascade == false) and cascade_model_p->has_soft_cascade())
         {
             const float last_cascade_threshold = cascade_model_p->get_last_cascade_threshold();
             // seems a "non trivial" threshold
@@ -345,6 +359,23 @@ new_single_scale_detector_instance(const variables_map &options,
                     score_threshold, additional_border);
 
     }
+    else if((method.compare("cpu_channel_window_major") == 0) or
+            (method.compare("cpu_channels_window_major") == 0) or
+            (method.compare("cpu_chnftrs_window_major") == 0) )
+    {
+
+        if(cascade_model_p == false)
+        {
+            throw std::runtime_error("Failed to read a model compatible with the selected IntegralChannelsDetector");
+        }
+
+        IntegralChannelsDetector *detector_p = new IntegralChannelsDetector(
+                    options,
+                    cascade_model_p, non_maximal_suppression_p,
+                    score_threshold, additional_border);
+        detector_p->set_window_major_evaluation(true);
+        objects_detector_p = detector_p;
+    }
     else if((method.compare("gpu_channel") == 0) or
             (method.compare("gpu_channels") == 0) or
             (method.compare("gpu_chnftrs") == 0) )
@@ -430,10 +461,9 @@ new_single_scale_detector_instance(const variables_map &options,
 }
 
 
-AbstractObjectsDetector*
-new_multi_scales_detector_instance(const variables_map &options,
-                                   boost::shared_ptr<doppia_protobuf::MultiScalesDetectorModel> detector_model_data_p,
-                                   boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p)
+boost::shared_ptr<MultiScalesIntegralChannelsModel>
+new_multi_scales_model(const variables_map &options,
+                       boost::shared_ptr<doppia_protobuf::MultiScalesDetectorModel> detector_model_data_p)
 {
 
     if(detector_model_data_p)
@@ -462,15 +492,27 @@ new_multi_scales_detector_instance(const variables_map &options,
     } // end of "if detector model data is available"
 
     boost::shared_ptr<MultiScalesIntegralChannelsModel> detector_model_p;
-    float score_threshold = get_option_value<float>(options, "objects_detector.score_threshold");
-
-    const bool ignore_cascade = get_option_value<bool>(options, "objects_detector.ignore_soft_cascade");
-
     if(detector_model_data_p)
     {
         // the MultiScalesIntegralChannelsModel is built _after_ applying cascade_threshold_offset
         detector_model_p.reset(new MultiScalesIntegralChannelsModel(*detector_model_data_p));
+    }
+
+    return detector_model_p;
+}
+
+
+AbstractObjectsDetector*
+new_multi_scales_detector_instance(const variables_map &options,
+                                   boost::shared_ptr<MultiScalesIntegralChannelsModel> detector_model_p,
+                                   boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p)
+{
+    float score_threshold = get_option_value<float>(options, "objects_detector.score_threshold");
+
+    const bool ignore_cascade = get_option_value<bool>(options, "objects_detector.ignore_soft_cascade");
 
+    if(detector_model_p)
+    {
         // MultiScalesIntegralChannelsModel takes care of normalizing the models between themselves
         // this we only need to update the score_threshold based on one of models
 
@@ -501,7 +543,7 @@ new_multi_scales_detector_instance(const variables_map &options,
                 } // end of "for each detector"
             } // end of "if we care about the cascade"
         } // end of "if detectors is not empty"
-    } // end of "if detector model data is available"
+    } // end of "if detector model is available"
 
 
     int additional_border = 0;
@@ -528,6 +570,23 @@ new_multi_scales_detector_instance(const variables_map &options,
                     score_threshold, additional_border);
 
     }
+    else if((method.compare("cpu_channel_window_major") == 0) or
+            (method.compare("cpu_channels_window_major") == 0) or
+            (method.compare("cpu_chnftrs_window_major") == 0) )
+    {
+
+        if(detector_model_p == false)
+        {
+            throw std::runtime_error("Failed to read a model compatible with the selected IntegralChannelsDetector");
+        }
+
+        MultiscalesIntegralChannelsDetector *detector_p = new MultiscalesIntegralChannelsDetector(
+                    options,
+                    detector_model_p, non_maximal_suppression_p,
+                    score_threshold, additional_border);
+        detector_p->set_window_major_evaluation(true);
+        objects_detector_p = detector_p;
+    }
     else if((method.compare("gpu_channel") == 0) or
             (method.compare("gpu_channels") == 0) or
             (method.compare("gpu_chnftrs") == 0) )
@@ -598,12 +657,14 @@ new_multi_scales_detector_instance(const variables_map &options,
 AbstractObjectsDetector*
 ObjectsDetectorFactory::new_instance(const variables_map &options)
 {
+    const boost::shared_ptr<const SharedDetectorModel> model_p = new_shared_model(options);
+    return new_instance(options, *model_p);
+}
 
-    const string non_maximal_suppression_method = \
-            get_option_value<string>(options, "objects_detector.non_maximal_suppression_method");
-    boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p;
-    non_maximal_suppression_p.reset( NonMaximalSuppressionFactory::new_instance(non_maximal_suppression_method, options) );
 
+boost::shared_ptr<const SharedDetectorModel>
+ObjectsDetectorFactory::new_shared_model(const variables_map &options)
+{
     boost::filesystem::path model_path = get_option_value<string>(options, "objects_detector.model");
 
     model_path = replace_environment_variables(model_path);
@@ -614,13 +675,15 @@ ObjectsDetectorFactory::new_instance(const variables_map &options)
         throw std::invalid_argument("Could not find the objects_detector.model file");
     }
 
+    boost::shared_ptr<SharedDetectorModel> model_p(new SharedDetectorModel());
+
     boost::shared_ptr<doppia_protobuf::DetectorModel> detector_model_data_p;
     read_protobuf_model(model_path.string(), detector_model_data_p);
 
     if(detector_model_data_p)
     {
-        return new_single_scale_detector_instance(options,
-                                                  detector_model_data_p, non_maximal_suppression_p);
+        model_p->single_scale_model_data_p = detector_model_data_p;
+        model_p->single_scale_model_p = new_single_scale_model(options, detector_model_data_p);
     }
     else
     {
@@ -629,9 +692,7 @@ ObjectsDetectorFactory::new_instance(const variables_map &options)
 
         if(multi_scales_detector_model_data_p)
         {
-            return new_multi_scales_detector_instance(options,
-                                                      multi_scales_detector_model_data_p, non_maximal_suppression_p);
-
+            model_p->multi_scales_model_p = new_multi_scales_model(options, multi_scales_detector_model_data_p);
         }
         else
         {
@@ -640,6 +701,35 @@ ObjectsDetectorFactory::new_instance(const variables_map &options)
         }
     }
 
+    return model_p;
+}
+
+
+AbstractObjectsDetector*
+ObjectsDetectorFactory::new_instance(const variables_map &options, const SharedDetectorModel &model)
+{
+
+    const string non_maximal_suppression_method = \
+            get_option_value<string>(options, "objects_detector.non_maximal_suppression_method");
+    boost::shared_ptr<AbstractNonMaximalSuppression> non_maximal_suppression_p;
+    non_maximal_suppression_p.reset( NonMaximalSuppressionFactory::new_instance(non_maximal_suppression_method, options) );
+
+    if(model.single_scale_model_data_p)
+    {
+        return new_single_scale_detector_instance(options,
+                                                  model.single_scale_model_data_p, model.single_scale_model_p,
+                                                  non_maximal_suppression_p);
+    }
+    else if(model.multi_scales_model_p)
+    {
+        return new_multi_scales_detector_instance(options,
+                                                  model.multi_scales_model_p, non_maximal_suppression_p);
+    }
+    else
+    {
+        throw std::invalid_argument("ObjectsDetectorFactory::new_instance received an empty detector model");
+    }
+
     return NULL;
 }
 
@@ -11,14 +11,38 @@ class DetectorModel;
 
 namespace doppia {
 
-// forward declaration
+// forward declarations
 class AbstractObjectsDetector;
+class SoftCascadeOverIntegralChannelsModel;
+class MultiScalesIntegralChannelsModel;
+
+/// Detector model read from the objects_detector.model file (with the cascade offsets already applied).
+/// The detectors only read their model, so multiple detector instances can share the same SharedDetectorModel,
+/// even when used from different threads.
+/// Exactly one of single_scale_model_p and multi_scales_model_p is set.
+struct SharedDetectorModel
+{
+    /// kept for the models that are not soft cascades (e.g. linear svm)
+    boost::shared_ptr<doppia_protobuf::DetectorModel> single_scale_model_data_p;
+
+    boost::shared_ptr<SoftCascadeOverIntegralChannelsModel> single_scale_model_p;
+    boost::shared_ptr<MultiScalesIntegralChannelsModel> multi_scales_model_p;
+};
 
 class ObjectsDetectorFactory
 {
 public:
     static boost::program_options::options_description get_args_options();
     static AbstractObjectsDetector* new_instance(const boost::program_options::variables_map &options);
+
+    /// read the model once, to then create multiple detectors using new_instance(options, model)
+    static boost::shared_ptr<const SharedDetectorModel>
+    new_shared_model(const boost::program_options::variables_map &options);
+
+    /// the detector options should be compatible with the options used to create the model
+    /// (objects_detector.model and the cascade offsets are ignored)
+    static AbstractObjectsDetector* new_instance(const boost::program_options::variables_map &options,
+                                                 const SharedDetectorModel &model);
 };
 
 void read_protobuf_model(const std::string &filename,
@@ -4,6 +4,8 @@
 #include "SoftCascadeOverIntegralChannelsModel.hpp"
 #include "integral_channels/IntegralChannelsForPedestrians.hpp"
 
+#include <boost/cstdint.hpp>
+
 #include <cstdio>
 
 namespace doppia {
@@ -31,6 +33,11 @@ public:
     /// get the integral value of the feature
     float get_value();
 
+    /// same as get_value, but computed using integers only.
+    /// Both values are identical as long as the integral channels values are below 2^24,
+    /// above that get_value looses precision
+    boost::int32_t get_integer_value();
+
 protected:
 
     const uint8_t xstride;
@@ -96,6 +103,16 @@ float SlidingIntegralFeature::get_value()
 }
 
 
+inline
+boost::int32_t SlidingIntegralFeature::get_integer_value()
+{
+    // a + c - b - d is the sum of the channel values inside the box, it is never negative,
+    // the uint32 wrap around of the intermediate results does not matter
+    const boost::uint32_t a = *top_left_p, b = *top_right_p, c = *bottom_right_p, d = *bottom_left_p;
+    return static_cast<boost::int32_t>(a + c - b - d);
+}
+
+
 } // end of namespace doppia
 
 #endif // SLIDINGINTEGRALFEATURE_HPP
@@ -13,6 +13,7 @@
 
 #include <ostream>
 #include <vector>
+#include <algorithm>
 #include <cmath>
 
 namespace
@@ -67,6 +68,7 @@ SoftCascadeOverIntegralChannelsModel::SoftCascadeOverIntegralChannelsModel(const
     set_stages_from_model(model.soft_cascade_model());
 
     shrinking_factor = model.soft_cascade_model().shrinking_factor();
+    set_channels_scaling_exponents_from_model(model.soft_cascade_model());
 
     if(model.has_scale())
     {
@@ -387,6 +389,39 @@ void set_weak_classifier(const doppia_protobuf::SoftCascadeOverIntegralChannelsS
 }
 
 
+void SoftCascadeOverIntegralChannelsModel::set_channels_scaling_exponents_from_model(
+        const doppia_protobuf::SoftCascadeOverIntegralChannelsModel &model)
+{
+    // FIXME hardcoded parameter, 6 gradients orientations, 1 gradient intensity, 3 LUV color channels
+    const int num_channels = 10;
+
+    channels_scaling_exponents.clear();
+
+    if(model.channels_scaling_exponents_size() == 0)
+    {
+        // per pixel estimates from "Fast Feature Pyramids for Object Detection", P. Dollar et al. PAMI 2014,
+        // the gradients get stronger when downscaling the image, the colors do not change
+        const float gradients_exponent = 0.11, luv_exponent = 0;
+        channels_scaling_exponents.resize(num_channels, gradients_exponent);
+        std::fill(channels_scaling_exponents.begin() + 7, channels_scaling_exponents.end(), luv_exponent);
+    }
+    else if(model.channels_scaling_exponents_size() == num_channels)
+    {
+        channels_scaling_exponents.assign(model.channels_scaling_exponents().begin(),
+                                          model.channels_scaling_exponents().end());
+        log_info() << "Using the channels scaling exponents provided by the model" << std::endl;
+    }
+    else
+    {
+        log_error() << "The model provides " << model.channels_scaling_exponents_size()
+                    << " channels scaling exponents, expected " << num_channels << std::endl;
+        throw std::runtime_error("The model channels_scaling_exponents do not match the number of channels");
+    }
+
+    return;
+}
+
+
 void SoftCascadeOverIntegralChannelsModel::set_stages_from_model(const doppia_protobuf::SoftCascadeOverIntegralChannelsModel &model)
 {
     typedef google::protobuf::RepeatedPtrField< doppia_protobuf::IntegralChannelsFeature > features_t;
@@ -806,6 +841,11 @@ int SoftCascadeOverIntegralChannelsModel::get_shrinking_factor() const
     return shrinking_factor;
 }
 
+const std::vector<float> &SoftCascadeOverIntegralChannelsModel::get_channels_scaling_exponents() const
+{
+    return channels_scaling_exponents;
+}
+
 float SoftCascadeOverIntegralChannelsModel::get_last_cascade_threshold() const
 {
 
@@ -70,6 +70,10 @@ public:
 
     int get_shrinking_factor() const;
 
+    /// one exponent per channel, used to approximate the channels of nearby scales
+    /// (see IntegralChannelsPyramid and channels_scaling_exponents in detector_model.proto)
+    const std::vector<float> &get_channels_scaling_exponents() const;
+
     /// Helper method that returns the cascade threshold of the last stage of the model
     float get_last_cascade_threshold() const;
 
@@ -87,11 +91,13 @@ protected:
     stump_stages_t stump_stages;
 
     int shrinking_factor;
+    std::vector<float> channels_scaling_exponents;
     float scale;
     model_window_size_t model_window_size;
     object_window_t object_window;
 
     void set_stages_from_model(const doppia_protobuf::SoftCascadeOverIntegralChannelsModel &model);    
+    void set_channels_scaling_exponents_from_model(const doppia_protobuf::SoftCascadeOverIntegralChannelsModel &model);
 };
 
 /// debugging helper
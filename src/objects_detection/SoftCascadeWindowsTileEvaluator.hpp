@@ -0,0 +1,550 @@
+#ifndef BICLOP_SOFTCASCADEWINDOWSTILEEVALUATOR_HPP
+#define BICLOP_SOFTCASCADEWINDOWSTILEEVALUATOR_HPP
+
+#include "SoftCascadeOverIntegralChannelsModel.hpp"
+#include "CompiledSoftCascadeOverIntegralChannels.hpp"
+#include "integral_channels/IntegralChannelsForPedestrians.hpp"
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/cstdint.hpp>
+
+#include <vector>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+// emmintrin will define __m128i
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+#endif
+
+namespace doppia {
+
+/// Small helper class to build fast IntegralChannels detectors
+/// Evaluates the soft cascade "window-major": a tile of neighbouring candidate windows
+/// (same row, xstride pixels apart) goes through all the cascade stages before moving to the next tile
+/// (the stage-major alternative sweeps each stage over all the rows, see compute_cascade_stage_on_row).
+/// The features of the tile are read using SIMD gathers (AVX2) or loads (SSE2),
+/// and the windows rejected by the soft cascade are masked out until the whole tile is rejected.
+///
+/// The cascade is read from a CompiledSoftCascadeOverIntegralChannels, the features values are computed
+/// and compared to the thresholds as integers (in integral channels units).
+/// As long as the integral channels values are below 2^24 (always the case for our images)
+/// the float computation of SlidingIntegralFeature::get_value is exact,
+/// thus the obtained scores are bit-for-bit identical to the stage-major evaluation.
+/// The integral channels values are loaded as signed int32, this is fine for
+/// all the images we handle (values below 2^31, i.e. images smaller than ~2800x2800 pixels).
+///
+/// This class will do zero memory checks, the user is responsible of avoiding segmentation faults
+class SoftCascadeWindowsTileEvaluator
+{
+public:
+
+    typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
+    typedef SoftCascadeOverIntegralChannelsModel::fast_stages_t fast_stages_t;
+    typedef SoftCascadeOverIntegralChannelsModel::stump_stages_t stump_stages_t;
+
+#if defined(__AVX2__)
+    /// number of windows evaluated in parallel
+    static const int tile_size = 8;
+#else
+    /// number of windows evaluated in parallel
+    static const int tile_size = 4;
+#endif
+
+    /// the compiled cascade must outlive the evaluator
+    SoftCascadeWindowsTileEvaluator(const CompiledSoftCascadeOverIntegralChannels &compiled_cascade,
+                                    const integral_channels_t &integral_channels,
+                                    const bool use_the_detector_model_cascade);
+
+    /// will compile the stages (slower, better use a cached compiled cascade)
+    SoftCascadeWindowsTileEvaluator(const fast_stages_t &stages,
+                                    const integral_channels_t &integral_channels,
+                                    const bool use_the_detector_model_cascade);
+
+    /// will compile the stages (slower, better use a cached compiled cascade)
+    SoftCascadeWindowsTileEvaluator(const stump_stages_t &stages,
+                                    const integral_channels_t &integral_channels,
+                                    const bool use_the_detector_model_cascade);
+
+    /// Evaluates num_windows (<= tile_size) windows, the first one at (row_index, col_index),
+    /// the following ones each xstride pixels to the right.
+    /// scores and num_stages_evaluated must point to arrays of at least num_windows elements
+    /// @returns the number of stages after which some windows of the tile are still unresolved
+    /// (0 if every window was rejected by the first stage, stages.size() if some window went through the whole cascade)
+    size_t operator()(const size_t row_index, const size_t col_index,
+                      const int xstride, const int num_windows,
+                      float *scores, int *num_stages_evaluated) const;
+
+    size_t get_num_stages() const;
+
+protected:
+
+    /// only set when the evaluator was built from the cascade stages
+    boost::scoped_ptr<const CompiledSoftCascadeOverIntegralChannels> own_compiled_cascade_p;
+
+    const bool use_the_detector_model_cascade;
+    bool use_stumps;
+    size_t num_stages;
+
+    /// for each node, the features corners (top_left, top_right, bottom_right, bottom_left)
+    /// stored as offsets with respect to the window top-left corner in the first channel
+    std::vector<boost::int32_t> nodes_a_offsets, nodes_b_offsets, nodes_c_offsets, nodes_d_offsets;
+
+    /// point to the compiled cascade data
+    const boost::int32_t *nodes_thresholds_p;
+    const float *leaves_weights_p, *cascade_thresholds_p;
+
+    const boost::int32_t *channels_origin_p;
+    size_t row_stride;
+
+    /// computes the nodes offsets for the given integral channels
+    void bind(const CompiledSoftCascadeOverIntegralChannels &compiled_cascade,
+              const integral_channels_t &integral_channels);
+
+    boost::int32_t get_feature_value(const boost::int32_t *window_p, const size_t node_index) const;
+
+    /// scalar version, used for the incomplete tiles at the end of the rows
+    size_t evaluate_window(const boost::int32_t *window_p, float &score, int &num_stages_evaluated) const;
+
+    /// SIMD version, used for full tiles
+    size_t evaluate_tile(const boost::int32_t *window_p, const int xstride,
+                         float *scores, int *num_stages_evaluated) const;
+
+#if defined(__AVX2__)
+    __m256i get_features_values(const boost::int32_t *window_p, const size_t node_index,
+                                const int xstride, const __m256i &lanes_offsets) const;
+#else
+    __m128i get_features_values(const boost::int32_t *window_p, const size_t node_index,
+                                const int xstride) const;
+#endif
+};
+
+
+// ~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~
+// all methods inlined for performance reasons
+
+inline
+SoftCascadeWindowsTileEvaluator::SoftCascadeWindowsTileEvaluator(
+        const CompiledSoftCascadeOverIntegralChannels &compiled_cascade,
+        const integral_channels_t &integral_channels,
+        const bool use_the_detector_model_cascade_)
+    : use_the_detector_model_cascade(use_the_detector_model_cascade_)
+{
+    bind(compiled_cascade, integral_channels);
+    return;
+}
+
+
+inline
+SoftCascadeWindowsTileEvaluator::SoftCascadeWindowsTileEvaluator(
+        const fast_stages_t &fast_stages,
+        const integral_channels_t &integral_channels,
+        const bool use_the_detector_model_cascade_)
+    : own_compiled_cascade_p(new CompiledSoftCascadeOverIntegralChannels(fast_stages)),
+      use_the_detector_model_cascade(use_the_detector_model_cascade_)
+{
+    bind(*own_compiled_cascade_p, integral_channels);
+    return;
+}
+
+
+inline
+SoftCascadeWindowsTileEvaluator::SoftCascadeWindowsTileEvaluator(
+        const stump_stages_t &stump_stages,
+        const integral_channels_t &integral_channels,
+        const bool use_the_detector_model_cascade_)
+    : own_compiled_cascade_p(new CompiledSoftCascadeOverIntegralChannels(stump_stages)),
+      use_the_detector_model_cascade(use_the_detector_model_cascade_)
+{
+    bind(*own_compiled_cascade_p, integral_channels);
+    return;
+}
+
+
+inline
+size_t SoftCascadeWindowsTileEvaluator::get_num_stages() const
+{
+    return num_stages;
+}
+
+
+inline
+void SoftCascadeWindowsTileEvaluator::bind(const CompiledSoftCascadeOverIntegralChannels &compiled_cascade,
+                                           const integral_channels_t &integral_channels)
+{
+    use_stumps = compiled_cascade.get_use_stumps();
+    num_stages = compiled_cascade.get_num_stages();
+
+    nodes_thresholds_p = compiled_cascade.nodes_threshold.empty()? NULL : &compiled_cascade.nodes_threshold[0];
+    leaves_weights_p = compiled_cascade.leaves_weights.empty()? NULL : &compiled_cascade.leaves_weights[0];
+    cascade_thresholds_p = compiled_cascade.cascade_thresholds.empty()? NULL : &compiled_cascade.cascade_thresholds[0];
+
+    // we assume a dense multi_array (as allocated by IntegralChannelsForPedestrians)
+    channels_origin_p = reinterpret_cast<const boost::int32_t *>(integral_channels.origin());
+    row_stride = integral_channels.strides()[1];
+
+    // offset of each channel plane with respect to the first channel
+    std::vector<boost::int32_t> channels_offsets(integral_channels.shape()[0]);
+    for(size_t channel_index=0; channel_index < channels_offsets.size(); channel_index+=1)
+    {
+        channels_offsets[channel_index] = channel_index*integral_channels.strides()[0];
+    }
+
+    const size_t num_nodes = compiled_cascade.nodes_threshold.size();
+    nodes_a_offsets.resize(num_nodes);
+    nodes_b_offsets.resize(num_nodes);
+    nodes_c_offsets.resize(num_nodes);
+    nodes_d_offsets.resize(num_nodes);
+    for(size_t node_index=0; node_index < num_nodes; node_index+=1)
+    {
+        const boost::int32_t
+                channel_offset = channels_offsets[compiled_cascade.nodes_channel_index[node_index]],
+                top_offset = channel_offset + compiled_cascade.nodes_min_y[node_index]*row_stride,
+                bottom_offset = channel_offset + compiled_cascade.nodes_max_y[node_index]*row_stride;
+
+        // same order as SlidingIntegralFeature: top_left, top_right, bottom_right, bottom_left (a, b, c, d)
+        nodes_a_offsets[node_index] = top_offset + compiled_cascade.nodes_min_x[node_index];
+        nodes_b_offsets[node_index] = top_offset + compiled_cascade.nodes_max_x[node_index];
+        nodes_c_offsets[node_index] = bottom_offset + compiled_cascade.nodes_max_x[node_index];
+        nodes_d_offsets[node_index] = bottom_offset + compiled_cascade.nodes_min_x[node_index];
+    }
+
+    return;
+}
+
+
+inline
+boost::int32_t SoftCascadeWindowsTileEvaluator::get_feature_value(const boost::int32_t *window_p,
+                                                                  const size_t node_index) const
+{
+    // same computation as SlidingIntegralFeature::get_value, but using integers
+    // (a + c - b - d is the sum of the channel values inside the box, it is never negative)
+    const boost::uint32_t
+            a = window_p[nodes_a_offsets[node_index]],
+            b = window_p[nodes_b_offsets[node_index]],
+            c = window_p[nodes_c_offsets[node_index]],
+            d = window_p[nodes_d_offsets[node_index]];
+    return static_cast<boost::int32_t>(a + c - b - d);
+}
+
+
+inline
+size_t SoftCascadeWindowsTileEvaluator::evaluate_window(const boost::int32_t *window_p,
+                                                       float &score, int &num_stages_evaluated) const
+{
+    float detection_score = 0;
+    size_t stage_index = 0;
+
+    for(; stage_index < num_stages; stage_index += 1)
+    {
+        if(use_stumps)
+        {
+            const float *weights_p = leaves_weights_p + 2*stage_index;
+            detection_score +=
+                    (get_feature_value(window_p, stage_index) >= nodes_thresholds_p[stage_index])?
+                        weights_p[0] : weights_p[1];
+        }
+        else
+        {
+            // level 1 nodes return a boolean value,
+            // level 2 nodes return directly the float value to add to the score
+            const size_t node_index = 3*stage_index;
+            const float *weights_p = leaves_weights_p + 4*stage_index;
+            if(get_feature_value(window_p, node_index) >= nodes_thresholds_p[node_index])
+            {
+                detection_score +=
+                        (get_feature_value(window_p, node_index + 1) >= nodes_thresholds_p[node_index + 1])?
+                            weights_p[0] : weights_p[1];
+            }
+            else
+            {
+                detection_score +=
+                        (get_feature_value(window_p, node_index + 2) >= nodes_thresholds_p[node_index + 2])?
+                            weights_p[2] : weights_p[3];
+            }
+        }
+
+        if(use_the_detector_model_cascade and detection_score < cascade_thresholds_p[stage_index])
+        {
+            // since re-ordered classifiers may have a "very high threshold in the middle"
+            detection_score = -1E5;
+            break;
+        }
+    } // end of "for each stage"
+
+    score = detection_score;
+
+    if(stage_index < num_stages)
+    {
+        // the window was rejected at stage_index
+        num_stages_evaluated = stage_index + 1;
+        return stage_index;
+    }
+
+    num_stages_evaluated = num_stages;
+    return num_stages;
+}
+
+
+#if defined(__AVX2__)
+
+inline
+__m256i SoftCascadeWindowsTileEvaluator::get_features_values(const boost::int32_t *window_p,
+                                                             const size_t node_index,
+                                                             const int xstride, const __m256i &lanes_offsets) const
+{
+    const boost::int32_t
+            *a_p = window_p + nodes_a_offsets[node_index], *b_p = window_p + nodes_b_offsets[node_index],
+            *c_p = window_p + nodes_c_offsets[node_index], *d_p = window_p + nodes_d_offsets[node_index];
+
+    __m256i a, b, c, d;
+    if(xstride == 1)
+    {
+        a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a_p));
+        b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b_p));
+        c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(c_p));
+        d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(d_p));
+    }
+    else
+    {
+        a = _mm256_i32gather_epi32(reinterpret_cast<const int *>(a_p), lanes_offsets, 4);
+        b = _mm256_i32gather_epi32(reinterpret_cast<const int *>(b_p), lanes_offsets, 4);
+        c = _mm256_i32gather_epi32(reinterpret_cast<const int *>(c_p), lanes_offsets, 4);
+        d = _mm256_i32gather_epi32(reinterpret_cast<const int *>(d_p), lanes_offsets, 4);
+    }
+
+    return _mm256_sub_epi32(_mm256_sub_epi32(_mm256_add_epi32(a, c), b), d);
+}
+
+
+/// (feature_values >= threshold), for integer thresholds above the int32 minimum
+inline
+__m256 get_nodes_results(const __m256i &feature_values, const boost::int32_t threshold)
+{
+    return _mm256_castsi256_ps(_mm256_cmpgt_epi32(feature_values, _mm256_set1_epi32(threshold - 1)));
+}
+
+
+inline
+__m256 get_leaf_weights(const __m256i &feature_values, const boost::int32_t threshold,
+                        const float weight_true_leaf, const float weight_false_leaf)
+{
+    // uses >= to be consistent with Markus Mathias code
+    return _mm256_blendv_ps(_mm256_set1_ps(weight_false_leaf), _mm256_set1_ps(weight_true_leaf),
+                            get_nodes_results(feature_values, threshold));
+}
+
+
+inline
+size_t SoftCascadeWindowsTileEvaluator::evaluate_tile(const boost::int32_t *window_p, const int xstride,
+                                                     float *scores_p, int *num_stages_evaluated_p) const
+{
+    const __m256i lanes_offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                                     _mm256_set1_epi32(xstride));
+    const __m256 rejected_score = _mm256_set1_ps(-1E5);
+
+    __m256 scores = _mm256_setzero_ps();
+    __m256i num_stages_evaluated = _mm256_setzero_si256();
+    __m256 active = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+
+    size_t stage_index = 0;
+    for(; stage_index < num_stages; stage_index += 1)
+    {
+        __m256 weights;
+        if(use_stumps)
+        {
+            const float *weights_p = leaves_weights_p + 2*stage_index;
+            weights = get_leaf_weights(get_features_values(window_p, stage_index, xstride, lanes_offsets),
+                                       nodes_thresholds_p[stage_index], weights_p[0], weights_p[1]);
+        }
+        else
+        {
+            const size_t node_index = 3*stage_index;
+            const float *weights_p = leaves_weights_p + 4*stage_index;
+            const __m256
+                    level1_is_true = get_nodes_results(
+                                         get_features_values(window_p, node_index, xstride, lanes_offsets),
+                                         nodes_thresholds_p[node_index]),
+                    level2_true_weights = get_leaf_weights(
+                                              get_features_values(window_p, node_index + 1, xstride, lanes_offsets),
+                                              nodes_thresholds_p[node_index + 1], weights_p[0], weights_p[1]),
+                    level2_false_weights = get_leaf_weights(
+                                               get_features_values(window_p, node_index + 2, xstride, lanes_offsets),
+                                               nodes_thresholds_p[node_index + 2], weights_p[2], weights_p[3]);
+
+            weights = _mm256_blendv_ps(level2_false_weights, level2_true_weights, level1_is_true);
+        }
+
+        // only the active windows are updated
+        scores = _mm256_blendv_ps(scores, _mm256_add_ps(scores, weights), active);
+        // active lanes are -1
+        num_stages_evaluated = _mm256_sub_epi32(num_stages_evaluated, _mm256_castps_si256(active));
+
+        if(use_the_detector_model_cascade)
+        {
+            const __m256 rejected =
+                    _mm256_and_ps(active, _mm256_cmp_ps(scores, _mm256_set1_ps(cascade_thresholds_p[stage_index]),
+                                                        _CMP_LT_OQ));
+            scores = _mm256_blendv_ps(scores, rejected_score, rejected);
+            active = _mm256_andnot_ps(rejected, active);
+
+            if(_mm256_movemask_ps(active) == 0)
+            {
+                // all the windows of the tile have been rejected
+                break;
+            }
+        }
+    } // end of "for each stage"
+
+    _mm256_storeu_ps(scores_p, scores);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(num_stages_evaluated_p), num_stages_evaluated);
+
+    // stage_index == num_stages if some window went through the whole cascade
+    return stage_index;
+}
+
+#else // SSE2 version
+
+inline
+__m128i SoftCascadeWindowsTileEvaluator::get_features_values(const boost::int32_t *window_p,
+                                                             const size_t node_index,
+                                                             const int xstride) const
+{
+    const boost::int32_t
+            *a_p = window_p + nodes_a_offsets[node_index], *b_p = window_p + nodes_b_offsets[node_index],
+            *c_p = window_p + nodes_c_offsets[node_index], *d_p = window_p + nodes_d_offsets[node_index];
+    const int x1 = xstride, x2 = 2*xstride, x3 = 3*xstride;
+
+    const __m128i
+            a = _mm_setr_epi32(a_p[0], a_p[x1], a_p[x2], a_p[x3]),
+            b = _mm_setr_epi32(b_p[0], b_p[x1], b_p[x2], b_p[x3]),
+            c = _mm_setr_epi32(c_p[0], c_p[x1], c_p[x2], c_p[x3]),
+            d = _mm_setr_epi32(d_p[0], d_p[x1], d_p[x2], d_p[x3]);
+
+    return _mm_sub_epi32(_mm_sub_epi32(_mm_add_epi32(a, c), b), d);
+}
+
+
+/// SSE2 has no blendv, we use and/andnot/or
+inline
+__m128 select_ps(const __m128 &mask, const __m128 &true_values, const __m128 &false_values)
+{
+    return _mm_or_ps(_mm_and_ps(mask, true_values), _mm_andnot_ps(mask, false_values));
+}
+
+
+/// (feature_values >= threshold), for integer thresholds above the int32 minimum
+inline
+__m128 get_nodes_results(const __m128i &feature_values, const boost::int32_t threshold)
+{
+    return _mm_castsi128_ps(_mm_cmpgt_epi32(feature_values, _mm_set1_epi32(threshold - 1)));
+}
+
+
+inline
+__m128 get_leaf_weights(const __m128i &feature_values, const boost::int32_t threshold,
+                        const float weight_true_leaf, const float weight_false_leaf)
+{
+    // uses >= to be consistent with Markus Mathias code
+    return select_ps(get_nodes_results(feature_values, threshold),
+                     _mm_set1_ps(weight_true_leaf), _mm_set1_ps(weight_false_leaf));
+}
+
+
+inline
+size_t SoftCascadeWindowsTileEvaluator::evaluate_tile(const boost::int32_t *window_p, const int xstride,
+                                                     float *scores_p, int *num_stages_evaluated_p) const
+{
+    const __m128 rejected_score = _mm_set1_ps(-1E5);
+
+    __m128 scores = _mm_setzero_ps();
+    __m128i num_stages_evaluated = _mm_setzero_si128();
+    __m128 active = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+    size_t stage_index = 0;
+    for(; stage_index < num_stages; stage_index += 1)
+    {
+        __m128 weights;
+        if(use_stumps)
+        {
+            const float *weights_p = leaves_weights_p + 2*stage_index;
+            weights = get_leaf_weights(get_features_values(window_p, stage_index, xstride),
+                                       nodes_thresholds_p[stage_index], weights_p[0], weights_p[1]);
+        }
+        else
+        {
+            const size_t node_index = 3*stage_index;
+            const float *weights_p = leaves_weights_p + 4*stage_index;
+            const __m128
+                    level1_is_true = get_nodes_results(get_features_values(window_p, node_index, xstride),
+                                                       nodes_thresholds_p[node_index]),
+                    level2_true_weights = get_leaf_weights(
+                                              get_features_values(window_p, node_index + 1, xstride),
+                                              nodes_thresholds_p[node_index + 1], weights_p[0], weights_p[1]),
+                    level2_false_weights = get_leaf_weights(
+                                               get_features_values(window_p, node_index + 2, xstride),
+                                               nodes_thresholds_p[node_index + 2], weights_p[2], weights_p[3]);
+
+            weights = select_ps(level1_is_true, level2_true_weights, level2_false_weights);
+        }
+
+        // only the active windows are updated
+        scores = select_ps(active, _mm_add_ps(scores, weights), scores);
+        // active lanes are -1
+        num_stages_evaluated = _mm_sub_epi32(num_stages_evaluated, _mm_castps_si128(active));
+
+        if(use_the_detector_model_cascade)
+        {
+            const __m128 rejected = _mm_and_ps(active, _mm_cmplt_ps(scores,
+                                                                    _mm_set1_ps(cascade_thresholds_p[stage_index])));
+            scores = select_ps(rejected, rejected_score, scores);
+            active = _mm_andnot_ps(rejected, active);
+
+            if(_mm_movemask_ps(active) == 0)
+            {
+                // all the windows of the tile have been rejected
+                break;
+            }
+        }
+    } // end of "for each stage"
+
+    _mm_storeu_ps(scores_p, scores);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(num_stages_evaluated_p), num_stages_evaluated);
+
+    // stage_index == num_stages if some window went through the whole cascade
+    return stage_index;
+}
+
+#endif // end of "if AVX2 else SSE2"
+
+
+inline
+size_t SoftCascadeWindowsTileEvaluator::operator()(const size_t row_index, const size_t col_index,
+                                                   const int xstride, const int num_windows,
+                                                   float *scores, int *num_stages_evaluated) const
+{
+    const boost::int32_t *window_p = channels_origin_p + row_index*row_stride + col_index;
+
+    if(num_windows == tile_size)
+    {
+        return evaluate_tile(window_p, xstride, scores, num_stages_evaluated);
+    }
+
+    // incomplete tile
+    size_t max_stages = 0;
+    for(int window_index = 0; window_index < num_windows; window_index += 1)
+    {
+        max_stages = std::max(max_stages,
+                              evaluate_window(window_p + window_index*xstride,
+                                              scores[window_index], num_stages_evaluated[window_index]));
+    }
+
+    return max_stages;
+}
+
+
+} // end of namespace doppia
+
+#endif // BICLOP_SOFTCASCADEWINDOWSTILEEVALUATOR_HPP
@@ -57,6 +57,16 @@ void VeryFastIntegralChannelsDetector::process_raw_detections()
 {
     const size_t num_raw_detections = detections.size();
 
+    if(streaming_nms_buffer_size > 0)
+    {
+        // the detections were already resized, filtered (and partially suppressed) by stream_raw_detections
+        log_info() << "number of detections (before non maximal suppression)  on this frame == "
+                   << num_raw_detections << " (after streaming suppression)" << std::endl;
+
+        compute_non_maximal_suppresion();
+        return;
+    }
+
     //recenter_detections(detections); // FIXME should be enabled
 
     // windows size adjustment should be done before non-maximal suppression
@@ -0,0 +1,1023 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: compiled_detector_model.proto
+
+#include "compiled_detector_model.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR CompiledSoftCascade::CompiledSoftCascade(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.nodes_channel_index_)*/{}
+  , /*decltype(_impl_._nodes_channel_index_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodes_min_x_)*/{}
+  , /*decltype(_impl_._nodes_min_x_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodes_min_y_)*/{}
+  , /*decltype(_impl_._nodes_min_y_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodes_max_x_)*/{}
+  , /*decltype(_impl_._nodes_max_x_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodes_max_y_)*/{}
+  , /*decltype(_impl_._nodes_max_y_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.nodes_threshold_)*/{}
+  , /*decltype(_impl_._nodes_threshold_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.leaves_weights_)*/{}
+  , /*decltype(_impl_.cascade_thresholds_)*/{}
+  , /*decltype(_impl_.relative_scale_)*/0
+  , /*decltype(_impl_.detection_window_width_)*/0u
+  , /*decltype(_impl_.detection_window_height_)*/0u
+  , /*decltype(_impl_.use_stumps_)*/false
+  , /*decltype(_impl_.source_checksum_)*/uint64_t{0u}} {}
+struct CompiledSoftCascadeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompiledSoftCascadeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompiledSoftCascadeDefaultTypeInternal() {}
+  union {
+    CompiledSoftCascade _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompiledSoftCascadeDefaultTypeInternal _CompiledSoftCascade_default_instance_;
+PROTOBUF_CONSTEXPR CompiledSoftCascadesModel::CompiledSoftCascadesModel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.cascades_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CompiledSoftCascadesModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CompiledSoftCascadesModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CompiledSoftCascadesModelDefaultTypeInternal() {}
+  union {
+    CompiledSoftCascadesModel _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CompiledSoftCascadesModelDefaultTypeInternal _CompiledSoftCascadesModel_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_compiled_5fdetector_5fmodel_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_compiled_5fdetector_5fmodel_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_compiled_5fdetector_5fmodel_2eproto = nullptr;
+
+const uint32_t TableStruct_compiled_5fdetector_5fmodel_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.relative_scale_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.detection_window_width_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.detection_window_height_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.use_stumps_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.source_checksum_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_channel_index_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_min_x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_min_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_max_x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_max_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.nodes_threshold_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.leaves_weights_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascade, _impl_.cascade_thresholds_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascadesModel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CompiledSoftCascadesModel, _impl_.cascades_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 19, -1, sizeof(::doppia_protobuf::CompiledSoftCascade)},
+  { 32, -1, -1, sizeof(::doppia_protobuf::CompiledSoftCascadesModel)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_CompiledSoftCascade_default_instance_._instance,
+  &::doppia_protobuf::_CompiledSoftCascadesModel_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_compiled_5fdetector_5fmodel_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\035compiled_detector_model.proto\022\017doppia_"
+  "protobuf\"\371\002\n\023CompiledSoftCascade\022\026\n\016rela"
+  "tive_scale\030\001 \002(\002\022\036\n\026detection_window_wid"
+  "th\030\002 \002(\r\022\037\n\027detection_window_height\030\003 \002("
+  "\r\022\022\n\nuse_stumps\030\004 \002(\010\022\027\n\017source_checksum"
+  "\030\005 \002(\004\022\037\n\023nodes_channel_index\030\n \003(\rB\002\020\001\022"
+  "\027\n\013nodes_min_x\030\013 \003(\005B\002\020\001\022\027\n\013nodes_min_y\030"
+  "\014 \003(\005B\002\020\001\022\027\n\013nodes_max_x\030\r \003(\005B\002\020\001\022\027\n\013no"
+  "des_max_y\030\016 \003(\005B\002\020\001\022\033\n\017nodes_threshold\030\017"
+  " \003(\005B\002\020\001\022\032\n\016leaves_weights\030\024 \003(\002B\002\020\001\022\036\n\022"
+  "cascade_thresholds\030\025 \003(\002B\002\020\001\"S\n\031Compiled"
+  "SoftCascadesModel\0226\n\010cascades\030\001 \003(\0132$.do"
+  "ppia_protobuf.CompiledSoftCascade"
+  ;
+static ::_pbi::once_flag descriptor_table_compiled_5fdetector_5fmodel_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_compiled_5fdetector_5fmodel_2eproto = {
+    false, false, 513, descriptor_table_protodef_compiled_5fdetector_5fmodel_2eproto,
+    "compiled_detector_model.proto",
+    &descriptor_table_compiled_5fdetector_5fmodel_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_compiled_5fdetector_5fmodel_2eproto::offsets,
+    file_level_metadata_compiled_5fdetector_5fmodel_2eproto, file_level_enum_descriptors_compiled_5fdetector_5fmodel_2eproto,
+    file_level_service_descriptors_compiled_5fdetector_5fmodel_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_compiled_5fdetector_5fmodel_2eproto_getter() {
+  return &descriptor_table_compiled_5fdetector_5fmodel_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_compiled_5fdetector_5fmodel_2eproto(&descriptor_table_compiled_5fdetector_5fmodel_2eproto);
+namespace doppia_protobuf {
+
+// ===================================================================
+
+class CompiledSoftCascade::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CompiledSoftCascade>()._impl_._has_bits_);
+  static void set_has_relative_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_detection_window_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_detection_window_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_use_stumps(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_source_checksum(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+CompiledSoftCascade::CompiledSoftCascade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.CompiledSoftCascade)
+}
+CompiledSoftCascade::CompiledSoftCascade(const CompiledSoftCascade& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompiledSoftCascade* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_channel_index_){from._impl_.nodes_channel_index_}
+    , /*decltype(_impl_._nodes_channel_index_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_min_x_){from._impl_.nodes_min_x_}
+    , /*decltype(_impl_._nodes_min_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_min_y_){from._impl_.nodes_min_y_}
+    , /*decltype(_impl_._nodes_min_y_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_max_x_){from._impl_.nodes_max_x_}
+    , /*decltype(_impl_._nodes_max_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_max_y_){from._impl_.nodes_max_y_}
+    , /*decltype(_impl_._nodes_max_y_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_threshold_){from._impl_.nodes_threshold_}
+    , /*decltype(_impl_._nodes_threshold_cached_byte_size_)*/{0}
+    , decltype(_impl_.leaves_weights_){from._impl_.leaves_weights_}
+    , decltype(_impl_.cascade_thresholds_){from._impl_.cascade_thresholds_}
+    , decltype(_impl_.relative_scale_){}
+    , decltype(_impl_.detection_window_width_){}
+    , decltype(_impl_.detection_window_height_){}
+    , decltype(_impl_.use_stumps_){}
+    , decltype(_impl_.source_checksum_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.relative_scale_, &from._impl_.relative_scale_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.source_checksum_) -
+    reinterpret_cast<char*>(&_impl_.relative_scale_)) + sizeof(_impl_.source_checksum_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.CompiledSoftCascade)
+}
+
+inline void CompiledSoftCascade::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.nodes_channel_index_){arena}
+    , /*decltype(_impl_._nodes_channel_index_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_min_x_){arena}
+    , /*decltype(_impl_._nodes_min_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_min_y_){arena}
+    , /*decltype(_impl_._nodes_min_y_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_max_x_){arena}
+    , /*decltype(_impl_._nodes_max_x_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_max_y_){arena}
+    , /*decltype(_impl_._nodes_max_y_cached_byte_size_)*/{0}
+    , decltype(_impl_.nodes_threshold_){arena}
+    , /*decltype(_impl_._nodes_threshold_cached_byte_size_)*/{0}
+    , decltype(_impl_.leaves_weights_){arena}
+    , decltype(_impl_.cascade_thresholds_){arena}
+    , decltype(_impl_.relative_scale_){0}
+    , decltype(_impl_.detection_window_width_){0u}
+    , decltype(_impl_.detection_window_height_){0u}
+    , decltype(_impl_.use_stumps_){false}
+    , decltype(_impl_.source_checksum_){uint64_t{0u}}
+  };
+}
+
+CompiledSoftCascade::~CompiledSoftCascade() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.CompiledSoftCascade)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompiledSoftCascade::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_channel_index_.~RepeatedField();
+  _impl_.nodes_min_x_.~RepeatedField();
+  _impl_.nodes_min_y_.~RepeatedField();
+  _impl_.nodes_max_x_.~RepeatedField();
+  _impl_.nodes_max_y_.~RepeatedField();
+  _impl_.nodes_threshold_.~RepeatedField();
+  _impl_.leaves_weights_.~RepeatedField();
+  _impl_.cascade_thresholds_.~RepeatedField();
+}
+
+void CompiledSoftCascade::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompiledSoftCascade::Clear() {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.CompiledSoftCascade)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_channel_index_.Clear();
+  _impl_.nodes_min_x_.Clear();
+  _impl_.nodes_min_y_.Clear();
+  _impl_.nodes_max_x_.Clear();
+  _impl_.nodes_max_y_.Clear();
+  _impl_.nodes_threshold_.Clear();
+  _impl_.leaves_weights_.Clear();
+  _impl_.cascade_thresholds_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.relative_scale_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.source_checksum_) -
+        reinterpret_cast<char*>(&_impl_.relative_scale_)) + sizeof(_impl_.source_checksum_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompiledSoftCascade::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required float relative_scale = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_relative_scale(&has_bits);
+          _impl_.relative_scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 detection_window_width = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_detection_window_width(&has_bits);
+          _impl_.detection_window_width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 detection_window_height = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_detection_window_height(&has_bits);
+          _impl_.detection_window_height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bool use_stumps = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_use_stumps(&has_bits);
+          _impl_.use_stumps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 source_checksum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_source_checksum(&has_bits);
+          _impl_.source_checksum_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 nodes_channel_index = 10 [packed = true];
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_nodes_channel_index(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_nodes_channel_index(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nodes_min_x = 11 [packed = true];
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nodes_min_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 88) {
+          _internal_add_nodes_min_x(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nodes_min_y = 12 [packed = true];
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nodes_min_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 96) {
+          _internal_add_nodes_min_y(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nodes_max_x = 13 [packed = true];
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nodes_max_x(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 104) {
+          _internal_add_nodes_max_x(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nodes_max_y = 14 [packed = true];
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nodes_max_y(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 112) {
+          _internal_add_nodes_max_y(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 nodes_threshold = 15 [packed = true];
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_nodes_threshold(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 120) {
+          _internal_add_nodes_threshold(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float leaves_weights = 20 [packed = true];
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_leaves_weights(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 165) {
+          _internal_add_leaves_weights(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float cascade_thresholds = 21 [packed = true];
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_cascade_thresholds(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 173) {
+          _internal_add_cascade_thresholds(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompiledSoftCascade::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.CompiledSoftCascade)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required float relative_scale = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_relative_scale(), target);
+  }
+
+  // required uint32 detection_window_width = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_detection_window_width(), target);
+  }
+
+  // required uint32 detection_window_height = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_detection_window_height(), target);
+  }
+
+  // required bool use_stumps = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_use_stumps(), target);
+  }
+
+  // required uint64 source_checksum = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_source_checksum(), target);
+  }
+
+  // repeated uint32 nodes_channel_index = 10 [packed = true];
+  {
+    int byte_size = _impl_._nodes_channel_index_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          10, _internal_nodes_channel_index(), byte_size, target);
+    }
+  }
+
+  // repeated int32 nodes_min_x = 11 [packed = true];
+  {
+    int byte_size = _impl_._nodes_min_x_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          11, _internal_nodes_min_x(), byte_size, target);
+    }
+  }
+
+  // repeated int32 nodes_min_y = 12 [packed = true];
+  {
+    int byte_size = _impl_._nodes_min_y_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          12, _internal_nodes_min_y(), byte_size, target);
+    }
+  }
+
+  // repeated int32 nodes_max_x = 13 [packed = true];
+  {
+    int byte_size = _impl_._nodes_max_x_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          13, _internal_nodes_max_x(), byte_size, target);
+    }
+  }
+
+  // repeated int32 nodes_max_y = 14 [packed = true];
+  {
+    int byte_size = _impl_._nodes_max_y_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          14, _internal_nodes_max_y(), byte_size, target);
+    }
+  }
+
+  // repeated int32 nodes_threshold = 15 [packed = true];
+  {
+    int byte_size = _impl_._nodes_threshold_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          15, _internal_nodes_threshold(), byte_size, target);
+    }
+  }
+
+  // repeated float leaves_weights = 20 [packed = true];
+  if (this->_internal_leaves_weights_size() > 0) {
+    target = stream->WriteFixedPacked(20, _internal_leaves_weights(), target);
+  }
+
+  // repeated float cascade_thresholds = 21 [packed = true];
+  if (this->_internal_cascade_thresholds_size() > 0) {
+    target = stream->WriteFixedPacked(21, _internal_cascade_thresholds(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.CompiledSoftCascade)
+  return target;
+}
+
+size_t CompiledSoftCascade::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.CompiledSoftCascade)
+  size_t total_size = 0;
+
+  if (_internal_has_relative_scale()) {
+    // required float relative_scale = 1;
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_detection_window_width()) {
+    // required uint32 detection_window_width = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_detection_window_width());
+  }
+
+  if (_internal_has_detection_window_height()) {
+    // required uint32 detection_window_height = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_detection_window_height());
+  }
+
+  if (_internal_has_use_stumps()) {
+    // required bool use_stumps = 4;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_source_checksum()) {
+    // required uint64 source_checksum = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_source_checksum());
+  }
+
+  return total_size;
+}
+size_t CompiledSoftCascade::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.CompiledSoftCascade)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required float relative_scale = 1;
+    total_size += 1 + 4;
+
+    // required uint32 detection_window_width = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_detection_window_width());
+
+    // required uint32 detection_window_height = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_detection_window_height());
+
+    // required bool use_stumps = 4;
+    total_size += 1 + 1;
+
+    // required uint64 source_checksum = 5;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_source_checksum());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 nodes_channel_index = 10 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.nodes_channel_index_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_channel_index_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 nodes_min_x = 11 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nodes_min_x_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_min_x_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 nodes_min_y = 12 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nodes_min_y_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_min_y_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 nodes_max_x = 13 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nodes_max_x_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_max_x_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 nodes_max_y = 14 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nodes_max_y_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_max_y_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 nodes_threshold = 15 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.nodes_threshold_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._nodes_threshold_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float leaves_weights = 20 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_leaves_weights_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated float cascade_thresholds = 21 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_cascade_thresholds_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompiledSoftCascade::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompiledSoftCascade::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompiledSoftCascade::GetClassData() const { return &_class_data_; }
+
+
+void CompiledSoftCascade::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompiledSoftCascade*>(&to_msg);
+  auto& from = static_cast<const CompiledSoftCascade&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.CompiledSoftCascade)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_channel_index_.MergeFrom(from._impl_.nodes_channel_index_);
+  _this->_impl_.nodes_min_x_.MergeFrom(from._impl_.nodes_min_x_);
+  _this->_impl_.nodes_min_y_.MergeFrom(from._impl_.nodes_min_y_);
+  _this->_impl_.nodes_max_x_.MergeFrom(from._impl_.nodes_max_x_);
+  _this->_impl_.nodes_max_y_.MergeFrom(from._impl_.nodes_max_y_);
+  _this->_impl_.nodes_threshold_.MergeFrom(from._impl_.nodes_threshold_);
+  _this->_impl_.leaves_weights_.MergeFrom(from._impl_.leaves_weights_);
+  _this->_impl_.cascade_thresholds_.MergeFrom(from._impl_.cascade_thresholds_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.relative_scale_ = from._impl_.relative_scale_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.detection_window_width_ = from._impl_.detection_window_width_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.detection_window_height_ = from._impl_.detection_window_height_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.use_stumps_ = from._impl_.use_stumps_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.source_checksum_ = from._impl_.source_checksum_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompiledSoftCascade::CopyFrom(const CompiledSoftCascade& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.CompiledSoftCascade)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompiledSoftCascade::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void CompiledSoftCascade::InternalSwap(CompiledSoftCascade* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.nodes_channel_index_.InternalSwap(&other->_impl_.nodes_channel_index_);
+  _impl_.nodes_min_x_.InternalSwap(&other->_impl_.nodes_min_x_);
+  _impl_.nodes_min_y_.InternalSwap(&other->_impl_.nodes_min_y_);
+  _impl_.nodes_max_x_.InternalSwap(&other->_impl_.nodes_max_x_);
+  _impl_.nodes_max_y_.InternalSwap(&other->_impl_.nodes_max_y_);
+  _impl_.nodes_threshold_.InternalSwap(&other->_impl_.nodes_threshold_);
+  _impl_.leaves_weights_.InternalSwap(&other->_impl_.leaves_weights_);
+  _impl_.cascade_thresholds_.InternalSwap(&other->_impl_.cascade_thresholds_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CompiledSoftCascade, _impl_.source_checksum_)
+      + sizeof(CompiledSoftCascade::_impl_.source_checksum_)
+      - PROTOBUF_FIELD_OFFSET(CompiledSoftCascade, _impl_.relative_scale_)>(
+          reinterpret_cast<char*>(&_impl_.relative_scale_),
+          reinterpret_cast<char*>(&other->_impl_.relative_scale_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompiledSoftCascade::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_compiled_5fdetector_5fmodel_2eproto_getter, &descriptor_table_compiled_5fdetector_5fmodel_2eproto_once,
+      file_level_metadata_compiled_5fdetector_5fmodel_2eproto[0]);
+}
+
+// ===================================================================
+
+class CompiledSoftCascadesModel::_Internal {
+ public:
+};
+
+CompiledSoftCascadesModel::CompiledSoftCascadesModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.CompiledSoftCascadesModel)
+}
+CompiledSoftCascadesModel::CompiledSoftCascadesModel(const CompiledSoftCascadesModel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CompiledSoftCascadesModel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cascades_){from._impl_.cascades_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.CompiledSoftCascadesModel)
+}
+
+inline void CompiledSoftCascadesModel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.cascades_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CompiledSoftCascadesModel::~CompiledSoftCascadesModel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.CompiledSoftCascadesModel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CompiledSoftCascadesModel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.cascades_.~RepeatedPtrField();
+}
+
+void CompiledSoftCascadesModel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CompiledSoftCascadesModel::Clear() {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.CompiledSoftCascadesModel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.cascades_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CompiledSoftCascadesModel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .doppia_protobuf.CompiledSoftCascade cascades = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_cascades(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CompiledSoftCascadesModel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.CompiledSoftCascadesModel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .doppia_protobuf.CompiledSoftCascade cascades = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_cascades_size()); i < n; i++) {
+    const auto& repfield = this->_internal_cascades(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.CompiledSoftCascadesModel)
+  return target;
+}
+
+size_t CompiledSoftCascadesModel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.CompiledSoftCascadesModel)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .doppia_protobuf.CompiledSoftCascade cascades = 1;
+  total_size += 1UL * this->_internal_cascades_size();
+  for (const auto& msg : this->_impl_.cascades_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CompiledSoftCascadesModel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CompiledSoftCascadesModel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CompiledSoftCascadesModel::GetClassData() const { return &_class_data_; }
+
+
+void CompiledSoftCascadesModel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CompiledSoftCascadesModel*>(&to_msg);
+  auto& from = static_cast<const CompiledSoftCascadesModel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.CompiledSoftCascadesModel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.cascades_.MergeFrom(from._impl_.cascades_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CompiledSoftCascadesModel::CopyFrom(const CompiledSoftCascadesModel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.CompiledSoftCascadesModel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CompiledSoftCascadesModel::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.cascades_))
+    return false;
+  return true;
+}
+
+void CompiledSoftCascadesModel::InternalSwap(CompiledSoftCascadesModel* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.cascades_.InternalSwap(&other->_impl_.cascades_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CompiledSoftCascadesModel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_compiled_5fdetector_5fmodel_2eproto_getter, &descriptor_table_compiled_5fdetector_5fmodel_2eproto_once,
+      file_level_metadata_compiled_5fdetector_5fmodel_2eproto[1]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::CompiledSoftCascade*
+Arena::CreateMaybeMessage< ::doppia_protobuf::CompiledSoftCascade >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::CompiledSoftCascade >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::CompiledSoftCascadesModel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::CompiledSoftCascadesModel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::CompiledSoftCascadesModel >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1230 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: compiled_detector_model.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_compiled_5fdetector_5fmodel_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_compiled_5fdetector_5fmodel_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_compiled_5fdetector_5fmodel_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_compiled_5fdetector_5fmodel_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_compiled_5fdetector_5fmodel_2eproto;
+namespace doppia_protobuf {
+class CompiledSoftCascade;
+struct CompiledSoftCascadeDefaultTypeInternal;
+extern CompiledSoftCascadeDefaultTypeInternal _CompiledSoftCascade_default_instance_;
+class CompiledSoftCascadesModel;
+struct CompiledSoftCascadesModelDefaultTypeInternal;
+extern CompiledSoftCascadesModelDefaultTypeInternal _CompiledSoftCascadesModel_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::CompiledSoftCascade* Arena::CreateMaybeMessage<::doppia_protobuf::CompiledSoftCascade>(Arena*);
+template<> ::doppia_protobuf::CompiledSoftCascadesModel* Arena::CreateMaybeMessage<::doppia_protobuf::CompiledSoftCascadesModel>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
+
+// ===================================================================
+
+class CompiledSoftCascade final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.CompiledSoftCascade) */ {
+ public:
+  inline CompiledSoftCascade() : CompiledSoftCascade(nullptr) {}
+  ~CompiledSoftCascade() override;
+  explicit PROTOBUF_CONSTEXPR CompiledSoftCascade(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompiledSoftCascade(const CompiledSoftCascade& from);
+  CompiledSoftCascade(CompiledSoftCascade&& from) noexcept
+    : CompiledSoftCascade() {
+    *this = ::std::move(from);
+  }
+
+  inline CompiledSoftCascade& operator=(const CompiledSoftCascade& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompiledSoftCascade& operator=(CompiledSoftCascade&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompiledSoftCascade& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompiledSoftCascade* internal_default_instance() {
+    return reinterpret_cast<const CompiledSoftCascade*>(
+               &_CompiledSoftCascade_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CompiledSoftCascade& a, CompiledSoftCascade& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompiledSoftCascade* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompiledSoftCascade* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompiledSoftCascade* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompiledSoftCascade>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompiledSoftCascade& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompiledSoftCascade& from) {
+    CompiledSoftCascade::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompiledSoftCascade* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.CompiledSoftCascade";
+  }
+  protected:
+  explicit CompiledSoftCascade(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesChannelIndexFieldNumber = 10,
+    kNodesMinXFieldNumber = 11,
+    kNodesMinYFieldNumber = 12,
+    kNodesMaxXFieldNumber = 13,
+    kNodesMaxYFieldNumber = 14,
+    kNodesThresholdFieldNumber = 15,
+    kLeavesWeightsFieldNumber = 20,
+    kCascadeThresholdsFieldNumber = 21,
+    kRelativeScaleFieldNumber = 1,
+    kDetectionWindowWidthFieldNumber = 2,
+    kDetectionWindowHeightFieldNumber = 3,
+    kUseStumpsFieldNumber = 4,
+    kSourceChecksumFieldNumber = 5,
+  };
+  // repeated uint32 nodes_channel_index = 10 [packed = true];
+  int nodes_channel_index_size() const;
+  private:
+  int _internal_nodes_channel_index_size() const;
+  public:
+  void clear_nodes_channel_index();
+  private:
+  uint32_t _internal_nodes_channel_index(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_nodes_channel_index() const;
+  void _internal_add_nodes_channel_index(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_nodes_channel_index();
+  public:
+  uint32_t nodes_channel_index(int index) const;
+  void set_nodes_channel_index(int index, uint32_t value);
+  void add_nodes_channel_index(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      nodes_channel_index() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_nodes_channel_index();
+
+  // repeated int32 nodes_min_x = 11 [packed = true];
+  int nodes_min_x_size() const;
+  private:
+  int _internal_nodes_min_x_size() const;
+  public:
+  void clear_nodes_min_x();
+  private:
+  int32_t _internal_nodes_min_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nodes_min_x() const;
+  void _internal_add_nodes_min_x(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nodes_min_x();
+  public:
+  int32_t nodes_min_x(int index) const;
+  void set_nodes_min_x(int index, int32_t value);
+  void add_nodes_min_x(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nodes_min_x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nodes_min_x();
+
+  // repeated int32 nodes_min_y = 12 [packed = true];
+  int nodes_min_y_size() const;
+  private:
+  int _internal_nodes_min_y_size() const;
+  public:
+  void clear_nodes_min_y();
+  private:
+  int32_t _internal_nodes_min_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nodes_min_y() const;
+  void _internal_add_nodes_min_y(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nodes_min_y();
+  public:
+  int32_t nodes_min_y(int index) const;
+  void set_nodes_min_y(int index, int32_t value);
+  void add_nodes_min_y(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nodes_min_y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nodes_min_y();
+
+  // repeated int32 nodes_max_x = 13 [packed = true];
+  int nodes_max_x_size() const;
+  private:
+  int _internal_nodes_max_x_size() const;
+  public:
+  void clear_nodes_max_x();
+  private:
+  int32_t _internal_nodes_max_x(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nodes_max_x() const;
+  void _internal_add_nodes_max_x(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nodes_max_x();
+  public:
+  int32_t nodes_max_x(int index) const;
+  void set_nodes_max_x(int index, int32_t value);
+  void add_nodes_max_x(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nodes_max_x() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nodes_max_x();
+
+  // repeated int32 nodes_max_y = 14 [packed = true];
+  int nodes_max_y_size() const;
+  private:
+  int _internal_nodes_max_y_size() const;
+  public:
+  void clear_nodes_max_y();
+  private:
+  int32_t _internal_nodes_max_y(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nodes_max_y() const;
+  void _internal_add_nodes_max_y(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nodes_max_y();
+  public:
+  int32_t nodes_max_y(int index) const;
+  void set_nodes_max_y(int index, int32_t value);
+  void add_nodes_max_y(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nodes_max_y() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nodes_max_y();
+
+  // repeated int32 nodes_threshold = 15 [packed = true];
+  int nodes_threshold_size() const;
+  private:
+  int _internal_nodes_threshold_size() const;
+  public:
+  void clear_nodes_threshold();
+  private:
+  int32_t _internal_nodes_threshold(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_nodes_threshold() const;
+  void _internal_add_nodes_threshold(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_nodes_threshold();
+  public:
+  int32_t nodes_threshold(int index) const;
+  void set_nodes_threshold(int index, int32_t value);
+  void add_nodes_threshold(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      nodes_threshold() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_nodes_threshold();
+
+  // repeated float leaves_weights = 20 [packed = true];
+  int leaves_weights_size() const;
+  private:
+  int _internal_leaves_weights_size() const;
+  public:
+  void clear_leaves_weights();
+  private:
+  float _internal_leaves_weights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_leaves_weights() const;
+  void _internal_add_leaves_weights(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_leaves_weights();
+  public:
+  float leaves_weights(int index) const;
+  void set_leaves_weights(int index, float value);
+  void add_leaves_weights(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      leaves_weights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_leaves_weights();
+
+  // repeated float cascade_thresholds = 21 [packed = true];
+  int cascade_thresholds_size() const;
+  private:
+  int _internal_cascade_thresholds_size() const;
+  public:
+  void clear_cascade_thresholds();
+  private:
+  float _internal_cascade_thresholds(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_cascade_thresholds() const;
+  void _internal_add_cascade_thresholds(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_cascade_thresholds();
+  public:
+  float cascade_thresholds(int index) const;
+  void set_cascade_thresholds(int index, float value);
+  void add_cascade_thresholds(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      cascade_thresholds() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_cascade_thresholds();
+
+  // required float relative_scale = 1;
+  bool has_relative_scale() const;
+  private:
+  bool _internal_has_relative_scale() const;
+  public:
+  void clear_relative_scale();
+  float relative_scale() const;
+  void set_relative_scale(float value);
+  private:
+  float _internal_relative_scale() const;
+  void _internal_set_relative_scale(float value);
+  public:
+
+  // required uint32 detection_window_width = 2;
+  bool has_detection_window_width() const;
+  private:
+  bool _internal_has_detection_window_width() const;
+  public:
+  void clear_detection_window_width();
+  uint32_t detection_window_width() const;
+  void set_detection_window_width(uint32_t value);
+  private:
+  uint32_t _internal_detection_window_width() const;
+  void _internal_set_detection_window_width(uint32_t value);
+  public:
+
+  // required uint32 detection_window_height = 3;
+  bool has_detection_window_height() const;
+  private:
+  bool _internal_has_detection_window_height() const;
+  public:
+  void clear_detection_window_height();
+  uint32_t detection_window_height() const;
+  void set_detection_window_height(uint32_t value);
+  private:
+  uint32_t _internal_detection_window_height() const;
+  void _internal_set_detection_window_height(uint32_t value);
+  public:
+
+  // required bool use_stumps = 4;
+  bool has_use_stumps() const;
+  private:
+  bool _internal_has_use_stumps() const;
+  public:
+  void clear_use_stumps();
+  bool use_stumps() const;
+  void set_use_stumps(bool value);
+  private:
+  bool _internal_use_stumps() const;
+  void _internal_set_use_stumps(bool value);
+  public:
+
+  // required uint64 source_checksum = 5;
+  bool has_source_checksum() const;
+  private:
+  bool _internal_has_source_checksum() const;
+  public:
+  void clear_source_checksum();
+  uint64_t source_checksum() const;
+  void set_source_checksum(uint64_t value);
+  private:
+  uint64_t _internal_source_checksum() const;
+  void _internal_set_source_checksum(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:doppia_protobuf.CompiledSoftCascade)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > nodes_channel_index_;
+    mutable std::atomic<int> _nodes_channel_index_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nodes_min_x_;
+    mutable std::atomic<int> _nodes_min_x_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nodes_min_y_;
+    mutable std::atomic<int> _nodes_min_y_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nodes_max_x_;
+    mutable std::atomic<int> _nodes_max_x_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nodes_max_y_;
+    mutable std::atomic<int> _nodes_max_y_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > nodes_threshold_;
+    mutable std::atomic<int> _nodes_threshold_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > leaves_weights_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > cascade_thresholds_;
+    float relative_scale_;
+    uint32_t detection_window_width_;
+    uint32_t detection_window_height_;
+    bool use_stumps_;
+    uint64_t source_checksum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_compiled_5fdetector_5fmodel_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CompiledSoftCascadesModel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.CompiledSoftCascadesModel) */ {
+ public:
+  inline CompiledSoftCascadesModel() : CompiledSoftCascadesModel(nullptr) {}
+  ~CompiledSoftCascadesModel() override;
+  explicit PROTOBUF_CONSTEXPR CompiledSoftCascadesModel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CompiledSoftCascadesModel(const CompiledSoftCascadesModel& from);
+  CompiledSoftCascadesModel(CompiledSoftCascadesModel&& from) noexcept
+    : CompiledSoftCascadesModel() {
+    *this = ::std::move(from);
+  }
+
+  inline CompiledSoftCascadesModel& operator=(const CompiledSoftCascadesModel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CompiledSoftCascadesModel& operator=(CompiledSoftCascadesModel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CompiledSoftCascadesModel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CompiledSoftCascadesModel* internal_default_instance() {
+    return reinterpret_cast<const CompiledSoftCascadesModel*>(
+               &_CompiledSoftCascadesModel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(CompiledSoftCascadesModel& a, CompiledSoftCascadesModel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CompiledSoftCascadesModel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CompiledSoftCascadesModel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CompiledSoftCascadesModel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CompiledSoftCascadesModel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CompiledSoftCascadesModel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CompiledSoftCascadesModel& from) {
+    CompiledSoftCascadesModel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CompiledSoftCascadesModel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.CompiledSoftCascadesModel";
+  }
+  protected:
+  explicit CompiledSoftCascadesModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCascadesFieldNumber = 1,
+  };
+  // repeated .doppia_protobuf.CompiledSoftCascade cascades = 1;
+  int cascades_size() const;
+  private:
+  int _internal_cascades_size() const;
+  public:
+  void clear_cascades();
+  ::doppia_protobuf::CompiledSoftCascade* mutable_cascades(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::CompiledSoftCascade >*
+      mutable_cascades();
+  private:
+  const ::doppia_protobuf::CompiledSoftCascade& _internal_cascades(int index) const;
+  ::doppia_protobuf::CompiledSoftCascade* _internal_add_cascades();
+  public:
+  const ::doppia_protobuf::CompiledSoftCascade& cascades(int index) const;
+  ::doppia_protobuf::CompiledSoftCascade* add_cascades();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::CompiledSoftCascade >&
+      cascades() const;
+
+  // @@protoc_insertion_point(class_scope:doppia_protobuf.CompiledSoftCascadesModel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::CompiledSoftCascade > cascades_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_compiled_5fdetector_5fmodel_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// CompiledSoftCascade
+
+// required float relative_scale = 1;
+inline bool CompiledSoftCascade::_internal_has_relative_scale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CompiledSoftCascade::has_relative_scale() const {
+  return _internal_has_relative_scale();
+}
+inline void CompiledSoftCascade::clear_relative_scale() {
+  _impl_.relative_scale_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CompiledSoftCascade::_internal_relative_scale() const {
+  return _impl_.relative_scale_;
+}
+inline float CompiledSoftCascade::relative_scale() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.relative_scale)
+  return _internal_relative_scale();
+}
+inline void CompiledSoftCascade::_internal_set_relative_scale(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.relative_scale_ = value;
+}
+inline void CompiledSoftCascade::set_relative_scale(float value) {
+  _internal_set_relative_scale(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.relative_scale)
+}
+
+// required uint32 detection_window_width = 2;
+inline bool CompiledSoftCascade::_internal_has_detection_window_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CompiledSoftCascade::has_detection_window_width() const {
+  return _internal_has_detection_window_width();
+}
+inline void CompiledSoftCascade::clear_detection_window_width() {
+  _impl_.detection_window_width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t CompiledSoftCascade::_internal_detection_window_width() const {
+  return _impl_.detection_window_width_;
+}
+inline uint32_t CompiledSoftCascade::detection_window_width() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.detection_window_width)
+  return _internal_detection_window_width();
+}
+inline void CompiledSoftCascade::_internal_set_detection_window_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.detection_window_width_ = value;
+}
+inline void CompiledSoftCascade::set_detection_window_width(uint32_t value) {
+  _internal_set_detection_window_width(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.detection_window_width)
+}
+
+// required uint32 detection_window_height = 3;
+inline bool CompiledSoftCascade::_internal_has_detection_window_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CompiledSoftCascade::has_detection_window_height() const {
+  return _internal_has_detection_window_height();
+}
+inline void CompiledSoftCascade::clear_detection_window_height() {
+  _impl_.detection_window_height_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t CompiledSoftCascade::_internal_detection_window_height() const {
+  return _impl_.detection_window_height_;
+}
+inline uint32_t CompiledSoftCascade::detection_window_height() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.detection_window_height)
+  return _internal_detection_window_height();
+}
+inline void CompiledSoftCascade::_internal_set_detection_window_height(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.detection_window_height_ = value;
+}
+inline void CompiledSoftCascade::set_detection_window_height(uint32_t value) {
+  _internal_set_detection_window_height(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.detection_window_height)
+}
+
+// required bool use_stumps = 4;
+inline bool CompiledSoftCascade::_internal_has_use_stumps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool CompiledSoftCascade::has_use_stumps() const {
+  return _internal_has_use_stumps();
+}
+inline void CompiledSoftCascade::clear_use_stumps() {
+  _impl_.use_stumps_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool CompiledSoftCascade::_internal_use_stumps() const {
+  return _impl_.use_stumps_;
+}
+inline bool CompiledSoftCascade::use_stumps() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.use_stumps)
+  return _internal_use_stumps();
+}
+inline void CompiledSoftCascade::_internal_set_use_stumps(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.use_stumps_ = value;
+}
+inline void CompiledSoftCascade::set_use_stumps(bool value) {
+  _internal_set_use_stumps(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.use_stumps)
+}
+
+// required uint64 source_checksum = 5;
+inline bool CompiledSoftCascade::_internal_has_source_checksum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool CompiledSoftCascade::has_source_checksum() const {
+  return _internal_has_source_checksum();
+}
+inline void CompiledSoftCascade::clear_source_checksum() {
+  _impl_.source_checksum_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t CompiledSoftCascade::_internal_source_checksum() const {
+  return _impl_.source_checksum_;
+}
+inline uint64_t CompiledSoftCascade::source_checksum() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.source_checksum)
+  return _internal_source_checksum();
+}
+inline void CompiledSoftCascade::_internal_set_source_checksum(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.source_checksum_ = value;
+}
+inline void CompiledSoftCascade::set_source_checksum(uint64_t value) {
+  _internal_set_source_checksum(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.source_checksum)
+}
+
+// repeated uint32 nodes_channel_index = 10 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_channel_index_size() const {
+  return _impl_.nodes_channel_index_.size();
+}
+inline int CompiledSoftCascade::nodes_channel_index_size() const {
+  return _internal_nodes_channel_index_size();
+}
+inline void CompiledSoftCascade::clear_nodes_channel_index() {
+  _impl_.nodes_channel_index_.Clear();
+}
+inline uint32_t CompiledSoftCascade::_internal_nodes_channel_index(int index) const {
+  return _impl_.nodes_channel_index_.Get(index);
+}
+inline uint32_t CompiledSoftCascade::nodes_channel_index(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_channel_index)
+  return _internal_nodes_channel_index(index);
+}
+inline void CompiledSoftCascade::set_nodes_channel_index(int index, uint32_t value) {
+  _impl_.nodes_channel_index_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_channel_index)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_channel_index(uint32_t value) {
+  _impl_.nodes_channel_index_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_channel_index(uint32_t value) {
+  _internal_add_nodes_channel_index(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_channel_index)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CompiledSoftCascade::_internal_nodes_channel_index() const {
+  return _impl_.nodes_channel_index_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+CompiledSoftCascade::nodes_channel_index() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_channel_index)
+  return _internal_nodes_channel_index();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_channel_index() {
+  return &_impl_.nodes_channel_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+CompiledSoftCascade::mutable_nodes_channel_index() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_channel_index)
+  return _internal_mutable_nodes_channel_index();
+}
+
+// repeated int32 nodes_min_x = 11 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_min_x_size() const {
+  return _impl_.nodes_min_x_.size();
+}
+inline int CompiledSoftCascade::nodes_min_x_size() const {
+  return _internal_nodes_min_x_size();
+}
+inline void CompiledSoftCascade::clear_nodes_min_x() {
+  _impl_.nodes_min_x_.Clear();
+}
+inline int32_t CompiledSoftCascade::_internal_nodes_min_x(int index) const {
+  return _impl_.nodes_min_x_.Get(index);
+}
+inline int32_t CompiledSoftCascade::nodes_min_x(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_min_x)
+  return _internal_nodes_min_x(index);
+}
+inline void CompiledSoftCascade::set_nodes_min_x(int index, int32_t value) {
+  _impl_.nodes_min_x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_min_x)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_min_x(int32_t value) {
+  _impl_.nodes_min_x_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_min_x(int32_t value) {
+  _internal_add_nodes_min_x(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_min_x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::_internal_nodes_min_x() const {
+  return _impl_.nodes_min_x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::nodes_min_x() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_min_x)
+  return _internal_nodes_min_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_min_x() {
+  return &_impl_.nodes_min_x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::mutable_nodes_min_x() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_min_x)
+  return _internal_mutable_nodes_min_x();
+}
+
+// repeated int32 nodes_min_y = 12 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_min_y_size() const {
+  return _impl_.nodes_min_y_.size();
+}
+inline int CompiledSoftCascade::nodes_min_y_size() const {
+  return _internal_nodes_min_y_size();
+}
+inline void CompiledSoftCascade::clear_nodes_min_y() {
+  _impl_.nodes_min_y_.Clear();
+}
+inline int32_t CompiledSoftCascade::_internal_nodes_min_y(int index) const {
+  return _impl_.nodes_min_y_.Get(index);
+}
+inline int32_t CompiledSoftCascade::nodes_min_y(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_min_y)
+  return _internal_nodes_min_y(index);
+}
+inline void CompiledSoftCascade::set_nodes_min_y(int index, int32_t value) {
+  _impl_.nodes_min_y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_min_y)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_min_y(int32_t value) {
+  _impl_.nodes_min_y_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_min_y(int32_t value) {
+  _internal_add_nodes_min_y(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_min_y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::_internal_nodes_min_y() const {
+  return _impl_.nodes_min_y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::nodes_min_y() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_min_y)
+  return _internal_nodes_min_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_min_y() {
+  return &_impl_.nodes_min_y_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::mutable_nodes_min_y() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_min_y)
+  return _internal_mutable_nodes_min_y();
+}
+
+// repeated int32 nodes_max_x = 13 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_max_x_size() const {
+  return _impl_.nodes_max_x_.size();
+}
+inline int CompiledSoftCascade::nodes_max_x_size() const {
+  return _internal_nodes_max_x_size();
+}
+inline void CompiledSoftCascade::clear_nodes_max_x() {
+  _impl_.nodes_max_x_.Clear();
+}
+inline int32_t CompiledSoftCascade::_internal_nodes_max_x(int index) const {
+  return _impl_.nodes_max_x_.Get(index);
+}
+inline int32_t CompiledSoftCascade::nodes_max_x(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_max_x)
+  return _internal_nodes_max_x(index);
+}
+inline void CompiledSoftCascade::set_nodes_max_x(int index, int32_t value) {
+  _impl_.nodes_max_x_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_max_x)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_max_x(int32_t value) {
+  _impl_.nodes_max_x_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_max_x(int32_t value) {
+  _internal_add_nodes_max_x(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_max_x)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::_internal_nodes_max_x() const {
+  return _impl_.nodes_max_x_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::nodes_max_x() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_max_x)
+  return _internal_nodes_max_x();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_max_x() {
+  return &_impl_.nodes_max_x_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::mutable_nodes_max_x() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_max_x)
+  return _internal_mutable_nodes_max_x();
+}
+
+// repeated int32 nodes_max_y = 14 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_max_y_size() const {
+  return _impl_.nodes_max_y_.size();
+}
+inline int CompiledSoftCascade::nodes_max_y_size() const {
+  return _internal_nodes_max_y_size();
+}
+inline void CompiledSoftCascade::clear_nodes_max_y() {
+  _impl_.nodes_max_y_.Clear();
+}
+inline int32_t CompiledSoftCascade::_internal_nodes_max_y(int index) const {
+  return _impl_.nodes_max_y_.Get(index);
+}
+inline int32_t CompiledSoftCascade::nodes_max_y(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_max_y)
+  return _internal_nodes_max_y(index);
+}
+inline void CompiledSoftCascade::set_nodes_max_y(int index, int32_t value) {
+  _impl_.nodes_max_y_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_max_y)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_max_y(int32_t value) {
+  _impl_.nodes_max_y_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_max_y(int32_t value) {
+  _internal_add_nodes_max_y(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_max_y)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::_internal_nodes_max_y() const {
+  return _impl_.nodes_max_y_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::nodes_max_y() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_max_y)
+  return _internal_nodes_max_y();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_max_y() {
+  return &_impl_.nodes_max_y_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::mutable_nodes_max_y() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_max_y)
+  return _internal_mutable_nodes_max_y();
+}
+
+// repeated int32 nodes_threshold = 15 [packed = true];
+inline int CompiledSoftCascade::_internal_nodes_threshold_size() const {
+  return _impl_.nodes_threshold_.size();
+}
+inline int CompiledSoftCascade::nodes_threshold_size() const {
+  return _internal_nodes_threshold_size();
+}
+inline void CompiledSoftCascade::clear_nodes_threshold() {
+  _impl_.nodes_threshold_.Clear();
+}
+inline int32_t CompiledSoftCascade::_internal_nodes_threshold(int index) const {
+  return _impl_.nodes_threshold_.Get(index);
+}
+inline int32_t CompiledSoftCascade::nodes_threshold(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.nodes_threshold)
+  return _internal_nodes_threshold(index);
+}
+inline void CompiledSoftCascade::set_nodes_threshold(int index, int32_t value) {
+  _impl_.nodes_threshold_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.nodes_threshold)
+}
+inline void CompiledSoftCascade::_internal_add_nodes_threshold(int32_t value) {
+  _impl_.nodes_threshold_.Add(value);
+}
+inline void CompiledSoftCascade::add_nodes_threshold(int32_t value) {
+  _internal_add_nodes_threshold(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.nodes_threshold)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::_internal_nodes_threshold() const {
+  return _impl_.nodes_threshold_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+CompiledSoftCascade::nodes_threshold() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.nodes_threshold)
+  return _internal_nodes_threshold();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::_internal_mutable_nodes_threshold() {
+  return &_impl_.nodes_threshold_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+CompiledSoftCascade::mutable_nodes_threshold() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.nodes_threshold)
+  return _internal_mutable_nodes_threshold();
+}
+
+// repeated float leaves_weights = 20 [packed = true];
+inline int CompiledSoftCascade::_internal_leaves_weights_size() const {
+  return _impl_.leaves_weights_.size();
+}
+inline int CompiledSoftCascade::leaves_weights_size() const {
+  return _internal_leaves_weights_size();
+}
+inline void CompiledSoftCascade::clear_leaves_weights() {
+  _impl_.leaves_weights_.Clear();
+}
+inline float CompiledSoftCascade::_internal_leaves_weights(int index) const {
+  return _impl_.leaves_weights_.Get(index);
+}
+inline float CompiledSoftCascade::leaves_weights(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.leaves_weights)
+  return _internal_leaves_weights(index);
+}
+inline void CompiledSoftCascade::set_leaves_weights(int index, float value) {
+  _impl_.leaves_weights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.leaves_weights)
+}
+inline void CompiledSoftCascade::_internal_add_leaves_weights(float value) {
+  _impl_.leaves_weights_.Add(value);
+}
+inline void CompiledSoftCascade::add_leaves_weights(float value) {
+  _internal_add_leaves_weights(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.leaves_weights)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+CompiledSoftCascade::_internal_leaves_weights() const {
+  return _impl_.leaves_weights_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+CompiledSoftCascade::leaves_weights() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.leaves_weights)
+  return _internal_leaves_weights();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+CompiledSoftCascade::_internal_mutable_leaves_weights() {
+  return &_impl_.leaves_weights_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+CompiledSoftCascade::mutable_leaves_weights() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.leaves_weights)
+  return _internal_mutable_leaves_weights();
+}
+
+// repeated float cascade_thresholds = 21 [packed = true];
+inline int CompiledSoftCascade::_internal_cascade_thresholds_size() const {
+  return _impl_.cascade_thresholds_.size();
+}
+inline int CompiledSoftCascade::cascade_thresholds_size() const {
+  return _internal_cascade_thresholds_size();
+}
+inline void CompiledSoftCascade::clear_cascade_thresholds() {
+  _impl_.cascade_thresholds_.Clear();
+}
+inline float CompiledSoftCascade::_internal_cascade_thresholds(int index) const {
+  return _impl_.cascade_thresholds_.Get(index);
+}
+inline float CompiledSoftCascade::cascade_thresholds(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascade.cascade_thresholds)
+  return _internal_cascade_thresholds(index);
+}
+inline void CompiledSoftCascade::set_cascade_thresholds(int index, float value) {
+  _impl_.cascade_thresholds_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CompiledSoftCascade.cascade_thresholds)
+}
+inline void CompiledSoftCascade::_internal_add_cascade_thresholds(float value) {
+  _impl_.cascade_thresholds_.Add(value);
+}
+inline void CompiledSoftCascade::add_cascade_thresholds(float value) {
+  _internal_add_cascade_thresholds(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascade.cascade_thresholds)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+CompiledSoftCascade::_internal_cascade_thresholds() const {
+  return _impl_.cascade_thresholds_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+CompiledSoftCascade::cascade_thresholds() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascade.cascade_thresholds)
+  return _internal_cascade_thresholds();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+CompiledSoftCascade::_internal_mutable_cascade_thresholds() {
+  return &_impl_.cascade_thresholds_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+CompiledSoftCascade::mutable_cascade_thresholds() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascade.cascade_thresholds)
+  return _internal_mutable_cascade_thresholds();
+}
+
+// -------------------------------------------------------------------
+
+// CompiledSoftCascadesModel
+
+// repeated .doppia_protobuf.CompiledSoftCascade cascades = 1;
+inline int CompiledSoftCascadesModel::_internal_cascades_size() const {
+  return _impl_.cascades_.size();
+}
+inline int CompiledSoftCascadesModel::cascades_size() const {
+  return _internal_cascades_size();
+}
+inline void CompiledSoftCascadesModel::clear_cascades() {
+  _impl_.cascades_.Clear();
+}
+inline ::doppia_protobuf::CompiledSoftCascade* CompiledSoftCascadesModel::mutable_cascades(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CompiledSoftCascadesModel.cascades)
+  return _impl_.cascades_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::CompiledSoftCascade >*
+CompiledSoftCascadesModel::mutable_cascades() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.CompiledSoftCascadesModel.cascades)
+  return &_impl_.cascades_;
+}
+inline const ::doppia_protobuf::CompiledSoftCascade& CompiledSoftCascadesModel::_internal_cascades(int index) const {
+  return _impl_.cascades_.Get(index);
+}
+inline const ::doppia_protobuf::CompiledSoftCascade& CompiledSoftCascadesModel::cascades(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CompiledSoftCascadesModel.cascades)
+  return _internal_cascades(index);
+}
+inline ::doppia_protobuf::CompiledSoftCascade* CompiledSoftCascadesModel::_internal_add_cascades() {
+  return _impl_.cascades_.Add();
+}
+inline ::doppia_protobuf::CompiledSoftCascade* CompiledSoftCascadesModel::add_cascades() {
+  ::doppia_protobuf::CompiledSoftCascade* _add = _internal_add_cascades();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.CompiledSoftCascadesModel.cascades)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::CompiledSoftCascade >&
+CompiledSoftCascadesModel::cascades() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.CompiledSoftCascadesModel.cascades)
+  return _impl_.cascades_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace doppia_protobuf
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_compiled_5fdetector_5fmodel_2eproto
@@ -1,1301 +1,1345 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: detections.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "detections.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Point2d_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Point2d_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Box_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Box_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Detection_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Detection_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Detection_ObjectClasses_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Detections_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Detections_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_detections_2eproto() {
-  protobuf_AddDesc_detections_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "detections.proto");
-  GOOGLE_CHECK(file != NULL);
-  Point2d_descriptor_ = file->message_type(0);
-  static const int Point2d_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Point2d, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Point2d, y_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR Point2d::Point2d(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.x_)*/0
+  , /*decltype(_impl_.y_)*/0} {}
+struct Point2dDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Point2dDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Point2dDefaultTypeInternal() {}
+  union {
+    Point2d _instance;
   };
-  Point2d_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Point2d_descriptor_,
-      Point2d::default_instance_,
-      Point2d_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Point2d, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Point2d, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Point2d));
-  Box_descriptor_ = file->message_type(1);
-  static const int Box_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Box, min_corner_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Box, max_corner_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Point2dDefaultTypeInternal _Point2d_default_instance_;
+PROTOBUF_CONSTEXPR Box::Box(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.min_corner_)*/nullptr
+  , /*decltype(_impl_.max_corner_)*/nullptr} {}
+struct BoxDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BoxDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BoxDefaultTypeInternal() {}
+  union {
+    Box _instance;
   };
-  Box_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Box_descriptor_,
-      Box::default_instance_,
-      Box_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Box, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Box, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Box));
-  Detection_descriptor_ = file->message_type(2);
-  static const int Detection_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detection, bounding_box_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detection, object_class_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detection, score_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BoxDefaultTypeInternal _Box_default_instance_;
+PROTOBUF_CONSTEXPR Detection::Detection(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.bounding_box_)*/nullptr
+  , /*decltype(_impl_.score_)*/0
+  , /*decltype(_impl_.object_class_)*/2} {}
+struct DetectionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectionDefaultTypeInternal() {}
+  union {
+    Detection _instance;
   };
-  Detection_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Detection_descriptor_,
-      Detection::default_instance_,
-      Detection_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detection, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detection, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Detection));
-  Detection_ObjectClasses_descriptor_ = Detection_descriptor_->enum_type(0);
-  Detections_descriptor_ = file->message_type(3);
-  static const int Detections_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detections, image_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detections, detections_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectionDefaultTypeInternal _Detection_default_instance_;
+PROTOBUF_CONSTEXPR Detections::Detections(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.detections_)*/{}
+  , /*decltype(_impl_.image_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct DetectionsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectionsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectionsDefaultTypeInternal() {}
+  union {
+    Detections _instance;
   };
-  Detections_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Detections_descriptor_,
-      Detections::default_instance_,
-      Detections_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detections, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Detections, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Detections));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_detections_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Point2d_descriptor_, &Point2d::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Box_descriptor_, &Box::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Detection_descriptor_, &Detection::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Detections_descriptor_, &Detections::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_detections_2eproto() {
-  delete Point2d::default_instance_;
-  delete Point2d_reflection_;
-  delete Box::default_instance_;
-  delete Box_reflection_;
-  delete Detection::default_instance_;
-  delete Detection_reflection_;
-  delete Detections::default_instance_;
-  delete Detections_reflection_;
-}
-
-void protobuf_AddDesc_detections_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\020detections.proto\022\017doppia_protobuf\"\037\n\007P"
-    "oint2d\022\t\n\001x\030\001 \002(\005\022\t\n\001y\030\002 \002(\005\"a\n\003Box\022,\n\nm"
-    "in_corner\030\001 \002(\0132\030.doppia_protobuf.Point2"
-    "d\022,\n\nmax_corner\030\002 \002(\0132\030.doppia_protobuf."
-    "Point2d\"\373\001\n\tDetection\022*\n\014bounding_box\030\001 "
-    "\002(\0132\024.doppia_protobuf.Box\022>\n\014object_clas"
-    "s\030\002 \002(\0162(.doppia_protobuf.Detection.Obje"
-    "ctClasses\022\r\n\005score\030\003 \001(\002\"s\n\rObjectClasse"
-    "s\022\007\n\003Car\020\002\022\016\n\nPedestrian\020\003\022\010\n\004Bike\020\005\022\r\n\t"
-    "Motorbike\020\006\022\007\n\003Bus\020\007\022\010\n\004Tram\020\010\022\020\n\014Static"
-    "Object\020\004\022\013\n\007Unknown\020\000\"P\n\nDetections\022\022\n\ni"
-    "mage_name\030\001 \001(\t\022.\n\ndetections\030\002 \003(\0132\032.do"
-    "ppia_protobuf.Detection", 503);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "detections.proto", &protobuf_RegisterTypes);
-  Point2d::default_instance_ = new Point2d();
-  Box::default_instance_ = new Box();
-  Detection::default_instance_ = new Detection();
-  Detections::default_instance_ = new Detections();
-  Point2d::default_instance_->InitAsDefaultInstance();
-  Box::default_instance_->InitAsDefaultInstance();
-  Detection::default_instance_->InitAsDefaultInstance();
-  Detections::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_detections_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_detections_2eproto {
-  StaticDescriptorInitializer_detections_2eproto() {
-    protobuf_AddDesc_detections_2eproto();
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectionsDefaultTypeInternal _Detections_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_detections_2eproto[4];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_detections_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_detections_2eproto = nullptr;
+
+const uint32_t TableStruct_detections_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Point2d, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Point2d, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Point2d, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Point2d, _impl_.y_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Box, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Box, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Box, _impl_.min_corner_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Box, _impl_.max_corner_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detection, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detection, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detection, _impl_.bounding_box_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detection, _impl_.object_class_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detection, _impl_.score_),
+  0,
+  2,
+  1,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detections, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detections, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detections, _impl_.image_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Detections, _impl_.detections_),
+  0,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::doppia_protobuf::Point2d)},
+  { 10, 18, -1, sizeof(::doppia_protobuf::Box)},
+  { 20, 29, -1, sizeof(::doppia_protobuf::Detection)},
+  { 32, 40, -1, sizeof(::doppia_protobuf::Detections)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_Point2d_default_instance_._instance,
+  &::doppia_protobuf::_Box_default_instance_._instance,
+  &::doppia_protobuf::_Detection_default_instance_._instance,
+  &::doppia_protobuf::_Detections_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_detections_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\020detections.proto\022\017doppia_protobuf\"\037\n\007P"
+  "oint2d\022\t\n\001x\030\001 \002(\005\022\t\n\001y\030\002 \002(\005\"a\n\003Box\022,\n\nm"
+  "in_corner\030\001 \002(\0132\030.doppia_protobuf.Point2"
+  "d\022,\n\nmax_corner\030\002 \002(\0132\030.doppia_protobuf."
+  "Point2d\"\373\001\n\tDetection\022*\n\014bounding_box\030\001 "
+  "\002(\0132\024.doppia_protobuf.Box\022>\n\014object_clas"
+  "s\030\002 \002(\0162(.doppia_protobuf.Detection.Obje"
+  "ctClasses\022\r\n\005score\030\003 \001(\002\"s\n\rObjectClasse"
+  "s\022\007\n\003Car\020\002\022\016\n\nPedestrian\020\003\022\010\n\004Bike\020\005\022\r\n\t"
+  "Motorbike\020\006\022\007\n\003Bus\020\007\022\010\n\004Tram\020\010\022\020\n\014Static"
+  "Object\020\004\022\013\n\007Unknown\020\000\"P\n\nDetections\022\022\n\ni"
+  "mage_name\030\001 \001(\t\022.\n\ndetections\030\002 \003(\0132\032.do"
+  "ppia_protobuf.Detection"
+  ;
+static ::_pbi::once_flag descriptor_table_detections_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_detections_2eproto = {
+    false, false, 503, descriptor_table_protodef_detections_2eproto,
+    "detections.proto",
+    &descriptor_table_detections_2eproto_once, nullptr, 0, 4,
+    schemas, file_default_instances, TableStruct_detections_2eproto::offsets,
+    file_level_metadata_detections_2eproto, file_level_enum_descriptors_detections_2eproto,
+    file_level_service_descriptors_detections_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_detections_2eproto_getter() {
+  return &descriptor_table_detections_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_detections_2eproto(&descriptor_table_detections_2eproto);
+namespace doppia_protobuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Detection_ObjectClasses_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_detections_2eproto);
+  return file_level_enum_descriptors_detections_2eproto[0];
+}
+bool Detection_ObjectClasses_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+      return true;
+    default:
+      return false;
   }
-} static_descriptor_initializer_detections_2eproto_;
+}
 
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Detection_ObjectClasses Detection::Car;
+constexpr Detection_ObjectClasses Detection::Pedestrian;
+constexpr Detection_ObjectClasses Detection::Bike;
+constexpr Detection_ObjectClasses Detection::Motorbike;
+constexpr Detection_ObjectClasses Detection::Bus;
+constexpr Detection_ObjectClasses Detection::Tram;
+constexpr Detection_ObjectClasses Detection::StaticObject;
+constexpr Detection_ObjectClasses Detection::Unknown;
+constexpr Detection_ObjectClasses Detection::ObjectClasses_MIN;
+constexpr Detection_ObjectClasses Detection::ObjectClasses_MAX;
+constexpr int Detection::ObjectClasses_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Point2d::kXFieldNumber;
-const int Point2d::kYFieldNumber;
-#endif  // !_MSC_VER
-
-Point2d::Point2d()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Point2d::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Point2d>()._impl_._has_bits_);
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void Point2d::InitAsDefaultInstance() {
+Point2d::Point2d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Point2d)
 }
-
 Point2d::Point2d(const Point2d& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Point2d::SharedCtor() {
-  _cached_size_ = 0;
-  x_ = 0;
-  y_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Point2d* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.x_, &from._impl_.x_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.y_) -
+    reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Point2d)
+}
+
+inline void Point2d::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.x_){0}
+    , decltype(_impl_.y_){0}
+  };
 }
 
 Point2d::~Point2d() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Point2d)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Point2d::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Point2d::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Point2d::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Point2d::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Point2d_descriptor_;
-}
-
-const Point2d& Point2d::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detections_2eproto();  return *default_instance_;
-}
-
-Point2d* Point2d::default_instance_ = NULL;
-
-Point2d* Point2d::New() const {
-  return new Point2d;
+  _impl_._cached_size_.Set(size);
 }
 
 void Point2d::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    x_ = 0;
-    y_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Point2d::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Point2d)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.x_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.y_) -
+        reinterpret_cast<char*>(&_impl_.x_)) + sizeof(_impl_.y_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Point2d::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 x = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &x_)));
-          set_has_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_y;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required int32 y = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &y_)));
-          set_has_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_y(&has_bits);
+          _impl_.y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Point2d::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Point2d::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Point2d)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 x = 1;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->x(), output);
-  }
-  
-  // required int32 y = 2;
-  if (has_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(2, this->y(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_x(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* Point2d::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 x = 1;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->x(), target);
-  }
-  
   // required int32 y = 2;
-  if (has_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(2, this->y(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_y(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Point2d)
   return target;
 }
 
-int Point2d::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t Point2d::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Point2d)
+  size_t total_size = 0;
+
+  if (_internal_has_x()) {
     // required int32 x = 1;
-    if (has_x()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->x());
-    }
-    
-    // required int32 y = 2;
-    if (has_y()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->y());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_y()) {
+    // required int32 y = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t Point2d::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Point2d)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required int32 x = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_x());
+
+    // required int32 y = 2;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_y());
 
-void Point2d::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Point2d* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Point2d*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Point2d::MergeFrom(const Point2d& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_x()) {
-      set_x(from.x());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Point2d::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Point2d::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Point2d::GetClassData() const { return &_class_data_; }
+
+
+void Point2d::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Point2d*>(&to_msg);
+  auto& from = static_cast<const Point2d&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Point2d)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_y()) {
-      set_y(from.y());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.y_ = from._impl_.y_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Point2d::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Point2d::CopyFrom(const Point2d& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Point2d)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Point2d::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Point2d::Swap(Point2d* other) {
-  if (other != this) {
-    std::swap(x_, other->x_);
-    std::swap(y_, other->y_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Point2d::InternalSwap(Point2d* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Point2d, _impl_.y_)
+      + sizeof(Point2d::_impl_.y_)
+      - PROTOBUF_FIELD_OFFSET(Point2d, _impl_.x_)>(
+          reinterpret_cast<char*>(&_impl_.x_),
+          reinterpret_cast<char*>(&other->_impl_.x_));
 }
 
-::google::protobuf::Metadata Point2d::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Point2d_descriptor_;
-  metadata.reflection = Point2d_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Point2d::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detections_2eproto_getter, &descriptor_table_detections_2eproto_once,
+      file_level_metadata_detections_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Box::kMinCornerFieldNumber;
-const int Box::kMaxCornerFieldNumber;
-#endif  // !_MSC_VER
+class Box::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Box>()._impl_._has_bits_);
+  static const ::doppia_protobuf::Point2d& min_corner(const Box* msg);
+  static void set_has_min_corner(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::Point2d& max_corner(const Box* msg);
+  static void set_has_max_corner(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-Box::Box()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::Point2d&
+Box::_Internal::min_corner(const Box* msg) {
+  return *msg->_impl_.min_corner_;
 }
-
-void Box::InitAsDefaultInstance() {
-  min_corner_ = const_cast< ::doppia_protobuf::Point2d*>(&::doppia_protobuf::Point2d::default_instance());
-  max_corner_ = const_cast< ::doppia_protobuf::Point2d*>(&::doppia_protobuf::Point2d::default_instance());
+const ::doppia_protobuf::Point2d&
+Box::_Internal::max_corner(const Box* msg) {
+  return *msg->_impl_.max_corner_;
 }
-
-Box::Box(const Box& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+Box::Box(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Box)
 }
-
-void Box::SharedCtor() {
-  _cached_size_ = 0;
-  min_corner_ = NULL;
-  max_corner_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+Box::Box(const Box& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Box* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_corner_){nullptr}
+    , decltype(_impl_.max_corner_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_min_corner()) {
+    _this->_impl_.min_corner_ = new ::doppia_protobuf::Point2d(*from._impl_.min_corner_);
+  }
+  if (from._internal_has_max_corner()) {
+    _this->_impl_.max_corner_ = new ::doppia_protobuf::Point2d(*from._impl_.max_corner_);
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Box)
+}
+
+inline void Box::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.min_corner_){nullptr}
+    , decltype(_impl_.max_corner_){nullptr}
+  };
 }
 
 Box::~Box() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Box)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Box::SharedDtor() {
-  if (this != default_instance_) {
-    delete min_corner_;
-    delete max_corner_;
-  }
+inline void Box::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.min_corner_;
+  if (this != internal_default_instance()) delete _impl_.max_corner_;
 }
 
 void Box::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Box::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Box_descriptor_;
-}
-
-const Box& Box::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detections_2eproto();  return *default_instance_;
-}
-
-Box* Box::default_instance_ = NULL;
-
-Box* Box::New() const {
-  return new Box;
+  _impl_._cached_size_.Set(size);
 }
 
 void Box::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_min_corner()) {
-      if (min_corner_ != NULL) min_corner_->::doppia_protobuf::Point2d::Clear();
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Box)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.min_corner_ != nullptr);
+      _impl_.min_corner_->Clear();
     }
-    if (has_max_corner()) {
-      if (max_corner_ != NULL) max_corner_->::doppia_protobuf::Point2d::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.max_corner_ != nullptr);
+      _impl_.max_corner_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Box::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Box::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .doppia_protobuf.Point2d min_corner = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_min_corner()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_max_corner;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_min_corner(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.Point2d max_corner = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_max_corner:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_max_corner()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_max_corner(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Box::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Box::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Box)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .doppia_protobuf.Point2d min_corner = 1;
-  if (has_min_corner()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->min_corner(), output);
-  }
-  
-  // required .doppia_protobuf.Point2d max_corner = 2;
-  if (has_max_corner()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->max_corner(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::min_corner(this),
+        _Internal::min_corner(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* Box::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .doppia_protobuf.Point2d min_corner = 1;
-  if (has_min_corner()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->min_corner(), target);
-  }
-  
   // required .doppia_protobuf.Point2d max_corner = 2;
-  if (has_max_corner()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->max_corner(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::max_corner(this),
+        _Internal::max_corner(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Box)
   return target;
 }
 
-int Box::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t Box::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Box)
+  size_t total_size = 0;
+
+  if (_internal_has_min_corner()) {
     // required .doppia_protobuf.Point2d min_corner = 1;
-    if (has_min_corner()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->min_corner());
-    }
-    
-    // required .doppia_protobuf.Point2d max_corner = 2;
-    if (has_max_corner()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->max_corner());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_corner_);
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_max_corner()) {
+    // required .doppia_protobuf.Point2d max_corner = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_corner_);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t Box::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Box)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .doppia_protobuf.Point2d min_corner = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.min_corner_);
+
+    // required .doppia_protobuf.Point2d max_corner = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.max_corner_);
 
-void Box::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Box* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Box*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Box::MergeFrom(const Box& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_min_corner()) {
-      mutable_min_corner()->::doppia_protobuf::Point2d::MergeFrom(from.min_corner());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Box::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Box::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Box::GetClassData() const { return &_class_data_; }
+
+
+void Box::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Box*>(&to_msg);
+  auto& from = static_cast<const Box&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Box)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_min_corner()->::doppia_protobuf::Point2d::MergeFrom(
+          from._internal_min_corner());
     }
-    if (from.has_max_corner()) {
-      mutable_max_corner()->::doppia_protobuf::Point2d::MergeFrom(from.max_corner());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_max_corner()->::doppia_protobuf::Point2d::MergeFrom(
+          from._internal_max_corner());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Box::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Box::CopyFrom(const Box& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Box)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Box::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_min_corner()) {
-    if (!this->min_corner().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_min_corner()) {
+    if (!_impl_.min_corner_->IsInitialized()) return false;
   }
-  if (has_max_corner()) {
-    if (!this->max_corner().IsInitialized()) return false;
+  if (_internal_has_max_corner()) {
+    if (!_impl_.max_corner_->IsInitialized()) return false;
   }
   return true;
 }
 
-void Box::Swap(Box* other) {
-  if (other != this) {
-    std::swap(min_corner_, other->min_corner_);
-    std::swap(max_corner_, other->max_corner_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Box::InternalSwap(Box* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Box, _impl_.max_corner_)
+      + sizeof(Box::_impl_.max_corner_)
+      - PROTOBUF_FIELD_OFFSET(Box, _impl_.min_corner_)>(
+          reinterpret_cast<char*>(&_impl_.min_corner_),
+          reinterpret_cast<char*>(&other->_impl_.min_corner_));
 }
 
-::google::protobuf::Metadata Box::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Box_descriptor_;
-  metadata.reflection = Box_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Box::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detections_2eproto_getter, &descriptor_table_detections_2eproto_once,
+      file_level_metadata_detections_2eproto[1]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Detection_ObjectClasses_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Detection_ObjectClasses_descriptor_;
-}
-bool Detection_ObjectClasses_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 2:
-    case 3:
-    case 4:
-    case 5:
-    case 6:
-    case 7:
-    case 8:
-      return true;
-    default:
-      return false;
+class Detection::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Detection>()._impl_._has_bits_);
+  static const ::doppia_protobuf::Box& bounding_box(const Detection* msg);
+  static void set_has_bounding_box(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const Detection_ObjectClasses Detection::Car;
-const Detection_ObjectClasses Detection::Pedestrian;
-const Detection_ObjectClasses Detection::Bike;
-const Detection_ObjectClasses Detection::Motorbike;
-const Detection_ObjectClasses Detection::Bus;
-const Detection_ObjectClasses Detection::Tram;
-const Detection_ObjectClasses Detection::StaticObject;
-const Detection_ObjectClasses Detection::Unknown;
-const Detection_ObjectClasses Detection::ObjectClasses_MIN;
-const Detection_ObjectClasses Detection::ObjectClasses_MAX;
-const int Detection::ObjectClasses_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Detection::kBoundingBoxFieldNumber;
-const int Detection::kObjectClassFieldNumber;
-const int Detection::kScoreFieldNumber;
-#endif  // !_MSC_VER
+  static void set_has_object_class(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_score(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+  }
+};
 
-Detection::Detection()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::Box&
+Detection::_Internal::bounding_box(const Detection* msg) {
+  return *msg->_impl_.bounding_box_;
 }
-
-void Detection::InitAsDefaultInstance() {
-  bounding_box_ = const_cast< ::doppia_protobuf::Box*>(&::doppia_protobuf::Box::default_instance());
+Detection::Detection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Detection)
 }
-
 Detection::Detection(const Detection& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Detection::SharedCtor() {
-  _cached_size_ = 0;
-  bounding_box_ = NULL;
-  object_class_ = 2;
-  score_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Detection* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bounding_box_){nullptr}
+    , decltype(_impl_.score_){}
+    , decltype(_impl_.object_class_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_bounding_box()) {
+    _this->_impl_.bounding_box_ = new ::doppia_protobuf::Box(*from._impl_.bounding_box_);
+  }
+  ::memcpy(&_impl_.score_, &from._impl_.score_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.object_class_) -
+    reinterpret_cast<char*>(&_impl_.score_)) + sizeof(_impl_.object_class_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Detection)
+}
+
+inline void Detection::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.bounding_box_){nullptr}
+    , decltype(_impl_.score_){0}
+    , decltype(_impl_.object_class_){2}
+  };
 }
 
 Detection::~Detection() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Detection)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Detection::SharedDtor() {
-  if (this != default_instance_) {
-    delete bounding_box_;
-  }
+inline void Detection::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.bounding_box_;
 }
 
 void Detection::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Detection::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Detection_descriptor_;
-}
-
-const Detection& Detection::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detections_2eproto();  return *default_instance_;
-}
-
-Detection* Detection::default_instance_ = NULL;
-
-Detection* Detection::New() const {
-  return new Detection;
+  _impl_._cached_size_.Set(size);
 }
 
 void Detection::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_bounding_box()) {
-      if (bounding_box_ != NULL) bounding_box_->::doppia_protobuf::Box::Clear();
-    }
-    object_class_ = 2;
-    score_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Detection::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Detection)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.bounding_box_ != nullptr);
+    _impl_.bounding_box_->Clear();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    _impl_.score_ = 0;
+    _impl_.object_class_ = 2;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Detection::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .doppia_protobuf.Box bounding_box = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_bounding_box()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_object_class;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bounding_box(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_object_class:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::doppia_protobuf::Detection_ObjectClasses_IsValid(value)) {
-            set_object_class(static_cast< ::doppia_protobuf::Detection_ObjectClasses >(value));
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::doppia_protobuf::Detection_ObjectClasses_IsValid(val))) {
+            _internal_set_object_class(static_cast<::doppia_protobuf::Detection_ObjectClasses>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(2, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_score;
-        break;
-      }
-      
+        } else
+          goto handle_unusual;
+        continue;
       // optional float score = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_score:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &score_)));
-          set_has_score();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_score(&has_bits);
+          _impl_.score_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Detection::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Detection::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Detection)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .doppia_protobuf.Box bounding_box = 1;
-  if (has_bounding_box()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->bounding_box(), output);
-  }
-  
-  // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-  if (has_object_class()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      2, this->object_class(), output);
-  }
-  
-  // optional float score = 3;
-  if (has_score()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->score(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::bounding_box(this),
+        _Internal::bounding_box(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* Detection::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .doppia_protobuf.Box bounding_box = 1;
-  if (has_bounding_box()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->bounding_box(), target);
-  }
-  
   // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-  if (has_object_class()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      2, this->object_class(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_object_class(), target);
   }
-  
+
   // optional float score = 3;
-  if (has_score()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->score(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_score(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Detection)
   return target;
 }
 
-int Detection::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t Detection::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Detection)
+  size_t total_size = 0;
+
+  if (_internal_has_bounding_box()) {
     // required .doppia_protobuf.Box bounding_box = 1;
-    if (has_bounding_box()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->bounding_box());
-    }
-    
-    // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-    if (has_object_class()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->object_class());
-    }
-    
-    // optional float score = 3;
-    if (has_score()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bounding_box_);
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_object_class()) {
+    // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_object_class());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t Detection::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Detection)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
+    // required .doppia_protobuf.Box bounding_box = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bounding_box_);
+
+    // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_object_class());
 
-void Detection::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Detection* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Detection*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float score = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Detection::MergeFrom(const Detection& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_bounding_box()) {
-      mutable_bounding_box()->::doppia_protobuf::Box::MergeFrom(from.bounding_box());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Detection::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Detection::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Detection::GetClassData() const { return &_class_data_; }
+
+
+void Detection::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Detection*>(&to_msg);
+  auto& from = static_cast<const Detection&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Detection)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_bounding_box()->::doppia_protobuf::Box::MergeFrom(
+          from._internal_bounding_box());
     }
-    if (from.has_object_class()) {
-      set_object_class(from.object_class());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.score_ = from._impl_.score_;
     }
-    if (from.has_score()) {
-      set_score(from.score());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.object_class_ = from._impl_.object_class_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Detection::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Detection::CopyFrom(const Detection& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Detection)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Detection::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_bounding_box()) {
-    if (!this->bounding_box().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_bounding_box()) {
+    if (!_impl_.bounding_box_->IsInitialized()) return false;
   }
   return true;
 }
 
-void Detection::Swap(Detection* other) {
-  if (other != this) {
-    std::swap(bounding_box_, other->bounding_box_);
-    std::swap(object_class_, other->object_class_);
-    std::swap(score_, other->score_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Detection::InternalSwap(Detection* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Detection, _impl_.score_)
+      + sizeof(Detection::_impl_.score_)
+      - PROTOBUF_FIELD_OFFSET(Detection, _impl_.bounding_box_)>(
+          reinterpret_cast<char*>(&_impl_.bounding_box_),
+          reinterpret_cast<char*>(&other->_impl_.bounding_box_));
+  swap(_impl_.object_class_, other->_impl_.object_class_);
 }
 
-::google::protobuf::Metadata Detection::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Detection_descriptor_;
-  metadata.reflection = Detection_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Detection::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detections_2eproto_getter, &descriptor_table_detections_2eproto_once,
+      file_level_metadata_detections_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Detections::kImageNameFieldNumber;
-const int Detections::kDetectionsFieldNumber;
-#endif  // !_MSC_VER
-
-Detections::Detections()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Detections::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Detections>()._impl_._has_bits_);
+  static void set_has_image_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void Detections::InitAsDefaultInstance() {
+Detections::Detections(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Detections)
 }
-
 Detections::Detections(const Detections& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Detections::SharedCtor() {
-  _cached_size_ = 0;
-  image_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Detections* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detections_){from._impl_.detections_}
+    , decltype(_impl_.image_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.image_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_image_name()) {
+    _this->_impl_.image_name_.Set(from._internal_image_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Detections)
+}
+
+inline void Detections::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detections_){arena}
+    , decltype(_impl_.image_name_){}
+  };
+  _impl_.image_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Detections::~Detections() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Detections)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Detections::SharedDtor() {
-  if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete image_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Detections::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.detections_.~RepeatedPtrField();
+  _impl_.image_name_.Destroy();
 }
 
 void Detections::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Detections::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Detections_descriptor_;
-}
-
-const Detections& Detections::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detections_2eproto();  return *default_instance_;
-}
-
-Detections* Detections::default_instance_ = NULL;
-
-Detections* Detections::New() const {
-  return new Detections;
+  _impl_._cached_size_.Set(size);
 }
 
 void Detections::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_image_name()) {
-      if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-        image_name_->clear();
-      }
-    }
-  }
-  detections_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Detections::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Detections)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.detections_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.image_name_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Detections::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string image_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_image_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->image_name().data(), this->image_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_detections;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_image_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.Detections.image_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .doppia_protobuf.Detection detections = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_detections:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_detections()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_detections;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_detections(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Detections::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Detections::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Detections)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string image_name = 1;
-  if (has_image_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->image_name().data(), this->image_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->image_name(), output);
-  }
-  
-  // repeated .doppia_protobuf.Detection detections = 2;
-  for (int i = 0; i < this->detections_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->detections(i), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_image_name().data(), static_cast<int>(this->_internal_image_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.Detections.image_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_image_name(), target);
   }
-}
 
-::google::protobuf::uint8* Detections::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string image_name = 1;
-  if (has_image_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->image_name().data(), this->image_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->image_name(), target);
-  }
-  
   // repeated .doppia_protobuf.Detection detections = 2;
-  for (int i = 0; i < this->detections_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->detections(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_detections_size()); i < n; i++) {
+    const auto& repfield = this->_internal_detections(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Detections)
   return target;
 }
 
-int Detections::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string image_name = 1;
-    if (has_image_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->image_name());
-    }
-    
-  }
+size_t Detections::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Detections)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.Detection detections = 2;
-  total_size += 1 * this->detections_size();
-  for (int i = 0; i < this->detections_size(); i++) {
+  total_size += 1UL * this->_internal_detections_size();
+  for (const auto& msg : this->_impl_.detections_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->detections(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Detections::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Detections* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Detections*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional string image_name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_image_name());
   }
-}
 
-void Detections::MergeFrom(const Detections& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  detections_.MergeFrom(from.detections_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_image_name()) {
-      set_image_name(from.image_name());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Detections::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Detections::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Detections::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Detections::GetClassData() const { return &_class_data_; }
+
+
+void Detections::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Detections*>(&to_msg);
+  auto& from = static_cast<const Detections&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Detections)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.detections_.MergeFrom(from._impl_.detections_);
+  if (from._internal_has_image_name()) {
+    _this->_internal_set_image_name(from._internal_image_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Detections::CopyFrom(const Detections& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Detections)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Detections::IsInitialized() const {
-  
-  for (int i = 0; i < detections_size(); i++) {
-    if (!this->detections(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.detections_))
+    return false;
   return true;
 }
 
-void Detections::Swap(Detections* other) {
-  if (other != this) {
-    std::swap(image_name_, other->image_name_);
-    detections_.Swap(&other->detections_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Detections::InternalSwap(Detections* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.detections_.InternalSwap(&other->_impl_.detections_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_name_, lhs_arena,
+      &other->_impl_.image_name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata Detections::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Detections_descriptor_;
-  metadata.reflection = Detections_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Detections::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detections_2eproto_getter, &descriptor_table_detections_2eproto_once,
+      file_level_metadata_detections_2eproto[3]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Point2d*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Point2d >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Point2d >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Box*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Box >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Box >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Detection*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Detection >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Detection >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Detections*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Detections >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Detections >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
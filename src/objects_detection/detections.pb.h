@@ -1,43 +1,73 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: detections.proto
 
-#ifndef PROTOBUF_detections_2eproto__INCLUDED
-#define PROTOBUF_detections_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_detections_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_detections_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_detections_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_detections_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_detections_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_detections_2eproto();
-void protobuf_AssignDesc_detections_2eproto();
-void protobuf_ShutdownFile_detections_2eproto();
-
-class Point2d;
 class Box;
+struct BoxDefaultTypeInternal;
+extern BoxDefaultTypeInternal _Box_default_instance_;
 class Detection;
+struct DetectionDefaultTypeInternal;
+extern DetectionDefaultTypeInternal _Detection_default_instance_;
 class Detections;
+struct DetectionsDefaultTypeInternal;
+extern DetectionsDefaultTypeInternal _Detections_default_instance_;
+class Point2d;
+struct Point2dDefaultTypeInternal;
+extern Point2dDefaultTypeInternal _Point2d_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::Box* Arena::CreateMaybeMessage<::doppia_protobuf::Box>(Arena*);
+template<> ::doppia_protobuf::Detection* Arena::CreateMaybeMessage<::doppia_protobuf::Detection>(Arena*);
+template<> ::doppia_protobuf::Detections* Arena::CreateMaybeMessage<::doppia_protobuf::Detections>(Arena*);
+template<> ::doppia_protobuf::Point2d* Arena::CreateMaybeMessage<::doppia_protobuf::Point2d>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
-enum Detection_ObjectClasses {
+enum Detection_ObjectClasses : int {
   Detection_ObjectClasses_Car = 2,
   Detection_ObjectClasses_Pedestrian = 3,
   Detection_ObjectClasses_Bike = 5,
@@ -48,487 +78,880 @@ enum Detection_ObjectClasses {
   Detection_ObjectClasses_Unknown = 0
 };
 bool Detection_ObjectClasses_IsValid(int value);
-const Detection_ObjectClasses Detection_ObjectClasses_ObjectClasses_MIN = Detection_ObjectClasses_Unknown;
-const Detection_ObjectClasses Detection_ObjectClasses_ObjectClasses_MAX = Detection_ObjectClasses_Tram;
-const int Detection_ObjectClasses_ObjectClasses_ARRAYSIZE = Detection_ObjectClasses_ObjectClasses_MAX + 1;
+constexpr Detection_ObjectClasses Detection_ObjectClasses_ObjectClasses_MIN = Detection_ObjectClasses_Unknown;
+constexpr Detection_ObjectClasses Detection_ObjectClasses_ObjectClasses_MAX = Detection_ObjectClasses_Tram;
+constexpr int Detection_ObjectClasses_ObjectClasses_ARRAYSIZE = Detection_ObjectClasses_ObjectClasses_MAX + 1;
 
-const ::google::protobuf::EnumDescriptor* Detection_ObjectClasses_descriptor();
-inline const ::std::string& Detection_ObjectClasses_Name(Detection_ObjectClasses value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Detection_ObjectClasses_descriptor(), value);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Detection_ObjectClasses_descriptor();
+template<typename T>
+inline const std::string& Detection_ObjectClasses_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Detection_ObjectClasses>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Detection_ObjectClasses_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Detection_ObjectClasses_descriptor(), enum_t_value);
 }
 inline bool Detection_ObjectClasses_Parse(
-    const ::std::string& name, Detection_ObjectClasses* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Detection_ObjectClasses>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Detection_ObjectClasses* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Detection_ObjectClasses>(
     Detection_ObjectClasses_descriptor(), name, value);
 }
 // ===================================================================
 
-class Point2d : public ::google::protobuf::Message {
+class Point2d final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Point2d) */ {
  public:
-  Point2d();
-  virtual ~Point2d();
-  
+  inline Point2d() : Point2d(nullptr) {}
+  ~Point2d() override;
+  explicit PROTOBUF_CONSTEXPR Point2d(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Point2d(const Point2d& from);
-  
+  Point2d(Point2d&& from) noexcept
+    : Point2d() {
+    *this = ::std::move(from);
+  }
+
   inline Point2d& operator=(const Point2d& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Point2d& operator=(Point2d&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const Point2d& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Point2d& default_instance();
-  
-  void Swap(Point2d* other);
-  
+  static inline const Point2d* internal_default_instance() {
+    return reinterpret_cast<const Point2d*>(
+               &_Point2d_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Point2d& a, Point2d& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Point2d* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Point2d* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Point2d* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Point2d* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Point2d>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Point2d& from);
-  void MergeFrom(const Point2d& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Point2d& from) {
+    Point2d::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Point2d* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Point2d";
+  }
+  protected:
+  explicit Point2d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kXFieldNumber = 1,
+    kYFieldNumber = 2,
+  };
   // required int32 x = 1;
-  inline bool has_x() const;
-  inline void clear_x();
-  static const int kXFieldNumber = 1;
-  inline ::google::protobuf::int32 x() const;
-  inline void set_x(::google::protobuf::int32 value);
-  
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  int32_t x() const;
+  void set_x(int32_t value);
+  private:
+  int32_t _internal_x() const;
+  void _internal_set_x(int32_t value);
+  public:
+
   // required int32 y = 2;
-  inline bool has_y() const;
-  inline void clear_y();
-  static const int kYFieldNumber = 2;
-  inline ::google::protobuf::int32 y() const;
-  inline void set_y(::google::protobuf::int32 value);
-  
+  bool has_y() const;
+  private:
+  bool _internal_has_y() const;
+  public:
+  void clear_y();
+  int32_t y() const;
+  void set_y(int32_t value);
+  private:
+  int32_t _internal_y() const;
+  void _internal_set_y(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Point2d)
  private:
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_y();
-  inline void clear_has_y();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::int32 x_;
-  ::google::protobuf::int32 y_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detections_2eproto();
-  friend void protobuf_AssignDesc_detections_2eproto();
-  friend void protobuf_ShutdownFile_detections_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Point2d* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t x_;
+    int32_t y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detections_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Box : public ::google::protobuf::Message {
+class Box final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Box) */ {
  public:
-  Box();
-  virtual ~Box();
-  
+  inline Box() : Box(nullptr) {}
+  ~Box() override;
+  explicit PROTOBUF_CONSTEXPR Box(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Box(const Box& from);
-  
+  Box(Box&& from) noexcept
+    : Box() {
+    *this = ::std::move(from);
+  }
+
   inline Box& operator=(const Box& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Box& operator=(Box&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Box& default_instance() {
+    return *internal_default_instance();
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static inline const Box* internal_default_instance() {
+    return reinterpret_cast<const Box*>(
+               &_Box_default_instance_);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Box& default_instance();
-  
-  void Swap(Box* other);
-  
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Box& a, Box& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Box* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Box* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Box* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Box* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Box>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Box& from);
-  void MergeFrom(const Box& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Box& from) {
+    Box::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Box* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Box";
+  }
+  protected:
+  explicit Box(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kMinCornerFieldNumber = 1,
+    kMaxCornerFieldNumber = 2,
+  };
   // required .doppia_protobuf.Point2d min_corner = 1;
-  inline bool has_min_corner() const;
-  inline void clear_min_corner();
-  static const int kMinCornerFieldNumber = 1;
-  inline const ::doppia_protobuf::Point2d& min_corner() const;
-  inline ::doppia_protobuf::Point2d* mutable_min_corner();
-  inline ::doppia_protobuf::Point2d* release_min_corner();
-  
+  bool has_min_corner() const;
+  private:
+  bool _internal_has_min_corner() const;
+  public:
+  void clear_min_corner();
+  const ::doppia_protobuf::Point2d& min_corner() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Point2d* release_min_corner();
+  ::doppia_protobuf::Point2d* mutable_min_corner();
+  void set_allocated_min_corner(::doppia_protobuf::Point2d* min_corner);
+  private:
+  const ::doppia_protobuf::Point2d& _internal_min_corner() const;
+  ::doppia_protobuf::Point2d* _internal_mutable_min_corner();
+  public:
+  void unsafe_arena_set_allocated_min_corner(
+      ::doppia_protobuf::Point2d* min_corner);
+  ::doppia_protobuf::Point2d* unsafe_arena_release_min_corner();
+
   // required .doppia_protobuf.Point2d max_corner = 2;
-  inline bool has_max_corner() const;
-  inline void clear_max_corner();
-  static const int kMaxCornerFieldNumber = 2;
-  inline const ::doppia_protobuf::Point2d& max_corner() const;
-  inline ::doppia_protobuf::Point2d* mutable_max_corner();
-  inline ::doppia_protobuf::Point2d* release_max_corner();
-  
+  bool has_max_corner() const;
+  private:
+  bool _internal_has_max_corner() const;
+  public:
+  void clear_max_corner();
+  const ::doppia_protobuf::Point2d& max_corner() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Point2d* release_max_corner();
+  ::doppia_protobuf::Point2d* mutable_max_corner();
+  void set_allocated_max_corner(::doppia_protobuf::Point2d* max_corner);
+  private:
+  const ::doppia_protobuf::Point2d& _internal_max_corner() const;
+  ::doppia_protobuf::Point2d* _internal_mutable_max_corner();
+  public:
+  void unsafe_arena_set_allocated_max_corner(
+      ::doppia_protobuf::Point2d* max_corner);
+  ::doppia_protobuf::Point2d* unsafe_arena_release_max_corner();
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Box)
  private:
-  inline void set_has_min_corner();
-  inline void clear_has_min_corner();
-  inline void set_has_max_corner();
-  inline void clear_has_max_corner();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::Point2d* min_corner_;
-  ::doppia_protobuf::Point2d* max_corner_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detections_2eproto();
-  friend void protobuf_AssignDesc_detections_2eproto();
-  friend void protobuf_ShutdownFile_detections_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Box* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::Point2d* min_corner_;
+    ::doppia_protobuf::Point2d* max_corner_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detections_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Detection : public ::google::protobuf::Message {
+class Detection final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Detection) */ {
  public:
-  Detection();
-  virtual ~Detection();
-  
+  inline Detection() : Detection(nullptr) {}
+  ~Detection() override;
+  explicit PROTOBUF_CONSTEXPR Detection(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Detection(const Detection& from);
-  
+  Detection(Detection&& from) noexcept
+    : Detection() {
+    *this = ::std::move(from);
+  }
+
   inline Detection& operator=(const Detection& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Detection& operator=(Detection&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Detection& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Detection* internal_default_instance() {
+    return reinterpret_cast<const Detection*>(
+               &_Detection_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Detection& a, Detection& b) {
+    a.Swap(&b);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Detection& default_instance();
-  
-  void Swap(Detection* other);
-  
+  inline void Swap(Detection* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Detection* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Detection* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Detection* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Detection>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Detection& from);
-  void MergeFrom(const Detection& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Detection& from) {
+    Detection::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Detection* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Detection";
+  }
+  protected:
+  explicit Detection(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   typedef Detection_ObjectClasses ObjectClasses;
-  static const ObjectClasses Car = Detection_ObjectClasses_Car;
-  static const ObjectClasses Pedestrian = Detection_ObjectClasses_Pedestrian;
-  static const ObjectClasses Bike = Detection_ObjectClasses_Bike;
-  static const ObjectClasses Motorbike = Detection_ObjectClasses_Motorbike;
-  static const ObjectClasses Bus = Detection_ObjectClasses_Bus;
-  static const ObjectClasses Tram = Detection_ObjectClasses_Tram;
-  static const ObjectClasses StaticObject = Detection_ObjectClasses_StaticObject;
-  static const ObjectClasses Unknown = Detection_ObjectClasses_Unknown;
+  static constexpr ObjectClasses Car =
+    Detection_ObjectClasses_Car;
+  static constexpr ObjectClasses Pedestrian =
+    Detection_ObjectClasses_Pedestrian;
+  static constexpr ObjectClasses Bike =
+    Detection_ObjectClasses_Bike;
+  static constexpr ObjectClasses Motorbike =
+    Detection_ObjectClasses_Motorbike;
+  static constexpr ObjectClasses Bus =
+    Detection_ObjectClasses_Bus;
+  static constexpr ObjectClasses Tram =
+    Detection_ObjectClasses_Tram;
+  static constexpr ObjectClasses StaticObject =
+    Detection_ObjectClasses_StaticObject;
+  static constexpr ObjectClasses Unknown =
+    Detection_ObjectClasses_Unknown;
   static inline bool ObjectClasses_IsValid(int value) {
     return Detection_ObjectClasses_IsValid(value);
   }
-  static const ObjectClasses ObjectClasses_MIN =
+  static constexpr ObjectClasses ObjectClasses_MIN =
     Detection_ObjectClasses_ObjectClasses_MIN;
-  static const ObjectClasses ObjectClasses_MAX =
+  static constexpr ObjectClasses ObjectClasses_MAX =
     Detection_ObjectClasses_ObjectClasses_MAX;
-  static const int ObjectClasses_ARRAYSIZE =
+  static constexpr int ObjectClasses_ARRAYSIZE =
     Detection_ObjectClasses_ObjectClasses_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   ObjectClasses_descriptor() {
     return Detection_ObjectClasses_descriptor();
   }
-  static inline const ::std::string& ObjectClasses_Name(ObjectClasses value) {
-    return Detection_ObjectClasses_Name(value);
+  template<typename T>
+  static inline const std::string& ObjectClasses_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, ObjectClasses>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function ObjectClasses_Name.");
+    return Detection_ObjectClasses_Name(enum_t_value);
   }
-  static inline bool ObjectClasses_Parse(const ::std::string& name,
+  static inline bool ObjectClasses_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       ObjectClasses* value) {
     return Detection_ObjectClasses_Parse(name, value);
   }
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kBoundingBoxFieldNumber = 1,
+    kScoreFieldNumber = 3,
+    kObjectClassFieldNumber = 2,
+  };
   // required .doppia_protobuf.Box bounding_box = 1;
-  inline bool has_bounding_box() const;
-  inline void clear_bounding_box();
-  static const int kBoundingBoxFieldNumber = 1;
-  inline const ::doppia_protobuf::Box& bounding_box() const;
-  inline ::doppia_protobuf::Box* mutable_bounding_box();
-  inline ::doppia_protobuf::Box* release_bounding_box();
-  
-  // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-  inline bool has_object_class() const;
-  inline void clear_object_class();
-  static const int kObjectClassFieldNumber = 2;
-  inline ::doppia_protobuf::Detection_ObjectClasses object_class() const;
-  inline void set_object_class(::doppia_protobuf::Detection_ObjectClasses value);
-  
+  bool has_bounding_box() const;
+  private:
+  bool _internal_has_bounding_box() const;
+  public:
+  void clear_bounding_box();
+  const ::doppia_protobuf::Box& bounding_box() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Box* release_bounding_box();
+  ::doppia_protobuf::Box* mutable_bounding_box();
+  void set_allocated_bounding_box(::doppia_protobuf::Box* bounding_box);
+  private:
+  const ::doppia_protobuf::Box& _internal_bounding_box() const;
+  ::doppia_protobuf::Box* _internal_mutable_bounding_box();
+  public:
+  void unsafe_arena_set_allocated_bounding_box(
+      ::doppia_protobuf::Box* bounding_box);
+  ::doppia_protobuf::Box* unsafe_arena_release_bounding_box();
+
   // optional float score = 3;
-  inline bool has_score() const;
-  inline void clear_score();
-  static const int kScoreFieldNumber = 3;
-  inline float score() const;
-  inline void set_score(float value);
-  
+  bool has_score() const;
+  private:
+  bool _internal_has_score() const;
+  public:
+  void clear_score();
+  float score() const;
+  void set_score(float value);
+  private:
+  float _internal_score() const;
+  void _internal_set_score(float value);
+  public:
+
+  // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
+  bool has_object_class() const;
+  private:
+  bool _internal_has_object_class() const;
+  public:
+  void clear_object_class();
+  ::doppia_protobuf::Detection_ObjectClasses object_class() const;
+  void set_object_class(::doppia_protobuf::Detection_ObjectClasses value);
+  private:
+  ::doppia_protobuf::Detection_ObjectClasses _internal_object_class() const;
+  void _internal_set_object_class(::doppia_protobuf::Detection_ObjectClasses value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Detection)
  private:
-  inline void set_has_bounding_box();
-  inline void clear_has_bounding_box();
-  inline void set_has_object_class();
-  inline void clear_has_object_class();
-  inline void set_has_score();
-  inline void clear_has_score();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::Box* bounding_box_;
-  int object_class_;
-  float score_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detections_2eproto();
-  friend void protobuf_AssignDesc_detections_2eproto();
-  friend void protobuf_ShutdownFile_detections_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Detection* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::Box* bounding_box_;
+    float score_;
+    int object_class_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detections_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Detections : public ::google::protobuf::Message {
+class Detections final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Detections) */ {
  public:
-  Detections();
-  virtual ~Detections();
-  
+  inline Detections() : Detections(nullptr) {}
+  ~Detections() override;
+  explicit PROTOBUF_CONSTEXPR Detections(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Detections(const Detections& from);
-  
+  Detections(Detections&& from) noexcept
+    : Detections() {
+    *this = ::std::move(from);
+  }
+
   inline Detections& operator=(const Detections& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Detections& operator=(Detections&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Detections& default_instance();
-  
-  void Swap(Detections* other);
-  
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Detections& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Detections* internal_default_instance() {
+    return reinterpret_cast<const Detections*>(
+               &_Detections_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Detections& a, Detections& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Detections* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Detections* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Detections* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Detections* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Detections>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Detections& from);
-  void MergeFrom(const Detections& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Detections& from) {
+    Detections::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Detections* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Detections";
+  }
+  protected:
+  explicit Detections(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
-  // optional string image_name = 1;
-  inline bool has_image_name() const;
-  inline void clear_image_name();
-  static const int kImageNameFieldNumber = 1;
-  inline const ::std::string& image_name() const;
-  inline void set_image_name(const ::std::string& value);
-  inline void set_image_name(const char* value);
-  inline void set_image_name(const char* value, size_t size);
-  inline ::std::string* mutable_image_name();
-  inline ::std::string* release_image_name();
-  
+
+  enum : int {
+    kDetectionsFieldNumber = 2,
+    kImageNameFieldNumber = 1,
+  };
   // repeated .doppia_protobuf.Detection detections = 2;
-  inline int detections_size() const;
-  inline void clear_detections();
-  static const int kDetectionsFieldNumber = 2;
-  inline const ::doppia_protobuf::Detection& detections(int index) const;
-  inline ::doppia_protobuf::Detection* mutable_detections(int index);
-  inline ::doppia_protobuf::Detection* add_detections();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Detection >&
-      detections() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Detection >*
+  int detections_size() const;
+  private:
+  int _internal_detections_size() const;
+  public:
+  void clear_detections();
+  ::doppia_protobuf::Detection* mutable_detections(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Detection >*
       mutable_detections();
-  
+  private:
+  const ::doppia_protobuf::Detection& _internal_detections(int index) const;
+  ::doppia_protobuf::Detection* _internal_add_detections();
+  public:
+  const ::doppia_protobuf::Detection& detections(int index) const;
+  ::doppia_protobuf::Detection* add_detections();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Detection >&
+      detections() const;
+
+  // optional string image_name = 1;
+  bool has_image_name() const;
+  private:
+  bool _internal_has_image_name() const;
+  public:
+  void clear_image_name();
+  const std::string& image_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_image_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_image_name();
+  PROTOBUF_NODISCARD std::string* release_image_name();
+  void set_allocated_image_name(std::string* image_name);
+  private:
+  const std::string& _internal_image_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_image_name(const std::string& value);
+  std::string* _internal_mutable_image_name();
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Detections)
  private:
-  inline void set_has_image_name();
-  inline void clear_has_image_name();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* image_name_;
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Detection > detections_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detections_2eproto();
-  friend void protobuf_AssignDesc_detections_2eproto();
-  friend void protobuf_ShutdownFile_detections_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Detections* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Detection > detections_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detections_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Point2d
 
 // required int32 x = 1;
+inline bool Point2d::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool Point2d::has_x() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_x();
 }
-inline void Point2d::set_has_x() {
-  _has_bits_[0] |= 0x00000001u;
+inline void Point2d::clear_x() {
+  _impl_.x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Point2d::clear_has_x() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t Point2d::_internal_x() const {
+  return _impl_.x_;
 }
-inline void Point2d::clear_x() {
-  x_ = 0;
-  clear_has_x();
+inline int32_t Point2d::x() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Point2d.x)
+  return _internal_x();
 }
-inline ::google::protobuf::int32 Point2d::x() const {
-  return x_;
+inline void Point2d::_internal_set_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.x_ = value;
 }
-inline void Point2d::set_x(::google::protobuf::int32 value) {
-  set_has_x();
-  x_ = value;
+inline void Point2d::set_x(int32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Point2d.x)
 }
 
 // required int32 y = 2;
+inline bool Point2d::_internal_has_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Point2d::has_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_y();
 }
-inline void Point2d::set_has_y() {
-  _has_bits_[0] |= 0x00000002u;
+inline void Point2d::clear_y() {
+  _impl_.y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Point2d::clear_has_y() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t Point2d::_internal_y() const {
+  return _impl_.y_;
 }
-inline void Point2d::clear_y() {
-  y_ = 0;
-  clear_has_y();
+inline int32_t Point2d::y() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Point2d.y)
+  return _internal_y();
 }
-inline ::google::protobuf::int32 Point2d::y() const {
-  return y_;
+inline void Point2d::_internal_set_y(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.y_ = value;
 }
-inline void Point2d::set_y(::google::protobuf::int32 value) {
-  set_has_y();
-  y_ = value;
+inline void Point2d::set_y(int32_t value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Point2d.y)
 }
 
 // -------------------------------------------------------------------
@@ -536,139 +959,334 @@ inline void Point2d::set_y(::google::protobuf::int32 value) {
 // Box
 
 // required .doppia_protobuf.Point2d min_corner = 1;
-inline bool Box::has_min_corner() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Box::set_has_min_corner() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Box::_internal_has_min_corner() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.min_corner_ != nullptr);
+  return value;
 }
-inline void Box::clear_has_min_corner() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Box::has_min_corner() const {
+  return _internal_has_min_corner();
 }
 inline void Box::clear_min_corner() {
-  if (min_corner_ != NULL) min_corner_->::doppia_protobuf::Point2d::Clear();
-  clear_has_min_corner();
+  if (_impl_.min_corner_ != nullptr) _impl_.min_corner_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::Point2d& Box::_internal_min_corner() const {
+  const ::doppia_protobuf::Point2d* p = _impl_.min_corner_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Point2d&>(
+      ::doppia_protobuf::_Point2d_default_instance_);
 }
 inline const ::doppia_protobuf::Point2d& Box::min_corner() const {
-  return min_corner_ != NULL ? *min_corner_ : *default_instance_->min_corner_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Box.min_corner)
+  return _internal_min_corner();
 }
-inline ::doppia_protobuf::Point2d* Box::mutable_min_corner() {
-  set_has_min_corner();
-  if (min_corner_ == NULL) min_corner_ = new ::doppia_protobuf::Point2d;
-  return min_corner_;
+inline void Box::unsafe_arena_set_allocated_min_corner(
+    ::doppia_protobuf::Point2d* min_corner) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.min_corner_);
+  }
+  _impl_.min_corner_ = min_corner;
+  if (min_corner) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Box.min_corner)
 }
 inline ::doppia_protobuf::Point2d* Box::release_min_corner() {
-  clear_has_min_corner();
-  ::doppia_protobuf::Point2d* temp = min_corner_;
-  min_corner_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Point2d* temp = _impl_.min_corner_;
+  _impl_.min_corner_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Point2d* Box::unsafe_arena_release_min_corner() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Box.min_corner)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Point2d* temp = _impl_.min_corner_;
+  _impl_.min_corner_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Point2d* Box::_internal_mutable_min_corner() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.min_corner_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Point2d>(GetArenaForAllocation());
+    _impl_.min_corner_ = p;
+  }
+  return _impl_.min_corner_;
+}
+inline ::doppia_protobuf::Point2d* Box::mutable_min_corner() {
+  ::doppia_protobuf::Point2d* _msg = _internal_mutable_min_corner();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Box.min_corner)
+  return _msg;
+}
+inline void Box::set_allocated_min_corner(::doppia_protobuf::Point2d* min_corner) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.min_corner_;
+  }
+  if (min_corner) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(min_corner);
+    if (message_arena != submessage_arena) {
+      min_corner = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, min_corner, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.min_corner_ = min_corner;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Box.min_corner)
+}
 
 // required .doppia_protobuf.Point2d max_corner = 2;
-inline bool Box::has_max_corner() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Box::set_has_max_corner() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Box::_internal_has_max_corner() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.max_corner_ != nullptr);
+  return value;
 }
-inline void Box::clear_has_max_corner() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Box::has_max_corner() const {
+  return _internal_has_max_corner();
 }
 inline void Box::clear_max_corner() {
-  if (max_corner_ != NULL) max_corner_->::doppia_protobuf::Point2d::Clear();
-  clear_has_max_corner();
+  if (_impl_.max_corner_ != nullptr) _impl_.max_corner_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::doppia_protobuf::Point2d& Box::_internal_max_corner() const {
+  const ::doppia_protobuf::Point2d* p = _impl_.max_corner_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Point2d&>(
+      ::doppia_protobuf::_Point2d_default_instance_);
 }
 inline const ::doppia_protobuf::Point2d& Box::max_corner() const {
-  return max_corner_ != NULL ? *max_corner_ : *default_instance_->max_corner_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Box.max_corner)
+  return _internal_max_corner();
 }
-inline ::doppia_protobuf::Point2d* Box::mutable_max_corner() {
-  set_has_max_corner();
-  if (max_corner_ == NULL) max_corner_ = new ::doppia_protobuf::Point2d;
-  return max_corner_;
+inline void Box::unsafe_arena_set_allocated_max_corner(
+    ::doppia_protobuf::Point2d* max_corner) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.max_corner_);
+  }
+  _impl_.max_corner_ = max_corner;
+  if (max_corner) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Box.max_corner)
 }
 inline ::doppia_protobuf::Point2d* Box::release_max_corner() {
-  clear_has_max_corner();
-  ::doppia_protobuf::Point2d* temp = max_corner_;
-  max_corner_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::Point2d* temp = _impl_.max_corner_;
+  _impl_.max_corner_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Point2d* Box::unsafe_arena_release_max_corner() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Box.max_corner)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::Point2d* temp = _impl_.max_corner_;
+  _impl_.max_corner_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Point2d* Box::_internal_mutable_max_corner() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.max_corner_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Point2d>(GetArenaForAllocation());
+    _impl_.max_corner_ = p;
+  }
+  return _impl_.max_corner_;
+}
+inline ::doppia_protobuf::Point2d* Box::mutable_max_corner() {
+  ::doppia_protobuf::Point2d* _msg = _internal_mutable_max_corner();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Box.max_corner)
+  return _msg;
+}
+inline void Box::set_allocated_max_corner(::doppia_protobuf::Point2d* max_corner) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.max_corner_;
+  }
+  if (max_corner) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(max_corner);
+    if (message_arena != submessage_arena) {
+      max_corner = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, max_corner, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.max_corner_ = max_corner;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Box.max_corner)
+}
 
 // -------------------------------------------------------------------
 
 // Detection
 
 // required .doppia_protobuf.Box bounding_box = 1;
-inline bool Detection::has_bounding_box() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Detection::_internal_has_bounding_box() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.bounding_box_ != nullptr);
+  return value;
 }
-inline void Detection::set_has_bounding_box() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Detection::clear_has_bounding_box() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Detection::has_bounding_box() const {
+  return _internal_has_bounding_box();
 }
 inline void Detection::clear_bounding_box() {
-  if (bounding_box_ != NULL) bounding_box_->::doppia_protobuf::Box::Clear();
-  clear_has_bounding_box();
+  if (_impl_.bounding_box_ != nullptr) _impl_.bounding_box_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::Box& Detection::_internal_bounding_box() const {
+  const ::doppia_protobuf::Box* p = _impl_.bounding_box_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Box&>(
+      ::doppia_protobuf::_Box_default_instance_);
 }
 inline const ::doppia_protobuf::Box& Detection::bounding_box() const {
-  return bounding_box_ != NULL ? *bounding_box_ : *default_instance_->bounding_box_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Detection.bounding_box)
+  return _internal_bounding_box();
 }
-inline ::doppia_protobuf::Box* Detection::mutable_bounding_box() {
-  set_has_bounding_box();
-  if (bounding_box_ == NULL) bounding_box_ = new ::doppia_protobuf::Box;
-  return bounding_box_;
+inline void Detection::unsafe_arena_set_allocated_bounding_box(
+    ::doppia_protobuf::Box* bounding_box) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bounding_box_);
+  }
+  _impl_.bounding_box_ = bounding_box;
+  if (bounding_box) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Detection.bounding_box)
 }
 inline ::doppia_protobuf::Box* Detection::release_bounding_box() {
-  clear_has_bounding_box();
-  ::doppia_protobuf::Box* temp = bounding_box_;
-  bounding_box_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Box* temp = _impl_.bounding_box_;
+  _impl_.bounding_box_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::Box* Detection::unsafe_arena_release_bounding_box() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Detection.bounding_box)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Box* temp = _impl_.bounding_box_;
+  _impl_.bounding_box_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::Box* Detection::_internal_mutable_bounding_box() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.bounding_box_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Box>(GetArenaForAllocation());
+    _impl_.bounding_box_ = p;
+  }
+  return _impl_.bounding_box_;
+}
+inline ::doppia_protobuf::Box* Detection::mutable_bounding_box() {
+  ::doppia_protobuf::Box* _msg = _internal_mutable_bounding_box();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Detection.bounding_box)
+  return _msg;
+}
+inline void Detection::set_allocated_bounding_box(::doppia_protobuf::Box* bounding_box) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.bounding_box_;
+  }
+  if (bounding_box) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bounding_box);
+    if (message_arena != submessage_arena) {
+      bounding_box = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bounding_box, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.bounding_box_ = bounding_box;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Detection.bounding_box)
+}
 
 // required .doppia_protobuf.Detection.ObjectClasses object_class = 2;
-inline bool Detection::has_object_class() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Detection::_internal_has_object_class() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Detection::set_has_object_class() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Detection::clear_has_object_class() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Detection::has_object_class() const {
+  return _internal_has_object_class();
 }
 inline void Detection::clear_object_class() {
-  object_class_ = 2;
-  clear_has_object_class();
+  _impl_.object_class_ = 2;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::doppia_protobuf::Detection_ObjectClasses Detection::_internal_object_class() const {
+  return static_cast< ::doppia_protobuf::Detection_ObjectClasses >(_impl_.object_class_);
 }
 inline ::doppia_protobuf::Detection_ObjectClasses Detection::object_class() const {
-  return static_cast< ::doppia_protobuf::Detection_ObjectClasses >(object_class_);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Detection.object_class)
+  return _internal_object_class();
+}
+inline void Detection::_internal_set_object_class(::doppia_protobuf::Detection_ObjectClasses value) {
+  assert(::doppia_protobuf::Detection_ObjectClasses_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.object_class_ = value;
 }
 inline void Detection::set_object_class(::doppia_protobuf::Detection_ObjectClasses value) {
-  GOOGLE_DCHECK(::doppia_protobuf::Detection_ObjectClasses_IsValid(value));
-  set_has_object_class();
-  object_class_ = value;
+  _internal_set_object_class(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Detection.object_class)
 }
 
 // optional float score = 3;
-inline bool Detection::has_score() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool Detection::_internal_has_score() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Detection::set_has_score() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void Detection::clear_has_score() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Detection::has_score() const {
+  return _internal_has_score();
 }
 inline void Detection::clear_score() {
-  score_ = 0;
-  clear_has_score();
+  _impl_.score_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Detection::_internal_score() const {
+  return _impl_.score_;
 }
 inline float Detection::score() const {
-  return score_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Detection.score)
+  return _internal_score();
+}
+inline void Detection::_internal_set_score(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.score_ = value;
 }
 inline void Detection::set_score(float value) {
-  set_has_score();
-  score_ = value;
+  _internal_set_score(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Detection.score)
 }
 
 // -------------------------------------------------------------------
@@ -676,106 +1294,138 @@ inline void Detection::set_score(float value) {
 // Detections
 
 // optional string image_name = 1;
-inline bool Detections::has_image_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Detections::set_has_image_name() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Detections::_internal_has_image_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Detections::clear_has_image_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Detections::has_image_name() const {
+  return _internal_has_image_name();
 }
 inline void Detections::clear_image_name() {
-  if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-    image_name_->clear();
-  }
-  clear_has_image_name();
-}
-inline const ::std::string& Detections::image_name() const {
-  return *image_name_;
-}
-inline void Detections::set_image_name(const ::std::string& value) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
-  }
-  image_name_->assign(value);
-}
-inline void Detections::set_image_name(const char* value) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
-  }
-  image_name_->assign(value);
-}
-inline void Detections::set_image_name(const char* value, size_t size) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
+  _impl_.image_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Detections::image_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Detections.image_name)
+  return _internal_image_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Detections::set_image_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.image_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Detections.image_name)
+}
+inline std::string* Detections::mutable_image_name() {
+  std::string* _s = _internal_mutable_image_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Detections.image_name)
+  return _s;
+}
+inline const std::string& Detections::_internal_image_name() const {
+  return _impl_.image_name_.Get();
+}
+inline void Detections::_internal_set_image_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.image_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Detections::_internal_mutable_image_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.image_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Detections::release_image_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Detections.image_name)
+  if (!_internal_has_image_name()) {
+    return nullptr;
   }
-  image_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Detections::mutable_image_name() {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.image_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_name_.IsDefault()) {
+    _impl_.image_name_.Set("", GetArenaForAllocation());
   }
-  return image_name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* Detections::release_image_name() {
-  clear_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void Detections::set_allocated_image_name(std::string* image_name) {
+  if (image_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = image_name_;
-    image_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.image_name_.SetAllocated(image_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_name_.IsDefault()) {
+    _impl_.image_name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Detections.image_name)
 }
 
 // repeated .doppia_protobuf.Detection detections = 2;
+inline int Detections::_internal_detections_size() const {
+  return _impl_.detections_.size();
+}
 inline int Detections::detections_size() const {
-  return detections_.size();
+  return _internal_detections_size();
 }
 inline void Detections::clear_detections() {
-  detections_.Clear();
+  _impl_.detections_.Clear();
+}
+inline ::doppia_protobuf::Detection* Detections::mutable_detections(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Detections.detections)
+  return _impl_.detections_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Detection >*
+Detections::mutable_detections() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.Detections.detections)
+  return &_impl_.detections_;
+}
+inline const ::doppia_protobuf::Detection& Detections::_internal_detections(int index) const {
+  return _impl_.detections_.Get(index);
 }
 inline const ::doppia_protobuf::Detection& Detections::detections(int index) const {
-  return detections_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Detections.detections)
+  return _internal_detections(index);
 }
-inline ::doppia_protobuf::Detection* Detections::mutable_detections(int index) {
-  return detections_.Mutable(index);
+inline ::doppia_protobuf::Detection* Detections::_internal_add_detections() {
+  return _impl_.detections_.Add();
 }
 inline ::doppia_protobuf::Detection* Detections::add_detections() {
-  return detections_.Add();
+  ::doppia_protobuf::Detection* _add = _internal_add_detections();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.Detections.detections)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Detection >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Detection >&
 Detections::detections() const {
-  return detections_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Detection >*
-Detections::mutable_detections() {
-  return &detections_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.Detections.detections)
+  return _impl_.detections_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::doppia_protobuf::Detection_ObjectClasses> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::doppia_protobuf::Detection_ObjectClasses>() {
   return ::doppia_protobuf::Detection_ObjectClasses_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_detections_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_detections_2eproto
@@ -1,3646 +1,3723 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: detector_model.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "detector_model.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* LinearSvmModel_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  LinearSvmModel_reflection_ = NULL;
-const ::google::protobuf::Descriptor* IntegralChannelsFeature_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  IntegralChannelsFeature_reflection_ = NULL;
-const ::google::protobuf::Descriptor* IntegralChannelDecisionStump_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  IntegralChannelDecisionStump_reflection_ = NULL;
-const ::google::protobuf::Descriptor* IntegralChannelBinaryDecisionTreeNode_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  IntegralChannelBinaryDecisionTreeNode_reflection_ = NULL;
-const ::google::protobuf::Descriptor* IntegralChannelBinaryDecisionTree_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  IntegralChannelBinaryDecisionTree_reflection_ = NULL;
-const ::google::protobuf::Descriptor* SoftCascadeOverIntegralChannelsStage_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SoftCascadeOverIntegralChannelsStage_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* SoftCascadeOverIntegralChannelsModel_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  SoftCascadeOverIntegralChannelsModel_reflection_ = NULL;
-const ::google::protobuf::Descriptor* DetectorModel_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  DetectorModel_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* DetectorModel_DetectorTypes_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* MultiScalesDetectorModel_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  MultiScalesDetectorModel_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_detector_5fmodel_2eproto() {
-  protobuf_AddDesc_detector_5fmodel_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "detector_model.proto");
-  GOOGLE_CHECK(file != NULL);
-  LinearSvmModel_descriptor_ = file->message_type(0);
-  static const int LinearSvmModel_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, solved_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, number_of_classes_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, labels_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, number_of_features_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, bias_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, w_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR LinearSvmModel::LinearSvmModel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.labels_)*/{}
+  , /*decltype(_impl_.w_)*/{}
+  , /*decltype(_impl_.solved_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.number_of_classes_)*/0u
+  , /*decltype(_impl_.number_of_features_)*/0u
+  , /*decltype(_impl_.bias_)*/0} {}
+struct LinearSvmModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LinearSvmModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LinearSvmModelDefaultTypeInternal() {}
+  union {
+    LinearSvmModel _instance;
   };
-  LinearSvmModel_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      LinearSvmModel_descriptor_,
-      LinearSvmModel::default_instance_,
-      LinearSvmModel_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(LinearSvmModel, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(LinearSvmModel));
-  IntegralChannelsFeature_descriptor_ = file->message_type(1);
-  static const int IntegralChannelsFeature_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelsFeature, channel_index_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelsFeature, box_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LinearSvmModelDefaultTypeInternal _LinearSvmModel_default_instance_;
+PROTOBUF_CONSTEXPR IntegralChannelsFeature::IntegralChannelsFeature(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.box_)*/nullptr
+  , /*decltype(_impl_.channel_index_)*/0} {}
+struct IntegralChannelsFeatureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntegralChannelsFeatureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntegralChannelsFeatureDefaultTypeInternal() {}
+  union {
+    IntegralChannelsFeature _instance;
   };
-  IntegralChannelsFeature_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      IntegralChannelsFeature_descriptor_,
-      IntegralChannelsFeature::default_instance_,
-      IntegralChannelsFeature_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelsFeature, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelsFeature, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(IntegralChannelsFeature));
-  IntegralChannelDecisionStump_descriptor_ = file->message_type(2);
-  static const int IntegralChannelDecisionStump_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, feature_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, feature_threshold_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, larger_than_threshold_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, true_leaf_weight_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, false_leaf_weight_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntegralChannelsFeatureDefaultTypeInternal _IntegralChannelsFeature_default_instance_;
+PROTOBUF_CONSTEXPR IntegralChannelDecisionStump::IntegralChannelDecisionStump(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.feature_)*/nullptr
+  , /*decltype(_impl_.feature_threshold_)*/0
+  , /*decltype(_impl_.larger_than_threshold_)*/false
+  , /*decltype(_impl_.true_leaf_weight_)*/0
+  , /*decltype(_impl_.false_leaf_weight_)*/0} {}
+struct IntegralChannelDecisionStumpDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntegralChannelDecisionStumpDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntegralChannelDecisionStumpDefaultTypeInternal() {}
+  union {
+    IntegralChannelDecisionStump _instance;
   };
-  IntegralChannelDecisionStump_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      IntegralChannelDecisionStump_descriptor_,
-      IntegralChannelDecisionStump::default_instance_,
-      IntegralChannelDecisionStump_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelDecisionStump, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(IntegralChannelDecisionStump));
-  IntegralChannelBinaryDecisionTreeNode_descriptor_ = file->message_type(3);
-  static const int IntegralChannelBinaryDecisionTreeNode_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, parent_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, parent_value_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, decision_stump_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntegralChannelDecisionStumpDefaultTypeInternal _IntegralChannelDecisionStump_default_instance_;
+PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTreeNode::IntegralChannelBinaryDecisionTreeNode(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.decision_stump_)*/nullptr
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_.parent_id_)*/0u
+  , /*decltype(_impl_.parent_value_)*/false} {}
+struct IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal() {}
+  union {
+    IntegralChannelBinaryDecisionTreeNode _instance;
   };
-  IntegralChannelBinaryDecisionTreeNode_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      IntegralChannelBinaryDecisionTreeNode_descriptor_,
-      IntegralChannelBinaryDecisionTreeNode::default_instance_,
-      IntegralChannelBinaryDecisionTreeNode_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(IntegralChannelBinaryDecisionTreeNode));
-  IntegralChannelBinaryDecisionTree_descriptor_ = file->message_type(4);
-  static const int IntegralChannelBinaryDecisionTree_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTree, nodes_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal _IntegralChannelBinaryDecisionTreeNode_default_instance_;
+PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTree::IntegralChannelBinaryDecisionTree(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IntegralChannelBinaryDecisionTreeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTreeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IntegralChannelBinaryDecisionTreeDefaultTypeInternal() {}
+  union {
+    IntegralChannelBinaryDecisionTree _instance;
   };
-  IntegralChannelBinaryDecisionTree_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      IntegralChannelBinaryDecisionTree_descriptor_,
-      IntegralChannelBinaryDecisionTree::default_instance_,
-      IntegralChannelBinaryDecisionTree_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTree, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(IntegralChannelBinaryDecisionTree, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(IntegralChannelBinaryDecisionTree));
-  SoftCascadeOverIntegralChannelsStage_descriptor_ = file->message_type(5);
-  static const int SoftCascadeOverIntegralChannelsStage_offsets_[6] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, feature_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, decision_stump_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, level2_decision_tree_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, leveln_decision_tree_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, weight_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, cascade_threshold_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IntegralChannelBinaryDecisionTreeDefaultTypeInternal _IntegralChannelBinaryDecisionTree_default_instance_;
+PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsStage::SoftCascadeOverIntegralChannelsStage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.decision_stump_)*/nullptr
+  , /*decltype(_impl_.level2_decision_tree_)*/nullptr
+  , /*decltype(_impl_.leveln_decision_tree_)*/nullptr
+  , /*decltype(_impl_.feature_type_)*/0
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.cascade_threshold_)*/0} {}
+struct SoftCascadeOverIntegralChannelsStageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsStageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SoftCascadeOverIntegralChannelsStageDefaultTypeInternal() {}
+  union {
+    SoftCascadeOverIntegralChannelsStage _instance;
   };
-  SoftCascadeOverIntegralChannelsStage_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SoftCascadeOverIntegralChannelsStage_descriptor_,
-      SoftCascadeOverIntegralChannelsStage::default_instance_,
-      SoftCascadeOverIntegralChannelsStage_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SoftCascadeOverIntegralChannelsStage));
-  SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor_ = SoftCascadeOverIntegralChannelsStage_descriptor_->enum_type(0);
-  SoftCascadeOverIntegralChannelsModel_descriptor_ = file->message_type(6);
-  static const int SoftCascadeOverIntegralChannelsModel_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsModel, stages_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsModel, channels_description_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsModel, shrinking_factor_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SoftCascadeOverIntegralChannelsStageDefaultTypeInternal _SoftCascadeOverIntegralChannelsStage_default_instance_;
+PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsModel::SoftCascadeOverIntegralChannelsModel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stages_)*/{}
+  , /*decltype(_impl_.channels_scaling_exponents_)*/{}
+  , /*decltype(_impl_.channels_description_)*/{nullptr, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shrinking_factor_)*/4u} {}
+struct SoftCascadeOverIntegralChannelsModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SoftCascadeOverIntegralChannelsModelDefaultTypeInternal() {}
+  union {
+    SoftCascadeOverIntegralChannelsModel _instance;
   };
-  SoftCascadeOverIntegralChannelsModel_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      SoftCascadeOverIntegralChannelsModel_descriptor_,
-      SoftCascadeOverIntegralChannelsModel::default_instance_,
-      SoftCascadeOverIntegralChannelsModel_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsModel, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(SoftCascadeOverIntegralChannelsModel, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(SoftCascadeOverIntegralChannelsModel));
-  DetectorModel_descriptor_ = file->message_type(7);
-  static const int DetectorModel_offsets_[8] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, detector_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, training_dataset_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, model_window_size_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, object_window_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, detector_type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, linear_svm_model_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, soft_cascade_model_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, scale_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SoftCascadeOverIntegralChannelsModelDefaultTypeInternal _SoftCascadeOverIntegralChannelsModel_default_instance_;
+PROTOBUF_CONSTEXPR DetectorModel::DetectorModel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.detector_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.training_dataset_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.model_window_size_)*/nullptr
+  , /*decltype(_impl_.object_window_)*/nullptr
+  , /*decltype(_impl_.linear_svm_model_)*/nullptr
+  , /*decltype(_impl_.soft_cascade_model_)*/nullptr
+  , /*decltype(_impl_.detector_type_)*/0
+  , /*decltype(_impl_.scale_)*/1} {}
+struct DetectorModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DetectorModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DetectorModelDefaultTypeInternal() {}
+  union {
+    DetectorModel _instance;
   };
-  DetectorModel_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      DetectorModel_descriptor_,
-      DetectorModel::default_instance_,
-      DetectorModel_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(DetectorModel, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(DetectorModel));
-  DetectorModel_DetectorTypes_descriptor_ = DetectorModel_descriptor_->enum_type(0);
-  MultiScalesDetectorModel_descriptor_ = file->message_type(8);
-  static const int MultiScalesDetectorModel_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MultiScalesDetectorModel, detector_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MultiScalesDetectorModel, training_dataset_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MultiScalesDetectorModel, detectors_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DetectorModelDefaultTypeInternal _DetectorModel_default_instance_;
+PROTOBUF_CONSTEXPR MultiScalesDetectorModel::MultiScalesDetectorModel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.detectors_)*/{}
+  , /*decltype(_impl_.detector_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.training_dataset_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct MultiScalesDetectorModelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiScalesDetectorModelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiScalesDetectorModelDefaultTypeInternal() {}
+  union {
+    MultiScalesDetectorModel _instance;
   };
-  MultiScalesDetectorModel_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      MultiScalesDetectorModel_descriptor_,
-      MultiScalesDetectorModel::default_instance_,
-      MultiScalesDetectorModel_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MultiScalesDetectorModel, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(MultiScalesDetectorModel, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(MultiScalesDetectorModel));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_detector_5fmodel_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    LinearSvmModel_descriptor_, &LinearSvmModel::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    IntegralChannelsFeature_descriptor_, &IntegralChannelsFeature::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    IntegralChannelDecisionStump_descriptor_, &IntegralChannelDecisionStump::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    IntegralChannelBinaryDecisionTreeNode_descriptor_, &IntegralChannelBinaryDecisionTreeNode::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    IntegralChannelBinaryDecisionTree_descriptor_, &IntegralChannelBinaryDecisionTree::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SoftCascadeOverIntegralChannelsStage_descriptor_, &SoftCascadeOverIntegralChannelsStage::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    SoftCascadeOverIntegralChannelsModel_descriptor_, &SoftCascadeOverIntegralChannelsModel::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    DetectorModel_descriptor_, &DetectorModel::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    MultiScalesDetectorModel_descriptor_, &MultiScalesDetectorModel::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_detector_5fmodel_2eproto() {
-  delete LinearSvmModel::default_instance_;
-  delete LinearSvmModel_reflection_;
-  delete IntegralChannelsFeature::default_instance_;
-  delete IntegralChannelsFeature_reflection_;
-  delete IntegralChannelDecisionStump::default_instance_;
-  delete IntegralChannelDecisionStump_reflection_;
-  delete IntegralChannelBinaryDecisionTreeNode::default_instance_;
-  delete IntegralChannelBinaryDecisionTreeNode_reflection_;
-  delete IntegralChannelBinaryDecisionTree::default_instance_;
-  delete IntegralChannelBinaryDecisionTree_reflection_;
-  delete SoftCascadeOverIntegralChannelsStage::default_instance_;
-  delete SoftCascadeOverIntegralChannelsStage_reflection_;
-  delete SoftCascadeOverIntegralChannelsModel::default_instance_;
-  delete SoftCascadeOverIntegralChannelsModel_reflection_;
-  delete DetectorModel::default_instance_;
-  delete DetectorModel_reflection_;
-  delete MultiScalesDetectorModel::default_instance_;
-  delete MultiScalesDetectorModel_reflection_;
-}
-
-void protobuf_AddDesc_detector_5fmodel_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::doppia_protobuf::protobuf_AddDesc_detections_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\024detector_model.proto\022\017doppia_protobuf\032"
-    "\020detections.proto\"\205\001\n\016LinearSvmModel\022\023\n\013"
-    "solved_type\030\001 \001(\t\022\031\n\021number_of_classes\030\002"
-    " \001(\r\022\016\n\006labels\030\003 \003(\005\022\032\n\022number_of_featur"
-    "es\030\004 \001(\r\022\014\n\004bias\030\005 \002(\002\022\t\n\001w\030\006 \003(\002\"S\n\027Int"
-    "egralChannelsFeature\022\025\n\rchannel_index\030\001 "
-    "\002(\005\022!\n\003box\030\002 \002(\0132\024.doppia_protobuf.Box\"\317"
-    "\001\n\034IntegralChannelDecisionStump\0229\n\007featu"
-    "re\030\001 \002(\0132(.doppia_protobuf.IntegralChann"
-    "elsFeature\022\031\n\021feature_threshold\030\002 \002(\002\022$\n"
-    "\025larger_than_threshold\030\003 \001(\010:\005false\022\030\n\020t"
-    "rue_leaf_weight\030\n \001(\002\022\031\n\021false_leaf_weig"
-    "ht\030\013 \001(\002\"\243\001\n%IntegralChannelBinaryDecisi"
-    "onTreeNode\022\n\n\002id\030\001 \002(\r\022\021\n\tparent_id\030\002 \002("
-    "\r\022\024\n\014parent_value\030\003 \001(\010\022E\n\016decision_stum"
-    "p\030\004 \001(\0132-.doppia_protobuf.IntegralChanne"
-    "lDecisionStump\"j\n!IntegralChannelBinaryD"
-    "ecisionTree\022E\n\005nodes\030\001 \003(\01326.doppia_prot"
-    "obuf.IntegralChannelBinaryDecisionTreeNo"
-    "de\"\342\003\n$SoftCascadeOverIntegralChannelsSt"
-    "age\022X\n\014feature_type\030\001 \002(\0162B.doppia_proto"
-    "buf.SoftCascadeOverIntegralChannelsStage"
-    ".FeatureTypes\022E\n\016decision_stump\030\n \001(\0132-."
-    "doppia_protobuf.IntegralChannelDecisionS"
-    "tump\022P\n\024level2_decision_tree\030\013 \001(\01322.dop"
-    "pia_protobuf.IntegralChannelBinaryDecisi"
-    "onTree\022P\n\024levelN_decision_tree\030\014 \001(\01322.d"
-    "oppia_protobuf.IntegralChannelBinaryDeci"
-    "sionTree\022\016\n\006weight\030\002 \002(\002\022\031\n\021cascade_thre"
-    "shold\030\003 \002(\002\"J\n\014FeatureTypes\022\n\n\006Stumps\020\000\022"
-    "\026\n\022Level2DecisionTree\020\n\022\026\n\022LevelNDecisio"
-    "nTree\020d\"\262\001\n$SoftCascadeOverIntegralChann"
-    "elsModel\022E\n\006stages\030\001 \003(\01325.doppia_protob"
-    "uf.SoftCascadeOverIntegralChannelsStage\022"
-    "&\n\024channels_description\030\002 \001(\t:\010hog6_luv\022"
-    "\033\n\020shrinking_factor\030\003 \001(\r:\0014\"\343\003\n\rDetecto"
-    "rModel\022\025\n\rdetector_name\030\001 \001(\t\022\035\n\025trainin"
-    "g_dataset_name\030\002 \002(\t\0223\n\021model_window_siz"
-    "e\030\n \001(\0132\030.doppia_protobuf.Point2d\022+\n\robj"
-    "ect_window\030\013 \001(\0132\024.doppia_protobuf.Box\022C"
-    "\n\rdetector_type\030\003 \002(\0162,.doppia_protobuf."
-    "DetectorModel.DetectorTypes\0229\n\020linear_sv"
-    "m_model\030d \001(\0132\037.doppia_protobuf.LinearSv"
-    "mModel\022Q\n\022soft_cascade_model\030f \001(\01325.dop"
-    "pia_protobuf.SoftCascadeOverIntegralChan"
-    "nelsModel\022\021\n\005scale\030\310\001 \001(\002:\0011\"T\n\rDetector"
-    "Types\022\r\n\tLinearSvm\020\000\022#\n\037SoftCascadeOverI"
-    "ntegralChannels\020\n\022\017\n\013HoughForest\020\024\"\203\001\n\030M"
-    "ultiScalesDetectorModel\022\025\n\rdetector_name"
-    "\030\001 \001(\t\022\035\n\025training_dataset_name\030\002 \002(\t\0221\n"
-    "\tdetectors\030\003 \003(\0132\036.doppia_protobuf.Detec"
-    "torModel", 2048);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "detector_model.proto", &protobuf_RegisterTypes);
-  LinearSvmModel::default_instance_ = new LinearSvmModel();
-  IntegralChannelsFeature::default_instance_ = new IntegralChannelsFeature();
-  IntegralChannelDecisionStump::default_instance_ = new IntegralChannelDecisionStump();
-  IntegralChannelBinaryDecisionTreeNode::default_instance_ = new IntegralChannelBinaryDecisionTreeNode();
-  IntegralChannelBinaryDecisionTree::default_instance_ = new IntegralChannelBinaryDecisionTree();
-  SoftCascadeOverIntegralChannelsStage::default_instance_ = new SoftCascadeOverIntegralChannelsStage();
-  SoftCascadeOverIntegralChannelsModel::default_instance_ = new SoftCascadeOverIntegralChannelsModel();
-  DetectorModel::default_instance_ = new DetectorModel();
-  MultiScalesDetectorModel::default_instance_ = new MultiScalesDetectorModel();
-  LinearSvmModel::default_instance_->InitAsDefaultInstance();
-  IntegralChannelsFeature::default_instance_->InitAsDefaultInstance();
-  IntegralChannelDecisionStump::default_instance_->InitAsDefaultInstance();
-  IntegralChannelBinaryDecisionTreeNode::default_instance_->InitAsDefaultInstance();
-  IntegralChannelBinaryDecisionTree::default_instance_->InitAsDefaultInstance();
-  SoftCascadeOverIntegralChannelsStage::default_instance_->InitAsDefaultInstance();
-  SoftCascadeOverIntegralChannelsModel::default_instance_->InitAsDefaultInstance();
-  DetectorModel::default_instance_->InitAsDefaultInstance();
-  MultiScalesDetectorModel::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_detector_5fmodel_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_detector_5fmodel_2eproto {
-  StaticDescriptorInitializer_detector_5fmodel_2eproto() {
-    protobuf_AddDesc_detector_5fmodel_2eproto();
-  }
-} static_descriptor_initializer_detector_5fmodel_2eproto_;
-
-
-// ===================================================================
-
-#ifndef _MSC_VER
-const int LinearSvmModel::kSolvedTypeFieldNumber;
-const int LinearSvmModel::kNumberOfClassesFieldNumber;
-const int LinearSvmModel::kLabelsFieldNumber;
-const int LinearSvmModel::kNumberOfFeaturesFieldNumber;
-const int LinearSvmModel::kBiasFieldNumber;
-const int LinearSvmModel::kWFieldNumber;
-#endif  // !_MSC_VER
-
-LinearSvmModel::LinearSvmModel()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiScalesDetectorModelDefaultTypeInternal _MultiScalesDetectorModel_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_detector_5fmodel_2eproto[9];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_detector_5fmodel_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_detector_5fmodel_2eproto = nullptr;
+
+const uint32_t TableStruct_detector_5fmodel_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.solved_type_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.number_of_classes_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.labels_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.number_of_features_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.bias_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::LinearSvmModel, _impl_.w_),
+  0,
+  1,
+  ~0u,
+  2,
+  3,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelsFeature, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelsFeature, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelsFeature, _impl_.channel_index_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelsFeature, _impl_.box_),
+  1,
+  0,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_.feature_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_.feature_threshold_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_.larger_than_threshold_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_.true_leaf_weight_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelDecisionStump, _impl_.false_leaf_weight_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _impl_.parent_id_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _impl_.parent_value_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode, _impl_.decision_stump_),
+  1,
+  2,
+  3,
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTree, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::IntegralChannelBinaryDecisionTree, _impl_.nodes_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.feature_type_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.decision_stump_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.level2_decision_tree_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.leveln_decision_tree_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage, _impl_.cascade_threshold_),
+  3,
+  0,
+  1,
+  2,
+  4,
+  5,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _impl_.stages_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _impl_.channels_description_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _impl_.shrinking_factor_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel, _impl_.channels_scaling_exponents_),
+  ~0u,
+  0,
+  1,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.detector_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.training_dataset_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.model_window_size_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.object_window_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.detector_type_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.linear_svm_model_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.soft_cascade_model_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::DetectorModel, _impl_.scale_),
+  0,
+  1,
+  2,
+  3,
+  6,
+  4,
+  5,
+  7,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::MultiScalesDetectorModel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::MultiScalesDetectorModel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::MultiScalesDetectorModel, _impl_.detector_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::MultiScalesDetectorModel, _impl_.training_dataset_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::MultiScalesDetectorModel, _impl_.detectors_),
+  0,
+  1,
+  ~0u,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 12, -1, sizeof(::doppia_protobuf::LinearSvmModel)},
+  { 18, 26, -1, sizeof(::doppia_protobuf::IntegralChannelsFeature)},
+  { 28, 39, -1, sizeof(::doppia_protobuf::IntegralChannelDecisionStump)},
+  { 44, 54, -1, sizeof(::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode)},
+  { 58, -1, -1, sizeof(::doppia_protobuf::IntegralChannelBinaryDecisionTree)},
+  { 65, 77, -1, sizeof(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage)},
+  { 83, 93, -1, sizeof(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel)},
+  { 97, 111, -1, sizeof(::doppia_protobuf::DetectorModel)},
+  { 119, 128, -1, sizeof(::doppia_protobuf::MultiScalesDetectorModel)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_LinearSvmModel_default_instance_._instance,
+  &::doppia_protobuf::_IntegralChannelsFeature_default_instance_._instance,
+  &::doppia_protobuf::_IntegralChannelDecisionStump_default_instance_._instance,
+  &::doppia_protobuf::_IntegralChannelBinaryDecisionTreeNode_default_instance_._instance,
+  &::doppia_protobuf::_IntegralChannelBinaryDecisionTree_default_instance_._instance,
+  &::doppia_protobuf::_SoftCascadeOverIntegralChannelsStage_default_instance_._instance,
+  &::doppia_protobuf::_SoftCascadeOverIntegralChannelsModel_default_instance_._instance,
+  &::doppia_protobuf::_DetectorModel_default_instance_._instance,
+  &::doppia_protobuf::_MultiScalesDetectorModel_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_detector_5fmodel_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\024detector_model.proto\022\017doppia_protobuf\032"
+  "\020detections.proto\"\205\001\n\016LinearSvmModel\022\023\n\013"
+  "solved_type\030\001 \001(\t\022\031\n\021number_of_classes\030\002"
+  " \001(\r\022\016\n\006labels\030\003 \003(\005\022\032\n\022number_of_featur"
+  "es\030\004 \001(\r\022\014\n\004bias\030\005 \002(\002\022\t\n\001w\030\006 \003(\002\"S\n\027Int"
+  "egralChannelsFeature\022\025\n\rchannel_index\030\001 "
+  "\002(\005\022!\n\003box\030\002 \002(\0132\024.doppia_protobuf.Box\"\317"
+  "\001\n\034IntegralChannelDecisionStump\0229\n\007featu"
+  "re\030\001 \002(\0132(.doppia_protobuf.IntegralChann"
+  "elsFeature\022\031\n\021feature_threshold\030\002 \002(\002\022$\n"
+  "\025larger_than_threshold\030\003 \001(\010:\005false\022\030\n\020t"
+  "rue_leaf_weight\030\n \001(\002\022\031\n\021false_leaf_weig"
+  "ht\030\013 \001(\002\"\243\001\n%IntegralChannelBinaryDecisi"
+  "onTreeNode\022\n\n\002id\030\001 \002(\r\022\021\n\tparent_id\030\002 \002("
+  "\r\022\024\n\014parent_value\030\003 \001(\010\022E\n\016decision_stum"
+  "p\030\004 \001(\0132-.doppia_protobuf.IntegralChanne"
+  "lDecisionStump\"j\n!IntegralChannelBinaryD"
+  "ecisionTree\022E\n\005nodes\030\001 \003(\01326.doppia_prot"
+  "obuf.IntegralChannelBinaryDecisionTreeNo"
+  "de\"\342\003\n$SoftCascadeOverIntegralChannelsSt"
+  "age\022X\n\014feature_type\030\001 \002(\0162B.doppia_proto"
+  "buf.SoftCascadeOverIntegralChannelsStage"
+  ".FeatureTypes\022E\n\016decision_stump\030\n \001(\0132-."
+  "doppia_protobuf.IntegralChannelDecisionS"
+  "tump\022P\n\024level2_decision_tree\030\013 \001(\01322.dop"
+  "pia_protobuf.IntegralChannelBinaryDecisi"
+  "onTree\022P\n\024levelN_decision_tree\030\014 \001(\01322.d"
+  "oppia_protobuf.IntegralChannelBinaryDeci"
+  "sionTree\022\016\n\006weight\030\002 \002(\002\022\031\n\021cascade_thre"
+  "shold\030\003 \002(\002\"J\n\014FeatureTypes\022\n\n\006Stumps\020\000\022"
+  "\026\n\022Level2DecisionTree\020\n\022\026\n\022LevelNDecisio"
+  "nTree\020d\"\326\001\n$SoftCascadeOverIntegralChann"
+  "elsModel\022E\n\006stages\030\001 \003(\01325.doppia_protob"
+  "uf.SoftCascadeOverIntegralChannelsStage\022"
+  "&\n\024channels_description\030\002 \001(\t:\010hog6_luv\022"
+  "\033\n\020shrinking_factor\030\003 \001(\r:\0014\022\"\n\032channels"
+  "_scaling_exponents\030\004 \003(\002\"\343\003\n\rDetectorMod"
+  "el\022\025\n\rdetector_name\030\001 \001(\t\022\035\n\025training_da"
+  "taset_name\030\002 \002(\t\0223\n\021model_window_size\030\n "
+  "\001(\0132\030.doppia_protobuf.Point2d\022+\n\robject_"
+  "window\030\013 \001(\0132\024.doppia_protobuf.Box\022C\n\rde"
+  "tector_type\030\003 \002(\0162,.doppia_protobuf.Dete"
+  "ctorModel.DetectorTypes\0229\n\020linear_svm_mo"
+  "del\030d \001(\0132\037.doppia_protobuf.LinearSvmMod"
+  "el\022Q\n\022soft_cascade_model\030f \001(\01325.doppia_"
+  "protobuf.SoftCascadeOverIntegralChannels"
+  "Model\022\021\n\005scale\030\310\001 \001(\002:\0011\"T\n\rDetectorType"
+  "s\022\r\n\tLinearSvm\020\000\022#\n\037SoftCascadeOverInteg"
+  "ralChannels\020\n\022\017\n\013HoughForest\020\024\"\203\001\n\030Multi"
+  "ScalesDetectorModel\022\025\n\rdetector_name\030\001 \001"
+  "(\t\022\035\n\025training_dataset_name\030\002 \002(\t\0221\n\tdet"
+  "ectors\030\003 \003(\0132\036.doppia_protobuf.DetectorM"
+  "odel"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_detector_5fmodel_2eproto_deps[1] = {
+  &::descriptor_table_detections_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_detector_5fmodel_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_detector_5fmodel_2eproto = {
+    false, false, 2084, descriptor_table_protodef_detector_5fmodel_2eproto,
+    "detector_model.proto",
+    &descriptor_table_detector_5fmodel_2eproto_once, descriptor_table_detector_5fmodel_2eproto_deps, 1, 9,
+    schemas, file_default_instances, TableStruct_detector_5fmodel_2eproto::offsets,
+    file_level_metadata_detector_5fmodel_2eproto, file_level_enum_descriptors_detector_5fmodel_2eproto,
+    file_level_service_descriptors_detector_5fmodel_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_detector_5fmodel_2eproto_getter() {
+  return &descriptor_table_detector_5fmodel_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_detector_5fmodel_2eproto(&descriptor_table_detector_5fmodel_2eproto);
+namespace doppia_protobuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_detector_5fmodel_2eproto);
+  return file_level_enum_descriptors_detector_5fmodel_2eproto[0];
 }
-
-void LinearSvmModel::InitAsDefaultInstance() {
+bool SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 10:
+    case 100:
+      return true;
+    default:
+      return false;
+  }
 }
 
-LinearSvmModel::LinearSvmModel(const LinearSvmModel& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::Stumps;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::Level2DecisionTree;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::LevelNDecisionTree;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::FeatureTypes_MIN;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::FeatureTypes_MAX;
+constexpr int SoftCascadeOverIntegralChannelsStage::FeatureTypes_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DetectorModel_DetectorTypes_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_detector_5fmodel_2eproto);
+  return file_level_enum_descriptors_detector_5fmodel_2eproto[1];
 }
-
-void LinearSvmModel::SharedCtor() {
-  _cached_size_ = 0;
-  solved_type_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  number_of_classes_ = 0u;
-  number_of_features_ = 0u;
-  bias_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+bool DetectorModel_DetectorTypes_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 10:
+    case 20:
+      return true;
+    default:
+      return false;
+  }
 }
 
-LinearSvmModel::~LinearSvmModel() {
-  SharedDtor();
-}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr DetectorModel_DetectorTypes DetectorModel::LinearSvm;
+constexpr DetectorModel_DetectorTypes DetectorModel::SoftCascadeOverIntegralChannels;
+constexpr DetectorModel_DetectorTypes DetectorModel::HoughForest;
+constexpr DetectorModel_DetectorTypes DetectorModel::DetectorTypes_MIN;
+constexpr DetectorModel_DetectorTypes DetectorModel::DetectorTypes_MAX;
+constexpr int DetectorModel::DetectorTypes_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-void LinearSvmModel::SharedDtor() {
-  if (solved_type_ != &::google::protobuf::internal::kEmptyString) {
-    delete solved_type_;
+// ===================================================================
+
+class LinearSvmModel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LinearSvmModel>()._impl_._has_bits_);
+  static void set_has_solved_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (this != default_instance_) {
+  static void set_has_number_of_classes(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
+  static void set_has_number_of_features(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bias(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000008) ^ 0x00000008) != 0;
+  }
+};
 
-void LinearSvmModel::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+LinearSvmModel::LinearSvmModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.LinearSvmModel)
 }
-const ::google::protobuf::Descriptor* LinearSvmModel::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return LinearSvmModel_descriptor_;
+LinearSvmModel::LinearSvmModel(const LinearSvmModel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LinearSvmModel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.labels_){from._impl_.labels_}
+    , decltype(_impl_.w_){from._impl_.w_}
+    , decltype(_impl_.solved_type_){}
+    , decltype(_impl_.number_of_classes_){}
+    , decltype(_impl_.number_of_features_){}
+    , decltype(_impl_.bias_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.solved_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.solved_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_solved_type()) {
+    _this->_impl_.solved_type_.Set(from._internal_solved_type(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.number_of_classes_, &from._impl_.number_of_classes_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bias_) -
+    reinterpret_cast<char*>(&_impl_.number_of_classes_)) + sizeof(_impl_.bias_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.LinearSvmModel)
+}
+
+inline void LinearSvmModel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.labels_){arena}
+    , decltype(_impl_.w_){arena}
+    , decltype(_impl_.solved_type_){}
+    , decltype(_impl_.number_of_classes_){0u}
+    , decltype(_impl_.number_of_features_){0u}
+    , decltype(_impl_.bias_){0}
+  };
+  _impl_.solved_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.solved_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const LinearSvmModel& LinearSvmModel::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
+LinearSvmModel::~LinearSvmModel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.LinearSvmModel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-LinearSvmModel* LinearSvmModel::default_instance_ = NULL;
+inline void LinearSvmModel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.labels_.~RepeatedField();
+  _impl_.w_.~RepeatedField();
+  _impl_.solved_type_.Destroy();
+}
 
-LinearSvmModel* LinearSvmModel::New() const {
-  return new LinearSvmModel;
+void LinearSvmModel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void LinearSvmModel::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_solved_type()) {
-      if (solved_type_ != &::google::protobuf::internal::kEmptyString) {
-        solved_type_->clear();
-      }
-    }
-    number_of_classes_ = 0u;
-    number_of_features_ = 0u;
-    bias_ = 0;
-  }
-  labels_.Clear();
-  w_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool LinearSvmModel::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.LinearSvmModel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.labels_.Clear();
+  _impl_.w_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.solved_type_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.number_of_classes_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bias_) -
+        reinterpret_cast<char*>(&_impl_.number_of_classes_)) + sizeof(_impl_.bias_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LinearSvmModel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string solved_type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_solved_type()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->solved_type().data(), this->solved_type().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_number_of_classes;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_solved_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.LinearSvmModel.solved_type");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 number_of_classes = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_number_of_classes:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &number_of_classes_)));
-          set_has_number_of_classes();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_labels;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_number_of_classes(&has_bits);
+          _impl_.number_of_classes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated int32 labels = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_labels:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 1, 24, input, this->mutable_labels())));
-        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
-                   == ::google::protobuf::internal::WireFormatLite::
-                      WIRETYPE_LENGTH_DELIMITED) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, this->mutable_labels())));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_labels;
-        if (input->ExpectTag(32)) goto parse_number_of_features;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_labels(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<24>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 26) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_labels(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 number_of_features = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_number_of_features:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &number_of_features_)));
-          set_has_number_of_features();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_bias;
-        break;
-      }
-      
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_number_of_features(&has_bits);
+          _impl_.number_of_features_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required float bias = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_bias:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &bias_)));
-          set_has_bias();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(53)) goto parse_w;
-        break;
-      }
-      
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_bias(&has_bits);
+          _impl_.bias_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated float w = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_w:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 1, 53, input, this->mutable_w())));
-        } else if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag)
-                   == ::google::protobuf::internal::WireFormatLite::
-                      WIRETYPE_LENGTH_DELIMITED) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitiveNoInline<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, this->mutable_w())));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(53)) goto parse_w;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_w(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<53>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_w(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LinearSvmModel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.LinearSvmModel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string solved_type = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_solved_type().data(), static_cast<int>(this->_internal_solved_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.LinearSvmModel.solved_type");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_solved_type(), target);
   }
-  return true;
-#undef DO_
-}
 
-void LinearSvmModel::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string solved_type = 1;
-  if (has_solved_type()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->solved_type().data(), this->solved_type().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->solved_type(), output);
-  }
-  
   // optional uint32 number_of_classes = 2;
-  if (has_number_of_classes()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->number_of_classes(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_number_of_classes(), target);
   }
-  
+
   // repeated int32 labels = 3;
-  for (int i = 0; i < this->labels_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(
-      3, this->labels(i), output);
+  for (int i = 0, n = this->_internal_labels_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_labels(i), target);
   }
-  
+
   // optional uint32 number_of_features = 4;
-  if (has_number_of_features()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->number_of_features(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_number_of_features(), target);
   }
-  
+
   // required float bias = 5;
-  if (has_bias()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->bias(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_bias(), target);
   }
-  
+
   // repeated float w = 6;
-  for (int i = 0; i < this->w_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(
-      6, this->w(i), output);
+  for (int i = 0, n = this->_internal_w_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_w(i), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.LinearSvmModel)
+  return target;
 }
 
-::google::protobuf::uint8* LinearSvmModel::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string solved_type = 1;
-  if (has_solved_type()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->solved_type().data(), this->solved_type().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->solved_type(), target);
-  }
-  
-  // optional uint32 number_of_classes = 2;
-  if (has_number_of_classes()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->number_of_classes(), target);
+size_t LinearSvmModel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.LinearSvmModel)
+  size_t total_size = 0;
+
+  // required float bias = 5;
+  if (_internal_has_bias()) {
+    total_size += 1 + 4;
   }
-  
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated int32 labels = 3;
-  for (int i = 0; i < this->labels_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteInt32ToArray(3, this->labels(i), target);
-  }
-  
-  // optional uint32 number_of_features = 4;
-  if (has_number_of_features()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->number_of_features(), target);
-  }
-  
-  // required float bias = 5;
-  if (has_bias()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->bias(), target);
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.labels_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_labels_size());
+    total_size += data_size;
   }
-  
+
   // repeated float w = 6;
-  for (int i = 0; i < this->w_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteFloatToArray(6, this->w(i), target);
-  }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_w_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_w_size());
+    total_size += data_size;
   }
-  return target;
-}
 
-int LinearSvmModel::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
     // optional string solved_type = 1;
-    if (has_solved_type()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->solved_type());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_solved_type());
     }
-    
+
     // optional uint32 number_of_classes = 2;
-    if (has_number_of_classes()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->number_of_classes());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number_of_classes());
     }
-    
+
     // optional uint32 number_of_features = 4;
-    if (has_number_of_features()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->number_of_features());
-    }
-    
-    // required float bias = 5;
-    if (has_bias()) {
-      total_size += 1 + 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_number_of_features());
     }
-    
-  }
-  // repeated int32 labels = 3;
-  {
-    int data_size = 0;
-    for (int i = 0; i < this->labels_size(); i++) {
-      data_size += ::google::protobuf::internal::WireFormatLite::
-        Int32Size(this->labels(i));
-    }
-    total_size += 1 * this->labels_size() + data_size;
-  }
-  
-  // repeated float w = 6;
-  {
-    int data_size = 0;
-    data_size = 4 * this->w_size();
-    total_size += 1 * this->w_size() + data_size;
-  }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void LinearSvmModel::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const LinearSvmModel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const LinearSvmModel*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void LinearSvmModel::MergeFrom(const LinearSvmModel& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  labels_.MergeFrom(from.labels_);
-  w_.MergeFrom(from.w_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_solved_type()) {
-      set_solved_type(from.solved_type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LinearSvmModel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LinearSvmModel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LinearSvmModel::GetClassData() const { return &_class_data_; }
+
+
+void LinearSvmModel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LinearSvmModel*>(&to_msg);
+  auto& from = static_cast<const LinearSvmModel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.LinearSvmModel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.labels_.MergeFrom(from._impl_.labels_);
+  _this->_impl_.w_.MergeFrom(from._impl_.w_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_solved_type(from._internal_solved_type());
     }
-    if (from.has_number_of_classes()) {
-      set_number_of_classes(from.number_of_classes());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.number_of_classes_ = from._impl_.number_of_classes_;
     }
-    if (from.has_number_of_features()) {
-      set_number_of_features(from.number_of_features());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.number_of_features_ = from._impl_.number_of_features_;
     }
-    if (from.has_bias()) {
-      set_bias(from.bias());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.bias_ = from._impl_.bias_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void LinearSvmModel::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void LinearSvmModel::CopyFrom(const LinearSvmModel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.LinearSvmModel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool LinearSvmModel::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000010) != 0x00000010) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void LinearSvmModel::Swap(LinearSvmModel* other) {
-  if (other != this) {
-    std::swap(solved_type_, other->solved_type_);
-    std::swap(number_of_classes_, other->number_of_classes_);
-    labels_.Swap(&other->labels_);
-    std::swap(number_of_features_, other->number_of_features_);
-    std::swap(bias_, other->bias_);
-    w_.Swap(&other->w_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata LinearSvmModel::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = LinearSvmModel_descriptor_;
-  metadata.reflection = LinearSvmModel_reflection_;
-  return metadata;
+void LinearSvmModel::InternalSwap(LinearSvmModel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.labels_.InternalSwap(&other->_impl_.labels_);
+  _impl_.w_.InternalSwap(&other->_impl_.w_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.solved_type_, lhs_arena,
+      &other->_impl_.solved_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LinearSvmModel, _impl_.bias_)
+      + sizeof(LinearSvmModel::_impl_.bias_)
+      - PROTOBUF_FIELD_OFFSET(LinearSvmModel, _impl_.number_of_classes_)>(
+          reinterpret_cast<char*>(&_impl_.number_of_classes_),
+          reinterpret_cast<char*>(&other->_impl_.number_of_classes_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LinearSvmModel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int IntegralChannelsFeature::kChannelIndexFieldNumber;
-const int IntegralChannelsFeature::kBoxFieldNumber;
-#endif  // !_MSC_VER
+class IntegralChannelsFeature::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IntegralChannelsFeature>()._impl_._has_bits_);
+  static void set_has_channel_index(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::Box& box(const IntegralChannelsFeature* msg);
+  static void set_has_box(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-IntegralChannelsFeature::IntegralChannelsFeature()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::Box&
+IntegralChannelsFeature::_Internal::box(const IntegralChannelsFeature* msg) {
+  return *msg->_impl_.box_;
 }
-
-void IntegralChannelsFeature::InitAsDefaultInstance() {
-  box_ = const_cast< ::doppia_protobuf::Box*>(&::doppia_protobuf::Box::default_instance());
+void IntegralChannelsFeature::clear_box() {
+  if (_impl_.box_ != nullptr) _impl_.box_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-
-IntegralChannelsFeature::IntegralChannelsFeature(const IntegralChannelsFeature& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+IntegralChannelsFeature::IntegralChannelsFeature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.IntegralChannelsFeature)
 }
-
-void IntegralChannelsFeature::SharedCtor() {
-  _cached_size_ = 0;
-  channel_index_ = 0;
-  box_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+IntegralChannelsFeature::IntegralChannelsFeature(const IntegralChannelsFeature& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IntegralChannelsFeature* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.box_){nullptr}
+    , decltype(_impl_.channel_index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_box()) {
+    _this->_impl_.box_ = new ::doppia_protobuf::Box(*from._impl_.box_);
+  }
+  _this->_impl_.channel_index_ = from._impl_.channel_index_;
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.IntegralChannelsFeature)
+}
+
+inline void IntegralChannelsFeature::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.box_){nullptr}
+    , decltype(_impl_.channel_index_){0}
+  };
 }
 
 IntegralChannelsFeature::~IntegralChannelsFeature() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.IntegralChannelsFeature)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void IntegralChannelsFeature::SharedDtor() {
-  if (this != default_instance_) {
-    delete box_;
-  }
+inline void IntegralChannelsFeature::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.box_;
 }
 
 void IntegralChannelsFeature::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* IntegralChannelsFeature::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return IntegralChannelsFeature_descriptor_;
-}
-
-const IntegralChannelsFeature& IntegralChannelsFeature::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-IntegralChannelsFeature* IntegralChannelsFeature::default_instance_ = NULL;
-
-IntegralChannelsFeature* IntegralChannelsFeature::New() const {
-  return new IntegralChannelsFeature;
+  _impl_._cached_size_.Set(size);
 }
 
 void IntegralChannelsFeature::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    channel_index_ = 0;
-    if (has_box()) {
-      if (box_ != NULL) box_->::doppia_protobuf::Box::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool IntegralChannelsFeature::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.IntegralChannelsFeature)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.box_ != nullptr);
+    _impl_.box_->Clear();
+  }
+  _impl_.channel_index_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IntegralChannelsFeature::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required int32 channel_index = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &channel_index_)));
-          set_has_channel_index();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_box;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_channel_index(&has_bits);
+          _impl_.channel_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.Box box = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_box:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_box()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void IntegralChannelsFeature::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_box(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IntegralChannelsFeature::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.IntegralChannelsFeature)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required int32 channel_index = 1;
-  if (has_channel_index()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->channel_index(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_channel_index(), target);
   }
-  
-  // required .doppia_protobuf.Box box = 2;
-  if (has_box()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->box(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* IntegralChannelsFeature::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required int32 channel_index = 1;
-  if (has_channel_index()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->channel_index(), target);
-  }
-  
   // required .doppia_protobuf.Box box = 2;
-  if (has_box()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->box(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::box(this),
+        _Internal::box(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.IntegralChannelsFeature)
   return target;
 }
 
-int IntegralChannelsFeature::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required int32 channel_index = 1;
-    if (has_channel_index()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->channel_index());
-    }
-    
+size_t IntegralChannelsFeature::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.IntegralChannelsFeature)
+  size_t total_size = 0;
+
+  if (_internal_has_box()) {
     // required .doppia_protobuf.Box box = 2;
-    if (has_box()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->box());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.box_);
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_channel_index()) {
+    // required int32 channel_index = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_channel_index());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t IntegralChannelsFeature::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.IntegralChannelsFeature)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .doppia_protobuf.Box box = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.box_);
+
+    // required int32 channel_index = 1;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_channel_index());
 
-void IntegralChannelsFeature::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const IntegralChannelsFeature* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const IntegralChannelsFeature*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IntegralChannelsFeature::MergeFrom(const IntegralChannelsFeature& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_channel_index()) {
-      set_channel_index(from.channel_index());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IntegralChannelsFeature::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IntegralChannelsFeature::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IntegralChannelsFeature::GetClassData() const { return &_class_data_; }
+
+
+void IntegralChannelsFeature::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IntegralChannelsFeature*>(&to_msg);
+  auto& from = static_cast<const IntegralChannelsFeature&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.IntegralChannelsFeature)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_box()->::doppia_protobuf::Box::MergeFrom(
+          from._internal_box());
     }
-    if (from.has_box()) {
-      mutable_box()->::doppia_protobuf::Box::MergeFrom(from.box());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.channel_index_ = from._impl_.channel_index_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void IntegralChannelsFeature::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IntegralChannelsFeature::CopyFrom(const IntegralChannelsFeature& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.IntegralChannelsFeature)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool IntegralChannelsFeature::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_box()) {
-    if (!this->box().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_box()) {
+    if (!_impl_.box_->IsInitialized()) return false;
   }
   return true;
 }
 
-void IntegralChannelsFeature::Swap(IntegralChannelsFeature* other) {
-  if (other != this) {
-    std::swap(channel_index_, other->channel_index_);
-    std::swap(box_, other->box_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void IntegralChannelsFeature::InternalSwap(IntegralChannelsFeature* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IntegralChannelsFeature, _impl_.channel_index_)
+      + sizeof(IntegralChannelsFeature::_impl_.channel_index_)
+      - PROTOBUF_FIELD_OFFSET(IntegralChannelsFeature, _impl_.box_)>(
+          reinterpret_cast<char*>(&_impl_.box_),
+          reinterpret_cast<char*>(&other->_impl_.box_));
 }
 
-::google::protobuf::Metadata IntegralChannelsFeature::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = IntegralChannelsFeature_descriptor_;
-  metadata.reflection = IntegralChannelsFeature_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata IntegralChannelsFeature::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int IntegralChannelDecisionStump::kFeatureFieldNumber;
-const int IntegralChannelDecisionStump::kFeatureThresholdFieldNumber;
-const int IntegralChannelDecisionStump::kLargerThanThresholdFieldNumber;
-const int IntegralChannelDecisionStump::kTrueLeafWeightFieldNumber;
-const int IntegralChannelDecisionStump::kFalseLeafWeightFieldNumber;
-#endif  // !_MSC_VER
+class IntegralChannelDecisionStump::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IntegralChannelDecisionStump>()._impl_._has_bits_);
+  static const ::doppia_protobuf::IntegralChannelsFeature& feature(const IntegralChannelDecisionStump* msg);
+  static void set_has_feature(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_feature_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_larger_than_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_true_leaf_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_false_leaf_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-IntegralChannelDecisionStump::IntegralChannelDecisionStump()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::IntegralChannelsFeature&
+IntegralChannelDecisionStump::_Internal::feature(const IntegralChannelDecisionStump* msg) {
+  return *msg->_impl_.feature_;
 }
-
-void IntegralChannelDecisionStump::InitAsDefaultInstance() {
-  feature_ = const_cast< ::doppia_protobuf::IntegralChannelsFeature*>(&::doppia_protobuf::IntegralChannelsFeature::default_instance());
+IntegralChannelDecisionStump::IntegralChannelDecisionStump(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.IntegralChannelDecisionStump)
 }
-
 IntegralChannelDecisionStump::IntegralChannelDecisionStump(const IntegralChannelDecisionStump& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void IntegralChannelDecisionStump::SharedCtor() {
-  _cached_size_ = 0;
-  feature_ = NULL;
-  feature_threshold_ = 0;
-  larger_than_threshold_ = false;
-  true_leaf_weight_ = 0;
-  false_leaf_weight_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IntegralChannelDecisionStump* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.feature_){nullptr}
+    , decltype(_impl_.feature_threshold_){}
+    , decltype(_impl_.larger_than_threshold_){}
+    , decltype(_impl_.true_leaf_weight_){}
+    , decltype(_impl_.false_leaf_weight_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_feature()) {
+    _this->_impl_.feature_ = new ::doppia_protobuf::IntegralChannelsFeature(*from._impl_.feature_);
+  }
+  ::memcpy(&_impl_.feature_threshold_, &from._impl_.feature_threshold_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.false_leaf_weight_) -
+    reinterpret_cast<char*>(&_impl_.feature_threshold_)) + sizeof(_impl_.false_leaf_weight_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.IntegralChannelDecisionStump)
+}
+
+inline void IntegralChannelDecisionStump::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.feature_){nullptr}
+    , decltype(_impl_.feature_threshold_){0}
+    , decltype(_impl_.larger_than_threshold_){false}
+    , decltype(_impl_.true_leaf_weight_){0}
+    , decltype(_impl_.false_leaf_weight_){0}
+  };
 }
 
 IntegralChannelDecisionStump::~IntegralChannelDecisionStump() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.IntegralChannelDecisionStump)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void IntegralChannelDecisionStump::SharedDtor() {
-  if (this != default_instance_) {
-    delete feature_;
-  }
+inline void IntegralChannelDecisionStump::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.feature_;
 }
 
 void IntegralChannelDecisionStump::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* IntegralChannelDecisionStump::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return IntegralChannelDecisionStump_descriptor_;
-}
-
-const IntegralChannelDecisionStump& IntegralChannelDecisionStump::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-IntegralChannelDecisionStump* IntegralChannelDecisionStump::default_instance_ = NULL;
-
-IntegralChannelDecisionStump* IntegralChannelDecisionStump::New() const {
-  return new IntegralChannelDecisionStump;
+  _impl_._cached_size_.Set(size);
 }
 
 void IntegralChannelDecisionStump::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_feature()) {
-      if (feature_ != NULL) feature_->::doppia_protobuf::IntegralChannelsFeature::Clear();
-    }
-    feature_threshold_ = 0;
-    larger_than_threshold_ = false;
-    true_leaf_weight_ = 0;
-    false_leaf_weight_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool IntegralChannelDecisionStump::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.IntegralChannelDecisionStump)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.feature_ != nullptr);
+    _impl_.feature_->Clear();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.feature_threshold_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.false_leaf_weight_) -
+        reinterpret_cast<char*>(&_impl_.feature_threshold_)) + sizeof(_impl_.false_leaf_weight_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IntegralChannelDecisionStump::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_feature()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_feature_threshold;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_feature(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required float feature_threshold = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_feature_threshold:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &feature_threshold_)));
-          set_has_feature_threshold();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_larger_than_threshold;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_feature_threshold(&has_bits);
+          _impl_.feature_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool larger_than_threshold = 3 [default = false];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_larger_than_threshold:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &larger_than_threshold_)));
-          set_has_larger_than_threshold();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(85)) goto parse_true_leaf_weight;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_larger_than_threshold(&has_bits);
+          _impl_.larger_than_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float true_leaf_weight = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_true_leaf_weight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &true_leaf_weight_)));
-          set_has_true_leaf_weight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(93)) goto parse_false_leaf_weight;
-        break;
-      }
-      
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 85)) {
+          _Internal::set_has_true_leaf_weight(&has_bits);
+          _impl_.true_leaf_weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float false_leaf_weight = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_false_leaf_weight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &false_leaf_weight_)));
-          set_has_false_leaf_weight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void IntegralChannelDecisionStump::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 93)) {
+          _Internal::set_has_false_leaf_weight(&has_bits);
+          _impl_.false_leaf_weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IntegralChannelDecisionStump::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.IntegralChannelDecisionStump)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-  if (has_feature()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->feature(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::feature(this),
+        _Internal::feature(this).GetCachedSize(), target, stream);
   }
-  
+
   // required float feature_threshold = 2;
-  if (has_feature_threshold()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->feature_threshold(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_feature_threshold(), target);
   }
-  
+
   // optional bool larger_than_threshold = 3 [default = false];
-  if (has_larger_than_threshold()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->larger_than_threshold(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_larger_than_threshold(), target);
   }
-  
+
   // optional float true_leaf_weight = 10;
-  if (has_true_leaf_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(10, this->true_leaf_weight(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(10, this->_internal_true_leaf_weight(), target);
   }
-  
+
   // optional float false_leaf_weight = 11;
-  if (has_false_leaf_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(11, this->false_leaf_weight(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(11, this->_internal_false_leaf_weight(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.IntegralChannelDecisionStump)
+  return target;
 }
 
-::google::protobuf::uint8* IntegralChannelDecisionStump::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-  if (has_feature()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->feature(), target);
-  }
-  
-  // required float feature_threshold = 2;
-  if (has_feature_threshold()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->feature_threshold(), target);
-  }
-  
-  // optional bool larger_than_threshold = 3 [default = false];
-  if (has_larger_than_threshold()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->larger_than_threshold(), target);
-  }
-  
-  // optional float true_leaf_weight = 10;
-  if (has_true_leaf_weight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(10, this->true_leaf_weight(), target);
-  }
-  
-  // optional float false_leaf_weight = 11;
-  if (has_false_leaf_weight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(11, this->false_leaf_weight(), target);
+size_t IntegralChannelDecisionStump::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.IntegralChannelDecisionStump)
+  size_t total_size = 0;
+
+  if (_internal_has_feature()) {
+    // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.feature_);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_feature_threshold()) {
+    // required float feature_threshold = 2;
+    total_size += 1 + 4;
   }
-  return target;
+
+  return total_size;
 }
+size_t IntegralChannelDecisionStump::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.IntegralChannelDecisionStump)
+  size_t total_size = 0;
 
-int IntegralChannelDecisionStump::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
     // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-    if (has_feature()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->feature());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.feature_);
+
     // required float feature_threshold = 2;
-    if (has_feature_threshold()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001cu) {
     // optional bool larger_than_threshold = 3 [default = false];
-    if (has_larger_than_threshold()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 1;
     }
-    
+
     // optional float true_leaf_weight = 10;
-    if (has_true_leaf_weight()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 + 4;
     }
-    
+
     // optional float false_leaf_weight = 11;
-    if (has_false_leaf_weight()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 + 4;
     }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void IntegralChannelDecisionStump::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const IntegralChannelDecisionStump* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const IntegralChannelDecisionStump*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IntegralChannelDecisionStump::MergeFrom(const IntegralChannelDecisionStump& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_feature()) {
-      mutable_feature()->::doppia_protobuf::IntegralChannelsFeature::MergeFrom(from.feature());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IntegralChannelDecisionStump::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IntegralChannelDecisionStump::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IntegralChannelDecisionStump::GetClassData() const { return &_class_data_; }
+
+
+void IntegralChannelDecisionStump::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IntegralChannelDecisionStump*>(&to_msg);
+  auto& from = static_cast<const IntegralChannelDecisionStump&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.IntegralChannelDecisionStump)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_feature()->::doppia_protobuf::IntegralChannelsFeature::MergeFrom(
+          from._internal_feature());
     }
-    if (from.has_feature_threshold()) {
-      set_feature_threshold(from.feature_threshold());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.feature_threshold_ = from._impl_.feature_threshold_;
     }
-    if (from.has_larger_than_threshold()) {
-      set_larger_than_threshold(from.larger_than_threshold());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.larger_than_threshold_ = from._impl_.larger_than_threshold_;
     }
-    if (from.has_true_leaf_weight()) {
-      set_true_leaf_weight(from.true_leaf_weight());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.true_leaf_weight_ = from._impl_.true_leaf_weight_;
     }
-    if (from.has_false_leaf_weight()) {
-      set_false_leaf_weight(from.false_leaf_weight());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.false_leaf_weight_ = from._impl_.false_leaf_weight_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void IntegralChannelDecisionStump::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IntegralChannelDecisionStump::CopyFrom(const IntegralChannelDecisionStump& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.IntegralChannelDecisionStump)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool IntegralChannelDecisionStump::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_feature()) {
-    if (!this->feature().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_feature()) {
+    if (!_impl_.feature_->IsInitialized()) return false;
   }
   return true;
 }
 
-void IntegralChannelDecisionStump::Swap(IntegralChannelDecisionStump* other) {
-  if (other != this) {
-    std::swap(feature_, other->feature_);
-    std::swap(feature_threshold_, other->feature_threshold_);
-    std::swap(larger_than_threshold_, other->larger_than_threshold_);
-    std::swap(true_leaf_weight_, other->true_leaf_weight_);
-    std::swap(false_leaf_weight_, other->false_leaf_weight_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void IntegralChannelDecisionStump::InternalSwap(IntegralChannelDecisionStump* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IntegralChannelDecisionStump, _impl_.false_leaf_weight_)
+      + sizeof(IntegralChannelDecisionStump::_impl_.false_leaf_weight_)
+      - PROTOBUF_FIELD_OFFSET(IntegralChannelDecisionStump, _impl_.feature_)>(
+          reinterpret_cast<char*>(&_impl_.feature_),
+          reinterpret_cast<char*>(&other->_impl_.feature_));
 }
 
-::google::protobuf::Metadata IntegralChannelDecisionStump::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = IntegralChannelDecisionStump_descriptor_;
-  metadata.reflection = IntegralChannelDecisionStump_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata IntegralChannelDecisionStump::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int IntegralChannelBinaryDecisionTreeNode::kIdFieldNumber;
-const int IntegralChannelBinaryDecisionTreeNode::kParentIdFieldNumber;
-const int IntegralChannelBinaryDecisionTreeNode::kParentValueFieldNumber;
-const int IntegralChannelBinaryDecisionTreeNode::kDecisionStumpFieldNumber;
-#endif  // !_MSC_VER
+class IntegralChannelBinaryDecisionTreeNode::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IntegralChannelBinaryDecisionTreeNode>()._impl_._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_parent_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_parent_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump(const IntegralChannelBinaryDecisionTreeNode* msg);
+  static void set_has_decision_stump(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000006) ^ 0x00000006) != 0;
+  }
+};
 
-IntegralChannelBinaryDecisionTreeNode::IntegralChannelBinaryDecisionTreeNode()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::IntegralChannelDecisionStump&
+IntegralChannelBinaryDecisionTreeNode::_Internal::decision_stump(const IntegralChannelBinaryDecisionTreeNode* msg) {
+  return *msg->_impl_.decision_stump_;
 }
-
-void IntegralChannelBinaryDecisionTreeNode::InitAsDefaultInstance() {
-  decision_stump_ = const_cast< ::doppia_protobuf::IntegralChannelDecisionStump*>(&::doppia_protobuf::IntegralChannelDecisionStump::default_instance());
+IntegralChannelBinaryDecisionTreeNode::IntegralChannelBinaryDecisionTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
 }
-
 IntegralChannelBinaryDecisionTreeNode::IntegralChannelBinaryDecisionTreeNode(const IntegralChannelBinaryDecisionTreeNode& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void IntegralChannelBinaryDecisionTreeNode::SharedCtor() {
-  _cached_size_ = 0;
-  id_ = 0u;
-  parent_id_ = 0u;
-  parent_value_ = false;
-  decision_stump_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IntegralChannelBinaryDecisionTreeNode* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.decision_stump_){nullptr}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.parent_id_){}
+    , decltype(_impl_.parent_value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_decision_stump()) {
+    _this->_impl_.decision_stump_ = new ::doppia_protobuf::IntegralChannelDecisionStump(*from._impl_.decision_stump_);
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.parent_value_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.parent_value_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+}
+
+inline void IntegralChannelBinaryDecisionTreeNode::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.decision_stump_){nullptr}
+    , decltype(_impl_.id_){0u}
+    , decltype(_impl_.parent_id_){0u}
+    , decltype(_impl_.parent_value_){false}
+  };
 }
 
 IntegralChannelBinaryDecisionTreeNode::~IntegralChannelBinaryDecisionTreeNode() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void IntegralChannelBinaryDecisionTreeNode::SharedDtor() {
-  if (this != default_instance_) {
-    delete decision_stump_;
-  }
+inline void IntegralChannelBinaryDecisionTreeNode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.decision_stump_;
 }
 
 void IntegralChannelBinaryDecisionTreeNode::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* IntegralChannelBinaryDecisionTreeNode::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return IntegralChannelBinaryDecisionTreeNode_descriptor_;
-}
-
-const IntegralChannelBinaryDecisionTreeNode& IntegralChannelBinaryDecisionTreeNode::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTreeNode::default_instance_ = NULL;
-
-IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTreeNode::New() const {
-  return new IntegralChannelBinaryDecisionTreeNode;
+  _impl_._cached_size_.Set(size);
 }
 
 void IntegralChannelBinaryDecisionTreeNode::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    id_ = 0u;
-    parent_id_ = 0u;
-    parent_value_ = false;
-    if (has_decision_stump()) {
-      if (decision_stump_ != NULL) decision_stump_->::doppia_protobuf::IntegralChannelDecisionStump::Clear();
-    }
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool IntegralChannelBinaryDecisionTreeNode::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.decision_stump_ != nullptr);
+    _impl_.decision_stump_->Clear();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.parent_value_) -
+        reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.parent_value_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IntegralChannelBinaryDecisionTreeNode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint32 id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &id_)));
-          set_has_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_parent_id;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_id(&has_bits);
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 parent_id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_parent_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &parent_id_)));
-          set_has_parent_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_parent_value;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_parent_id(&has_bits);
+          _impl_.parent_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool parent_value = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_parent_value:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &parent_value_)));
-          set_has_parent_value();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_decision_stump;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_parent_value(&has_bits);
+          _impl_.parent_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_decision_stump:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_decision_stump()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void IntegralChannelBinaryDecisionTreeNode::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_decision_stump(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IntegralChannelBinaryDecisionTreeNode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint32 id = 1;
-  if (has_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->id(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
   }
-  
-  // required uint32 parent_id = 2;
-  if (has_parent_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->parent_id(), output);
-  }
-  
-  // optional bool parent_value = 3;
-  if (has_parent_value()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(3, this->parent_value(), output);
-  }
-  
-  // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-  if (has_decision_stump()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->decision_stump(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* IntegralChannelBinaryDecisionTreeNode::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 id = 1;
-  if (has_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->id(), target);
-  }
-  
   // required uint32 parent_id = 2;
-  if (has_parent_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->parent_id(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_parent_id(), target);
   }
-  
+
   // optional bool parent_value = 3;
-  if (has_parent_value()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(3, this->parent_value(), target);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_parent_value(), target);
   }
-  
+
   // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-  if (has_decision_stump()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->decision_stump(), target);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::decision_stump(this),
+        _Internal::decision_stump(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
   return target;
 }
 
-int IntegralChannelBinaryDecisionTreeNode::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t IntegralChannelBinaryDecisionTreeNode::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  size_t total_size = 0;
+
+  if (_internal_has_id()) {
     // required uint32 id = 1;
-    if (has_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->id());
-    }
-    
-    // required uint32 parent_id = 2;
-    if (has_parent_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->parent_id());
-    }
-    
-    // optional bool parent_value = 3;
-    if (has_parent_value()) {
-      total_size += 1 + 1;
-    }
-    
-    // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-    if (has_decision_stump()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->decision_stump());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_parent_id()) {
+    // required uint32 parent_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_id());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t IntegralChannelBinaryDecisionTreeNode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000006) ^ 0x00000006) == 0) {  // All required fields are present.
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+
+    // required uint32 parent_id = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_parent_id());
 
-void IntegralChannelBinaryDecisionTreeNode::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const IntegralChannelBinaryDecisionTreeNode* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const IntegralChannelBinaryDecisionTreeNode*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.decision_stump_);
+  }
+
+  // optional bool parent_value = 3;
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 1 + 1;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IntegralChannelBinaryDecisionTreeNode::MergeFrom(const IntegralChannelBinaryDecisionTreeNode& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_id()) {
-      set_id(from.id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IntegralChannelBinaryDecisionTreeNode::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IntegralChannelBinaryDecisionTreeNode::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IntegralChannelBinaryDecisionTreeNode::GetClassData() const { return &_class_data_; }
+
+
+void IntegralChannelBinaryDecisionTreeNode::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IntegralChannelBinaryDecisionTreeNode*>(&to_msg);
+  auto& from = static_cast<const IntegralChannelBinaryDecisionTreeNode&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_decision_stump()->::doppia_protobuf::IntegralChannelDecisionStump::MergeFrom(
+          from._internal_decision_stump());
     }
-    if (from.has_parent_id()) {
-      set_parent_id(from.parent_id());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.id_ = from._impl_.id_;
     }
-    if (from.has_parent_value()) {
-      set_parent_value(from.parent_value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.parent_id_ = from._impl_.parent_id_;
     }
-    if (from.has_decision_stump()) {
-      mutable_decision_stump()->::doppia_protobuf::IntegralChannelDecisionStump::MergeFrom(from.decision_stump());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.parent_value_ = from._impl_.parent_value_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void IntegralChannelBinaryDecisionTreeNode::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IntegralChannelBinaryDecisionTreeNode::CopyFrom(const IntegralChannelBinaryDecisionTreeNode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool IntegralChannelBinaryDecisionTreeNode::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_decision_stump()) {
-    if (!this->decision_stump().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_decision_stump()) {
+    if (!_impl_.decision_stump_->IsInitialized()) return false;
   }
   return true;
 }
 
-void IntegralChannelBinaryDecisionTreeNode::Swap(IntegralChannelBinaryDecisionTreeNode* other) {
-  if (other != this) {
-    std::swap(id_, other->id_);
-    std::swap(parent_id_, other->parent_id_);
-    std::swap(parent_value_, other->parent_value_);
-    std::swap(decision_stump_, other->decision_stump_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void IntegralChannelBinaryDecisionTreeNode::InternalSwap(IntegralChannelBinaryDecisionTreeNode* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, _impl_.parent_value_)
+      + sizeof(IntegralChannelBinaryDecisionTreeNode::_impl_.parent_value_)
+      - PROTOBUF_FIELD_OFFSET(IntegralChannelBinaryDecisionTreeNode, _impl_.decision_stump_)>(
+          reinterpret_cast<char*>(&_impl_.decision_stump_),
+          reinterpret_cast<char*>(&other->_impl_.decision_stump_));
 }
 
-::google::protobuf::Metadata IntegralChannelBinaryDecisionTreeNode::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = IntegralChannelBinaryDecisionTreeNode_descriptor_;
-  metadata.reflection = IntegralChannelBinaryDecisionTreeNode_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata IntegralChannelBinaryDecisionTreeNode::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int IntegralChannelBinaryDecisionTree::kNodesFieldNumber;
-#endif  // !_MSC_VER
-
-IntegralChannelBinaryDecisionTree::IntegralChannelBinaryDecisionTree()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class IntegralChannelBinaryDecisionTree::_Internal {
+ public:
+};
 
-void IntegralChannelBinaryDecisionTree::InitAsDefaultInstance() {
+IntegralChannelBinaryDecisionTree::IntegralChannelBinaryDecisionTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.IntegralChannelBinaryDecisionTree)
 }
-
 IntegralChannelBinaryDecisionTree::IntegralChannelBinaryDecisionTree(const IntegralChannelBinaryDecisionTree& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void IntegralChannelBinaryDecisionTree::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IntegralChannelBinaryDecisionTree* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+}
+
+inline void IntegralChannelBinaryDecisionTree::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 IntegralChannelBinaryDecisionTree::~IntegralChannelBinaryDecisionTree() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void IntegralChannelBinaryDecisionTree::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void IntegralChannelBinaryDecisionTree::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
 }
 
 void IntegralChannelBinaryDecisionTree::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* IntegralChannelBinaryDecisionTree::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return IntegralChannelBinaryDecisionTree_descriptor_;
-}
-
-const IntegralChannelBinaryDecisionTree& IntegralChannelBinaryDecisionTree::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-IntegralChannelBinaryDecisionTree* IntegralChannelBinaryDecisionTree::default_instance_ = NULL;
-
-IntegralChannelBinaryDecisionTree* IntegralChannelBinaryDecisionTree::New() const {
-  return new IntegralChannelBinaryDecisionTree;
+  _impl_._cached_size_.Set(size);
 }
 
 void IntegralChannelBinaryDecisionTree::Clear() {
-  nodes_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool IntegralChannelBinaryDecisionTree::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* IntegralChannelBinaryDecisionTree::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_nodes:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_nodes()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_nodes;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IntegralChannelBinaryDecisionTree::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void IntegralChannelBinaryDecisionTree::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->nodes(i), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* IntegralChannelBinaryDecisionTree::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
-  for (int i = 0; i < this->nodes_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->nodes(i), target);
-  }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.IntegralChannelBinaryDecisionTree)
   return target;
 }
 
-int IntegralChannelBinaryDecisionTree::ByteSize() const {
-  int total_size = 0;
-  
+size_t IntegralChannelBinaryDecisionTree::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
-  total_size += 1 * this->nodes_size();
-  for (int i = 0; i < this->nodes_size(); i++) {
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->nodes(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void IntegralChannelBinaryDecisionTree::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const IntegralChannelBinaryDecisionTree* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const IntegralChannelBinaryDecisionTree*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void IntegralChannelBinaryDecisionTree::MergeFrom(const IntegralChannelBinaryDecisionTree& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  nodes_.MergeFrom(from.nodes_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IntegralChannelBinaryDecisionTree::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IntegralChannelBinaryDecisionTree::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IntegralChannelBinaryDecisionTree::GetClassData() const { return &_class_data_; }
 
-void IntegralChannelBinaryDecisionTree::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void IntegralChannelBinaryDecisionTree::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IntegralChannelBinaryDecisionTree*>(&to_msg);
+  auto& from = static_cast<const IntegralChannelBinaryDecisionTree&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.IntegralChannelBinaryDecisionTree)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void IntegralChannelBinaryDecisionTree::CopyFrom(const IntegralChannelBinaryDecisionTree& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.IntegralChannelBinaryDecisionTree)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool IntegralChannelBinaryDecisionTree::IsInitialized() const {
-  
-  for (int i = 0; i < nodes_size(); i++) {
-    if (!this->nodes(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.nodes_))
+    return false;
   return true;
 }
 
-void IntegralChannelBinaryDecisionTree::Swap(IntegralChannelBinaryDecisionTree* other) {
-  if (other != this) {
-    nodes_.Swap(&other->nodes_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void IntegralChannelBinaryDecisionTree::InternalSwap(IntegralChannelBinaryDecisionTree* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
 }
 
-::google::protobuf::Metadata IntegralChannelBinaryDecisionTree::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = IntegralChannelBinaryDecisionTree_descriptor_;
-  metadata.reflection = IntegralChannelBinaryDecisionTree_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata IntegralChannelBinaryDecisionTree::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[4]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor_;
-}
-bool SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 10:
-    case 100:
-      return true;
-    default:
-      return false;
+class SoftCascadeOverIntegralChannelsStage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SoftCascadeOverIntegralChannelsStage>()._impl_._has_bits_);
+  static void set_has_feature_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
   }
-}
-
-#ifndef _MSC_VER
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::Stumps;
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::Level2DecisionTree;
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::LevelNDecisionTree;
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::FeatureTypes_MIN;
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::FeatureTypes_MAX;
-const int SoftCascadeOverIntegralChannelsStage::FeatureTypes_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int SoftCascadeOverIntegralChannelsStage::kFeatureTypeFieldNumber;
-const int SoftCascadeOverIntegralChannelsStage::kDecisionStumpFieldNumber;
-const int SoftCascadeOverIntegralChannelsStage::kLevel2DecisionTreeFieldNumber;
-const int SoftCascadeOverIntegralChannelsStage::kLevelNDecisionTreeFieldNumber;
-const int SoftCascadeOverIntegralChannelsStage::kWeightFieldNumber;
-const int SoftCascadeOverIntegralChannelsStage::kCascadeThresholdFieldNumber;
-#endif  // !_MSC_VER
+  static const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump(const SoftCascadeOverIntegralChannelsStage* msg);
+  static void set_has_decision_stump(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& level2_decision_tree(const SoftCascadeOverIntegralChannelsStage* msg);
+  static void set_has_level2_decision_tree(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& leveln_decision_tree(const SoftCascadeOverIntegralChannelsStage* msg);
+  static void set_has_leveln_decision_tree(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_weight(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cascade_threshold(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000038) ^ 0x00000038) != 0;
+  }
+};
 
-SoftCascadeOverIntegralChannelsStage::SoftCascadeOverIntegralChannelsStage()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::IntegralChannelDecisionStump&
+SoftCascadeOverIntegralChannelsStage::_Internal::decision_stump(const SoftCascadeOverIntegralChannelsStage* msg) {
+  return *msg->_impl_.decision_stump_;
 }
-
-void SoftCascadeOverIntegralChannelsStage::InitAsDefaultInstance() {
-  decision_stump_ = const_cast< ::doppia_protobuf::IntegralChannelDecisionStump*>(&::doppia_protobuf::IntegralChannelDecisionStump::default_instance());
-  level2_decision_tree_ = const_cast< ::doppia_protobuf::IntegralChannelBinaryDecisionTree*>(&::doppia_protobuf::IntegralChannelBinaryDecisionTree::default_instance());
-  leveln_decision_tree_ = const_cast< ::doppia_protobuf::IntegralChannelBinaryDecisionTree*>(&::doppia_protobuf::IntegralChannelBinaryDecisionTree::default_instance());
+const ::doppia_protobuf::IntegralChannelBinaryDecisionTree&
+SoftCascadeOverIntegralChannelsStage::_Internal::level2_decision_tree(const SoftCascadeOverIntegralChannelsStage* msg) {
+  return *msg->_impl_.level2_decision_tree_;
 }
-
-SoftCascadeOverIntegralChannelsStage::SoftCascadeOverIntegralChannelsStage(const SoftCascadeOverIntegralChannelsStage& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::doppia_protobuf::IntegralChannelBinaryDecisionTree&
+SoftCascadeOverIntegralChannelsStage::_Internal::leveln_decision_tree(const SoftCascadeOverIntegralChannelsStage* msg) {
+  return *msg->_impl_.leveln_decision_tree_;
 }
-
-void SoftCascadeOverIntegralChannelsStage::SharedCtor() {
-  _cached_size_ = 0;
-  feature_type_ = 0;
-  decision_stump_ = NULL;
-  level2_decision_tree_ = NULL;
-  leveln_decision_tree_ = NULL;
-  weight_ = 0;
-  cascade_threshold_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+SoftCascadeOverIntegralChannelsStage::SoftCascadeOverIntegralChannelsStage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+}
+SoftCascadeOverIntegralChannelsStage::SoftCascadeOverIntegralChannelsStage(const SoftCascadeOverIntegralChannelsStage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SoftCascadeOverIntegralChannelsStage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.decision_stump_){nullptr}
+    , decltype(_impl_.level2_decision_tree_){nullptr}
+    , decltype(_impl_.leveln_decision_tree_){nullptr}
+    , decltype(_impl_.feature_type_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.cascade_threshold_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_decision_stump()) {
+    _this->_impl_.decision_stump_ = new ::doppia_protobuf::IntegralChannelDecisionStump(*from._impl_.decision_stump_);
+  }
+  if (from._internal_has_level2_decision_tree()) {
+    _this->_impl_.level2_decision_tree_ = new ::doppia_protobuf::IntegralChannelBinaryDecisionTree(*from._impl_.level2_decision_tree_);
+  }
+  if (from._internal_has_leveln_decision_tree()) {
+    _this->_impl_.leveln_decision_tree_ = new ::doppia_protobuf::IntegralChannelBinaryDecisionTree(*from._impl_.leveln_decision_tree_);
+  }
+  ::memcpy(&_impl_.feature_type_, &from._impl_.feature_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.cascade_threshold_) -
+    reinterpret_cast<char*>(&_impl_.feature_type_)) + sizeof(_impl_.cascade_threshold_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+}
+
+inline void SoftCascadeOverIntegralChannelsStage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.decision_stump_){nullptr}
+    , decltype(_impl_.level2_decision_tree_){nullptr}
+    , decltype(_impl_.leveln_decision_tree_){nullptr}
+    , decltype(_impl_.feature_type_){0}
+    , decltype(_impl_.weight_){0}
+    , decltype(_impl_.cascade_threshold_){0}
+  };
 }
 
 SoftCascadeOverIntegralChannelsStage::~SoftCascadeOverIntegralChannelsStage() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SoftCascadeOverIntegralChannelsStage::SharedDtor() {
-  if (this != default_instance_) {
-    delete decision_stump_;
-    delete level2_decision_tree_;
-    delete leveln_decision_tree_;
-  }
+inline void SoftCascadeOverIntegralChannelsStage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.decision_stump_;
+  if (this != internal_default_instance()) delete _impl_.level2_decision_tree_;
+  if (this != internal_default_instance()) delete _impl_.leveln_decision_tree_;
 }
 
 void SoftCascadeOverIntegralChannelsStage::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SoftCascadeOverIntegralChannelsStage::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SoftCascadeOverIntegralChannelsStage_descriptor_;
-}
-
-const SoftCascadeOverIntegralChannelsStage& SoftCascadeOverIntegralChannelsStage::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsStage::default_instance_ = NULL;
-
-SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsStage::New() const {
-  return new SoftCascadeOverIntegralChannelsStage;
+  _impl_._cached_size_.Set(size);
 }
 
 void SoftCascadeOverIntegralChannelsStage::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    feature_type_ = 0;
-    if (has_decision_stump()) {
-      if (decision_stump_ != NULL) decision_stump_->::doppia_protobuf::IntegralChannelDecisionStump::Clear();
-    }
-    if (has_level2_decision_tree()) {
-      if (level2_decision_tree_ != NULL) level2_decision_tree_->::doppia_protobuf::IntegralChannelBinaryDecisionTree::Clear();
-    }
-    if (has_leveln_decision_tree()) {
-      if (leveln_decision_tree_ != NULL) leveln_decision_tree_->::doppia_protobuf::IntegralChannelBinaryDecisionTree::Clear();
-    }
-    weight_ = 0;
-    cascade_threshold_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SoftCascadeOverIntegralChannelsStage::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.decision_stump_ != nullptr);
+      _impl_.decision_stump_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.level2_decision_tree_ != nullptr);
+      _impl_.level2_decision_tree_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.leveln_decision_tree_ != nullptr);
+      _impl_.leveln_decision_tree_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.feature_type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.cascade_threshold_) -
+        reinterpret_cast<char*>(&_impl_.feature_type_)) + sizeof(_impl_.cascade_threshold_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SoftCascadeOverIntegralChannelsStage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(value)) {
-            set_feature_type(static_cast< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(val))) {
+            _internal_set_feature_type(static_cast<::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_weight;
-        break;
-      }
-      
+        } else
+          goto handle_unusual;
+        continue;
       // required float weight = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_weight:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &weight_)));
-          set_has_weight();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_cascade_threshold;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_weight(&has_bits);
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float cascade_threshold = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_cascade_threshold:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &cascade_threshold_)));
-          set_has_cascade_threshold();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(82)) goto parse_decision_stump;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_cascade_threshold(&has_bits);
+          _impl_.cascade_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_decision_stump:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_decision_stump()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(90)) goto parse_level2_decision_tree;
-        break;
-      }
-      
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_decision_stump(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_level2_decision_tree:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_level2_decision_tree()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(98)) goto parse_levelN_decision_tree;
-        break;
-      }
-      
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_level2_decision_tree(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-      case 12: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_levelN_decision_tree:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_leveln_decision_tree()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void SoftCascadeOverIntegralChannelsStage::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leveln_decision_tree(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SoftCascadeOverIntegralChannelsStage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-  if (has_feature_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->feature_type(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_feature_type(), target);
   }
-  
+
   // required float weight = 2;
-  if (has_weight()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->weight(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_weight(), target);
   }
-  
+
   // required float cascade_threshold = 3;
-  if (has_cascade_threshold()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->cascade_threshold(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_cascade_threshold(), target);
   }
-  
+
   // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-  if (has_decision_stump()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->decision_stump(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::decision_stump(this),
+        _Internal::decision_stump(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-  if (has_level2_decision_tree()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->level2_decision_tree(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::level2_decision_tree(this),
+        _Internal::level2_decision_tree(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-  if (has_leveln_decision_tree()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      12, this->leveln_decision_tree(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::leveln_decision_tree(this),
+        _Internal::leveln_decision_tree(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  return target;
 }
 
-::google::protobuf::uint8* SoftCascadeOverIntegralChannelsStage::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-  if (has_feature_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->feature_type(), target);
-  }
-  
-  // required float weight = 2;
-  if (has_weight()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->weight(), target);
-  }
-  
-  // required float cascade_threshold = 3;
-  if (has_cascade_threshold()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->cascade_threshold(), target);
-  }
-  
-  // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-  if (has_decision_stump()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        10, this->decision_stump(), target);
-  }
-  
-  // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-  if (has_level2_decision_tree()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        11, this->level2_decision_tree(), target);
+size_t SoftCascadeOverIntegralChannelsStage::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  size_t total_size = 0;
+
+  if (_internal_has_feature_type()) {
+    // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_feature_type());
   }
-  
-  // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-  if (has_leveln_decision_tree()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        12, this->leveln_decision_tree(), target);
+
+  if (_internal_has_weight()) {
+    // required float weight = 2;
+    total_size += 1 + 4;
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_cascade_threshold()) {
+    // required float cascade_threshold = 3;
+    total_size += 1 + 4;
   }
-  return target;
+
+  return total_size;
 }
+size_t SoftCascadeOverIntegralChannelsStage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  size_t total_size = 0;
 
-int SoftCascadeOverIntegralChannelsStage::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x00000038) ^ 0x00000038) == 0) {  // All required fields are present.
     // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-    if (has_feature_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->feature_type());
-    }
-    
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_feature_type());
+
+    // required float weight = 2;
+    total_size += 1 + 4;
+
+    // required float cascade_threshold = 3;
+    total_size += 1 + 4;
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
     // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-    if (has_decision_stump()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->decision_stump());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.decision_stump_);
     }
-    
+
     // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-    if (has_level2_decision_tree()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->level2_decision_tree());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.level2_decision_tree_);
     }
-    
+
     // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-    if (has_leveln_decision_tree()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->leveln_decision_tree());
-    }
-    
-    // required float weight = 2;
-    if (has_weight()) {
-      total_size += 1 + 4;
-    }
-    
-    // required float cascade_threshold = 3;
-    if (has_cascade_threshold()) {
-      total_size += 1 + 4;
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.leveln_decision_tree_);
     }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void SoftCascadeOverIntegralChannelsStage::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SoftCascadeOverIntegralChannelsStage* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SoftCascadeOverIntegralChannelsStage*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SoftCascadeOverIntegralChannelsStage::MergeFrom(const SoftCascadeOverIntegralChannelsStage& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_feature_type()) {
-      set_feature_type(from.feature_type());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SoftCascadeOverIntegralChannelsStage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SoftCascadeOverIntegralChannelsStage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SoftCascadeOverIntegralChannelsStage::GetClassData() const { return &_class_data_; }
+
+
+void SoftCascadeOverIntegralChannelsStage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SoftCascadeOverIntegralChannelsStage*>(&to_msg);
+  auto& from = static_cast<const SoftCascadeOverIntegralChannelsStage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_decision_stump()->::doppia_protobuf::IntegralChannelDecisionStump::MergeFrom(
+          from._internal_decision_stump());
     }
-    if (from.has_decision_stump()) {
-      mutable_decision_stump()->::doppia_protobuf::IntegralChannelDecisionStump::MergeFrom(from.decision_stump());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_level2_decision_tree()->::doppia_protobuf::IntegralChannelBinaryDecisionTree::MergeFrom(
+          from._internal_level2_decision_tree());
     }
-    if (from.has_level2_decision_tree()) {
-      mutable_level2_decision_tree()->::doppia_protobuf::IntegralChannelBinaryDecisionTree::MergeFrom(from.level2_decision_tree());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_leveln_decision_tree()->::doppia_protobuf::IntegralChannelBinaryDecisionTree::MergeFrom(
+          from._internal_leveln_decision_tree());
     }
-    if (from.has_leveln_decision_tree()) {
-      mutable_leveln_decision_tree()->::doppia_protobuf::IntegralChannelBinaryDecisionTree::MergeFrom(from.leveln_decision_tree());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.feature_type_ = from._impl_.feature_type_;
     }
-    if (from.has_weight()) {
-      set_weight(from.weight());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.weight_ = from._impl_.weight_;
     }
-    if (from.has_cascade_threshold()) {
-      set_cascade_threshold(from.cascade_threshold());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cascade_threshold_ = from._impl_.cascade_threshold_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SoftCascadeOverIntegralChannelsStage::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SoftCascadeOverIntegralChannelsStage::CopyFrom(const SoftCascadeOverIntegralChannelsStage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SoftCascadeOverIntegralChannelsStage::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000031) != 0x00000031) return false;
-  
-  if (has_decision_stump()) {
-    if (!this->decision_stump().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_decision_stump()) {
+    if (!_impl_.decision_stump_->IsInitialized()) return false;
   }
-  if (has_level2_decision_tree()) {
-    if (!this->level2_decision_tree().IsInitialized()) return false;
+  if (_internal_has_level2_decision_tree()) {
+    if (!_impl_.level2_decision_tree_->IsInitialized()) return false;
   }
-  if (has_leveln_decision_tree()) {
-    if (!this->leveln_decision_tree().IsInitialized()) return false;
+  if (_internal_has_leveln_decision_tree()) {
+    if (!_impl_.leveln_decision_tree_->IsInitialized()) return false;
   }
   return true;
 }
 
-void SoftCascadeOverIntegralChannelsStage::Swap(SoftCascadeOverIntegralChannelsStage* other) {
-  if (other != this) {
-    std::swap(feature_type_, other->feature_type_);
-    std::swap(decision_stump_, other->decision_stump_);
-    std::swap(level2_decision_tree_, other->level2_decision_tree_);
-    std::swap(leveln_decision_tree_, other->leveln_decision_tree_);
-    std::swap(weight_, other->weight_);
-    std::swap(cascade_threshold_, other->cascade_threshold_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SoftCascadeOverIntegralChannelsStage::InternalSwap(SoftCascadeOverIntegralChannelsStage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, _impl_.cascade_threshold_)
+      + sizeof(SoftCascadeOverIntegralChannelsStage::_impl_.cascade_threshold_)
+      - PROTOBUF_FIELD_OFFSET(SoftCascadeOverIntegralChannelsStage, _impl_.decision_stump_)>(
+          reinterpret_cast<char*>(&_impl_.decision_stump_),
+          reinterpret_cast<char*>(&other->_impl_.decision_stump_));
 }
 
-::google::protobuf::Metadata SoftCascadeOverIntegralChannelsStage::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SoftCascadeOverIntegralChannelsStage_descriptor_;
-  metadata.reflection = SoftCascadeOverIntegralChannelsStage_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SoftCascadeOverIntegralChannelsStage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[5]);
 }
 
-
 // ===================================================================
 
-const ::std::string SoftCascadeOverIntegralChannelsModel::_default_channels_description_("hog6_luv");
-#ifndef _MSC_VER
-const int SoftCascadeOverIntegralChannelsModel::kStagesFieldNumber;
-const int SoftCascadeOverIntegralChannelsModel::kChannelsDescriptionFieldNumber;
-const int SoftCascadeOverIntegralChannelsModel::kShrinkingFactorFieldNumber;
-#endif  // !_MSC_VER
-
-SoftCascadeOverIntegralChannelsModel::SoftCascadeOverIntegralChannelsModel()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class SoftCascadeOverIntegralChannelsModel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SoftCascadeOverIntegralChannelsModel>()._impl_._has_bits_);
+  static void set_has_channels_description(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shrinking_factor(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
 
-void SoftCascadeOverIntegralChannelsModel::InitAsDefaultInstance() {
+const ::PROTOBUF_NAMESPACE_ID::internal::LazyString SoftCascadeOverIntegralChannelsModel::Impl_::_i_give_permission_to_break_this_code_default_channels_description_{{{"hog6_luv", 8}}, {nullptr}};
+SoftCascadeOverIntegralChannelsModel::SoftCascadeOverIntegralChannelsModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
 }
-
 SoftCascadeOverIntegralChannelsModel::SoftCascadeOverIntegralChannelsModel(const SoftCascadeOverIntegralChannelsModel& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void SoftCascadeOverIntegralChannelsModel::SharedCtor() {
-  _cached_size_ = 0;
-  channels_description_ = const_cast< ::std::string*>(&_default_channels_description_);
-  shrinking_factor_ = 4u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SoftCascadeOverIntegralChannelsModel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stages_){from._impl_.stages_}
+    , decltype(_impl_.channels_scaling_exponents_){from._impl_.channels_scaling_exponents_}
+    , decltype(_impl_.channels_description_){}
+    , decltype(_impl_.shrinking_factor_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.channels_description_.InitDefault();
+  if (from._internal_has_channels_description()) {
+    _this->_impl_.channels_description_.Set(from._internal_channels_description(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.shrinking_factor_ = from._impl_.shrinking_factor_;
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+}
+
+inline void SoftCascadeOverIntegralChannelsModel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stages_){arena}
+    , decltype(_impl_.channels_scaling_exponents_){arena}
+    , decltype(_impl_.channels_description_){}
+    , decltype(_impl_.shrinking_factor_){4u}
+  };
+  _impl_.channels_description_.InitDefault();
 }
 
 SoftCascadeOverIntegralChannelsModel::~SoftCascadeOverIntegralChannelsModel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void SoftCascadeOverIntegralChannelsModel::SharedDtor() {
-  if (channels_description_ != &_default_channels_description_) {
-    delete channels_description_;
-  }
-  if (this != default_instance_) {
-  }
+inline void SoftCascadeOverIntegralChannelsModel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stages_.~RepeatedPtrField();
+  _impl_.channels_scaling_exponents_.~RepeatedField();
+  _impl_.channels_description_.Destroy();
 }
 
 void SoftCascadeOverIntegralChannelsModel::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* SoftCascadeOverIntegralChannelsModel::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return SoftCascadeOverIntegralChannelsModel_descriptor_;
-}
-
-const SoftCascadeOverIntegralChannelsModel& SoftCascadeOverIntegralChannelsModel::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-SoftCascadeOverIntegralChannelsModel* SoftCascadeOverIntegralChannelsModel::default_instance_ = NULL;
-
-SoftCascadeOverIntegralChannelsModel* SoftCascadeOverIntegralChannelsModel::New() const {
-  return new SoftCascadeOverIntegralChannelsModel;
+  _impl_._cached_size_.Set(size);
 }
 
 void SoftCascadeOverIntegralChannelsModel::Clear() {
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (has_channels_description()) {
-      if (channels_description_ != &_default_channels_description_) {
-        channels_description_->assign(_default_channels_description_);
-      }
-    }
-    shrinking_factor_ = 4u;
-  }
-  stages_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool SoftCascadeOverIntegralChannelsModel::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stages_.Clear();
+  _impl_.channels_scaling_exponents_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.channels_description_.ClearToDefault(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::Impl_::_i_give_permission_to_break_this_code_default_channels_description_, GetArenaForAllocation());
+       }
+    _impl_.shrinking_factor_ = 4u;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SoftCascadeOverIntegralChannelsModel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_stages:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_stages()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_stages;
-        if (input->ExpectTag(18)) goto parse_channels_description;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional string channels_description = 2 [default = "hog6_luv"];
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_channels_description:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_channels_description()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->channels_description().data(), this->channels_description().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_shrinking_factor;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_channels_description();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // optional uint32 shrinking_factor = 3 [default = 4];
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_shrinking_factor:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &shrinking_factor_)));
-          set_has_shrinking_factor();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shrinking_factor(&has_bits);
+          _impl_.shrinking_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float channels_scaling_exponents = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_channels_scaling_exponents(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+            ptr += sizeof(float);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<37>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 34) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_channels_scaling_exponents(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SoftCascadeOverIntegralChannelsModel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void SoftCascadeOverIntegralChannelsModel::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
-  for (int i = 0; i < this->stages_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->stages(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string channels_description = 2 [default = "hog6_luv"];
-  if (has_channels_description()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->channels_description().data(), this->channels_description().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->channels_description(), output);
-  }
-  
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_channels_description().data(), static_cast<int>(this->_internal_channels_description().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_channels_description(), target);
+  }
+
   // optional uint32 shrinking_factor = 3 [default = 4];
-  if (has_shrinking_factor()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->shrinking_factor(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_shrinking_factor(), target);
+  }
+
+  // repeated float channels_scaling_exponents = 4;
+  for (int i = 0, n = this->_internal_channels_scaling_exponents_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_channels_scaling_exponents(i), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  return target;
 }
 
-::google::protobuf::uint8* SoftCascadeOverIntegralChannelsModel::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t SoftCascadeOverIntegralChannelsModel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
-  for (int i = 0; i < this->stages_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->stages(i), target);
-  }
-  
-  // optional string channels_description = 2 [default = "hog6_luv"];
-  if (has_channels_description()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->channels_description().data(), this->channels_description().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->channels_description(), target);
-  }
-  
-  // optional uint32 shrinking_factor = 3 [default = 4];
-  if (has_shrinking_factor()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->shrinking_factor(), target);
+  total_size += 1UL * this->_internal_stages_size();
+  for (const auto& msg : this->_impl_.stages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  // repeated float channels_scaling_exponents = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_channels_scaling_exponents_size());
+    size_t data_size = 4UL * count;
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_channels_scaling_exponents_size());
+    total_size += data_size;
   }
-  return target;
-}
 
-int SoftCascadeOverIntegralChannelsModel::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[1 / 32] & (0xffu << (1 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
     // optional string channels_description = 2 [default = "hog6_luv"];
-    if (has_channels_description()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->channels_description());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_channels_description());
     }
-    
+
     // optional uint32 shrinking_factor = 3 [default = 4];
-    if (has_shrinking_factor()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->shrinking_factor());
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shrinking_factor());
     }
-    
-  }
-  // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
-  total_size += 1 * this->stages_size();
-  for (int i = 0; i < this->stages_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->stages(i));
-  }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void SoftCascadeOverIntegralChannelsModel::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const SoftCascadeOverIntegralChannelsModel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const SoftCascadeOverIntegralChannelsModel*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void SoftCascadeOverIntegralChannelsModel::MergeFrom(const SoftCascadeOverIntegralChannelsModel& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  stages_.MergeFrom(from.stages_);
-  if (from._has_bits_[1 / 32] & (0xffu << (1 % 32))) {
-    if (from.has_channels_description()) {
-      set_channels_description(from.channels_description());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SoftCascadeOverIntegralChannelsModel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SoftCascadeOverIntegralChannelsModel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SoftCascadeOverIntegralChannelsModel::GetClassData() const { return &_class_data_; }
+
+
+void SoftCascadeOverIntegralChannelsModel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SoftCascadeOverIntegralChannelsModel*>(&to_msg);
+  auto& from = static_cast<const SoftCascadeOverIntegralChannelsModel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stages_.MergeFrom(from._impl_.stages_);
+  _this->_impl_.channels_scaling_exponents_.MergeFrom(from._impl_.channels_scaling_exponents_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_channels_description(from._internal_channels_description());
     }
-    if (from.has_shrinking_factor()) {
-      set_shrinking_factor(from.shrinking_factor());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shrinking_factor_ = from._impl_.shrinking_factor_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void SoftCascadeOverIntegralChannelsModel::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void SoftCascadeOverIntegralChannelsModel::CopyFrom(const SoftCascadeOverIntegralChannelsModel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool SoftCascadeOverIntegralChannelsModel::IsInitialized() const {
-  
-  for (int i = 0; i < stages_size(); i++) {
-    if (!this->stages(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.stages_))
+    return false;
   return true;
 }
 
-void SoftCascadeOverIntegralChannelsModel::Swap(SoftCascadeOverIntegralChannelsModel* other) {
-  if (other != this) {
-    stages_.Swap(&other->stages_);
-    std::swap(channels_description_, other->channels_description_);
-    std::swap(shrinking_factor_, other->shrinking_factor_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void SoftCascadeOverIntegralChannelsModel::InternalSwap(SoftCascadeOverIntegralChannelsModel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stages_.InternalSwap(&other->_impl_.stages_);
+  _impl_.channels_scaling_exponents_.InternalSwap(&other->_impl_.channels_scaling_exponents_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channels_description_, lhs_arena,
+      &other->_impl_.channels_description_, rhs_arena
+  );
+  swap(_impl_.shrinking_factor_, other->_impl_.shrinking_factor_);
 }
 
-::google::protobuf::Metadata SoftCascadeOverIntegralChannelsModel::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = SoftCascadeOverIntegralChannelsModel_descriptor_;
-  metadata.reflection = SoftCascadeOverIntegralChannelsModel_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata SoftCascadeOverIntegralChannelsModel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[6]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* DetectorModel_DetectorTypes_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DetectorModel_DetectorTypes_descriptor_;
-}
-bool DetectorModel_DetectorTypes_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 10:
-    case 20:
-      return true;
-    default:
-      return false;
+class DetectorModel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DetectorModel>()._impl_._has_bits_);
+  static void set_has_detector_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-}
-
-#ifndef _MSC_VER
-const DetectorModel_DetectorTypes DetectorModel::LinearSvm;
-const DetectorModel_DetectorTypes DetectorModel::SoftCascadeOverIntegralChannels;
-const DetectorModel_DetectorTypes DetectorModel::HoughForest;
-const DetectorModel_DetectorTypes DetectorModel::DetectorTypes_MIN;
-const DetectorModel_DetectorTypes DetectorModel::DetectorTypes_MAX;
-const int DetectorModel::DetectorTypes_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int DetectorModel::kDetectorNameFieldNumber;
-const int DetectorModel::kTrainingDatasetNameFieldNumber;
-const int DetectorModel::kModelWindowSizeFieldNumber;
-const int DetectorModel::kObjectWindowFieldNumber;
-const int DetectorModel::kDetectorTypeFieldNumber;
-const int DetectorModel::kLinearSvmModelFieldNumber;
-const int DetectorModel::kSoftCascadeModelFieldNumber;
-const int DetectorModel::kScaleFieldNumber;
-#endif  // !_MSC_VER
+  static void set_has_training_dataset_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::Point2d& model_window_size(const DetectorModel* msg);
+  static void set_has_model_window_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::doppia_protobuf::Box& object_window(const DetectorModel* msg);
+  static void set_has_object_window(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_detector_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::doppia_protobuf::LinearSvmModel& linear_svm_model(const DetectorModel* msg);
+  static void set_has_linear_svm_model(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& soft_cascade_model(const DetectorModel* msg);
+  static void set_has_soft_cascade_model(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_scale(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000042) ^ 0x00000042) != 0;
+  }
+};
 
-DetectorModel::DetectorModel()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::Point2d&
+DetectorModel::_Internal::model_window_size(const DetectorModel* msg) {
+  return *msg->_impl_.model_window_size_;
 }
-
-void DetectorModel::InitAsDefaultInstance() {
-  model_window_size_ = const_cast< ::doppia_protobuf::Point2d*>(&::doppia_protobuf::Point2d::default_instance());
-  object_window_ = const_cast< ::doppia_protobuf::Box*>(&::doppia_protobuf::Box::default_instance());
-  linear_svm_model_ = const_cast< ::doppia_protobuf::LinearSvmModel*>(&::doppia_protobuf::LinearSvmModel::default_instance());
-  soft_cascade_model_ = const_cast< ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel*>(&::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::default_instance());
+const ::doppia_protobuf::Box&
+DetectorModel::_Internal::object_window(const DetectorModel* msg) {
+  return *msg->_impl_.object_window_;
 }
-
-DetectorModel::DetectorModel(const DetectorModel& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::doppia_protobuf::LinearSvmModel&
+DetectorModel::_Internal::linear_svm_model(const DetectorModel* msg) {
+  return *msg->_impl_.linear_svm_model_;
 }
-
-void DetectorModel::SharedCtor() {
-  _cached_size_ = 0;
-  detector_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  training_dataset_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  model_window_size_ = NULL;
-  object_window_ = NULL;
-  detector_type_ = 0;
-  linear_svm_model_ = NULL;
-  soft_cascade_model_ = NULL;
-  scale_ = 1;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel&
+DetectorModel::_Internal::soft_cascade_model(const DetectorModel* msg) {
+  return *msg->_impl_.soft_cascade_model_;
 }
-
-DetectorModel::~DetectorModel() {
-  SharedDtor();
+void DetectorModel::clear_model_window_size() {
+  if (_impl_.model_window_size_ != nullptr) _impl_.model_window_size_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-
-void DetectorModel::SharedDtor() {
-  if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete detector_name_;
-  }
-  if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete training_dataset_name_;
-  }
-  if (this != default_instance_) {
-    delete model_window_size_;
-    delete object_window_;
-    delete linear_svm_model_;
-    delete soft_cascade_model_;
-  }
+void DetectorModel::clear_object_window() {
+  if (_impl_.object_window_ != nullptr) _impl_.object_window_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-
-void DetectorModel::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+DetectorModel::DetectorModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.DetectorModel)
 }
-const ::google::protobuf::Descriptor* DetectorModel::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return DetectorModel_descriptor_;
+DetectorModel::DetectorModel(const DetectorModel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DetectorModel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detector_name_){}
+    , decltype(_impl_.training_dataset_name_){}
+    , decltype(_impl_.model_window_size_){nullptr}
+    , decltype(_impl_.object_window_){nullptr}
+    , decltype(_impl_.linear_svm_model_){nullptr}
+    , decltype(_impl_.soft_cascade_model_){nullptr}
+    , decltype(_impl_.detector_type_){}
+    , decltype(_impl_.scale_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.detector_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_detector_name()) {
+    _this->_impl_.detector_name_.Set(from._internal_detector_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.training_dataset_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_training_dataset_name()) {
+    _this->_impl_.training_dataset_name_.Set(from._internal_training_dataset_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_model_window_size()) {
+    _this->_impl_.model_window_size_ = new ::doppia_protobuf::Point2d(*from._impl_.model_window_size_);
+  }
+  if (from._internal_has_object_window()) {
+    _this->_impl_.object_window_ = new ::doppia_protobuf::Box(*from._impl_.object_window_);
+  }
+  if (from._internal_has_linear_svm_model()) {
+    _this->_impl_.linear_svm_model_ = new ::doppia_protobuf::LinearSvmModel(*from._impl_.linear_svm_model_);
+  }
+  if (from._internal_has_soft_cascade_model()) {
+    _this->_impl_.soft_cascade_model_ = new ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel(*from._impl_.soft_cascade_model_);
+  }
+  ::memcpy(&_impl_.detector_type_, &from._impl_.detector_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.scale_) -
+    reinterpret_cast<char*>(&_impl_.detector_type_)) + sizeof(_impl_.scale_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.DetectorModel)
+}
+
+inline void DetectorModel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detector_name_){}
+    , decltype(_impl_.training_dataset_name_){}
+    , decltype(_impl_.model_window_size_){nullptr}
+    , decltype(_impl_.object_window_){nullptr}
+    , decltype(_impl_.linear_svm_model_){nullptr}
+    , decltype(_impl_.soft_cascade_model_){nullptr}
+    , decltype(_impl_.detector_type_){0}
+    , decltype(_impl_.scale_){1}
+  };
+  _impl_.detector_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.training_dataset_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const DetectorModel& DetectorModel::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
+DetectorModel::~DetectorModel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.DetectorModel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-DetectorModel* DetectorModel::default_instance_ = NULL;
+inline void DetectorModel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.detector_name_.Destroy();
+  _impl_.training_dataset_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.model_window_size_;
+  if (this != internal_default_instance()) delete _impl_.object_window_;
+  if (this != internal_default_instance()) delete _impl_.linear_svm_model_;
+  if (this != internal_default_instance()) delete _impl_.soft_cascade_model_;
+}
 
-DetectorModel* DetectorModel::New() const {
-  return new DetectorModel;
+void DetectorModel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void DetectorModel::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_detector_name()) {
-      if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-        detector_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.DetectorModel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.detector_name_.ClearNonDefaultToEmpty();
     }
-    if (has_training_dataset_name()) {
-      if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-        training_dataset_name_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.training_dataset_name_.ClearNonDefaultToEmpty();
     }
-    if (has_model_window_size()) {
-      if (model_window_size_ != NULL) model_window_size_->::doppia_protobuf::Point2d::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.model_window_size_ != nullptr);
+      _impl_.model_window_size_->Clear();
     }
-    if (has_object_window()) {
-      if (object_window_ != NULL) object_window_->::doppia_protobuf::Box::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.object_window_ != nullptr);
+      _impl_.object_window_->Clear();
     }
-    detector_type_ = 0;
-    if (has_linear_svm_model()) {
-      if (linear_svm_model_ != NULL) linear_svm_model_->::doppia_protobuf::LinearSvmModel::Clear();
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.linear_svm_model_ != nullptr);
+      _impl_.linear_svm_model_->Clear();
     }
-    if (has_soft_cascade_model()) {
-      if (soft_cascade_model_ != NULL) soft_cascade_model_->::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::Clear();
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.soft_cascade_model_ != nullptr);
+      _impl_.soft_cascade_model_->Clear();
     }
-    scale_ = 1;
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x000000c0u) {
+    _impl_.detector_type_ = 0;
+    _impl_.scale_ = 1;
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool DetectorModel::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* DetectorModel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string detector_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_detector_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->detector_name().data(), this->detector_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_training_dataset_name;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_detector_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.DetectorModel.detector_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string training_dataset_name = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_training_dataset_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_training_dataset_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->training_dataset_name().data(), this->training_dataset_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_detector_type;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_training_dataset_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.DetectorModel.training_dataset_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_detector_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::doppia_protobuf::DetectorModel_DetectorTypes_IsValid(value)) {
-            set_detector_type(static_cast< ::doppia_protobuf::DetectorModel_DetectorTypes >(value));
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::doppia_protobuf::DetectorModel_DetectorTypes_IsValid(val))) {
+            _internal_set_detector_type(static_cast<::doppia_protobuf::DetectorModel_DetectorTypes>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(3, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(82)) goto parse_model_window_size;
-        break;
-      }
-      
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.Point2d model_window_size = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_model_window_size:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_model_window_size()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(90)) goto parse_object_window;
-        break;
-      }
-      
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_model_window_size(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.Box object_window = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_object_window:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_object_window()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(802)) goto parse_linear_svm_model;
-        break;
-      }
-      
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_object_window(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-      case 100: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_linear_svm_model:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_linear_svm_model()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(818)) goto parse_soft_cascade_model;
-        break;
-      }
-      
+      case 100:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_linear_svm_model(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-      case 102: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_soft_cascade_model:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_soft_cascade_model()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(1605)) goto parse_scale;
-        break;
-      }
-      
+      case 102:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_soft_cascade_model(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float scale = 200 [default = 1];
-      case 200: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_scale:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &scale_)));
-          set_has_scale();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+      case 200:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_scale(&has_bits);
+          _impl_.scale_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DetectorModel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.DetectorModel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string detector_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_detector_name().data(), static_cast<int>(this->_internal_detector_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.DetectorModel.detector_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_detector_name(), target);
   }
-  return true;
-#undef DO_
-}
 
-void DetectorModel::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string detector_name = 1;
-  if (has_detector_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->detector_name().data(), this->detector_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->detector_name(), output);
-  }
-  
   // required string training_dataset_name = 2;
-  if (has_training_dataset_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->training_dataset_name().data(), this->training_dataset_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->training_dataset_name(), output);
-  }
-  
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_training_dataset_name().data(), static_cast<int>(this->_internal_training_dataset_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.DetectorModel.training_dataset_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_training_dataset_name(), target);
+  }
+
   // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-  if (has_detector_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      3, this->detector_type(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_detector_type(), target);
   }
-  
+
   // optional .doppia_protobuf.Point2d model_window_size = 10;
-  if (has_model_window_size()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      10, this->model_window_size(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::model_window_size(this),
+        _Internal::model_window_size(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.Box object_window = 11;
-  if (has_object_window()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      11, this->object_window(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::object_window(this),
+        _Internal::object_window(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-  if (has_linear_svm_model()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      100, this->linear_svm_model(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(100, _Internal::linear_svm_model(this),
+        _Internal::linear_svm_model(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-  if (has_soft_cascade_model()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      102, this->soft_cascade_model(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(102, _Internal::soft_cascade_model(this),
+        _Internal::soft_cascade_model(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional float scale = 200 [default = 1];
-  if (has_scale()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(200, this->scale(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(200, this->_internal_scale(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.DetectorModel)
+  return target;
 }
 
-::google::protobuf::uint8* DetectorModel::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string detector_name = 1;
-  if (has_detector_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->detector_name().data(), this->detector_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->detector_name(), target);
-  }
-  
-  // required string training_dataset_name = 2;
-  if (has_training_dataset_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->training_dataset_name().data(), this->training_dataset_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->training_dataset_name(), target);
-  }
-  
-  // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-  if (has_detector_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      3, this->detector_type(), target);
-  }
-  
-  // optional .doppia_protobuf.Point2d model_window_size = 10;
-  if (has_model_window_size()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        10, this->model_window_size(), target);
-  }
-  
-  // optional .doppia_protobuf.Box object_window = 11;
-  if (has_object_window()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        11, this->object_window(), target);
-  }
-  
-  // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-  if (has_linear_svm_model()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        100, this->linear_svm_model(), target);
-  }
-  
-  // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-  if (has_soft_cascade_model()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        102, this->soft_cascade_model(), target);
-  }
-  
-  // optional float scale = 200 [default = 1];
-  if (has_scale()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(200, this->scale(), target);
+size_t DetectorModel::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.DetectorModel)
+  size_t total_size = 0;
+
+  if (_internal_has_training_dataset_name()) {
+    // required string training_dataset_name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_training_dataset_name());
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_detector_type()) {
+    // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_detector_type());
   }
-  return target;
+
+  return total_size;
 }
+size_t DetectorModel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.DetectorModel)
+  size_t total_size = 0;
 
-int DetectorModel::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string detector_name = 1;
-    if (has_detector_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->detector_name());
-    }
-    
+  if (((_impl_._has_bits_[0] & 0x00000042) ^ 0x00000042) == 0) {  // All required fields are present.
     // required string training_dataset_name = 2;
-    if (has_training_dataset_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->training_dataset_name());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_training_dataset_name());
+
+    // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_detector_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string detector_name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_detector_name());
+  }
+
+  if (cached_has_bits & 0x0000003cu) {
     // optional .doppia_protobuf.Point2d model_window_size = 10;
-    if (has_model_window_size()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->model_window_size());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.model_window_size_);
     }
-    
+
     // optional .doppia_protobuf.Box object_window = 11;
-    if (has_object_window()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->object_window());
-    }
-    
-    // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-    if (has_detector_type()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->detector_type());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.object_window_);
     }
-    
+
     // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-    if (has_linear_svm_model()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->linear_svm_model());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.linear_svm_model_);
     }
-    
+
     // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-    if (has_soft_cascade_model()) {
+    if (cached_has_bits & 0x00000020u) {
       total_size += 2 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->soft_cascade_model());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.soft_cascade_model_);
     }
-    
-    // optional float scale = 200 [default = 1];
-    if (has_scale()) {
-      total_size += 2 + 4;
-    }
-    
+
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional float scale = 200 [default = 1];
+  if (cached_has_bits & 0x00000080u) {
+    total_size += 2 + 4;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void DetectorModel::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const DetectorModel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const DetectorModel*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void DetectorModel::MergeFrom(const DetectorModel& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_detector_name()) {
-      set_detector_name(from.detector_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DetectorModel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DetectorModel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DetectorModel::GetClassData() const { return &_class_data_; }
+
+
+void DetectorModel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DetectorModel*>(&to_msg);
+  auto& from = static_cast<const DetectorModel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.DetectorModel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_detector_name(from._internal_detector_name());
     }
-    if (from.has_training_dataset_name()) {
-      set_training_dataset_name(from.training_dataset_name());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_training_dataset_name(from._internal_training_dataset_name());
     }
-    if (from.has_model_window_size()) {
-      mutable_model_window_size()->::doppia_protobuf::Point2d::MergeFrom(from.model_window_size());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_model_window_size()->::doppia_protobuf::Point2d::MergeFrom(
+          from._internal_model_window_size());
     }
-    if (from.has_object_window()) {
-      mutable_object_window()->::doppia_protobuf::Box::MergeFrom(from.object_window());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_object_window()->::doppia_protobuf::Box::MergeFrom(
+          from._internal_object_window());
     }
-    if (from.has_detector_type()) {
-      set_detector_type(from.detector_type());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_linear_svm_model()->::doppia_protobuf::LinearSvmModel::MergeFrom(
+          from._internal_linear_svm_model());
     }
-    if (from.has_linear_svm_model()) {
-      mutable_linear_svm_model()->::doppia_protobuf::LinearSvmModel::MergeFrom(from.linear_svm_model());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_soft_cascade_model()->::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::MergeFrom(
+          from._internal_soft_cascade_model());
     }
-    if (from.has_soft_cascade_model()) {
-      mutable_soft_cascade_model()->::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::MergeFrom(from.soft_cascade_model());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.detector_type_ = from._impl_.detector_type_;
     }
-    if (from.has_scale()) {
-      set_scale(from.scale());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.scale_ = from._impl_.scale_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void DetectorModel::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void DetectorModel::CopyFrom(const DetectorModel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.DetectorModel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool DetectorModel::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000012) != 0x00000012) return false;
-  
-  if (has_model_window_size()) {
-    if (!this->model_window_size().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_model_window_size()) {
+    if (!_impl_.model_window_size_->IsInitialized()) return false;
   }
-  if (has_object_window()) {
-    if (!this->object_window().IsInitialized()) return false;
+  if (_internal_has_object_window()) {
+    if (!_impl_.object_window_->IsInitialized()) return false;
   }
-  if (has_linear_svm_model()) {
-    if (!this->linear_svm_model().IsInitialized()) return false;
+  if (_internal_has_linear_svm_model()) {
+    if (!_impl_.linear_svm_model_->IsInitialized()) return false;
   }
-  if (has_soft_cascade_model()) {
-    if (!this->soft_cascade_model().IsInitialized()) return false;
+  if (_internal_has_soft_cascade_model()) {
+    if (!_impl_.soft_cascade_model_->IsInitialized()) return false;
   }
   return true;
 }
 
-void DetectorModel::Swap(DetectorModel* other) {
-  if (other != this) {
-    std::swap(detector_name_, other->detector_name_);
-    std::swap(training_dataset_name_, other->training_dataset_name_);
-    std::swap(model_window_size_, other->model_window_size_);
-    std::swap(object_window_, other->object_window_);
-    std::swap(detector_type_, other->detector_type_);
-    std::swap(linear_svm_model_, other->linear_svm_model_);
-    std::swap(soft_cascade_model_, other->soft_cascade_model_);
-    std::swap(scale_, other->scale_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata DetectorModel::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = DetectorModel_descriptor_;
-  metadata.reflection = DetectorModel_reflection_;
-  return metadata;
+void DetectorModel::InternalSwap(DetectorModel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.detector_name_, lhs_arena,
+      &other->_impl_.detector_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.training_dataset_name_, lhs_arena,
+      &other->_impl_.training_dataset_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DetectorModel, _impl_.detector_type_)
+      + sizeof(DetectorModel::_impl_.detector_type_)
+      - PROTOBUF_FIELD_OFFSET(DetectorModel, _impl_.model_window_size_)>(
+          reinterpret_cast<char*>(&_impl_.model_window_size_),
+          reinterpret_cast<char*>(&other->_impl_.model_window_size_));
+  swap(_impl_.scale_, other->_impl_.scale_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DetectorModel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[7]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int MultiScalesDetectorModel::kDetectorNameFieldNumber;
-const int MultiScalesDetectorModel::kTrainingDatasetNameFieldNumber;
-const int MultiScalesDetectorModel::kDetectorsFieldNumber;
-#endif  // !_MSC_VER
-
-MultiScalesDetectorModel::MultiScalesDetectorModel()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class MultiScalesDetectorModel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MultiScalesDetectorModel>()._impl_._has_bits_);
+  static void set_has_detector_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_training_dataset_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
 
-void MultiScalesDetectorModel::InitAsDefaultInstance() {
+MultiScalesDetectorModel::MultiScalesDetectorModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.MultiScalesDetectorModel)
 }
-
 MultiScalesDetectorModel::MultiScalesDetectorModel(const MultiScalesDetectorModel& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void MultiScalesDetectorModel::SharedCtor() {
-  _cached_size_ = 0;
-  detector_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  training_dataset_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiScalesDetectorModel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detectors_){from._impl_.detectors_}
+    , decltype(_impl_.detector_name_){}
+    , decltype(_impl_.training_dataset_name_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.detector_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_detector_name()) {
+    _this->_impl_.detector_name_.Set(from._internal_detector_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.training_dataset_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_training_dataset_name()) {
+    _this->_impl_.training_dataset_name_.Set(from._internal_training_dataset_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.MultiScalesDetectorModel)
+}
+
+inline void MultiScalesDetectorModel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.detectors_){arena}
+    , decltype(_impl_.detector_name_){}
+    , decltype(_impl_.training_dataset_name_){}
+  };
+  _impl_.detector_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.training_dataset_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 MultiScalesDetectorModel::~MultiScalesDetectorModel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.MultiScalesDetectorModel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void MultiScalesDetectorModel::SharedDtor() {
-  if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete detector_name_;
-  }
-  if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete training_dataset_name_;
-  }
-  if (this != default_instance_) {
-  }
+inline void MultiScalesDetectorModel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.detectors_.~RepeatedPtrField();
+  _impl_.detector_name_.Destroy();
+  _impl_.training_dataset_name_.Destroy();
 }
 
 void MultiScalesDetectorModel::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* MultiScalesDetectorModel::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return MultiScalesDetectorModel_descriptor_;
-}
-
-const MultiScalesDetectorModel& MultiScalesDetectorModel::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_detector_5fmodel_2eproto();  return *default_instance_;
-}
-
-MultiScalesDetectorModel* MultiScalesDetectorModel::default_instance_ = NULL;
-
-MultiScalesDetectorModel* MultiScalesDetectorModel::New() const {
-  return new MultiScalesDetectorModel;
+  _impl_._cached_size_.Set(size);
 }
 
 void MultiScalesDetectorModel::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_detector_name()) {
-      if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-        detector_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.MultiScalesDetectorModel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.detectors_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.detector_name_.ClearNonDefaultToEmpty();
     }
-    if (has_training_dataset_name()) {
-      if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-        training_dataset_name_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.training_dataset_name_.ClearNonDefaultToEmpty();
     }
   }
-  detectors_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool MultiScalesDetectorModel::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* MultiScalesDetectorModel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string detector_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_detector_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->detector_name().data(), this->detector_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_training_dataset_name;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_detector_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.MultiScalesDetectorModel.detector_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string training_dataset_name = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_training_dataset_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_training_dataset_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->training_dataset_name().data(), this->training_dataset_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_detectors;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_training_dataset_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.MultiScalesDetectorModel.training_dataset_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .doppia_protobuf.DetectorModel detectors = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_detectors:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_detectors()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_detectors;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_detectors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiScalesDetectorModel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.MultiScalesDetectorModel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string detector_name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_detector_name().data(), static_cast<int>(this->_internal_detector_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.MultiScalesDetectorModel.detector_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_detector_name(), target);
   }
-  return true;
-#undef DO_
-}
 
-void MultiScalesDetectorModel::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string detector_name = 1;
-  if (has_detector_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->detector_name().data(), this->detector_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->detector_name(), output);
-  }
-  
   // required string training_dataset_name = 2;
-  if (has_training_dataset_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->training_dataset_name().data(), this->training_dataset_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->training_dataset_name(), output);
-  }
-  
-  // repeated .doppia_protobuf.DetectorModel detectors = 3;
-  for (int i = 0; i < this->detectors_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->detectors(i), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_training_dataset_name().data(), static_cast<int>(this->_internal_training_dataset_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.MultiScalesDetectorModel.training_dataset_name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_training_dataset_name(), target);
   }
-}
 
-::google::protobuf::uint8* MultiScalesDetectorModel::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string detector_name = 1;
-  if (has_detector_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->detector_name().data(), this->detector_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->detector_name(), target);
-  }
-  
-  // required string training_dataset_name = 2;
-  if (has_training_dataset_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->training_dataset_name().data(), this->training_dataset_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->training_dataset_name(), target);
-  }
-  
   // repeated .doppia_protobuf.DetectorModel detectors = 3;
-  for (int i = 0; i < this->detectors_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->detectors(i), target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_detectors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_detectors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.MultiScalesDetectorModel)
   return target;
 }
 
-int MultiScalesDetectorModel::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string detector_name = 1;
-    if (has_detector_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->detector_name());
-    }
-    
-    // required string training_dataset_name = 2;
-    if (has_training_dataset_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->training_dataset_name());
-    }
-    
+size_t MultiScalesDetectorModel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.MultiScalesDetectorModel)
+  size_t total_size = 0;
+
+  // required string training_dataset_name = 2;
+  if (_internal_has_training_dataset_name()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_training_dataset_name());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.DetectorModel detectors = 3;
-  total_size += 1 * this->detectors_size();
-  for (int i = 0; i < this->detectors_size(); i++) {
+  total_size += 1UL * this->_internal_detectors_size();
+  for (const auto& msg : this->_impl_.detectors_) {
     total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->detectors(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void MultiScalesDetectorModel::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const MultiScalesDetectorModel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const MultiScalesDetectorModel*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+  // optional string detector_name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_detector_name());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void MultiScalesDetectorModel::MergeFrom(const MultiScalesDetectorModel& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  detectors_.MergeFrom(from.detectors_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_detector_name()) {
-      set_detector_name(from.detector_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiScalesDetectorModel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiScalesDetectorModel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiScalesDetectorModel::GetClassData() const { return &_class_data_; }
+
+
+void MultiScalesDetectorModel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiScalesDetectorModel*>(&to_msg);
+  auto& from = static_cast<const MultiScalesDetectorModel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.MultiScalesDetectorModel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.detectors_.MergeFrom(from._impl_.detectors_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_detector_name(from._internal_detector_name());
     }
-    if (from.has_training_dataset_name()) {
-      set_training_dataset_name(from.training_dataset_name());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_training_dataset_name(from._internal_training_dataset_name());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void MultiScalesDetectorModel::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void MultiScalesDetectorModel::CopyFrom(const MultiScalesDetectorModel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.MultiScalesDetectorModel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool MultiScalesDetectorModel::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000002) != 0x00000002) return false;
-  
-  for (int i = 0; i < detectors_size(); i++) {
-    if (!this->detectors(i).IsInitialized()) return false;
-  }
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.detectors_))
+    return false;
   return true;
 }
 
-void MultiScalesDetectorModel::Swap(MultiScalesDetectorModel* other) {
-  if (other != this) {
-    std::swap(detector_name_, other->detector_name_);
-    std::swap(training_dataset_name_, other->training_dataset_name_);
-    detectors_.Swap(&other->detectors_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void MultiScalesDetectorModel::InternalSwap(MultiScalesDetectorModel* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.detectors_.InternalSwap(&other->_impl_.detectors_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.detector_name_, lhs_arena,
+      &other->_impl_.detector_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.training_dataset_name_, lhs_arena,
+      &other->_impl_.training_dataset_name_, rhs_arena
+  );
 }
 
-::google::protobuf::Metadata MultiScalesDetectorModel::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = MultiScalesDetectorModel_descriptor_;
-  metadata.reflection = MultiScalesDetectorModel_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata MultiScalesDetectorModel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_detector_5fmodel_2eproto_getter, &descriptor_table_detector_5fmodel_2eproto_once,
+      file_level_metadata_detector_5fmodel_2eproto[8]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::LinearSvmModel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::LinearSvmModel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::LinearSvmModel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::IntegralChannelsFeature*
+Arena::CreateMaybeMessage< ::doppia_protobuf::IntegralChannelsFeature >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::IntegralChannelsFeature >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::IntegralChannelDecisionStump*
+Arena::CreateMaybeMessage< ::doppia_protobuf::IntegralChannelDecisionStump >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::IntegralChannelDecisionStump >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode*
+Arena::CreateMaybeMessage< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::IntegralChannelBinaryDecisionTree*
+Arena::CreateMaybeMessage< ::doppia_protobuf::IntegralChannelBinaryDecisionTree >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::IntegralChannelBinaryDecisionTree >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage*
+Arena::CreateMaybeMessage< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::DetectorModel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::DetectorModel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::DetectorModel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::MultiScalesDetectorModel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::MultiScalesDetectorModel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::MultiScalesDetectorModel >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
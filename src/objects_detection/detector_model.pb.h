@@ -1,1395 +1,2487 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: detector_model.proto
 
-#ifndef PROTOBUF_detector_5fmodel_2eproto__INCLUDED
-#define PROTOBUF_detector_5fmodel_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_detector_5fmodel_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_detector_5fmodel_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
 #include "detections.pb.h"
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_detector_5fmodel_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_detector_5fmodel_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_detector_5fmodel_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_detector_5fmodel_2eproto();
-void protobuf_AssignDesc_detector_5fmodel_2eproto();
-void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-
-class LinearSvmModel;
-class IntegralChannelsFeature;
-class IntegralChannelDecisionStump;
-class IntegralChannelBinaryDecisionTreeNode;
-class IntegralChannelBinaryDecisionTree;
-class SoftCascadeOverIntegralChannelsStage;
-class SoftCascadeOverIntegralChannelsModel;
 class DetectorModel;
+struct DetectorModelDefaultTypeInternal;
+extern DetectorModelDefaultTypeInternal _DetectorModel_default_instance_;
+class IntegralChannelBinaryDecisionTree;
+struct IntegralChannelBinaryDecisionTreeDefaultTypeInternal;
+extern IntegralChannelBinaryDecisionTreeDefaultTypeInternal _IntegralChannelBinaryDecisionTree_default_instance_;
+class IntegralChannelBinaryDecisionTreeNode;
+struct IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal;
+extern IntegralChannelBinaryDecisionTreeNodeDefaultTypeInternal _IntegralChannelBinaryDecisionTreeNode_default_instance_;
+class IntegralChannelDecisionStump;
+struct IntegralChannelDecisionStumpDefaultTypeInternal;
+extern IntegralChannelDecisionStumpDefaultTypeInternal _IntegralChannelDecisionStump_default_instance_;
+class IntegralChannelsFeature;
+struct IntegralChannelsFeatureDefaultTypeInternal;
+extern IntegralChannelsFeatureDefaultTypeInternal _IntegralChannelsFeature_default_instance_;
+class LinearSvmModel;
+struct LinearSvmModelDefaultTypeInternal;
+extern LinearSvmModelDefaultTypeInternal _LinearSvmModel_default_instance_;
 class MultiScalesDetectorModel;
+struct MultiScalesDetectorModelDefaultTypeInternal;
+extern MultiScalesDetectorModelDefaultTypeInternal _MultiScalesDetectorModel_default_instance_;
+class SoftCascadeOverIntegralChannelsModel;
+struct SoftCascadeOverIntegralChannelsModelDefaultTypeInternal;
+extern SoftCascadeOverIntegralChannelsModelDefaultTypeInternal _SoftCascadeOverIntegralChannelsModel_default_instance_;
+class SoftCascadeOverIntegralChannelsStage;
+struct SoftCascadeOverIntegralChannelsStageDefaultTypeInternal;
+extern SoftCascadeOverIntegralChannelsStageDefaultTypeInternal _SoftCascadeOverIntegralChannelsStage_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::DetectorModel* Arena::CreateMaybeMessage<::doppia_protobuf::DetectorModel>(Arena*);
+template<> ::doppia_protobuf::IntegralChannelBinaryDecisionTree* Arena::CreateMaybeMessage<::doppia_protobuf::IntegralChannelBinaryDecisionTree>(Arena*);
+template<> ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* Arena::CreateMaybeMessage<::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode>(Arena*);
+template<> ::doppia_protobuf::IntegralChannelDecisionStump* Arena::CreateMaybeMessage<::doppia_protobuf::IntegralChannelDecisionStump>(Arena*);
+template<> ::doppia_protobuf::IntegralChannelsFeature* Arena::CreateMaybeMessage<::doppia_protobuf::IntegralChannelsFeature>(Arena*);
+template<> ::doppia_protobuf::LinearSvmModel* Arena::CreateMaybeMessage<::doppia_protobuf::LinearSvmModel>(Arena*);
+template<> ::doppia_protobuf::MultiScalesDetectorModel* Arena::CreateMaybeMessage<::doppia_protobuf::MultiScalesDetectorModel>(Arena*);
+template<> ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* Arena::CreateMaybeMessage<::doppia_protobuf::SoftCascadeOverIntegralChannelsModel>(Arena*);
+template<> ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* Arena::CreateMaybeMessage<::doppia_protobuf::SoftCascadeOverIntegralChannelsStage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
-enum SoftCascadeOverIntegralChannelsStage_FeatureTypes {
+enum SoftCascadeOverIntegralChannelsStage_FeatureTypes : int {
   SoftCascadeOverIntegralChannelsStage_FeatureTypes_Stumps = 0,
   SoftCascadeOverIntegralChannelsStage_FeatureTypes_Level2DecisionTree = 10,
   SoftCascadeOverIntegralChannelsStage_FeatureTypes_LevelNDecisionTree = 100
 };
 bool SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(int value);
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MIN = SoftCascadeOverIntegralChannelsStage_FeatureTypes_Stumps;
-const SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MAX = SoftCascadeOverIntegralChannelsStage_FeatureTypes_LevelNDecisionTree;
-const int SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_ARRAYSIZE = SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MAX + 1;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MIN = SoftCascadeOverIntegralChannelsStage_FeatureTypes_Stumps;
+constexpr SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MAX = SoftCascadeOverIntegralChannelsStage_FeatureTypes_LevelNDecisionTree;
+constexpr int SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_ARRAYSIZE = SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MAX + 1;
 
-const ::google::protobuf::EnumDescriptor* SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor();
-inline const ::std::string& SoftCascadeOverIntegralChannelsStage_FeatureTypes_Name(SoftCascadeOverIntegralChannelsStage_FeatureTypes value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor(), value);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor();
+template<typename T>
+inline const std::string& SoftCascadeOverIntegralChannelsStage_FeatureTypes_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, SoftCascadeOverIntegralChannelsStage_FeatureTypes>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function SoftCascadeOverIntegralChannelsStage_FeatureTypes_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor(), enum_t_value);
 }
 inline bool SoftCascadeOverIntegralChannelsStage_FeatureTypes_Parse(
-    const ::std::string& name, SoftCascadeOverIntegralChannelsStage_FeatureTypes* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<SoftCascadeOverIntegralChannelsStage_FeatureTypes>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, SoftCascadeOverIntegralChannelsStage_FeatureTypes* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<SoftCascadeOverIntegralChannelsStage_FeatureTypes>(
     SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor(), name, value);
 }
-enum DetectorModel_DetectorTypes {
+enum DetectorModel_DetectorTypes : int {
   DetectorModel_DetectorTypes_LinearSvm = 0,
   DetectorModel_DetectorTypes_SoftCascadeOverIntegralChannels = 10,
   DetectorModel_DetectorTypes_HoughForest = 20
 };
 bool DetectorModel_DetectorTypes_IsValid(int value);
-const DetectorModel_DetectorTypes DetectorModel_DetectorTypes_DetectorTypes_MIN = DetectorModel_DetectorTypes_LinearSvm;
-const DetectorModel_DetectorTypes DetectorModel_DetectorTypes_DetectorTypes_MAX = DetectorModel_DetectorTypes_HoughForest;
-const int DetectorModel_DetectorTypes_DetectorTypes_ARRAYSIZE = DetectorModel_DetectorTypes_DetectorTypes_MAX + 1;
+constexpr DetectorModel_DetectorTypes DetectorModel_DetectorTypes_DetectorTypes_MIN = DetectorModel_DetectorTypes_LinearSvm;
+constexpr DetectorModel_DetectorTypes DetectorModel_DetectorTypes_DetectorTypes_MAX = DetectorModel_DetectorTypes_HoughForest;
+constexpr int DetectorModel_DetectorTypes_DetectorTypes_ARRAYSIZE = DetectorModel_DetectorTypes_DetectorTypes_MAX + 1;
 
-const ::google::protobuf::EnumDescriptor* DetectorModel_DetectorTypes_descriptor();
-inline const ::std::string& DetectorModel_DetectorTypes_Name(DetectorModel_DetectorTypes value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    DetectorModel_DetectorTypes_descriptor(), value);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* DetectorModel_DetectorTypes_descriptor();
+template<typename T>
+inline const std::string& DetectorModel_DetectorTypes_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, DetectorModel_DetectorTypes>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function DetectorModel_DetectorTypes_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    DetectorModel_DetectorTypes_descriptor(), enum_t_value);
 }
 inline bool DetectorModel_DetectorTypes_Parse(
-    const ::std::string& name, DetectorModel_DetectorTypes* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<DetectorModel_DetectorTypes>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, DetectorModel_DetectorTypes* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<DetectorModel_DetectorTypes>(
     DetectorModel_DetectorTypes_descriptor(), name, value);
 }
 // ===================================================================
 
-class LinearSvmModel : public ::google::protobuf::Message {
+class LinearSvmModel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.LinearSvmModel) */ {
  public:
-  LinearSvmModel();
-  virtual ~LinearSvmModel();
-  
+  inline LinearSvmModel() : LinearSvmModel(nullptr) {}
+  ~LinearSvmModel() override;
+  explicit PROTOBUF_CONSTEXPR LinearSvmModel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   LinearSvmModel(const LinearSvmModel& from);
-  
+  LinearSvmModel(LinearSvmModel&& from) noexcept
+    : LinearSvmModel() {
+    *this = ::std::move(from);
+  }
+
   inline LinearSvmModel& operator=(const LinearSvmModel& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline LinearSvmModel& operator=(LinearSvmModel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LinearSvmModel& default_instance();
-  
-  void Swap(LinearSvmModel* other);
-  
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LinearSvmModel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LinearSvmModel* internal_default_instance() {
+    return reinterpret_cast<const LinearSvmModel*>(
+               &_LinearSvmModel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(LinearSvmModel& a, LinearSvmModel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LinearSvmModel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LinearSvmModel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  LinearSvmModel* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  LinearSvmModel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LinearSvmModel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LinearSvmModel& from);
-  void MergeFrom(const LinearSvmModel& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LinearSvmModel& from) {
+    LinearSvmModel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LinearSvmModel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.LinearSvmModel";
+  }
+  protected:
+  explicit LinearSvmModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
-  // optional string solved_type = 1;
-  inline bool has_solved_type() const;
-  inline void clear_solved_type();
-  static const int kSolvedTypeFieldNumber = 1;
-  inline const ::std::string& solved_type() const;
-  inline void set_solved_type(const ::std::string& value);
-  inline void set_solved_type(const char* value);
-  inline void set_solved_type(const char* value, size_t size);
-  inline ::std::string* mutable_solved_type();
-  inline ::std::string* release_solved_type();
-  
-  // optional uint32 number_of_classes = 2;
-  inline bool has_number_of_classes() const;
-  inline void clear_number_of_classes();
-  static const int kNumberOfClassesFieldNumber = 2;
-  inline ::google::protobuf::uint32 number_of_classes() const;
-  inline void set_number_of_classes(::google::protobuf::uint32 value);
-  
+
+  enum : int {
+    kLabelsFieldNumber = 3,
+    kWFieldNumber = 6,
+    kSolvedTypeFieldNumber = 1,
+    kNumberOfClassesFieldNumber = 2,
+    kNumberOfFeaturesFieldNumber = 4,
+    kBiasFieldNumber = 5,
+  };
   // repeated int32 labels = 3;
-  inline int labels_size() const;
-  inline void clear_labels();
-  static const int kLabelsFieldNumber = 3;
-  inline ::google::protobuf::int32 labels(int index) const;
-  inline void set_labels(int index, ::google::protobuf::int32 value);
-  inline void add_labels(::google::protobuf::int32 value);
-  inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+  int labels_size() const;
+  private:
+  int _internal_labels_size() const;
+  public:
+  void clear_labels();
+  private:
+  int32_t _internal_labels(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_labels() const;
+  void _internal_add_labels(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_labels();
+  public:
+  int32_t labels(int index) const;
+  void set_labels(int index, int32_t value);
+  void add_labels(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
       labels() const;
-  inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
       mutable_labels();
-  
-  // optional uint32 number_of_features = 4;
-  inline bool has_number_of_features() const;
-  inline void clear_number_of_features();
-  static const int kNumberOfFeaturesFieldNumber = 4;
-  inline ::google::protobuf::uint32 number_of_features() const;
-  inline void set_number_of_features(::google::protobuf::uint32 value);
-  
-  // required float bias = 5;
-  inline bool has_bias() const;
-  inline void clear_bias();
-  static const int kBiasFieldNumber = 5;
-  inline float bias() const;
-  inline void set_bias(float value);
-  
+
   // repeated float w = 6;
-  inline int w_size() const;
-  inline void clear_w();
-  static const int kWFieldNumber = 6;
-  inline float w(int index) const;
-  inline void set_w(int index, float value);
-  inline void add_w(float value);
-  inline const ::google::protobuf::RepeatedField< float >&
+  int w_size() const;
+  private:
+  int _internal_w_size() const;
+  public:
+  void clear_w();
+  private:
+  float _internal_w(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_w() const;
+  void _internal_add_w(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_w();
+  public:
+  float w(int index) const;
+  void set_w(int index, float value);
+  void add_w(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
       w() const;
-  inline ::google::protobuf::RepeatedField< float >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_w();
-  
+
+  // optional string solved_type = 1;
+  bool has_solved_type() const;
+  private:
+  bool _internal_has_solved_type() const;
+  public:
+  void clear_solved_type();
+  const std::string& solved_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_solved_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_solved_type();
+  PROTOBUF_NODISCARD std::string* release_solved_type();
+  void set_allocated_solved_type(std::string* solved_type);
+  private:
+  const std::string& _internal_solved_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_solved_type(const std::string& value);
+  std::string* _internal_mutable_solved_type();
+  public:
+
+  // optional uint32 number_of_classes = 2;
+  bool has_number_of_classes() const;
+  private:
+  bool _internal_has_number_of_classes() const;
+  public:
+  void clear_number_of_classes();
+  uint32_t number_of_classes() const;
+  void set_number_of_classes(uint32_t value);
+  private:
+  uint32_t _internal_number_of_classes() const;
+  void _internal_set_number_of_classes(uint32_t value);
+  public:
+
+  // optional uint32 number_of_features = 4;
+  bool has_number_of_features() const;
+  private:
+  bool _internal_has_number_of_features() const;
+  public:
+  void clear_number_of_features();
+  uint32_t number_of_features() const;
+  void set_number_of_features(uint32_t value);
+  private:
+  uint32_t _internal_number_of_features() const;
+  void _internal_set_number_of_features(uint32_t value);
+  public:
+
+  // required float bias = 5;
+  bool has_bias() const;
+  private:
+  bool _internal_has_bias() const;
+  public:
+  void clear_bias();
+  float bias() const;
+  void set_bias(float value);
+  private:
+  float _internal_bias() const;
+  void _internal_set_bias(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.LinearSvmModel)
  private:
-  inline void set_has_solved_type();
-  inline void clear_has_solved_type();
-  inline void set_has_number_of_classes();
-  inline void clear_has_number_of_classes();
-  inline void set_has_number_of_features();
-  inline void clear_has_number_of_features();
-  inline void set_has_bias();
-  inline void clear_has_bias();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* solved_type_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > labels_;
-  ::google::protobuf::uint32 number_of_classes_;
-  ::google::protobuf::uint32 number_of_features_;
-  ::google::protobuf::RepeatedField< float > w_;
-  float bias_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static LinearSvmModel* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > labels_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > w_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr solved_type_;
+    uint32_t number_of_classes_;
+    uint32_t number_of_features_;
+    float bias_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IntegralChannelsFeature : public ::google::protobuf::Message {
+class IntegralChannelsFeature final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.IntegralChannelsFeature) */ {
  public:
-  IntegralChannelsFeature();
-  virtual ~IntegralChannelsFeature();
-  
+  inline IntegralChannelsFeature() : IntegralChannelsFeature(nullptr) {}
+  ~IntegralChannelsFeature() override;
+  explicit PROTOBUF_CONSTEXPR IntegralChannelsFeature(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   IntegralChannelsFeature(const IntegralChannelsFeature& from);
-  
+  IntegralChannelsFeature(IntegralChannelsFeature&& from) noexcept
+    : IntegralChannelsFeature() {
+    *this = ::std::move(from);
+  }
+
   inline IntegralChannelsFeature& operator=(const IntegralChannelsFeature& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline IntegralChannelsFeature& operator=(IntegralChannelsFeature&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const IntegralChannelsFeature& default_instance();
-  
-  void Swap(IntegralChannelsFeature* other);
-  
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IntegralChannelsFeature& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IntegralChannelsFeature* internal_default_instance() {
+    return reinterpret_cast<const IntegralChannelsFeature*>(
+               &_IntegralChannelsFeature_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(IntegralChannelsFeature& a, IntegralChannelsFeature& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IntegralChannelsFeature* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IntegralChannelsFeature* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  IntegralChannelsFeature* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  IntegralChannelsFeature* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IntegralChannelsFeature>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IntegralChannelsFeature& from);
-  void MergeFrom(const IntegralChannelsFeature& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IntegralChannelsFeature& from) {
+    IntegralChannelsFeature::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IntegralChannelsFeature* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.IntegralChannelsFeature";
+  }
+  protected:
+  explicit IntegralChannelsFeature(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
-  // required int32 channel_index = 1;
-  inline bool has_channel_index() const;
-  inline void clear_channel_index();
-  static const int kChannelIndexFieldNumber = 1;
-  inline ::google::protobuf::int32 channel_index() const;
-  inline void set_channel_index(::google::protobuf::int32 value);
-  
+
+  enum : int {
+    kBoxFieldNumber = 2,
+    kChannelIndexFieldNumber = 1,
+  };
   // required .doppia_protobuf.Box box = 2;
-  inline bool has_box() const;
-  inline void clear_box();
-  static const int kBoxFieldNumber = 2;
-  inline const ::doppia_protobuf::Box& box() const;
-  inline ::doppia_protobuf::Box* mutable_box();
-  inline ::doppia_protobuf::Box* release_box();
-  
+  bool has_box() const;
+  private:
+  bool _internal_has_box() const;
+  public:
+  void clear_box();
+  const ::doppia_protobuf::Box& box() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Box* release_box();
+  ::doppia_protobuf::Box* mutable_box();
+  void set_allocated_box(::doppia_protobuf::Box* box);
+  private:
+  const ::doppia_protobuf::Box& _internal_box() const;
+  ::doppia_protobuf::Box* _internal_mutable_box();
+  public:
+  void unsafe_arena_set_allocated_box(
+      ::doppia_protobuf::Box* box);
+  ::doppia_protobuf::Box* unsafe_arena_release_box();
+
+  // required int32 channel_index = 1;
+  bool has_channel_index() const;
+  private:
+  bool _internal_has_channel_index() const;
+  public:
+  void clear_channel_index();
+  int32_t channel_index() const;
+  void set_channel_index(int32_t value);
+  private:
+  int32_t _internal_channel_index() const;
+  void _internal_set_channel_index(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.IntegralChannelsFeature)
  private:
-  inline void set_has_channel_index();
-  inline void clear_has_channel_index();
-  inline void set_has_box();
-  inline void clear_has_box();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::Box* box_;
-  ::google::protobuf::int32 channel_index_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static IntegralChannelsFeature* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::Box* box_;
+    int32_t channel_index_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IntegralChannelDecisionStump : public ::google::protobuf::Message {
+class IntegralChannelDecisionStump final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.IntegralChannelDecisionStump) */ {
  public:
-  IntegralChannelDecisionStump();
-  virtual ~IntegralChannelDecisionStump();
-  
+  inline IntegralChannelDecisionStump() : IntegralChannelDecisionStump(nullptr) {}
+  ~IntegralChannelDecisionStump() override;
+  explicit PROTOBUF_CONSTEXPR IntegralChannelDecisionStump(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   IntegralChannelDecisionStump(const IntegralChannelDecisionStump& from);
-  
+  IntegralChannelDecisionStump(IntegralChannelDecisionStump&& from) noexcept
+    : IntegralChannelDecisionStump() {
+    *this = ::std::move(from);
+  }
+
   inline IntegralChannelDecisionStump& operator=(const IntegralChannelDecisionStump& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline IntegralChannelDecisionStump& operator=(IntegralChannelDecisionStump&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const IntegralChannelDecisionStump& default_instance();
-  
-  void Swap(IntegralChannelDecisionStump* other);
-  
+  static const IntegralChannelDecisionStump& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IntegralChannelDecisionStump* internal_default_instance() {
+    return reinterpret_cast<const IntegralChannelDecisionStump*>(
+               &_IntegralChannelDecisionStump_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(IntegralChannelDecisionStump& a, IntegralChannelDecisionStump& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IntegralChannelDecisionStump* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IntegralChannelDecisionStump* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  IntegralChannelDecisionStump* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  IntegralChannelDecisionStump* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IntegralChannelDecisionStump>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IntegralChannelDecisionStump& from);
-  void MergeFrom(const IntegralChannelDecisionStump& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IntegralChannelDecisionStump& from) {
+    IntegralChannelDecisionStump::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IntegralChannelDecisionStump* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.IntegralChannelDecisionStump";
+  }
+  protected:
+  explicit IntegralChannelDecisionStump(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kFeatureFieldNumber = 1,
+    kFeatureThresholdFieldNumber = 2,
+    kLargerThanThresholdFieldNumber = 3,
+    kTrueLeafWeightFieldNumber = 10,
+    kFalseLeafWeightFieldNumber = 11,
+  };
   // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-  inline bool has_feature() const;
-  inline void clear_feature();
-  static const int kFeatureFieldNumber = 1;
-  inline const ::doppia_protobuf::IntegralChannelsFeature& feature() const;
-  inline ::doppia_protobuf::IntegralChannelsFeature* mutable_feature();
-  inline ::doppia_protobuf::IntegralChannelsFeature* release_feature();
-  
+  bool has_feature() const;
+  private:
+  bool _internal_has_feature() const;
+  public:
+  void clear_feature();
+  const ::doppia_protobuf::IntegralChannelsFeature& feature() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::IntegralChannelsFeature* release_feature();
+  ::doppia_protobuf::IntegralChannelsFeature* mutable_feature();
+  void set_allocated_feature(::doppia_protobuf::IntegralChannelsFeature* feature);
+  private:
+  const ::doppia_protobuf::IntegralChannelsFeature& _internal_feature() const;
+  ::doppia_protobuf::IntegralChannelsFeature* _internal_mutable_feature();
+  public:
+  void unsafe_arena_set_allocated_feature(
+      ::doppia_protobuf::IntegralChannelsFeature* feature);
+  ::doppia_protobuf::IntegralChannelsFeature* unsafe_arena_release_feature();
+
   // required float feature_threshold = 2;
-  inline bool has_feature_threshold() const;
-  inline void clear_feature_threshold();
-  static const int kFeatureThresholdFieldNumber = 2;
-  inline float feature_threshold() const;
-  inline void set_feature_threshold(float value);
-  
+  bool has_feature_threshold() const;
+  private:
+  bool _internal_has_feature_threshold() const;
+  public:
+  void clear_feature_threshold();
+  float feature_threshold() const;
+  void set_feature_threshold(float value);
+  private:
+  float _internal_feature_threshold() const;
+  void _internal_set_feature_threshold(float value);
+  public:
+
   // optional bool larger_than_threshold = 3 [default = false];
-  inline bool has_larger_than_threshold() const;
-  inline void clear_larger_than_threshold();
-  static const int kLargerThanThresholdFieldNumber = 3;
-  inline bool larger_than_threshold() const;
-  inline void set_larger_than_threshold(bool value);
-  
+  bool has_larger_than_threshold() const;
+  private:
+  bool _internal_has_larger_than_threshold() const;
+  public:
+  void clear_larger_than_threshold();
+  bool larger_than_threshold() const;
+  void set_larger_than_threshold(bool value);
+  private:
+  bool _internal_larger_than_threshold() const;
+  void _internal_set_larger_than_threshold(bool value);
+  public:
+
   // optional float true_leaf_weight = 10;
-  inline bool has_true_leaf_weight() const;
-  inline void clear_true_leaf_weight();
-  static const int kTrueLeafWeightFieldNumber = 10;
-  inline float true_leaf_weight() const;
-  inline void set_true_leaf_weight(float value);
-  
+  bool has_true_leaf_weight() const;
+  private:
+  bool _internal_has_true_leaf_weight() const;
+  public:
+  void clear_true_leaf_weight();
+  float true_leaf_weight() const;
+  void set_true_leaf_weight(float value);
+  private:
+  float _internal_true_leaf_weight() const;
+  void _internal_set_true_leaf_weight(float value);
+  public:
+
   // optional float false_leaf_weight = 11;
-  inline bool has_false_leaf_weight() const;
-  inline void clear_false_leaf_weight();
-  static const int kFalseLeafWeightFieldNumber = 11;
-  inline float false_leaf_weight() const;
-  inline void set_false_leaf_weight(float value);
-  
+  bool has_false_leaf_weight() const;
+  private:
+  bool _internal_has_false_leaf_weight() const;
+  public:
+  void clear_false_leaf_weight();
+  float false_leaf_weight() const;
+  void set_false_leaf_weight(float value);
+  private:
+  float _internal_false_leaf_weight() const;
+  void _internal_set_false_leaf_weight(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.IntegralChannelDecisionStump)
  private:
-  inline void set_has_feature();
-  inline void clear_has_feature();
-  inline void set_has_feature_threshold();
-  inline void clear_has_feature_threshold();
-  inline void set_has_larger_than_threshold();
-  inline void clear_has_larger_than_threshold();
-  inline void set_has_true_leaf_weight();
-  inline void clear_has_true_leaf_weight();
-  inline void set_has_false_leaf_weight();
-  inline void clear_has_false_leaf_weight();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::IntegralChannelsFeature* feature_;
-  float feature_threshold_;
-  bool larger_than_threshold_;
-  float true_leaf_weight_;
-  float false_leaf_weight_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static IntegralChannelDecisionStump* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::IntegralChannelsFeature* feature_;
+    float feature_threshold_;
+    bool larger_than_threshold_;
+    float true_leaf_weight_;
+    float false_leaf_weight_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IntegralChannelBinaryDecisionTreeNode : public ::google::protobuf::Message {
+class IntegralChannelBinaryDecisionTreeNode final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode) */ {
  public:
-  IntegralChannelBinaryDecisionTreeNode();
-  virtual ~IntegralChannelBinaryDecisionTreeNode();
-  
+  inline IntegralChannelBinaryDecisionTreeNode() : IntegralChannelBinaryDecisionTreeNode(nullptr) {}
+  ~IntegralChannelBinaryDecisionTreeNode() override;
+  explicit PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTreeNode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   IntegralChannelBinaryDecisionTreeNode(const IntegralChannelBinaryDecisionTreeNode& from);
-  
+  IntegralChannelBinaryDecisionTreeNode(IntegralChannelBinaryDecisionTreeNode&& from) noexcept
+    : IntegralChannelBinaryDecisionTreeNode() {
+    *this = ::std::move(from);
+  }
+
   inline IntegralChannelBinaryDecisionTreeNode& operator=(const IntegralChannelBinaryDecisionTreeNode& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline IntegralChannelBinaryDecisionTreeNode& operator=(IntegralChannelBinaryDecisionTreeNode&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const IntegralChannelBinaryDecisionTreeNode& default_instance();
-  
-  void Swap(IntegralChannelBinaryDecisionTreeNode* other);
-  
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IntegralChannelBinaryDecisionTreeNode& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IntegralChannelBinaryDecisionTreeNode* internal_default_instance() {
+    return reinterpret_cast<const IntegralChannelBinaryDecisionTreeNode*>(
+               &_IntegralChannelBinaryDecisionTreeNode_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(IntegralChannelBinaryDecisionTreeNode& a, IntegralChannelBinaryDecisionTreeNode& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IntegralChannelBinaryDecisionTreeNode* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IntegralChannelBinaryDecisionTreeNode* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  IntegralChannelBinaryDecisionTreeNode* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  IntegralChannelBinaryDecisionTreeNode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IntegralChannelBinaryDecisionTreeNode>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IntegralChannelBinaryDecisionTreeNode& from);
-  void MergeFrom(const IntegralChannelBinaryDecisionTreeNode& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IntegralChannelBinaryDecisionTreeNode& from) {
+    IntegralChannelBinaryDecisionTreeNode::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IntegralChannelBinaryDecisionTreeNode* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.IntegralChannelBinaryDecisionTreeNode";
+  }
+  protected:
+  explicit IntegralChannelBinaryDecisionTreeNode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kDecisionStumpFieldNumber = 4,
+    kIdFieldNumber = 1,
+    kParentIdFieldNumber = 2,
+    kParentValueFieldNumber = 3,
+  };
+  // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
+  bool has_decision_stump() const;
+  private:
+  bool _internal_has_decision_stump() const;
+  public:
+  void clear_decision_stump();
+  const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::IntegralChannelDecisionStump* release_decision_stump();
+  ::doppia_protobuf::IntegralChannelDecisionStump* mutable_decision_stump();
+  void set_allocated_decision_stump(::doppia_protobuf::IntegralChannelDecisionStump* decision_stump);
+  private:
+  const ::doppia_protobuf::IntegralChannelDecisionStump& _internal_decision_stump() const;
+  ::doppia_protobuf::IntegralChannelDecisionStump* _internal_mutable_decision_stump();
+  public:
+  void unsafe_arena_set_allocated_decision_stump(
+      ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump);
+  ::doppia_protobuf::IntegralChannelDecisionStump* unsafe_arena_release_decision_stump();
+
   // required uint32 id = 1;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 id() const;
-  inline void set_id(::google::protobuf::uint32 value);
-  
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
+  private:
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
+  public:
+
   // required uint32 parent_id = 2;
-  inline bool has_parent_id() const;
-  inline void clear_parent_id();
-  static const int kParentIdFieldNumber = 2;
-  inline ::google::protobuf::uint32 parent_id() const;
-  inline void set_parent_id(::google::protobuf::uint32 value);
-  
+  bool has_parent_id() const;
+  private:
+  bool _internal_has_parent_id() const;
+  public:
+  void clear_parent_id();
+  uint32_t parent_id() const;
+  void set_parent_id(uint32_t value);
+  private:
+  uint32_t _internal_parent_id() const;
+  void _internal_set_parent_id(uint32_t value);
+  public:
+
   // optional bool parent_value = 3;
-  inline bool has_parent_value() const;
-  inline void clear_parent_value();
-  static const int kParentValueFieldNumber = 3;
-  inline bool parent_value() const;
-  inline void set_parent_value(bool value);
-  
-  // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-  inline bool has_decision_stump() const;
-  inline void clear_decision_stump();
-  static const int kDecisionStumpFieldNumber = 4;
-  inline const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump() const;
-  inline ::doppia_protobuf::IntegralChannelDecisionStump* mutable_decision_stump();
-  inline ::doppia_protobuf::IntegralChannelDecisionStump* release_decision_stump();
-  
+  bool has_parent_value() const;
+  private:
+  bool _internal_has_parent_value() const;
+  public:
+  void clear_parent_value();
+  bool parent_value() const;
+  void set_parent_value(bool value);
+  private:
+  bool _internal_parent_value() const;
+  void _internal_set_parent_value(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode)
  private:
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_parent_id();
-  inline void clear_has_parent_id();
-  inline void set_has_parent_value();
-  inline void clear_has_parent_value();
-  inline void set_has_decision_stump();
-  inline void clear_has_decision_stump();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::uint32 id_;
-  ::google::protobuf::uint32 parent_id_;
-  ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump_;
-  bool parent_value_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static IntegralChannelBinaryDecisionTreeNode* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump_;
+    uint32_t id_;
+    uint32_t parent_id_;
+    bool parent_value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class IntegralChannelBinaryDecisionTree : public ::google::protobuf::Message {
+class IntegralChannelBinaryDecisionTree final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.IntegralChannelBinaryDecisionTree) */ {
  public:
-  IntegralChannelBinaryDecisionTree();
-  virtual ~IntegralChannelBinaryDecisionTree();
-  
+  inline IntegralChannelBinaryDecisionTree() : IntegralChannelBinaryDecisionTree(nullptr) {}
+  ~IntegralChannelBinaryDecisionTree() override;
+  explicit PROTOBUF_CONSTEXPR IntegralChannelBinaryDecisionTree(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   IntegralChannelBinaryDecisionTree(const IntegralChannelBinaryDecisionTree& from);
-  
+  IntegralChannelBinaryDecisionTree(IntegralChannelBinaryDecisionTree&& from) noexcept
+    : IntegralChannelBinaryDecisionTree() {
+    *this = ::std::move(from);
+  }
+
   inline IntegralChannelBinaryDecisionTree& operator=(const IntegralChannelBinaryDecisionTree& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline IntegralChannelBinaryDecisionTree& operator=(IntegralChannelBinaryDecisionTree&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const IntegralChannelBinaryDecisionTree& default_instance();
-  
-  void Swap(IntegralChannelBinaryDecisionTree* other);
-  
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IntegralChannelBinaryDecisionTree& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IntegralChannelBinaryDecisionTree* internal_default_instance() {
+    return reinterpret_cast<const IntegralChannelBinaryDecisionTree*>(
+               &_IntegralChannelBinaryDecisionTree_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(IntegralChannelBinaryDecisionTree& a, IntegralChannelBinaryDecisionTree& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IntegralChannelBinaryDecisionTree* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IntegralChannelBinaryDecisionTree* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  IntegralChannelBinaryDecisionTree* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  IntegralChannelBinaryDecisionTree* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IntegralChannelBinaryDecisionTree>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const IntegralChannelBinaryDecisionTree& from);
-  void MergeFrom(const IntegralChannelBinaryDecisionTree& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IntegralChannelBinaryDecisionTree& from) {
+    IntegralChannelBinaryDecisionTree::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IntegralChannelBinaryDecisionTree* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.IntegralChannelBinaryDecisionTree";
+  }
+  protected:
+  explicit IntegralChannelBinaryDecisionTree(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kNodesFieldNumber = 1,
+  };
   // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
-  inline int nodes_size() const;
-  inline void clear_nodes();
-  static const int kNodesFieldNumber = 1;
-  inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode& nodes(int index) const;
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* mutable_nodes(int index);
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* add_nodes();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >&
-      nodes() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >*
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >*
       mutable_nodes();
-  
+  private:
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode& _internal_nodes(int index) const;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* _internal_add_nodes();
+  public:
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode& nodes(int index) const;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >&
+      nodes() const;
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.IntegralChannelBinaryDecisionTree)
  private:
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode > nodes_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static IntegralChannelBinaryDecisionTree* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode > nodes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SoftCascadeOverIntegralChannelsStage : public ::google::protobuf::Message {
+class SoftCascadeOverIntegralChannelsStage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.SoftCascadeOverIntegralChannelsStage) */ {
  public:
-  SoftCascadeOverIntegralChannelsStage();
-  virtual ~SoftCascadeOverIntegralChannelsStage();
-  
+  inline SoftCascadeOverIntegralChannelsStage() : SoftCascadeOverIntegralChannelsStage(nullptr) {}
+  ~SoftCascadeOverIntegralChannelsStage() override;
+  explicit PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsStage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   SoftCascadeOverIntegralChannelsStage(const SoftCascadeOverIntegralChannelsStage& from);
-  
+  SoftCascadeOverIntegralChannelsStage(SoftCascadeOverIntegralChannelsStage&& from) noexcept
+    : SoftCascadeOverIntegralChannelsStage() {
+    *this = ::std::move(from);
+  }
+
   inline SoftCascadeOverIntegralChannelsStage& operator=(const SoftCascadeOverIntegralChannelsStage& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SoftCascadeOverIntegralChannelsStage& operator=(SoftCascadeOverIntegralChannelsStage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SoftCascadeOverIntegralChannelsStage& default_instance();
-  
-  void Swap(SoftCascadeOverIntegralChannelsStage* other);
-  
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SoftCascadeOverIntegralChannelsStage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SoftCascadeOverIntegralChannelsStage* internal_default_instance() {
+    return reinterpret_cast<const SoftCascadeOverIntegralChannelsStage*>(
+               &_SoftCascadeOverIntegralChannelsStage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SoftCascadeOverIntegralChannelsStage& a, SoftCascadeOverIntegralChannelsStage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SoftCascadeOverIntegralChannelsStage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SoftCascadeOverIntegralChannelsStage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  SoftCascadeOverIntegralChannelsStage* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  SoftCascadeOverIntegralChannelsStage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SoftCascadeOverIntegralChannelsStage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SoftCascadeOverIntegralChannelsStage& from);
-  void MergeFrom(const SoftCascadeOverIntegralChannelsStage& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SoftCascadeOverIntegralChannelsStage& from) {
+    SoftCascadeOverIntegralChannelsStage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SoftCascadeOverIntegralChannelsStage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.SoftCascadeOverIntegralChannelsStage";
+  }
+  protected:
+  explicit SoftCascadeOverIntegralChannelsStage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   typedef SoftCascadeOverIntegralChannelsStage_FeatureTypes FeatureTypes;
-  static const FeatureTypes Stumps = SoftCascadeOverIntegralChannelsStage_FeatureTypes_Stumps;
-  static const FeatureTypes Level2DecisionTree = SoftCascadeOverIntegralChannelsStage_FeatureTypes_Level2DecisionTree;
-  static const FeatureTypes LevelNDecisionTree = SoftCascadeOverIntegralChannelsStage_FeatureTypes_LevelNDecisionTree;
+  static constexpr FeatureTypes Stumps =
+    SoftCascadeOverIntegralChannelsStage_FeatureTypes_Stumps;
+  static constexpr FeatureTypes Level2DecisionTree =
+    SoftCascadeOverIntegralChannelsStage_FeatureTypes_Level2DecisionTree;
+  static constexpr FeatureTypes LevelNDecisionTree =
+    SoftCascadeOverIntegralChannelsStage_FeatureTypes_LevelNDecisionTree;
   static inline bool FeatureTypes_IsValid(int value) {
     return SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(value);
   }
-  static const FeatureTypes FeatureTypes_MIN =
+  static constexpr FeatureTypes FeatureTypes_MIN =
     SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MIN;
-  static const FeatureTypes FeatureTypes_MAX =
+  static constexpr FeatureTypes FeatureTypes_MAX =
     SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_MAX;
-  static const int FeatureTypes_ARRAYSIZE =
+  static constexpr int FeatureTypes_ARRAYSIZE =
     SoftCascadeOverIntegralChannelsStage_FeatureTypes_FeatureTypes_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   FeatureTypes_descriptor() {
     return SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor();
   }
-  static inline const ::std::string& FeatureTypes_Name(FeatureTypes value) {
-    return SoftCascadeOverIntegralChannelsStage_FeatureTypes_Name(value);
+  template<typename T>
+  static inline const std::string& FeatureTypes_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, FeatureTypes>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function FeatureTypes_Name.");
+    return SoftCascadeOverIntegralChannelsStage_FeatureTypes_Name(enum_t_value);
   }
-  static inline bool FeatureTypes_Parse(const ::std::string& name,
+  static inline bool FeatureTypes_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       FeatureTypes* value) {
     return SoftCascadeOverIntegralChannelsStage_FeatureTypes_Parse(name, value);
   }
-  
+
   // accessors -------------------------------------------------------
-  
-  // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-  inline bool has_feature_type() const;
-  inline void clear_feature_type();
-  static const int kFeatureTypeFieldNumber = 1;
-  inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes feature_type() const;
-  inline void set_feature_type(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes value);
-  
+
+  enum : int {
+    kDecisionStumpFieldNumber = 10,
+    kLevel2DecisionTreeFieldNumber = 11,
+    kLevelNDecisionTreeFieldNumber = 12,
+    kFeatureTypeFieldNumber = 1,
+    kWeightFieldNumber = 2,
+    kCascadeThresholdFieldNumber = 3,
+  };
   // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-  inline bool has_decision_stump() const;
-  inline void clear_decision_stump();
-  static const int kDecisionStumpFieldNumber = 10;
-  inline const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump() const;
-  inline ::doppia_protobuf::IntegralChannelDecisionStump* mutable_decision_stump();
-  inline ::doppia_protobuf::IntegralChannelDecisionStump* release_decision_stump();
-  
+  bool has_decision_stump() const;
+  private:
+  bool _internal_has_decision_stump() const;
+  public:
+  void clear_decision_stump();
+  const ::doppia_protobuf::IntegralChannelDecisionStump& decision_stump() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::IntegralChannelDecisionStump* release_decision_stump();
+  ::doppia_protobuf::IntegralChannelDecisionStump* mutable_decision_stump();
+  void set_allocated_decision_stump(::doppia_protobuf::IntegralChannelDecisionStump* decision_stump);
+  private:
+  const ::doppia_protobuf::IntegralChannelDecisionStump& _internal_decision_stump() const;
+  ::doppia_protobuf::IntegralChannelDecisionStump* _internal_mutable_decision_stump();
+  public:
+  void unsafe_arena_set_allocated_decision_stump(
+      ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump);
+  ::doppia_protobuf::IntegralChannelDecisionStump* unsafe_arena_release_decision_stump();
+
   // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-  inline bool has_level2_decision_tree() const;
-  inline void clear_level2_decision_tree();
-  static const int kLevel2DecisionTreeFieldNumber = 11;
-  inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& level2_decision_tree() const;
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* mutable_level2_decision_tree();
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* release_level2_decision_tree();
-  
+  bool has_level2_decision_tree() const;
+  private:
+  bool _internal_has_level2_decision_tree() const;
+  public:
+  void clear_level2_decision_tree();
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& level2_decision_tree() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::IntegralChannelBinaryDecisionTree* release_level2_decision_tree();
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* mutable_level2_decision_tree();
+  void set_allocated_level2_decision_tree(::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree);
+  private:
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& _internal_level2_decision_tree() const;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* _internal_mutable_level2_decision_tree();
+  public:
+  void unsafe_arena_set_allocated_level2_decision_tree(
+      ::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree);
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* unsafe_arena_release_level2_decision_tree();
+
   // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-  inline bool has_leveln_decision_tree() const;
-  inline void clear_leveln_decision_tree();
-  static const int kLevelNDecisionTreeFieldNumber = 12;
-  inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& leveln_decision_tree() const;
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* mutable_leveln_decision_tree();
-  inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* release_leveln_decision_tree();
-  
+  bool has_leveln_decision_tree() const;
+  private:
+  bool _internal_has_leveln_decision_tree() const;
+  public:
+  void clear_leveln_decision_tree();
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& leveln_decision_tree() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::IntegralChannelBinaryDecisionTree* release_leveln_decision_tree();
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* mutable_leveln_decision_tree();
+  void set_allocated_leveln_decision_tree(::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree);
+  private:
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& _internal_leveln_decision_tree() const;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* _internal_mutable_leveln_decision_tree();
+  public:
+  void unsafe_arena_set_allocated_leveln_decision_tree(
+      ::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree);
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* unsafe_arena_release_leveln_decision_tree();
+
+  // required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
+  bool has_feature_type() const;
+  private:
+  bool _internal_has_feature_type() const;
+  public:
+  void clear_feature_type();
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes feature_type() const;
+  void set_feature_type(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes value);
+  private:
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes _internal_feature_type() const;
+  void _internal_set_feature_type(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes value);
+  public:
+
   // required float weight = 2;
-  inline bool has_weight() const;
-  inline void clear_weight();
-  static const int kWeightFieldNumber = 2;
-  inline float weight() const;
-  inline void set_weight(float value);
-  
+  bool has_weight() const;
+  private:
+  bool _internal_has_weight() const;
+  public:
+  void clear_weight();
+  float weight() const;
+  void set_weight(float value);
+  private:
+  float _internal_weight() const;
+  void _internal_set_weight(float value);
+  public:
+
   // required float cascade_threshold = 3;
-  inline bool has_cascade_threshold() const;
-  inline void clear_cascade_threshold();
-  static const int kCascadeThresholdFieldNumber = 3;
-  inline float cascade_threshold() const;
-  inline void set_cascade_threshold(float value);
-  
+  bool has_cascade_threshold() const;
+  private:
+  bool _internal_has_cascade_threshold() const;
+  public:
+  void clear_cascade_threshold();
+  float cascade_threshold() const;
+  void set_cascade_threshold(float value);
+  private:
+  float _internal_cascade_threshold() const;
+  void _internal_set_cascade_threshold(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.SoftCascadeOverIntegralChannelsStage)
  private:
-  inline void set_has_feature_type();
-  inline void clear_has_feature_type();
-  inline void set_has_decision_stump();
-  inline void clear_has_decision_stump();
-  inline void set_has_level2_decision_tree();
-  inline void clear_has_level2_decision_tree();
-  inline void set_has_leveln_decision_tree();
-  inline void clear_has_leveln_decision_tree();
-  inline void set_has_weight();
-  inline void clear_has_weight();
-  inline void set_has_cascade_threshold();
-  inline void clear_has_cascade_threshold();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump_;
-  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree_;
-  int feature_type_;
-  float weight_;
-  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree_;
-  float cascade_threshold_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(6 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static SoftCascadeOverIntegralChannelsStage* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump_;
+    ::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree_;
+    ::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree_;
+    int feature_type_;
+    float weight_;
+    float cascade_threshold_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class SoftCascadeOverIntegralChannelsModel : public ::google::protobuf::Message {
+class SoftCascadeOverIntegralChannelsModel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.SoftCascadeOverIntegralChannelsModel) */ {
  public:
-  SoftCascadeOverIntegralChannelsModel();
-  virtual ~SoftCascadeOverIntegralChannelsModel();
-  
+  inline SoftCascadeOverIntegralChannelsModel() : SoftCascadeOverIntegralChannelsModel(nullptr) {}
+  ~SoftCascadeOverIntegralChannelsModel() override;
+  explicit PROTOBUF_CONSTEXPR SoftCascadeOverIntegralChannelsModel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   SoftCascadeOverIntegralChannelsModel(const SoftCascadeOverIntegralChannelsModel& from);
-  
+  SoftCascadeOverIntegralChannelsModel(SoftCascadeOverIntegralChannelsModel&& from) noexcept
+    : SoftCascadeOverIntegralChannelsModel() {
+    *this = ::std::move(from);
+  }
+
   inline SoftCascadeOverIntegralChannelsModel& operator=(const SoftCascadeOverIntegralChannelsModel& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline SoftCascadeOverIntegralChannelsModel& operator=(SoftCascadeOverIntegralChannelsModel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const SoftCascadeOverIntegralChannelsModel& default_instance();
-  
-  void Swap(SoftCascadeOverIntegralChannelsModel* other);
-  
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SoftCascadeOverIntegralChannelsModel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SoftCascadeOverIntegralChannelsModel* internal_default_instance() {
+    return reinterpret_cast<const SoftCascadeOverIntegralChannelsModel*>(
+               &_SoftCascadeOverIntegralChannelsModel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SoftCascadeOverIntegralChannelsModel& a, SoftCascadeOverIntegralChannelsModel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SoftCascadeOverIntegralChannelsModel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SoftCascadeOverIntegralChannelsModel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  SoftCascadeOverIntegralChannelsModel* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  SoftCascadeOverIntegralChannelsModel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SoftCascadeOverIntegralChannelsModel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const SoftCascadeOverIntegralChannelsModel& from);
-  void MergeFrom(const SoftCascadeOverIntegralChannelsModel& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SoftCascadeOverIntegralChannelsModel& from) {
+    SoftCascadeOverIntegralChannelsModel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SoftCascadeOverIntegralChannelsModel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.SoftCascadeOverIntegralChannelsModel";
+  }
+  protected:
+  explicit SoftCascadeOverIntegralChannelsModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kStagesFieldNumber = 1,
+    kChannelsScalingExponentsFieldNumber = 4,
+    kChannelsDescriptionFieldNumber = 2,
+    kShrinkingFactorFieldNumber = 3,
+  };
   // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
-  inline int stages_size() const;
-  inline void clear_stages();
-  static const int kStagesFieldNumber = 1;
-  inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage& stages(int index) const;
-  inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* mutable_stages(int index);
-  inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* add_stages();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >&
-      stages() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >*
+  int stages_size() const;
+  private:
+  int _internal_stages_size() const;
+  public:
+  void clear_stages();
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* mutable_stages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >*
       mutable_stages();
-  
+  private:
+  const ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage& _internal_stages(int index) const;
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* _internal_add_stages();
+  public:
+  const ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage& stages(int index) const;
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* add_stages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >&
+      stages() const;
+
+  // repeated float channels_scaling_exponents = 4;
+  int channels_scaling_exponents_size() const;
+  private:
+  int _internal_channels_scaling_exponents_size() const;
+  public:
+  void clear_channels_scaling_exponents();
+  private:
+  float _internal_channels_scaling_exponents(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_channels_scaling_exponents() const;
+  void _internal_add_channels_scaling_exponents(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_channels_scaling_exponents();
+  public:
+  float channels_scaling_exponents(int index) const;
+  void set_channels_scaling_exponents(int index, float value);
+  void add_channels_scaling_exponents(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      channels_scaling_exponents() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_channels_scaling_exponents();
+
   // optional string channels_description = 2 [default = "hog6_luv"];
-  inline bool has_channels_description() const;
-  inline void clear_channels_description();
-  static const int kChannelsDescriptionFieldNumber = 2;
-  inline const ::std::string& channels_description() const;
-  inline void set_channels_description(const ::std::string& value);
-  inline void set_channels_description(const char* value);
-  inline void set_channels_description(const char* value, size_t size);
-  inline ::std::string* mutable_channels_description();
-  inline ::std::string* release_channels_description();
-  
+  bool has_channels_description() const;
+  private:
+  bool _internal_has_channels_description() const;
+  public:
+  void clear_channels_description();
+  const std::string& channels_description() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channels_description(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channels_description();
+  PROTOBUF_NODISCARD std::string* release_channels_description();
+  void set_allocated_channels_description(std::string* channels_description);
+  private:
+  const std::string& _internal_channels_description() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channels_description(const std::string& value);
+  std::string* _internal_mutable_channels_description();
+  public:
+
   // optional uint32 shrinking_factor = 3 [default = 4];
-  inline bool has_shrinking_factor() const;
-  inline void clear_shrinking_factor();
-  static const int kShrinkingFactorFieldNumber = 3;
-  inline ::google::protobuf::uint32 shrinking_factor() const;
-  inline void set_shrinking_factor(::google::protobuf::uint32 value);
-  
+  bool has_shrinking_factor() const;
+  private:
+  bool _internal_has_shrinking_factor() const;
+  public:
+  void clear_shrinking_factor();
+  uint32_t shrinking_factor() const;
+  void set_shrinking_factor(uint32_t value);
+  private:
+  uint32_t _internal_shrinking_factor() const;
+  void _internal_set_shrinking_factor(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.SoftCascadeOverIntegralChannelsModel)
  private:
-  inline void set_has_channels_description();
-  inline void clear_has_channels_description();
-  inline void set_has_shrinking_factor();
-  inline void clear_has_shrinking_factor();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage > stages_;
-  ::std::string* channels_description_;
-  static const ::std::string _default_channels_description_;
-  ::google::protobuf::uint32 shrinking_factor_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static SoftCascadeOverIntegralChannelsModel* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage > stages_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > channels_scaling_exponents_;
+    static const ::PROTOBUF_NAMESPACE_ID::internal::LazyString _i_give_permission_to_break_this_code_default_channels_description_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channels_description_;
+    uint32_t shrinking_factor_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DetectorModel : public ::google::protobuf::Message {
- public:
-  DetectorModel();
-  virtual ~DetectorModel();
-  
-  DetectorModel(const DetectorModel& from);
-  
-  inline DetectorModel& operator=(const DetectorModel& from) {
-    CopyFrom(from);
-    return *this;
+class DetectorModel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.DetectorModel) */ {
+ public:
+  inline DetectorModel() : DetectorModel(nullptr) {}
+  ~DetectorModel() override;
+  explicit PROTOBUF_CONSTEXPR DetectorModel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DetectorModel(const DetectorModel& from);
+  DetectorModel(DetectorModel&& from) noexcept
+    : DetectorModel() {
+    *this = ::std::move(from);
+  }
+
+  inline DetectorModel& operator=(const DetectorModel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DetectorModel& operator=(DetectorModel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DetectorModel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DetectorModel* internal_default_instance() {
+    return reinterpret_cast<const DetectorModel*>(
+               &_DetectorModel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(DetectorModel& a, DetectorModel& b) {
+    a.Swap(&b);
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline void Swap(DetectorModel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  void UnsafeArenaSwap(DetectorModel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const DetectorModel& default_instance();
-  
-  void Swap(DetectorModel* other);
-  
+
   // implements Message ----------------------------------------------
-  
-  DetectorModel* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  DetectorModel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DetectorModel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const DetectorModel& from);
-  void MergeFrom(const DetectorModel& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DetectorModel& from) {
+    DetectorModel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DetectorModel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.DetectorModel";
+  }
+  protected:
+  explicit DetectorModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   typedef DetectorModel_DetectorTypes DetectorTypes;
-  static const DetectorTypes LinearSvm = DetectorModel_DetectorTypes_LinearSvm;
-  static const DetectorTypes SoftCascadeOverIntegralChannels = DetectorModel_DetectorTypes_SoftCascadeOverIntegralChannels;
-  static const DetectorTypes HoughForest = DetectorModel_DetectorTypes_HoughForest;
+  static constexpr DetectorTypes LinearSvm =
+    DetectorModel_DetectorTypes_LinearSvm;
+  static constexpr DetectorTypes SoftCascadeOverIntegralChannels =
+    DetectorModel_DetectorTypes_SoftCascadeOverIntegralChannels;
+  static constexpr DetectorTypes HoughForest =
+    DetectorModel_DetectorTypes_HoughForest;
   static inline bool DetectorTypes_IsValid(int value) {
     return DetectorModel_DetectorTypes_IsValid(value);
   }
-  static const DetectorTypes DetectorTypes_MIN =
+  static constexpr DetectorTypes DetectorTypes_MIN =
     DetectorModel_DetectorTypes_DetectorTypes_MIN;
-  static const DetectorTypes DetectorTypes_MAX =
+  static constexpr DetectorTypes DetectorTypes_MAX =
     DetectorModel_DetectorTypes_DetectorTypes_MAX;
-  static const int DetectorTypes_ARRAYSIZE =
+  static constexpr int DetectorTypes_ARRAYSIZE =
     DetectorModel_DetectorTypes_DetectorTypes_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   DetectorTypes_descriptor() {
     return DetectorModel_DetectorTypes_descriptor();
   }
-  static inline const ::std::string& DetectorTypes_Name(DetectorTypes value) {
-    return DetectorModel_DetectorTypes_Name(value);
+  template<typename T>
+  static inline const std::string& DetectorTypes_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, DetectorTypes>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function DetectorTypes_Name.");
+    return DetectorModel_DetectorTypes_Name(enum_t_value);
   }
-  static inline bool DetectorTypes_Parse(const ::std::string& name,
+  static inline bool DetectorTypes_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       DetectorTypes* value) {
     return DetectorModel_DetectorTypes_Parse(name, value);
   }
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kDetectorNameFieldNumber = 1,
+    kTrainingDatasetNameFieldNumber = 2,
+    kModelWindowSizeFieldNumber = 10,
+    kObjectWindowFieldNumber = 11,
+    kLinearSvmModelFieldNumber = 100,
+    kSoftCascadeModelFieldNumber = 102,
+    kDetectorTypeFieldNumber = 3,
+    kScaleFieldNumber = 200,
+  };
   // optional string detector_name = 1;
-  inline bool has_detector_name() const;
-  inline void clear_detector_name();
-  static const int kDetectorNameFieldNumber = 1;
-  inline const ::std::string& detector_name() const;
-  inline void set_detector_name(const ::std::string& value);
-  inline void set_detector_name(const char* value);
-  inline void set_detector_name(const char* value, size_t size);
-  inline ::std::string* mutable_detector_name();
-  inline ::std::string* release_detector_name();
-  
+  bool has_detector_name() const;
+  private:
+  bool _internal_has_detector_name() const;
+  public:
+  void clear_detector_name();
+  const std::string& detector_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_detector_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_detector_name();
+  PROTOBUF_NODISCARD std::string* release_detector_name();
+  void set_allocated_detector_name(std::string* detector_name);
+  private:
+  const std::string& _internal_detector_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_detector_name(const std::string& value);
+  std::string* _internal_mutable_detector_name();
+  public:
+
   // required string training_dataset_name = 2;
-  inline bool has_training_dataset_name() const;
-  inline void clear_training_dataset_name();
-  static const int kTrainingDatasetNameFieldNumber = 2;
-  inline const ::std::string& training_dataset_name() const;
-  inline void set_training_dataset_name(const ::std::string& value);
-  inline void set_training_dataset_name(const char* value);
-  inline void set_training_dataset_name(const char* value, size_t size);
-  inline ::std::string* mutable_training_dataset_name();
-  inline ::std::string* release_training_dataset_name();
-  
+  bool has_training_dataset_name() const;
+  private:
+  bool _internal_has_training_dataset_name() const;
+  public:
+  void clear_training_dataset_name();
+  const std::string& training_dataset_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_training_dataset_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_training_dataset_name();
+  PROTOBUF_NODISCARD std::string* release_training_dataset_name();
+  void set_allocated_training_dataset_name(std::string* training_dataset_name);
+  private:
+  const std::string& _internal_training_dataset_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_training_dataset_name(const std::string& value);
+  std::string* _internal_mutable_training_dataset_name();
+  public:
+
   // optional .doppia_protobuf.Point2d model_window_size = 10;
-  inline bool has_model_window_size() const;
-  inline void clear_model_window_size();
-  static const int kModelWindowSizeFieldNumber = 10;
-  inline const ::doppia_protobuf::Point2d& model_window_size() const;
-  inline ::doppia_protobuf::Point2d* mutable_model_window_size();
-  inline ::doppia_protobuf::Point2d* release_model_window_size();
-  
+  bool has_model_window_size() const;
+  private:
+  bool _internal_has_model_window_size() const;
+  public:
+  void clear_model_window_size();
+  const ::doppia_protobuf::Point2d& model_window_size() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Point2d* release_model_window_size();
+  ::doppia_protobuf::Point2d* mutable_model_window_size();
+  void set_allocated_model_window_size(::doppia_protobuf::Point2d* model_window_size);
+  private:
+  const ::doppia_protobuf::Point2d& _internal_model_window_size() const;
+  ::doppia_protobuf::Point2d* _internal_mutable_model_window_size();
+  public:
+  void unsafe_arena_set_allocated_model_window_size(
+      ::doppia_protobuf::Point2d* model_window_size);
+  ::doppia_protobuf::Point2d* unsafe_arena_release_model_window_size();
+
   // optional .doppia_protobuf.Box object_window = 11;
-  inline bool has_object_window() const;
-  inline void clear_object_window();
-  static const int kObjectWindowFieldNumber = 11;
-  inline const ::doppia_protobuf::Box& object_window() const;
-  inline ::doppia_protobuf::Box* mutable_object_window();
-  inline ::doppia_protobuf::Box* release_object_window();
-  
-  // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-  inline bool has_detector_type() const;
-  inline void clear_detector_type();
-  static const int kDetectorTypeFieldNumber = 3;
-  inline ::doppia_protobuf::DetectorModel_DetectorTypes detector_type() const;
-  inline void set_detector_type(::doppia_protobuf::DetectorModel_DetectorTypes value);
-  
+  bool has_object_window() const;
+  private:
+  bool _internal_has_object_window() const;
+  public:
+  void clear_object_window();
+  const ::doppia_protobuf::Box& object_window() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Box* release_object_window();
+  ::doppia_protobuf::Box* mutable_object_window();
+  void set_allocated_object_window(::doppia_protobuf::Box* object_window);
+  private:
+  const ::doppia_protobuf::Box& _internal_object_window() const;
+  ::doppia_protobuf::Box* _internal_mutable_object_window();
+  public:
+  void unsafe_arena_set_allocated_object_window(
+      ::doppia_protobuf::Box* object_window);
+  ::doppia_protobuf::Box* unsafe_arena_release_object_window();
+
   // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-  inline bool has_linear_svm_model() const;
-  inline void clear_linear_svm_model();
-  static const int kLinearSvmModelFieldNumber = 100;
-  inline const ::doppia_protobuf::LinearSvmModel& linear_svm_model() const;
-  inline ::doppia_protobuf::LinearSvmModel* mutable_linear_svm_model();
-  inline ::doppia_protobuf::LinearSvmModel* release_linear_svm_model();
-  
+  bool has_linear_svm_model() const;
+  private:
+  bool _internal_has_linear_svm_model() const;
+  public:
+  void clear_linear_svm_model();
+  const ::doppia_protobuf::LinearSvmModel& linear_svm_model() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::LinearSvmModel* release_linear_svm_model();
+  ::doppia_protobuf::LinearSvmModel* mutable_linear_svm_model();
+  void set_allocated_linear_svm_model(::doppia_protobuf::LinearSvmModel* linear_svm_model);
+  private:
+  const ::doppia_protobuf::LinearSvmModel& _internal_linear_svm_model() const;
+  ::doppia_protobuf::LinearSvmModel* _internal_mutable_linear_svm_model();
+  public:
+  void unsafe_arena_set_allocated_linear_svm_model(
+      ::doppia_protobuf::LinearSvmModel* linear_svm_model);
+  ::doppia_protobuf::LinearSvmModel* unsafe_arena_release_linear_svm_model();
+
   // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-  inline bool has_soft_cascade_model() const;
-  inline void clear_soft_cascade_model();
-  static const int kSoftCascadeModelFieldNumber = 102;
-  inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& soft_cascade_model() const;
-  inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* mutable_soft_cascade_model();
-  inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* release_soft_cascade_model();
-  
+  bool has_soft_cascade_model() const;
+  private:
+  bool _internal_has_soft_cascade_model() const;
+  public:
+  void clear_soft_cascade_model();
+  const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& soft_cascade_model() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* release_soft_cascade_model();
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* mutable_soft_cascade_model();
+  void set_allocated_soft_cascade_model(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model);
+  private:
+  const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& _internal_soft_cascade_model() const;
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* _internal_mutable_soft_cascade_model();
+  public:
+  void unsafe_arena_set_allocated_soft_cascade_model(
+      ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model);
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* unsafe_arena_release_soft_cascade_model();
+
+  // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
+  bool has_detector_type() const;
+  private:
+  bool _internal_has_detector_type() const;
+  public:
+  void clear_detector_type();
+  ::doppia_protobuf::DetectorModel_DetectorTypes detector_type() const;
+  void set_detector_type(::doppia_protobuf::DetectorModel_DetectorTypes value);
+  private:
+  ::doppia_protobuf::DetectorModel_DetectorTypes _internal_detector_type() const;
+  void _internal_set_detector_type(::doppia_protobuf::DetectorModel_DetectorTypes value);
+  public:
+
   // optional float scale = 200 [default = 1];
-  inline bool has_scale() const;
-  inline void clear_scale();
-  static const int kScaleFieldNumber = 200;
-  inline float scale() const;
-  inline void set_scale(float value);
-  
+  bool has_scale() const;
+  private:
+  bool _internal_has_scale() const;
+  public:
+  void clear_scale();
+  float scale() const;
+  void set_scale(float value);
+  private:
+  float _internal_scale() const;
+  void _internal_set_scale(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.DetectorModel)
  private:
-  inline void set_has_detector_name();
-  inline void clear_has_detector_name();
-  inline void set_has_training_dataset_name();
-  inline void clear_has_training_dataset_name();
-  inline void set_has_model_window_size();
-  inline void clear_has_model_window_size();
-  inline void set_has_object_window();
-  inline void clear_has_object_window();
-  inline void set_has_detector_type();
-  inline void clear_has_detector_type();
-  inline void set_has_linear_svm_model();
-  inline void clear_has_linear_svm_model();
-  inline void set_has_soft_cascade_model();
-  inline void clear_has_soft_cascade_model();
-  inline void set_has_scale();
-  inline void clear_has_scale();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* detector_name_;
-  ::std::string* training_dataset_name_;
-  ::doppia_protobuf::Point2d* model_window_size_;
-  ::doppia_protobuf::Box* object_window_;
-  ::doppia_protobuf::LinearSvmModel* linear_svm_model_;
-  int detector_type_;
-  float scale_;
-  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static DetectorModel* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr detector_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr training_dataset_name_;
+    ::doppia_protobuf::Point2d* model_window_size_;
+    ::doppia_protobuf::Box* object_window_;
+    ::doppia_protobuf::LinearSvmModel* linear_svm_model_;
+    ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model_;
+    int detector_type_;
+    float scale_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MultiScalesDetectorModel : public ::google::protobuf::Message {
+class MultiScalesDetectorModel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.MultiScalesDetectorModel) */ {
  public:
-  MultiScalesDetectorModel();
-  virtual ~MultiScalesDetectorModel();
-  
+  inline MultiScalesDetectorModel() : MultiScalesDetectorModel(nullptr) {}
+  ~MultiScalesDetectorModel() override;
+  explicit PROTOBUF_CONSTEXPR MultiScalesDetectorModel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   MultiScalesDetectorModel(const MultiScalesDetectorModel& from);
-  
+  MultiScalesDetectorModel(MultiScalesDetectorModel&& from) noexcept
+    : MultiScalesDetectorModel() {
+    *this = ::std::move(from);
+  }
+
   inline MultiScalesDetectorModel& operator=(const MultiScalesDetectorModel& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MultiScalesDetectorModel& operator=(MultiScalesDetectorModel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const MultiScalesDetectorModel& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MultiScalesDetectorModel& default_instance();
-  
-  void Swap(MultiScalesDetectorModel* other);
-  
+  static inline const MultiScalesDetectorModel* internal_default_instance() {
+    return reinterpret_cast<const MultiScalesDetectorModel*>(
+               &_MultiScalesDetectorModel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(MultiScalesDetectorModel& a, MultiScalesDetectorModel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MultiScalesDetectorModel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MultiScalesDetectorModel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  MultiScalesDetectorModel* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  MultiScalesDetectorModel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiScalesDetectorModel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MultiScalesDetectorModel& from);
-  void MergeFrom(const MultiScalesDetectorModel& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MultiScalesDetectorModel& from) {
+    MultiScalesDetectorModel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MultiScalesDetectorModel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.MultiScalesDetectorModel";
+  }
+  protected:
+  explicit MultiScalesDetectorModel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
-  // optional string detector_name = 1;
-  inline bool has_detector_name() const;
-  inline void clear_detector_name();
-  static const int kDetectorNameFieldNumber = 1;
-  inline const ::std::string& detector_name() const;
-  inline void set_detector_name(const ::std::string& value);
-  inline void set_detector_name(const char* value);
-  inline void set_detector_name(const char* value, size_t size);
-  inline ::std::string* mutable_detector_name();
-  inline ::std::string* release_detector_name();
-  
-  // required string training_dataset_name = 2;
-  inline bool has_training_dataset_name() const;
-  inline void clear_training_dataset_name();
-  static const int kTrainingDatasetNameFieldNumber = 2;
-  inline const ::std::string& training_dataset_name() const;
-  inline void set_training_dataset_name(const ::std::string& value);
-  inline void set_training_dataset_name(const char* value);
-  inline void set_training_dataset_name(const char* value, size_t size);
-  inline ::std::string* mutable_training_dataset_name();
-  inline ::std::string* release_training_dataset_name();
-  
+
+  enum : int {
+    kDetectorsFieldNumber = 3,
+    kDetectorNameFieldNumber = 1,
+    kTrainingDatasetNameFieldNumber = 2,
+  };
   // repeated .doppia_protobuf.DetectorModel detectors = 3;
-  inline int detectors_size() const;
-  inline void clear_detectors();
-  static const int kDetectorsFieldNumber = 3;
-  inline const ::doppia_protobuf::DetectorModel& detectors(int index) const;
-  inline ::doppia_protobuf::DetectorModel* mutable_detectors(int index);
-  inline ::doppia_protobuf::DetectorModel* add_detectors();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DetectorModel >&
-      detectors() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DetectorModel >*
+  int detectors_size() const;
+  private:
+  int _internal_detectors_size() const;
+  public:
+  void clear_detectors();
+  ::doppia_protobuf::DetectorModel* mutable_detectors(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DetectorModel >*
       mutable_detectors();
-  
+  private:
+  const ::doppia_protobuf::DetectorModel& _internal_detectors(int index) const;
+  ::doppia_protobuf::DetectorModel* _internal_add_detectors();
+  public:
+  const ::doppia_protobuf::DetectorModel& detectors(int index) const;
+  ::doppia_protobuf::DetectorModel* add_detectors();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DetectorModel >&
+      detectors() const;
+
+  // optional string detector_name = 1;
+  bool has_detector_name() const;
+  private:
+  bool _internal_has_detector_name() const;
+  public:
+  void clear_detector_name();
+  const std::string& detector_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_detector_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_detector_name();
+  PROTOBUF_NODISCARD std::string* release_detector_name();
+  void set_allocated_detector_name(std::string* detector_name);
+  private:
+  const std::string& _internal_detector_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_detector_name(const std::string& value);
+  std::string* _internal_mutable_detector_name();
+  public:
+
+  // required string training_dataset_name = 2;
+  bool has_training_dataset_name() const;
+  private:
+  bool _internal_has_training_dataset_name() const;
+  public:
+  void clear_training_dataset_name();
+  const std::string& training_dataset_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_training_dataset_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_training_dataset_name();
+  PROTOBUF_NODISCARD std::string* release_training_dataset_name();
+  void set_allocated_training_dataset_name(std::string* training_dataset_name);
+  private:
+  const std::string& _internal_training_dataset_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_training_dataset_name(const std::string& value);
+  std::string* _internal_mutable_training_dataset_name();
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.MultiScalesDetectorModel)
  private:
-  inline void set_has_detector_name();
-  inline void clear_has_detector_name();
-  inline void set_has_training_dataset_name();
-  inline void clear_has_training_dataset_name();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* detector_name_;
-  ::std::string* training_dataset_name_;
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DetectorModel > detectors_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_detector_5fmodel_2eproto();
-  friend void protobuf_AssignDesc_detector_5fmodel_2eproto();
-  friend void protobuf_ShutdownFile_detector_5fmodel_2eproto();
-  
-  void InitAsDefaultInstance();
-  static MultiScalesDetectorModel* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DetectorModel > detectors_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr detector_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr training_dataset_name_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_detector_5fmodel_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // LinearSvmModel
 
 // optional string solved_type = 1;
-inline bool LinearSvmModel::has_solved_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void LinearSvmModel::set_has_solved_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool LinearSvmModel::_internal_has_solved_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void LinearSvmModel::clear_has_solved_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool LinearSvmModel::has_solved_type() const {
+  return _internal_has_solved_type();
 }
 inline void LinearSvmModel::clear_solved_type() {
-  if (solved_type_ != &::google::protobuf::internal::kEmptyString) {
-    solved_type_->clear();
-  }
-  clear_has_solved_type();
-}
-inline const ::std::string& LinearSvmModel::solved_type() const {
-  return *solved_type_;
-}
-inline void LinearSvmModel::set_solved_type(const ::std::string& value) {
-  set_has_solved_type();
-  if (solved_type_ == &::google::protobuf::internal::kEmptyString) {
-    solved_type_ = new ::std::string;
-  }
-  solved_type_->assign(value);
-}
-inline void LinearSvmModel::set_solved_type(const char* value) {
-  set_has_solved_type();
-  if (solved_type_ == &::google::protobuf::internal::kEmptyString) {
-    solved_type_ = new ::std::string;
+  _impl_.solved_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& LinearSvmModel::solved_type() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.solved_type)
+  return _internal_solved_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LinearSvmModel::set_solved_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.solved_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.solved_type)
+}
+inline std::string* LinearSvmModel::mutable_solved_type() {
+  std::string* _s = _internal_mutable_solved_type();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.LinearSvmModel.solved_type)
+  return _s;
+}
+inline const std::string& LinearSvmModel::_internal_solved_type() const {
+  return _impl_.solved_type_.Get();
+}
+inline void LinearSvmModel::_internal_set_solved_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.solved_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LinearSvmModel::_internal_mutable_solved_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.solved_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LinearSvmModel::release_solved_type() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.LinearSvmModel.solved_type)
+  if (!_internal_has_solved_type()) {
+    return nullptr;
   }
-  solved_type_->assign(value);
-}
-inline void LinearSvmModel::set_solved_type(const char* value, size_t size) {
-  set_has_solved_type();
-  if (solved_type_ == &::google::protobuf::internal::kEmptyString) {
-    solved_type_ = new ::std::string;
-  }
-  solved_type_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* LinearSvmModel::mutable_solved_type() {
-  set_has_solved_type();
-  if (solved_type_ == &::google::protobuf::internal::kEmptyString) {
-    solved_type_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.solved_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.solved_type_.IsDefault()) {
+    _impl_.solved_type_.Set("", GetArenaForAllocation());
   }
-  return solved_type_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* LinearSvmModel::release_solved_type() {
-  clear_has_solved_type();
-  if (solved_type_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void LinearSvmModel::set_allocated_solved_type(std::string* solved_type) {
+  if (solved_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = solved_type_;
-    solved_type_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.solved_type_.SetAllocated(solved_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.solved_type_.IsDefault()) {
+    _impl_.solved_type_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.LinearSvmModel.solved_type)
 }
 
 // optional uint32 number_of_classes = 2;
+inline bool LinearSvmModel::_internal_has_number_of_classes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool LinearSvmModel::has_number_of_classes() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_number_of_classes();
 }
-inline void LinearSvmModel::set_has_number_of_classes() {
-  _has_bits_[0] |= 0x00000002u;
+inline void LinearSvmModel::clear_number_of_classes() {
+  _impl_.number_of_classes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void LinearSvmModel::clear_has_number_of_classes() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint32_t LinearSvmModel::_internal_number_of_classes() const {
+  return _impl_.number_of_classes_;
 }
-inline void LinearSvmModel::clear_number_of_classes() {
-  number_of_classes_ = 0u;
-  clear_has_number_of_classes();
+inline uint32_t LinearSvmModel::number_of_classes() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.number_of_classes)
+  return _internal_number_of_classes();
 }
-inline ::google::protobuf::uint32 LinearSvmModel::number_of_classes() const {
-  return number_of_classes_;
+inline void LinearSvmModel::_internal_set_number_of_classes(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.number_of_classes_ = value;
 }
-inline void LinearSvmModel::set_number_of_classes(::google::protobuf::uint32 value) {
-  set_has_number_of_classes();
-  number_of_classes_ = value;
+inline void LinearSvmModel::set_number_of_classes(uint32_t value) {
+  _internal_set_number_of_classes(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.number_of_classes)
 }
 
 // repeated int32 labels = 3;
+inline int LinearSvmModel::_internal_labels_size() const {
+  return _impl_.labels_.size();
+}
 inline int LinearSvmModel::labels_size() const {
-  return labels_.size();
+  return _internal_labels_size();
 }
 inline void LinearSvmModel::clear_labels() {
-  labels_.Clear();
+  _impl_.labels_.Clear();
 }
-inline ::google::protobuf::int32 LinearSvmModel::labels(int index) const {
-  return labels_.Get(index);
+inline int32_t LinearSvmModel::_internal_labels(int index) const {
+  return _impl_.labels_.Get(index);
 }
-inline void LinearSvmModel::set_labels(int index, ::google::protobuf::int32 value) {
-  labels_.Set(index, value);
+inline int32_t LinearSvmModel::labels(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.labels)
+  return _internal_labels(index);
 }
-inline void LinearSvmModel::add_labels(::google::protobuf::int32 value) {
-  labels_.Add(value);
+inline void LinearSvmModel::set_labels(int index, int32_t value) {
+  _impl_.labels_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.labels)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+inline void LinearSvmModel::_internal_add_labels(int32_t value) {
+  _impl_.labels_.Add(value);
+}
+inline void LinearSvmModel::add_labels(int32_t value) {
+  _internal_add_labels(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.LinearSvmModel.labels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+LinearSvmModel::_internal_labels() const {
+  return _impl_.labels_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
 LinearSvmModel::labels() const {
-  return labels_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.LinearSvmModel.labels)
+  return _internal_labels();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+LinearSvmModel::_internal_mutable_labels() {
+  return &_impl_.labels_;
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
 LinearSvmModel::mutable_labels() {
-  return &labels_;
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.LinearSvmModel.labels)
+  return _internal_mutable_labels();
 }
 
 // optional uint32 number_of_features = 4;
+inline bool LinearSvmModel::_internal_has_number_of_features() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool LinearSvmModel::has_number_of_features() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_number_of_features();
 }
-inline void LinearSvmModel::set_has_number_of_features() {
-  _has_bits_[0] |= 0x00000008u;
+inline void LinearSvmModel::clear_number_of_features() {
+  _impl_.number_of_features_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void LinearSvmModel::clear_has_number_of_features() {
-  _has_bits_[0] &= ~0x00000008u;
+inline uint32_t LinearSvmModel::_internal_number_of_features() const {
+  return _impl_.number_of_features_;
 }
-inline void LinearSvmModel::clear_number_of_features() {
-  number_of_features_ = 0u;
-  clear_has_number_of_features();
+inline uint32_t LinearSvmModel::number_of_features() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.number_of_features)
+  return _internal_number_of_features();
 }
-inline ::google::protobuf::uint32 LinearSvmModel::number_of_features() const {
-  return number_of_features_;
+inline void LinearSvmModel::_internal_set_number_of_features(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.number_of_features_ = value;
 }
-inline void LinearSvmModel::set_number_of_features(::google::protobuf::uint32 value) {
-  set_has_number_of_features();
-  number_of_features_ = value;
+inline void LinearSvmModel::set_number_of_features(uint32_t value) {
+  _internal_set_number_of_features(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.number_of_features)
 }
 
 // required float bias = 5;
-inline bool LinearSvmModel::has_bias() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool LinearSvmModel::_internal_has_bias() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void LinearSvmModel::set_has_bias() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void LinearSvmModel::clear_has_bias() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool LinearSvmModel::has_bias() const {
+  return _internal_has_bias();
 }
 inline void LinearSvmModel::clear_bias() {
-  bias_ = 0;
-  clear_has_bias();
+  _impl_.bias_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float LinearSvmModel::_internal_bias() const {
+  return _impl_.bias_;
 }
 inline float LinearSvmModel::bias() const {
-  return bias_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.bias)
+  return _internal_bias();
+}
+inline void LinearSvmModel::_internal_set_bias(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.bias_ = value;
 }
 inline void LinearSvmModel::set_bias(float value) {
-  set_has_bias();
-  bias_ = value;
+  _internal_set_bias(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.bias)
 }
 
 // repeated float w = 6;
+inline int LinearSvmModel::_internal_w_size() const {
+  return _impl_.w_.size();
+}
 inline int LinearSvmModel::w_size() const {
-  return w_.size();
+  return _internal_w_size();
 }
 inline void LinearSvmModel::clear_w() {
-  w_.Clear();
+  _impl_.w_.Clear();
+}
+inline float LinearSvmModel::_internal_w(int index) const {
+  return _impl_.w_.Get(index);
 }
 inline float LinearSvmModel::w(int index) const {
-  return w_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.LinearSvmModel.w)
+  return _internal_w(index);
 }
 inline void LinearSvmModel::set_w(int index, float value) {
-  w_.Set(index, value);
+  _impl_.w_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.LinearSvmModel.w)
+}
+inline void LinearSvmModel::_internal_add_w(float value) {
+  _impl_.w_.Add(value);
 }
 inline void LinearSvmModel::add_w(float value) {
-  w_.Add(value);
+  _internal_add_w(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.LinearSvmModel.w)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+LinearSvmModel::_internal_w() const {
+  return _impl_.w_;
 }
-inline const ::google::protobuf::RepeatedField< float >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
 LinearSvmModel::w() const {
-  return w_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.LinearSvmModel.w)
+  return _internal_w();
 }
-inline ::google::protobuf::RepeatedField< float >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+LinearSvmModel::_internal_mutable_w() {
+  return &_impl_.w_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
 LinearSvmModel::mutable_w() {
-  return &w_;
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.LinearSvmModel.w)
+  return _internal_mutable_w();
 }
 
 // -------------------------------------------------------------------
@@ -1397,175 +2489,324 @@ LinearSvmModel::mutable_w() {
 // IntegralChannelsFeature
 
 // required int32 channel_index = 1;
+inline bool IntegralChannelsFeature::_internal_has_channel_index() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool IntegralChannelsFeature::has_channel_index() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_channel_index();
 }
-inline void IntegralChannelsFeature::set_has_channel_index() {
-  _has_bits_[0] |= 0x00000001u;
+inline void IntegralChannelsFeature::clear_channel_index() {
+  _impl_.channel_index_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void IntegralChannelsFeature::clear_has_channel_index() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t IntegralChannelsFeature::_internal_channel_index() const {
+  return _impl_.channel_index_;
 }
-inline void IntegralChannelsFeature::clear_channel_index() {
-  channel_index_ = 0;
-  clear_has_channel_index();
+inline int32_t IntegralChannelsFeature::channel_index() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelsFeature.channel_index)
+  return _internal_channel_index();
 }
-inline ::google::protobuf::int32 IntegralChannelsFeature::channel_index() const {
-  return channel_index_;
+inline void IntegralChannelsFeature::_internal_set_channel_index(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.channel_index_ = value;
 }
-inline void IntegralChannelsFeature::set_channel_index(::google::protobuf::int32 value) {
-  set_has_channel_index();
-  channel_index_ = value;
+inline void IntegralChannelsFeature::set_channel_index(int32_t value) {
+  _internal_set_channel_index(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelsFeature.channel_index)
 }
 
 // required .doppia_protobuf.Box box = 2;
-inline bool IntegralChannelsFeature::has_box() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void IntegralChannelsFeature::set_has_box() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool IntegralChannelsFeature::_internal_has_box() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.box_ != nullptr);
+  return value;
 }
-inline void IntegralChannelsFeature::clear_has_box() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool IntegralChannelsFeature::has_box() const {
+  return _internal_has_box();
 }
-inline void IntegralChannelsFeature::clear_box() {
-  if (box_ != NULL) box_->::doppia_protobuf::Box::Clear();
-  clear_has_box();
+inline const ::doppia_protobuf::Box& IntegralChannelsFeature::_internal_box() const {
+  const ::doppia_protobuf::Box* p = _impl_.box_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Box&>(
+      ::doppia_protobuf::_Box_default_instance_);
 }
 inline const ::doppia_protobuf::Box& IntegralChannelsFeature::box() const {
-  return box_ != NULL ? *box_ : *default_instance_->box_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelsFeature.box)
+  return _internal_box();
 }
-inline ::doppia_protobuf::Box* IntegralChannelsFeature::mutable_box() {
-  set_has_box();
-  if (box_ == NULL) box_ = new ::doppia_protobuf::Box;
-  return box_;
+inline void IntegralChannelsFeature::unsafe_arena_set_allocated_box(
+    ::doppia_protobuf::Box* box) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.box_);
+  }
+  _impl_.box_ = box;
+  if (box) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.IntegralChannelsFeature.box)
 }
 inline ::doppia_protobuf::Box* IntegralChannelsFeature::release_box() {
-  clear_has_box();
-  ::doppia_protobuf::Box* temp = box_;
-  box_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Box* temp = _impl_.box_;
+  _impl_.box_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Box* IntegralChannelsFeature::unsafe_arena_release_box() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.IntegralChannelsFeature.box)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::Box* temp = _impl_.box_;
+  _impl_.box_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Box* IntegralChannelsFeature::_internal_mutable_box() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.box_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Box>(GetArenaForAllocation());
+    _impl_.box_ = p;
+  }
+  return _impl_.box_;
+}
+inline ::doppia_protobuf::Box* IntegralChannelsFeature::mutable_box() {
+  ::doppia_protobuf::Box* _msg = _internal_mutable_box();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.IntegralChannelsFeature.box)
+  return _msg;
+}
+inline void IntegralChannelsFeature::set_allocated_box(::doppia_protobuf::Box* box) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.box_);
+  }
+  if (box) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(box));
+    if (message_arena != submessage_arena) {
+      box = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, box, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.box_ = box;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.IntegralChannelsFeature.box)
+}
 
 // -------------------------------------------------------------------
 
 // IntegralChannelDecisionStump
 
 // required .doppia_protobuf.IntegralChannelsFeature feature = 1;
-inline bool IntegralChannelDecisionStump::has_feature() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool IntegralChannelDecisionStump::_internal_has_feature() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.feature_ != nullptr);
+  return value;
 }
-inline void IntegralChannelDecisionStump::set_has_feature() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void IntegralChannelDecisionStump::clear_has_feature() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool IntegralChannelDecisionStump::has_feature() const {
+  return _internal_has_feature();
 }
 inline void IntegralChannelDecisionStump::clear_feature() {
-  if (feature_ != NULL) feature_->::doppia_protobuf::IntegralChannelsFeature::Clear();
-  clear_has_feature();
+  if (_impl_.feature_ != nullptr) _impl_.feature_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::IntegralChannelsFeature& IntegralChannelDecisionStump::_internal_feature() const {
+  const ::doppia_protobuf::IntegralChannelsFeature* p = _impl_.feature_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::IntegralChannelsFeature&>(
+      ::doppia_protobuf::_IntegralChannelsFeature_default_instance_);
 }
 inline const ::doppia_protobuf::IntegralChannelsFeature& IntegralChannelDecisionStump::feature() const {
-  return feature_ != NULL ? *feature_ : *default_instance_->feature_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelDecisionStump.feature)
+  return _internal_feature();
 }
-inline ::doppia_protobuf::IntegralChannelsFeature* IntegralChannelDecisionStump::mutable_feature() {
-  set_has_feature();
-  if (feature_ == NULL) feature_ = new ::doppia_protobuf::IntegralChannelsFeature;
-  return feature_;
+inline void IntegralChannelDecisionStump::unsafe_arena_set_allocated_feature(
+    ::doppia_protobuf::IntegralChannelsFeature* feature) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.feature_);
+  }
+  _impl_.feature_ = feature;
+  if (feature) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.IntegralChannelDecisionStump.feature)
 }
 inline ::doppia_protobuf::IntegralChannelsFeature* IntegralChannelDecisionStump::release_feature() {
-  clear_has_feature();
-  ::doppia_protobuf::IntegralChannelsFeature* temp = feature_;
-  feature_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelsFeature* temp = _impl_.feature_;
+  _impl_.feature_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::IntegralChannelsFeature* IntegralChannelDecisionStump::unsafe_arena_release_feature() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.IntegralChannelDecisionStump.feature)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelsFeature* temp = _impl_.feature_;
+  _impl_.feature_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::IntegralChannelsFeature* IntegralChannelDecisionStump::_internal_mutable_feature() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.feature_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::IntegralChannelsFeature>(GetArenaForAllocation());
+    _impl_.feature_ = p;
+  }
+  return _impl_.feature_;
+}
+inline ::doppia_protobuf::IntegralChannelsFeature* IntegralChannelDecisionStump::mutable_feature() {
+  ::doppia_protobuf::IntegralChannelsFeature* _msg = _internal_mutable_feature();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.IntegralChannelDecisionStump.feature)
+  return _msg;
+}
+inline void IntegralChannelDecisionStump::set_allocated_feature(::doppia_protobuf::IntegralChannelsFeature* feature) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.feature_;
+  }
+  if (feature) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(feature);
+    if (message_arena != submessage_arena) {
+      feature = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, feature, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.feature_ = feature;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.IntegralChannelDecisionStump.feature)
+}
 
 // required float feature_threshold = 2;
-inline bool IntegralChannelDecisionStump::has_feature_threshold() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool IntegralChannelDecisionStump::_internal_has_feature_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void IntegralChannelDecisionStump::set_has_feature_threshold() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void IntegralChannelDecisionStump::clear_has_feature_threshold() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool IntegralChannelDecisionStump::has_feature_threshold() const {
+  return _internal_has_feature_threshold();
 }
 inline void IntegralChannelDecisionStump::clear_feature_threshold() {
-  feature_threshold_ = 0;
-  clear_has_feature_threshold();
+  _impl_.feature_threshold_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float IntegralChannelDecisionStump::_internal_feature_threshold() const {
+  return _impl_.feature_threshold_;
 }
 inline float IntegralChannelDecisionStump::feature_threshold() const {
-  return feature_threshold_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelDecisionStump.feature_threshold)
+  return _internal_feature_threshold();
+}
+inline void IntegralChannelDecisionStump::_internal_set_feature_threshold(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.feature_threshold_ = value;
 }
 inline void IntegralChannelDecisionStump::set_feature_threshold(float value) {
-  set_has_feature_threshold();
-  feature_threshold_ = value;
+  _internal_set_feature_threshold(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelDecisionStump.feature_threshold)
 }
 
 // optional bool larger_than_threshold = 3 [default = false];
-inline bool IntegralChannelDecisionStump::has_larger_than_threshold() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void IntegralChannelDecisionStump::set_has_larger_than_threshold() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool IntegralChannelDecisionStump::_internal_has_larger_than_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void IntegralChannelDecisionStump::clear_has_larger_than_threshold() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool IntegralChannelDecisionStump::has_larger_than_threshold() const {
+  return _internal_has_larger_than_threshold();
 }
 inline void IntegralChannelDecisionStump::clear_larger_than_threshold() {
-  larger_than_threshold_ = false;
-  clear_has_larger_than_threshold();
+  _impl_.larger_than_threshold_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool IntegralChannelDecisionStump::_internal_larger_than_threshold() const {
+  return _impl_.larger_than_threshold_;
 }
 inline bool IntegralChannelDecisionStump::larger_than_threshold() const {
-  return larger_than_threshold_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelDecisionStump.larger_than_threshold)
+  return _internal_larger_than_threshold();
+}
+inline void IntegralChannelDecisionStump::_internal_set_larger_than_threshold(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.larger_than_threshold_ = value;
 }
 inline void IntegralChannelDecisionStump::set_larger_than_threshold(bool value) {
-  set_has_larger_than_threshold();
-  larger_than_threshold_ = value;
+  _internal_set_larger_than_threshold(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelDecisionStump.larger_than_threshold)
 }
 
 // optional float true_leaf_weight = 10;
-inline bool IntegralChannelDecisionStump::has_true_leaf_weight() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool IntegralChannelDecisionStump::_internal_has_true_leaf_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void IntegralChannelDecisionStump::set_has_true_leaf_weight() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void IntegralChannelDecisionStump::clear_has_true_leaf_weight() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool IntegralChannelDecisionStump::has_true_leaf_weight() const {
+  return _internal_has_true_leaf_weight();
 }
 inline void IntegralChannelDecisionStump::clear_true_leaf_weight() {
-  true_leaf_weight_ = 0;
-  clear_has_true_leaf_weight();
+  _impl_.true_leaf_weight_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float IntegralChannelDecisionStump::_internal_true_leaf_weight() const {
+  return _impl_.true_leaf_weight_;
 }
 inline float IntegralChannelDecisionStump::true_leaf_weight() const {
-  return true_leaf_weight_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelDecisionStump.true_leaf_weight)
+  return _internal_true_leaf_weight();
+}
+inline void IntegralChannelDecisionStump::_internal_set_true_leaf_weight(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.true_leaf_weight_ = value;
 }
 inline void IntegralChannelDecisionStump::set_true_leaf_weight(float value) {
-  set_has_true_leaf_weight();
-  true_leaf_weight_ = value;
+  _internal_set_true_leaf_weight(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelDecisionStump.true_leaf_weight)
 }
 
 // optional float false_leaf_weight = 11;
-inline bool IntegralChannelDecisionStump::has_false_leaf_weight() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void IntegralChannelDecisionStump::set_has_false_leaf_weight() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool IntegralChannelDecisionStump::_internal_has_false_leaf_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void IntegralChannelDecisionStump::clear_has_false_leaf_weight() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool IntegralChannelDecisionStump::has_false_leaf_weight() const {
+  return _internal_has_false_leaf_weight();
 }
 inline void IntegralChannelDecisionStump::clear_false_leaf_weight() {
-  false_leaf_weight_ = 0;
-  clear_has_false_leaf_weight();
+  _impl_.false_leaf_weight_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float IntegralChannelDecisionStump::_internal_false_leaf_weight() const {
+  return _impl_.false_leaf_weight_;
 }
 inline float IntegralChannelDecisionStump::false_leaf_weight() const {
-  return false_leaf_weight_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelDecisionStump.false_leaf_weight)
+  return _internal_false_leaf_weight();
+}
+inline void IntegralChannelDecisionStump::_internal_set_false_leaf_weight(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.false_leaf_weight_ = value;
 }
 inline void IntegralChannelDecisionStump::set_false_leaf_weight(float value) {
-  set_has_false_leaf_weight();
-  false_leaf_weight_ = value;
+  _internal_set_false_leaf_weight(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelDecisionStump.false_leaf_weight)
 }
 
 // -------------------------------------------------------------------
@@ -1573,285 +2814,580 @@ inline void IntegralChannelDecisionStump::set_false_leaf_weight(float value) {
 // IntegralChannelBinaryDecisionTreeNode
 
 // required uint32 id = 1;
+inline bool IntegralChannelBinaryDecisionTreeNode::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool IntegralChannelBinaryDecisionTreeNode::has_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_id();
 }
-inline void IntegralChannelBinaryDecisionTreeNode::set_has_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline void IntegralChannelBinaryDecisionTreeNode::clear_id() {
+  _impl_.id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::clear_has_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint32_t IntegralChannelBinaryDecisionTreeNode::_internal_id() const {
+  return _impl_.id_;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::clear_id() {
-  id_ = 0u;
-  clear_has_id();
+inline uint32_t IntegralChannelBinaryDecisionTreeNode::id() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.id)
+  return _internal_id();
 }
-inline ::google::protobuf::uint32 IntegralChannelBinaryDecisionTreeNode::id() const {
-  return id_;
+inline void IntegralChannelBinaryDecisionTreeNode::_internal_set_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::set_id(::google::protobuf::uint32 value) {
-  set_has_id();
-  id_ = value;
+inline void IntegralChannelBinaryDecisionTreeNode::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.id)
 }
 
 // required uint32 parent_id = 2;
+inline bool IntegralChannelBinaryDecisionTreeNode::_internal_has_parent_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool IntegralChannelBinaryDecisionTreeNode::has_parent_id() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_parent_id();
 }
-inline void IntegralChannelBinaryDecisionTreeNode::set_has_parent_id() {
-  _has_bits_[0] |= 0x00000002u;
+inline void IntegralChannelBinaryDecisionTreeNode::clear_parent_id() {
+  _impl_.parent_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::clear_has_parent_id() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint32_t IntegralChannelBinaryDecisionTreeNode::_internal_parent_id() const {
+  return _impl_.parent_id_;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::clear_parent_id() {
-  parent_id_ = 0u;
-  clear_has_parent_id();
+inline uint32_t IntegralChannelBinaryDecisionTreeNode::parent_id() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.parent_id)
+  return _internal_parent_id();
 }
-inline ::google::protobuf::uint32 IntegralChannelBinaryDecisionTreeNode::parent_id() const {
-  return parent_id_;
+inline void IntegralChannelBinaryDecisionTreeNode::_internal_set_parent_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.parent_id_ = value;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::set_parent_id(::google::protobuf::uint32 value) {
-  set_has_parent_id();
-  parent_id_ = value;
+inline void IntegralChannelBinaryDecisionTreeNode::set_parent_id(uint32_t value) {
+  _internal_set_parent_id(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.parent_id)
 }
 
 // optional bool parent_value = 3;
-inline bool IntegralChannelBinaryDecisionTreeNode::has_parent_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool IntegralChannelBinaryDecisionTreeNode::_internal_has_parent_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::set_has_parent_value() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void IntegralChannelBinaryDecisionTreeNode::clear_has_parent_value() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool IntegralChannelBinaryDecisionTreeNode::has_parent_value() const {
+  return _internal_has_parent_value();
 }
 inline void IntegralChannelBinaryDecisionTreeNode::clear_parent_value() {
-  parent_value_ = false;
-  clear_has_parent_value();
+  _impl_.parent_value_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool IntegralChannelBinaryDecisionTreeNode::_internal_parent_value() const {
+  return _impl_.parent_value_;
 }
 inline bool IntegralChannelBinaryDecisionTreeNode::parent_value() const {
-  return parent_value_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.parent_value)
+  return _internal_parent_value();
+}
+inline void IntegralChannelBinaryDecisionTreeNode::_internal_set_parent_value(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.parent_value_ = value;
 }
 inline void IntegralChannelBinaryDecisionTreeNode::set_parent_value(bool value) {
-  set_has_parent_value();
-  parent_value_ = value;
+  _internal_set_parent_value(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.parent_value)
 }
 
 // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 4;
-inline bool IntegralChannelBinaryDecisionTreeNode::has_decision_stump() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void IntegralChannelBinaryDecisionTreeNode::set_has_decision_stump() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool IntegralChannelBinaryDecisionTreeNode::_internal_has_decision_stump() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.decision_stump_ != nullptr);
+  return value;
 }
-inline void IntegralChannelBinaryDecisionTreeNode::clear_has_decision_stump() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool IntegralChannelBinaryDecisionTreeNode::has_decision_stump() const {
+  return _internal_has_decision_stump();
 }
 inline void IntegralChannelBinaryDecisionTreeNode::clear_decision_stump() {
-  if (decision_stump_ != NULL) decision_stump_->::doppia_protobuf::IntegralChannelDecisionStump::Clear();
-  clear_has_decision_stump();
+  if (_impl_.decision_stump_ != nullptr) _impl_.decision_stump_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::IntegralChannelDecisionStump& IntegralChannelBinaryDecisionTreeNode::_internal_decision_stump() const {
+  const ::doppia_protobuf::IntegralChannelDecisionStump* p = _impl_.decision_stump_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::IntegralChannelDecisionStump&>(
+      ::doppia_protobuf::_IntegralChannelDecisionStump_default_instance_);
 }
 inline const ::doppia_protobuf::IntegralChannelDecisionStump& IntegralChannelBinaryDecisionTreeNode::decision_stump() const {
-  return decision_stump_ != NULL ? *decision_stump_ : *default_instance_->decision_stump_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.decision_stump)
+  return _internal_decision_stump();
 }
-inline ::doppia_protobuf::IntegralChannelDecisionStump* IntegralChannelBinaryDecisionTreeNode::mutable_decision_stump() {
-  set_has_decision_stump();
-  if (decision_stump_ == NULL) decision_stump_ = new ::doppia_protobuf::IntegralChannelDecisionStump;
-  return decision_stump_;
+inline void IntegralChannelBinaryDecisionTreeNode::unsafe_arena_set_allocated_decision_stump(
+    ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.decision_stump_);
+  }
+  _impl_.decision_stump_ = decision_stump;
+  if (decision_stump) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.decision_stump)
 }
 inline ::doppia_protobuf::IntegralChannelDecisionStump* IntegralChannelBinaryDecisionTreeNode::release_decision_stump() {
-  clear_has_decision_stump();
-  ::doppia_protobuf::IntegralChannelDecisionStump* temp = decision_stump_;
-  decision_stump_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelDecisionStump* temp = _impl_.decision_stump_;
+  _impl_.decision_stump_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::IntegralChannelDecisionStump* IntegralChannelBinaryDecisionTreeNode::unsafe_arena_release_decision_stump() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.decision_stump)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelDecisionStump* temp = _impl_.decision_stump_;
+  _impl_.decision_stump_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::IntegralChannelDecisionStump* IntegralChannelBinaryDecisionTreeNode::_internal_mutable_decision_stump() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.decision_stump_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::IntegralChannelDecisionStump>(GetArenaForAllocation());
+    _impl_.decision_stump_ = p;
+  }
+  return _impl_.decision_stump_;
+}
+inline ::doppia_protobuf::IntegralChannelDecisionStump* IntegralChannelBinaryDecisionTreeNode::mutable_decision_stump() {
+  ::doppia_protobuf::IntegralChannelDecisionStump* _msg = _internal_mutable_decision_stump();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.decision_stump)
+  return _msg;
+}
+inline void IntegralChannelBinaryDecisionTreeNode::set_allocated_decision_stump(::doppia_protobuf::IntegralChannelDecisionStump* decision_stump) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.decision_stump_;
+  }
+  if (decision_stump) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(decision_stump);
+    if (message_arena != submessage_arena) {
+      decision_stump = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, decision_stump, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.decision_stump_ = decision_stump;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.IntegralChannelBinaryDecisionTreeNode.decision_stump)
+}
 
 // -------------------------------------------------------------------
 
 // IntegralChannelBinaryDecisionTree
 
 // repeated .doppia_protobuf.IntegralChannelBinaryDecisionTreeNode nodes = 1;
+inline int IntegralChannelBinaryDecisionTree::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
 inline int IntegralChannelBinaryDecisionTree::nodes_size() const {
-  return nodes_.size();
+  return _internal_nodes_size();
 }
 inline void IntegralChannelBinaryDecisionTree::clear_nodes() {
-  nodes_.Clear();
+  _impl_.nodes_.Clear();
+}
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTree::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.IntegralChannelBinaryDecisionTree.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >*
+IntegralChannelBinaryDecisionTree::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.IntegralChannelBinaryDecisionTree.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode& IntegralChannelBinaryDecisionTree::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
 }
 inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode& IntegralChannelBinaryDecisionTree::nodes(int index) const {
-  return nodes_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.IntegralChannelBinaryDecisionTree.nodes)
+  return _internal_nodes(index);
 }
-inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTree::mutable_nodes(int index) {
-  return nodes_.Mutable(index);
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTree::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
 }
 inline ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* IntegralChannelBinaryDecisionTree::add_nodes() {
-  return nodes_.Add();
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.IntegralChannelBinaryDecisionTree.nodes)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >&
 IntegralChannelBinaryDecisionTree::nodes() const {
-  return nodes_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::IntegralChannelBinaryDecisionTreeNode >*
-IntegralChannelBinaryDecisionTree::mutable_nodes() {
-  return &nodes_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.IntegralChannelBinaryDecisionTree.nodes)
+  return _impl_.nodes_;
 }
 
 // -------------------------------------------------------------------
 
 // SoftCascadeOverIntegralChannelsStage
 
-// required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
-inline bool SoftCascadeOverIntegralChannelsStage::has_feature_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void SoftCascadeOverIntegralChannelsStage::set_has_feature_type() {
-  _has_bits_[0] |= 0x00000001u;
+// required .doppia_protobuf.SoftCascadeOverIntegralChannelsStage.FeatureTypes feature_type = 1;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_feature_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_feature_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_feature_type() const {
+  return _internal_has_feature_type();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_feature_type() {
-  feature_type_ = 0;
-  clear_has_feature_type();
+  _impl_.feature_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::_internal_feature_type() const {
+  return static_cast< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes >(_impl_.feature_type_);
 }
 inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes SoftCascadeOverIntegralChannelsStage::feature_type() const {
-  return static_cast< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes >(feature_type_);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.feature_type)
+  return _internal_feature_type();
+}
+inline void SoftCascadeOverIntegralChannelsStage::_internal_set_feature_type(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes value) {
+  assert(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.feature_type_ = value;
 }
 inline void SoftCascadeOverIntegralChannelsStage::set_feature_type(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes value) {
-  GOOGLE_DCHECK(::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes_IsValid(value));
-  set_has_feature_type();
-  feature_type_ = value;
+  _internal_set_feature_type(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.feature_type)
 }
 
 // optional .doppia_protobuf.IntegralChannelDecisionStump decision_stump = 10;
-inline bool SoftCascadeOverIntegralChannelsStage::has_decision_stump() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void SoftCascadeOverIntegralChannelsStage::set_has_decision_stump() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_decision_stump() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.decision_stump_ != nullptr);
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_decision_stump() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_decision_stump() const {
+  return _internal_has_decision_stump();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_decision_stump() {
-  if (decision_stump_ != NULL) decision_stump_->::doppia_protobuf::IntegralChannelDecisionStump::Clear();
-  clear_has_decision_stump();
+  if (_impl_.decision_stump_ != nullptr) _impl_.decision_stump_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::IntegralChannelDecisionStump& SoftCascadeOverIntegralChannelsStage::_internal_decision_stump() const {
+  const ::doppia_protobuf::IntegralChannelDecisionStump* p = _impl_.decision_stump_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::IntegralChannelDecisionStump&>(
+      ::doppia_protobuf::_IntegralChannelDecisionStump_default_instance_);
 }
 inline const ::doppia_protobuf::IntegralChannelDecisionStump& SoftCascadeOverIntegralChannelsStage::decision_stump() const {
-  return decision_stump_ != NULL ? *decision_stump_ : *default_instance_->decision_stump_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.decision_stump)
+  return _internal_decision_stump();
 }
-inline ::doppia_protobuf::IntegralChannelDecisionStump* SoftCascadeOverIntegralChannelsStage::mutable_decision_stump() {
-  set_has_decision_stump();
-  if (decision_stump_ == NULL) decision_stump_ = new ::doppia_protobuf::IntegralChannelDecisionStump;
-  return decision_stump_;
+inline void SoftCascadeOverIntegralChannelsStage::unsafe_arena_set_allocated_decision_stump(
+    ::doppia_protobuf::IntegralChannelDecisionStump* decision_stump) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.decision_stump_);
+  }
+  _impl_.decision_stump_ = decision_stump;
+  if (decision_stump) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.decision_stump)
 }
 inline ::doppia_protobuf::IntegralChannelDecisionStump* SoftCascadeOverIntegralChannelsStage::release_decision_stump() {
-  clear_has_decision_stump();
-  ::doppia_protobuf::IntegralChannelDecisionStump* temp = decision_stump_;
-  decision_stump_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelDecisionStump* temp = _impl_.decision_stump_;
+  _impl_.decision_stump_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::IntegralChannelDecisionStump* SoftCascadeOverIntegralChannelsStage::unsafe_arena_release_decision_stump() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.decision_stump)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::IntegralChannelDecisionStump* temp = _impl_.decision_stump_;
+  _impl_.decision_stump_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::IntegralChannelDecisionStump* SoftCascadeOverIntegralChannelsStage::_internal_mutable_decision_stump() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.decision_stump_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::IntegralChannelDecisionStump>(GetArenaForAllocation());
+    _impl_.decision_stump_ = p;
+  }
+  return _impl_.decision_stump_;
+}
+inline ::doppia_protobuf::IntegralChannelDecisionStump* SoftCascadeOverIntegralChannelsStage::mutable_decision_stump() {
+  ::doppia_protobuf::IntegralChannelDecisionStump* _msg = _internal_mutable_decision_stump();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.decision_stump)
+  return _msg;
+}
+inline void SoftCascadeOverIntegralChannelsStage::set_allocated_decision_stump(::doppia_protobuf::IntegralChannelDecisionStump* decision_stump) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.decision_stump_;
+  }
+  if (decision_stump) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(decision_stump);
+    if (message_arena != submessage_arena) {
+      decision_stump = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, decision_stump, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.decision_stump_ = decision_stump;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.decision_stump)
+}
 
 // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree level2_decision_tree = 11;
-inline bool SoftCascadeOverIntegralChannelsStage::has_level2_decision_tree() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void SoftCascadeOverIntegralChannelsStage::set_has_level2_decision_tree() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_level2_decision_tree() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.level2_decision_tree_ != nullptr);
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_level2_decision_tree() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_level2_decision_tree() const {
+  return _internal_has_level2_decision_tree();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_level2_decision_tree() {
-  if (level2_decision_tree_ != NULL) level2_decision_tree_->::doppia_protobuf::IntegralChannelBinaryDecisionTree::Clear();
-  clear_has_level2_decision_tree();
+  if (_impl_.level2_decision_tree_ != nullptr) _impl_.level2_decision_tree_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& SoftCascadeOverIntegralChannelsStage::_internal_level2_decision_tree() const {
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree* p = _impl_.level2_decision_tree_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::IntegralChannelBinaryDecisionTree&>(
+      ::doppia_protobuf::_IntegralChannelBinaryDecisionTree_default_instance_);
 }
 inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& SoftCascadeOverIntegralChannelsStage::level2_decision_tree() const {
-  return level2_decision_tree_ != NULL ? *level2_decision_tree_ : *default_instance_->level2_decision_tree_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.level2_decision_tree)
+  return _internal_level2_decision_tree();
 }
-inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::mutable_level2_decision_tree() {
-  set_has_level2_decision_tree();
-  if (level2_decision_tree_ == NULL) level2_decision_tree_ = new ::doppia_protobuf::IntegralChannelBinaryDecisionTree;
-  return level2_decision_tree_;
+inline void SoftCascadeOverIntegralChannelsStage::unsafe_arena_set_allocated_level2_decision_tree(
+    ::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.level2_decision_tree_);
+  }
+  _impl_.level2_decision_tree_ = level2_decision_tree;
+  if (level2_decision_tree) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.level2_decision_tree)
 }
 inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::release_level2_decision_tree() {
-  clear_has_level2_decision_tree();
-  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = level2_decision_tree_;
-  level2_decision_tree_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = _impl_.level2_decision_tree_;
+  _impl_.level2_decision_tree_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::unsafe_arena_release_level2_decision_tree() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.level2_decision_tree)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = _impl_.level2_decision_tree_;
+  _impl_.level2_decision_tree_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::_internal_mutable_level2_decision_tree() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.level2_decision_tree_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::IntegralChannelBinaryDecisionTree>(GetArenaForAllocation());
+    _impl_.level2_decision_tree_ = p;
+  }
+  return _impl_.level2_decision_tree_;
+}
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::mutable_level2_decision_tree() {
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* _msg = _internal_mutable_level2_decision_tree();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.level2_decision_tree)
+  return _msg;
+}
+inline void SoftCascadeOverIntegralChannelsStage::set_allocated_level2_decision_tree(::doppia_protobuf::IntegralChannelBinaryDecisionTree* level2_decision_tree) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.level2_decision_tree_;
+  }
+  if (level2_decision_tree) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(level2_decision_tree);
+    if (message_arena != submessage_arena) {
+      level2_decision_tree = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, level2_decision_tree, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.level2_decision_tree_ = level2_decision_tree;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.level2_decision_tree)
+}
 
 // optional .doppia_protobuf.IntegralChannelBinaryDecisionTree levelN_decision_tree = 12;
-inline bool SoftCascadeOverIntegralChannelsStage::has_leveln_decision_tree() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void SoftCascadeOverIntegralChannelsStage::set_has_leveln_decision_tree() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_leveln_decision_tree() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.leveln_decision_tree_ != nullptr);
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_leveln_decision_tree() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_leveln_decision_tree() const {
+  return _internal_has_leveln_decision_tree();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_leveln_decision_tree() {
-  if (leveln_decision_tree_ != NULL) leveln_decision_tree_->::doppia_protobuf::IntegralChannelBinaryDecisionTree::Clear();
-  clear_has_leveln_decision_tree();
+  if (_impl_.leveln_decision_tree_ != nullptr) _impl_.leveln_decision_tree_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& SoftCascadeOverIntegralChannelsStage::_internal_leveln_decision_tree() const {
+  const ::doppia_protobuf::IntegralChannelBinaryDecisionTree* p = _impl_.leveln_decision_tree_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::IntegralChannelBinaryDecisionTree&>(
+      ::doppia_protobuf::_IntegralChannelBinaryDecisionTree_default_instance_);
 }
 inline const ::doppia_protobuf::IntegralChannelBinaryDecisionTree& SoftCascadeOverIntegralChannelsStage::leveln_decision_tree() const {
-  return leveln_decision_tree_ != NULL ? *leveln_decision_tree_ : *default_instance_->leveln_decision_tree_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.levelN_decision_tree)
+  return _internal_leveln_decision_tree();
 }
-inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::mutable_leveln_decision_tree() {
-  set_has_leveln_decision_tree();
-  if (leveln_decision_tree_ == NULL) leveln_decision_tree_ = new ::doppia_protobuf::IntegralChannelBinaryDecisionTree;
-  return leveln_decision_tree_;
+inline void SoftCascadeOverIntegralChannelsStage::unsafe_arena_set_allocated_leveln_decision_tree(
+    ::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.leveln_decision_tree_);
+  }
+  _impl_.leveln_decision_tree_ = leveln_decision_tree;
+  if (leveln_decision_tree) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.levelN_decision_tree)
 }
 inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::release_leveln_decision_tree() {
-  clear_has_leveln_decision_tree();
-  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = leveln_decision_tree_;
-  leveln_decision_tree_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = _impl_.leveln_decision_tree_;
+  _impl_.leveln_decision_tree_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::unsafe_arena_release_leveln_decision_tree() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.levelN_decision_tree)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* temp = _impl_.leveln_decision_tree_;
+  _impl_.leveln_decision_tree_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::_internal_mutable_leveln_decision_tree() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.leveln_decision_tree_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::IntegralChannelBinaryDecisionTree>(GetArenaForAllocation());
+    _impl_.leveln_decision_tree_ = p;
+  }
+  return _impl_.leveln_decision_tree_;
+}
+inline ::doppia_protobuf::IntegralChannelBinaryDecisionTree* SoftCascadeOverIntegralChannelsStage::mutable_leveln_decision_tree() {
+  ::doppia_protobuf::IntegralChannelBinaryDecisionTree* _msg = _internal_mutable_leveln_decision_tree();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.levelN_decision_tree)
+  return _msg;
+}
+inline void SoftCascadeOverIntegralChannelsStage::set_allocated_leveln_decision_tree(::doppia_protobuf::IntegralChannelBinaryDecisionTree* leveln_decision_tree) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.leveln_decision_tree_;
+  }
+  if (leveln_decision_tree) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(leveln_decision_tree);
+    if (message_arena != submessage_arena) {
+      leveln_decision_tree = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leveln_decision_tree, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.leveln_decision_tree_ = leveln_decision_tree;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.levelN_decision_tree)
+}
 
 // required float weight = 2;
-inline bool SoftCascadeOverIntegralChannelsStage::has_weight() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void SoftCascadeOverIntegralChannelsStage::set_has_weight() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_weight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_weight() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_weight() const {
+  return _internal_has_weight();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_weight() {
-  weight_ = 0;
-  clear_has_weight();
+  _impl_.weight_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float SoftCascadeOverIntegralChannelsStage::_internal_weight() const {
+  return _impl_.weight_;
 }
 inline float SoftCascadeOverIntegralChannelsStage::weight() const {
-  return weight_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.weight)
+  return _internal_weight();
+}
+inline void SoftCascadeOverIntegralChannelsStage::_internal_set_weight(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.weight_ = value;
 }
 inline void SoftCascadeOverIntegralChannelsStage::set_weight(float value) {
-  set_has_weight();
-  weight_ = value;
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.weight)
 }
 
 // required float cascade_threshold = 3;
-inline bool SoftCascadeOverIntegralChannelsStage::has_cascade_threshold() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool SoftCascadeOverIntegralChannelsStage::_internal_has_cascade_threshold() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsStage::set_has_cascade_threshold() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void SoftCascadeOverIntegralChannelsStage::clear_has_cascade_threshold() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool SoftCascadeOverIntegralChannelsStage::has_cascade_threshold() const {
+  return _internal_has_cascade_threshold();
 }
 inline void SoftCascadeOverIntegralChannelsStage::clear_cascade_threshold() {
-  cascade_threshold_ = 0;
-  clear_has_cascade_threshold();
+  _impl_.cascade_threshold_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float SoftCascadeOverIntegralChannelsStage::_internal_cascade_threshold() const {
+  return _impl_.cascade_threshold_;
 }
 inline float SoftCascadeOverIntegralChannelsStage::cascade_threshold() const {
-  return cascade_threshold_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.cascade_threshold)
+  return _internal_cascade_threshold();
+}
+inline void SoftCascadeOverIntegralChannelsStage::_internal_set_cascade_threshold(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cascade_threshold_ = value;
 }
 inline void SoftCascadeOverIntegralChannelsStage::set_cascade_threshold(float value) {
-  set_has_cascade_threshold();
-  cascade_threshold_ = value;
+  _internal_set_cascade_threshold(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsStage.cascade_threshold)
 }
 
 // -------------------------------------------------------------------
@@ -1859,108 +3395,177 @@ inline void SoftCascadeOverIntegralChannelsStage::set_cascade_threshold(float va
 // SoftCascadeOverIntegralChannelsModel
 
 // repeated .doppia_protobuf.SoftCascadeOverIntegralChannelsStage stages = 1;
+inline int SoftCascadeOverIntegralChannelsModel::_internal_stages_size() const {
+  return _impl_.stages_.size();
+}
 inline int SoftCascadeOverIntegralChannelsModel::stages_size() const {
-  return stages_.size();
+  return _internal_stages_size();
 }
 inline void SoftCascadeOverIntegralChannelsModel::clear_stages() {
-  stages_.Clear();
+  _impl_.stages_.Clear();
+}
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsModel::mutable_stages(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.stages)
+  return _impl_.stages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >*
+SoftCascadeOverIntegralChannelsModel::mutable_stages() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.stages)
+  return &_impl_.stages_;
+}
+inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage& SoftCascadeOverIntegralChannelsModel::_internal_stages(int index) const {
+  return _impl_.stages_.Get(index);
 }
 inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage& SoftCascadeOverIntegralChannelsModel::stages(int index) const {
-  return stages_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.stages)
+  return _internal_stages(index);
 }
-inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsModel::mutable_stages(int index) {
-  return stages_.Mutable(index);
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsModel::_internal_add_stages() {
+  return _impl_.stages_.Add();
 }
 inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* SoftCascadeOverIntegralChannelsModel::add_stages() {
-  return stages_.Add();
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage* _add = _internal_add_stages();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.stages)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >&
 SoftCascadeOverIntegralChannelsModel::stages() const {
-  return stages_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage >*
-SoftCascadeOverIntegralChannelsModel::mutable_stages() {
-  return &stages_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.stages)
+  return _impl_.stages_;
 }
 
 // optional string channels_description = 2 [default = "hog6_luv"];
-inline bool SoftCascadeOverIntegralChannelsModel::has_channels_description() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool SoftCascadeOverIntegralChannelsModel::_internal_has_channels_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsModel::set_has_channels_description() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void SoftCascadeOverIntegralChannelsModel::clear_has_channels_description() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool SoftCascadeOverIntegralChannelsModel::has_channels_description() const {
+  return _internal_has_channels_description();
 }
 inline void SoftCascadeOverIntegralChannelsModel::clear_channels_description() {
-  if (channels_description_ != &_default_channels_description_) {
-    channels_description_->assign(_default_channels_description_);
+  _impl_.channels_description_.ClearToDefault(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::Impl_::_i_give_permission_to_break_this_code_default_channels_description_, GetArenaForAllocation());
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SoftCascadeOverIntegralChannelsModel::channels_description() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description)
+  if (_impl_.channels_description_.IsDefault()) return Impl_::_i_give_permission_to_break_this_code_default_channels_description_.get();
+  return _internal_channels_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SoftCascadeOverIntegralChannelsModel::set_channels_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channels_description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description)
+}
+inline std::string* SoftCascadeOverIntegralChannelsModel::mutable_channels_description() {
+  std::string* _s = _internal_mutable_channels_description();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description)
+  return _s;
+}
+inline const std::string& SoftCascadeOverIntegralChannelsModel::_internal_channels_description() const {
+  return _impl_.channels_description_.Get();
+}
+inline void SoftCascadeOverIntegralChannelsModel::_internal_set_channels_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channels_description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SoftCascadeOverIntegralChannelsModel::_internal_mutable_channels_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channels_description_.Mutable(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::Impl_::_i_give_permission_to_break_this_code_default_channels_description_, GetArenaForAllocation());
+}
+inline std::string* SoftCascadeOverIntegralChannelsModel::release_channels_description() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description)
+  if (!_internal_has_channels_description()) {
+    return nullptr;
   }
-  clear_has_channels_description();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channels_description_.Release();
+  return p;
 }
-inline const ::std::string& SoftCascadeOverIntegralChannelsModel::channels_description() const {
-  return *channels_description_;
-}
-inline void SoftCascadeOverIntegralChannelsModel::set_channels_description(const ::std::string& value) {
-  set_has_channels_description();
-  if (channels_description_ == &_default_channels_description_) {
-    channels_description_ = new ::std::string;
+inline void SoftCascadeOverIntegralChannelsModel::set_allocated_channels_description(std::string* channels_description) {
+  if (channels_description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  channels_description_->assign(value);
+  _impl_.channels_description_.SetAllocated(channels_description, GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_description)
 }
-inline void SoftCascadeOverIntegralChannelsModel::set_channels_description(const char* value) {
-  set_has_channels_description();
-  if (channels_description_ == &_default_channels_description_) {
-    channels_description_ = new ::std::string;
-  }
-  channels_description_->assign(value);
+
+// optional uint32 shrinking_factor = 3 [default = 4];
+inline bool SoftCascadeOverIntegralChannelsModel::_internal_has_shrinking_factor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void SoftCascadeOverIntegralChannelsModel::set_channels_description(const char* value, size_t size) {
-  set_has_channels_description();
-  if (channels_description_ == &_default_channels_description_) {
-    channels_description_ = new ::std::string;
-  }
-  channels_description_->assign(reinterpret_cast<const char*>(value), size);
+inline bool SoftCascadeOverIntegralChannelsModel::has_shrinking_factor() const {
+  return _internal_has_shrinking_factor();
 }
-inline ::std::string* SoftCascadeOverIntegralChannelsModel::mutable_channels_description() {
-  set_has_channels_description();
-  if (channels_description_ == &_default_channels_description_) {
-    channels_description_ = new ::std::string(_default_channels_description_);
-  }
-  return channels_description_;
+inline void SoftCascadeOverIntegralChannelsModel::clear_shrinking_factor() {
+  _impl_.shrinking_factor_ = 4u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline ::std::string* SoftCascadeOverIntegralChannelsModel::release_channels_description() {
-  clear_has_channels_description();
-  if (channels_description_ == &_default_channels_description_) {
-    return NULL;
-  } else {
-    ::std::string* temp = channels_description_;
-    channels_description_ = const_cast< ::std::string*>(&_default_channels_description_);
-    return temp;
-  }
+inline uint32_t SoftCascadeOverIntegralChannelsModel::_internal_shrinking_factor() const {
+  return _impl_.shrinking_factor_;
+}
+inline uint32_t SoftCascadeOverIntegralChannelsModel::shrinking_factor() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.shrinking_factor)
+  return _internal_shrinking_factor();
+}
+inline void SoftCascadeOverIntegralChannelsModel::_internal_set_shrinking_factor(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shrinking_factor_ = value;
+}
+inline void SoftCascadeOverIntegralChannelsModel::set_shrinking_factor(uint32_t value) {
+  _internal_set_shrinking_factor(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.shrinking_factor)
 }
 
-// optional uint32 shrinking_factor = 3 [default = 4];
-inline bool SoftCascadeOverIntegralChannelsModel::has_shrinking_factor() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// repeated float channels_scaling_exponents = 4;
+inline int SoftCascadeOverIntegralChannelsModel::_internal_channels_scaling_exponents_size() const {
+  return _impl_.channels_scaling_exponents_.size();
 }
-inline void SoftCascadeOverIntegralChannelsModel::set_has_shrinking_factor() {
-  _has_bits_[0] |= 0x00000004u;
+inline int SoftCascadeOverIntegralChannelsModel::channels_scaling_exponents_size() const {
+  return _internal_channels_scaling_exponents_size();
 }
-inline void SoftCascadeOverIntegralChannelsModel::clear_has_shrinking_factor() {
-  _has_bits_[0] &= ~0x00000004u;
+inline void SoftCascadeOverIntegralChannelsModel::clear_channels_scaling_exponents() {
+  _impl_.channels_scaling_exponents_.Clear();
 }
-inline void SoftCascadeOverIntegralChannelsModel::clear_shrinking_factor() {
-  shrinking_factor_ = 4u;
-  clear_has_shrinking_factor();
+inline float SoftCascadeOverIntegralChannelsModel::_internal_channels_scaling_exponents(int index) const {
+  return _impl_.channels_scaling_exponents_.Get(index);
+}
+inline float SoftCascadeOverIntegralChannelsModel::channels_scaling_exponents(int index) const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_scaling_exponents)
+  return _internal_channels_scaling_exponents(index);
+}
+inline void SoftCascadeOverIntegralChannelsModel::set_channels_scaling_exponents(int index, float value) {
+  _impl_.channels_scaling_exponents_.Set(index, value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_scaling_exponents)
+}
+inline void SoftCascadeOverIntegralChannelsModel::_internal_add_channels_scaling_exponents(float value) {
+  _impl_.channels_scaling_exponents_.Add(value);
 }
-inline ::google::protobuf::uint32 SoftCascadeOverIntegralChannelsModel::shrinking_factor() const {
-  return shrinking_factor_;
+inline void SoftCascadeOverIntegralChannelsModel::add_channels_scaling_exponents(float value) {
+  _internal_add_channels_scaling_exponents(value);
+  // @@protoc_insertion_point(field_add:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_scaling_exponents)
 }
-inline void SoftCascadeOverIntegralChannelsModel::set_shrinking_factor(::google::protobuf::uint32 value) {
-  set_has_shrinking_factor();
-  shrinking_factor_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SoftCascadeOverIntegralChannelsModel::_internal_channels_scaling_exponents() const {
+  return _impl_.channels_scaling_exponents_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+SoftCascadeOverIntegralChannelsModel::channels_scaling_exponents() const {
+  // @@protoc_insertion_point(field_list:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_scaling_exponents)
+  return _internal_channels_scaling_exponents();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SoftCascadeOverIntegralChannelsModel::_internal_mutable_channels_scaling_exponents() {
+  return &_impl_.channels_scaling_exponents_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+SoftCascadeOverIntegralChannelsModel::mutable_channels_scaling_exponents() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.SoftCascadeOverIntegralChannelsModel.channels_scaling_exponents)
+  return _internal_mutable_channels_scaling_exponents();
 }
 
 // -------------------------------------------------------------------
@@ -1968,280 +3573,550 @@ inline void SoftCascadeOverIntegralChannelsModel::set_shrinking_factor(::google:
 // DetectorModel
 
 // optional string detector_name = 1;
-inline bool DetectorModel::has_detector_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool DetectorModel::_internal_has_detector_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void DetectorModel::set_has_detector_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void DetectorModel::clear_has_detector_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool DetectorModel::has_detector_name() const {
+  return _internal_has_detector_name();
 }
 inline void DetectorModel::clear_detector_name() {
-  if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-    detector_name_->clear();
-  }
-  clear_has_detector_name();
-}
-inline const ::std::string& DetectorModel::detector_name() const {
-  return *detector_name_;
-}
-inline void DetectorModel::set_detector_name(const ::std::string& value) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
-  }
-  detector_name_->assign(value);
-}
-inline void DetectorModel::set_detector_name(const char* value) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
-  }
-  detector_name_->assign(value);
-}
-inline void DetectorModel::set_detector_name(const char* value, size_t size) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
+  _impl_.detector_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DetectorModel::detector_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.detector_name)
+  return _internal_detector_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetectorModel::set_detector_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.detector_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DetectorModel.detector_name)
+}
+inline std::string* DetectorModel::mutable_detector_name() {
+  std::string* _s = _internal_mutable_detector_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.detector_name)
+  return _s;
+}
+inline const std::string& DetectorModel::_internal_detector_name() const {
+  return _impl_.detector_name_.Get();
+}
+inline void DetectorModel::_internal_set_detector_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.detector_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DetectorModel::_internal_mutable_detector_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.detector_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DetectorModel::release_detector_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.detector_name)
+  if (!_internal_has_detector_name()) {
+    return nullptr;
   }
-  detector_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* DetectorModel::mutable_detector_name() {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.detector_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.detector_name_.IsDefault()) {
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
   }
-  return detector_name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* DetectorModel::release_detector_name() {
-  clear_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void DetectorModel::set_allocated_detector_name(std::string* detector_name) {
+  if (detector_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = detector_name_;
-    detector_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.detector_name_.SetAllocated(detector_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.detector_name_.IsDefault()) {
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.detector_name)
 }
 
 // required string training_dataset_name = 2;
-inline bool DetectorModel::has_training_dataset_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool DetectorModel::_internal_has_training_dataset_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void DetectorModel::set_has_training_dataset_name() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void DetectorModel::clear_has_training_dataset_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool DetectorModel::has_training_dataset_name() const {
+  return _internal_has_training_dataset_name();
 }
 inline void DetectorModel::clear_training_dataset_name() {
-  if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_->clear();
-  }
-  clear_has_training_dataset_name();
-}
-inline const ::std::string& DetectorModel::training_dataset_name() const {
-  return *training_dataset_name_;
-}
-inline void DetectorModel::set_training_dataset_name(const ::std::string& value) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
-  }
-  training_dataset_name_->assign(value);
-}
-inline void DetectorModel::set_training_dataset_name(const char* value) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
-  }
-  training_dataset_name_->assign(value);
-}
-inline void DetectorModel::set_training_dataset_name(const char* value, size_t size) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
+  _impl_.training_dataset_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& DetectorModel::training_dataset_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.training_dataset_name)
+  return _internal_training_dataset_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DetectorModel::set_training_dataset_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.training_dataset_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DetectorModel.training_dataset_name)
+}
+inline std::string* DetectorModel::mutable_training_dataset_name() {
+  std::string* _s = _internal_mutable_training_dataset_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.training_dataset_name)
+  return _s;
+}
+inline const std::string& DetectorModel::_internal_training_dataset_name() const {
+  return _impl_.training_dataset_name_.Get();
+}
+inline void DetectorModel::_internal_set_training_dataset_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.training_dataset_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DetectorModel::_internal_mutable_training_dataset_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.training_dataset_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DetectorModel::release_training_dataset_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.training_dataset_name)
+  if (!_internal_has_training_dataset_name()) {
+    return nullptr;
   }
-  training_dataset_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* DetectorModel::mutable_training_dataset_name() {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.training_dataset_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.training_dataset_name_.IsDefault()) {
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
   }
-  return training_dataset_name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* DetectorModel::release_training_dataset_name() {
-  clear_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void DetectorModel::set_allocated_training_dataset_name(std::string* training_dataset_name) {
+  if (training_dataset_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = training_dataset_name_;
-    training_dataset_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.training_dataset_name_.SetAllocated(training_dataset_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.training_dataset_name_.IsDefault()) {
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.training_dataset_name)
 }
 
 // optional .doppia_protobuf.Point2d model_window_size = 10;
-inline bool DetectorModel::has_model_window_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool DetectorModel::_internal_has_model_window_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.model_window_size_ != nullptr);
+  return value;
 }
-inline void DetectorModel::set_has_model_window_size() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void DetectorModel::clear_has_model_window_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool DetectorModel::has_model_window_size() const {
+  return _internal_has_model_window_size();
 }
-inline void DetectorModel::clear_model_window_size() {
-  if (model_window_size_ != NULL) model_window_size_->::doppia_protobuf::Point2d::Clear();
-  clear_has_model_window_size();
+inline const ::doppia_protobuf::Point2d& DetectorModel::_internal_model_window_size() const {
+  const ::doppia_protobuf::Point2d* p = _impl_.model_window_size_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Point2d&>(
+      ::doppia_protobuf::_Point2d_default_instance_);
 }
 inline const ::doppia_protobuf::Point2d& DetectorModel::model_window_size() const {
-  return model_window_size_ != NULL ? *model_window_size_ : *default_instance_->model_window_size_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.model_window_size)
+  return _internal_model_window_size();
 }
-inline ::doppia_protobuf::Point2d* DetectorModel::mutable_model_window_size() {
-  set_has_model_window_size();
-  if (model_window_size_ == NULL) model_window_size_ = new ::doppia_protobuf::Point2d;
-  return model_window_size_;
+inline void DetectorModel::unsafe_arena_set_allocated_model_window_size(
+    ::doppia_protobuf::Point2d* model_window_size) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.model_window_size_);
+  }
+  _impl_.model_window_size_ = model_window_size;
+  if (model_window_size) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.DetectorModel.model_window_size)
 }
 inline ::doppia_protobuf::Point2d* DetectorModel::release_model_window_size() {
-  clear_has_model_window_size();
-  ::doppia_protobuf::Point2d* temp = model_window_size_;
-  model_window_size_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::Point2d* temp = _impl_.model_window_size_;
+  _impl_.model_window_size_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::Point2d* DetectorModel::unsafe_arena_release_model_window_size() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.model_window_size)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::Point2d* temp = _impl_.model_window_size_;
+  _impl_.model_window_size_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::Point2d* DetectorModel::_internal_mutable_model_window_size() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.model_window_size_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Point2d>(GetArenaForAllocation());
+    _impl_.model_window_size_ = p;
+  }
+  return _impl_.model_window_size_;
+}
+inline ::doppia_protobuf::Point2d* DetectorModel::mutable_model_window_size() {
+  ::doppia_protobuf::Point2d* _msg = _internal_mutable_model_window_size();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.model_window_size)
+  return _msg;
+}
+inline void DetectorModel::set_allocated_model_window_size(::doppia_protobuf::Point2d* model_window_size) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.model_window_size_);
+  }
+  if (model_window_size) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(model_window_size));
+    if (message_arena != submessage_arena) {
+      model_window_size = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, model_window_size, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.model_window_size_ = model_window_size;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.model_window_size)
+}
 
 // optional .doppia_protobuf.Box object_window = 11;
-inline bool DetectorModel::has_object_window() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void DetectorModel::set_has_object_window() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool DetectorModel::_internal_has_object_window() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.object_window_ != nullptr);
+  return value;
 }
-inline void DetectorModel::clear_has_object_window() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool DetectorModel::has_object_window() const {
+  return _internal_has_object_window();
 }
-inline void DetectorModel::clear_object_window() {
-  if (object_window_ != NULL) object_window_->::doppia_protobuf::Box::Clear();
-  clear_has_object_window();
+inline const ::doppia_protobuf::Box& DetectorModel::_internal_object_window() const {
+  const ::doppia_protobuf::Box* p = _impl_.object_window_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Box&>(
+      ::doppia_protobuf::_Box_default_instance_);
 }
 inline const ::doppia_protobuf::Box& DetectorModel::object_window() const {
-  return object_window_ != NULL ? *object_window_ : *default_instance_->object_window_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.object_window)
+  return _internal_object_window();
 }
-inline ::doppia_protobuf::Box* DetectorModel::mutable_object_window() {
-  set_has_object_window();
-  if (object_window_ == NULL) object_window_ = new ::doppia_protobuf::Box;
-  return object_window_;
+inline void DetectorModel::unsafe_arena_set_allocated_object_window(
+    ::doppia_protobuf::Box* object_window) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.object_window_);
+  }
+  _impl_.object_window_ = object_window;
+  if (object_window) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.DetectorModel.object_window)
 }
 inline ::doppia_protobuf::Box* DetectorModel::release_object_window() {
-  clear_has_object_window();
-  ::doppia_protobuf::Box* temp = object_window_;
-  object_window_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::doppia_protobuf::Box* temp = _impl_.object_window_;
+  _impl_.object_window_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Box* DetectorModel::unsafe_arena_release_object_window() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.object_window)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::doppia_protobuf::Box* temp = _impl_.object_window_;
+  _impl_.object_window_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Box* DetectorModel::_internal_mutable_object_window() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.object_window_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Box>(GetArenaForAllocation());
+    _impl_.object_window_ = p;
+  }
+  return _impl_.object_window_;
+}
+inline ::doppia_protobuf::Box* DetectorModel::mutable_object_window() {
+  ::doppia_protobuf::Box* _msg = _internal_mutable_object_window();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.object_window)
+  return _msg;
+}
+inline void DetectorModel::set_allocated_object_window(::doppia_protobuf::Box* object_window) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.object_window_);
+  }
+  if (object_window) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(object_window));
+    if (message_arena != submessage_arena) {
+      object_window = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, object_window, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.object_window_ = object_window;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.object_window)
+}
 
 // required .doppia_protobuf.DetectorModel.DetectorTypes detector_type = 3;
-inline bool DetectorModel::has_detector_type() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool DetectorModel::_internal_has_detector_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void DetectorModel::set_has_detector_type() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void DetectorModel::clear_has_detector_type() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool DetectorModel::has_detector_type() const {
+  return _internal_has_detector_type();
 }
 inline void DetectorModel::clear_detector_type() {
-  detector_type_ = 0;
-  clear_has_detector_type();
+  _impl_.detector_type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline ::doppia_protobuf::DetectorModel_DetectorTypes DetectorModel::_internal_detector_type() const {
+  return static_cast< ::doppia_protobuf::DetectorModel_DetectorTypes >(_impl_.detector_type_);
 }
 inline ::doppia_protobuf::DetectorModel_DetectorTypes DetectorModel::detector_type() const {
-  return static_cast< ::doppia_protobuf::DetectorModel_DetectorTypes >(detector_type_);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.detector_type)
+  return _internal_detector_type();
+}
+inline void DetectorModel::_internal_set_detector_type(::doppia_protobuf::DetectorModel_DetectorTypes value) {
+  assert(::doppia_protobuf::DetectorModel_DetectorTypes_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.detector_type_ = value;
 }
 inline void DetectorModel::set_detector_type(::doppia_protobuf::DetectorModel_DetectorTypes value) {
-  GOOGLE_DCHECK(::doppia_protobuf::DetectorModel_DetectorTypes_IsValid(value));
-  set_has_detector_type();
-  detector_type_ = value;
+  _internal_set_detector_type(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DetectorModel.detector_type)
 }
 
 // optional .doppia_protobuf.LinearSvmModel linear_svm_model = 100;
-inline bool DetectorModel::has_linear_svm_model() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void DetectorModel::set_has_linear_svm_model() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool DetectorModel::_internal_has_linear_svm_model() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.linear_svm_model_ != nullptr);
+  return value;
 }
-inline void DetectorModel::clear_has_linear_svm_model() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool DetectorModel::has_linear_svm_model() const {
+  return _internal_has_linear_svm_model();
 }
 inline void DetectorModel::clear_linear_svm_model() {
-  if (linear_svm_model_ != NULL) linear_svm_model_->::doppia_protobuf::LinearSvmModel::Clear();
-  clear_has_linear_svm_model();
+  if (_impl_.linear_svm_model_ != nullptr) _impl_.linear_svm_model_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::doppia_protobuf::LinearSvmModel& DetectorModel::_internal_linear_svm_model() const {
+  const ::doppia_protobuf::LinearSvmModel* p = _impl_.linear_svm_model_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::LinearSvmModel&>(
+      ::doppia_protobuf::_LinearSvmModel_default_instance_);
 }
 inline const ::doppia_protobuf::LinearSvmModel& DetectorModel::linear_svm_model() const {
-  return linear_svm_model_ != NULL ? *linear_svm_model_ : *default_instance_->linear_svm_model_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.linear_svm_model)
+  return _internal_linear_svm_model();
 }
-inline ::doppia_protobuf::LinearSvmModel* DetectorModel::mutable_linear_svm_model() {
-  set_has_linear_svm_model();
-  if (linear_svm_model_ == NULL) linear_svm_model_ = new ::doppia_protobuf::LinearSvmModel;
-  return linear_svm_model_;
+inline void DetectorModel::unsafe_arena_set_allocated_linear_svm_model(
+    ::doppia_protobuf::LinearSvmModel* linear_svm_model) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.linear_svm_model_);
+  }
+  _impl_.linear_svm_model_ = linear_svm_model;
+  if (linear_svm_model) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.DetectorModel.linear_svm_model)
 }
 inline ::doppia_protobuf::LinearSvmModel* DetectorModel::release_linear_svm_model() {
-  clear_has_linear_svm_model();
-  ::doppia_protobuf::LinearSvmModel* temp = linear_svm_model_;
-  linear_svm_model_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::doppia_protobuf::LinearSvmModel* temp = _impl_.linear_svm_model_;
+  _impl_.linear_svm_model_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::LinearSvmModel* DetectorModel::unsafe_arena_release_linear_svm_model() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.linear_svm_model)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::doppia_protobuf::LinearSvmModel* temp = _impl_.linear_svm_model_;
+  _impl_.linear_svm_model_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::LinearSvmModel* DetectorModel::_internal_mutable_linear_svm_model() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.linear_svm_model_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::LinearSvmModel>(GetArenaForAllocation());
+    _impl_.linear_svm_model_ = p;
+  }
+  return _impl_.linear_svm_model_;
+}
+inline ::doppia_protobuf::LinearSvmModel* DetectorModel::mutable_linear_svm_model() {
+  ::doppia_protobuf::LinearSvmModel* _msg = _internal_mutable_linear_svm_model();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.linear_svm_model)
+  return _msg;
+}
+inline void DetectorModel::set_allocated_linear_svm_model(::doppia_protobuf::LinearSvmModel* linear_svm_model) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.linear_svm_model_;
+  }
+  if (linear_svm_model) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(linear_svm_model);
+    if (message_arena != submessage_arena) {
+      linear_svm_model = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, linear_svm_model, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.linear_svm_model_ = linear_svm_model;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.linear_svm_model)
+}
 
 // optional .doppia_protobuf.SoftCascadeOverIntegralChannelsModel soft_cascade_model = 102;
-inline bool DetectorModel::has_soft_cascade_model() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void DetectorModel::set_has_soft_cascade_model() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool DetectorModel::_internal_has_soft_cascade_model() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.soft_cascade_model_ != nullptr);
+  return value;
 }
-inline void DetectorModel::clear_has_soft_cascade_model() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool DetectorModel::has_soft_cascade_model() const {
+  return _internal_has_soft_cascade_model();
 }
 inline void DetectorModel::clear_soft_cascade_model() {
-  if (soft_cascade_model_ != NULL) soft_cascade_model_->::doppia_protobuf::SoftCascadeOverIntegralChannelsModel::Clear();
-  clear_has_soft_cascade_model();
+  if (_impl_.soft_cascade_model_ != nullptr) _impl_.soft_cascade_model_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& DetectorModel::_internal_soft_cascade_model() const {
+  const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* p = _impl_.soft_cascade_model_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel&>(
+      ::doppia_protobuf::_SoftCascadeOverIntegralChannelsModel_default_instance_);
 }
 inline const ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel& DetectorModel::soft_cascade_model() const {
-  return soft_cascade_model_ != NULL ? *soft_cascade_model_ : *default_instance_->soft_cascade_model_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.soft_cascade_model)
+  return _internal_soft_cascade_model();
 }
-inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* DetectorModel::mutable_soft_cascade_model() {
-  set_has_soft_cascade_model();
-  if (soft_cascade_model_ == NULL) soft_cascade_model_ = new ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel;
-  return soft_cascade_model_;
+inline void DetectorModel::unsafe_arena_set_allocated_soft_cascade_model(
+    ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.soft_cascade_model_);
+  }
+  _impl_.soft_cascade_model_ = soft_cascade_model;
+  if (soft_cascade_model) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.DetectorModel.soft_cascade_model)
 }
 inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* DetectorModel::release_soft_cascade_model() {
-  clear_has_soft_cascade_model();
-  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* temp = soft_cascade_model_;
-  soft_cascade_model_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* temp = _impl_.soft_cascade_model_;
+  _impl_.soft_cascade_model_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* DetectorModel::unsafe_arena_release_soft_cascade_model() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.DetectorModel.soft_cascade_model)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* temp = _impl_.soft_cascade_model_;
+  _impl_.soft_cascade_model_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* DetectorModel::_internal_mutable_soft_cascade_model() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.soft_cascade_model_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::SoftCascadeOverIntegralChannelsModel>(GetArenaForAllocation());
+    _impl_.soft_cascade_model_ = p;
+  }
+  return _impl_.soft_cascade_model_;
+}
+inline ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* DetectorModel::mutable_soft_cascade_model() {
+  ::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* _msg = _internal_mutable_soft_cascade_model();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.DetectorModel.soft_cascade_model)
+  return _msg;
+}
+inline void DetectorModel::set_allocated_soft_cascade_model(::doppia_protobuf::SoftCascadeOverIntegralChannelsModel* soft_cascade_model) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.soft_cascade_model_;
+  }
+  if (soft_cascade_model) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(soft_cascade_model);
+    if (message_arena != submessage_arena) {
+      soft_cascade_model = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, soft_cascade_model, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.soft_cascade_model_ = soft_cascade_model;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.DetectorModel.soft_cascade_model)
+}
 
 // optional float scale = 200 [default = 1];
-inline bool DetectorModel::has_scale() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void DetectorModel::set_has_scale() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool DetectorModel::_internal_has_scale() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void DetectorModel::clear_has_scale() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool DetectorModel::has_scale() const {
+  return _internal_has_scale();
 }
 inline void DetectorModel::clear_scale() {
-  scale_ = 1;
-  clear_has_scale();
+  _impl_.scale_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float DetectorModel::_internal_scale() const {
+  return _impl_.scale_;
 }
 inline float DetectorModel::scale() const {
-  return scale_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.DetectorModel.scale)
+  return _internal_scale();
+}
+inline void DetectorModel::_internal_set_scale(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.scale_ = value;
 }
 inline void DetectorModel::set_scale(float value) {
-  set_has_scale();
-  scale_ = value;
+  _internal_set_scale(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.DetectorModel.scale)
 }
 
 // -------------------------------------------------------------------
@@ -2249,168 +4124,221 @@ inline void DetectorModel::set_scale(float value) {
 // MultiScalesDetectorModel
 
 // optional string detector_name = 1;
-inline bool MultiScalesDetectorModel::has_detector_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool MultiScalesDetectorModel::_internal_has_detector_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void MultiScalesDetectorModel::set_has_detector_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void MultiScalesDetectorModel::clear_has_detector_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool MultiScalesDetectorModel::has_detector_name() const {
+  return _internal_has_detector_name();
 }
 inline void MultiScalesDetectorModel::clear_detector_name() {
-  if (detector_name_ != &::google::protobuf::internal::kEmptyString) {
-    detector_name_->clear();
-  }
-  clear_has_detector_name();
-}
-inline const ::std::string& MultiScalesDetectorModel::detector_name() const {
-  return *detector_name_;
-}
-inline void MultiScalesDetectorModel::set_detector_name(const ::std::string& value) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
-  }
-  detector_name_->assign(value);
-}
-inline void MultiScalesDetectorModel::set_detector_name(const char* value) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
-  }
-  detector_name_->assign(value);
-}
-inline void MultiScalesDetectorModel::set_detector_name(const char* value, size_t size) {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
+  _impl_.detector_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& MultiScalesDetectorModel::detector_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.MultiScalesDetectorModel.detector_name)
+  return _internal_detector_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiScalesDetectorModel::set_detector_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.detector_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.MultiScalesDetectorModel.detector_name)
+}
+inline std::string* MultiScalesDetectorModel::mutable_detector_name() {
+  std::string* _s = _internal_mutable_detector_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.MultiScalesDetectorModel.detector_name)
+  return _s;
+}
+inline const std::string& MultiScalesDetectorModel::_internal_detector_name() const {
+  return _impl_.detector_name_.Get();
+}
+inline void MultiScalesDetectorModel::_internal_set_detector_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.detector_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiScalesDetectorModel::_internal_mutable_detector_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.detector_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiScalesDetectorModel::release_detector_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.MultiScalesDetectorModel.detector_name)
+  if (!_internal_has_detector_name()) {
+    return nullptr;
   }
-  detector_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* MultiScalesDetectorModel::mutable_detector_name() {
-  set_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    detector_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.detector_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.detector_name_.IsDefault()) {
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
   }
-  return detector_name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* MultiScalesDetectorModel::release_detector_name() {
-  clear_has_detector_name();
-  if (detector_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void MultiScalesDetectorModel::set_allocated_detector_name(std::string* detector_name) {
+  if (detector_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = detector_name_;
-    detector_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.detector_name_.SetAllocated(detector_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.detector_name_.IsDefault()) {
+    _impl_.detector_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.MultiScalesDetectorModel.detector_name)
 }
 
 // required string training_dataset_name = 2;
-inline bool MultiScalesDetectorModel::has_training_dataset_name() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool MultiScalesDetectorModel::_internal_has_training_dataset_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void MultiScalesDetectorModel::set_has_training_dataset_name() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void MultiScalesDetectorModel::clear_has_training_dataset_name() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool MultiScalesDetectorModel::has_training_dataset_name() const {
+  return _internal_has_training_dataset_name();
 }
 inline void MultiScalesDetectorModel::clear_training_dataset_name() {
-  if (training_dataset_name_ != &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_->clear();
-  }
-  clear_has_training_dataset_name();
-}
-inline const ::std::string& MultiScalesDetectorModel::training_dataset_name() const {
-  return *training_dataset_name_;
-}
-inline void MultiScalesDetectorModel::set_training_dataset_name(const ::std::string& value) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
-  }
-  training_dataset_name_->assign(value);
-}
-inline void MultiScalesDetectorModel::set_training_dataset_name(const char* value) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
-  }
-  training_dataset_name_->assign(value);
-}
-inline void MultiScalesDetectorModel::set_training_dataset_name(const char* value, size_t size) {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
+  _impl_.training_dataset_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& MultiScalesDetectorModel::training_dataset_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.MultiScalesDetectorModel.training_dataset_name)
+  return _internal_training_dataset_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void MultiScalesDetectorModel::set_training_dataset_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.training_dataset_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.MultiScalesDetectorModel.training_dataset_name)
+}
+inline std::string* MultiScalesDetectorModel::mutable_training_dataset_name() {
+  std::string* _s = _internal_mutable_training_dataset_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.MultiScalesDetectorModel.training_dataset_name)
+  return _s;
+}
+inline const std::string& MultiScalesDetectorModel::_internal_training_dataset_name() const {
+  return _impl_.training_dataset_name_.Get();
+}
+inline void MultiScalesDetectorModel::_internal_set_training_dataset_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.training_dataset_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* MultiScalesDetectorModel::_internal_mutable_training_dataset_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.training_dataset_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* MultiScalesDetectorModel::release_training_dataset_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.MultiScalesDetectorModel.training_dataset_name)
+  if (!_internal_has_training_dataset_name()) {
+    return nullptr;
   }
-  training_dataset_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* MultiScalesDetectorModel::mutable_training_dataset_name() {
-  set_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    training_dataset_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.training_dataset_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.training_dataset_name_.IsDefault()) {
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
   }
-  return training_dataset_name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* MultiScalesDetectorModel::release_training_dataset_name() {
-  clear_has_training_dataset_name();
-  if (training_dataset_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void MultiScalesDetectorModel::set_allocated_training_dataset_name(std::string* training_dataset_name) {
+  if (training_dataset_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = training_dataset_name_;
-    training_dataset_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.training_dataset_name_.SetAllocated(training_dataset_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.training_dataset_name_.IsDefault()) {
+    _impl_.training_dataset_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.MultiScalesDetectorModel.training_dataset_name)
 }
 
 // repeated .doppia_protobuf.DetectorModel detectors = 3;
+inline int MultiScalesDetectorModel::_internal_detectors_size() const {
+  return _impl_.detectors_.size();
+}
 inline int MultiScalesDetectorModel::detectors_size() const {
-  return detectors_.size();
+  return _internal_detectors_size();
 }
 inline void MultiScalesDetectorModel::clear_detectors() {
-  detectors_.Clear();
+  _impl_.detectors_.Clear();
+}
+inline ::doppia_protobuf::DetectorModel* MultiScalesDetectorModel::mutable_detectors(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.MultiScalesDetectorModel.detectors)
+  return _impl_.detectors_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DetectorModel >*
+MultiScalesDetectorModel::mutable_detectors() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.MultiScalesDetectorModel.detectors)
+  return &_impl_.detectors_;
+}
+inline const ::doppia_protobuf::DetectorModel& MultiScalesDetectorModel::_internal_detectors(int index) const {
+  return _impl_.detectors_.Get(index);
 }
 inline const ::doppia_protobuf::DetectorModel& MultiScalesDetectorModel::detectors(int index) const {
-  return detectors_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.MultiScalesDetectorModel.detectors)
+  return _internal_detectors(index);
 }
-inline ::doppia_protobuf::DetectorModel* MultiScalesDetectorModel::mutable_detectors(int index) {
-  return detectors_.Mutable(index);
+inline ::doppia_protobuf::DetectorModel* MultiScalesDetectorModel::_internal_add_detectors() {
+  return _impl_.detectors_.Add();
 }
 inline ::doppia_protobuf::DetectorModel* MultiScalesDetectorModel::add_detectors() {
-  return detectors_.Add();
+  ::doppia_protobuf::DetectorModel* _add = _internal_add_detectors();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.MultiScalesDetectorModel.detectors)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DetectorModel >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::DetectorModel >&
 MultiScalesDetectorModel::detectors() const {
-  return detectors_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::DetectorModel >*
-MultiScalesDetectorModel::mutable_detectors() {
-  return &detectors_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.MultiScalesDetectorModel.detectors)
+  return _impl_.detectors_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes>() {
   return ::doppia_protobuf::SoftCascadeOverIntegralChannelsStage_FeatureTypes_descriptor();
 }
+template <> struct is_proto_enum< ::doppia_protobuf::DetectorModel_DetectorTypes> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::doppia_protobuf::DetectorModel_DetectorTypes>() {
   return ::doppia_protobuf::DetectorModel_DetectorTypes_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_detector_5fmodel_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_detector_5fmodel_2eproto
@@ -19,8 +19,14 @@
 #include <opencv2/imgproc/imgproc.hpp>
 #include <opencv2/highgui/highgui.hpp>
 
+#include <emmintrin.h>
+
 #include <string>
 #include <stdexcept>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
 
 namespace
 {
@@ -126,7 +132,7 @@ IntegralChannelsForPedestrians::IntegralChannelsForPedestrians()
     : num_angle_bins(angle_bin_computer.get_num_bins()),
       resizing_factor(get_shrinking_factor())
 {
-    // nothing to do here
+    use_single_pass_computation = false;
 
     pre_smoothing_filter_p = create_pre_smoothing_filter();
     return;
@@ -151,23 +157,7 @@ void IntegralChannelsForPedestrians::set_image(const boost::gil::rgb8c_view_t &t
     const int num_channels = 10;
 
     input_size = the_input_view.dimensions();
-
-    //channel_size = input_image.dimensions() / resizing_factor;
-    // +resizing_factor/2 to round-up
-    if(resizing_factor == 4)
-    {
-        channel_size.x = (( (input_size.x+1)/2) + 1)/2;
-        channel_size.y = (( (input_size.y+1)/2) + 1)/2;
-    }
-    else if(resizing_factor == 2)
-    {
-        channel_size.x = (input_size.x+1) / 2;
-        channel_size.y = (input_size.y+1) / 2;
-    }
-    else
-    {
-        channel_size = input_size;
-    }
+    channel_size = get_channel_size(input_size);
 
     static int num_calls = 0;
     if(num_calls < 100)
@@ -192,13 +182,9 @@ void IntegralChannelsForPedestrians::set_image(const boost::gil::rgb8c_view_t &t
     }
 
     // allocate the channel images
+    // (input_channels are allocated by compute_v0 and compute_v1, when needed)
     channels.resize(boost::extents[num_channels][channel_size.y][channel_size.x]);
     integral_channels.resize(boost::extents[num_channels][channel_size.y+1][channel_size.x+1]);
-    input_channels.resize(boost::extents[10][input_size.y][input_size.x]);
-    // since  hog_input_channels[angle_index][y][x] does set the value for all hog channels,
-    // we need to set them all to zero
-    fill(input_channels, 0);
-    // all other channels will be completelly overwritten, so no need to fill them in
 
 
     // copy the input image
@@ -211,13 +197,41 @@ void IntegralChannelsForPedestrians::set_image(const boost::gil::rgb8c_view_t &t
 void IntegralChannelsForPedestrians::compute()
 {
     //compute_v0();
-    compute_v1();
+    if(use_single_pass_computation)
+    {
+        compute_v2();
+    }
+    else
+    {
+        compute_v1();
+    }
 
     return;
 }
 
 
-void compute_derivative(cv::InputArray _src, cv::OutputArray _dst, int ddepth, const int dx, const int dy)
+void IntegralChannelsForPedestrians::set_single_pass_computation(const bool use_single_pass_computation_)
+{
+    use_single_pass_computation = use_single_pass_computation_;
+    return;
+}
+
+
+void IntegralChannelsForPedestrians::allocate_input_channels()
+{
+    input_channels.resize(boost::extents[10][input_size.y][input_size.x]);
+    // since  hog_input_channels[angle_index][y][x] does set the value for all hog channels,
+    // we need to set them all to zero
+    fill(input_channels, 0);
+    // all other channels will be completelly overwritten, so no need to fill them in
+    return;
+}
+
+
+/// dx_filter and dy_filter are created on the first call,
+/// filters are stateful, they should not be shared across threads
+void compute_derivative(cv::InputArray _src, cv::OutputArray _dst, int ddepth, const int dx, const int dy,
+                        filter_shared_pointer_t &dx_filter, filter_shared_pointer_t &dy_filter)
 {
     cv::Mat src = _src.getMat();
     if (ddepth < 0)
@@ -231,7 +245,6 @@ void compute_derivative(cv::InputArray _src, cv::OutputArray _dst, int ddepth, c
     //const int kernel_type = cv::DataType<float>::type;
     //const int kernel_type = cv::DataType<boost::int8_t>::type;
 
-    static cv::Ptr<cv::FilterEngine> dx_filter, dy_filter;
     if(dx_filter.empty())
     {
         const cv::Mat dx_kernel = (cv::Mat_<boost::int8_t>(1, 3) << -1, 0, 1);
@@ -470,8 +483,8 @@ void IntegralChannelsForPedestrians::compute_hog_channels_v1()
     if(use_gray_derivatives)
     {
         cv::cvtColor(smoothed_input_mat, gray_input_mat, CV_RGB2GRAY);
-        compute_derivative(gray_input_mat, df_dx, CV_16S, 1, 0);
-        compute_derivative(gray_input_mat, df_dy, CV_16S, 0, 1);
+        compute_derivative(gray_input_mat, df_dx, CV_16S, 1, 0, derivative_dx_filter_p, derivative_dy_filter_p);
+        compute_derivative(gray_input_mat, df_dy, CV_16S, 0, 1, derivative_dx_filter_p, derivative_dy_filter_p);
     }
     else
     {
@@ -808,6 +821,8 @@ void IntegralChannelsForPedestrians::integrate_channels_v0()
 
 void IntegralChannelsForPedestrians::compute_v0()
 {
+    allocate_input_channels();
+
     // in OpenCv 2.2 pyrDown, cvtColor and integral/integrate are all non-parallel operations
     // when possible, we run each channel task in parallel
 
@@ -838,6 +853,8 @@ void IntegralChannelsForPedestrians::compute_v1()
         throw std::logic_error("IntegralChannelsForPedestrians::compute_v1 only supports uint16_t channels_t");
     }
 
+    allocate_input_channels();
+
     // in OpenCv 2.2 pyrDown, cvtColor and integral/integrate are all non-parallel operations
     // when possible, we run each channel task in parallel
 
@@ -860,6 +877,399 @@ void IntegralChannelsForPedestrians::compute_v1()
 }
 
 
+// ~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~=~
+// Helper functions for compute_v2
+
+/// mirrors the out of range indices, like cv::BORDER_REFLECT_101 (the default border of the opencv filters)
+inline
+int reflect_101(const int index, const int size)
+{
+    if(index < 0)
+    {
+        return -index;
+    }
+    else if(index >= size)
+    {
+        return 2*size - 2 - index;
+    }
+    return index;
+}
+
+
+/// horizontal pass of the pre_smoothing_filter ([1 2 1] binomial kernel), over an interleaved rgb row
+inline
+void horizontal_binomial_filter(const boost::uint8_t *rgb_row, const int width, boost::uint16_t *filtered_row)
+{
+    const int num_values = 3*width;
+    for(int c=0; c < 3; c+=1)
+    {
+        filtered_row[c] = 2*rgb_row[c] + 2*rgb_row[3 + c];
+        filtered_row[num_values - 3 + c] = 2*rgb_row[num_values - 3 + c] + 2*rgb_row[num_values - 6 + c];
+    }
+
+    for(int i=3; i < (num_values - 3); i+=1)
+    {
+        filtered_row[i] = rgb_row[i - 3] + 2*rgb_row[i] + rgb_row[i + 3];
+    }
+
+    return;
+}
+
+
+/// vertical pass of the pre_smoothing_filter, rounds like the opencv fixed point filters
+inline
+void vertical_binomial_filter(const boost::uint16_t *row_above, const boost::uint16_t *row, const boost::uint16_t *row_below,
+                              const int num_values, boost::uint8_t *smoothed_row)
+{
+    for(int i=0; i < num_values; i+=1)
+    {
+        smoothed_row[i] = (row_above[i] + 2*row[i] + row_below[i] + 8) >> 4;
+    }
+    return;
+}
+
+
+/// same fixed point computation as cv::cvtColor(..., CV_RGB2GRAY)
+inline
+void rgb_to_gray(const boost::uint8_t *rgb_row, const int width, boost::uint8_t *gray_row)
+{
+    for(int x=0; x < width; x+=1)
+    {
+        const boost::uint8_t *rgb = rgb_row + 3*x;
+        gray_row[x] = (rgb[0]*4899 + rgb[1]*9617 + rgb[2]*1868 + (1 << 13)) >> 14;
+    }
+    return;
+}
+
+
+/// loads 4 uint8 values as 4 int32
+inline
+__m128i load_4_uint8_as_int32(const boost::uint8_t *data)
+{
+    boost::int32_t four_values;
+    std::memcpy(&four_values, data, sizeof(four_values));
+    const __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(four_values), zero), zero);
+}
+
+
+/// stores the 4 lower bytes of 4 int32 values (in the range [0, 255])
+inline
+void store_int32_as_4_uint8(const __m128i values, boost::uint8_t *data)
+{
+    const __m128i values_u8 = _mm_packus_epi16(_mm_packs_epi32(values, values), values);
+    const boost::int32_t four_values = _mm_cvtsi128_si32(values_u8);
+    std::memcpy(data, &four_values, sizeof(four_values));
+    return;
+}
+
+
+/// same computation as compute_hog_channels, for one pixel
+template<int num_bins>
+inline
+void compute_hog_pixel(const int x, const float dx, const float dy,
+                       const AngleBinComputer<num_bins> &angle_bin_computer,
+                       const float magnitude_scaling,
+                       boost::uint8_t * const *hog_rows)
+{
+    const int num_angle_bins = angle_bin_computer.get_num_bins();
+    const float magnitude = std::min(255.0f, std::sqrt(dx*dx + dy*dy) * magnitude_scaling);
+    const boost::uint8_t magnitude_u8 = static_cast<boost::uint8_t>(magnitude);
+    const int angle_index = angle_bin_computer(dy, dx);
+
+    for(int angle_bin_index = 0; angle_bin_index < num_angle_bins; angle_bin_index+=1)
+    {
+        hog_rows[angle_bin_index][x] = (angle_bin_index == angle_index)? magnitude_u8 : 0;
+    }
+    hog_rows[num_angle_bins][x] = magnitude_u8;
+    return;
+}
+
+
+/// computes the gradient orientation channels and the gradient magnitude channel for one row,
+/// the derivatives are [-1 0 1] filters over the gray image (like compute_derivative),
+/// the 4 pixels at a time SSE2 code follows compute_hog_channels and AngleBinComputer
+template<int num_bins>
+inline
+void compute_hog_row(const boost::uint8_t *gray_row_above, const boost::uint8_t *gray_row,
+                     const boost::uint8_t *gray_row_below, const int width,
+                     const AngleBinComputer<num_bins> &angle_bin_computer,
+                     const float magnitude_scaling,
+                     boost::uint8_t * const *hog_rows)
+{
+    const int num_angle_bins = angle_bin_computer.get_num_bins();
+
+    // reflect 101 borders, the horizontal derivative is zero on the first and last columns
+    compute_hog_pixel(0, 0, gray_row_below[0] - gray_row_above[0],
+                      angle_bin_computer, magnitude_scaling, hog_rows);
+
+    __m128 cos_values[num_bins], sin_values[num_bins];
+    __m128i bin_indices[num_bins];
+    for(int i=0; i < num_angle_bins; i+=1)
+    {
+        cos_values[i] = _mm_set1_ps(angle_bin_computer.bin_vectors[i][0]);
+        sin_values[i] = _mm_set1_ps(angle_bin_computer.bin_vectors[i][1]);
+        bin_indices[i] = _mm_set1_epi32(i);
+    }
+
+    const __m128
+            scaling = _mm_set1_ps(magnitude_scaling),
+            max_magnitude = _mm_set1_ps(255.0f),
+            sign_mask = _mm_set1_ps(-0.0f);
+
+    int x = 1;
+    for(; (x + 4) < width; x+=4)
+    {
+        const __m128
+                dx = _mm_cvtepi32_ps(_mm_sub_epi32(load_4_uint8_as_int32(gray_row + x + 1),
+                                                   load_4_uint8_as_int32(gray_row + x - 1))),
+                dy = _mm_cvtepi32_ps(_mm_sub_epi32(load_4_uint8_as_int32(gray_row_below + x),
+                                                   load_4_uint8_as_int32(gray_row_above + x)));
+
+        const __m128 magnitude =
+                _mm_min_ps(max_magnitude,
+                           _mm_mul_ps(_mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy))), scaling));
+        const __m128i magnitude_i32 = _mm_cvttps_epi32(magnitude);
+
+        // the first bin with the largest absolute dot product wins
+        __m128 max_dot_product =
+                _mm_andnot_ps(sign_mask, _mm_add_ps(_mm_mul_ps(dx, cos_values[0]), _mm_mul_ps(dy, sin_values[0])));
+        __m128i angle_index = bin_indices[0];
+        for(int i=1; i < num_angle_bins; i+=1)
+        {
+            const __m128 dot_product =
+                    _mm_andnot_ps(sign_mask, _mm_add_ps(_mm_mul_ps(dx, cos_values[i]), _mm_mul_ps(dy, sin_values[i])));
+            const __m128i is_larger = _mm_castps_si128(_mm_cmpgt_ps(dot_product, max_dot_product));
+            max_dot_product = _mm_max_ps(max_dot_product, dot_product);
+            angle_index = _mm_or_si128(_mm_and_si128(is_larger, bin_indices[i]),
+                                       _mm_andnot_si128(is_larger, angle_index));
+        }
+
+        for(int i=0; i < num_angle_bins; i+=1)
+        {
+            store_int32_as_4_uint8(_mm_and_si128(_mm_cmpeq_epi32(angle_index, bin_indices[i]), magnitude_i32),
+                                   hog_rows[i] + x);
+        }
+        store_int32_as_4_uint8(magnitude_i32, hog_rows[num_angle_bins] + x);
+    } // end of "for each 4 pixels"
+
+    for(; x < (width - 1); x+=1)
+    {
+        compute_hog_pixel(x, gray_row[x + 1] - gray_row[x - 1], gray_row_below[x] - gray_row_above[x],
+                          angle_bin_computer, magnitude_scaling, hog_rows);
+    }
+
+    compute_hog_pixel(width - 1, 0, gray_row_below[width - 1] - gray_row_above[width - 1],
+                      angle_bin_computer, magnitude_scaling, hog_rows);
+    return;
+}
+
+
+/// adds the sum of each block of shrinking_factor consecutive values to block_sums
+inline
+void accumulate_row_blocks(const boost::uint8_t *row, const int width, const int shrinking_factor,
+                           boost::uint16_t *block_sums)
+{
+    int x = 0;
+    if(shrinking_factor == 4)
+    {
+        // 16 values give 4 block sums
+        const __m128i zero = _mm_setzero_si128(), ones = _mm_set1_epi16(1);
+        for(; (x + 16) <= width; x+=16)
+        {
+            const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + x));
+            const __m128i
+                    pairs_low = _mm_madd_epi16(_mm_unpacklo_epi8(values, zero), ones),
+                    pairs_high = _mm_madd_epi16(_mm_unpackhi_epi8(values, zero), ones),
+                    quads = _mm_madd_epi16(_mm_packs_epi32(pairs_low, pairs_high), ones);
+
+            __m128i *block_sums_p = reinterpret_cast<__m128i *>(block_sums + x/4);
+            _mm_storel_epi64(block_sums_p,
+                             _mm_add_epi16(_mm_loadl_epi64(block_sums_p), _mm_packs_epi32(quads, quads)));
+        }
+    }
+
+    for(; x < width; x+=1)
+    {
+        block_sums[x / shrinking_factor] += row[x];
+    }
+    return;
+}
+
+
+void IntegralChannelsForPedestrians::compute_v2()
+{
+    const int
+            width = input_size.x, height = input_size.y,
+            channels_width = channel_size.x, channels_height = channel_size.y,
+            num_channels = channels.shape()[0],
+            num_hog_channels = num_angle_bins + 1;
+
+    if((width < 3) or (height < 3))
+    {
+        // the borders handling below assumes at least 3 pixels on each dimension
+        compute_v1();
+        return;
+    }
+
+    // FIXME hardcoded parameter
+    // 8 rows of channels correspond to 32 rows of the input image, for 640 pixels wide images
+    // the strip buffers (~250 KB) stay in the L2 cache
+    const int strip_channels_rows = 8;
+    const int num_strips = (channels_height + strip_channels_rows - 1) / strip_channels_rows;
+
+    const float max_magnitude = sqrt(2)*255; // same as compute_hog_channels_v1
+    const float magnitude_scaling = 255.0/max_magnitude;
+
+    const boost::uint8_t *input_data = reinterpret_cast<const boost::uint8_t *>(&input_image_view(0, 0));
+    const ptrdiff_t input_row_step = input_image_view.pixels().row_size();
+
+#pragma omp parallel
+    {
+        // per thread buffers, reused across strips
+        const int max_strip_rows = strip_channels_rows*resizing_factor;
+        std::vector<boost::uint16_t> filtered_rows((max_strip_rows + 4)*3*width);
+        std::vector<boost::uint8_t>
+                smoothed_rows((max_strip_rows + 2)*3*width),
+                gray_rows((max_strip_rows + 2)*width),
+                luv_rows(3*max_strip_rows*width),
+                hog_rows_data(num_hog_channels*width);
+        std::vector<boost::uint16_t> block_sums(num_channels*channels_width);
+
+        std::vector<boost::uint8_t *> hog_rows(num_hog_channels);
+        for(int c=0; c < num_hog_channels; c+=1)
+        {
+            hog_rows[c] = &hog_rows_data[c*width];
+        }
+
+#pragma omp for schedule(dynamic)
+        for(int strip_index=0; strip_index < num_strips; strip_index+=1)
+        {
+            const int
+                    first_channels_row = strip_index*strip_channels_rows,
+                    end_channels_row = std::min(channels_height, first_channels_row + strip_channels_rows),
+                    first_row = first_channels_row*resizing_factor,
+                    end_row = std::min(height, end_channels_row*resizing_factor),
+                    strip_rows = end_row - first_row;
+
+            // horizontal smoothing of the input rows [first_row - 2, end_row + 2)
+            for(int i=0; i < (strip_rows + 4); i+=1)
+            {
+                const int input_row = reflect_101(first_row - 2 + i, height);
+                horizontal_binomial_filter(input_data + input_row*input_row_step, width,
+                                           &filtered_rows[i*3*width]);
+            }
+
+            // vertical smoothing and gray conversion of the rows [first_row - 1, end_row + 1)
+            for(int i=0; i < (strip_rows + 2); i+=1)
+            {
+                const int
+                        row = reflect_101(first_row - 1 + i, height),
+                        // index of the filtered row, in the strip buffer
+                        filtered_index = row - (first_row - 2),
+                        above_index = reflect_101(row - 1, height) - (first_row - 2),
+                        below_index = reflect_101(row + 1, height) - (first_row - 2);
+
+                boost::uint8_t *smoothed_row = &smoothed_rows[i*3*width];
+                vertical_binomial_filter(&filtered_rows[above_index*3*width],
+                                         &filtered_rows[filtered_index*3*width],
+                                         &filtered_rows[below_index*3*width],
+                                         3*width, smoothed_row);
+                rgb_to_gray(smoothed_row, width, &gray_rows[i*width]);
+            }
+
+            // LUV channels of the strip rows
+            {
+                const gil::rgb8c_view_t rgb_view =
+                        gil::interleaved_view(width, strip_rows,
+                                              reinterpret_cast<const gil::rgb8c_pixel_t *>(&smoothed_rows[3*width]),
+                                              3*width);
+                const gil::dev3n8_planar_view_t luv_view =
+                        gil::planar_devicen_view(width, strip_rows,
+                                                 &luv_rows[0],
+                                                 &luv_rows[strip_rows*width],
+                                                 &luv_rows[2*strip_rows*width],
+                                                 width);
+                fast_rgb_to_luv(rgb_view, luv_view);
+            }
+
+            // gradients, shrinking and integration
+            std::fill(block_sums.begin(), block_sums.end(), 0);
+            for(int row=first_row; row < end_row; row+=1)
+            {
+                const int i = row - first_row;
+                compute_hog_row(&gray_rows[i*width], &gray_rows[(i + 1)*width], &gray_rows[(i + 2)*width], width,
+                                angle_bin_computer, magnitude_scaling, &hog_rows[0]);
+
+                for(int c=0; c < num_hog_channels; c+=1)
+                {
+                    accumulate_row_blocks(hog_rows[c], width, resizing_factor, &block_sums[c*channels_width]);
+                }
+                for(int c=0; c < 3; c+=1)
+                {
+                    accumulate_row_blocks(&luv_rows[(c*strip_rows + i)*width], width, resizing_factor,
+                                          &block_sums[(num_hog_channels + c)*channels_width]);
+                }
+
+                const int channels_row = row / resizing_factor;
+                const bool end_of_block = (((row + 1) % resizing_factor) == 0) or ((row + 1) == height);
+                if(end_of_block == false)
+                {
+                    continue;
+                }
+
+                // the last row and column blocks may be smaller than resizing_factor
+                const int block_height = row + 1 - channels_row*resizing_factor;
+                for(int c=0; c < num_channels; c+=1)
+                {
+                    const boost::uint16_t *channel_block_sums = &block_sums[c*channels_width];
+                    channel_t channel = channels[c];
+                    channels_t::element *channel_row = channel[channels_row].origin();
+                    integral_channels_t::element *integral_row = integral_channels[c][channels_row + 1].origin();
+
+                    integral_row[0] = 0;
+                    boost::uint32_t row_sum = 0;
+                    for(int col=0; col < channels_width; col+=1)
+                    {
+                        const int
+                                block_width = std::min(resizing_factor, width - col*resizing_factor),
+                                block_area = block_width*block_height;
+                        // rounded average of the block
+                        const channels_t::element value = (2*channel_block_sums[col] + block_area) / (2*block_area);
+                        channel_row[col] = value;
+                        row_sum += value;
+                        integral_row[col + 1] = row_sum;
+                    }
+                } // end of "for each channel"
+
+                std::fill(block_sums.begin(), block_sums.end(), 0);
+            } // end of "for each row in the strip"
+
+        } // end of "for each strip"
+    } // end of "parallel section"
+
+    // the rows of integral_channels contain the sums along each row,
+    // we accumulate them vertically
+#pragma omp parallel for
+    for(int c=0; c < num_channels; c+=1)
+    {
+        integral_channel_t integral_channel = integral_channels[c];
+        std::fill(integral_channel[0].begin(), integral_channel[0].end(), 0);
+        for(int row=2; row < (channels_height + 1); row+=1)
+        {
+            const integral_channels_t::element *previous_row = integral_channel[row - 1].origin();
+            integral_channels_t::element *integral_row = integral_channel[row].origin();
+            for(int col=1; col < (channels_width + 1); col+=1)
+            {
+                integral_row[col] += previous_row[col];
+            }
+        }
+    } // end of "for each channel"
+
+    return;
+}
+
+
 void IntegralChannelsForPedestrians::save_channels_to_file()
 {
 
@@ -955,6 +1365,33 @@ int IntegralChannelsForPedestrians::get_shrinking_factor()
 }
 
 
+IntegralChannelsForPedestrians::input_size_t
+IntegralChannelsForPedestrians::get_channel_size(const input_size_t &input_size)
+{
+    const int resizing_factor = get_shrinking_factor();
+    input_size_t channel_size;
+
+    //channel_size = input_image.dimensions() / resizing_factor;
+    // +resizing_factor/2 to round-up
+    if(resizing_factor == 4)
+    {
+        channel_size.x = (( (input_size.x+1)/2) + 1)/2;
+        channel_size.y = (( (input_size.y+1)/2) + 1)/2;
+    }
+    else if(resizing_factor == 2)
+    {
+        channel_size.x = (input_size.x+1) / 2;
+        channel_size.y = (input_size.y+1) / 2;
+    }
+    else
+    {
+        channel_size = input_size;
+    }
+
+    return channel_size;
+}
+
+
 const IntegralChannelsForPedestrians::input_size_t IntegralChannelsForPedestrians::get_input_size() const
 {
     return input_image_view.dimensions();
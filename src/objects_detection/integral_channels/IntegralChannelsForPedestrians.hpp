@@ -52,6 +52,10 @@ public:
     void set_image(const input_image_view_t &input_image);
     void compute();
 
+    /// compute() uses compute_v1 by default,
+    /// the single pass version is faster but a few percent of the channels values slightly differ
+    void set_single_pass_computation(const bool use_single_pass_computation);
+
     /// @deprecated
     /// Only used in the (also deprecated IntegralChannelsLinearSvmSlidingWindow)
     int get_feature_vector_length() const;
@@ -62,6 +66,9 @@ public:
     typedef boost::gil::rgb8c_view_t::point_t input_size_t;
     const input_size_t get_input_size() const;
 
+    /// size of the channels computed for an input image of the given size
+    static input_size_t get_channel_size(const input_size_t &input_size);
+
 #if not defined(OBJECTS_DETECTION_LIB)
     typedef Eigen::VectorXf feature_vector_t;
 
@@ -82,6 +89,8 @@ protected:
     /// how much the shrink the channel images ?
     const int resizing_factor;
 
+    bool use_single_pass_computation;
+
     input_image_t input_image;
     input_image_view_t input_image_view;
     input_image_view_t::point_t input_size, channel_size;
@@ -123,6 +132,10 @@ protected:
 
     filter_shared_pointer_t pre_smoothing_filter_p;
 
+    /// used by compute_hog_channels_v1, one per instance since
+    /// multiple instances may be computed concurrently (one per thread)
+    filter_shared_pointer_t derivative_dx_filter_p, derivative_dy_filter_p;
+
     /// original baseline implementation (using opencv)
     void compute_v0();
     void compute_hog_channels_v0();
@@ -137,6 +150,14 @@ protected:
     void resize_channels_v1();
     void resize_channel_v1(const input_channel_t input_channel, channel_t channel);
 
+    /// same channels as compute_v1, but computed in a single pass over horizontal strips of the input image
+    /// (smoothing, gradients, LUV, shrinking and integration),
+    /// the full resolution input_channels are never materialized
+    void compute_v2();
+
+    /// input_channels are only used by compute_v0 and compute_v1
+    void allocate_input_channels();
+
 
 public:
     /// helper function for low level operations
@@ -0,0 +1,303 @@
+#include "IntegralChannelsPyramid.hpp"
+
+#include "image_processing/integrate.hpp"
+
+#include "helpers/Log.hpp"
+
+#include <boost/gil/extension/opencv/ipl_image_wrapper.hpp>
+#include <boost/format.hpp>
+
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include <stdexcept>
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+
+std::ostream & log_info()
+{
+    return  logging::log(logging::InfoMessage, "IntegralChannelsPyramid");
+}
+
+typedef doppia::IntegralChannelsPyramid::input_size_t input_size_t;
+
+/// sort by decreasing size
+bool has_larger_size(const input_size_t &a, const input_size_t &b)
+{
+    if(a.x != b.x)
+    {
+        return a.x > b.x;
+    }
+    return a.y > b.y;
+}
+
+
+/// multi_array::resize always reallocates, we only resize when the shape changes
+template<typename MultiArrayType>
+void resize_if_needed(MultiArrayType &array,
+                      const size_t num_channels, const size_t num_rows, const size_t num_columns)
+{
+    if((array.shape()[0] != num_channels) or (array.shape()[1] != num_rows) or (array.shape()[2] != num_columns))
+    {
+        array.resize(boost::extents[num_channels][num_rows][num_columns]);
+    }
+    return;
+}
+
+} // end of anonymous namespace
+
+
+namespace doppia {
+
+using namespace std;
+using namespace boost;
+
+IntegralChannelsPyramid::IntegralChannelsPyramid(const int real_scales_per_octave_,
+                                                 const std::vector<float> &channels_scaling_exponents_)
+    : real_scales_per_octave(real_scales_per_octave_),
+      channels_scaling_exponents(channels_scaling_exponents_)
+{
+    if(channels_scaling_exponents.empty())
+    {
+        throw std::invalid_argument("IntegralChannelsPyramid requires one scaling exponent per channel");
+    }
+    return;
+}
+
+
+IntegralChannelsPyramid::~IntegralChannelsPyramid()
+{
+    // nothing to do here
+    return;
+}
+
+
+void IntegralChannelsPyramid::set_scales(const std::vector<input_size_t> &scaled_input_sizes)
+{
+    std::vector<input_size_t> levels_sizes;
+    for(size_t scale_index = 0; scale_index < scaled_input_sizes.size(); scale_index += 1)
+    {
+        const input_size_t &size = scaled_input_sizes[scale_index];
+        if(std::find(levels_sizes.begin(), levels_sizes.end(), size) == levels_sizes.end())
+        {
+            levels_sizes.push_back(size);
+        }
+    }
+    std::sort(levels_sizes.begin(), levels_sizes.end(), has_larger_size);
+
+    bool levels_changed = (levels_sizes.size() != levels.size());
+    for(size_t level_index = 0; (levels_changed == false) and (level_index < levels.size()); level_index += 1)
+    {
+        levels_changed = (levels[level_index].scaled_input_size != levels_sizes[level_index]);
+    }
+
+    if(levels_changed)
+    {
+        // the real levels are spaced by (at most) 1/real_scales_per_octave octaves,
+        // the levels in between are approximated from the previous (larger) real level
+        const bool all_levels_are_real = (real_scales_per_octave <= 0);
+        const float
+                min_relative_scale = all_levels_are_real? 1 : std::pow(2.0f, -1.0f/real_scales_per_octave),
+                // the scaled sizes are rounded to integers
+                relative_scale_tolerance = 1E-3;
+
+        const size_t num_channels = channels_scaling_exponents.size();
+        levels.resize(levels_sizes.size());
+        approximated_levels_indices.clear();
+
+        int source_level_index = -1;
+        for(size_t level_index = 0; level_index < levels.size(); level_index += 1)
+        {
+            Level &level = levels[level_index];
+            level.scaled_input_size = levels_sizes[level_index];
+            level.channel_size = IntegralChannelsForPedestrians::get_channel_size(level.scaled_input_size);
+            level.source_level_index = -1;
+            level.relative_scale = 1;
+
+            if((all_levels_are_real == false) and (source_level_index >= 0))
+            {
+                const float relative_scale =
+                        static_cast<float>(level.scaled_input_size.x)
+                        / levels[source_level_index].scaled_input_size.x;
+                if(relative_scale >= (min_relative_scale - relative_scale_tolerance))
+                {
+                    level.source_level_index = source_level_index;
+                    level.relative_scale = relative_scale;
+                    approximated_levels_indices.push_back(level_index);
+                }
+            }
+
+            if(level.source_level_index < 0)
+            {
+                source_level_index = level_index;
+            }
+
+            // real levels only keep their (non integral) channels when all_levels_are_real is false,
+            // since they are used to approximate the following levels
+            const size_t
+                    channels_height = all_levels_are_real? 0 : level.channel_size.y,
+                    channels_width = all_levels_are_real? 0 : level.channel_size.x;
+            resize_if_needed(level.channels, num_channels, channels_height, channels_width);
+            resize_if_needed(level.integral_channels, num_channels,
+                             level.channel_size.y + 1, level.channel_size.x + 1);
+        } // end of "for each level"
+
+        log_info() << boost::str(boost::format("The channels pyramid has %i real levels out of %i levels, "
+                                               "using %.1f MB")
+                                 % get_num_real_levels() % get_num_levels()
+                                 % (get_memory_size() / (1024.0f*1024.0f))) << std::endl;
+    }
+
+    level_index_per_scale.resize(scaled_input_sizes.size());
+    for(size_t scale_index = 0; scale_index < scaled_input_sizes.size(); scale_index += 1)
+    {
+        size_t level_index = 0;
+        while(levels[level_index].scaled_input_size != scaled_input_sizes[scale_index])
+        {
+            level_index += 1;
+        }
+        level_index_per_scale[scale_index] = level_index;
+    }
+
+    return;
+}
+
+
+void IntegralChannelsPyramid::compute(const input_image_view_t &input_view)
+{
+    // each real level computation is parallel
+    for(size_t level_index = 0; level_index < levels.size(); level_index += 1)
+    {
+        Level &level = levels[level_index];
+        if(level.source_level_index < 0)
+        {
+            compute_real_level(input_view, level);
+        }
+    }
+
+    // the approximated levels are independent from each other
+#pragma omp parallel for schedule(dynamic, 1)
+    for(size_t i = 0; i < approximated_levels_indices.size(); i += 1)
+    {
+        Level &level = levels[approximated_levels_indices[i]];
+        compute_approximated_level(levels[level.source_level_index], level);
+    }
+
+    return;
+}
+
+
+void IntegralChannelsPyramid::compute_real_level(const input_image_view_t &input_view, Level &level)
+{
+    const input_size_t &scaled_input_size = level.scaled_input_size;
+
+    if(scaled_input_size == input_view.dimensions())
+    {
+        integral_channels_computer.set_image(input_view);
+    }
+    else
+    {
+        // same resizing as IntegralChannelsDetector::resize_input_and_compute_integral_channels
+        const gil::opencv::ipl_image_wrapper input_ipl = gil::opencv::create_ipl_image(input_view);
+        const cv::Mat input_mat(input_ipl.get());
+
+        int interpolation = cv::INTER_LINEAR;
+        if(input_view.width() > scaled_input_size.x)
+        {
+            // when shrinking the image, should use a decimation specific interpolation method
+            interpolation = cv::INTER_AREA;
+        }
+
+        cv::resize(input_mat, scaled_input,
+                   cv::Size(scaled_input_size.x, scaled_input_size.y),
+                   0, 0, interpolation);
+
+        const input_image_view_t scaled_input_view =
+                gil::interleaved_view(scaled_input.cols, scaled_input.rows,
+                                      reinterpret_cast<gil::rgb8c_pixel_t*>(scaled_input.data),
+                                      static_cast<size_t>(scaled_input.step));
+
+        integral_channels_computer.set_image(scaled_input_view);
+    }
+
+    integral_channels_computer.compute();
+
+    if(integral_channels_computer.get_integral_channels().shape()[0] != level.integral_channels.shape()[0])
+    {
+        throw std::runtime_error("IntegralChannelsPyramid received a number of channels scaling exponents "
+                                 "that does not match the number of computed channels");
+    }
+
+    level.integral_channels = integral_channels_computer.get_integral_channels();
+    if(level.channels.num_elements() > 0)
+    {
+        level.channels = integral_channels_computer.get_channels();
+    }
+
+    return;
+}
+
+
+void IntegralChannelsPyramid::compute_approximated_level(const Level &source_level, Level &level) const
+{
+    for(size_t channel_index = 0; channel_index < level.channels.shape()[0]; channel_index += 1)
+    {
+        const cv::Mat source_channel(source_level.channel_size.y, source_level.channel_size.x, CV_16UC1,
+                                     const_cast<boost::uint16_t *>(&source_level.channels[channel_index][0][0]));
+        cv::Mat channel(level.channel_size.y, level.channel_size.x, CV_16UC1,
+                        &level.channels[channel_index][0][0]);
+
+        // the channels are averages over the shrinking factor pixels, so we resample them by averaging too
+        cv::resize(source_channel, channel, channel.size(), 0, 0, cv::INTER_AREA);
+
+        const float scaling_factor = std::pow(level.relative_scale, -channels_scaling_exponents[channel_index]);
+        if(scaling_factor != 1)
+        {
+            // rounded and saturated
+            channel.convertTo(channel, CV_16UC1, scaling_factor);
+        }
+
+        // for some strange reason explicitly defining this reference is needed to get the code compiling
+        integral_channels_t::reference integral_channel = level.integral_channels[channel_index];
+        integrate(level.channels[channel_index], integral_channel);
+    } // end of "for each channel"
+
+    return;
+}
+
+
+const IntegralChannelsPyramid::integral_channels_t &
+IntegralChannelsPyramid::get_integral_channels(const size_t scale_index) const
+{
+    return levels[level_index_per_scale.at(scale_index)].integral_channels;
+}
+
+
+size_t IntegralChannelsPyramid::get_num_levels() const
+{
+    return levels.size();
+}
+
+
+size_t IntegralChannelsPyramid::get_num_real_levels() const
+{
+    return levels.size() - approximated_levels_indices.size();
+}
+
+
+size_t IntegralChannelsPyramid::get_memory_size() const
+{
+    size_t memory_size = 0;
+    for(size_t level_index = 0; level_index < levels.size(); level_index += 1)
+    {
+        const Level &level = levels[level_index];
+        memory_size += level.channels.num_elements() * sizeof(channels_t::element);
+        memory_size += level.integral_channels.num_elements() * sizeof(integral_channels_t::element);
+    }
+    return memory_size;
+}
+
+
+} // end of namespace doppia
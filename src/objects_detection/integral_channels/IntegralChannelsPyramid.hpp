@@ -0,0 +1,87 @@
+#ifndef BICLOP_INTEGRALCHANNELSPYRAMID_HPP
+#define BICLOP_INTEGRALCHANNELSPYRAMID_HPP
+
+#include "IntegralChannelsForPedestrians.hpp"
+
+#include <opencv2/core/core.hpp>
+
+#include <vector>
+
+namespace doppia {
+
+/// Integral channels of the input image at multiple scales,
+/// following "Fast Feature Pyramids for Object Detection", P. Dollar et al. PAMI 2014.
+///
+/// Only a few levels per octave are computed from the rescaled input image ("real" levels),
+/// the other levels are approximated by resampling the channels of the nearest larger real level r
+/// and multiplying each channel by (s/r)^(-exponent), where s is the level scale.
+/// The exponents are provided by the detector model (see SoftCascadeOverIntegralChannelsModel).
+///
+/// The levels buffers are kept across calls to compute,
+/// no memory is allocated as long as the requested scales and the input size do not change.
+class IntegralChannelsPyramid
+{
+public:
+
+    typedef IntegralChannelsForPedestrians::input_image_view_t input_image_view_t;
+    typedef IntegralChannelsForPedestrians::input_size_t input_size_t;
+    typedef IntegralChannelsForPedestrians::channels_t channels_t;
+    typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
+
+    /// real_scales_per_octave is the maximum number of real levels per octave,
+    /// zero (or less) means that all the levels are real
+    IntegralChannelsPyramid(const int real_scales_per_octave,
+                            const std::vector<float> &channels_scaling_exponents);
+    ~IntegralChannelsPyramid();
+
+    /// one scaled input image size per requested scale,
+    /// the scales with the same scaled input image size share the same level
+    void set_scales(const std::vector<input_size_t> &scaled_input_sizes);
+
+    /// compute all the levels for the given input image
+    void compute(const input_image_view_t &input_view);
+
+    /// integral channels of the requested scale,
+    /// same size as IntegralChannelsForPedestrians would compute for scaled_input_sizes[scale_index]
+    const integral_channels_t &get_integral_channels(const size_t scale_index) const;
+
+    size_t get_num_levels() const;
+    size_t get_num_real_levels() const;
+
+    /// memory used by the levels buffers, in bytes
+    size_t get_memory_size() const;
+
+protected:
+
+    const int real_scales_per_octave;
+    const std::vector<float> channels_scaling_exponents;
+
+    struct Level
+    {
+        input_size_t scaled_input_size, channel_size;
+
+        /// index of the real level used to approximate this one, -1 for real levels
+        int source_level_index;
+
+        /// scale of this level with respect to its source level (<= 1)
+        float relative_scale;
+
+        channels_t channels;
+        integral_channels_t integral_channels;
+    };
+
+    /// levels sorted by decreasing size
+    std::vector<Level> levels;
+    std::vector<size_t> level_index_per_scale;
+    std::vector<size_t> approximated_levels_indices;
+
+    IntegralChannelsForPedestrians integral_channels_computer;
+    cv::Mat scaled_input;
+
+    void compute_real_level(const input_image_view_t &input_view, Level &level);
+    void compute_approximated_level(const Level &source_level, Level &level) const;
+};
+
+} // end of namespace doppia
+
+#endif // BICLOP_INTEGRALCHANNELSPYRAMID_HPP
@@ -0,0 +1,356 @@
+#include "IndexedGreedyNonMaximalSuppression.hpp"
+
+#include "GreedyNonMaximalSuppression.hpp"
+
+#include "helpers/get_option_value.hpp"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstring>
+
+namespace doppia {
+
+using namespace std;
+using namespace boost;
+using namespace boost::program_options;
+
+typedef IndexedGreedyNonMaximalSuppression::detection_t detection_t;
+typedef IndexedGreedyNonMaximalSuppression::detections_t detections_t;
+
+
+IndexedGreedyNonMaximalSuppression::IndexedGreedyNonMaximalSuppression(const variables_map &options)
+    : minimal_overlap_threshold(
+          get_option_value<float>(options, "objects_detector.minimal_overlap_threshold"))
+{
+    // nothing to do here
+    return;
+}
+
+
+IndexedGreedyNonMaximalSuppression::IndexedGreedyNonMaximalSuppression(const float minimal_overlap_threshold_)
+    : minimal_overlap_threshold(minimal_overlap_threshold_)
+{
+    // nothing to do here
+    return;
+}
+
+
+IndexedGreedyNonMaximalSuppression::~IndexedGreedyNonMaximalSuppression()
+{
+    // nothing to do here
+    return;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::set_detections(const detections_t &detections)
+{
+    candidate_detections = detections;
+    return;
+}
+
+
+/// maps the float score to an integer with the opposite order
+/// (sorting these keys is faster than sorting using a float comparison)
+inline
+boost::uint32_t get_decreasing_score_key(float score)
+{
+    if(score == 0)
+    {
+        score = 0; // -0 and +0 are equal scores
+    }
+
+    boost::uint32_t score_bits;
+    std::memcpy(&score_bits, &score, sizeof(score_bits));
+
+    // negative floats have the sign bit set and are ordered backwards
+    const boost::uint32_t increasing_key = (score_bits & 0x80000000u)? ~score_bits : (score_bits | 0x80000000u);
+    return ~increasing_key;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::sort_candidate_detections()
+{
+    if(candidate_detections.size() > std::numeric_limits<boost::uint32_t>::max())
+    {
+        throw std::runtime_error("IndexedGreedyNonMaximalSuppression received too many detections");
+    }
+
+    sorted_keys.resize(candidate_detections.size());
+    for(size_t index = 0; index < sorted_keys.size(); index += 1)
+    {
+        sorted_keys[index] =
+                (static_cast<boost::uint64_t>(get_decreasing_score_key(candidate_detections[index].score)) << 32)
+                | index;
+    }
+
+    // sorting by index the detections with equal score
+    // gives the same order as GreedyNonMaximalSuppression (std::list::sort is stable)
+    std::sort(sorted_keys.begin(), sorted_keys.end());
+    return;
+}
+
+
+inline
+size_t get_index(const boost::uint64_t sorted_key)
+{
+    return static_cast<size_t>(sorted_key & 0xFFFFFFFFu);
+}
+
+
+/// boxes with an empty area never overlap (the P. Dollar overlap is zero or undefined)
+inline
+bool has_empty_area(const detection_t &detection)
+{
+    const detection_t::rectangle_t &box = detection.bounding_box;
+    return (box.max_corner().x() <= box.min_corner().x()) or (box.max_corner().y() <= box.min_corner().y());
+}
+
+
+/// same computation as the area function used by GreedyNonMaximalSuppression
+inline
+float box_area(const detection_t::rectangle_t &box)
+{
+    const float delta_x = box.max_corner().x() - box.min_corner().x();
+    const float delta_y = box.max_corner().y() - box.min_corner().y();
+    return delta_x*delta_y;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::compute()
+{
+    maximal_detections.clear();
+    maximal_detections.reserve(42); // we do not expect more than 42 pedestrians per scene
+
+    if((minimal_overlap_threshold >= 0) == false)
+    {
+        // negative (or nan) thresholds do not require the detections to intersect
+        compute_without_index();
+        return;
+    }
+
+    sort_candidate_detections();
+    set_grid(candidate_detections);
+
+    // a candidate is kept if no higher score kept detection overlaps it,
+    // this is equivalent to removing the candidates overlapping each kept detection
+    for(size_t i = 0; i < sorted_keys.size(); i += 1)
+    {
+        const detection_t &detection = candidate_detections[get_index(sorted_keys[i])];
+
+        if(has_empty_area(detection))
+        {
+            maximal_detections.push_back(detection);
+        }
+        else if(overlaps_kept_detections(detection) == false)
+        {
+            maximal_detections.push_back(detection);
+            add_kept_detection(detection);
+        }
+    } // end of "for each candidate detection"
+
+    return;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::compute_without_index()
+{
+    sort_candidate_detections();
+
+    for(size_t i = 0; i < sorted_keys.size(); i += 1)
+    {
+        const detection_t &detection = candidate_detections[get_index(sorted_keys[i])];
+
+        bool is_suppressed = false;
+        for(size_t j = 0; (is_suppressed == false) and (j < maximal_detections.size()); j += 1)
+        {
+            is_suppressed = compute_overlap(maximal_detections[j], detection) > minimal_overlap_threshold;
+        }
+
+        if(is_suppressed == false)
+        {
+            maximal_detections.push_back(detection);
+        }
+    } // end of "for each candidate detection"
+
+    return;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::set_grid(const detections_t &detections)
+{
+    // the grid covers the pixels of all the (non empty) boxes,
+    // the cell size is the median box width (most boxes cover 2x3 cells)
+    int
+            min_x = std::numeric_limits<int>::max(), min_y = std::numeric_limits<int>::max(),
+            max_x = std::numeric_limits<int>::min(), max_y = std::numeric_limits<int>::min();
+    std::vector<int> widths;
+    widths.reserve(detections.size());
+
+    for(size_t index = 0; index < detections.size(); index += 1)
+    {
+        const detection_t &detection = detections[index];
+        if(has_empty_area(detection))
+        {
+            continue;
+        }
+
+        const detection_t::rectangle_t &box = detection.bounding_box;
+        min_x = std::min<int>(min_x, box.min_corner().x());
+        min_y = std::min<int>(min_y, box.min_corner().y());
+        max_x = std::max<int>(max_x, box.max_corner().x() - 1);
+        max_y = std::max<int>(max_y, box.max_corner().y() - 1);
+        widths.push_back(box.max_corner().x() - box.min_corner().x());
+    }
+
+    if(widths.empty())
+    {
+        grid_origin_x = 0; grid_origin_y = 0;
+        grid_cell_size = 1;
+        grid_width = 0; grid_height = 0;
+        return;
+    }
+
+    std::nth_element(widths.begin(), widths.begin() + widths.size()/2, widths.end());
+
+    // FIXME hardcoded parameters
+    const int min_cell_size = 8;
+    const size_t max_num_cells = std::max<size_t>(1024, 4*widths.size());
+
+    grid_origin_x = min_x;
+    grid_origin_y = min_y;
+    grid_cell_size = std::max(min_cell_size, widths[widths.size()/2]);
+    while(true)
+    {
+        grid_width = (max_x - min_x) / grid_cell_size + 1;
+        grid_height = (max_y - min_y) / grid_cell_size + 1;
+        if(static_cast<size_t>(grid_width*grid_height) <= max_num_cells)
+        {
+            break;
+        }
+        grid_cell_size *= 2;
+    }
+
+    const size_t num_cells = grid_width*grid_height;
+    if(grid_cells.size() < num_cells)
+    {
+        grid_cells.resize(num_cells);
+    }
+
+    for(size_t cell_index = 0; cell_index < num_cells; cell_index += 1)
+    {
+        grid_cells[cell_index].boxes_blocks.clear();
+        grid_cells[cell_index].num_boxes = 0;
+    }
+
+    return;
+}
+
+
+/// floats per block of 4 boxes (min_x, min_y, max_x, max_y, area)
+const size_t block_size = 5*4;
+
+
+bool IndexedGreedyNonMaximalSuppression::overlaps_kept_detections(const detection_t &detection) const
+{
+    const detection_t::rectangle_t &box = detection.bounding_box;
+
+    // same operations as compute_overlap, four kept boxes at a time
+    // (the coordinates are int16 values, so the float min, max and differences are exact)
+    const __m128
+            zero = _mm_setzero_ps(),
+            threshold = _mm_set1_ps(minimal_overlap_threshold),
+            box_min_x = _mm_set1_ps(box.min_corner().x()),
+            box_min_y = _mm_set1_ps(box.min_corner().y()),
+            box_max_x = _mm_set1_ps(box.max_corner().x()),
+            box_max_y = _mm_set1_ps(box.max_corner().y()),
+            area = _mm_set1_ps(box_area(box));
+
+    const int
+            first_cell_x = (box.min_corner().x() - grid_origin_x) / grid_cell_size,
+            first_cell_y = (box.min_corner().y() - grid_origin_y) / grid_cell_size,
+            last_cell_x = (box.max_corner().x() - 1 - grid_origin_x) / grid_cell_size,
+            last_cell_y = (box.max_corner().y() - 1 - grid_origin_y) / grid_cell_size;
+
+    for(int cell_y = first_cell_y; cell_y <= last_cell_y; cell_y += 1)
+    {
+        for(int cell_x = first_cell_x; cell_x <= last_cell_x; cell_x += 1)
+        {
+            const GridCell &cell = grid_cells[cell_y*grid_width + cell_x];
+            const float *blocks_p = cell.boxes_blocks.empty()? NULL : &cell.boxes_blocks[0];
+            const float *blocks_end_p = blocks_p + cell.boxes_blocks.size();
+
+            for(; blocks_p != blocks_end_p; blocks_p += block_size)
+            {
+                const __m128
+                        w = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(blocks_p + 8), box_max_x),
+                                       _mm_max_ps(_mm_loadu_ps(blocks_p + 0), box_min_x)),
+                        h = _mm_sub_ps(_mm_min_ps(_mm_loadu_ps(blocks_p + 12), box_max_y),
+                                       _mm_max_ps(_mm_loadu_ps(blocks_p + 4), box_min_y)),
+                        intersects = _mm_and_ps(_mm_cmpge_ps(w, zero), _mm_cmpge_ps(h, zero)),
+                        intersection_area = _mm_and_ps(intersects, _mm_mul_ps(w, h)),
+                        min_area = _mm_min_ps(_mm_loadu_ps(blocks_p + 16), area),
+                        overlap = _mm_div_ps(intersection_area, min_area);
+
+                if(_mm_movemask_ps(_mm_cmpgt_ps(overlap, threshold)) != 0)
+                {
+                    return true;
+                }
+            } // end of "for each block of kept boxes"
+
+        } // end of "for each cell column"
+    } // end of "for each cell row"
+
+    return false;
+}
+
+
+void IndexedGreedyNonMaximalSuppression::add_kept_detection(const detection_t &detection)
+{
+    const detection_t::rectangle_t &box = detection.bounding_box;
+
+    const int
+            first_cell_x = (box.min_corner().x() - grid_origin_x) / grid_cell_size,
+            first_cell_y = (box.min_corner().y() - grid_origin_y) / grid_cell_size,
+            last_cell_x = (box.max_corner().x() - 1 - grid_origin_x) / grid_cell_size,
+            last_cell_y = (box.max_corner().y() - 1 - grid_origin_y) / grid_cell_size;
+
+    // the unused slots of a block hold an inverted box, with no intersection
+    const float
+            max_value = std::numeric_limits<float>::max(),
+            empty_block[block_size] = {
+        max_value, max_value, max_value, max_value,
+        max_value, max_value, max_value, max_value,
+        -max_value, -max_value, -max_value, -max_value,
+        -max_value, -max_value, -max_value, -max_value,
+        1, 1, 1, 1 };
+
+    for(int cell_y = first_cell_y; cell_y <= last_cell_y; cell_y += 1)
+    {
+        for(int cell_x = first_cell_x; cell_x <= last_cell_x; cell_x += 1)
+        {
+            GridCell &cell = grid_cells[cell_y*grid_width + cell_x];
+
+            const size_t slot_index = cell.num_boxes % 4;
+            if(slot_index == 0)
+            {
+                cell.boxes_blocks.insert(cell.boxes_blocks.end(), empty_block, empty_block + block_size);
+            }
+
+            float *block_p = &cell.boxes_blocks[cell.boxes_blocks.size() - block_size];
+            block_p[0 + slot_index] = box.min_corner().x();
+            block_p[4 + slot_index] = box.min_corner().y();
+            block_p[8 + slot_index] = box.max_corner().x();
+            block_p[12 + slot_index] = box.max_corner().y();
+            block_p[16 + slot_index] = box_area(box);
+            cell.num_boxes += 1;
+        } // end of "for each cell column"
+    } // end of "for each cell row"
+
+    return;
+}
+
+
+} // end of namespace doppia
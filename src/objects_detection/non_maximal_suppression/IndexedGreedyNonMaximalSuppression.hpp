@@ -0,0 +1,67 @@
+#ifndef BICLOP_INDEXEDGREEDYNONMAXIMALSUPPRESSION_HPP
+#define BICLOP_INDEXEDGREEDYNONMAXIMALSUPPRESSION_HPP
+
+#include "AbstractNonMaximalSuppression.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/cstdint.hpp>
+#include <vector>
+
+namespace doppia {
+
+/// Same results as GreedyNonMaximalSuppression (greedy* variant, P. Dollar overlap criterion),
+/// but instead of comparing each kept detection with all the remaining candidates,
+/// each candidate is only compared with the kept detections that share a cell of a uniform grid.
+/// The grid cells store the kept boxes in blocks of four, so that the overlaps are tested using SSE2.
+///
+/// Runs in O(n log n) (sorting) plus O(n*m), where m is the number of kept detections around each candidate,
+/// instead of O(n^2) for GreedyNonMaximalSuppression.
+class IndexedGreedyNonMaximalSuppression : public AbstractNonMaximalSuppression
+{
+public:
+
+    /// uses the GreedyNonMaximalSuppression options
+    IndexedGreedyNonMaximalSuppression(const boost::program_options::variables_map &options);
+    IndexedGreedyNonMaximalSuppression(const float minimal_overlap_threshold);
+    ~IndexedGreedyNonMaximalSuppression();
+
+    void set_detections(const detections_t &detections);
+
+    void compute();
+
+protected:
+
+    const float minimal_overlap_threshold;
+
+    detections_t candidate_detections;
+
+    /// candidate detections sorting keys, the (order preserving) score bits followed by the candidate index,
+    /// sorted by decreasing score (and increasing index for equal scores)
+    std::vector<boost::uint64_t> sorted_keys;
+
+    void sort_candidate_detections();
+
+    /// kept boxes inside one grid cell,
+    /// stored as blocks of 4 min_x, 4 min_y, 4 max_x, 4 max_y and 4 areas values
+    struct GridCell
+    {
+        std::vector<float> boxes_blocks;
+        size_t num_boxes;
+    };
+
+    /// the cells are kept across calls to avoid reallocations
+    std::vector<GridCell> grid_cells;
+    int grid_origin_x, grid_origin_y, grid_cell_size, grid_width, grid_height;
+
+    void set_grid(const detections_t &detections);
+    bool overlaps_kept_detections(const detection_t &detection) const;
+    void add_kept_detection(const detection_t &detection);
+
+    /// reference implementation, used when minimal_overlap_threshold < 0
+    /// (any pair of detections overlaps "enough")
+    void compute_without_index();
+};
+
+} // end of namespace doppia
+
+#endif // BICLOP_INDEXEDGREEDYNONMAXIMALSUPPRESSION_HPP
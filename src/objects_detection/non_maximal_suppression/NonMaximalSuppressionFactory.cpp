@@ -1,6 +1,7 @@
 #include "NonMaximalSuppressionFactory.hpp"
 
 #include "GreedyNonMaximalSuppression.hpp"
+#include "IndexedGreedyNonMaximalSuppression.hpp"
 #include "FixedWindowNonMaximalSuppression.hpp"
 
 #include "helpers/get_option_value.hpp"
@@ -67,6 +68,10 @@ NonMaximalSuppressionFactory::new_instance(const string method,
     {
         non_maximal_suppression_p = new GreedyNonMaximalSuppression(options);
     }
+    else if(method.compare("greedy_indexed") == 0)
+    {
+        non_maximal_suppression_p = new IndexedGreedyNonMaximalSuppression(options);
+    }
     else if(method.compare("fixed_window") == 0)
     {
         non_maximal_suppression_p = new FixedWindowNonMaximalSuppression();
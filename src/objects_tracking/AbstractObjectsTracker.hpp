@@ -12,6 +12,8 @@ public:
 
     typedef AbstractObjectsDetector::detection_t detection_t;
     typedef AbstractObjectsDetector::detections_t detections_t;
+    typedef AbstractObjectsDetector::PredictedRegion predicted_region_t;
+    typedef AbstractObjectsDetector::predicted_regions_t predicted_regions_t;
 
 
     AbstractObjectsTracker();
@@ -29,8 +31,9 @@ public:
 
     virtual const detections_t &get_current_detections() const = 0;
 
-    /// get the expected detections for
-    //virtual const detections_t &get_predicted_detections()  = 0;
+    /// get the regions where the tracked objects are expected on the next frame
+    /// (used for tracking guided detection, see AbstractObjectsDetector::set_predicted_regions)
+    virtual const predicted_regions_t &get_predicted_regions() = 0;
 
     /// get the current tracks
     //virtual const detections_t &get_current_tracks()  = 0;
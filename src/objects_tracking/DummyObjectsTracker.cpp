@@ -423,6 +423,16 @@ const AbstractObjectsTracker::detections_t &DummyObjectsTracker::get_current_det
     return current_detections;
 }
 
+const AbstractObjectsTracker::predicted_regions_t &DummyObjectsTracker::get_predicted_regions()
+{
+    predicted_regions.clear();
+    BOOST_FOREACH(const track_t &track, tracks)
+    {
+        predicted_regions.push_back(track.compute_predicted_region());
+    }
+    return predicted_regions;
+}
+
 const DummyObjectsTracker::tracks_t &DummyObjectsTracker::get_tracks() const
 {
     return tracks;
@@ -430,26 +440,7 @@ const DummyObjectsTracker::tracks_t &DummyObjectsTracker::get_tracks() const
 
 bool DummyObjectsTracker::track_is_outside_image(const DummyObjectsTracker::track_t &track) const
 {
-    bool outside_image = false;
-    const rectangle_t &bbox = track.get_current_bounding_box();
-
-    const bool use_width_center = true;
-    if(use_width_center)
-    {
-        const float center_x = (bbox.min_corner().x() + bbox.max_corner().x()) / 2;
-        outside_image |= center_x < 0;
-        outside_image |= center_x < 30; // we check the boundary of left image rectification // FIXME hardcoded parameter
-        outside_image |= center_x >= image_width;
-    }
-    else
-    { // we use all four corners
-        outside_image |= bbox.min_corner().x() >= image_width;
-        outside_image |= bbox.min_corner().y() >= image_height;
-        outside_image |= bbox.max_corner().x() < 0;
-        outside_image |= bbox.max_corner().y() < 0;
-    }
-
-    return outside_image;
+    return track.is_outside_image(image_width, image_height);
 }
 
 
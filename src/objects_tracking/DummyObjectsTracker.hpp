@@ -32,6 +32,8 @@ public:
 
     const detections_t &get_current_detections() const;
 
+    const predicted_regions_t &get_predicted_regions();
+
     const tracks_t &get_tracks() const;
 
 protected:
@@ -42,6 +44,7 @@ protected:
 
     new_detections_t new_detections;
     detections_t current_detections;
+    predicted_regions_t predicted_regions;
 
     tracks_t tracks;
 
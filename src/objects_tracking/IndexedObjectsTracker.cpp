@@ -0,0 +1,468 @@
+#include "IndexedObjectsTracker.hpp"
+
+#include "helpers/get_option_value.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace doppia {
+
+using namespace boost::program_options;
+typedef TrackedDetection2d::rectangle_t rectangle_t;
+
+namespace {
+
+inline
+float area(const rectangle_t &a)
+{
+    const float delta_x = a.max_corner().x() - a.min_corner().x();
+    const float delta_y = a.max_corner().y() - a.min_corner().y();
+
+    const float area = delta_x*delta_y;
+    return area;
+}
+
+
+inline
+float overlapping_area(const rectangle_t &a, const rectangle_t &b)
+{
+    const float w =
+            std::min(a.max_corner().x(), b.max_corner().x()) -
+            std::max(a.min_corner().x(), b.min_corner().x());
+    const float h =
+            std::min(a.max_corner().y(), b.max_corner().y()) -
+            std::max(a.min_corner().y(), b.min_corner().y());
+    if (w < 0 or h < 0)
+    {
+        return 0;
+    }
+    else
+    {
+        return w * h;
+    }
+}
+
+
+/// PASCAL VOC criterion
+inline
+float intersection_over_union(const rectangle_t &a, const rectangle_t &b)
+{
+    const float intersection_area = overlapping_area(a, b);
+    const float area_a = area(a), area_b = area(b);
+    const float union_area = area_a + area_b - intersection_area;
+
+    if (union_area > 0)
+    {
+        return intersection_area / union_area;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+
+typedef boost::tuple<float, int, int> match_t;
+
+/// best score first, ties are broken by track and then detection index (deterministic results)
+bool compare_matches(const match_t &a, const match_t &b)
+{
+    if(a.get<0>() != b.get<0>())
+    {
+        return a.get<0>() > b.get<0>();
+    }
+    else if(a.get<1>() != b.get<1>())
+    {
+        return a.get<1>() < b.get<1>();
+    }
+    return a.get<2>() < b.get<2>();
+}
+
+} // end of anonymous namespace
+
+
+void IndexedObjectsTracker::BoxesGrid::set_boxes(const std::vector<rectangle_t> &boxes)
+{
+    query_counter = 0;
+    boxes_last_query.assign(boxes.size(), -1);
+
+    // the grid covers all the boxes, the cell size is the median box width --
+    int min_x = std::numeric_limits<int>::max(), min_y = std::numeric_limits<int>::max();
+    int max_x = std::numeric_limits<int>::min(), max_y = std::numeric_limits<int>::min();
+    widths.clear();
+
+    for(size_t i=0; i < boxes.size(); i+=1)
+    {
+        const rectangle_t &box = boxes[i];
+        min_x = std::min<int>(min_x, box.min_corner().x());
+        min_y = std::min<int>(min_y, box.min_corner().y());
+        max_x = std::max<int>(max_x, box.max_corner().x());
+        max_y = std::max<int>(max_y, box.max_corner().y());
+        widths.push_back(box.max_corner().x() - box.min_corner().x());
+    }
+
+    if(widths.empty() or (max_x <= min_x) or (max_y <= min_y))
+    {
+        origin_x = 0; origin_y = 0;
+        cell_size = 1;
+        grid_width = 0; grid_height = 0;
+        cells_start.assign(1, 0);
+        cells_boxes_indices.clear();
+        return;
+    }
+
+    std::nth_element(widths.begin(), widths.begin() + widths.size()/2, widths.end());
+
+    const int min_cell_size = 8;
+    const int max_num_cells = std::max<int>(1024, 4*boxes.size());
+
+    origin_x = min_x;
+    origin_y = min_y;
+    cell_size = std::max(min_cell_size, widths[widths.size()/2]);
+    while(true)
+    {
+        grid_width = (max_x - 1 - min_x) / cell_size + 1;
+        grid_height = (max_y - 1 - min_y) / cell_size + 1;
+        if(grid_width*grid_height <= max_num_cells)
+        {
+            break;
+        }
+        cell_size *= 2;
+    }
+
+    // count the boxes per cell, then fill the compressed rows --
+    const int num_cells = grid_width*grid_height;
+    cells_start.assign(num_cells + 1, 0);
+
+    int first_x, first_y, last_x, last_y;
+    for(size_t i=0; i < boxes.size(); i+=1)
+    {
+        if(get_cells_range(boxes[i], first_x, first_y, last_x, last_y))
+        {
+            for(int y = first_y; y <= last_y; y += 1)
+            {
+                for(int x = first_x; x <= last_x; x += 1)
+                {
+                    cells_start[y*grid_width + x + 1] += 1;
+                }
+            }
+        }
+    }
+
+    for(int cell_index = 0; cell_index < num_cells; cell_index += 1)
+    {
+        cells_start[cell_index + 1] += cells_start[cell_index];
+    }
+
+    cells_boxes_indices.resize(cells_start[num_cells]);
+    cells_cursor.assign(cells_start.begin(), cells_start.end() - 1);
+
+    for(size_t i=0; i < boxes.size(); i+=1)
+    {
+        if(get_cells_range(boxes[i], first_x, first_y, last_x, last_y))
+        {
+            for(int y = first_y; y <= last_y; y += 1)
+            {
+                for(int x = first_x; x <= last_x; x += 1)
+                {
+                    int &cursor = cells_cursor[y*grid_width + x];
+                    cells_boxes_indices[cursor] = i;
+                    cursor += 1;
+                }
+            }
+        }
+    }
+
+    return;
+}
+
+
+bool IndexedObjectsTracker::BoxesGrid::get_cells_range(const rectangle_t &box,
+                                                      int &first_x, int &first_y, int &last_x, int &last_y) const
+{
+    // the box covers the pixels [min_corner, max_corner - 1]
+    const int
+            box_min_x = box.min_corner().x() - origin_x,
+            box_min_y = box.min_corner().y() - origin_y,
+            box_max_x = box.max_corner().x() - 1 - origin_x,
+            box_max_y = box.max_corner().y() - 1 - origin_y;
+
+    if((box_max_x < box_min_x) or (box_max_y < box_min_y)
+       or (box_max_x < 0) or (box_max_y < 0)
+       or (box_min_x >= grid_width*cell_size) or (box_min_y >= grid_height*cell_size))
+    {
+        return false; // empty box, or box outside of the grid
+    }
+
+    first_x = std::max(0, box_min_x) / cell_size;
+    first_y = std::max(0, box_min_y) / cell_size;
+    last_x = std::min(grid_width - 1, box_max_x / cell_size);
+    last_y = std::min(grid_height - 1, box_max_y / cell_size);
+    return true;
+}
+
+
+const std::vector<int> &IndexedObjectsTracker::BoxesGrid::get_candidates(const rectangle_t &box)
+{
+    candidates.clear();
+    query_counter += 1;
+
+    int first_x, first_y, last_x, last_y;
+    if(get_cells_range(box, first_x, first_y, last_x, last_y) == false)
+    {
+        return candidates;
+    }
+
+    for(int y = first_y; y <= last_y; y += 1)
+    {
+        for(int x = first_x; x <= last_x; x += 1)
+        {
+            const int cell_index = y*grid_width + x;
+            for(int i = cells_start[cell_index]; i < cells_start[cell_index + 1]; i += 1)
+            {
+                const int box_index = cells_boxes_indices[i];
+                if(boxes_last_query[box_index] != query_counter)
+                {
+                    boxes_last_query[box_index] = query_counter;
+                    candidates.push_back(box_index);
+                }
+            }
+        } // end of "for each cell in the row"
+    } // end of "for each cells row"
+
+    return candidates;
+}
+
+
+IndexedObjectsTracker::IndexedObjectsTracker(const boost::program_options::variables_map &options)
+    :
+      next_track_id(0),
+      max_extrapolation_length(get_option_value<int>(options, "objects_tracking.maximum_extrapolation_length"))
+{
+    // nothing to do here
+    return;
+}
+
+
+IndexedObjectsTracker::~IndexedObjectsTracker()
+{
+    // nothing to do here
+    return;
+}
+
+
+void IndexedObjectsTracker::set_detections(const detections_t &detections)
+{
+    new_detections = detections;
+    return;
+}
+
+
+/// update or create tracks as needed
+/// greedy matcher: considers the best match first, and the continue to lower scoring ones
+/// (same as update_tracks_with_detections_v1 in DummyObjectsTracker.cpp)
+void IndexedObjectsTracker::update_tracks_with_detections()
+{
+    const float track_to_detection_match_threshold = 0.5;
+
+    boxes.resize(new_detections.size());
+    for(size_t i=0; i < new_detections.size(); i+=1)
+    {
+        boxes[i] = new_detections[i].bounding_box;
+    }
+    grid.set_boxes(boxes);
+
+    // find the candidate matches, only the detections around each track are considered --
+    matches.clear();
+    for(size_t track_index = 0; track_index < tracks.size(); track_index += 1)
+    {
+        track_t &track = tracks[track_index];
+        const rectangle_t expected_track_box = track.compute_extrapolated_bounding_box();
+
+        const std::vector<int> &candidates = grid.get_candidates(expected_track_box);
+        for(size_t i=0; i < candidates.size(); i+=1)
+        {
+            const int detection_index = candidates[i];
+            const detection_t &detection = new_detections[detection_index];
+
+            if(detection.object_class != track.object_class)
+            {
+                continue;
+            }
+
+            const float iou = intersection_over_union(expected_track_box, detection.bounding_box);
+            if(iou >= track_to_detection_match_threshold)
+            {
+                matches.push_back(match_t(iou, track_index, detection_index));
+            }
+        } // end of "for each candidate detection"
+    } // end of "for each track"
+
+    std::sort(matches.begin(), matches.end(), compare_matches);
+
+    // -1 means "not matched"
+    track_matched_detection.assign(tracks.size(), -1);
+    detection_matched_track.assign(new_detections.size(), -1);
+
+    // greedy assignment --
+    for(size_t i=0; i < matches.size(); i+=1)
+    {
+        const int
+                track_index = matches[i].get<1>(),
+                detection_index = matches[i].get<2>();
+
+        if((track_matched_detection[track_index] == -1)
+           and (detection_matched_track[detection_index] == -1))
+        {
+            track_matched_detection[track_index] = detection_index;
+            detection_matched_track[detection_index] = track_index;
+        }
+    } // end of "for each candidate match"
+
+    // update the tracks --
+    for(size_t track_index = 0; track_index < tracks.size(); track_index += 1)
+    {
+        const int matched_detection_index = track_matched_detection[track_index];
+        if(matched_detection_index == -1)
+        {
+            tracks[track_index].skip_one_detection();
+        }
+        else
+        {
+            tracks[track_index].add_matched_detection(new_detections[matched_detection_index]);
+        }
+    }
+
+    // create new tracks --
+    for(size_t detection_index = 0; detection_index < new_detections.size(); detection_index += 1)
+    {
+        if(detection_matched_track[detection_index] == -1)
+        {
+            tracks.push_back(track_t(next_track_id, new_detections[detection_index], max_extrapolation_length));
+            next_track_id += 1;
+        }
+    }
+
+    return;
+}
+
+
+/// Occluded tracks are set to a very low score
+/// (same as handle_occlusions in DummyObjectsTracker.cpp)
+void IndexedObjectsTracker::handle_occlusions()
+{
+    const float track_maximum_overlap_ratio = 0.6;
+
+    boxes.resize(tracks.size());
+    for(size_t i=0; i < tracks.size(); i+=1)
+    {
+        boxes[i] = tracks[i].get_current_bounding_box();
+    }
+    grid.set_boxes(boxes);
+
+    for(size_t track_index = 0; track_index < tracks.size(); track_index += 1)
+    {
+        const rectangle_t &box_a = boxes[track_index];
+        const float area_box_a = area(box_a);
+
+        // only the overlapping tracks are candidates
+        const std::vector<int> &candidates = grid.get_candidates(box_a);
+        for(size_t i=0; i < candidates.size(); i+=1)
+        {
+            if(static_cast<size_t>(candidates[i]) == track_index)
+            {
+                // we skip the same window
+                continue;
+            }
+
+            const rectangle_t &box_b = boxes[candidates[i]];
+            const float
+                    intersection_area = overlapping_area(box_a, box_b),
+                    overlap_ratio = intersection_area/area_box_a;
+
+            const bool too_much_overlap = overlap_ratio > track_maximum_overlap_ratio;
+
+            // we assume camera above the ground plane
+            const bool box_a_is_behind_box_b = box_a.max_corner().y() < box_b.max_corner().y();
+
+            if(too_much_overlap and box_a_is_behind_box_b)
+            {
+                tracks[track_index].set_current_bounding_box_as_occluded();
+                break; // we move to the next track
+            }
+        } // end of "for each candidate track"
+    } // end of "for each track"
+
+    return;
+}
+
+
+void IndexedObjectsTracker::remove_old_tracks_and_set_current_detections()
+{
+    current_detections.clear();
+
+    // the kept tracks are moved (swapped) to the front, preserving their order
+    size_t num_kept_tracks = 0;
+    for(size_t track_index = 0; track_index < tracks.size(); track_index += 1)
+    {
+        const track_t &track = tracks[track_index];
+
+        // remove tracks that have extrapolated too long, or that left the image
+        if((track.get_extrapolation_length() > track.get_max_extrapolation_length())
+           or track.is_outside_image(image_width, image_height))
+        {
+            continue;
+        }
+
+        // copy the current detection
+        current_detections.push_back(track.get_current_detection());
+
+        if(num_kept_tracks != track_index)
+        {
+            tracks[num_kept_tracks].swap(tracks[track_index]);
+        }
+        num_kept_tracks += 1;
+    }
+
+    while(tracks.size() > num_kept_tracks)
+    {
+        tracks.pop_back();
+    }
+
+    return;
+}
+
+
+void IndexedObjectsTracker::compute()
+{
+    update_tracks_with_detections();
+    handle_occlusions();
+    remove_old_tracks_and_set_current_detections();
+    return;
+}
+
+
+const AbstractObjectsTracker::detections_t &IndexedObjectsTracker::get_current_detections() const
+{
+    return current_detections;
+}
+
+
+const AbstractObjectsTracker::predicted_regions_t &IndexedObjectsTracker::get_predicted_regions()
+{
+    predicted_regions.clear();
+    for(size_t track_index = 0; track_index < tracks.size(); track_index += 1)
+    {
+        predicted_regions.push_back(tracks[track_index].compute_predicted_region());
+    }
+    return predicted_regions;
+}
+
+
+const IndexedObjectsTracker::tracks_t &IndexedObjectsTracker::get_tracks() const
+{
+    return tracks;
+}
+
+
+} // end of namespace doppia
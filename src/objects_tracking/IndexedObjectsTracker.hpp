@@ -0,0 +1,99 @@
+#ifndef BICLOP_INDEXEDOBJECTSTRACKER_HPP
+#define BICLOP_INDEXEDOBJECTSTRACKER_HPP
+
+#include "AbstractObjectsTracker.hpp"
+#include "TrackedDetection2d.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/tuple/tuple.hpp>
+
+#include <vector>
+
+namespace doppia {
+
+/// Same tracking logic as DummyObjectsTracker (greedy association, occlusion handling),
+/// but designed for scenes with many objects:
+/// the tracks are stored in contiguous memory,
+/// and the candidate track/detection (and track/track) pairs are found using a uniform grid,
+/// instead of testing all the pairs.
+/// The greedy assignment runs over the sparse list of candidate matches.
+///
+/// Costs O(tracks + detections + candidate pairs) per frame,
+/// instead of O(tracks*detections + tracks^2) for DummyObjectsTracker.
+/// @see DummyObjectsTracker
+class IndexedObjectsTracker: public AbstractObjectsTracker
+{
+public:
+
+    typedef TrackedDetection2d track_t;
+    typedef std::vector<track_t> tracks_t;
+
+    /// uses the DummyObjectsTracker options
+    IndexedObjectsTracker(const boost::program_options::variables_map &options);
+    ~IndexedObjectsTracker();
+
+    void set_detections(const detections_t &detections);
+
+    void compute();
+
+    const detections_t &get_current_detections() const;
+
+    const predicted_regions_t &get_predicted_regions();
+
+    const tracks_t &get_tracks() const;
+
+protected:
+
+    typedef detection_t::rectangle_t rectangle_t;
+
+    /// ID given to the next track we will create
+    int next_track_id;
+    const int max_extrapolation_length;
+
+    detections_t new_detections, current_detections;
+    predicted_regions_t predicted_regions;
+    tracks_t tracks;
+
+    /// Uniform grid over a set of boxes, stored in compressed rows
+    /// (all the boxes indices in one array, sorted by cell).
+    /// The members are kept across frames to avoid reallocations.
+    class BoxesGrid
+    {
+    public:
+        void set_boxes(const std::vector<rectangle_t> &boxes);
+
+        /// @returns the indices of the boxes that share at least one cell with the query box
+        /// (each index appears once)
+        const std::vector<int> &get_candidates(const rectangle_t &box);
+
+    protected:
+        int origin_x, origin_y, cell_size, grid_width, grid_height;
+
+        /// the boxes of cell i are cells_boxes_indices[cells_start[i]] to cells_boxes_indices[cells_start[i+1] - 1]
+        std::vector<int> cells_start, cells_boxes_indices, cells_cursor, widths;
+
+        /// last query that returned each box, used to avoid duplicated candidates
+        std::vector<int> boxes_last_query;
+        int query_counter;
+        std::vector<int> candidates;
+
+        /// @returns false if the box does not touch the grid
+        bool get_cells_range(const rectangle_t &box, int &first_x, int &first_y, int &last_x, int &last_y) const;
+    };
+
+    BoxesGrid grid;
+    std::vector<rectangle_t> boxes;
+
+    /// (score, track index, detection index)
+    typedef boost::tuple<float, int, int> match_t;
+    std::vector<match_t> matches;
+    std::vector<int> track_matched_detection, detection_matched_track;
+
+    void update_tracks_with_detections();
+    void handle_occlusions();
+    void remove_old_tracks_and_set_current_detections();
+};
+
+} // end of namespace doppia
+
+#endif // BICLOP_INDEXEDOBJECTSTRACKER_HPP
@@ -1,5 +1,6 @@
 #include "ObjectsTrackerFactory.hpp"
 #include "DummyObjectsTracker.hpp"
+#include "IndexedObjectsTracker.hpp"
 
 #include "helpers/get_option_value.hpp"
 
@@ -20,6 +21,7 @@ options_description ObjectsTrackerFactory::get_args_options()
             ("objects_tracker.method", value<string>()->default_value("none"),
              "tracking methods: \n"\
              "\tdummy: simplistic 2d tracker\n" \
+             "\tindexed: same as dummy, faster for scenes with many objects\n" \
              "or none ")
 
             ;
@@ -39,6 +41,10 @@ AbstractObjectsTracker *ObjectsTrackerFactory::new_instance(const variables_map
     {
         objects_tracker_p = new DummyObjectsTracker(options);
     }
+    else if(method.compare("indexed") == 0)
+    {
+        objects_tracker_p = new IndexedObjectsTracker(options);
+    }
     else if (method.compare("none") == 0)
     {
         objects_tracker_p = NULL;
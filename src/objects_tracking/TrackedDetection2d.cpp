@@ -5,6 +5,7 @@
 #include <Eigen/Dense>
 
 #include <cmath>
+#include <algorithm>
 
 namespace doppia {
 
@@ -155,7 +156,7 @@ const int TrackedDetection2d::get_id() const
     return track_id;
 }
 
-TrackedDetection2d::rectangle_t TrackedDetection2d::compute_extrapolated_bounding_box()
+TrackedDetection2d::rectangle_t TrackedDetection2d::compute_extrapolated_bounding_box() const
 {
     const bool estimate_2d_motion = true;
     if(not estimate_2d_motion)
@@ -230,6 +231,26 @@ TrackedDetection2d::rectangle_t TrackedDetection2d::compute_extrapolated_boundin
 }
 
 
+TrackedDetection2d::predicted_region_t TrackedDetection2d::compute_predicted_region() const
+{
+    // FIXME hardcoded parameters
+    const float
+            position_uncertainty_to_height_ratio = 0.15,
+            scale_uncertainty = 0.1,
+            extrapolated_uncertainty_factor = 2;
+
+    predicted_region_t region;
+    region.bounding_box = compute_extrapolated_bounding_box();
+
+    const float height = region.bounding_box.max_corner().y() - region.bounding_box.min_corner().y();
+    const float uncertainty_factor = (num_consecutive_detections > 0)? 1 : extrapolated_uncertainty_factor;
+
+    region.position_uncertainty = height*position_uncertainty_to_height_ratio*uncertainty_factor;
+    region.scale_uncertainty = scale_uncertainty*uncertainty_factor;
+    return region;
+}
+
+
 void TrackedDetection2d::set_current_bounding_box_as_occluded()
 {
     // we only reduce the score, after extrapolating (not after receiving a valid detection)
@@ -245,6 +266,45 @@ void TrackedDetection2d::set_current_bounding_box_as_occluded()
 }
 
 
+bool TrackedDetection2d::is_outside_image(const int image_width, const int image_height) const
+{
+    bool outside_image = false;
+    const rectangle_t &bbox = current_bounding_box;
+
+    const bool use_width_center = true;
+    if(use_width_center)
+    {
+        const float center_x = (bbox.min_corner().x() + bbox.max_corner().x()) / 2;
+        outside_image |= center_x < 0;
+        outside_image |= center_x < 30; // we check the boundary of left image rectification // FIXME hardcoded parameter
+        outside_image |= center_x >= image_width;
+    }
+    else
+    { // we use all four corners
+        outside_image |= bbox.min_corner().x() >= image_width;
+        outside_image |= bbox.min_corner().y() >= image_height;
+        outside_image |= bbox.max_corner().x() < 0;
+        outside_image |= bbox.max_corner().y() < 0;
+    }
+
+    return outside_image;
+}
+
+
+void TrackedDetection2d::swap(TrackedDetection2d &other)
+{
+    std::swap(object_class, other.object_class);
+    std::swap(track_id, other.track_id);
+    std::swap(current_bounding_box, other.current_bounding_box);
+    detections_in_time.swap(other.detections_in_time);
+    std::swap(max_detection_score, other.max_detection_score);
+    std::swap(max_extrapolation_length, other.max_extrapolation_length);
+    std::swap(num_extrapolated_detections, other.num_extrapolated_detections);
+    std::swap(num_true_detections_in_time, other.num_true_detections_in_time);
+    std::swap(num_consecutive_detections, other.num_consecutive_detections);
+    std::swap(max_consecutive_detections, other.max_consecutive_detections);
+    return;
+}
 
 
 } // end namespace doppia
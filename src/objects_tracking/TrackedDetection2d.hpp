@@ -16,6 +16,7 @@ public:
     typedef Detection2d::rectangle_t rectangle_t;
     typedef AbstractObjectsTracker::detection_t detection_t;
     typedef AbstractObjectsTracker::detections_t detections_t;
+    typedef AbstractObjectsTracker::predicted_region_t predicted_region_t;
 
 
 public:
@@ -38,10 +39,20 @@ public:
     const detections_t &get_detections_in_time() const;
     const int get_id() const;
 
-    rectangle_t compute_extrapolated_bounding_box();
+    rectangle_t compute_extrapolated_bounding_box() const;
+
+    /// extrapolated bounding box, and its uncertainty (larger when the last detection was extrapolated)
+    predicted_region_t compute_predicted_region() const;
 
     void set_current_bounding_box_as_occluded();
 
+    /// @returns true if the track left the image (or entered the left image rectification border)
+    bool is_outside_image(const int image_width, const int image_height) const;
+
+    /// constant time swap (the detections in time are not copied),
+    /// used to store the tracks in contiguous memory
+    void swap(TrackedDetection2d &other);
+
 public:
     class_t object_class;
 
@@ -54,7 +65,7 @@ protected:
     float max_detection_score;
 
 
-    const int max_extrapolation_length;
+    int max_extrapolation_length; // not const, to allow swap
     int num_extrapolated_detections, num_true_detections_in_time;
     int num_consecutive_detections, max_consecutive_detections;
 };
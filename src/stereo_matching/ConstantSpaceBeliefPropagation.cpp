@@ -276,8 +276,8 @@ namespace doppia
         num_iterations += 1;
         if((num_iterations % num_iterations_for_timing) == 0)
         {
-            printf("Average ConstantSpaceBeliefPropagation::compute_disparity_map speed %.2lf [Hz] (in the last %i iterations) (non multithreaded)\n",
-                    num_iterations_for_timing / cumulated_time, num_iterations_for_timing );
+            printf("Average ConstantSpaceBeliefPropagation::compute_disparity_map speed %.2lf [Hz] (in the last %i iterations) (%i threads)\n",
+                    num_iterations_for_timing / cumulated_time, num_iterations_for_timing, omp_get_max_threads() );
             cumulated_time = 0;
         }
 
@@ -18,6 +18,9 @@ QingXiong Yang CPU implementation of
 Qingxiong Yang, Liang Wang and Narendra Ahuja,
 A Constant-Space Belief Propagation Algorithm for Stereo Matching,
 IEEE Conference on Computer Vision and Pattern Recognition (CVPR) 2010.
+
+The data costs and the message passing run multi-threaded (red/black checkerboard over rows)
+and use SSE2, the disparities are identical to the original sequential code.
 */
 class ConstantSpaceBeliefPropagation: public AbstractStereoBlockMatcher
 {
@@ -0,0 +1,690 @@
+#include "SemiGlobalMatcher.hpp"
+
+#include "helpers/get_option_value.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+// emmintrin will define __m128i
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+#endif
+
+#include <omp.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <cstdio>
+
+namespace doppia
+{
+
+using namespace std;
+using namespace boost::gil;
+
+namespace
+{
+
+/// 9x7 census window, 62 bits
+const int census_half_width = 4, census_half_height = 3;
+
+/// cost used when the right pixel falls outside of the image (the census distance is at most 62)
+const boost::uint8_t invalid_pixel_cost = 63;
+
+/// value placed around the disparities of each path costs vector, so that the d-1 and d+1 neighbours always exist
+const boost::int16_t infinite_path_cost = 0x3fff;
+
+/// the path costs of each pixel are stored as [padding, disparities, padding]
+const int path_costs_padding = 8;
+
+
+inline
+boost::int16_t horizontal_min(const __m128i &values)
+{
+    __m128i m = _mm_min_epi16(values, _mm_srli_si128(values, 8));
+    m = _mm_min_epi16(m, _mm_srli_si128(m, 4));
+    m = _mm_min_epi16(m, _mm_srli_si128(m, 2));
+    return static_cast<boost::int16_t>(_mm_extract_epi16(m, 0));
+}
+
+#if defined(__AVX2__)
+
+typedef __m256i costs_vector_t;
+const int costs_vector_size = 16;
+
+inline costs_vector_t load_pixels_costs(const boost::uint8_t *costs_p)
+{
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(costs_p)));
+}
+
+inline costs_vector_t load_costs(const boost::int16_t *costs_p)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(costs_p));
+}
+
+inline void store_costs(boost::int16_t *costs_p, const costs_vector_t &costs)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(costs_p), costs);
+}
+
+inline costs_vector_t set_costs(const boost::int16_t value) { return _mm256_set1_epi16(value); }
+inline costs_vector_t min_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_min_epi16(a, b); }
+inline costs_vector_t add_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_add_epi16(a, b); }
+inline costs_vector_t saturated_add_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_adds_epi16(a, b); }
+inline costs_vector_t subtract_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_sub_epi16(a, b); }
+
+inline costs_vector_t or_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_or_si256(a, b); }
+inline costs_vector_t greater_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm256_cmpgt_epi16(a, b); }
+
+/// @returns mask? a : b
+inline costs_vector_t select_costs(const costs_vector_t &mask, const costs_vector_t &a, const costs_vector_t &b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+/// two bits per equal cost
+inline int equal_costs_mask(const costs_vector_t &a, const costs_vector_t &b)
+{
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b));
+}
+
+inline
+boost::int16_t horizontal_min(const costs_vector_t &values)
+{
+    return horizontal_min(_mm_min_epi16(_mm256_castsi256_si128(values), _mm256_extracti128_si256(values, 1)));
+}
+
+#else
+
+typedef __m128i costs_vector_t;
+const int costs_vector_size = 8;
+
+inline costs_vector_t load_pixels_costs(const boost::uint8_t *costs_p)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(costs_p)), _mm_setzero_si128());
+}
+
+inline costs_vector_t load_costs(const boost::int16_t *costs_p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(costs_p));
+}
+
+inline void store_costs(boost::int16_t *costs_p, const costs_vector_t &costs)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(costs_p), costs);
+}
+
+inline costs_vector_t set_costs(const boost::int16_t value) { return _mm_set1_epi16(value); }
+inline costs_vector_t min_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_min_epi16(a, b); }
+inline costs_vector_t add_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_add_epi16(a, b); }
+inline costs_vector_t saturated_add_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_adds_epi16(a, b); }
+inline costs_vector_t subtract_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_sub_epi16(a, b); }
+
+inline costs_vector_t or_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_or_si128(a, b); }
+inline costs_vector_t greater_costs(const costs_vector_t &a, const costs_vector_t &b) { return _mm_cmpgt_epi16(a, b); }
+
+/// @returns mask? a : b
+inline costs_vector_t select_costs(const costs_vector_t &mask, const costs_vector_t &a, const costs_vector_t &b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/// two bits per equal cost
+inline int equal_costs_mask(const costs_vector_t &a, const costs_vector_t &b)
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(a, b));
+}
+
+#endif
+
+
+/// first pixel of a path, L(d) = C(d)
+/// @returns min_d L(d)
+inline
+boost::int16_t start_path(const boost::uint8_t *pixel_costs_p,
+                          boost::int16_t *path_costs_p,
+                          boost::int16_t *aggregated_costs_p,
+                          const int num_disparities,
+                          const bool first_path)
+{
+    costs_vector_t minimum_cost = set_costs(infinite_path_cost);
+    for(int d=0; d < num_disparities; d+=costs_vector_size)
+    {
+        const costs_vector_t path_cost = load_pixels_costs(pixel_costs_p + d);
+        store_costs(path_costs_p + d, path_cost);
+        minimum_cost = min_costs(minimum_cost, path_cost);
+
+        if(first_path)
+        {
+            store_costs(aggregated_costs_p + d, path_cost);
+        }
+        else
+        {
+            store_costs(aggregated_costs_p + d,
+                        saturated_add_costs(load_costs(aggregated_costs_p + d), path_cost));
+        }
+    }
+
+    return horizontal_min(minimum_cost);
+}
+
+
+/// one step along a path,
+/// L(d) = C(d) + min(L_p(d), L_p(d-1) + p1, L_p(d+1) + p1, min_k L_p(k) + p2) - min_k L_p(k)
+/// previous_path_costs_p[-1] and previous_path_costs_p[num_disparities] must be infinite_path_cost
+/// @returns min_d L(d)
+inline
+boost::int16_t aggregate_path_step(const boost::uint8_t *pixel_costs_p,
+                                   const boost::int16_t *previous_path_costs_p,
+                                   const boost::int16_t previous_minimum_cost,
+                                   boost::int16_t *path_costs_p,
+                                   boost::int16_t *aggregated_costs_p,
+                                   const int num_disparities,
+                                   const boost::int16_t penalty1, const boost::int16_t penalty2,
+                                   const bool first_path)
+{
+    const costs_vector_t
+            p1 = set_costs(penalty1),
+            previous_minimum = set_costs(previous_minimum_cost),
+            previous_minimum_plus_p2 = set_costs(previous_minimum_cost + penalty2);
+
+    costs_vector_t minimum_cost = set_costs(infinite_path_cost);
+    for(int d=0; d < num_disparities; d+=costs_vector_size)
+    {
+        const costs_vector_t
+                same_disparity = load_costs(previous_path_costs_p + d),
+                lower_disparity = saturated_add_costs(load_costs(previous_path_costs_p + d - 1), p1),
+                higher_disparity = saturated_add_costs(load_costs(previous_path_costs_p + d + 1), p1);
+
+        const costs_vector_t smallest_transition =
+                min_costs(min_costs(same_disparity, previous_minimum_plus_p2),
+                          min_costs(lower_disparity, higher_disparity));
+
+        const costs_vector_t path_cost =
+                subtract_costs(add_costs(load_pixels_costs(pixel_costs_p + d), smallest_transition), previous_minimum);
+
+        store_costs(path_costs_p + d, path_cost);
+        minimum_cost = min_costs(minimum_cost, path_cost);
+
+        if(first_path)
+        {
+            store_costs(aggregated_costs_p + d, path_cost);
+        }
+        else
+        {
+            store_costs(aggregated_costs_p + d,
+                        saturated_add_costs(load_costs(aggregated_costs_p + d), path_cost));
+        }
+    } // end of "for each disparities vector"
+
+    return horizontal_min(minimum_cost);
+}
+
+
+/// @returns the index of the smallest cost in [0, num_costs), the first one if there are ties
+inline
+int find_minimum_cost_index(const boost::int16_t *costs_p, const int num_costs)
+{
+    const int num_vectors_costs = (num_costs / costs_vector_size) * costs_vector_size;
+
+    costs_vector_t minimum_costs = set_costs(std::numeric_limits<boost::int16_t>::max());
+    for(int d=0; d < num_vectors_costs; d+=costs_vector_size)
+    {
+        minimum_costs = min_costs(minimum_costs, load_costs(costs_p + d));
+    }
+
+    boost::int16_t minimum_cost = horizontal_min(minimum_costs);
+    for(int d=num_vectors_costs; d < num_costs; d+=1)
+    {
+        minimum_cost = std::min(minimum_cost, costs_p[d]);
+    }
+
+    const costs_vector_t minimum_cost_vector = set_costs(minimum_cost);
+    for(int d=0; d < num_vectors_costs; d+=costs_vector_size)
+    {
+        const int mask = equal_costs_mask(load_costs(costs_p + d), minimum_cost_vector);
+        if(mask != 0)
+        {
+            return d + __builtin_ctz(mask) / 2;
+        }
+    }
+
+    return std::find(costs_p + num_vectors_costs, costs_p + num_costs, minimum_cost) - costs_p;
+}
+
+
+void compute_census_transform(const gray8c_view_t &image, std::vector<boost::uint64_t> &census)
+{
+    const int width = image.width(), height = image.height();
+    const int window_height = 2*census_half_height + 1, padded_width = width + 2*census_half_width;
+    census.resize(width*height);
+
+#pragma omp parallel
+    {
+        // rows of the census window, padded with the nearest border pixel
+        std::vector<boost::uint8_t> padded_rows(window_height*padded_width);
+
+#pragma omp for schedule(static)
+        for(int y=0; y < height; y+=1)
+        {
+            for(int dy = 0; dy < window_height; dy += 1)
+            {
+                const gray8c_view_t::x_iterator row_it =
+                        image.row_begin(std::max(0, std::min(height - 1, y + dy - census_half_height)));
+                boost::uint8_t *padded_row_p = &padded_rows[dy*padded_width];
+                for(int x=0; x < width; x+=1)
+                {
+                    padded_row_p[x + census_half_width] = row_it[x][0];
+                }
+                std::fill(padded_row_p, padded_row_p + census_half_width, padded_row_p[census_half_width]);
+                std::fill(padded_row_p + census_half_width + width, padded_row_p + padded_width,
+                          padded_row_p[census_half_width + width - 1]);
+            }
+
+            const boost::uint8_t *center_p = &padded_rows[census_half_height*padded_width + census_half_width];
+            boost::uint64_t *census_row_p = &census[y*width];
+            std::fill(census_row_p, census_row_p + width, 0);
+
+            // one window offset at a time, over the whole row (vectorizable inner loop)
+            for(int dy = 0; dy < window_height; dy += 1)
+            {
+                for(int dx = 0; dx < 2*census_half_width + 1; dx += 1)
+                {
+                    if((dx == census_half_width) and (dy == census_half_height))
+                    {
+                        continue; // we skip the center pixel
+                    }
+
+                    const boost::uint8_t *neighbour_p = &padded_rows[dy*padded_width + dx];
+                    for(int x=0; x < width; x+=1)
+                    {
+                        census_row_p[x] = (census_row_p[x] << 1) | ((neighbour_p[x] < center_p[x])? 1 : 0);
+                    }
+                }
+            }
+        } // end of "for each row"
+    }
+
+    return;
+}
+
+} // end of anonymous namespace
+
+
+program_options::options_description SemiGlobalMatcher::get_args_options()
+{
+    program_options::options_description desc("SemiGlobalMatcher options");
+
+    desc.add_options()
+
+            ("sgm.penalty1",
+             program_options::value<int>()->default_value(10),
+             "penalty for disparity changes of one pixel between neighbouring pixels (census distance units)")
+
+            ("sgm.penalty2",
+             program_options::value<int>()->default_value(120),
+             "penalty for disparity changes of more than one pixel between neighbouring pixels, "
+             "should be larger than sgm.penalty1")
+
+            ("sgm.num_paths",
+             program_options::value<int>()->default_value(8),
+             "number of aggregation paths: 4 (horizontal and vertical) or 8 (plus diagonals)")
+            ;
+
+    return desc;
+}
+
+
+SemiGlobalMatcher::SemiGlobalMatcher(const program_options::variables_map &options)
+    : AbstractStereoBlockMatcher(options)
+{
+    // the left right consistency check is done inside compute_disparity_map (not doing double calls)
+    do_left_right_consistency_check = get_option_value<bool>(options, "left_right_consistency");
+    do_dumb_left_right_consistency_check = false;
+
+    penalty1 = get_option_value<int>(options, "sgm.penalty1");
+    penalty2 = get_option_value<int>(options, "sgm.penalty2");
+    num_paths = get_option_value<int>(options, "sgm.num_paths");
+
+    if((num_paths != 4) and (num_paths != 8))
+    {
+        throw std::invalid_argument("sgm.num_paths should be 4 or 8");
+    }
+
+    // the path costs are bounded by invalid_pixel_cost + penalty2,
+    // the sum over 8 paths has to fit in an int16
+    const int max_penalty2 = 4000;
+    if((penalty1 <= 0) or (penalty2 <= penalty1) or (penalty2 > max_penalty2))
+    {
+        throw std::invalid_argument("SemiGlobalMatcher expects 0 < sgm.penalty1 < sgm.penalty2 <= 4000");
+    }
+
+    // disparity value 255 is used to mark the inconsistent pixels
+    if((max_disparity < 0) or (max_disparity >= 255))
+    {
+        throw std::invalid_argument("SemiGlobalMatcher expects max_disparity in the range [0, 254]");
+    }
+
+    num_disparities = ((max_disparity + 1 + costs_vector_size - 1) / costs_vector_size) * costs_vector_size;
+    return;
+}
+
+
+SemiGlobalMatcher::~SemiGlobalMatcher()
+{
+    // nothing to do here
+    return;
+}
+
+
+void SemiGlobalMatcher::set_rectified_images_pair(gil::any_image<input_images_t>::const_view_t &left,
+                                                  gil::any_image<input_images_t>::const_view_t &right)
+{
+    this->AbstractStereoBlockMatcher::set_rectified_images_pair(left, right);
+
+    // *.recreate does lazy allocation
+    right_disparity_map.recreate(left.dimensions());
+    return;
+}
+
+
+void SemiGlobalMatcher::compute_disparity_map(gil::gray8c_view_t &left, gil::gray8c_view_t &right,
+                                              const bool left_right_are_inverted)
+{
+    if(left_right_are_inverted)
+    {
+        throw std::runtime_error("SemiGlobalMatcher::compute_disparity_map should never receive left_right_are_inverted == true");
+    }
+
+    compute_gray_disparity_map(left, right);
+    return;
+}
+
+
+void SemiGlobalMatcher::compute_disparity_map(gil::rgb8c_view_t  &left, gil::rgb8c_view_t &right,
+                                              const bool left_right_are_inverted)
+{
+    if(left_right_are_inverted)
+    {
+        throw std::runtime_error("SemiGlobalMatcher::compute_disparity_map should never receive left_right_are_inverted == true");
+    }
+
+    // the census transform is computed over gray images
+    gray_left_image.recreate(left.dimensions());
+    gray_right_image.recreate(right.dimensions());
+    copy_and_convert_pixels(left, view(gray_left_image));
+    copy_and_convert_pixels(right, view(gray_right_image));
+
+    compute_gray_disparity_map(const_view(gray_left_image), const_view(gray_right_image));
+    return;
+}
+
+
+void SemiGlobalMatcher::compute_gray_disparity_map(const gil::gray8c_view_t &left, const gil::gray8c_view_t &right)
+{
+    if(first_disparity_map_computation)
+    {
+        printf("SemiGlobalMatcher::compute_disparity_map will aggregate the census costs along %i paths\n\n",
+               num_paths);
+    }
+
+    const int width = left.width(), height = left.height();
+
+    compute_pixels_costs(left, right);
+
+    aggregated_costs.resize(width*height*num_disparities);
+    aggregate_horizontal_paths(width, height);
+    aggregate_vertical_paths(width, height, true);
+    aggregate_vertical_paths(width, height, false);
+
+    compute_disparities(width, height);
+    return;
+}
+
+
+void SemiGlobalMatcher::compute_pixels_costs(const gil::gray8c_view_t &left, const gil::gray8c_view_t &right)
+{
+    compute_census_transform(left, left_census);
+    compute_census_transform(right, right_census);
+
+    const int width = left.width(), height = left.height();
+    pixels_costs.resize(width*height*num_disparities);
+
+#pragma omp parallel for schedule(static)
+    for(int y=0; y < height; y+=1)
+    {
+        const boost::uint64_t
+                *left_census_row_p = &left_census[y*width],
+                *right_census_row_p = &right_census[y*width];
+
+        for(int x=0; x < width; x+=1)
+        {
+            boost::uint8_t *costs_p = &pixels_costs[(y*width + x)*num_disparities];
+            const boost::uint64_t left_value = left_census_row_p[x];
+
+            const int max_valid_disparity = std::min(x, max_disparity);
+            for(int d=0; d <= max_valid_disparity; d+=1)
+            {
+                costs_p[d] = __builtin_popcountll(left_value ^ right_census_row_p[x - d]);
+            }
+
+            std::fill(costs_p + max_valid_disparity + 1, costs_p + num_disparities, invalid_pixel_cost);
+        } // end of "for each column"
+    } // end of "for each row"
+
+    return;
+}
+
+
+void SemiGlobalMatcher::aggregate_horizontal_paths(const int width, const int height)
+{
+    const int path_costs_stride = num_disparities + 2*path_costs_padding;
+    const boost::int16_t p1 = penalty1, p2 = penalty2;
+
+#pragma omp parallel
+    {
+        // previous and current pixel path costs, the padding is never written
+        std::vector<boost::int16_t> path_costs(2*path_costs_stride, infinite_path_cost);
+
+#pragma omp for schedule(static)
+        for(int y=0; y < height; y+=1)
+        {
+            const boost::uint8_t *row_costs_p = &pixels_costs[y*width*num_disparities];
+            boost::int16_t *row_aggregated_costs_p = &aggregated_costs[y*width*num_disparities];
+
+            boost::int16_t
+                    *previous_path_costs_p = &path_costs[path_costs_padding],
+                    *current_path_costs_p = &path_costs[path_costs_stride + path_costs_padding];
+
+            // left to right (first path, initializes the aggregated costs)
+            boost::int16_t minimum_cost =
+                    start_path(row_costs_p, previous_path_costs_p, row_aggregated_costs_p, num_disparities, true);
+            for(int x=1; x < width; x+=1)
+            {
+                const int offset = x*num_disparities;
+                minimum_cost = aggregate_path_step(row_costs_p + offset, previous_path_costs_p, minimum_cost,
+                                                   current_path_costs_p, row_aggregated_costs_p + offset,
+                                                   num_disparities, p1, p2, true);
+                std::swap(previous_path_costs_p, current_path_costs_p);
+            }
+
+            // right to left
+            const int last_offset = (width - 1)*num_disparities;
+            minimum_cost = start_path(row_costs_p + last_offset, previous_path_costs_p,
+                                      row_aggregated_costs_p + last_offset, num_disparities, false);
+            for(int x=width - 2; x >= 0; x-=1)
+            {
+                const int offset = x*num_disparities;
+                minimum_cost = aggregate_path_step(row_costs_p + offset, previous_path_costs_p, minimum_cost,
+                                                   current_path_costs_p, row_aggregated_costs_p + offset,
+                                                   num_disparities, p1, p2, false);
+                std::swap(previous_path_costs_p, current_path_costs_p);
+            }
+        } // end of "for each row"
+    }
+
+    return;
+}
+
+
+void SemiGlobalMatcher::aggregate_vertical_paths(const int width, const int height, const bool top_to_bottom)
+{
+    // column offset of the previous pixel along each path
+    const int paths_delta_x[3] = {0, -1, 1};
+    const int num_row_paths = (num_paths == 8)? 3 : 1;
+
+    const int path_costs_stride = num_disparities + 2*path_costs_padding;
+    const boost::int16_t p1 = penalty1, p2 = penalty2;
+
+    // [row parity][path][column], the padding is never written
+    rows_paths_costs.assign(2*num_row_paths*width*path_costs_stride, infinite_path_cost);
+    rows_paths_minimum_costs.resize(2*num_row_paths*width);
+
+#pragma omp parallel
+    {
+        // each thread goes through all the rows, the columns of each row are split amongst the threads
+        for(int i=0; i < height; i+=1)
+        {
+            const int
+                    y = top_to_bottom? i : (height - 1 - i),
+                    current_parity = i % 2,
+                    previous_parity = 1 - current_parity;
+
+            const boost::uint8_t *row_costs_p = &pixels_costs[y*width*num_disparities];
+            boost::int16_t *row_aggregated_costs_p = &aggregated_costs[y*width*num_disparities];
+
+#pragma omp for schedule(static)
+            for(int x=0; x < width; x+=1)
+            {
+                const int offset = x*num_disparities;
+
+                for(int path_index=0; path_index < num_row_paths; path_index+=1)
+                {
+                    const int
+                            current_index = (current_parity*num_row_paths + path_index)*width + x,
+                            previous_x = x + paths_delta_x[path_index];
+
+                    boost::int16_t *current_path_costs_p =
+                            &rows_paths_costs[current_index*path_costs_stride + path_costs_padding];
+
+                    if((i == 0) or (previous_x < 0) or (previous_x >= width))
+                    {
+                        rows_paths_minimum_costs[current_index] =
+                                start_path(row_costs_p + offset, current_path_costs_p,
+                                           row_aggregated_costs_p + offset, num_disparities, false);
+                    }
+                    else
+                    {
+                        const int previous_index = (previous_parity*num_row_paths + path_index)*width + previous_x;
+                        rows_paths_minimum_costs[current_index] =
+                                aggregate_path_step(row_costs_p + offset,
+                                                    &rows_paths_costs[previous_index*path_costs_stride + path_costs_padding],
+                                                    rows_paths_minimum_costs[previous_index],
+                                                    current_path_costs_p, row_aggregated_costs_p + offset,
+                                                    num_disparities, p1, p2, false);
+                    }
+                } // end of "for each path"
+            } // end of "for each column", implicit barrier before the next row
+
+        } // end of "for each row"
+    }
+
+    return;
+}
+
+
+void SemiGlobalMatcher::compute_disparities(const int width, const int height)
+{
+    const boost::int16_t maximum_cost = std::numeric_limits<boost::int16_t>::max();
+
+    // the disparities above max_disparity (padding of the last vector) are never selected
+    boost::int16_t last_vector_disparities[costs_vector_size], last_vector_padding[costs_vector_size];
+    for(int i=0; i < costs_vector_size; i+=1)
+    {
+        last_vector_disparities[i] = num_disparities - costs_vector_size + i;
+        last_vector_padding[i] = (last_vector_disparities[i] > max_disparity)? maximum_cost : 0;
+    }
+    const costs_vector_t last_vector_padding_costs = load_costs(last_vector_padding);
+
+#pragma omp parallel
+    {
+        // minimum cost (and its disparity) of each right pixel,
+        // stored in reverse order so that the disparities of one left pixel map to consecutive elements
+        std::vector<boost::int16_t>
+                right_minimum_costs(width + num_disparities),
+                right_disparities(width + num_disparities);
+
+#pragma omp for schedule(static)
+        for(int y=0; y < height; y+=1)
+        {
+            const boost::int16_t *row_aggregated_costs_p = &aggregated_costs[y*width*num_disparities];
+
+            // left disparities --
+            disparity_map_t::view_t::x_iterator disparity_it = disparity_map_view.row_begin(y);
+            for(int x=0; x < width; x+=1, ++disparity_it)
+            {
+                const boost::int16_t *costs_p = row_aggregated_costs_p + x*num_disparities;
+                const int max_valid_disparity = std::min(x, max_disparity);
+                (*disparity_it)[0] = find_minimum_cost_index(costs_p, max_valid_disparity + 1);
+            }
+
+            if(do_left_right_consistency_check == false)
+            {
+                continue;
+            }
+
+            // right disparities, the left pixel x matches the right pixel x - d --
+            std::fill(right_minimum_costs.begin(), right_minimum_costs.end(), maximum_cost);
+            std::fill(right_disparities.begin(), right_disparities.end(), 0);
+
+            for(int x=0; x < width; x+=1)
+            {
+                const boost::int16_t *costs_p = row_aggregated_costs_p + x*num_disparities;
+
+                // right pixel x - d is at index width - 1 - x + d,
+                // the right pixels x - d < 0 fall in the extra num_disparities elements
+                boost::int16_t
+                        *minimum_costs_p = &right_minimum_costs[width - 1 - x],
+                        *disparities_p = &right_disparities[width - 1 - x];
+
+                costs_vector_t disparities =
+                        subtract_costs(load_costs(last_vector_disparities), set_costs(num_disparities - costs_vector_size));
+                for(int d=0; d < num_disparities; d+=costs_vector_size)
+                {
+                    costs_vector_t costs = load_costs(costs_p + d);
+                    if(d + costs_vector_size == num_disparities)
+                    {
+                        costs = or_costs(costs, last_vector_padding_costs);
+                    }
+
+                    // strict comparison, the smallest disparity wins the ties
+                    const costs_vector_t
+                            previous_minimum_costs = load_costs(minimum_costs_p + d),
+                            is_better = greater_costs(previous_minimum_costs, costs);
+
+                    store_costs(minimum_costs_p + d, min_costs(previous_minimum_costs, costs));
+                    store_costs(disparities_p + d, select_costs(is_better, disparities, load_costs(disparities_p + d)));
+
+                    disparities = add_costs(disparities, set_costs(costs_vector_size));
+                } // end of "for each disparities vector"
+            } // end of "for each left pixel"
+
+            disparity_map_t::view_t::x_iterator right_disparity_it = view(right_disparity_map).row_begin(y);
+            for(int x=0; x < width; x+=1, ++right_disparity_it)
+            {
+                (*right_disparity_it)[0] = right_disparities[width - 1 - x];
+            }
+        } // end of "for each row"
+    }
+
+    if(do_left_right_consistency_check)
+    {
+        check_left_right_consistency(const_view(right_disparity_map), disparity_map_view);
+    }
+
+    return;
+}
+
+
+} // end of namespace doppia
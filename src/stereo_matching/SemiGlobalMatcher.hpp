@@ -0,0 +1,88 @@
+#ifndef SEMIGLOBALMATCHER_HPP
+#define SEMIGLOBALMATCHER_HPP
+
+#include "AbstractStereoBlockMatcher.hpp"
+
+#include <boost/cstdint.hpp>
+
+#include <vector>
+
+namespace doppia
+{
+
+namespace gil = boost::gil;
+
+/// CPU implementation of the semi-global matching stereo of
+/// H. Hirschmuller, "Stereo Processing by Semiglobal Matching and Mutual Information", PAMI 2008
+///
+/// The matching costs are the Hamming distances between 9x7 census transforms,
+/// aggregated along 4 (horizontal and vertical) or 8 (plus diagonals) paths.
+/// The paths costs are computed as int16, all the disparities of a pixel at once (SSE2 or AVX2).
+/// The horizontal paths run one image row per thread,
+/// the vertical and diagonal paths sweep the image rows, splitting each row amongst the threads.
+///
+/// The left right consistency check (left_right_consistency option) uses the right disparities
+/// obtained from the same aggregated costs (no second matching)
+class SemiGlobalMatcher : public AbstractStereoBlockMatcher
+{
+public:
+
+    static boost::program_options::options_description get_args_options();
+
+    SemiGlobalMatcher(const boost::program_options::variables_map &options);
+    ~SemiGlobalMatcher();
+
+    void set_rectified_images_pair(gil::any_image<input_images_t>::const_view_t &left,
+                                   gil::any_image<input_images_t>::const_view_t &right);
+
+    void compute_disparity_map(gil::gray8c_view_t &left, gil::gray8c_view_t &right, const bool left_right_are_inverted);
+
+    void compute_disparity_map(gil::rgb8c_view_t  &left, gil::rgb8c_view_t &right, const bool left_right_are_inverted);
+
+protected:
+
+    bool do_left_right_consistency_check;
+
+    /// penalties for disparity changes of one pixel (p1) and of more than one pixel (p2)
+    int penalty1, penalty2;
+
+    /// 4 or 8
+    int num_paths;
+
+    /// max_disparity + 1, rounded up to a multiple of the SIMD vectors size
+    int num_disparities;
+
+    /// used when receiving color images
+    gil::gray8_image_t gray_left_image, gray_right_image;
+
+    std::vector<boost::uint64_t> left_census, right_census;
+
+    /// matching costs, one value per pixel and disparity (disparities are the fastest changing index)
+    std::vector<boost::uint8_t> pixels_costs;
+
+    /// sum over all the paths, same layout as pixels_costs
+    std::vector<boost::int16_t> aggregated_costs;
+
+    /// path costs of the previous and current rows (vertical and diagonal paths),
+    /// and their minimum over the disparities
+    std::vector<boost::int16_t> rows_paths_costs, rows_paths_minimum_costs;
+
+    disparity_map_t right_disparity_map;
+
+    void compute_gray_disparity_map(const gil::gray8c_view_t &left, const gil::gray8c_view_t &right);
+
+    void compute_pixels_costs(const gil::gray8c_view_t &left, const gil::gray8c_view_t &right);
+
+    /// left to right and right to left paths, one row per thread
+    void aggregate_horizontal_paths(const int width, const int height);
+
+    /// vertical (and diagonal) paths, going down when top_to_bottom is true, else going up
+    void aggregate_vertical_paths(const int width, const int height, const bool top_to_bottom);
+
+    void compute_disparities(const int width, const int height);
+};
+
+
+} // end of namespace doppia
+
+#endif // SEMIGLOBALMATCHER_HPP
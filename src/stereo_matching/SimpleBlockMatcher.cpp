@@ -4,6 +4,15 @@
 
 #include "cost_functions.hpp"
 
+// emmintrin will define __m128i
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+
+#include <omp.h>
+
+#include <algorithm>
+#include <cstdlib>
+
 namespace doppia
 {
 
@@ -26,8 +35,9 @@ program_options::options_description  SimpleBlockMatcher::get_args_options(void)
 
 
             ("version,v",
-             program_options::value<int>()->default_value(2),
-             "implementation version to use. Currently versions [0,1,2] exist")
+             program_options::value<int>()->default_value(3),
+             "implementation version to use. Currently versions [0,1,2,3] exist, "
+             "version 3 supports sad, ssd and census (lcdm falls back to version 2)")
             ;
 
     return desc;
@@ -128,6 +138,17 @@ template <typename ImgView>
 void SimpleBlockMatcher::compute_disparity_map_impl( ImgView &left, ImgView &right, bool left_right_are_inverted)
 {
 
+    if((implementation_version_to_use == 3) and (pixels_matching_method != "lcdm"))
+    {
+        if(left_right_are_inverted)
+        {
+            throw std::runtime_error("SimpleBlockMatcher::compute_dispary_map_v3 should never receive left_right_are_inverted == true");
+        }
+
+        compute_dispary_map_v3(left, right, do_left_right_consistency_check, disparity_map_view);
+        return;
+    }
+
     if (pixels_matching_method == "sad")
     {
         if(first_disparity_map_computation)
@@ -155,6 +176,10 @@ void SimpleBlockMatcher::compute_disparity_map_impl( ImgView &left, ImgView &rig
         LCDMCostFunction pixels_distance;
         compute_dispary_map_vN(left, right, left_right_are_inverted, pixels_distance, disparity_map_view );
     }
+    else if (pixels_matching_method == "census")
+    {
+        throw std::runtime_error("SimpleBlockMatcher census matching is only implemented in version 3");
+    }
     else
     {
         printf("SimpleBlockMatcher::compute_disparity_map received an unknow pixels_matching_method value == %s\n",
@@ -753,5 +778,373 @@ void SimpleBlockMatcher::compute_dispary_map_v2(
 
 
 
+namespace
+{
+
+/// 5x5 census window, 24 bits
+const int census_half_window_size = 2;
+const int census_bits = 24;
+
+void compute_census_transform(const gil::gray8c_view_t &image, std::vector<boost::uint32_t> &census)
+{
+    const int width = image.width(), height = image.height();
+    census.resize(width*height);
+
+    // the pixels outside of the image are replaced by the nearest border pixel
+#pragma omp parallel for schedule(static)
+    for(int y=0; y < height; y+=1)
+    {
+        gil::gray8c_view_t::x_iterator rows[2*census_half_window_size + 1];
+        for(int dy = -census_half_window_size; dy <= census_half_window_size; dy += 1)
+        {
+            rows[dy + census_half_window_size] = image.row_begin(std::max(0, std::min(height - 1, y + dy)));
+        }
+
+        boost::uint32_t *census_row_p = &census[y*width];
+        for(int x=0; x < width; x+=1)
+        {
+            const int center_value = rows[census_half_window_size][x][0];
+            boost::uint32_t bits = 0;
+            for(int dy = 0; dy < 2*census_half_window_size + 1; dy += 1)
+            {
+                for(int dx = -census_half_window_size; dx <= census_half_window_size; dx += 1)
+                {
+                    if((dx == 0) and (dy == census_half_window_size))
+                    {
+                        continue; // we skip the center pixel
+                    }
+                    const int neighbour_x = std::max(0, std::min(width - 1, x + dx));
+                    bits = (bits << 1) | ((rows[dy][neighbour_x][0] < center_value)? 1 : 0);
+                }
+            }
+            census_row_p[x] = bits;
+        } // end of "for each column"
+    } // end of "for each row"
+
+    return;
+}
+
+void compute_census_transform(const gil::gray8c_view_t &image, gil::gray8_image_t &/*gray_image*/,
+                              std::vector<boost::uint32_t> &census)
+{
+    compute_census_transform(image, census);
+    return;
+}
+
+void compute_census_transform(const gil::rgb8c_view_t &image, gil::gray8_image_t &gray_image,
+                              std::vector<boost::uint32_t> &census)
+{
+    gray_image.recreate(image.dimensions());
+    gil::copy_and_convert_pixels(image, gil::view(gray_image));
+    compute_census_transform(gil::const_view(gray_image), census);
+    return;
+}
+
+
+/// absolute (or squared) differences between the left pixels x and the right pixels x - disparity,
+/// costs_p[x] is set for x in [disparity, width)
+void compute_pixels_costs_row(const gil::gray8c_view_t &left, const gil::gray8c_view_t &right,
+                              const int y, const int disparity, const bool squared_differences,
+                              boost::int32_t *costs_p)
+{
+    const int width = left.width();
+    const boost::uint8_t
+            *left_p = reinterpret_cast<const boost::uint8_t *>(&(*left.row_begin(y))),
+            *right_p = reinterpret_cast<const boost::uint8_t *>(&(*right.row_begin(y))) - disparity;
+
+    const __m128i zero = _mm_setzero_si128();
+
+    int x = disparity;
+    for(; (x + 16) <= width; x += 16)
+    {
+        const __m128i
+                left_pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(left_p + x)),
+                right_pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(right_p + x));
+
+        // |a - b| == (a -sat b) | (b -sat a)
+        const __m128i absolute_differences =
+                _mm_or_si128(_mm_subs_epu8(left_pixels, right_pixels), _mm_subs_epu8(right_pixels, left_pixels));
+
+        __m128i
+                low_costs = _mm_unpacklo_epi8(absolute_differences, zero),
+                high_costs = _mm_unpackhi_epi8(absolute_differences, zero);
+
+        if(squared_differences)
+        {
+            // 255*255 fits in uint16
+            low_costs = _mm_mullo_epi16(low_costs, low_costs);
+            high_costs = _mm_mullo_epi16(high_costs, high_costs);
+        }
+
+        __m128i *costs_m128_p = reinterpret_cast<__m128i *>(costs_p + x);
+        _mm_storeu_si128(costs_m128_p, _mm_unpacklo_epi16(low_costs, zero));
+        _mm_storeu_si128(costs_m128_p + 1, _mm_unpackhi_epi16(low_costs, zero));
+        _mm_storeu_si128(costs_m128_p + 2, _mm_unpacklo_epi16(high_costs, zero));
+        _mm_storeu_si128(costs_m128_p + 3, _mm_unpackhi_epi16(high_costs, zero));
+    } // end of "for each 16 pixels"
+
+    for(; x < width; x += 1)
+    {
+        const int delta = std::abs(left_p[x] - right_p[x]);
+        costs_p[x] = squared_differences? delta*delta : delta;
+    }
+
+    return;
+}
+
+void compute_pixels_costs_row(const gil::rgb8c_view_t &left, const gil::rgb8c_view_t &right,
+                              const int y, const int disparity, const bool squared_differences,
+                              boost::int32_t *costs_p)
+{
+    const int width = left.width();
+    gil::rgb8c_view_t::x_iterator
+            left_it = left.row_begin(y) + disparity,
+            right_it = right.row_begin(y);
+
+    for(int x = disparity; x < width; x += 1, ++left_it, ++right_it)
+    {
+        const int
+                delta_r = std::abs((*left_it)[0] - (*right_it)[0]),
+                delta_g = std::abs((*left_it)[1] - (*right_it)[1]),
+                delta_b = std::abs((*left_it)[2] - (*right_it)[2]);
+
+        costs_p[x] = squared_differences?
+                    (delta_r*delta_r + delta_g*delta_g + delta_b*delta_b) : (delta_r + delta_g + delta_b);
+    }
+
+    return;
+}
+
+void compute_census_costs_row(const boost::uint32_t *left_census_row_p, const boost::uint32_t *right_census_row_p,
+                              const int width, const int disparity,
+                              boost::int32_t *costs_p)
+{
+    for(int x = disparity; x < width; x += 1)
+    {
+        costs_p[x] = __builtin_popcount(left_census_row_p[x] ^ right_census_row_p[x - disparity]);
+    }
+    return;
+}
+
+/// columns_costs_p[x] += entering_costs_p[x] - leaving_costs_p[x], for x in [begin, end)
+void update_columns_costs(const boost::int32_t *entering_costs_p, const boost::int32_t *leaving_costs_p,
+                          const int begin, const int end,
+                          boost::int32_t *columns_costs_p)
+{
+    int x = begin;
+    for(; (x + 4) <= end; x += 4)
+    {
+        __m128i *columns_m128_p = reinterpret_cast<__m128i *>(columns_costs_p + x);
+        const __m128i delta = _mm_sub_epi32(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(entering_costs_p + x)),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(leaving_costs_p + x)));
+        _mm_storeu_si128(columns_m128_p, _mm_add_epi32(_mm_loadu_si128(columns_m128_p), delta));
+    }
+
+    for(; x < end; x += 1)
+    {
+        columns_costs_p[x] += entering_costs_p[x] - leaving_costs_p[x];
+    }
+
+    return;
+}
+
+} // end of anonymous namespace
+
+
+template <typename ImgView>
+void SimpleBlockMatcher::compute_dispary_map_v3(
+    const ImgView &left, const ImgView &right,
+    const bool do_consistency_check, disparity_map_t::view_t &disparity_map)
+{
+    const bool use_census = (pixels_matching_method == "census");
+    const bool squared_differences = (pixels_matching_method == "ssd");
+
+    if((use_census == false) and (squared_differences == false) and (pixels_matching_method != "sad"))
+    {
+        printf("SimpleBlockMatcher::compute_dispary_map_v3 received an unknow pixels_matching_method value == %s\n",
+               pixels_matching_method.c_str());
+        throw std::runtime_error("SimpleBlockMatcher::compute_dispary_map_v3 received an unknow pixels_matching_method");
+    }
+
+    if (first_disparity_map_computation)
+    {
+        printf("Calling SimpleBlockMatcher::compute_dispary_map_v3 with %s matching, "\
+               "SIMD pixels costs, running box sums over rows strips, fused winner takes all and left right consistency check\n\n",
+               pixels_matching_method.c_str());
+    }
+
+    const int num_color_channels = gil::num_channels<ImgView>::value;
+    float maximum_cost_per_pixel = 255 * num_color_channels;
+    if(use_census)
+    {
+        maximum_cost_per_pixel = census_bits;
+    }
+    else if(squared_differences)
+    {
+        maximum_cost_per_pixel = 255 * 255 * num_color_channels;
+    }
+
+    const int pixels_per_block = (this->window_width*this->window_height);
+    const boost::int32_t maximum_allowed_mismatch =
+            static_cast<boost::int32_t>(maximum_cost_per_pixel * pixels_per_block * threshold_percent);
+
+    typedef typename gil::channel_type<disparity_map_t>::type disparity_map_channel_t;
+    const int max_disparity_value = gil::channel_traits< disparity_map_channel_t >::max_value();
+
+    // pixels without a complete window (or a match below the threshold) keep max_disparity_value
+    gil::fill_pixels(left_to_right_disparity_map_view, max_disparity_value);
+    gil::fill_pixels(right_to_left_disparity_map_view, max_disparity_value);
+
+    if(use_census)
+    {
+        compute_census_transform(left, gray_left_image, left_census);
+        compute_census_transform(right, gray_right_image, right_census);
+    }
+
+    const int width = static_cast<int>(left.width());
+    const int height = static_cast<int>(left.height());
+    const int num_disparities = max_disparity; // same range as the other versions
+
+    // the window of pixel (x, y) covers [x - half_window_width, x - half_window_width + window_width)
+    const int half_window_width = window_width / 2, half_window_height = window_height / 2;
+    const int
+            first_center_y = half_window_height,
+            num_center_rows = std::max(0, height - window_height + 1);
+
+#pragma omp parallel
+    {
+        // per disparity sum of the pixels costs over the window rows, for each column
+        std::vector<boost::int32_t> columns_costs(num_disparities*width);
+        std::vector<boost::int32_t>
+                entering_costs(width), leaving_costs(width),
+                lowest_mismatch(width), right_lowest_mismatch(width);
+
+        const int num_strips = omp_get_num_threads();
+
+#pragma omp for schedule(static)
+        for(int strip_index = 0; strip_index < num_strips; strip_index += 1)
+        {
+            const int
+                    strip_begin = first_center_y + (num_center_rows*strip_index) / num_strips,
+                    strip_end = first_center_y + (num_center_rows*(strip_index + 1)) / num_strips;
+
+            for(int y = strip_begin; y < strip_end; y += 1)
+            {
+                const int top_row = y - half_window_height;
+
+                disparity_map_t::view_t::x_iterator
+                        left_to_right_row_it = left_to_right_disparity_map_view.row_begin(y),
+                        right_to_left_row_it = right_to_left_disparity_map_view.row_begin(y);
+
+                std::fill(lowest_mismatch.begin(), lowest_mismatch.end(), maximum_allowed_mismatch);
+                std::fill(right_lowest_mismatch.begin(), right_lowest_mismatch.end(), maximum_allowed_mismatch);
+
+                for(int disparity = 0; disparity < num_disparities; disparity += 1)
+                {
+                    boost::int32_t *columns_costs_p = &columns_costs[disparity*width];
+
+                    // update the columns costs --
+                    if(y == strip_begin)
+                    {
+                        // first row of the strip, we sum all the window rows
+                        std::fill(leaving_costs.begin(), leaving_costs.end(), 0);
+                        std::fill(columns_costs_p, columns_costs_p + width, 0);
+
+                        for(int row = top_row; row < (top_row + window_height); row += 1)
+                        {
+                            if(use_census)
+                            {
+                                compute_census_costs_row(&left_census[row*width], &right_census[row*width],
+                                                         width, disparity, &entering_costs[0]);
+                            }
+                            else
+                            {
+                                compute_pixels_costs_row(left, right, row, disparity, squared_differences, &entering_costs[0]);
+                            }
+                            update_columns_costs(&entering_costs[0], &leaving_costs[0], disparity, width, columns_costs_p);
+                        }
+                    }
+                    else
+                    {
+                        // the bottom row enters the window, the row above the window leaves it
+                        const int entering_row = top_row + window_height - 1, leaving_row = top_row - 1;
+                        if(use_census)
+                        {
+                            compute_census_costs_row(&left_census[entering_row*width], &right_census[entering_row*width],
+                                                     width, disparity, &entering_costs[0]);
+                            compute_census_costs_row(&left_census[leaving_row*width], &right_census[leaving_row*width],
+                                                     width, disparity, &leaving_costs[0]);
+                        }
+                        else
+                        {
+                            compute_pixels_costs_row(left, right, entering_row, disparity, squared_differences, &entering_costs[0]);
+                            compute_pixels_costs_row(left, right, leaving_row, disparity, squared_differences, &leaving_costs[0]);
+                        }
+                        update_columns_costs(&entering_costs[0], &leaving_costs[0], disparity, width, columns_costs_p);
+                    }
+
+                    // running box sum along the row and winner takes all --
+                    // (the window of the right pixel x - disparity should not go out of the image)
+                    const int
+                            first_x = disparity + half_window_width,
+                            end_x = width - window_width + half_window_width + 1;
+
+                    if(first_x >= end_x)
+                    {
+                        continue;
+                    }
+
+                    boost::int32_t mismatch = 0;
+                    for(int column = first_x - half_window_width; column < (first_x - half_window_width + window_width); column += 1)
+                    {
+                        mismatch += columns_costs_p[column];
+                    }
+
+                    for(int x = first_x; x < end_x; x += 1)
+                    {
+                        if(x > first_x)
+                        {
+                            const int leaving_column = x - half_window_width - 1;
+                            mismatch += columns_costs_p[leaving_column + window_width] - columns_costs_p[leaving_column];
+                        }
+
+                        // we prefer higher disparities (nearer estimation)
+                        if(mismatch <= lowest_mismatch[x])
+                        {
+                            lowest_mismatch[x] = mismatch;
+                            left_to_right_row_it[x][0] = disparity;
+                        }
+
+                        if(do_consistency_check)
+                        {
+                            const int right_x = x - disparity;
+                            if(mismatch <= right_lowest_mismatch[right_x])
+                            {
+                                right_lowest_mismatch[right_x] = mismatch;
+                                right_to_left_row_it[right_x][0] = disparity;
+                            }
+                        }
+                    } // end of "for each column"
+
+                } // end of "for each disparity"
+            } // end of "for each row in the strip"
+        } // end of "for each strip"
+    }
+
+    if(do_consistency_check)
+    {
+        // the right to left disparities are indexed by the right image pixels
+        // left_to_right_disparity_map_view will be updated
+        check_left_right_consistency(this->right_to_left_disparity_map_view, this->left_to_right_disparity_map_view);
+    }
+
+    // copy left_to_right_disparity_map_view into final disparity_map
+    gil::copy_pixels(this->left_to_right_disparity_map_view, disparity_map);
+
+    return;
+}
+
+
 } // end of namespace doppia
 
@@ -3,6 +3,10 @@
 
 #include "AbstractStereoBlockMatcher.hpp"
 
+#include <boost/cstdint.hpp>
+
+#include <vector>
+
 namespace doppia
 {
 
@@ -54,6 +58,17 @@ private:
     template <typename ImgT, typename PixelsCostType> void compute_dispary_map_v1(const ImgT &left, const ImgT &right, const bool do_consistency_check, PixelsCostType &pixels_distance, disparity_map_t::view_t &disparity_map);
     template <typename ImgT, typename PixelsCostType> void compute_dispary_map_v2(const ImgT &left, const ImgT &right, const bool do_consistency_check, PixelsCostType &pixels_distance, disparity_map_t::view_t &disparity_map);
 
+    /// Per disparity SIMD pixels costs rows, aggregated using running box sums (constant cost per pixel and disparity).
+    /// Each thread processes a strip of rows, the winner takes all and the right disparities are computed on the fly.
+    /// Supports sad, ssd and census matching
+    template <typename ImgT> void compute_dispary_map_v3(const ImgT &left, const ImgT &right, const bool do_consistency_check, disparity_map_t::view_t &disparity_map);
+
+    /// 5x5 census transforms, used by compute_dispary_map_v3
+    std::vector<boost::uint32_t> left_census, right_census;
+
+    /// used to compute the census transform of color images
+    gil::gray8_image_t gray_left_image, gray_right_image;
+
 };
 
 
@@ -5,6 +5,7 @@
 #include "CensusStereoMatcher.hpp"
 #include "DummyGpu.hpp"
 #include "SimpleBlockMatcher.hpp"
+#include "SemiGlobalMatcher.hpp"
 #include "HierarchicalBeliefPropagation.hpp"
 #include "ConstantSpaceBeliefPropagation.hpp"
 #include "RecordedDisparities.hpp"
@@ -34,7 +35,7 @@ StereoMatcherFactory::get_args_options()
 
             ("stereo.method", value<string>()->default_value("census"),
              "matching methods: none, census, simple_sad, simple_ssd, simple_lcdm, simple_census, " \
-             "hbp, csbp, " \
+             "hbp, csbp, sgm, " \
              "gpu_sad, gpu_ssd, gpu_census, " \
              "simple_trees, " \
              "or recorded");
@@ -44,6 +45,7 @@ StereoMatcherFactory::get_args_options()
     desc.add(CensusStereoMatcher::get_args_options());
     desc.add(DummyGpu::get_args_options());
     desc.add(SimpleBlockMatcher::get_args_options());
+    desc.add(SemiGlobalMatcher::get_args_options());
     desc.add(HierarchicalBeliefPropagation::get_args_options());
     desc.add(ConstantSpaceBeliefPropagation::get_args_options());
     desc.add(RecordedDisparities::get_args_options());
@@ -132,11 +134,11 @@ StereoMatcherFactory::new_instance(const variables_map &options, boost::shared_p
     else if (method.compare("nasa_raw") == 0)
     {
         stereo_matcher_p = new NasaVisionWorkBenchStereoRaw(options);
-    }
+    }*/
     else if (method.compare("sgm") == 0)
     {
-        throw std::runtime_error("sgm method not implemented in this executable");
-    }*/
+        stereo_matcher_p = new SemiGlobalMatcher(options);
+    }
     else if (method.compare("hbp") == 0)
     {
         stereo_matcher_p = new HierarchicalBeliefPropagation(options);
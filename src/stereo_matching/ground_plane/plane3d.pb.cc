@@ -1,423 +1,418 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: plane3d.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "plane3d.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
-
-namespace {
-
-const ::google::protobuf::Descriptor* Plane3d_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Plane3d_reflection_ = NULL;
+PROTOBUF_PRAGMA_INIT_SEG
 
-}  // namespace
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-
-void protobuf_AssignDesc_plane3d_2eproto() {
-  protobuf_AddDesc_plane3d_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "plane3d.proto");
-  GOOGLE_CHECK(file != NULL);
-  Plane3d_descriptor_ = file->message_type(0);
-  static const int Plane3d_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, offset_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, normal_x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, normal_y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, normal_z_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR Plane3d::Plane3d(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.offset_)*/0
+  , /*decltype(_impl_.normal_x_)*/0
+  , /*decltype(_impl_.normal_y_)*/0
+  , /*decltype(_impl_.normal_z_)*/0} {}
+struct Plane3dDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Plane3dDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Plane3dDefaultTypeInternal() {}
+  union {
+    Plane3d _instance;
   };
-  Plane3d_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Plane3d_descriptor_,
-      Plane3d::default_instance_,
-      Plane3d_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Plane3d, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Plane3d));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_plane3d_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Plane3d_descriptor_, &Plane3d::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_plane3d_2eproto() {
-  delete Plane3d::default_instance_;
-  delete Plane3d_reflection_;
-}
-
-void protobuf_AddDesc_plane3d_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\rplane3d.proto\022\017doppia_protobuf\"O\n\007Plan"
-    "e3d\022\016\n\006offset\030\001 \002(\002\022\020\n\010normal_x\030\002 \002(\002\022\020\n"
-    "\010normal_y\030\003 \002(\002\022\020\n\010normal_z\030\004 \002(\002", 113);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "plane3d.proto", &protobuf_RegisterTypes);
-  Plane3d::default_instance_ = new Plane3d();
-  Plane3d::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_plane3d_2eproto);
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Plane3dDefaultTypeInternal _Plane3d_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_plane3d_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_plane3d_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_plane3d_2eproto = nullptr;
+
+const uint32_t TableStruct_plane3d_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _impl_.normal_x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _impl_.normal_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Plane3d, _impl_.normal_z_),
+  0,
+  1,
+  2,
+  3,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 10, -1, sizeof(::doppia_protobuf::Plane3d)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_Plane3d_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_plane3d_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rplane3d.proto\022\017doppia_protobuf\"O\n\007Plan"
+  "e3d\022\016\n\006offset\030\001 \002(\002\022\020\n\010normal_x\030\002 \002(\002\022\020\n"
+  "\010normal_y\030\003 \002(\002\022\020\n\010normal_z\030\004 \002(\002"
+  ;
+static ::_pbi::once_flag descriptor_table_plane3d_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_plane3d_2eproto = {
+    false, false, 113, descriptor_table_protodef_plane3d_2eproto,
+    "plane3d.proto",
+    &descriptor_table_plane3d_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_plane3d_2eproto::offsets,
+    file_level_metadata_plane3d_2eproto, file_level_enum_descriptors_plane3d_2eproto,
+    file_level_service_descriptors_plane3d_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_plane3d_2eproto_getter() {
+  return &descriptor_table_plane3d_2eproto;
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_plane3d_2eproto {
-  StaticDescriptorInitializer_plane3d_2eproto() {
-    protobuf_AddDesc_plane3d_2eproto();
-  }
-} static_descriptor_initializer_plane3d_2eproto_;
-
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_plane3d_2eproto(&descriptor_table_plane3d_2eproto);
+namespace doppia_protobuf {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Plane3d::kOffsetFieldNumber;
-const int Plane3d::kNormalXFieldNumber;
-const int Plane3d::kNormalYFieldNumber;
-const int Plane3d::kNormalZFieldNumber;
-#endif  // !_MSC_VER
-
-Plane3d::Plane3d()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Plane3d::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Plane3d>()._impl_._has_bits_);
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_normal_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_normal_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_normal_z(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
 
-void Plane3d::InitAsDefaultInstance() {
+Plane3d::Plane3d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Plane3d)
 }
-
 Plane3d::Plane3d(const Plane3d& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Plane3d* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){}
+    , decltype(_impl_.normal_x_){}
+    , decltype(_impl_.normal_y_){}
+    , decltype(_impl_.normal_z_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.offset_, &from._impl_.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.normal_z_) -
+    reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.normal_z_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Plane3d)
 }
 
-void Plane3d::SharedCtor() {
-  _cached_size_ = 0;
-  offset_ = 0;
-  normal_x_ = 0;
-  normal_y_ = 0;
-  normal_z_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void Plane3d::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.offset_){0}
+    , decltype(_impl_.normal_x_){0}
+    , decltype(_impl_.normal_y_){0}
+    , decltype(_impl_.normal_z_){0}
+  };
 }
 
 Plane3d::~Plane3d() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Plane3d)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Plane3d::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Plane3d::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Plane3d::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Plane3d::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Plane3d_descriptor_;
-}
-
-const Plane3d& Plane3d::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_plane3d_2eproto();  return *default_instance_;
-}
-
-Plane3d* Plane3d::default_instance_ = NULL;
-
-Plane3d* Plane3d::New() const {
-  return new Plane3d;
+  _impl_._cached_size_.Set(size);
 }
 
 void Plane3d::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    offset_ = 0;
-    normal_x_ = 0;
-    normal_y_ = 0;
-    normal_z_ = 0;
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Plane3d)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.offset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.normal_z_) -
+        reinterpret_cast<char*>(&_impl_.offset_)) + sizeof(_impl_.normal_z_));
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Plane3d::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Plane3d::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float offset = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &offset_)));
-          set_has_offset();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_normal_x;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float normal_x = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_normal_x:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &normal_x_)));
-          set_has_normal_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_normal_y;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_normal_x(&has_bits);
+          _impl_.normal_x_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float normal_y = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_normal_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &normal_y_)));
-          set_has_normal_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_normal_z;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_normal_y(&has_bits);
+          _impl_.normal_y_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float normal_z = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_normal_z:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &normal_z_)));
-          set_has_normal_z();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_normal_z(&has_bits);
+          _impl_.normal_z_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Plane3d::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+uint8_t* Plane3d::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Plane3d)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float offset = 1;
-  if (has_offset()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->offset(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_offset(), target);
   }
-  
+
   // required float normal_x = 2;
-  if (has_normal_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->normal_x(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_normal_x(), target);
   }
-  
+
   // required float normal_y = 3;
-  if (has_normal_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->normal_y(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_normal_y(), target);
   }
-  
+
   // required float normal_z = 4;
-  if (has_normal_z()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->normal_z(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_normal_z(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Plane3d)
+  return target;
 }
 
-::google::protobuf::uint8* Plane3d::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required float offset = 1;
-  if (has_offset()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->offset(), target);
-  }
-  
-  // required float normal_x = 2;
-  if (has_normal_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->normal_x(), target);
+size_t Plane3d::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Plane3d)
+  size_t total_size = 0;
+
+  if (_internal_has_offset()) {
+    // required float offset = 1;
+    total_size += 1 + 4;
   }
-  
-  // required float normal_y = 3;
-  if (has_normal_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->normal_y(), target);
+
+  if (_internal_has_normal_x()) {
+    // required float normal_x = 2;
+    total_size += 1 + 4;
   }
-  
-  // required float normal_z = 4;
-  if (has_normal_z()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->normal_z(), target);
+
+  if (_internal_has_normal_y()) {
+    // required float normal_y = 3;
+    total_size += 1 + 4;
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_normal_z()) {
+    // required float normal_z = 4;
+    total_size += 1 + 4;
   }
-  return target;
+
+  return total_size;
 }
+size_t Plane3d::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Plane3d)
+  size_t total_size = 0;
 
-int Plane3d::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
     // required float offset = 1;
-    if (has_offset()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float normal_x = 2;
-    if (has_normal_x()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float normal_y = 3;
-    if (has_normal_y()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float normal_z = 4;
-    if (has_normal_z()) {
-      total_size += 1 + 4;
-    }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += 1 + 4;
 
-void Plane3d::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Plane3d* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Plane3d*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Plane3d::MergeFrom(const Plane3d& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_offset()) {
-      set_offset(from.offset());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Plane3d::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Plane3d::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Plane3d::GetClassData() const { return &_class_data_; }
+
+
+void Plane3d::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Plane3d*>(&to_msg);
+  auto& from = static_cast<const Plane3d&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Plane3d)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
     }
-    if (from.has_normal_x()) {
-      set_normal_x(from.normal_x());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.normal_x_ = from._impl_.normal_x_;
     }
-    if (from.has_normal_y()) {
-      set_normal_y(from.normal_y());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.normal_y_ = from._impl_.normal_y_;
     }
-    if (from.has_normal_z()) {
-      set_normal_z(from.normal_z());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.normal_z_ = from._impl_.normal_z_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Plane3d::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Plane3d::CopyFrom(const Plane3d& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Plane3d)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Plane3d::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Plane3d::Swap(Plane3d* other) {
-  if (other != this) {
-    std::swap(offset_, other->offset_);
-    std::swap(normal_x_, other->normal_x_);
-    std::swap(normal_y_, other->normal_y_);
-    std::swap(normal_z_, other->normal_z_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Plane3d::InternalSwap(Plane3d* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Plane3d, _impl_.normal_z_)
+      + sizeof(Plane3d::_impl_.normal_z_)
+      - PROTOBUF_FIELD_OFFSET(Plane3d, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
 }
 
-::google::protobuf::Metadata Plane3d::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Plane3d_descriptor_;
-  metadata.reflection = Plane3d_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Plane3d::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_plane3d_2eproto_getter, &descriptor_table_plane3d_2eproto_once,
+      file_level_metadata_plane3d_2eproto[0]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Plane3d*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Plane3d >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Plane3d >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,260 +1,399 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: plane3d.proto
 
-#ifndef PROTOBUF_plane3d_2eproto__INCLUDED
-#define PROTOBUF_plane3d_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_plane3d_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_plane3d_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_plane3d_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_plane3d_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_plane3d_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_plane3d_2eproto();
-void protobuf_AssignDesc_plane3d_2eproto();
-void protobuf_ShutdownFile_plane3d_2eproto();
-
 class Plane3d;
+struct Plane3dDefaultTypeInternal;
+extern Plane3dDefaultTypeInternal _Plane3d_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::Plane3d* Arena::CreateMaybeMessage<::doppia_protobuf::Plane3d>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
 // ===================================================================
 
-class Plane3d : public ::google::protobuf::Message {
+class Plane3d final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Plane3d) */ {
  public:
-  Plane3d();
-  virtual ~Plane3d();
-  
+  inline Plane3d() : Plane3d(nullptr) {}
+  ~Plane3d() override;
+  explicit PROTOBUF_CONSTEXPR Plane3d(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Plane3d(const Plane3d& from);
-  
+  Plane3d(Plane3d&& from) noexcept
+    : Plane3d() {
+    *this = ::std::move(from);
+  }
+
   inline Plane3d& operator=(const Plane3d& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Plane3d& operator=(Plane3d&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Plane3d& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Plane3d* internal_default_instance() {
+    return reinterpret_cast<const Plane3d*>(
+               &_Plane3d_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Plane3d& a, Plane3d& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Plane3d* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  void UnsafeArenaSwap(Plane3d* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Plane3d& default_instance();
-  
-  void Swap(Plane3d* other);
-  
+
   // implements Message ----------------------------------------------
-  
-  Plane3d* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Plane3d* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Plane3d>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Plane3d& from);
-  void MergeFrom(const Plane3d& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Plane3d& from) {
+    Plane3d::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Plane3d* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Plane3d";
+  }
+  protected:
+  explicit Plane3d(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kOffsetFieldNumber = 1,
+    kNormalXFieldNumber = 2,
+    kNormalYFieldNumber = 3,
+    kNormalZFieldNumber = 4,
+  };
   // required float offset = 1;
-  inline bool has_offset() const;
-  inline void clear_offset();
-  static const int kOffsetFieldNumber = 1;
-  inline float offset() const;
-  inline void set_offset(float value);
-  
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  float offset() const;
+  void set_offset(float value);
+  private:
+  float _internal_offset() const;
+  void _internal_set_offset(float value);
+  public:
+
   // required float normal_x = 2;
-  inline bool has_normal_x() const;
-  inline void clear_normal_x();
-  static const int kNormalXFieldNumber = 2;
-  inline float normal_x() const;
-  inline void set_normal_x(float value);
-  
+  bool has_normal_x() const;
+  private:
+  bool _internal_has_normal_x() const;
+  public:
+  void clear_normal_x();
+  float normal_x() const;
+  void set_normal_x(float value);
+  private:
+  float _internal_normal_x() const;
+  void _internal_set_normal_x(float value);
+  public:
+
   // required float normal_y = 3;
-  inline bool has_normal_y() const;
-  inline void clear_normal_y();
-  static const int kNormalYFieldNumber = 3;
-  inline float normal_y() const;
-  inline void set_normal_y(float value);
-  
+  bool has_normal_y() const;
+  private:
+  bool _internal_has_normal_y() const;
+  public:
+  void clear_normal_y();
+  float normal_y() const;
+  void set_normal_y(float value);
+  private:
+  float _internal_normal_y() const;
+  void _internal_set_normal_y(float value);
+  public:
+
   // required float normal_z = 4;
-  inline bool has_normal_z() const;
-  inline void clear_normal_z();
-  static const int kNormalZFieldNumber = 4;
-  inline float normal_z() const;
-  inline void set_normal_z(float value);
-  
+  bool has_normal_z() const;
+  private:
+  bool _internal_has_normal_z() const;
+  public:
+  void clear_normal_z();
+  float normal_z() const;
+  void set_normal_z(float value);
+  private:
+  float _internal_normal_z() const;
+  void _internal_set_normal_z(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Plane3d)
  private:
-  inline void set_has_offset();
-  inline void clear_has_offset();
-  inline void set_has_normal_x();
-  inline void clear_has_normal_x();
-  inline void set_has_normal_y();
-  inline void clear_has_normal_y();
-  inline void set_has_normal_z();
-  inline void clear_has_normal_z();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float offset_;
-  float normal_x_;
-  float normal_y_;
-  float normal_z_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_plane3d_2eproto();
-  friend void protobuf_AssignDesc_plane3d_2eproto();
-  friend void protobuf_ShutdownFile_plane3d_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Plane3d* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float offset_;
+    float normal_x_;
+    float normal_y_;
+    float normal_z_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_plane3d_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Plane3d
 
 // required float offset = 1;
-inline bool Plane3d::has_offset() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Plane3d::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Plane3d::set_has_offset() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Plane3d::clear_has_offset() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Plane3d::has_offset() const {
+  return _internal_has_offset();
 }
 inline void Plane3d::clear_offset() {
-  offset_ = 0;
-  clear_has_offset();
+  _impl_.offset_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float Plane3d::_internal_offset() const {
+  return _impl_.offset_;
 }
 inline float Plane3d::offset() const {
-  return offset_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Plane3d.offset)
+  return _internal_offset();
+}
+inline void Plane3d::_internal_set_offset(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.offset_ = value;
 }
 inline void Plane3d::set_offset(float value) {
-  set_has_offset();
-  offset_ = value;
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Plane3d.offset)
 }
 
 // required float normal_x = 2;
-inline bool Plane3d::has_normal_x() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Plane3d::_internal_has_normal_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Plane3d::set_has_normal_x() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Plane3d::clear_has_normal_x() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Plane3d::has_normal_x() const {
+  return _internal_has_normal_x();
 }
 inline void Plane3d::clear_normal_x() {
-  normal_x_ = 0;
-  clear_has_normal_x();
+  _impl_.normal_x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float Plane3d::_internal_normal_x() const {
+  return _impl_.normal_x_;
 }
 inline float Plane3d::normal_x() const {
-  return normal_x_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Plane3d.normal_x)
+  return _internal_normal_x();
+}
+inline void Plane3d::_internal_set_normal_x(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.normal_x_ = value;
 }
 inline void Plane3d::set_normal_x(float value) {
-  set_has_normal_x();
-  normal_x_ = value;
+  _internal_set_normal_x(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Plane3d.normal_x)
 }
 
 // required float normal_y = 3;
-inline bool Plane3d::has_normal_y() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool Plane3d::_internal_has_normal_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Plane3d::set_has_normal_y() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void Plane3d::clear_has_normal_y() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Plane3d::has_normal_y() const {
+  return _internal_has_normal_y();
 }
 inline void Plane3d::clear_normal_y() {
-  normal_y_ = 0;
-  clear_has_normal_y();
+  _impl_.normal_y_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float Plane3d::_internal_normal_y() const {
+  return _impl_.normal_y_;
 }
 inline float Plane3d::normal_y() const {
-  return normal_y_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Plane3d.normal_y)
+  return _internal_normal_y();
+}
+inline void Plane3d::_internal_set_normal_y(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.normal_y_ = value;
 }
 inline void Plane3d::set_normal_y(float value) {
-  set_has_normal_y();
-  normal_y_ = value;
+  _internal_set_normal_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Plane3d.normal_y)
 }
 
 // required float normal_z = 4;
-inline bool Plane3d::has_normal_z() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool Plane3d::_internal_has_normal_z() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Plane3d::set_has_normal_z() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void Plane3d::clear_has_normal_z() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool Plane3d::has_normal_z() const {
+  return _internal_has_normal_z();
 }
 inline void Plane3d::clear_normal_z() {
-  normal_z_ = 0;
-  clear_has_normal_z();
+  _impl_.normal_z_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float Plane3d::_internal_normal_z() const {
+  return _impl_.normal_z_;
 }
 inline float Plane3d::normal_z() const {
-  return normal_z_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Plane3d.normal_z)
+  return _internal_normal_z();
+}
+inline void Plane3d::_internal_set_normal_z(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.normal_z_ = value;
 }
 inline void Plane3d::set_normal_z(float value) {
-  set_has_normal_z();
-  normal_z_ = value;
+  _internal_set_normal_z(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Plane3d.normal_z)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_plane3d_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_plane3d_2eproto
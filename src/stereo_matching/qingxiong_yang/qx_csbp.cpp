@@ -5,6 +5,10 @@
 #include <cassert>
 #include <cstddef>
 
+// emmintrin will define __m128i
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+
 using std::size_t;
 
 namespace {
@@ -235,7 +239,6 @@ qx_csbp_base::qx_csbp_base(int h, int w, const options& opt, int *iterations)
       m_cost_max_data_term(opt.cost_max_data_term),
       m_temp(m_nr_planes),
       m_temp_2(m_nr_planes),
-      m_temp_3(m_nr_planes),
       m_message(w*h*NrNeighbors*opt.nr_planes_base_level)
 {
     /* 
@@ -426,7 +429,13 @@ void qx_csbp_base::compute_data_cost_init(int scale)
     const int w = m_w_pyramid[scale];
     const int nr_plane = m_max_nr_plane_pyramid[scale];
 
-    /* Loop over the image */
+    /* Loop over the image, every pixel is independent */
+#pragma omp parallel
+    {
+    /* Per thread temporary storage */
+    std::vector<short> temp(m_nr_planes), temp_2(m_nr_planes), temp_3(m_nr_planes);
+
+#pragma omp for schedule(static)
     for (int y=0;y<h;y++)
     {
         for (int x=0;x<w;x++)
@@ -434,7 +443,7 @@ void qx_csbp_base::compute_data_cost_init(int scale)
             short *selected_disparity = get_selected_disparities(scale, x, y);
             short *data_cost = get_selected_data_cost(scale, x, y);
 
-            /* Using m_temp instead of data_cost directly is crucial, some function later seems to depend on it
+            /* Using temp instead of data_cost directly is crucial, some function later seems to depend on it
              * TODO refactor
              */
             /*
@@ -443,16 +452,17 @@ void qx_csbp_base::compute_data_cost_init(int scale)
              */
             for (int d=0;d<m_nr_planes;d++)
             {
-                m_temp[d] = get_data_cost_for_pixel(scale, x, y, d);
+                temp[d] = get_data_cost_for_pixel(scale, x, y, d);
             }
 
-            /* Copy m_temp to m_temp_3 */
-            m_temp_3 = m_temp;
+            /* Copy temp to temp_3 */
+            temp_3 = temp;
 
             /* Find k local minima in the data costs */
-            qx_get_first_k_element_increase_special(data_cost, selected_disparity, &m_temp[0], &m_temp_3[0], &m_temp_2[0], nr_plane, m_nr_planes);
+            qx_get_first_k_element_increase_special(data_cost, selected_disparity, &temp[0], &temp_3[0], &temp_2[0], nr_plane, m_nr_planes);
         }
     }
+    }
 }
 
 void qx_csbp_base::compute_data_cost(int scale)
@@ -466,6 +476,12 @@ void qx_csbp_base::compute_data_cost(int scale)
     assert(((w-1)<<scale) < m_w);
     assert(((h-1)<<scale) < m_h);
 
+    /* Every pixel is independent */
+#pragma omp parallel
+    {
+    std::vector<short> temp(nr_plane2);
+
+#pragma omp for schedule(static)
     for (int y=0;y<h;y++)
     {
         const int y2 = min(h2_,(y>>1));
@@ -493,32 +509,56 @@ void qx_csbp_base::compute_data_cost(int scale)
                  * If the right pixel is outside the image, set the cost to cost_max.
                  * Otherwise, set the cost based on a pixel difference metric.
                  */
-                m_temp[di] = get_data_cost_for_pixel(scale, x, y, d);
+                temp[di] = get_data_cost_for_pixel(scale, x, y, d);
             }
 
-            memcpy(data_cost, &m_temp[0], nr_plane2 * sizeof(data_cost[0]));
+            memcpy(data_cost, &temp[0], nr_plane2 * sizeof(data_cost[0]));
         }
     }
+    }
 }
 
-/* This is one of the few bottlenecks in the computation. The double loop over nr_plane can be costly, and it is called very often. */
-void qx_csbp_base::compute_message_per_pixel_per_neighbor(short *comp_func_sub,short minimum,short *disp_left,short *disp_right,int nr_plane,int scale)
+/* This is one of the few bottlenecks in the computation. The double loop over nr_plane can be costly, and it is called very often.
+ * The disparities d are processed 8 at a time with SSE2 (the last block is padded). The 16 bits additions and
+ * multiplications wrap around like the conversions to short of the scalar code, so the results are identical.
+ * temp is a per thread buffer of (at least) nr_plane rounded up to 8 elements. */
+void qx_csbp_base::compute_message_per_pixel_per_neighbor(short *comp_func_sub,short minimum,short *disp_left,short *disp_right,int nr_plane,short *temp) const
 {
-    for (int d=0;d<nr_plane;d++)
+    const short cost_max = minimum+m_cost_max_discontinuity;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i single_jump = _mm_set1_epi16(m_cost_discontinuity_single_jump);
+
+    for (int d=0;d<nr_plane;d+=8)
     {
-        short cost_min=minimum+m_cost_max_discontinuity;
+        __m128i right;
+        if (d+8<=nr_plane)
+        {
+            right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(disp_right+d));
+        }
+        else
+        {
+            short padded_disp_right[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+            memcpy(padded_disp_right, disp_right+d, (nr_plane-d)*sizeof(disp_right[0]));
+            right = _mm_loadu_si128(reinterpret_cast<const __m128i *>(padded_disp_right));
+        }
+
+        __m128i cost_min = _mm_set1_epi16(cost_max);
         for (int i=0;i<nr_plane;i++)
         {
-            cost_min=min<short>(cost_min,comp_func_sub[i]+m_cost_discontinuity_single_jump*abs(disp_left[i]-disp_right[d]));
+            const __m128i delta = _mm_sub_epi16(_mm_set1_epi16(disp_left[i]), right);
+            const __m128i abs_delta = _mm_max_epi16(delta, _mm_sub_epi16(zero, delta));
+            const __m128i cost = _mm_add_epi16(_mm_set1_epi16(comp_func_sub[i]), _mm_mullo_epi16(single_jump, abs_delta));
+            cost_min = _mm_min_epi16(cost_min, cost);
         }
-        m_temp[d]=cost_min;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(temp+d), cost_min);
     }
-    memcpy(comp_func_sub,&m_temp[0],sizeof(comp_func_sub[0])*nr_plane);
+
+    memcpy(comp_func_sub,temp,sizeof(comp_func_sub[0])*nr_plane);
     bpstereo_normalize(comp_func_sub,nr_plane);
 }
 
 void qx_csbp_base::compute_message_per_pixel(short*c0,short *p0,short *p1,short *p2,short *p3,short *p4,short*d0,short*d1,short*d2,
-                                        short*d3,short*d4,int y,int x,int nr_plane,int scale,int &count)
+                                        short*d3,short*d4,int y,int x,int nr_plane,int scale,int &count,short *temp) const
 {
     short minimum[4] = { 30000, 30000, 30000, 30000 };
     short *p0u = p0;
@@ -538,10 +578,10 @@ void qx_csbp_base::compute_message_per_pixel(short*c0,short *p0,short *p1,short
         if (p0r[d]<minimum[3]) minimum[3] = p0r[d];
         //m_comp_func_sub_prev[d]=p1[d]+p2[d]+p3[d]+p4[d];
     }
-    compute_message_per_pixel_per_neighbor(p0u,minimum[0],d0,d1,nr_plane,scale);
-    compute_message_per_pixel_per_neighbor(p0l,minimum[1],d0,d2,nr_plane,scale);
-    compute_message_per_pixel_per_neighbor(p0d,minimum[2],d0,d3,nr_plane,scale);
-    compute_message_per_pixel_per_neighbor(p0r,minimum[3],d0,d4,nr_plane,scale);
+    compute_message_per_pixel_per_neighbor(p0u,minimum[0],d0,d1,nr_plane,temp);
+    compute_message_per_pixel_per_neighbor(p0l,minimum[1],d0,d2,nr_plane,temp);
+    compute_message_per_pixel_per_neighbor(p0d,minimum[2],d0,d3,nr_plane,temp);
+    compute_message_per_pixel_per_neighbor(p0r,minimum[3],d0,d4,nr_plane,temp);
 }
 
 void qx_csbp_base::compute_message(int scale)
@@ -553,14 +593,21 @@ void qx_csbp_base::compute_message(int scale)
     const int yy=h-1;
     const int xx=w-1;
 
-    int count = 0;
-
     /* 
      * Iterate over the image in a chessboard manner:
      * First the even fields, then the odd fields.
+     * A pixel only writes its own messages and only reads the messages of its neighbors (of the other color),
+     * so the rows of one color can be processed in parallel, with results identical to the sequential order.
      */
+#pragma omp parallel
+    {
+    int count = 0;
+    std::vector<short> temp(((nr_plane+7)/8)*8);
+
     for (int i=0;i<2;i++)
     {
+        // implicit barrier at the end of each color
+#pragma omp for schedule(static)
         for (int y=1;y<yy;y++)
         {
             for (int x=xx-1+(y+i)%2;x>=1;x-=2) //for(x=(y+i)%2+1;x<xx;x+=2)
@@ -579,10 +626,11 @@ void qx_csbp_base::compute_message(int scale)
                 short *d3 = get_selected_disparities(scale, x, y+1);
                 short *d4 = get_selected_disparities(scale, x+1, y);
 
-                compute_message_per_pixel(c0,p0,p1,p2,p3,p4,d0,d1,d2,d3,d4,y,x,nr_plane,scale,count);
+                compute_message_per_pixel(c0,p0,p1,p2,p3,p4,d0,d1,d2,d3,d4,y,x,nr_plane,scale,count,&temp[0]);
             }
         }
     }
+    }
 }
 
 int qx_csbp_base::compute_disparity(short *disparity, int scale)
@@ -596,6 +644,11 @@ int qx_csbp_base::compute_disparity(short *disparity, int scale)
     //const int nr_plane = m_max_nr_plane_pyramid[scale];
     const int nr_plane = get_nr_plane_at_scale(scale);
 
+#pragma omp parallel
+    {
+    std::vector<short> temp(nr_plane);
+
+#pragma omp for schedule(static)
     for (int y=1;y<h-1;y++)
     {
         for (int x=1;x<w-1;x++)
@@ -609,14 +662,15 @@ int qx_csbp_base::compute_disparity(short *disparity, int scale)
 
             for (int d=0;d<nr_plane;d++)
             {
-                m_temp[d]=c0[d]+p1[d]+p2[d]+p3[d]+p4[d];
+                temp[d]=c0[d]+p1[d]+p2[d]+p3[d]+p4[d];
             }
 
             short *selected_disparity = get_selected_disparities(scale, x, y);
-            int d0 = bpstereo_vec_min(&m_temp[0], nr_plane);
+            int d0 = bpstereo_vec_min(&temp[0], nr_plane);
             disparity[y*w+x] = selected_disparity[d0];
         }
     }
+    }
 
     // set the horizontal borders of the disparity
     memcpy(&(disparity[(h-1)*w]),&(disparity[(h-2)*w]),sizeof(short)*w);
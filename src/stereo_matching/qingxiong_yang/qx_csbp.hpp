@@ -162,11 +162,10 @@ private:
     short m_cost_max_data_term;
 
     /* 
-     * Some temporary storage
+     * Some temporary storage (for init_message, the multi-threaded functions use per thread buffers)
      */
     std::vector<short> m_temp;
     std::vector<short> m_temp_2;
-    std::vector<short> m_temp_3;
 
     /*
      * Message computation
@@ -181,9 +180,9 @@ private:
     void compute_message(int scale);
     void compute_message_per_pixel(short*c0,short *p0,short *p1,short *p2,short *p3,short *p4,
                                    short*d0,short*d1,short*d2,short*d3,short*d4,
-                                   int y,int x,int nr_planes,int scale,int &count);
+                                   int y,int x,int nr_planes,int scale,int &count,short *temp) const;
     void compute_message_per_pixel_per_neighbor(short *m_comp_func_sub,short minimum,
-            short *disp_left,short *disp_right,int nr_planes,int scale);
+            short *disp_left,short *disp_right,int nr_planes,short *temp) const;
     
     /*
      * Compute the disparity after the last round of message passing.
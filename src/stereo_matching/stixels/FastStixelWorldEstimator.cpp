@@ -50,6 +50,27 @@ program_options::options_description FastStixelWorldEstimator::get_args_options(
 
             /// will use same options at StixelWorldEstimator
 
+            ("stixel_world.temporal_band",
+             program_options::value<int>()->default_value(0),
+             "when > 0, the stixels of each frame are only searched within +/- temporal_band disparities "
+             "around the previous frame stixels (see the other temporal_* options). "
+             "0 disables the temporal mode (every frame is searched over all the disparities). "
+             "Only supported by stixel_world.method == fast")
+
+            ("stixel_world.temporal_full_search_period",
+             program_options::value<int>()->default_value(10),
+             "in the temporal mode, all the disparities are searched once every N frames")
+
+            ("stixel_world.temporal_cost_change_threshold",
+             program_options::value<float>()->default_value(0.3),
+             "in the temporal mode, a column is searched over all the disparities when the object cost "
+             "at the previous frame boundary changed more than this fraction")
+
+            ("stixel_world.temporal_max_ground_change",
+             program_options::value<float>()->default_value(3),
+             "in the temporal mode, all the disparities are searched when the ground plane "
+             "moved more than this number of rows since the previous frame")
+
             ;
 
 
@@ -137,6 +158,13 @@ FastStixelWorldEstimator::FastStixelWorldEstimator(
     }
     else if (method.compare("fast_uv") == 0)
     {
+        if(options.count("stixel_world.temporal_band") and
+           (get_option_value<int>(options, "stixel_world.temporal_band") > 0))
+        {
+            throw std::invalid_argument("FastStixelWorldEstimator does not support stixel_world.temporal_band "
+                                        "when stixel_world.method == 'fast_uv'");
+        }
+
         stixels_estimator_p.reset(new ImagePlaneStixelsEstimator(options,
                                                                  camera,
                                                                  expected_object_height,
@@ -257,6 +285,13 @@ void FastStixelWorldEstimator::compute()
     {
         printf("Average FastStixelWorldEstimator::compute speed  %.2lf [Hz] (in the last %i iterations)\n",
                num_iterations / cumulated_time, num_iterations );
+
+        const FastStixelsEstimator *fast_estimator_p = dynamic_cast<FastStixelsEstimator *>(stixels_estimator_p.get());
+        if(fast_estimator_p)
+        {
+            printf("FastStixelWorldEstimator searched %.1lf%% of the columns over all the disparities\n",
+                   fast_estimator_p->get_full_search_columns_fraction() * 100);
+        }
     }
 
     return;
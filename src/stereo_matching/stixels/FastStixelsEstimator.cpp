@@ -14,6 +14,8 @@
 #include <boost/gil/extension/io/png_io.hpp>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cmath>
 
 namespace
 {
@@ -58,9 +60,30 @@ FastStixelsEstimator::FastStixelsEstimator(
           minimum_object_height_in_pixels,
           stixel_width),
       disparity_offset(camera.get_calibration().get_disparity_offset_x()),
-      num_disparities(get_option_value<int>(options, "max_disparity"))
+      num_disparities(get_option_value<int>(options, "max_disparity")),
+      temporal_band(0),
+      temporal_full_search_period(1),
+      temporal_cost_change_threshold(0),
+      temporal_max_ground_change(0),
+      full_search_frame(true),
+      num_frames_since_full_search(0),
+      num_full_search_columns(0),
+      num_columns_searched(0)
 {
-    // nothing to do here
+    // the temporal options are defined in FastStixelWorldEstimator::get_args_options
+    if(options.count("stixel_world.temporal_band"))
+    {
+        temporal_band = get_option_value<int>(options, "stixel_world.temporal_band");
+        temporal_full_search_period = get_option_value<int>(options, "stixel_world.temporal_full_search_period");
+        temporal_cost_change_threshold = get_option_value<float>(options, "stixel_world.temporal_cost_change_threshold");
+        temporal_max_ground_change = get_option_value<float>(options, "stixel_world.temporal_max_ground_change");
+    }
+
+    if((temporal_band > 0) and (temporal_full_search_period < 1))
+    {
+        throw std::invalid_argument("stixel_world.temporal_full_search_period should be >= 1");
+    }
+
     return;
 }
 
@@ -124,6 +147,12 @@ void FastStixelsEstimator::set_ground_plane_estimate(const GroundPlane &ground_p
     the_v_disparity_ground_line = v_disparity_ground_line;
 
 
+    if(temporal_band > 0)
+    {
+        // used to detect large changes of the ground plane between frames
+        previous_v_given_disparity = v_given_disparity;
+    }
+
     const int num_rows = input_left_view.height();
     set_v_disparity_line_bidirectional_maps(num_rows, num_disparities);
     set_v_given_disparity(num_rows, num_disparities);
@@ -138,6 +167,9 @@ void FastStixelsEstimator::compute()
     copy_pixels(gil::transposed_view(input_left_view), transposed_left_image_p->get_view());
     copy_pixels(gil::transposed_view(input_right_view), transposed_right_image_p->get_view());
 
+    // full disparities range, or only around the previous boundary ? --
+    full_search_frame = should_do_full_search();
+
     // create the disparity space image --
     // (using estimated ground plane)
     compute_disparity_space_cost();
@@ -146,6 +178,81 @@ void FastStixelsEstimator::compute()
     // (using dynamic programming)
     compute_ground_obstacle_boundary();
 
+    update_temporal_search_state();
+
+    return;
+}
+
+
+float FastStixelsEstimator::get_full_search_columns_fraction() const
+{
+    if(num_columns_searched == 0)
+    {
+        return 1;
+    }
+
+    return static_cast<float>(num_full_search_columns) / num_columns_searched;
+}
+
+
+bool FastStixelsEstimator::should_do_full_search() const
+{
+    if(temporal_band <= 0)
+    {
+        return true;
+    }
+
+    if(num_frames_since_full_search >= temporal_full_search_period)
+    {
+        return true;
+    }
+
+    const size_t num_columns = input_left_view.width();
+    if((u_disparity_ground_obstacle_boundary.size() != num_columns) or
+       (previous_boundary_object_cost.size() != num_columns) or
+       (previous_v_given_disparity.size() != v_given_disparity.size()))
+    {
+        // no previous frame (or the image size changed)
+        return true;
+    }
+
+    // the boundary is expressed in disparities, which are not affected by the camera pitch and height changes,
+    // however these changes modify the object and ground areas of every column.
+    // If the ground moved too much since the previous frame, the previous boundary is not a good prior anymore
+    int max_ground_change = 0;
+    for(size_t d = 0; d < v_given_disparity.size(); d += 1)
+    {
+        max_ground_change = std::max(max_ground_change, std::abs(v_given_disparity[d] - previous_v_given_disparity[d]));
+    }
+
+    return max_ground_change > temporal_max_ground_change;
+}
+
+
+void FastStixelsEstimator::update_temporal_search_state()
+{
+    if(temporal_band <= 0)
+    {
+        return;
+    }
+
+    if(full_search_frame)
+    {
+        num_frames_since_full_search = 1;
+    }
+    else
+    {
+        num_frames_since_full_search += 1;
+    }
+
+    // keep the object cost at the new boundary, to detect the columns that changed in the next frame
+    const int num_columns = u_disparity_ground_obstacle_boundary.size();
+    previous_boundary_object_cost.resize(num_columns);
+    for(int u = 0; u < num_columns; u += 1)
+    {
+        previous_boundary_object_cost[u] = object_u_disparity_cost(u_disparity_ground_obstacle_boundary[u], u);
+    }
+
     return;
 }
 
@@ -233,19 +340,28 @@ void sum_object_cost_simd(
 
 void FastStixelsEstimator::compute_object_cost(u_disparity_cost_t &object_cost) const
 {
-    //const int num_rows = input_left_view.height();
-    const size_t num_columns = input_left_view.width();
-    const size_t num_disparities = this->num_disparities;
-    const int disparity_offset = this->disparity_offset;
-
-    //const bool use_simd = false;
-    const bool use_simd = true;
+    const int num_columns = input_left_view.width();
 
     // guided schedule seeems to provide the best performance (better than default and static)
 #pragma omp parallel for schedule(guided)
-    for(size_t u = 0; u < num_columns; u += 1)
+    for(int u = 0; u < num_columns; u += 1)
     { // iterate over the columns
+        compute_column_object_cost(u, 0, num_disparities, object_cost);
+    } // end of "for each u"
+
+    return;
+}
+
+
+void FastStixelsEstimator::compute_column_object_cost(const int u, const int disparity_begin, const int disparity_end,
+                                                      u_disparity_cost_t &object_cost) const
+{
+    const int disparity_offset = this->disparity_offset;
+
+    //const bool use_simd = false;
+    const bool use_simd = true;
 
+    {
         const AlignedImage::const_view_t::x_iterator
                 left_column_begin_it = transposed_left_image_p->get_view().row_begin(u);
         //left_column_end_it = transposed_left_image_p->get_view().row_end(u);
@@ -253,7 +369,7 @@ void FastStixelsEstimator::compute_object_cost(u_disparity_cost_t &object_cost)
         // a pixel (x,y) on the left image should be matched on the right image on the range ([0,x],y)
         //const int first_right_x = first_left_x - disparity;
 
-        for(size_t d = 0; d < num_disparities; d += 1)
+        for(int d = disparity_begin; d < disparity_end; d += 1)
         {
             const int right_u = u - (d + disparity_offset);
             if( right_u < 0 )
@@ -300,8 +416,69 @@ void FastStixelsEstimator::compute_object_cost(u_disparity_cost_t &object_cost)
             assert(t_object_cost >= 0);
 
         } // end of "for each disparity"
+    }
+
+    return;
+}
+
+
+void FastStixelsEstimator::compute_object_cost_within_temporal_band(u_disparity_cost_t &object_cost)
+{
+    const int num_columns = input_left_view.width();
+    const int num_disparities = this->num_disparities;
+    const int disparity_offset = this->disparity_offset;
+    const int temporal_band = this->temporal_band;
+    const float temporal_cost_change_threshold = this->temporal_cost_change_threshold;
+
+    // object costs are sad per pixel, averaged over the RGB channels
+    const float max_object_cost = 255;
+
+    int num_changed_columns = 0;
+
+    // guided schedule seeems to provide the best performance (better than default and static)
+#pragma omp parallel for schedule(guided) reduction(+:num_changed_columns)
+    for(int u = 0; u < num_columns; u += 1)
+    { // iterate over the columns
+
+        const int previous_d = u_disparity_ground_obstacle_boundary[u];
+        const int
+                disparity_begin = std::max(0, previous_d - temporal_band),
+                disparity_end = std::min(num_disparities, previous_d + temporal_band + 1);
+
+        compute_column_object_cost(u, disparity_begin, disparity_end, object_cost);
+
+        // relative change of the cost at the previous boundary
+        const float
+                previous_cost = previous_boundary_object_cost[u],
+                current_cost = object_cost(previous_d, u);
+        const bool column_changed =
+                std::abs(current_cost - previous_cost) > temporal_cost_change_threshold*std::max(previous_cost, 1.0f);
+
+        if(column_changed)
+        {
+            compute_column_object_cost(u, 0, disparity_begin, object_cost);
+            compute_column_object_cost(u, disparity_end, num_disparities, object_cost);
+            num_changed_columns += 1;
+        }
+        else
+        {
+            // outside of the band we set the maximum cost,
+            // disparities too large for the current column are left to zero (like in compute_object_cost)
+            const int max_d = std::min(num_disparities, u - disparity_offset + 1);
+            for(int d = 0; d < std::min(disparity_begin, max_d); d += 1)
+            {
+                object_cost(d, u) = max_object_cost;
+            }
+
+            for(int d = disparity_end; d < max_d; d += 1)
+            {
+                object_cost(d, u) = max_object_cost;
+            }
+        }
+
     } // end of "for each u"
 
+    num_full_search_columns += num_changed_columns;
     return;
 }
 
@@ -824,7 +1001,18 @@ void FastStixelsEstimator::compute_disparity_space_cost()
     {
         // it seems that computing one cost and then the next one is slightly faster
         // than computing both in the same time (probably because of cache streaming usage)
-        compute_object_cost(object_u_disparity_cost);
+        if(full_search_frame)
+        {
+            compute_object_cost(object_u_disparity_cost);
+            num_full_search_columns += num_columns;
+        }
+        else
+        {
+            // the ground cost is a single cumulative sum per column, there is no gain in restricting it
+            compute_object_cost_within_temporal_band(object_u_disparity_cost);
+        }
+        num_columns_searched += num_columns;
+
         //compute_ground_cost_v0(ground_u_disparity_cost);
         compute_ground_cost_v1(ground_u_disparity_cost);
     }
@@ -30,6 +30,9 @@ public:
 
     void compute();
 
+    /// fraction of the columns that were searched over all the disparities (since the first frame),
+    /// 1 when the temporal mode is disabled
+    float get_full_search_columns_fraction() const;
 
 protected:
 
@@ -46,6 +49,31 @@ protected:
 
     void compute_transposed_rectified_right_image();
     void compute_object_cost(u_disparity_cost_t &object_cost) const;
+
+    /// object cost of the column u, for the disparities in the range [disparity_begin, disparity_end)
+    void compute_column_object_cost(const int u, const int disparity_begin, const int disparity_end,
+                                    u_disparity_cost_t &object_cost) const;
+
+    /// Temporal mode (stixel_world.temporal_band > 0):
+    /// the object cost is only computed within +/- temporal_band disparities around the previous frame boundary,
+    /// the other disparities get the maximum object cost.
+    /// Columns where the object cost at the previous boundary changed more than temporal_cost_change_threshold
+    /// are searched over all the disparities, as are all the columns once every temporal_full_search_period frames,
+    /// and when the ground plane moved (between two frames) more than temporal_max_ground_change rows
+    /// @{
+    int temporal_band, temporal_full_search_period;
+    float temporal_cost_change_threshold, temporal_max_ground_change;
+
+    bool full_search_frame;
+    int num_frames_since_full_search;
+    std::vector<int> previous_v_given_disparity;
+    std::vector<float> previous_boundary_object_cost;
+    size_t num_full_search_columns, num_columns_searched;
+
+    bool should_do_full_search() const;
+    void compute_object_cost_within_temporal_band(u_disparity_cost_t &object_cost);
+    void update_temporal_search_state();
+    /// @}
     void compute_ground_cost_v0(u_disparity_cost_t &ground_cost) const;
 
     /// v1 is faster than v0 (even without simd)
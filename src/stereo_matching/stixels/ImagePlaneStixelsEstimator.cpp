@@ -8,6 +8,8 @@
 
 #include "stereo_matching/cost_functions.hpp"
 
+#include "stixels_dynamic_programming.hpp"
+
 #include "helpers/AlignedImage.hpp"
 #include "helpers/get_option_value.hpp"
 #include "helpers/Log.hpp"
@@ -827,7 +829,10 @@ void ImagePlaneStixelsEstimator::estimate_stixels_bottom_using_dynamic_programmi
 {
     // v0 uses backtracking for the second pass
     // (which on StixelsEstimator was slower than recomputing everything)
-    estimate_stixels_bottom_using_dynamic_programming_v0_backtracking();
+    //estimate_stixels_bottom_using_dynamic_programming_v0_backtracking();
+
+    // v1 computes the same values as v0, using a prefix minimum per stixel
+    estimate_stixels_bottom_using_dynamic_programming_v1_prefix_minimum();
     return;
 }
 
@@ -852,7 +857,7 @@ void ImagePlaneStixelsEstimator::estimate_stixels_bottom_using_dynamic_programmi
 
         const float diagonal_weight = u_disparity_boundary_diagonal_weight;
 
-        const cost_per_stixel_and_row_step_t &const_M_cost = M_cost;
+        const M_cost_t &const_M_cost = M_cost;
 
         if((min_M_minus_c_indices.shape()[1] != static_cast<size_t>(num_row_steps))
            or (min_M_minus_c_indices.shape()[0] != static_cast<size_t>(num_stixels)))
@@ -1005,19 +1010,14 @@ void ImagePlaneStixelsEstimator::estimate_stixels_bottom_using_dynamic_programmi
                 const_M_cost.row(0).minCoeff(&row_step_star);
             }
 
+            // the rest are set using the stored min_M_minus_c_indices
+            for(int stixel_index = 1; stixel_index < num_stixels; stixel_index += 1)
             {
-                int &previous_row_step_star = stixel_and_row_step_ground_obstacle_boundary[0];
-                int previous_stixel_index = 0;
-
-                // the rest are set using the stored min_M_minus_c_indices
-                for(int stixel_index = 1; stixel_index < num_stixels; stixel_index += 1, previous_stixel_index = stixel_index)
-                {
-                    int &row_step_star = stixel_and_row_step_ground_obstacle_boundary[stixel_index];
-                    // (no boundary check for speed reasons, in debug mode Eigen does the checks)
-                    row_step_star = min_M_minus_c_indices[previous_stixel_index][previous_row_step_star];
-                    previous_row_step_star = row_step_star;
-                } // end of "for each column", i.e. "for each u value"
-            }
+                const int previous_row_step_star = stixel_and_row_step_ground_obstacle_boundary[stixel_index - 1];
+                // (no boundary check for speed reasons, in debug mode Eigen does the checks)
+                stixel_and_row_step_ground_obstacle_boundary[stixel_index] =
+                        min_M_minus_c_indices[stixel_index - 1][previous_row_step_star];
+            } // end of "for each column", i.e. "for each u value"
 
         } // end of left to right pass
 
@@ -1025,6 +1025,164 @@ void ImagePlaneStixelsEstimator::estimate_stixels_bottom_using_dynamic_programmi
 
     // at this point stixel_and_row_step_ground_obstacle_boundary is now set
 
+    // set u_v_ground_obstacle_boundary and the stixels outputs --
+    stixel_and_row_step_boundary_to_stixels();
+
+    return;
+}
+
+
+void ImagePlaneStixelsEstimator::estimate_stixels_bottom_using_dynamic_programming_v1_prefix_minimum()
+{
+    // same recurrence as v0, but the minimum over the rows "above" the current row_step
+    // is read from the prefix minimum of the next stixel, computed once per stixel.
+    // M_cost is row major, so the row steps of each stixel are contiguous.
+    // Each stixel only takes a few microseconds, so we run single threaded
+    // (v0 synchronizes all the threads once per stixel)
+
+    const int stixel_width = this->stixel_width;
+
+    const int
+            num_stixels = cost_per_stixel_and_row_step.rows(),
+            num_row_steps = cost_per_stixel_and_row_step.cols();
+
+    stixel_and_row_step_ground_obstacle_boundary.resize(num_stixels);
+
+    const float diagonal_weight = u_disparity_boundary_diagonal_weight;
+
+    if((min_M_minus_c_indices.shape()[1] != static_cast<size_t>(num_row_steps))
+       or (min_M_minus_c_indices.shape()[0] != static_cast<size_t>(num_stixels)))
+    {
+        min_M_minus_c_indices.resize(boost::extents[num_stixels][num_row_steps]);
+        // all accessed values are set, so there is no need to initialize
+    }
+
+    // right to left pass --
+
+    // Kubota et al. 2007 penalizes using object cost
+    // this is completelly arbritrary, we use here
+    // object_cost + ground_cost
+    const cost_per_stixel_and_row_step_t &c_i_cost = object_cost_per_stixel_and_row_step;
+
+    {
+        // we first copy all m_i(d_i) values
+        M_cost = cost_per_stixel_and_row_step;
+
+        prefix_minimum_M_cost.resize(num_row_steps);
+        prefix_minimum_M_cost_indices.resize(num_row_steps);
+        float *prefix_minimum = &prefix_minimum_M_cost[0];
+        int *prefix_minimum_indices = &prefix_minimum_M_cost_indices[0];
+
+        for(int stixel_index = num_stixels - 2; stixel_index >=0; stixel_index -= 1)
+        {
+            // equation 3 with d_{i-1} replaced by e
+            // we do min instead of max because we are using correlation cost
+            // M_i(d_i) = m_i(d_i) + min_e[ M_{i-1}(e) - c_i(d_i, e) ]
+            min_M_minus_c_indices_t::reference min_M_minus_c_indices_stixel = min_M_minus_c_indices[stixel_index];
+
+            const int next_stixel_index_column = stixel_index + 1;
+            const float *next_stixel_M_cost = M_cost.row(next_stixel_index_column).data();
+            float *stixel_M_cost = M_cost.row(stixel_index).data();
+
+            compute_prefix_minimum(next_stixel_M_cost, num_row_steps, prefix_minimum);
+            compute_prefix_minimum_index(next_stixel_M_cost, prefix_minimum, num_row_steps, prefix_minimum_indices);
+
+            for(int row_step_index=0; row_step_index < num_row_steps; row_step_index+=1)
+            {
+                const int d = disparity_given_stixel_and_row_step[stixel_index][row_step_index];
+                float min_M_minus_c = std::numeric_limits<float>::max();
+                int min_M_minus_c_index = 0;
+
+                // since upper row do mean lower disparities,
+                // we can check safely all pixels "above" (c = 0)
+                if(row_step_index > 0)
+                {
+                    min_M_minus_c = prefix_minimum[row_step_index - 1];
+                    min_M_minus_c_index = prefix_minimum_indices[row_step_index - 1];
+                }
+
+                // e == row_step_index
+                // "straigh horizontal line" case
+                {
+                    const int e = row_step_index;
+
+                    const float w = -0.5; // FIXME hardcoded test parameter
+                    const float c = -w*c_i_cost(stixel_index, e);
+                    const float t_cost = next_stixel_M_cost[e] - c;
+
+                    if(t_cost < min_M_minus_c)
+                    {
+                        min_M_minus_c = t_cost;
+                        min_M_minus_c_index = e;
+                    }
+                }
+
+                // we now check next stixel on same row_step or below,
+                // until we cross the disparity diagonal constraint
+                for(int e = row_step_index + 1; e < num_row_steps ; e+=1)
+                {
+                    const int next_stixel_d = disparity_given_stixel_and_row_step[next_stixel_index_column][e];
+                    const int delta_d = next_stixel_d - d;
+
+                    if(delta_d < stixel_width)
+                    { // above the diagonal constraint, same operation as before
+                        const float t_cost = next_stixel_M_cost[e];
+                        if(t_cost < min_M_minus_c)
+                        {
+                            min_M_minus_c = t_cost;
+                            min_M_minus_c_index = e;
+                        }
+                    }
+                    else //if(delta_d >= stixel_width)
+                    { // below or exactly on the diagonal
+                        // even if not exactly on the diagonal we apply the diagonal constraint
+                        const float c = -diagonal_weight - c_i_cost(stixel_index, e);
+                        const float t_cost = next_stixel_M_cost[e] - c;
+
+                        if(t_cost < min_M_minus_c)
+                        {
+                            min_M_minus_c = t_cost;
+                            min_M_minus_c_index = e;
+                        }
+
+                        // no need to explore the rows below since they are non-valid
+                        break;
+                    }
+                } // end of "for current and next row"
+
+                stixel_M_cost[row_step_index] += min_M_minus_c;
+                min_M_minus_c_indices_stixel[row_step_index] = min_M_minus_c_index;
+            } // end of "for each row step"
+        } // end of "for each stixel", i.e. "for each column in the image"
+
+    } // end of right to left pass
+
+    // left to right pass --
+    {
+        // we set the first value directly
+        M_cost.row(0).minCoeff(&stixel_and_row_step_ground_obstacle_boundary[0]);
+
+        // the rest are set using the stored min_M_minus_c_indices
+        for(int stixel_index = 1; stixel_index < num_stixels; stixel_index += 1)
+        {
+            const int previous_row_step_star = stixel_and_row_step_ground_obstacle_boundary[stixel_index - 1];
+            stixel_and_row_step_ground_obstacle_boundary[stixel_index] =
+                    min_M_minus_c_indices[stixel_index - 1][previous_row_step_star];
+        }
+    } // end of left to right pass
+
+    // set u_v_ground_obstacle_boundary and the stixels outputs --
+    stixel_and_row_step_boundary_to_stixels();
+
+    return;
+}
+
+
+void ImagePlaneStixelsEstimator::stixel_and_row_step_boundary_to_stixels()
+{
+    const size_t num_stixels = row_given_stixel_and_row_step.shape()[0];
+    const int stixel_width = this->stixel_width;
+
     { // we store the final result
 
         // to make things simple we always output one stixel per column
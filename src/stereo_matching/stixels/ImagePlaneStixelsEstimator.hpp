@@ -106,11 +106,17 @@ protected:
     void compute_object_cost(cost_per_stixel_and_row_step_t &object_cost) const;
     void compute_ground_cost(cost_per_stixel_and_row_step_t &ground_cost) const;
 
-    cost_per_stixel_and_row_step_t M_cost;
+    /// row major, so that the row steps of each stixel are contiguous
+    typedef Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> M_cost_t;
+    M_cost_t M_cost;
 
     typedef boost::multi_array<int, 2> min_M_minus_c_indices_t;
     min_M_minus_c_indices_t min_M_minus_c_indices;
 
+    /// used by estimate_stixels_bottom_using_dynamic_programming_v1_prefix_minimum
+    std::vector<float> prefix_minimum_M_cost;
+    std::vector<int> prefix_minimum_M_cost_indices;
+
 
     /// estimate the distance using dynamic programming
     void estimate_stixels_bottom();
@@ -120,6 +126,10 @@ protected:
 
     void estimate_stixels_bottom_using_dynamic_programming();
     void estimate_stixels_bottom_using_dynamic_programming_v0_backtracking();
+    void estimate_stixels_bottom_using_dynamic_programming_v1_prefix_minimum();
+
+    /// set u_v_ground_obstacle_boundary and the stixels outputs, based on stixel_and_row_step_ground_obstacle_boundary
+    void stixel_and_row_step_boundary_to_stixels();
 
     /// this vector stores the resulting boundary line
     std::vector<int> stixel_and_row_step_ground_obstacle_boundary;
@@ -8,9 +8,15 @@
 // only for do_horizontal_averaging
 #include "stereo_matching/stixels/StixelsEstimatorWithHeightEstimation.hpp"
 
+#include "stixels_dynamic_programming.hpp"
+
 #include "helpers/get_option_value.hpp"
 #include "helpers/Log.hpp"
 
+// emmintrin will define __m128
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+
 #include <stdexcept>
 #include <cstdio>
 #include <limits>
@@ -764,12 +770,16 @@ void StixelsEstimator::compute_ground_obstacle_boundary()
 
     // v1 is significantly faster than v0, but they compute exactly the same values
     //compute_ground_obstacle_boundary_v0();
-    compute_ground_obstacle_boundary_v1();
+    //compute_ground_obstacle_boundary_v1();
 
     // v2 should be faster than v1 (on paper), but it is not (in practice)
     // v1 is one instance where "computing more is faster than computing less"
     //compute_ground_obstacle_boundary_v2();
 
+    // v3 computes the same values as v1, using a prefix minimum per column
+    // (linear instead of quadratic on the number of disparities, and no threads synchronization per column)
+    compute_ground_obstacle_boundary_v3();
+
     return;
 } // end of StixelsEstimator::compute_ground_obstacle_boundary
 
@@ -1315,6 +1325,154 @@ inline void StixelsEstimator::compute_ground_obstacle_boundary_v2()
 } // end of StixelsEstimator::compute_ground_obstacle_boundary_v2
 
 
+inline void StixelsEstimator::compute_ground_obstacle_boundary_v3()
+{
+    // run dynamic programming over the disparity space cost image --
+
+    // see section III.C of Kubota et al. 2007 paper
+    // (see StixelsEstimator class documentation)
+
+    // same recurrence as v1, but for each d the minimum over e <= d is read from the prefix minimum
+    // of the next column, computed once per column. M_cost is column major,
+    // so each column is a contiguous vector of disparities, processed with SSE2.
+    // Each column only takes a few microseconds, so we run single threaded
+    // (v1 synchronizes all the threads once per column)
+
+    const int
+            num_columns = u_disparity_cost.cols(),
+            num_disparities = u_disparity_cost.rows();
+
+    if(pixels_cost_volume_p)
+    {
+        if(pixels_cost_volume_p->disparities() != static_cast<size_t>(num_disparities) or
+           pixels_cost_volume_p->columns() != static_cast<size_t>(num_columns))
+        {
+            throw std::runtime_error("StixelsEstimator::compute_ground_obstacle_boundary_v3 "
+                                     "u_disparity_cost does not match the expected dimensions");
+        }
+    }
+
+    const float diagonal_weight = u_disparity_boundary_diagonal_weight;
+
+    // right to left pass --
+
+    // Kubota et al. 2007 penalizes using object cost
+    // this is completelly arbritrary, we use here
+    // object_cost + ground_cost
+    const u_disparity_cost_t &c_i_cost = object_u_disparity_cost;
+
+    {
+        // we first copy all m_i(d_i) values
+        M_cost = u_disparity_cost;
+
+        prefix_minimum_M_cost.resize(num_disparities);
+        float *prefix_minimum = &prefix_minimum_M_cost[0];
+
+        const __m128 minus_diagonal_weight = _mm_set1_ps(-diagonal_weight);
+
+        for(int column = num_columns - 2; column >=0; column -= 1)
+        {
+            // equation 3 with d_{i-1} replaced by e
+            // we do min instead of max because we are using correlation cost
+            // M_i(d_i) = m_i(d_i) + min_e[ M_{i-1}(e) - c_i(d_i, e) ]
+
+            const float *next_column_M_cost = M_cost.col(column + 1).data();
+            const float *column_c_i_cost = c_i_cost.col(column).data();
+            float *column_M_cost = M_cost.col(column).data();
+
+            // e_minus_one < d, c = 0
+            compute_prefix_minimum(next_column_M_cost, num_disparities, prefix_minimum);
+
+            // d == e_minus_one, c = -diagonal_weight - c_i_cost(d, column)
+            int d = 0;
+            for(; d + 4 < num_disparities; d += 4)
+            {
+                const __m128 c = _mm_sub_ps(minus_diagonal_weight, _mm_loadu_ps(column_c_i_cost + d));
+                const __m128 t_cost = _mm_sub_ps(_mm_loadu_ps(next_column_M_cost + d + 1), c);
+                const __m128 min_M_minus_c = _mm_min_ps(_mm_loadu_ps(prefix_minimum + d), t_cost);
+                _mm_storeu_ps(column_M_cost + d, _mm_add_ps(_mm_loadu_ps(column_M_cost + d), min_M_minus_c));
+            }
+
+            for(; d < num_disparities; d += 1)
+            {
+                float min_M_minus_c = prefix_minimum[d];
+
+                const int e = d+1;
+                if(e < num_disparities)
+                {
+                    const float c = -diagonal_weight - column_c_i_cost[d];
+                    const float t_cost = next_column_M_cost[e] - c;
+                    min_M_minus_c = std::min(t_cost, min_M_minus_c);
+                }
+
+                column_M_cost[d] += min_M_minus_c;
+            } // end of "for each remaining disparity d"
+
+            // e_minus_one > d is not a candidate for min[...]
+
+        } // end of "for each column", i.e. "for each u value"
+    } // end of right to left pass
+
+    // left to right pass --
+    {
+        const u_disparity_cost_t &const_M_cost = M_cost;
+
+        u_disparity_ground_obstacle_boundary.resize(num_columns);
+
+        // we set the first value directly
+        {
+            int &d_star = u_disparity_ground_obstacle_boundary[0];
+            const_M_cost.col(0).minCoeff(&d_star);
+        }
+
+        // the rest are recursively, the same as in v1
+        // (only one disparity per column is visited, the cost is negligible)
+        for(int column = 1; column < num_columns; column += 1)
+        {
+            const int previous_d_star = u_disparity_ground_obstacle_boundary[column - 1];
+            const float *column_M_cost = const_M_cost.col(column).data();
+
+            int &d_star = u_disparity_ground_obstacle_boundary[column];
+            float min_M_minus_c = std::numeric_limits<float>::max();
+
+            // e_minus_one < previous_d_star
+            const int e_end = std::min(previous_d_star+1, num_disparities);
+            for(int e=0; e < e_end; e+=1)
+            {
+                const float t_cost = column_M_cost[e];
+                if(t_cost <= min_M_minus_c)
+                {
+                    d_star = e;
+                    min_M_minus_c = t_cost;
+                }
+            }
+
+            // e_minus_one == previous_d_star
+            const int e = previous_d_star+1;
+            if(e < num_disparities)
+            {
+                const float c = -diagonal_weight - c_i_cost(previous_d_star, column - 1);
+                const float t_cost = column_M_cost[e] - c;
+                if(t_cost <= min_M_minus_c)
+                {
+                    d_star = e;
+                    min_M_minus_c = t_cost;
+                }
+            }
+
+        } // end of "for each column", i.e. "for each u value"
+
+    } // end of left to right pass
+
+    // at this point u_disparity_ground_obstacle_boundary is now set
+
+    // set u_v_ground_obstacle_boundary and the stixels outputs --
+    u_disparity_boundary_to_stixels();
+
+    return;
+} // end of StixelsEstimator::compute_ground_obstacle_boundary_v3
+
+
 void StixelsEstimator::u_disparity_boundary_to_stixels()
 {
     // dummy version, one stixel per column
@@ -93,6 +93,7 @@ protected:
     void compute_ground_obstacle_boundary_v0();
     void compute_ground_obstacle_boundary_v1();
     void compute_ground_obstacle_boundary_v2();
+    void compute_ground_obstacle_boundary_v3();
 
     void post_process_object_u_disparity_cost(u_disparity_cost_t &cost) const;
 
@@ -119,6 +120,9 @@ protected:
     typedef boost::multi_array<int, 2> min_M_minus_c_indices_t;
     min_M_minus_c_indices_t min_M_minus_c_indices;
 
+    /// used by compute_ground_obstacle_boundary_v3
+    std::vector<float> prefix_minimum_M_cost;
+
     /// for each u value, give the boundary disparity
     std::vector<int> u_disparity_ground_obstacle_boundary, u_v_ground_obstacle_boundary;
 
@@ -1,580 +1,565 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: ground_top_and_bottom.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "ground_top_and_bottom.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
-
-namespace {
-
-const ::google::protobuf::Descriptor* TopAndBottom_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TopAndBottom_reflection_ = NULL;
-const ::google::protobuf::Descriptor* GroundTopAndBottom_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  GroundTopAndBottom_reflection_ = NULL;
-
-}  // namespace
+PROTOBUF_PRAGMA_INIT_SEG
 
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-void protobuf_AssignDesc_ground_5ftop_5fand_5fbottom_2eproto() {
-  protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "ground_top_and_bottom.proto");
-  GOOGLE_CHECK(file != NULL);
-  TopAndBottom_descriptor_ = file->message_type(0);
-  static const int TopAndBottom_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopAndBottom, top_y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopAndBottom, bottom_y_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR TopAndBottom::TopAndBottom(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.top_y_)*/0u
+  , /*decltype(_impl_.bottom_y_)*/0u} {}
+struct TopAndBottomDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TopAndBottomDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TopAndBottomDefaultTypeInternal() {}
+  union {
+    TopAndBottom _instance;
   };
-  TopAndBottom_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TopAndBottom_descriptor_,
-      TopAndBottom::default_instance_,
-      TopAndBottom_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopAndBottom, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TopAndBottom, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TopAndBottom));
-  GroundTopAndBottom_descriptor_ = file->message_type(1);
-  static const int GroundTopAndBottom_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GroundTopAndBottom, top_and_bottom_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TopAndBottomDefaultTypeInternal _TopAndBottom_default_instance_;
+PROTOBUF_CONSTEXPR GroundTopAndBottom::GroundTopAndBottom(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.top_and_bottom_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GroundTopAndBottomDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GroundTopAndBottomDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GroundTopAndBottomDefaultTypeInternal() {}
+  union {
+    GroundTopAndBottom _instance;
   };
-  GroundTopAndBottom_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      GroundTopAndBottom_descriptor_,
-      GroundTopAndBottom::default_instance_,
-      GroundTopAndBottom_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GroundTopAndBottom, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GroundTopAndBottom, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(GroundTopAndBottom));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_ground_5ftop_5fand_5fbottom_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TopAndBottom_descriptor_, &TopAndBottom::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    GroundTopAndBottom_descriptor_, &GroundTopAndBottom::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_ground_5ftop_5fand_5fbottom_2eproto() {
-  delete TopAndBottom::default_instance_;
-  delete TopAndBottom_reflection_;
-  delete GroundTopAndBottom::default_instance_;
-  delete GroundTopAndBottom_reflection_;
-}
-
-void protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\033ground_top_and_bottom.proto\022\017doppia_pr"
-    "otobuf\"/\n\014TopAndBottom\022\r\n\005top_y\030\001 \002(\r\022\020\n"
-    "\010bottom_y\030\002 \002(\r\"K\n\022GroundTopAndBottom\0225\n"
-    "\016top_and_bottom\030\001 \003(\0132\035.doppia_protobuf."
-    "TopAndBottom", 172);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "ground_top_and_bottom.proto", &protobuf_RegisterTypes);
-  TopAndBottom::default_instance_ = new TopAndBottom();
-  GroundTopAndBottom::default_instance_ = new GroundTopAndBottom();
-  TopAndBottom::default_instance_->InitAsDefaultInstance();
-  GroundTopAndBottom::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_ground_5ftop_5fand_5fbottom_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_ground_5ftop_5fand_5fbottom_2eproto {
-  StaticDescriptorInitializer_ground_5ftop_5fand_5fbottom_2eproto() {
-    protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  }
-} static_descriptor_initializer_ground_5ftop_5fand_5fbottom_2eproto_;
-
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroundTopAndBottomDefaultTypeInternal _GroundTopAndBottom_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_ground_5ftop_5fand_5fbottom_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_ground_5ftop_5fand_5fbottom_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_ground_5ftop_5fand_5fbottom_2eproto = nullptr;
+
+const uint32_t TableStruct_ground_5ftop_5fand_5fbottom_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TopAndBottom, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TopAndBottom, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TopAndBottom, _impl_.top_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TopAndBottom, _impl_.bottom_y_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::GroundTopAndBottom, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::GroundTopAndBottom, _impl_.top_and_bottom_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 8, -1, sizeof(::doppia_protobuf::TopAndBottom)},
+  { 10, -1, -1, sizeof(::doppia_protobuf::GroundTopAndBottom)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_TopAndBottom_default_instance_._instance,
+  &::doppia_protobuf::_GroundTopAndBottom_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_ground_5ftop_5fand_5fbottom_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\033ground_top_and_bottom.proto\022\017doppia_pr"
+  "otobuf\"/\n\014TopAndBottom\022\r\n\005top_y\030\001 \002(\r\022\020\n"
+  "\010bottom_y\030\002 \002(\r\"K\n\022GroundTopAndBottom\0225\n"
+  "\016top_and_bottom\030\001 \003(\0132\035.doppia_protobuf."
+  "TopAndBottom"
+  ;
+static ::_pbi::once_flag descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_ground_5ftop_5fand_5fbottom_2eproto = {
+    false, false, 172, descriptor_table_protodef_ground_5ftop_5fand_5fbottom_2eproto,
+    "ground_top_and_bottom.proto",
+    &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_once, nullptr, 0, 2,
+    schemas, file_default_instances, TableStruct_ground_5ftop_5fand_5fbottom_2eproto::offsets,
+    file_level_metadata_ground_5ftop_5fand_5fbottom_2eproto, file_level_enum_descriptors_ground_5ftop_5fand_5fbottom_2eproto,
+    file_level_service_descriptors_ground_5ftop_5fand_5fbottom_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_getter() {
+  return &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_ground_5ftop_5fand_5fbottom_2eproto(&descriptor_table_ground_5ftop_5fand_5fbottom_2eproto);
+namespace doppia_protobuf {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int TopAndBottom::kTopYFieldNumber;
-const int TopAndBottom::kBottomYFieldNumber;
-#endif  // !_MSC_VER
-
-TopAndBottom::TopAndBottom()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class TopAndBottom::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TopAndBottom>()._impl_._has_bits_);
+  static void set_has_top_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_bottom_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void TopAndBottom::InitAsDefaultInstance() {
+TopAndBottom::TopAndBottom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.TopAndBottom)
 }
-
 TopAndBottom::TopAndBottom(const TopAndBottom& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void TopAndBottom::SharedCtor() {
-  _cached_size_ = 0;
-  top_y_ = 0u;
-  bottom_y_ = 0u;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TopAndBottom* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_y_){}
+    , decltype(_impl_.bottom_y_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.top_y_, &from._impl_.top_y_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bottom_y_) -
+    reinterpret_cast<char*>(&_impl_.top_y_)) + sizeof(_impl_.bottom_y_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.TopAndBottom)
+}
+
+inline void TopAndBottom::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.top_y_){0u}
+    , decltype(_impl_.bottom_y_){0u}
+  };
 }
 
 TopAndBottom::~TopAndBottom() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.TopAndBottom)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TopAndBottom::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void TopAndBottom::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void TopAndBottom::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TopAndBottom::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TopAndBottom_descriptor_;
-}
-
-const TopAndBottom& TopAndBottom::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();  return *default_instance_;
-}
-
-TopAndBottom* TopAndBottom::default_instance_ = NULL;
-
-TopAndBottom* TopAndBottom::New() const {
-  return new TopAndBottom;
+  _impl_._cached_size_.Set(size);
 }
 
 void TopAndBottom::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    top_y_ = 0u;
-    bottom_y_ = 0u;
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.TopAndBottom)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.top_y_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bottom_y_) -
+        reinterpret_cast<char*>(&_impl_.top_y_)) + sizeof(_impl_.bottom_y_));
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool TopAndBottom::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* TopAndBottom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint32 top_y = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &top_y_)));
-          set_has_top_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_bottom_y;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_top_y(&has_bits);
+          _impl_.top_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 bottom_y = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_bottom_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &bottom_y_)));
-          set_has_bottom_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_bottom_y(&has_bits);
+          _impl_.bottom_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void TopAndBottom::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TopAndBottom::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.TopAndBottom)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint32 top_y = 1;
-  if (has_top_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->top_y(), output);
-  }
-  
-  // required uint32 bottom_y = 2;
-  if (has_bottom_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->bottom_y(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_top_y(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* TopAndBottom::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 top_y = 1;
-  if (has_top_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->top_y(), target);
-  }
-  
   // required uint32 bottom_y = 2;
-  if (has_bottom_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->bottom_y(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_bottom_y(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.TopAndBottom)
   return target;
 }
 
-int TopAndBottom::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t TopAndBottom::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.TopAndBottom)
+  size_t total_size = 0;
+
+  if (_internal_has_top_y()) {
     // required uint32 top_y = 1;
-    if (has_top_y()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->top_y());
-    }
-    
-    // required uint32 bottom_y = 2;
-    if (has_bottom_y()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->bottom_y());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_y());
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_bottom_y()) {
+    // required uint32 bottom_y = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_y());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t TopAndBottom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.TopAndBottom)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint32 top_y = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_y());
+
+    // required uint32 bottom_y = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_y());
 
-void TopAndBottom::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TopAndBottom* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TopAndBottom*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TopAndBottom::MergeFrom(const TopAndBottom& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_top_y()) {
-      set_top_y(from.top_y());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TopAndBottom::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TopAndBottom::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TopAndBottom::GetClassData() const { return &_class_data_; }
+
+
+void TopAndBottom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TopAndBottom*>(&to_msg);
+  auto& from = static_cast<const TopAndBottom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.TopAndBottom)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.top_y_ = from._impl_.top_y_;
     }
-    if (from.has_bottom_y()) {
-      set_bottom_y(from.bottom_y());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.bottom_y_ = from._impl_.bottom_y_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void TopAndBottom::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TopAndBottom::CopyFrom(const TopAndBottom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.TopAndBottom)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TopAndBottom::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void TopAndBottom::Swap(TopAndBottom* other) {
-  if (other != this) {
-    std::swap(top_y_, other->top_y_);
-    std::swap(bottom_y_, other->bottom_y_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void TopAndBottom::InternalSwap(TopAndBottom* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TopAndBottom, _impl_.bottom_y_)
+      + sizeof(TopAndBottom::_impl_.bottom_y_)
+      - PROTOBUF_FIELD_OFFSET(TopAndBottom, _impl_.top_y_)>(
+          reinterpret_cast<char*>(&_impl_.top_y_),
+          reinterpret_cast<char*>(&other->_impl_.top_y_));
 }
 
-::google::protobuf::Metadata TopAndBottom::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TopAndBottom_descriptor_;
-  metadata.reflection = TopAndBottom_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata TopAndBottom::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_getter, &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_once,
+      file_level_metadata_ground_5ftop_5fand_5fbottom_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int GroundTopAndBottom::kTopAndBottomFieldNumber;
-#endif  // !_MSC_VER
-
-GroundTopAndBottom::GroundTopAndBottom()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class GroundTopAndBottom::_Internal {
+ public:
+};
 
-void GroundTopAndBottom::InitAsDefaultInstance() {
+GroundTopAndBottom::GroundTopAndBottom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.GroundTopAndBottom)
 }
-
 GroundTopAndBottom::GroundTopAndBottom(const GroundTopAndBottom& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void GroundTopAndBottom::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GroundTopAndBottom* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.top_and_bottom_){from._impl_.top_and_bottom_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.GroundTopAndBottom)
+}
+
+inline void GroundTopAndBottom::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.top_and_bottom_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 GroundTopAndBottom::~GroundTopAndBottom() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.GroundTopAndBottom)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void GroundTopAndBottom::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void GroundTopAndBottom::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.top_and_bottom_.~RepeatedPtrField();
 }
 
 void GroundTopAndBottom::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* GroundTopAndBottom::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return GroundTopAndBottom_descriptor_;
-}
-
-const GroundTopAndBottom& GroundTopAndBottom::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();  return *default_instance_;
-}
-
-GroundTopAndBottom* GroundTopAndBottom::default_instance_ = NULL;
-
-GroundTopAndBottom* GroundTopAndBottom::New() const {
-  return new GroundTopAndBottom;
+  _impl_._cached_size_.Set(size);
 }
 
 void GroundTopAndBottom::Clear() {
-  top_and_bottom_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.GroundTopAndBottom)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.top_and_bottom_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool GroundTopAndBottom::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* GroundTopAndBottom::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_top_and_bottom:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_top_and_bottom()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_top_and_bottom;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_top_and_bottom(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GroundTopAndBottom::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.GroundTopAndBottom)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void GroundTopAndBottom::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
   // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
-  for (int i = 0; i < this->top_and_bottom_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->top_and_bottom(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_top_and_bottom_size()); i < n; i++) {
+    const auto& repfield = this->_internal_top_and_bottom(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* GroundTopAndBottom::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
-  for (int i = 0; i < this->top_and_bottom_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->top_and_bottom(i), target);
-  }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.GroundTopAndBottom)
   return target;
 }
 
-int GroundTopAndBottom::ByteSize() const {
-  int total_size = 0;
-  
+size_t GroundTopAndBottom::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.GroundTopAndBottom)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
-  total_size += 1 * this->top_and_bottom_size();
-  for (int i = 0; i < this->top_and_bottom_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->top_and_bottom(i));
-  }
-  
-  if (!unknown_fields().empty()) {
+  total_size += 1UL * this->_internal_top_and_bottom_size();
+  for (const auto& msg : this->_impl_.top_and_bottom_) {
     total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void GroundTopAndBottom::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const GroundTopAndBottom* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GroundTopAndBottom*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void GroundTopAndBottom::MergeFrom(const GroundTopAndBottom& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  top_and_bottom_.MergeFrom(from.top_and_bottom_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GroundTopAndBottom::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GroundTopAndBottom::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GroundTopAndBottom::GetClassData() const { return &_class_data_; }
 
-void GroundTopAndBottom::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+
+void GroundTopAndBottom::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GroundTopAndBottom*>(&to_msg);
+  auto& from = static_cast<const GroundTopAndBottom&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.GroundTopAndBottom)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.top_and_bottom_.MergeFrom(from._impl_.top_and_bottom_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void GroundTopAndBottom::CopyFrom(const GroundTopAndBottom& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.GroundTopAndBottom)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool GroundTopAndBottom::IsInitialized() const {
-  
-  for (int i = 0; i < top_and_bottom_size(); i++) {
-    if (!this->top_and_bottom(i).IsInitialized()) return false;
-  }
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.top_and_bottom_))
+    return false;
   return true;
 }
 
-void GroundTopAndBottom::Swap(GroundTopAndBottom* other) {
-  if (other != this) {
-    top_and_bottom_.Swap(&other->top_and_bottom_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void GroundTopAndBottom::InternalSwap(GroundTopAndBottom* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.top_and_bottom_.InternalSwap(&other->_impl_.top_and_bottom_);
 }
 
-::google::protobuf::Metadata GroundTopAndBottom::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GroundTopAndBottom_descriptor_;
-  metadata.reflection = GroundTopAndBottom_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata GroundTopAndBottom::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_getter, &descriptor_table_ground_5ftop_5fand_5fbottom_2eproto_once,
+      file_level_metadata_ground_5ftop_5fand_5fbottom_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::TopAndBottom*
+Arena::CreateMaybeMessage< ::doppia_protobuf::TopAndBottom >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::TopAndBottom >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::GroundTopAndBottom*
+Arena::CreateMaybeMessage< ::doppia_protobuf::GroundTopAndBottom >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::GroundTopAndBottom >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
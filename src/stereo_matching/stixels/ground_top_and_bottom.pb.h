@@ -1,266 +1,470 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: ground_top_and_bottom.proto
 
-#ifndef PROTOBUF_ground_5ftop_5fand_5fbottom_2eproto__INCLUDED
-#define PROTOBUF_ground_5ftop_5fand_5fbottom_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_ground_5ftop_5fand_5fbottom_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_ground_5ftop_5fand_5fbottom_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_ground_5ftop_5fand_5fbottom_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_ground_5ftop_5fand_5fbottom_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_ground_5ftop_5fand_5fbottom_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-void protobuf_AssignDesc_ground_5ftop_5fand_5fbottom_2eproto();
-void protobuf_ShutdownFile_ground_5ftop_5fand_5fbottom_2eproto();
-
-class TopAndBottom;
 class GroundTopAndBottom;
+struct GroundTopAndBottomDefaultTypeInternal;
+extern GroundTopAndBottomDefaultTypeInternal _GroundTopAndBottom_default_instance_;
+class TopAndBottom;
+struct TopAndBottomDefaultTypeInternal;
+extern TopAndBottomDefaultTypeInternal _TopAndBottom_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::GroundTopAndBottom* Arena::CreateMaybeMessage<::doppia_protobuf::GroundTopAndBottom>(Arena*);
+template<> ::doppia_protobuf::TopAndBottom* Arena::CreateMaybeMessage<::doppia_protobuf::TopAndBottom>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
 // ===================================================================
 
-class TopAndBottom : public ::google::protobuf::Message {
+class TopAndBottom final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.TopAndBottom) */ {
  public:
-  TopAndBottom();
-  virtual ~TopAndBottom();
-  
+  inline TopAndBottom() : TopAndBottom(nullptr) {}
+  ~TopAndBottom() override;
+  explicit PROTOBUF_CONSTEXPR TopAndBottom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   TopAndBottom(const TopAndBottom& from);
-  
+  TopAndBottom(TopAndBottom&& from) noexcept
+    : TopAndBottom() {
+    *this = ::std::move(from);
+  }
+
   inline TopAndBottom& operator=(const TopAndBottom& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TopAndBottom& operator=(TopAndBottom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TopAndBottom& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TopAndBottom* internal_default_instance() {
+    return reinterpret_cast<const TopAndBottom*>(
+               &_TopAndBottom_default_instance_);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TopAndBottom& a, TopAndBottom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TopAndBottom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TopAndBottom& default_instance();
-  
-  void Swap(TopAndBottom* other);
-  
+  void UnsafeArenaSwap(TopAndBottom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  TopAndBottom* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  TopAndBottom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TopAndBottom>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TopAndBottom& from);
-  void MergeFrom(const TopAndBottom& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TopAndBottom& from) {
+    TopAndBottom::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TopAndBottom* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.TopAndBottom";
+  }
+  protected:
+  explicit TopAndBottom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kTopYFieldNumber = 1,
+    kBottomYFieldNumber = 2,
+  };
   // required uint32 top_y = 1;
-  inline bool has_top_y() const;
-  inline void clear_top_y();
-  static const int kTopYFieldNumber = 1;
-  inline ::google::protobuf::uint32 top_y() const;
-  inline void set_top_y(::google::protobuf::uint32 value);
-  
+  bool has_top_y() const;
+  private:
+  bool _internal_has_top_y() const;
+  public:
+  void clear_top_y();
+  uint32_t top_y() const;
+  void set_top_y(uint32_t value);
+  private:
+  uint32_t _internal_top_y() const;
+  void _internal_set_top_y(uint32_t value);
+  public:
+
   // required uint32 bottom_y = 2;
-  inline bool has_bottom_y() const;
-  inline void clear_bottom_y();
-  static const int kBottomYFieldNumber = 2;
-  inline ::google::protobuf::uint32 bottom_y() const;
-  inline void set_bottom_y(::google::protobuf::uint32 value);
-  
+  bool has_bottom_y() const;
+  private:
+  bool _internal_has_bottom_y() const;
+  public:
+  void clear_bottom_y();
+  uint32_t bottom_y() const;
+  void set_bottom_y(uint32_t value);
+  private:
+  uint32_t _internal_bottom_y() const;
+  void _internal_set_bottom_y(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.TopAndBottom)
  private:
-  inline void set_has_top_y();
-  inline void clear_has_top_y();
-  inline void set_has_bottom_y();
-  inline void clear_has_bottom_y();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::uint32 top_y_;
-  ::google::protobuf::uint32 bottom_y_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  friend void protobuf_AssignDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  friend void protobuf_ShutdownFile_ground_5ftop_5fand_5fbottom_2eproto();
-  
-  void InitAsDefaultInstance();
-  static TopAndBottom* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t top_y_;
+    uint32_t bottom_y_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ground_5ftop_5fand_5fbottom_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GroundTopAndBottom : public ::google::protobuf::Message {
+class GroundTopAndBottom final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.GroundTopAndBottom) */ {
  public:
-  GroundTopAndBottom();
-  virtual ~GroundTopAndBottom();
-  
+  inline GroundTopAndBottom() : GroundTopAndBottom(nullptr) {}
+  ~GroundTopAndBottom() override;
+  explicit PROTOBUF_CONSTEXPR GroundTopAndBottom(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   GroundTopAndBottom(const GroundTopAndBottom& from);
-  
+  GroundTopAndBottom(GroundTopAndBottom&& from) noexcept
+    : GroundTopAndBottom() {
+    *this = ::std::move(from);
+  }
+
   inline GroundTopAndBottom& operator=(const GroundTopAndBottom& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline GroundTopAndBottom& operator=(GroundTopAndBottom&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const GroundTopAndBottom& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GroundTopAndBottom& default_instance();
-  
-  void Swap(GroundTopAndBottom* other);
-  
+  static inline const GroundTopAndBottom* internal_default_instance() {
+    return reinterpret_cast<const GroundTopAndBottom*>(
+               &_GroundTopAndBottom_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(GroundTopAndBottom& a, GroundTopAndBottom& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GroundTopAndBottom* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GroundTopAndBottom* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  GroundTopAndBottom* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  GroundTopAndBottom* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GroundTopAndBottom>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GroundTopAndBottom& from);
-  void MergeFrom(const GroundTopAndBottom& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GroundTopAndBottom& from) {
+    GroundTopAndBottom::MergeImpl(*this, from);
+  }
   private:
-  void SharedCtor();
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GroundTopAndBottom* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.GroundTopAndBottom";
+  }
+  protected:
+  explicit GroundTopAndBottom(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kTopAndBottomFieldNumber = 1,
+  };
   // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
-  inline int top_and_bottom_size() const;
-  inline void clear_top_and_bottom();
-  static const int kTopAndBottomFieldNumber = 1;
-  inline const ::doppia_protobuf::TopAndBottom& top_and_bottom(int index) const;
-  inline ::doppia_protobuf::TopAndBottom* mutable_top_and_bottom(int index);
-  inline ::doppia_protobuf::TopAndBottom* add_top_and_bottom();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >&
-      top_and_bottom() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >*
+  int top_and_bottom_size() const;
+  private:
+  int _internal_top_and_bottom_size() const;
+  public:
+  void clear_top_and_bottom();
+  ::doppia_protobuf::TopAndBottom* mutable_top_and_bottom(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >*
       mutable_top_and_bottom();
-  
+  private:
+  const ::doppia_protobuf::TopAndBottom& _internal_top_and_bottom(int index) const;
+  ::doppia_protobuf::TopAndBottom* _internal_add_top_and_bottom();
+  public:
+  const ::doppia_protobuf::TopAndBottom& top_and_bottom(int index) const;
+  ::doppia_protobuf::TopAndBottom* add_top_and_bottom();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >&
+      top_and_bottom() const;
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.GroundTopAndBottom)
  private:
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::TopAndBottom > top_and_bottom_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  friend void protobuf_AssignDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  friend void protobuf_ShutdownFile_ground_5ftop_5fand_5fbottom_2eproto();
-  
-  void InitAsDefaultInstance();
-  static GroundTopAndBottom* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::TopAndBottom > top_and_bottom_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_ground_5ftop_5fand_5fbottom_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // TopAndBottom
 
 // required uint32 top_y = 1;
+inline bool TopAndBottom::_internal_has_top_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TopAndBottom::has_top_y() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_top_y();
 }
-inline void TopAndBottom::set_has_top_y() {
-  _has_bits_[0] |= 0x00000001u;
+inline void TopAndBottom::clear_top_y() {
+  _impl_.top_y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void TopAndBottom::clear_has_top_y() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint32_t TopAndBottom::_internal_top_y() const {
+  return _impl_.top_y_;
 }
-inline void TopAndBottom::clear_top_y() {
-  top_y_ = 0u;
-  clear_has_top_y();
+inline uint32_t TopAndBottom::top_y() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TopAndBottom.top_y)
+  return _internal_top_y();
 }
-inline ::google::protobuf::uint32 TopAndBottom::top_y() const {
-  return top_y_;
+inline void TopAndBottom::_internal_set_top_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.top_y_ = value;
 }
-inline void TopAndBottom::set_top_y(::google::protobuf::uint32 value) {
-  set_has_top_y();
-  top_y_ = value;
+inline void TopAndBottom::set_top_y(uint32_t value) {
+  _internal_set_top_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TopAndBottom.top_y)
 }
 
 // required uint32 bottom_y = 2;
+inline bool TopAndBottom::_internal_has_bottom_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TopAndBottom::has_bottom_y() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_bottom_y();
 }
-inline void TopAndBottom::set_has_bottom_y() {
-  _has_bits_[0] |= 0x00000002u;
+inline void TopAndBottom::clear_bottom_y() {
+  _impl_.bottom_y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void TopAndBottom::clear_has_bottom_y() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint32_t TopAndBottom::_internal_bottom_y() const {
+  return _impl_.bottom_y_;
 }
-inline void TopAndBottom::clear_bottom_y() {
-  bottom_y_ = 0u;
-  clear_has_bottom_y();
+inline uint32_t TopAndBottom::bottom_y() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TopAndBottom.bottom_y)
+  return _internal_bottom_y();
 }
-inline ::google::protobuf::uint32 TopAndBottom::bottom_y() const {
-  return bottom_y_;
+inline void TopAndBottom::_internal_set_bottom_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.bottom_y_ = value;
 }
-inline void TopAndBottom::set_bottom_y(::google::protobuf::uint32 value) {
-  set_has_bottom_y();
-  bottom_y_ = value;
+inline void TopAndBottom::set_bottom_y(uint32_t value) {
+  _internal_set_bottom_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TopAndBottom.bottom_y)
 }
 
 // -------------------------------------------------------------------
@@ -268,44 +472,56 @@ inline void TopAndBottom::set_bottom_y(::google::protobuf::uint32 value) {
 // GroundTopAndBottom
 
 // repeated .doppia_protobuf.TopAndBottom top_and_bottom = 1;
+inline int GroundTopAndBottom::_internal_top_and_bottom_size() const {
+  return _impl_.top_and_bottom_.size();
+}
 inline int GroundTopAndBottom::top_and_bottom_size() const {
-  return top_and_bottom_.size();
+  return _internal_top_and_bottom_size();
 }
 inline void GroundTopAndBottom::clear_top_and_bottom() {
-  top_and_bottom_.Clear();
+  _impl_.top_and_bottom_.Clear();
+}
+inline ::doppia_protobuf::TopAndBottom* GroundTopAndBottom::mutable_top_and_bottom(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.GroundTopAndBottom.top_and_bottom)
+  return _impl_.top_and_bottom_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >*
+GroundTopAndBottom::mutable_top_and_bottom() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.GroundTopAndBottom.top_and_bottom)
+  return &_impl_.top_and_bottom_;
+}
+inline const ::doppia_protobuf::TopAndBottom& GroundTopAndBottom::_internal_top_and_bottom(int index) const {
+  return _impl_.top_and_bottom_.Get(index);
 }
 inline const ::doppia_protobuf::TopAndBottom& GroundTopAndBottom::top_and_bottom(int index) const {
-  return top_and_bottom_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.GroundTopAndBottom.top_and_bottom)
+  return _internal_top_and_bottom(index);
 }
-inline ::doppia_protobuf::TopAndBottom* GroundTopAndBottom::mutable_top_and_bottom(int index) {
-  return top_and_bottom_.Mutable(index);
+inline ::doppia_protobuf::TopAndBottom* GroundTopAndBottom::_internal_add_top_and_bottom() {
+  return _impl_.top_and_bottom_.Add();
 }
 inline ::doppia_protobuf::TopAndBottom* GroundTopAndBottom::add_top_and_bottom() {
-  return top_and_bottom_.Add();
+  ::doppia_protobuf::TopAndBottom* _add = _internal_add_top_and_bottom();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.GroundTopAndBottom.top_and_bottom)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >&
 GroundTopAndBottom::top_and_bottom() const {
-  return top_and_bottom_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::TopAndBottom >*
-GroundTopAndBottom::mutable_top_and_bottom() {
-  return &top_and_bottom_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.GroundTopAndBottom.top_and_bottom)
+  return _impl_.top_and_bottom_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_ground_5ftop_5fand_5fbottom_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_ground_5ftop_5fand_5fbottom_2eproto
@@ -1,157 +1,163 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: stixels.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "stixels.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Stixel_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Stixel_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Stixel_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Stixels_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Stixels_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_stixels_2eproto() {
-  protobuf_AddDesc_stixels_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "stixels.proto");
-  GOOGLE_CHECK(file != NULL);
-  Stixel_descriptor_ = file->message_type(0);
-  static const int Stixel_offsets_[9] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, width_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, bottom_y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, top_y_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, disparity_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, backward_delta_x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, valid_delta_x_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, backward_width_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR Stixel::Stixel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.width_)*/0u
+  , /*decltype(_impl_.x_)*/0u
+  , /*decltype(_impl_.bottom_y_)*/0u
+  , /*decltype(_impl_.top_y_)*/0u
+  , /*decltype(_impl_.disparity_)*/0u
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_.backward_delta_x_)*/0
+  , /*decltype(_impl_.valid_delta_x_)*/false
+  , /*decltype(_impl_.backward_width_)*/1} {}
+struct StixelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StixelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StixelDefaultTypeInternal() {}
+  union {
+    Stixel _instance;
   };
-  Stixel_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Stixel_descriptor_,
-      Stixel::default_instance_,
-      Stixel_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixel, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Stixel));
-  Stixel_Type_descriptor_ = Stixel_descriptor_->enum_type(0);
-  Stixels_descriptor_ = file->message_type(1);
-  static const int Stixels_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, image_name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, stixels_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, ground_top_and_bottom_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, ground_plane_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StixelDefaultTypeInternal _Stixel_default_instance_;
+PROTOBUF_CONSTEXPR Stixels::Stixels(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.stixels_)*/{}
+  , /*decltype(_impl_.image_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ground_top_and_bottom_)*/nullptr
+  , /*decltype(_impl_.ground_plane_)*/nullptr} {}
+struct StixelsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StixelsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StixelsDefaultTypeInternal() {}
+  union {
+    Stixels _instance;
   };
-  Stixels_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Stixels_descriptor_,
-      Stixels::default_instance_,
-      Stixels_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Stixels, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Stixels));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_stixels_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Stixel_descriptor_, &Stixel::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Stixels_descriptor_, &Stixels::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_stixels_2eproto() {
-  delete Stixel::default_instance_;
-  delete Stixel_reflection_;
-  delete Stixels::default_instance_;
-  delete Stixels_reflection_;
-}
-
-void protobuf_AddDesc_stixels_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::doppia_protobuf::protobuf_AddDesc_ground_5ftop_5fand_5fbottom_2eproto();
-  ::doppia_protobuf::protobuf_AddDesc_plane3d_2eproto();
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\rstixels.proto\022\017doppia_protobuf\032\033ground"
-    "_top_and_bottom.proto\032\rplane3d.proto\"\246\002\n"
-    "\006Stixel\022\r\n\005width\030\001 \002(\r\022\t\n\001x\030\002 \002(\r\022\020\n\010bot"
-    "tom_y\030\003 \002(\r\022\r\n\005top_y\030\004 \002(\r\022\021\n\tdisparity\030"
-    "\005 \002(\r\022*\n\004type\030\006 \002(\0162\034.doppia_protobuf.St"
-    "ixel.Type\022\033\n\020backward_delta_x\030\007 \001(\005:\0010\022\034"
-    "\n\rvalid_delta_x\030\010 \001(\010:\005false\022\031\n\016backward"
-    "_width\030\t \001(\005:\0011\"L\n\004Type\022\013\n\007Unknown\020\000\022\014\n\010"
-    "Occluded\020\001\022\007\n\003Car\020\002\022\016\n\nPedestrian\020\003\022\020\n\014S"
-    "taticObject\020\004\"\273\001\n\007Stixels\022\022\n\nimage_name\030"
-    "\001 \001(\t\022(\n\007stixels\030\002 \003(\0132\027.doppia_protobuf"
-    ".Stixel\022B\n\025ground_top_and_bottom\030\003 \001(\0132#"
-    ".doppia_protobuf.GroundTopAndBottom\022.\n\014g"
-    "round_plane\030\004 \001(\0132\030.doppia_protobuf.Plan"
-    "e3d", 563);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "stixels.proto", &protobuf_RegisterTypes);
-  Stixel::default_instance_ = new Stixel();
-  Stixels::default_instance_ = new Stixels();
-  Stixel::default_instance_->InitAsDefaultInstance();
-  Stixels::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_stixels_2eproto);
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StixelsDefaultTypeInternal _Stixels_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_stixels_2eproto[2];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_stixels_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_stixels_2eproto = nullptr;
+
+const uint32_t TableStruct_stixels_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.bottom_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.top_y_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.disparity_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.backward_delta_x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.valid_delta_x_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixel, _impl_.backward_width_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _impl_.image_name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _impl_.stixels_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _impl_.ground_top_and_bottom_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Stixels, _impl_.ground_plane_),
+  0,
+  ~0u,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::doppia_protobuf::Stixel)},
+  { 24, 34, -1, sizeof(::doppia_protobuf::Stixels)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_Stixel_default_instance_._instance,
+  &::doppia_protobuf::_Stixels_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_stixels_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rstixels.proto\022\017doppia_protobuf\032\033ground"
+  "_top_and_bottom.proto\032\rplane3d.proto\"\246\002\n"
+  "\006Stixel\022\r\n\005width\030\001 \002(\r\022\t\n\001x\030\002 \002(\r\022\020\n\010bot"
+  "tom_y\030\003 \002(\r\022\r\n\005top_y\030\004 \002(\r\022\021\n\tdisparity\030"
+  "\005 \002(\r\022*\n\004type\030\006 \002(\0162\034.doppia_protobuf.St"
+  "ixel.Type\022\033\n\020backward_delta_x\030\007 \001(\005:\0010\022\034"
+  "\n\rvalid_delta_x\030\010 \001(\010:\005false\022\031\n\016backward"
+  "_width\030\t \001(\005:\0011\"L\n\004Type\022\013\n\007Unknown\020\000\022\014\n\010"
+  "Occluded\020\001\022\007\n\003Car\020\002\022\016\n\nPedestrian\020\003\022\020\n\014S"
+  "taticObject\020\004\"\273\001\n\007Stixels\022\022\n\nimage_name\030"
+  "\001 \001(\t\022(\n\007stixels\030\002 \003(\0132\027.doppia_protobuf"
+  ".Stixel\022B\n\025ground_top_and_bottom\030\003 \001(\0132#"
+  ".doppia_protobuf.GroundTopAndBottom\022.\n\014g"
+  "round_plane\030\004 \001(\0132\030.doppia_protobuf.Plan"
+  "e3d"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_stixels_2eproto_deps[2] = {
+  &::descriptor_table_ground_5ftop_5fand_5fbottom_2eproto,
+  &::descriptor_table_plane3d_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_stixels_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_stixels_2eproto = {
+    false, false, 563, descriptor_table_protodef_stixels_2eproto,
+    "stixels.proto",
+    &descriptor_table_stixels_2eproto_once, descriptor_table_stixels_2eproto_deps, 2, 2,
+    schemas, file_default_instances, TableStruct_stixels_2eproto::offsets,
+    file_level_metadata_stixels_2eproto, file_level_enum_descriptors_stixels_2eproto,
+    file_level_service_descriptors_stixels_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_stixels_2eproto_getter() {
+  return &descriptor_table_stixels_2eproto;
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_stixels_2eproto {
-  StaticDescriptorInitializer_stixels_2eproto() {
-    protobuf_AddDesc_stixels_2eproto();
-  }
-} static_descriptor_initializer_stixels_2eproto_;
-
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Stixel_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Stixel_Type_descriptor_;
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_stixels_2eproto(&descriptor_table_stixels_2eproto);
+namespace doppia_protobuf {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Stixel_Type_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_stixels_2eproto);
+  return file_level_enum_descriptors_stixels_2eproto[0];
 }
 bool Stixel_Type_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
@@ -163,917 +169,874 @@ bool Stixel_Type_IsValid(int value) {
   }
 }
 
-#ifndef _MSC_VER
-const Stixel_Type Stixel::Unknown;
-const Stixel_Type Stixel::Occluded;
-const Stixel_Type Stixel::Car;
-const Stixel_Type Stixel::Pedestrian;
-const Stixel_Type Stixel::StaticObject;
-const Stixel_Type Stixel::Type_MIN;
-const Stixel_Type Stixel::Type_MAX;
-const int Stixel::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Stixel::kWidthFieldNumber;
-const int Stixel::kXFieldNumber;
-const int Stixel::kBottomYFieldNumber;
-const int Stixel::kTopYFieldNumber;
-const int Stixel::kDisparityFieldNumber;
-const int Stixel::kTypeFieldNumber;
-const int Stixel::kBackwardDeltaXFieldNumber;
-const int Stixel::kValidDeltaXFieldNumber;
-const int Stixel::kBackwardWidthFieldNumber;
-#endif  // !_MSC_VER
-
-Stixel::Stixel()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Stixel_Type Stixel::Unknown;
+constexpr Stixel_Type Stixel::Occluded;
+constexpr Stixel_Type Stixel::Car;
+constexpr Stixel_Type Stixel::Pedestrian;
+constexpr Stixel_Type Stixel::StaticObject;
+constexpr Stixel_Type Stixel::Type_MIN;
+constexpr Stixel_Type Stixel::Type_MAX;
+constexpr int Stixel::Type_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-void Stixel::InitAsDefaultInstance() {
-}
+// ===================================================================
+
+class Stixel::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Stixel>()._impl_._has_bits_);
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_bottom_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_top_y(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_disparity(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_backward_delta_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_valid_delta_x(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_backward_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
 
+Stixel::Stixel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Stixel)
+}
 Stixel::Stixel(const Stixel& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stixel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.x_){}
+    , decltype(_impl_.bottom_y_){}
+    , decltype(_impl_.top_y_){}
+    , decltype(_impl_.disparity_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.backward_delta_x_){}
+    , decltype(_impl_.valid_delta_x_){}
+    , decltype(_impl_.backward_width_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.backward_width_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.backward_width_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Stixel)
 }
 
-void Stixel::SharedCtor() {
-  _cached_size_ = 0;
-  width_ = 0u;
-  x_ = 0u;
-  bottom_y_ = 0u;
-  top_y_ = 0u;
-  disparity_ = 0u;
-  type_ = 0;
-  backward_delta_x_ = 0;
-  valid_delta_x_ = false;
-  backward_width_ = 1;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void Stixel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.width_){0u}
+    , decltype(_impl_.x_){0u}
+    , decltype(_impl_.bottom_y_){0u}
+    , decltype(_impl_.top_y_){0u}
+    , decltype(_impl_.disparity_){0u}
+    , decltype(_impl_.type_){0}
+    , decltype(_impl_.backward_delta_x_){0}
+    , decltype(_impl_.valid_delta_x_){false}
+    , decltype(_impl_.backward_width_){1}
+  };
 }
 
 Stixel::~Stixel() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Stixel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Stixel::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void Stixel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void Stixel::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Stixel::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Stixel_descriptor_;
-}
-
-const Stixel& Stixel::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_stixels_2eproto();  return *default_instance_;
-}
-
-Stixel* Stixel::default_instance_ = NULL;
-
-Stixel* Stixel::New() const {
-  return new Stixel;
+  _impl_._cached_size_.Set(size);
 }
 
 void Stixel::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    width_ = 0u;
-    x_ = 0u;
-    bottom_y_ = 0u;
-    top_y_ = 0u;
-    disparity_ = 0u;
-    type_ = 0;
-    backward_delta_x_ = 0;
-    valid_delta_x_ = false;
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Stixel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.valid_delta_x_) -
+        reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.valid_delta_x_));
   }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    backward_width_ = 1;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_.backward_width_ = 1;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Stixel::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Stixel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint32 width = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &width_)));
-          set_has_width();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_x;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 x = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_x:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &x_)));
-          set_has_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_bottom_y;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_x(&has_bits);
+          _impl_.x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 bottom_y = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_bottom_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &bottom_y_)));
-          set_has_bottom_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_top_y;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_bottom_y(&has_bits);
+          _impl_.bottom_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 top_y = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_top_y:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &top_y_)));
-          set_has_top_y();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(40)) goto parse_disparity;
-        break;
-      }
-      
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_top_y(&has_bits);
+          _impl_.top_y_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 disparity = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_disparity:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &disparity_)));
-          set_has_disparity();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_type;
-        break;
-      }
-      
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_disparity(&has_bits);
+          _impl_.disparity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.Stixel.Type type = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::doppia_protobuf::Stixel_Type_IsValid(value)) {
-            set_type(static_cast< ::doppia_protobuf::Stixel_Type >(value));
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::doppia_protobuf::Stixel_Type_IsValid(val))) {
+            _internal_set_type(static_cast<::doppia_protobuf::Stixel_Type>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(6, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(6, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_backward_delta_x;
-        break;
-      }
-      
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 backward_delta_x = 7 [default = 0];
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_backward_delta_x:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &backward_delta_x_)));
-          set_has_backward_delta_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_valid_delta_x;
-        break;
-      }
-      
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_backward_delta_x(&has_bits);
+          _impl_.backward_delta_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional bool valid_delta_x = 8 [default = false];
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_valid_delta_x:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &valid_delta_x_)));
-          set_has_valid_delta_x();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(72)) goto parse_backward_width;
-        break;
-      }
-      
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_valid_delta_x(&has_bits);
+          _impl_.valid_delta_x_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional int32 backward_width = 9 [default = 1];
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_backward_width:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &backward_width_)));
-          set_has_backward_width();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_backward_width(&has_bits);
+          _impl_.backward_width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Stixel::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+uint8_t* Stixel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Stixel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint32 width = 1;
-  if (has_width()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->width(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_width(), target);
   }
-  
+
   // required uint32 x = 2;
-  if (has_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->x(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_x(), target);
   }
-  
+
   // required uint32 bottom_y = 3;
-  if (has_bottom_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(3, this->bottom_y(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_bottom_y(), target);
   }
-  
+
   // required uint32 top_y = 4;
-  if (has_top_y()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->top_y(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_top_y(), target);
   }
-  
+
   // required uint32 disparity = 5;
-  if (has_disparity()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(5, this->disparity(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_disparity(), target);
   }
-  
+
   // required .doppia_protobuf.Stixel.Type type = 6;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      6, this->type(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_type(), target);
   }
-  
+
   // optional int32 backward_delta_x = 7 [default = 0];
-  if (has_backward_delta_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(7, this->backward_delta_x(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(7, this->_internal_backward_delta_x(), target);
   }
-  
+
   // optional bool valid_delta_x = 8 [default = false];
-  if (has_valid_delta_x()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(8, this->valid_delta_x(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_valid_delta_x(), target);
   }
-  
+
   // optional int32 backward_width = 9 [default = 1];
-  if (has_backward_width()) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(9, this->backward_width(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_backward_width(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Stixel)
+  return target;
 }
 
-::google::protobuf::uint8* Stixel::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 width = 1;
-  if (has_width()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->width(), target);
-  }
-  
-  // required uint32 x = 2;
-  if (has_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->x(), target);
-  }
-  
-  // required uint32 bottom_y = 3;
-  if (has_bottom_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(3, this->bottom_y(), target);
-  }
-  
-  // required uint32 top_y = 4;
-  if (has_top_y()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->top_y(), target);
-  }
-  
-  // required uint32 disparity = 5;
-  if (has_disparity()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(5, this->disparity(), target);
+size_t Stixel::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Stixel)
+  size_t total_size = 0;
+
+  if (_internal_has_width()) {
+    // required uint32 width = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
   }
-  
-  // required .doppia_protobuf.Stixel.Type type = 6;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      6, this->type(), target);
+
+  if (_internal_has_x()) {
+    // required uint32 x = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x());
   }
-  
-  // optional int32 backward_delta_x = 7 [default = 0];
-  if (has_backward_delta_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(7, this->backward_delta_x(), target);
+
+  if (_internal_has_bottom_y()) {
+    // required uint32 bottom_y = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_y());
   }
-  
-  // optional bool valid_delta_x = 8 [default = false];
-  if (has_valid_delta_x()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(8, this->valid_delta_x(), target);
+
+  if (_internal_has_top_y()) {
+    // required uint32 top_y = 4;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_y());
   }
-  
-  // optional int32 backward_width = 9 [default = 1];
-  if (has_backward_width()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(9, this->backward_width(), target);
+
+  if (_internal_has_disparity()) {
+    // required uint32 disparity = 5;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_disparity());
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_type()) {
+    // required .doppia_protobuf.Stixel.Type type = 6;
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
-  return target;
+
+  return total_size;
 }
+size_t Stixel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Stixel)
+  size_t total_size = 0;
 
-int Stixel::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
     // required uint32 width = 1;
-    if (has_width()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->width());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_width());
+
     // required uint32 x = 2;
-    if (has_x()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->x());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_x());
+
     // required uint32 bottom_y = 3;
-    if (has_bottom_y()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->bottom_y());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bottom_y());
+
     // required uint32 top_y = 4;
-    if (has_top_y()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->top_y());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_top_y());
+
     // required uint32 disparity = 5;
-    if (has_disparity()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->disparity());
-    }
-    
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_disparity());
+
     // required .doppia_protobuf.Stixel.Type type = 6;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-    
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000c0u) {
     // optional int32 backward_delta_x = 7 [default = 0];
-    if (has_backward_delta_x()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->backward_delta_x());
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_backward_delta_x());
     }
-    
+
     // optional bool valid_delta_x = 8 [default = false];
-    if (has_valid_delta_x()) {
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 + 1;
     }
-    
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional int32 backward_width = 9 [default = 1];
-    if (has_backward_width()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->backward_width());
-    }
-    
+
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  // optional int32 backward_width = 9 [default = 1];
+  if (cached_has_bits & 0x00000100u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_backward_width());
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Stixel::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Stixel* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Stixel*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Stixel::MergeFrom(const Stixel& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_width()) {
-      set_width(from.width());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stixel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stixel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stixel::GetClassData() const { return &_class_data_; }
+
+
+void Stixel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stixel*>(&to_msg);
+  auto& from = static_cast<const Stixel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Stixel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.width_ = from._impl_.width_;
     }
-    if (from.has_x()) {
-      set_x(from.x());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.x_ = from._impl_.x_;
     }
-    if (from.has_bottom_y()) {
-      set_bottom_y(from.bottom_y());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.bottom_y_ = from._impl_.bottom_y_;
     }
-    if (from.has_top_y()) {
-      set_top_y(from.top_y());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.top_y_ = from._impl_.top_y_;
     }
-    if (from.has_disparity()) {
-      set_disparity(from.disparity());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.disparity_ = from._impl_.disparity_;
     }
-    if (from.has_type()) {
-      set_type(from.type());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.type_ = from._impl_.type_;
     }
-    if (from.has_backward_delta_x()) {
-      set_backward_delta_x(from.backward_delta_x());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.backward_delta_x_ = from._impl_.backward_delta_x_;
     }
-    if (from.has_valid_delta_x()) {
-      set_valid_delta_x(from.valid_delta_x());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.valid_delta_x_ = from._impl_.valid_delta_x_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_backward_width()) {
-      set_backward_width(from.backward_width());
-    }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_backward_width(from._internal_backward_width());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Stixel::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Stixel::CopyFrom(const Stixel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Stixel)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Stixel::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000003f) != 0x0000003f) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Stixel::Swap(Stixel* other) {
-  if (other != this) {
-    std::swap(width_, other->width_);
-    std::swap(x_, other->x_);
-    std::swap(bottom_y_, other->bottom_y_);
-    std::swap(top_y_, other->top_y_);
-    std::swap(disparity_, other->disparity_);
-    std::swap(type_, other->type_);
-    std::swap(backward_delta_x_, other->backward_delta_x_);
-    std::swap(valid_delta_x_, other->valid_delta_x_);
-    std::swap(backward_width_, other->backward_width_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Stixel::InternalSwap(Stixel* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stixel, _impl_.valid_delta_x_)
+      + sizeof(Stixel::_impl_.valid_delta_x_)
+      - PROTOBUF_FIELD_OFFSET(Stixel, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
+  swap(_impl_.backward_width_, other->_impl_.backward_width_);
 }
 
-::google::protobuf::Metadata Stixel::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Stixel_descriptor_;
-  metadata.reflection = Stixel_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Stixel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_stixels_2eproto_getter, &descriptor_table_stixels_2eproto_once,
+      file_level_metadata_stixels_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Stixels::kImageNameFieldNumber;
-const int Stixels::kStixelsFieldNumber;
-const int Stixels::kGroundTopAndBottomFieldNumber;
-const int Stixels::kGroundPlaneFieldNumber;
-#endif  // !_MSC_VER
+class Stixels::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Stixels>()._impl_._has_bits_);
+  static void set_has_image_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::GroundTopAndBottom& ground_top_and_bottom(const Stixels* msg);
+  static void set_has_ground_top_and_bottom(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::Plane3d& ground_plane(const Stixels* msg);
+  static void set_has_ground_plane(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
 
-Stixels::Stixels()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::GroundTopAndBottom&
+Stixels::_Internal::ground_top_and_bottom(const Stixels* msg) {
+  return *msg->_impl_.ground_top_and_bottom_;
 }
-
-void Stixels::InitAsDefaultInstance() {
-  ground_top_and_bottom_ = const_cast< ::doppia_protobuf::GroundTopAndBottom*>(&::doppia_protobuf::GroundTopAndBottom::default_instance());
-  ground_plane_ = const_cast< ::doppia_protobuf::Plane3d*>(&::doppia_protobuf::Plane3d::default_instance());
+const ::doppia_protobuf::Plane3d&
+Stixels::_Internal::ground_plane(const Stixels* msg) {
+  return *msg->_impl_.ground_plane_;
 }
-
-Stixels::Stixels(const Stixels& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+void Stixels::clear_ground_top_and_bottom() {
+  if (_impl_.ground_top_and_bottom_ != nullptr) _impl_.ground_top_and_bottom_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-
-void Stixels::SharedCtor() {
-  _cached_size_ = 0;
-  image_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ground_top_and_bottom_ = NULL;
-  ground_plane_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+void Stixels::clear_ground_plane() {
+  if (_impl_.ground_plane_ != nullptr) _impl_.ground_plane_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-
-Stixels::~Stixels() {
-  SharedDtor();
+Stixels::Stixels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Stixels)
 }
-
-void Stixels::SharedDtor() {
-  if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-    delete image_name_;
+Stixels::Stixels(const Stixels& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stixels* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stixels_){from._impl_.stixels_}
+    , decltype(_impl_.image_name_){}
+    , decltype(_impl_.ground_top_and_bottom_){nullptr}
+    , decltype(_impl_.ground_plane_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.image_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_image_name()) {
+    _this->_impl_.image_name_.Set(from._internal_image_name(), 
+      _this->GetArenaForAllocation());
   }
-  if (this != default_instance_) {
-    delete ground_top_and_bottom_;
-    delete ground_plane_;
+  if (from._internal_has_ground_top_and_bottom()) {
+    _this->_impl_.ground_top_and_bottom_ = new ::doppia_protobuf::GroundTopAndBottom(*from._impl_.ground_top_and_bottom_);
   }
+  if (from._internal_has_ground_plane()) {
+    _this->_impl_.ground_plane_ = new ::doppia_protobuf::Plane3d(*from._impl_.ground_plane_);
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Stixels)
 }
 
-void Stixels::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Stixels::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Stixels_descriptor_;
+inline void Stixels::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.stixels_){arena}
+    , decltype(_impl_.image_name_){}
+    , decltype(_impl_.ground_top_and_bottom_){nullptr}
+    , decltype(_impl_.ground_plane_){nullptr}
+  };
+  _impl_.image_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.image_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Stixels& Stixels::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_stixels_2eproto();  return *default_instance_;
+Stixels::~Stixels() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Stixels)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Stixels* Stixels::default_instance_ = NULL;
+inline void Stixels::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stixels_.~RepeatedPtrField();
+  _impl_.image_name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.ground_top_and_bottom_;
+  if (this != internal_default_instance()) delete _impl_.ground_plane_;
+}
 
-Stixels* Stixels::New() const {
-  return new Stixels;
+void Stixels::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Stixels::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_image_name()) {
-      if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-        image_name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Stixels)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stixels_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.image_name_.ClearNonDefaultToEmpty();
     }
-    if (has_ground_top_and_bottom()) {
-      if (ground_top_and_bottom_ != NULL) ground_top_and_bottom_->::doppia_protobuf::GroundTopAndBottom::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.ground_top_and_bottom_ != nullptr);
+      _impl_.ground_top_and_bottom_->Clear();
     }
-    if (has_ground_plane()) {
-      if (ground_plane_ != NULL) ground_plane_->::doppia_protobuf::Plane3d::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.ground_plane_ != nullptr);
+      _impl_.ground_plane_->Clear();
     }
   }
-  stixels_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Stixels::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Stixels::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string image_name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_image_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->image_name().data(), this->image_name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_stixels;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_image_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.Stixels.image_name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .doppia_protobuf.Stixel stixels = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_stixels:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_stixels()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_stixels;
-        if (input->ExpectTag(26)) goto parse_ground_top_and_bottom;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stixels(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ground_top_and_bottom:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_ground_top_and_bottom()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_ground_plane;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ground_top_and_bottom(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.Plane3d ground_plane = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_ground_plane:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_ground_plane()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ground_plane(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void Stixels::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+uint8_t* Stixels::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Stixels)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string image_name = 1;
-  if (has_image_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->image_name().data(), this->image_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->image_name(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_image_name().data(), static_cast<int>(this->_internal_image_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.Stixels.image_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_image_name(), target);
   }
-  
+
   // repeated .doppia_protobuf.Stixel stixels = 2;
-  for (int i = 0; i < this->stixels_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->stixels(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stixels_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stixels(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-  if (has_ground_top_and_bottom()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->ground_top_and_bottom(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::ground_top_and_bottom(this),
+        _Internal::ground_top_and_bottom(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.Plane3d ground_plane = 4;
-  if (has_ground_plane()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->ground_plane(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::ground_plane(this),
+        _Internal::ground_plane(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Stixels)
+  return target;
 }
 
-::google::protobuf::uint8* Stixels::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string image_name = 1;
-  if (has_image_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->image_name().data(), this->image_name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->image_name(), target);
-  }
-  
+size_t Stixels::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Stixels)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
   // repeated .doppia_protobuf.Stixel stixels = 2;
-  for (int i = 0; i < this->stixels_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->stixels(i), target);
-  }
-  
-  // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-  if (has_ground_top_and_bottom()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->ground_top_and_bottom(), target);
-  }
-  
-  // optional .doppia_protobuf.Plane3d ground_plane = 4;
-  if (has_ground_plane()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->ground_plane(), target);
-  }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  total_size += 1UL * this->_internal_stixels_size();
+  for (const auto& msg : this->_impl_.stixels_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
-  return target;
-}
 
-int Stixels::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
     // optional string image_name = 1;
-    if (has_image_name()) {
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->image_name());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_image_name());
     }
-    
+
     // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-    if (has_ground_top_and_bottom()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->ground_top_and_bottom());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ground_top_and_bottom_);
     }
-    
+
     // optional .doppia_protobuf.Plane3d ground_plane = 4;
-    if (has_ground_plane()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->ground_plane());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.ground_plane_);
     }
-    
-  }
-  // repeated .doppia_protobuf.Stixel stixels = 2;
-  total_size += 1 * this->stixels_size();
-  for (int i = 0; i < this->stixels_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->stixels(i));
-  }
-  
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Stixels::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Stixels* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Stixels*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Stixels::MergeFrom(const Stixels& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  stixels_.MergeFrom(from.stixels_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_image_name()) {
-      set_image_name(from.image_name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stixels::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stixels::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stixels::GetClassData() const { return &_class_data_; }
+
+
+void Stixels::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stixels*>(&to_msg);
+  auto& from = static_cast<const Stixels&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Stixels)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stixels_.MergeFrom(from._impl_.stixels_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_image_name(from._internal_image_name());
     }
-    if (from.has_ground_top_and_bottom()) {
-      mutable_ground_top_and_bottom()->::doppia_protobuf::GroundTopAndBottom::MergeFrom(from.ground_top_and_bottom());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_ground_top_and_bottom()->::doppia_protobuf::GroundTopAndBottom::MergeFrom(
+          from._internal_ground_top_and_bottom());
     }
-    if (from.has_ground_plane()) {
-      mutable_ground_plane()->::doppia_protobuf::Plane3d::MergeFrom(from.ground_plane());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_ground_plane()->::doppia_protobuf::Plane3d::MergeFrom(
+          from._internal_ground_plane());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Stixels::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Stixels::CopyFrom(const Stixels& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Stixels)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Stixels::IsInitialized() const {
-  
-  for (int i = 0; i < stixels_size(); i++) {
-    if (!this->stixels(i).IsInitialized()) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.stixels_))
+    return false;
+  if (_internal_has_ground_top_and_bottom()) {
+    if (!_impl_.ground_top_and_bottom_->IsInitialized()) return false;
   }
-  if (has_ground_top_and_bottom()) {
-    if (!this->ground_top_and_bottom().IsInitialized()) return false;
-  }
-  if (has_ground_plane()) {
-    if (!this->ground_plane().IsInitialized()) return false;
+  if (_internal_has_ground_plane()) {
+    if (!_impl_.ground_plane_->IsInitialized()) return false;
   }
   return true;
 }
 
-void Stixels::Swap(Stixels* other) {
-  if (other != this) {
-    std::swap(image_name_, other->image_name_);
-    stixels_.Swap(&other->stixels_);
-    std::swap(ground_top_and_bottom_, other->ground_top_and_bottom_);
-    std::swap(ground_plane_, other->ground_plane_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Stixels::InternalSwap(Stixels* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.stixels_.InternalSwap(&other->_impl_.stixels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.image_name_, lhs_arena,
+      &other->_impl_.image_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Stixels, _impl_.ground_plane_)
+      + sizeof(Stixels::_impl_.ground_plane_)
+      - PROTOBUF_FIELD_OFFSET(Stixels, _impl_.ground_top_and_bottom_)>(
+          reinterpret_cast<char*>(&_impl_.ground_top_and_bottom_),
+          reinterpret_cast<char*>(&other->_impl_.ground_top_and_bottom_));
 }
 
-::google::protobuf::Metadata Stixels::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Stixels_descriptor_;
-  metadata.reflection = Stixels_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Stixels::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_stixels_2eproto_getter, &descriptor_table_stixels_2eproto_once,
+      file_level_metadata_stixels_2eproto[1]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Stixel*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Stixel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Stixel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Stixels*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Stixels >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Stixels >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,43 +1,67 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: stixels.proto
 
-#ifndef PROTOBUF_stixels_2eproto__INCLUDED
-#define PROTOBUF_stixels_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_stixels_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_stixels_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
 #include "ground_top_and_bottom.pb.h"
 #include "../ground_plane/plane3d.pb.h"
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_stixels_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_stixels_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_stixels_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_stixels_2eproto();
-void protobuf_AssignDesc_stixels_2eproto();
-void protobuf_ShutdownFile_stixels_2eproto();
-
 class Stixel;
+struct StixelDefaultTypeInternal;
+extern StixelDefaultTypeInternal _Stixel_default_instance_;
 class Stixels;
+struct StixelsDefaultTypeInternal;
+extern StixelsDefaultTypeInternal _Stixels_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::Stixel* Arena::CreateMaybeMessage<::doppia_protobuf::Stixel>(Arena*);
+template<> ::doppia_protobuf::Stixels* Arena::CreateMaybeMessage<::doppia_protobuf::Stixels>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
-enum Stixel_Type {
+enum Stixel_Type : int {
   Stixel_Type_Unknown = 0,
   Stixel_Type_Occluded = 1,
   Stixel_Type_Car = 2,
@@ -45,534 +69,830 @@ enum Stixel_Type {
   Stixel_Type_StaticObject = 4
 };
 bool Stixel_Type_IsValid(int value);
-const Stixel_Type Stixel_Type_Type_MIN = Stixel_Type_Unknown;
-const Stixel_Type Stixel_Type_Type_MAX = Stixel_Type_StaticObject;
-const int Stixel_Type_Type_ARRAYSIZE = Stixel_Type_Type_MAX + 1;
+constexpr Stixel_Type Stixel_Type_Type_MIN = Stixel_Type_Unknown;
+constexpr Stixel_Type Stixel_Type_Type_MAX = Stixel_Type_StaticObject;
+constexpr int Stixel_Type_Type_ARRAYSIZE = Stixel_Type_Type_MAX + 1;
 
-const ::google::protobuf::EnumDescriptor* Stixel_Type_descriptor();
-inline const ::std::string& Stixel_Type_Name(Stixel_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Stixel_Type_descriptor(), value);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Stixel_Type_descriptor();
+template<typename T>
+inline const std::string& Stixel_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Stixel_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Stixel_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Stixel_Type_descriptor(), enum_t_value);
 }
 inline bool Stixel_Type_Parse(
-    const ::std::string& name, Stixel_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Stixel_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Stixel_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Stixel_Type>(
     Stixel_Type_descriptor(), name, value);
 }
 // ===================================================================
 
-class Stixel : public ::google::protobuf::Message {
+class Stixel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Stixel) */ {
  public:
-  Stixel();
-  virtual ~Stixel();
-  
+  inline Stixel() : Stixel(nullptr) {}
+  ~Stixel() override;
+  explicit PROTOBUF_CONSTEXPR Stixel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Stixel(const Stixel& from);
-  
+  Stixel(Stixel&& from) noexcept
+    : Stixel() {
+    *this = ::std::move(from);
+  }
+
   inline Stixel& operator=(const Stixel& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Stixel& operator=(Stixel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stixel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stixel* internal_default_instance() {
+    return reinterpret_cast<const Stixel*>(
+               &_Stixel_default_instance_);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Stixel& a, Stixel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stixel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stixel& default_instance();
-  
-  void Swap(Stixel* other);
-  
+  void UnsafeArenaSwap(Stixel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Stixel* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Stixel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stixel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Stixel& from);
-  void MergeFrom(const Stixel& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stixel& from) {
+    Stixel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stixel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Stixel";
+  }
+  protected:
+  explicit Stixel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   typedef Stixel_Type Type;
-  static const Type Unknown = Stixel_Type_Unknown;
-  static const Type Occluded = Stixel_Type_Occluded;
-  static const Type Car = Stixel_Type_Car;
-  static const Type Pedestrian = Stixel_Type_Pedestrian;
-  static const Type StaticObject = Stixel_Type_StaticObject;
+  static constexpr Type Unknown =
+    Stixel_Type_Unknown;
+  static constexpr Type Occluded =
+    Stixel_Type_Occluded;
+  static constexpr Type Car =
+    Stixel_Type_Car;
+  static constexpr Type Pedestrian =
+    Stixel_Type_Pedestrian;
+  static constexpr Type StaticObject =
+    Stixel_Type_StaticObject;
   static inline bool Type_IsValid(int value) {
     return Stixel_Type_IsValid(value);
   }
-  static const Type Type_MIN =
+  static constexpr Type Type_MIN =
     Stixel_Type_Type_MIN;
-  static const Type Type_MAX =
+  static constexpr Type Type_MAX =
     Stixel_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
+  static constexpr int Type_ARRAYSIZE =
     Stixel_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Type_descriptor() {
     return Stixel_Type_descriptor();
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return Stixel_Type_Name(value);
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return Stixel_Type_Name(enum_t_value);
   }
-  static inline bool Type_Parse(const ::std::string& name,
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Type* value) {
     return Stixel_Type_Parse(name, value);
   }
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kWidthFieldNumber = 1,
+    kXFieldNumber = 2,
+    kBottomYFieldNumber = 3,
+    kTopYFieldNumber = 4,
+    kDisparityFieldNumber = 5,
+    kTypeFieldNumber = 6,
+    kBackwardDeltaXFieldNumber = 7,
+    kValidDeltaXFieldNumber = 8,
+    kBackwardWidthFieldNumber = 9,
+  };
   // required uint32 width = 1;
-  inline bool has_width() const;
-  inline void clear_width();
-  static const int kWidthFieldNumber = 1;
-  inline ::google::protobuf::uint32 width() const;
-  inline void set_width(::google::protobuf::uint32 value);
-  
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  uint32_t width() const;
+  void set_width(uint32_t value);
+  private:
+  uint32_t _internal_width() const;
+  void _internal_set_width(uint32_t value);
+  public:
+
   // required uint32 x = 2;
-  inline bool has_x() const;
-  inline void clear_x();
-  static const int kXFieldNumber = 2;
-  inline ::google::protobuf::uint32 x() const;
-  inline void set_x(::google::protobuf::uint32 value);
-  
+  bool has_x() const;
+  private:
+  bool _internal_has_x() const;
+  public:
+  void clear_x();
+  uint32_t x() const;
+  void set_x(uint32_t value);
+  private:
+  uint32_t _internal_x() const;
+  void _internal_set_x(uint32_t value);
+  public:
+
   // required uint32 bottom_y = 3;
-  inline bool has_bottom_y() const;
-  inline void clear_bottom_y();
-  static const int kBottomYFieldNumber = 3;
-  inline ::google::protobuf::uint32 bottom_y() const;
-  inline void set_bottom_y(::google::protobuf::uint32 value);
-  
+  bool has_bottom_y() const;
+  private:
+  bool _internal_has_bottom_y() const;
+  public:
+  void clear_bottom_y();
+  uint32_t bottom_y() const;
+  void set_bottom_y(uint32_t value);
+  private:
+  uint32_t _internal_bottom_y() const;
+  void _internal_set_bottom_y(uint32_t value);
+  public:
+
   // required uint32 top_y = 4;
-  inline bool has_top_y() const;
-  inline void clear_top_y();
-  static const int kTopYFieldNumber = 4;
-  inline ::google::protobuf::uint32 top_y() const;
-  inline void set_top_y(::google::protobuf::uint32 value);
-  
+  bool has_top_y() const;
+  private:
+  bool _internal_has_top_y() const;
+  public:
+  void clear_top_y();
+  uint32_t top_y() const;
+  void set_top_y(uint32_t value);
+  private:
+  uint32_t _internal_top_y() const;
+  void _internal_set_top_y(uint32_t value);
+  public:
+
   // required uint32 disparity = 5;
-  inline bool has_disparity() const;
-  inline void clear_disparity();
-  static const int kDisparityFieldNumber = 5;
-  inline ::google::protobuf::uint32 disparity() const;
-  inline void set_disparity(::google::protobuf::uint32 value);
-  
+  bool has_disparity() const;
+  private:
+  bool _internal_has_disparity() const;
+  public:
+  void clear_disparity();
+  uint32_t disparity() const;
+  void set_disparity(uint32_t value);
+  private:
+  uint32_t _internal_disparity() const;
+  void _internal_set_disparity(uint32_t value);
+  public:
+
   // required .doppia_protobuf.Stixel.Type type = 6;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 6;
-  inline ::doppia_protobuf::Stixel_Type type() const;
-  inline void set_type(::doppia_protobuf::Stixel_Type value);
-  
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::doppia_protobuf::Stixel_Type type() const;
+  void set_type(::doppia_protobuf::Stixel_Type value);
+  private:
+  ::doppia_protobuf::Stixel_Type _internal_type() const;
+  void _internal_set_type(::doppia_protobuf::Stixel_Type value);
+  public:
+
   // optional int32 backward_delta_x = 7 [default = 0];
-  inline bool has_backward_delta_x() const;
-  inline void clear_backward_delta_x();
-  static const int kBackwardDeltaXFieldNumber = 7;
-  inline ::google::protobuf::int32 backward_delta_x() const;
-  inline void set_backward_delta_x(::google::protobuf::int32 value);
-  
+  bool has_backward_delta_x() const;
+  private:
+  bool _internal_has_backward_delta_x() const;
+  public:
+  void clear_backward_delta_x();
+  int32_t backward_delta_x() const;
+  void set_backward_delta_x(int32_t value);
+  private:
+  int32_t _internal_backward_delta_x() const;
+  void _internal_set_backward_delta_x(int32_t value);
+  public:
+
   // optional bool valid_delta_x = 8 [default = false];
-  inline bool has_valid_delta_x() const;
-  inline void clear_valid_delta_x();
-  static const int kValidDeltaXFieldNumber = 8;
-  inline bool valid_delta_x() const;
-  inline void set_valid_delta_x(bool value);
-  
+  bool has_valid_delta_x() const;
+  private:
+  bool _internal_has_valid_delta_x() const;
+  public:
+  void clear_valid_delta_x();
+  bool valid_delta_x() const;
+  void set_valid_delta_x(bool value);
+  private:
+  bool _internal_valid_delta_x() const;
+  void _internal_set_valid_delta_x(bool value);
+  public:
+
   // optional int32 backward_width = 9 [default = 1];
-  inline bool has_backward_width() const;
-  inline void clear_backward_width();
-  static const int kBackwardWidthFieldNumber = 9;
-  inline ::google::protobuf::int32 backward_width() const;
-  inline void set_backward_width(::google::protobuf::int32 value);
-  
+  bool has_backward_width() const;
+  private:
+  bool _internal_has_backward_width() const;
+  public:
+  void clear_backward_width();
+  int32_t backward_width() const;
+  void set_backward_width(int32_t value);
+  private:
+  int32_t _internal_backward_width() const;
+  void _internal_set_backward_width(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Stixel)
  private:
-  inline void set_has_width();
-  inline void clear_has_width();
-  inline void set_has_x();
-  inline void clear_has_x();
-  inline void set_has_bottom_y();
-  inline void clear_has_bottom_y();
-  inline void set_has_top_y();
-  inline void clear_has_top_y();
-  inline void set_has_disparity();
-  inline void clear_has_disparity();
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_backward_delta_x();
-  inline void clear_has_backward_delta_x();
-  inline void set_has_valid_delta_x();
-  inline void clear_has_valid_delta_x();
-  inline void set_has_backward_width();
-  inline void clear_has_backward_width();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::google::protobuf::uint32 width_;
-  ::google::protobuf::uint32 x_;
-  ::google::protobuf::uint32 bottom_y_;
-  ::google::protobuf::uint32 top_y_;
-  ::google::protobuf::uint32 disparity_;
-  int type_;
-  ::google::protobuf::int32 backward_delta_x_;
-  bool valid_delta_x_;
-  ::google::protobuf::int32 backward_width_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_stixels_2eproto();
-  friend void protobuf_AssignDesc_stixels_2eproto();
-  friend void protobuf_ShutdownFile_stixels_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Stixel* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t width_;
+    uint32_t x_;
+    uint32_t bottom_y_;
+    uint32_t top_y_;
+    uint32_t disparity_;
+    int type_;
+    int32_t backward_delta_x_;
+    bool valid_delta_x_;
+    int32_t backward_width_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_stixels_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Stixels : public ::google::protobuf::Message {
+class Stixels final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Stixels) */ {
  public:
-  Stixels();
-  virtual ~Stixels();
-  
+  inline Stixels() : Stixels(nullptr) {}
+  ~Stixels() override;
+  explicit PROTOBUF_CONSTEXPR Stixels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Stixels(const Stixels& from);
-  
+  Stixels(Stixels&& from) noexcept
+    : Stixels() {
+    *this = ::std::move(from);
+  }
+
   inline Stixels& operator=(const Stixels& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Stixels& operator=(Stixels&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stixels& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stixels* internal_default_instance() {
+    return reinterpret_cast<const Stixels*>(
+               &_Stixels_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Stixels& a, Stixels& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stixels* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  void UnsafeArenaSwap(Stixels* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stixels& default_instance();
-  
-  void Swap(Stixels* other);
-  
+
   // implements Message ----------------------------------------------
-  
-  Stixels* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Stixels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stixels>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Stixels& from);
-  void MergeFrom(const Stixels& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stixels& from) {
+    Stixels::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stixels* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Stixels";
+  }
+  protected:
+  explicit Stixels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
-  // optional string image_name = 1;
-  inline bool has_image_name() const;
-  inline void clear_image_name();
-  static const int kImageNameFieldNumber = 1;
-  inline const ::std::string& image_name() const;
-  inline void set_image_name(const ::std::string& value);
-  inline void set_image_name(const char* value);
-  inline void set_image_name(const char* value, size_t size);
-  inline ::std::string* mutable_image_name();
-  inline ::std::string* release_image_name();
-  
+
+  enum : int {
+    kStixelsFieldNumber = 2,
+    kImageNameFieldNumber = 1,
+    kGroundTopAndBottomFieldNumber = 3,
+    kGroundPlaneFieldNumber = 4,
+  };
   // repeated .doppia_protobuf.Stixel stixels = 2;
-  inline int stixels_size() const;
-  inline void clear_stixels();
-  static const int kStixelsFieldNumber = 2;
-  inline const ::doppia_protobuf::Stixel& stixels(int index) const;
-  inline ::doppia_protobuf::Stixel* mutable_stixels(int index);
-  inline ::doppia_protobuf::Stixel* add_stixels();
-  inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Stixel >&
-      stixels() const;
-  inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Stixel >*
+  int stixels_size() const;
+  private:
+  int _internal_stixels_size() const;
+  public:
+  void clear_stixels();
+  ::doppia_protobuf::Stixel* mutable_stixels(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Stixel >*
       mutable_stixels();
-  
+  private:
+  const ::doppia_protobuf::Stixel& _internal_stixels(int index) const;
+  ::doppia_protobuf::Stixel* _internal_add_stixels();
+  public:
+  const ::doppia_protobuf::Stixel& stixels(int index) const;
+  ::doppia_protobuf::Stixel* add_stixels();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Stixel >&
+      stixels() const;
+
+  // optional string image_name = 1;
+  bool has_image_name() const;
+  private:
+  bool _internal_has_image_name() const;
+  public:
+  void clear_image_name();
+  const std::string& image_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_image_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_image_name();
+  PROTOBUF_NODISCARD std::string* release_image_name();
+  void set_allocated_image_name(std::string* image_name);
+  private:
+  const std::string& _internal_image_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_image_name(const std::string& value);
+  std::string* _internal_mutable_image_name();
+  public:
+
   // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-  inline bool has_ground_top_and_bottom() const;
-  inline void clear_ground_top_and_bottom();
-  static const int kGroundTopAndBottomFieldNumber = 3;
-  inline const ::doppia_protobuf::GroundTopAndBottom& ground_top_and_bottom() const;
-  inline ::doppia_protobuf::GroundTopAndBottom* mutable_ground_top_and_bottom();
-  inline ::doppia_protobuf::GroundTopAndBottom* release_ground_top_and_bottom();
-  
+  bool has_ground_top_and_bottom() const;
+  private:
+  bool _internal_has_ground_top_and_bottom() const;
+  public:
+  void clear_ground_top_and_bottom();
+  const ::doppia_protobuf::GroundTopAndBottom& ground_top_and_bottom() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::GroundTopAndBottom* release_ground_top_and_bottom();
+  ::doppia_protobuf::GroundTopAndBottom* mutable_ground_top_and_bottom();
+  void set_allocated_ground_top_and_bottom(::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom);
+  private:
+  const ::doppia_protobuf::GroundTopAndBottom& _internal_ground_top_and_bottom() const;
+  ::doppia_protobuf::GroundTopAndBottom* _internal_mutable_ground_top_and_bottom();
+  public:
+  void unsafe_arena_set_allocated_ground_top_and_bottom(
+      ::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom);
+  ::doppia_protobuf::GroundTopAndBottom* unsafe_arena_release_ground_top_and_bottom();
+
   // optional .doppia_protobuf.Plane3d ground_plane = 4;
-  inline bool has_ground_plane() const;
-  inline void clear_ground_plane();
-  static const int kGroundPlaneFieldNumber = 4;
-  inline const ::doppia_protobuf::Plane3d& ground_plane() const;
-  inline ::doppia_protobuf::Plane3d* mutable_ground_plane();
-  inline ::doppia_protobuf::Plane3d* release_ground_plane();
-  
+  bool has_ground_plane() const;
+  private:
+  bool _internal_has_ground_plane() const;
+  public:
+  void clear_ground_plane();
+  const ::doppia_protobuf::Plane3d& ground_plane() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Plane3d* release_ground_plane();
+  ::doppia_protobuf::Plane3d* mutable_ground_plane();
+  void set_allocated_ground_plane(::doppia_protobuf::Plane3d* ground_plane);
+  private:
+  const ::doppia_protobuf::Plane3d& _internal_ground_plane() const;
+  ::doppia_protobuf::Plane3d* _internal_mutable_ground_plane();
+  public:
+  void unsafe_arena_set_allocated_ground_plane(
+      ::doppia_protobuf::Plane3d* ground_plane);
+  ::doppia_protobuf::Plane3d* unsafe_arena_release_ground_plane();
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Stixels)
  private:
-  inline void set_has_image_name();
-  inline void clear_has_image_name();
-  inline void set_has_ground_top_and_bottom();
-  inline void clear_has_ground_top_and_bottom();
-  inline void set_has_ground_plane();
-  inline void clear_has_ground_plane();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* image_name_;
-  ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Stixel > stixels_;
-  ::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom_;
-  ::doppia_protobuf::Plane3d* ground_plane_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_stixels_2eproto();
-  friend void protobuf_AssignDesc_stixels_2eproto();
-  friend void protobuf_ShutdownFile_stixels_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Stixels* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Stixel > stixels_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr image_name_;
+    ::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom_;
+    ::doppia_protobuf::Plane3d* ground_plane_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_stixels_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Stixel
 
 // required uint32 width = 1;
+inline bool Stixel::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool Stixel::has_width() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_width();
 }
-inline void Stixel::set_has_width() {
-  _has_bits_[0] |= 0x00000001u;
+inline void Stixel::clear_width() {
+  _impl_.width_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Stixel::clear_has_width() {
-  _has_bits_[0] &= ~0x00000001u;
+inline uint32_t Stixel::_internal_width() const {
+  return _impl_.width_;
 }
-inline void Stixel::clear_width() {
-  width_ = 0u;
-  clear_has_width();
+inline uint32_t Stixel::width() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.width)
+  return _internal_width();
 }
-inline ::google::protobuf::uint32 Stixel::width() const {
-  return width_;
+inline void Stixel::_internal_set_width(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.width_ = value;
 }
-inline void Stixel::set_width(::google::protobuf::uint32 value) {
-  set_has_width();
-  width_ = value;
+inline void Stixel::set_width(uint32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.width)
 }
 
 // required uint32 x = 2;
+inline bool Stixel::_internal_has_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Stixel::has_x() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_x();
 }
-inline void Stixel::set_has_x() {
-  _has_bits_[0] |= 0x00000002u;
+inline void Stixel::clear_x() {
+  _impl_.x_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Stixel::clear_has_x() {
-  _has_bits_[0] &= ~0x00000002u;
+inline uint32_t Stixel::_internal_x() const {
+  return _impl_.x_;
 }
-inline void Stixel::clear_x() {
-  x_ = 0u;
-  clear_has_x();
+inline uint32_t Stixel::x() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.x)
+  return _internal_x();
 }
-inline ::google::protobuf::uint32 Stixel::x() const {
-  return x_;
+inline void Stixel::_internal_set_x(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.x_ = value;
 }
-inline void Stixel::set_x(::google::protobuf::uint32 value) {
-  set_has_x();
-  x_ = value;
+inline void Stixel::set_x(uint32_t value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.x)
 }
 
 // required uint32 bottom_y = 3;
+inline bool Stixel::_internal_has_bottom_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool Stixel::has_bottom_y() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_bottom_y();
 }
-inline void Stixel::set_has_bottom_y() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Stixel::clear_bottom_y() {
+  _impl_.bottom_y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Stixel::clear_has_bottom_y() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint32_t Stixel::_internal_bottom_y() const {
+  return _impl_.bottom_y_;
 }
-inline void Stixel::clear_bottom_y() {
-  bottom_y_ = 0u;
-  clear_has_bottom_y();
+inline uint32_t Stixel::bottom_y() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.bottom_y)
+  return _internal_bottom_y();
 }
-inline ::google::protobuf::uint32 Stixel::bottom_y() const {
-  return bottom_y_;
+inline void Stixel::_internal_set_bottom_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.bottom_y_ = value;
 }
-inline void Stixel::set_bottom_y(::google::protobuf::uint32 value) {
-  set_has_bottom_y();
-  bottom_y_ = value;
+inline void Stixel::set_bottom_y(uint32_t value) {
+  _internal_set_bottom_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.bottom_y)
 }
 
 // required uint32 top_y = 4;
+inline bool Stixel::_internal_has_top_y() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool Stixel::has_top_y() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_top_y();
 }
-inline void Stixel::set_has_top_y() {
-  _has_bits_[0] |= 0x00000008u;
+inline void Stixel::clear_top_y() {
+  _impl_.top_y_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Stixel::clear_has_top_y() {
-  _has_bits_[0] &= ~0x00000008u;
+inline uint32_t Stixel::_internal_top_y() const {
+  return _impl_.top_y_;
 }
-inline void Stixel::clear_top_y() {
-  top_y_ = 0u;
-  clear_has_top_y();
+inline uint32_t Stixel::top_y() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.top_y)
+  return _internal_top_y();
 }
-inline ::google::protobuf::uint32 Stixel::top_y() const {
-  return top_y_;
+inline void Stixel::_internal_set_top_y(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.top_y_ = value;
 }
-inline void Stixel::set_top_y(::google::protobuf::uint32 value) {
-  set_has_top_y();
-  top_y_ = value;
+inline void Stixel::set_top_y(uint32_t value) {
+  _internal_set_top_y(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.top_y)
 }
 
 // required uint32 disparity = 5;
+inline bool Stixel::_internal_has_disparity() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool Stixel::has_disparity() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_disparity();
 }
-inline void Stixel::set_has_disparity() {
-  _has_bits_[0] |= 0x00000010u;
+inline void Stixel::clear_disparity() {
+  _impl_.disparity_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void Stixel::clear_has_disparity() {
-  _has_bits_[0] &= ~0x00000010u;
+inline uint32_t Stixel::_internal_disparity() const {
+  return _impl_.disparity_;
 }
-inline void Stixel::clear_disparity() {
-  disparity_ = 0u;
-  clear_has_disparity();
+inline uint32_t Stixel::disparity() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.disparity)
+  return _internal_disparity();
 }
-inline ::google::protobuf::uint32 Stixel::disparity() const {
-  return disparity_;
+inline void Stixel::_internal_set_disparity(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.disparity_ = value;
 }
-inline void Stixel::set_disparity(::google::protobuf::uint32 value) {
-  set_has_disparity();
-  disparity_ = value;
+inline void Stixel::set_disparity(uint32_t value) {
+  _internal_set_disparity(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.disparity)
 }
 
 // required .doppia_protobuf.Stixel.Type type = 6;
-inline bool Stixel::has_type() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool Stixel::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void Stixel::set_has_type() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void Stixel::clear_has_type() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool Stixel::has_type() const {
+  return _internal_has_type();
 }
 inline void Stixel::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline ::doppia_protobuf::Stixel_Type Stixel::_internal_type() const {
+  return static_cast< ::doppia_protobuf::Stixel_Type >(_impl_.type_);
 }
 inline ::doppia_protobuf::Stixel_Type Stixel::type() const {
-  return static_cast< ::doppia_protobuf::Stixel_Type >(type_);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.type)
+  return _internal_type();
+}
+inline void Stixel::_internal_set_type(::doppia_protobuf::Stixel_Type value) {
+  assert(::doppia_protobuf::Stixel_Type_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.type_ = value;
 }
 inline void Stixel::set_type(::doppia_protobuf::Stixel_Type value) {
-  GOOGLE_DCHECK(::doppia_protobuf::Stixel_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.type)
 }
 
 // optional int32 backward_delta_x = 7 [default = 0];
+inline bool Stixel::_internal_has_backward_delta_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
 inline bool Stixel::has_backward_delta_x() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+  return _internal_has_backward_delta_x();
 }
-inline void Stixel::set_has_backward_delta_x() {
-  _has_bits_[0] |= 0x00000040u;
+inline void Stixel::clear_backward_delta_x() {
+  _impl_.backward_delta_x_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
 }
-inline void Stixel::clear_has_backward_delta_x() {
-  _has_bits_[0] &= ~0x00000040u;
+inline int32_t Stixel::_internal_backward_delta_x() const {
+  return _impl_.backward_delta_x_;
 }
-inline void Stixel::clear_backward_delta_x() {
-  backward_delta_x_ = 0;
-  clear_has_backward_delta_x();
+inline int32_t Stixel::backward_delta_x() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.backward_delta_x)
+  return _internal_backward_delta_x();
 }
-inline ::google::protobuf::int32 Stixel::backward_delta_x() const {
-  return backward_delta_x_;
+inline void Stixel::_internal_set_backward_delta_x(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.backward_delta_x_ = value;
 }
-inline void Stixel::set_backward_delta_x(::google::protobuf::int32 value) {
-  set_has_backward_delta_x();
-  backward_delta_x_ = value;
+inline void Stixel::set_backward_delta_x(int32_t value) {
+  _internal_set_backward_delta_x(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.backward_delta_x)
 }
 
 // optional bool valid_delta_x = 8 [default = false];
-inline bool Stixel::has_valid_delta_x() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void Stixel::set_has_valid_delta_x() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool Stixel::_internal_has_valid_delta_x() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void Stixel::clear_has_valid_delta_x() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool Stixel::has_valid_delta_x() const {
+  return _internal_has_valid_delta_x();
 }
 inline void Stixel::clear_valid_delta_x() {
-  valid_delta_x_ = false;
-  clear_has_valid_delta_x();
+  _impl_.valid_delta_x_ = false;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline bool Stixel::_internal_valid_delta_x() const {
+  return _impl_.valid_delta_x_;
 }
 inline bool Stixel::valid_delta_x() const {
-  return valid_delta_x_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.valid_delta_x)
+  return _internal_valid_delta_x();
+}
+inline void Stixel::_internal_set_valid_delta_x(bool value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.valid_delta_x_ = value;
 }
 inline void Stixel::set_valid_delta_x(bool value) {
-  set_has_valid_delta_x();
-  valid_delta_x_ = value;
+  _internal_set_valid_delta_x(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.valid_delta_x)
 }
 
 // optional int32 backward_width = 9 [default = 1];
+inline bool Stixel::_internal_has_backward_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
 inline bool Stixel::has_backward_width() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+  return _internal_has_backward_width();
 }
-inline void Stixel::set_has_backward_width() {
-  _has_bits_[0] |= 0x00000100u;
+inline void Stixel::clear_backward_width() {
+  _impl_.backward_width_ = 1;
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void Stixel::clear_has_backward_width() {
-  _has_bits_[0] &= ~0x00000100u;
+inline int32_t Stixel::_internal_backward_width() const {
+  return _impl_.backward_width_;
 }
-inline void Stixel::clear_backward_width() {
-  backward_width_ = 1;
-  clear_has_backward_width();
+inline int32_t Stixel::backward_width() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixel.backward_width)
+  return _internal_backward_width();
 }
-inline ::google::protobuf::int32 Stixel::backward_width() const {
-  return backward_width_;
+inline void Stixel::_internal_set_backward_width(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.backward_width_ = value;
 }
-inline void Stixel::set_backward_width(::google::protobuf::int32 value) {
-  set_has_backward_width();
-  backward_width_ = value;
+inline void Stixel::set_backward_width(int32_t value) {
+  _internal_set_backward_width(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixel.backward_width)
 }
 
 // -------------------------------------------------------------------
@@ -580,164 +900,308 @@ inline void Stixel::set_backward_width(::google::protobuf::int32 value) {
 // Stixels
 
 // optional string image_name = 1;
-inline bool Stixels::has_image_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Stixels::_internal_has_image_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Stixels::set_has_image_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Stixels::clear_has_image_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Stixels::has_image_name() const {
+  return _internal_has_image_name();
 }
 inline void Stixels::clear_image_name() {
-  if (image_name_ != &::google::protobuf::internal::kEmptyString) {
-    image_name_->clear();
+  _impl_.image_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Stixels::image_name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixels.image_name)
+  return _internal_image_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stixels::set_image_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.image_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.Stixels.image_name)
+}
+inline std::string* Stixels::mutable_image_name() {
+  std::string* _s = _internal_mutable_image_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Stixels.image_name)
+  return _s;
+}
+inline const std::string& Stixels::_internal_image_name() const {
+  return _impl_.image_name_.Get();
+}
+inline void Stixels::_internal_set_image_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.image_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stixels::_internal_mutable_image_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.image_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stixels::release_image_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Stixels.image_name)
+  if (!_internal_has_image_name()) {
+    return nullptr;
   }
-  clear_has_image_name();
-}
-inline const ::std::string& Stixels::image_name() const {
-  return *image_name_;
-}
-inline void Stixels::set_image_name(const ::std::string& value) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
-  }
-  image_name_->assign(value);
-}
-inline void Stixels::set_image_name(const char* value) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.image_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_name_.IsDefault()) {
+    _impl_.image_name_.Set("", GetArenaForAllocation());
   }
-  image_name_->assign(value);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Stixels::set_image_name(const char* value, size_t size) {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
-  }
-  image_name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Stixels::mutable_image_name() {
-  set_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    image_name_ = new ::std::string;
-  }
-  return image_name_;
-}
-inline ::std::string* Stixels::release_image_name() {
-  clear_has_image_name();
-  if (image_name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void Stixels::set_allocated_image_name(std::string* image_name) {
+  if (image_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = image_name_;
-    image_name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.image_name_.SetAllocated(image_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.image_name_.IsDefault()) {
+    _impl_.image_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Stixels.image_name)
 }
 
 // repeated .doppia_protobuf.Stixel stixels = 2;
+inline int Stixels::_internal_stixels_size() const {
+  return _impl_.stixels_.size();
+}
 inline int Stixels::stixels_size() const {
-  return stixels_.size();
+  return _internal_stixels_size();
 }
 inline void Stixels::clear_stixels() {
-  stixels_.Clear();
+  _impl_.stixels_.Clear();
+}
+inline ::doppia_protobuf::Stixel* Stixels::mutable_stixels(int index) {
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Stixels.stixels)
+  return _impl_.stixels_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Stixel >*
+Stixels::mutable_stixels() {
+  // @@protoc_insertion_point(field_mutable_list:doppia_protobuf.Stixels.stixels)
+  return &_impl_.stixels_;
+}
+inline const ::doppia_protobuf::Stixel& Stixels::_internal_stixels(int index) const {
+  return _impl_.stixels_.Get(index);
 }
 inline const ::doppia_protobuf::Stixel& Stixels::stixels(int index) const {
-  return stixels_.Get(index);
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixels.stixels)
+  return _internal_stixels(index);
 }
-inline ::doppia_protobuf::Stixel* Stixels::mutable_stixels(int index) {
-  return stixels_.Mutable(index);
+inline ::doppia_protobuf::Stixel* Stixels::_internal_add_stixels() {
+  return _impl_.stixels_.Add();
 }
 inline ::doppia_protobuf::Stixel* Stixels::add_stixels() {
-  return stixels_.Add();
+  ::doppia_protobuf::Stixel* _add = _internal_add_stixels();
+  // @@protoc_insertion_point(field_add:doppia_protobuf.Stixels.stixels)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Stixel >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::doppia_protobuf::Stixel >&
 Stixels::stixels() const {
-  return stixels_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::doppia_protobuf::Stixel >*
-Stixels::mutable_stixels() {
-  return &stixels_;
+  // @@protoc_insertion_point(field_list:doppia_protobuf.Stixels.stixels)
+  return _impl_.stixels_;
 }
 
 // optional .doppia_protobuf.GroundTopAndBottom ground_top_and_bottom = 3;
-inline bool Stixels::has_ground_top_and_bottom() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Stixels::set_has_ground_top_and_bottom() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool Stixels::_internal_has_ground_top_and_bottom() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ground_top_and_bottom_ != nullptr);
+  return value;
 }
-inline void Stixels::clear_has_ground_top_and_bottom() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool Stixels::has_ground_top_and_bottom() const {
+  return _internal_has_ground_top_and_bottom();
 }
-inline void Stixels::clear_ground_top_and_bottom() {
-  if (ground_top_and_bottom_ != NULL) ground_top_and_bottom_->::doppia_protobuf::GroundTopAndBottom::Clear();
-  clear_has_ground_top_and_bottom();
+inline const ::doppia_protobuf::GroundTopAndBottom& Stixels::_internal_ground_top_and_bottom() const {
+  const ::doppia_protobuf::GroundTopAndBottom* p = _impl_.ground_top_and_bottom_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::GroundTopAndBottom&>(
+      ::doppia_protobuf::_GroundTopAndBottom_default_instance_);
 }
 inline const ::doppia_protobuf::GroundTopAndBottom& Stixels::ground_top_and_bottom() const {
-  return ground_top_and_bottom_ != NULL ? *ground_top_and_bottom_ : *default_instance_->ground_top_and_bottom_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixels.ground_top_and_bottom)
+  return _internal_ground_top_and_bottom();
 }
-inline ::doppia_protobuf::GroundTopAndBottom* Stixels::mutable_ground_top_and_bottom() {
-  set_has_ground_top_and_bottom();
-  if (ground_top_and_bottom_ == NULL) ground_top_and_bottom_ = new ::doppia_protobuf::GroundTopAndBottom;
-  return ground_top_and_bottom_;
+inline void Stixels::unsafe_arena_set_allocated_ground_top_and_bottom(
+    ::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ground_top_and_bottom_);
+  }
+  _impl_.ground_top_and_bottom_ = ground_top_and_bottom;
+  if (ground_top_and_bottom) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Stixels.ground_top_and_bottom)
 }
 inline ::doppia_protobuf::GroundTopAndBottom* Stixels::release_ground_top_and_bottom() {
-  clear_has_ground_top_and_bottom();
-  ::doppia_protobuf::GroundTopAndBottom* temp = ground_top_and_bottom_;
-  ground_top_and_bottom_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::GroundTopAndBottom* temp = _impl_.ground_top_and_bottom_;
+  _impl_.ground_top_and_bottom_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::GroundTopAndBottom* Stixels::unsafe_arena_release_ground_top_and_bottom() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Stixels.ground_top_and_bottom)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::GroundTopAndBottom* temp = _impl_.ground_top_and_bottom_;
+  _impl_.ground_top_and_bottom_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::GroundTopAndBottom* Stixels::_internal_mutable_ground_top_and_bottom() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.ground_top_and_bottom_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::GroundTopAndBottom>(GetArenaForAllocation());
+    _impl_.ground_top_and_bottom_ = p;
+  }
+  return _impl_.ground_top_and_bottom_;
+}
+inline ::doppia_protobuf::GroundTopAndBottom* Stixels::mutable_ground_top_and_bottom() {
+  ::doppia_protobuf::GroundTopAndBottom* _msg = _internal_mutable_ground_top_and_bottom();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Stixels.ground_top_and_bottom)
+  return _msg;
+}
+inline void Stixels::set_allocated_ground_top_and_bottom(::doppia_protobuf::GroundTopAndBottom* ground_top_and_bottom) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ground_top_and_bottom_);
+  }
+  if (ground_top_and_bottom) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ground_top_and_bottom));
+    if (message_arena != submessage_arena) {
+      ground_top_and_bottom = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ground_top_and_bottom, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.ground_top_and_bottom_ = ground_top_and_bottom;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Stixels.ground_top_and_bottom)
+}
 
 // optional .doppia_protobuf.Plane3d ground_plane = 4;
-inline bool Stixels::has_ground_plane() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void Stixels::set_has_ground_plane() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Stixels::_internal_has_ground_plane() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.ground_plane_ != nullptr);
+  return value;
 }
-inline void Stixels::clear_has_ground_plane() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool Stixels::has_ground_plane() const {
+  return _internal_has_ground_plane();
 }
-inline void Stixels::clear_ground_plane() {
-  if (ground_plane_ != NULL) ground_plane_->::doppia_protobuf::Plane3d::Clear();
-  clear_has_ground_plane();
+inline const ::doppia_protobuf::Plane3d& Stixels::_internal_ground_plane() const {
+  const ::doppia_protobuf::Plane3d* p = _impl_.ground_plane_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Plane3d&>(
+      ::doppia_protobuf::_Plane3d_default_instance_);
 }
 inline const ::doppia_protobuf::Plane3d& Stixels::ground_plane() const {
-  return ground_plane_ != NULL ? *ground_plane_ : *default_instance_->ground_plane_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Stixels.ground_plane)
+  return _internal_ground_plane();
 }
-inline ::doppia_protobuf::Plane3d* Stixels::mutable_ground_plane() {
-  set_has_ground_plane();
-  if (ground_plane_ == NULL) ground_plane_ = new ::doppia_protobuf::Plane3d;
-  return ground_plane_;
+inline void Stixels::unsafe_arena_set_allocated_ground_plane(
+    ::doppia_protobuf::Plane3d* ground_plane) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ground_plane_);
+  }
+  _impl_.ground_plane_ = ground_plane;
+  if (ground_plane) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Stixels.ground_plane)
 }
 inline ::doppia_protobuf::Plane3d* Stixels::release_ground_plane() {
-  clear_has_ground_plane();
-  ::doppia_protobuf::Plane3d* temp = ground_plane_;
-  ground_plane_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::Plane3d* temp = _impl_.ground_plane_;
+  _impl_.ground_plane_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Plane3d* Stixels::unsafe_arena_release_ground_plane() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Stixels.ground_plane)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::Plane3d* temp = _impl_.ground_plane_;
+  _impl_.ground_plane_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Plane3d* Stixels::_internal_mutable_ground_plane() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.ground_plane_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Plane3d>(GetArenaForAllocation());
+    _impl_.ground_plane_ = p;
+  }
+  return _impl_.ground_plane_;
+}
+inline ::doppia_protobuf::Plane3d* Stixels::mutable_ground_plane() {
+  ::doppia_protobuf::Plane3d* _msg = _internal_mutable_ground_plane();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Stixels.ground_plane)
+  return _msg;
+}
+inline void Stixels::set_allocated_ground_plane(::doppia_protobuf::Plane3d* ground_plane) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.ground_plane_);
+  }
+  if (ground_plane) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(ground_plane));
+    if (message_arena != submessage_arena) {
+      ground_plane = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ground_plane, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.ground_plane_ = ground_plane;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Stixels.ground_plane)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::doppia_protobuf::Stixel_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::doppia_protobuf::Stixel_Type>() {
   return ::doppia_protobuf::Stixel_Type_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_stixels_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_stixels_2eproto
@@ -0,0 +1,73 @@
+#include "stixels_dynamic_programming.hpp"
+
+// emmintrin will define __m128
+// and include the SSE2 intrinsics
+#include <emmintrin.h>
+
+#include <limits>
+#include <algorithm>
+
+namespace doppia {
+
+void compute_prefix_minimum(const float *values, const int size, float *prefix_minimum)
+{
+    const __m128 infinity = _mm_set1_ps(std::numeric_limits<float>::max());
+    __m128 carry = infinity;
+
+    int i = 0;
+    for(; i + 4 <= size; i += 4)
+    {
+        // in register prefix minimum, using log2(4) shifted copies
+        __m128 x = _mm_loadu_ps(values + i);
+
+        // [inf, x0, x1, x2]
+        const __m128 shifted_by_one = _mm_move_ss(
+                    _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(x), 4)), infinity);
+        x = _mm_min_ps(x, shifted_by_one);
+
+        // [inf, inf, x0, x1]
+        const __m128 shifted_by_two = _mm_shuffle_ps(infinity, x, _MM_SHUFFLE(1, 0, 0, 0));
+        x = _mm_min_ps(x, shifted_by_two);
+
+        // add the minimum of the previous blocks
+        x = _mm_min_ps(x, carry);
+        _mm_storeu_ps(prefix_minimum + i, x);
+
+        carry = _mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+
+    float minimum = _mm_cvtss_f32(carry);
+    for(; i < size; i += 1)
+    {
+        minimum = std::min(values[i], minimum);
+        prefix_minimum[i] = minimum;
+    }
+
+    return;
+}
+
+
+void compute_prefix_minimum_index(const float *values, const float *prefix_minimum, const int size,
+                                  int *prefix_minimum_index)
+{
+    if(size <= 0)
+    {
+        return;
+    }
+
+    int index = 0;
+    prefix_minimum_index[0] = index;
+    for(int i = 1; i < size; i += 1)
+    {
+        // the prefix minimum only changes when a strictly lower value is found
+        if(values[i] < prefix_minimum[i - 1])
+        {
+            index = i;
+        }
+        prefix_minimum_index[i] = index;
+    }
+
+    return;
+}
+
+} // end of namespace doppia
@@ -0,0 +1,24 @@
+#ifndef DOPPIA_STIXELS_DYNAMIC_PROGRAMMING_HPP
+#define DOPPIA_STIXELS_DYNAMIC_PROGRAMMING_HPP
+
+namespace doppia {
+
+/// Helpers shared by the dynamic programming of the ground obstacle boundary
+/// (StixelsEstimator and ImagePlaneStixelsEstimator).
+///
+/// In both cases the recurrence M_i(d) = m_i(d) + min_e[ M_{i+1}(e) - c_i(d, e) ] has c_i(d, e) = 0
+/// for all e "above" d, so the inner minimization is (mostly) a prefix minimum over the next column.
+/// Computing the prefix minimum once per column turns the O(num_disparities^2) per column into O(num_disparities).
+
+/// prefix_minimum[i] = min(values[0], ..., values[i]), SSE2 vectorized.
+/// values and prefix_minimum do not need to be aligned, but should not overlap
+void compute_prefix_minimum(const float *values, const int size, float *prefix_minimum);
+
+/// prefix_minimum_index[i] is the first index of the minimum of values[0], ..., values[i],
+/// given the prefix_minimum computed with compute_prefix_minimum
+void compute_prefix_minimum_index(const float *values, const float *prefix_minimum, const int size,
+                                  int *prefix_minimum_index);
+
+} // end of namespace doppia
+
+#endif // DOPPIA_STIXELS_DYNAMIC_PROGRAMMING_HPP
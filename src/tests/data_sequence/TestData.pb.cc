@@ -1,402 +1,395 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: TestData.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "TestData.pb.h"
-#include <google/protobuf/stubs/once.h>
+
+#include <algorithm>
+
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
-
-namespace {
-
-const ::google::protobuf::Descriptor* TestData_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TestData_reflection_ = NULL;
+PROTOBUF_PRAGMA_INIT_SEG
 
-}  // namespace
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-
-void protobuf_AssignDesc_TestData_2eproto() {
-  protobuf_AddDesc_TestData_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "TestData.proto");
-  GOOGLE_CHECK(file != NULL);
-  TestData_descriptor_ = file->message_type(0);
-  static const int TestData_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestData, int_value_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestData, float_value_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestData, string_value_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR TestData::TestData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.string_value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.int_value_)*/0
+  , /*decltype(_impl_.float_value_)*/0} {}
+struct TestDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TestDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TestDataDefaultTypeInternal() {}
+  union {
+    TestData _instance;
   };
-  TestData_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TestData_descriptor_,
-      TestData::default_instance_,
-      TestData_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestData, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TestData, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TestData));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_TestData_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TestData_descriptor_, &TestData::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_TestData_2eproto() {
-  delete TestData::default_instance_;
-  delete TestData_reflection_;
-}
-
-void protobuf_AddDesc_TestData_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\016TestData.proto\022\017doppia_protobuf\"H\n\010Tes"
-    "tData\022\021\n\tint_value\030\001 \001(\005\022\023\n\013float_value\030"
-    "\002 \001(\002\022\024\n\014string_value\030\003 \001(\t", 107);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "TestData.proto", &protobuf_RegisterTypes);
-  TestData::default_instance_ = new TestData();
-  TestData::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_TestData_2eproto);
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TestDataDefaultTypeInternal _TestData_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_TestData_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_TestData_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_TestData_2eproto = nullptr;
+
+const uint32_t TableStruct_TestData_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TestData, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TestData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TestData, _impl_.int_value_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TestData, _impl_.float_value_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TestData, _impl_.string_value_),
+  1,
+  2,
+  0,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::doppia_protobuf::TestData)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_TestData_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_TestData_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\016TestData.proto\022\017doppia_protobuf\"H\n\010Tes"
+  "tData\022\021\n\tint_value\030\001 \001(\005\022\023\n\013float_value\030"
+  "\002 \001(\002\022\024\n\014string_value\030\003 \001(\t"
+  ;
+static ::_pbi::once_flag descriptor_table_TestData_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_TestData_2eproto = {
+    false, false, 107, descriptor_table_protodef_TestData_2eproto,
+    "TestData.proto",
+    &descriptor_table_TestData_2eproto_once, nullptr, 0, 1,
+    schemas, file_default_instances, TableStruct_TestData_2eproto::offsets,
+    file_level_metadata_TestData_2eproto, file_level_enum_descriptors_TestData_2eproto,
+    file_level_service_descriptors_TestData_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_TestData_2eproto_getter() {
+  return &descriptor_table_TestData_2eproto;
 }
 
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_TestData_2eproto {
-  StaticDescriptorInitializer_TestData_2eproto() {
-    protobuf_AddDesc_TestData_2eproto();
-  }
-} static_descriptor_initializer_TestData_2eproto_;
-
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_TestData_2eproto(&descriptor_table_TestData_2eproto);
+namespace doppia_protobuf {
 
 // ===================================================================
 
-const ::std::string TestData::_default_string_value_;
-#ifndef _MSC_VER
-const int TestData::kIntValueFieldNumber;
-const int TestData::kFloatValueFieldNumber;
-const int TestData::kStringValueFieldNumber;
-#endif  // !_MSC_VER
-
-TestData::TestData()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class TestData::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TestData>()._impl_._has_bits_);
+  static void set_has_int_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_float_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_string_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
 
-void TestData::InitAsDefaultInstance() {
+TestData::TestData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.TestData)
 }
-
 TestData::TestData(const TestData& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TestData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.string_value_){}
+    , decltype(_impl_.int_value_){}
+    , decltype(_impl_.float_value_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.string_value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_string_value()) {
+    _this->_impl_.string_value_.Set(from._internal_string_value(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.int_value_, &from._impl_.int_value_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.float_value_) -
+    reinterpret_cast<char*>(&_impl_.int_value_)) + sizeof(_impl_.float_value_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.TestData)
 }
 
-void TestData::SharedCtor() {
-  _cached_size_ = 0;
-  int_value_ = 0;
-  float_value_ = 0;
-  string_value_ = const_cast< ::std::string*>(&_default_string_value_);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+inline void TestData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.string_value_){}
+    , decltype(_impl_.int_value_){0}
+    , decltype(_impl_.float_value_){0}
+  };
+  _impl_.string_value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.string_value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 TestData::~TestData() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.TestData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TestData::SharedDtor() {
-  if (string_value_ != &_default_string_value_) {
-    delete string_value_;
-  }
-  if (this != default_instance_) {
-  }
+inline void TestData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.string_value_.Destroy();
 }
 
 void TestData::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TestData::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TestData_descriptor_;
-}
-
-const TestData& TestData::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_TestData_2eproto();  return *default_instance_;
-}
-
-TestData* TestData::default_instance_ = NULL;
-
-TestData* TestData::New() const {
-  return new TestData;
+  _impl_._cached_size_.Set(size);
 }
 
 void TestData::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    int_value_ = 0;
-    float_value_ = 0;
-    if (_has_bit(2)) {
-      if (string_value_ != &_default_string_value_) {
-        string_value_->clear();
-      }
-    }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.TestData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.string_value_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.int_value_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.float_value_) -
+        reinterpret_cast<char*>(&_impl_.int_value_)) + sizeof(_impl_.float_value_));
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool TestData::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* TestData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional int32 int_value = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
-                 input, &int_value_)));
-          _set_bit(0);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_float_value;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_int_value(&has_bits);
+          _impl_.int_value_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float float_value = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_float_value:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &float_value_)));
-          _set_bit(1);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_string_value;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_float_value(&has_bits);
+          _impl_.float_value_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional string string_value = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_string_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_string_value()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->string_value().data(), this->string_value().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_string_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.TestData.string_value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
 
-void TestData::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional int32 int_value = 1;
-  if (_has_bit(0)) {
-    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->int_value(), output);
-  }
-  
-  // optional float float_value = 2;
-  if (_has_bit(1)) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->float_value(), output);
-  }
-  
-  // optional string string_value = 3;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->string_value().data(), this->string_value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->string_value(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
+uint8_t* TestData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.TestData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-::google::protobuf::uint8* TestData::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+  cached_has_bits = _impl_._has_bits_[0];
   // optional int32 int_value = 1;
-  if (_has_bit(0)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteInt32ToArray(1, this->int_value(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_int_value(), target);
   }
-  
+
   // optional float float_value = 2;
-  if (_has_bit(1)) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->float_value(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_float_value(), target);
   }
-  
+
   // optional string string_value = 3;
-  if (_has_bit(2)) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->string_value().data(), this->string_value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->string_value(), target);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_string_value().data(), static_cast<int>(this->_internal_string_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.TestData.string_value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_string_value(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.TestData)
   return target;
 }
 
-int TestData::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional int32 int_value = 1;
-    if (has_int_value()) {
+size_t TestData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.TestData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string string_value = 3;
+    if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::Int32Size(
-          this->int_value());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_string_value());
     }
-    
+
+    // optional int32 int_value = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_int_value());
+    }
+
     // optional float float_value = 2;
-    if (has_float_value()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 4;
     }
-    
-    // optional string string_value = 3;
-    if (has_string_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->string_value());
-    }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void TestData::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TestData* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TestData*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TestData::MergeFrom(const TestData& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from._has_bit(0)) {
-      set_int_value(from.int_value());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TestData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TestData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TestData::GetClassData() const { return &_class_data_; }
+
+
+void TestData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TestData*>(&to_msg);
+  auto& from = static_cast<const TestData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.TestData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_string_value(from._internal_string_value());
     }
-    if (from._has_bit(1)) {
-      set_float_value(from.float_value());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.int_value_ = from._impl_.int_value_;
     }
-    if (from._has_bit(2)) {
-      set_string_value(from.string_value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.float_value_ = from._impl_.float_value_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void TestData::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TestData::CopyFrom(const TestData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.TestData)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TestData::IsInitialized() const {
-  
   return true;
 }
 
-void TestData::Swap(TestData* other) {
-  if (other != this) {
-    std::swap(int_value_, other->int_value_);
-    std::swap(float_value_, other->float_value_);
-    std::swap(string_value_, other->string_value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void TestData::InternalSwap(TestData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.string_value_, lhs_arena,
+      &other->_impl_.string_value_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TestData, _impl_.float_value_)
+      + sizeof(TestData::_impl_.float_value_)
+      - PROTOBUF_FIELD_OFFSET(TestData, _impl_.int_value_)>(
+          reinterpret_cast<char*>(&_impl_.int_value_),
+          reinterpret_cast<char*>(&other->_impl_.int_value_));
 }
 
-::google::protobuf::Metadata TestData::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TestData_descriptor_;
-  metadata.reflection = TestData_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata TestData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_TestData_2eproto_getter, &descriptor_table_TestData_2eproto_once,
+      file_level_metadata_TestData_2eproto[0]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::TestData*
+Arena::CreateMaybeMessage< ::doppia_protobuf::TestData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::TestData >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,243 +1,398 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: TestData.proto
 
-#ifndef PROTOBUF_TestData_2eproto__INCLUDED
-#define PROTOBUF_TestData_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_TestData_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_TestData_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2003000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_TestData_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
+// Internal implementation detail -- do not use these members.
+struct TableStruct_TestData_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_TestData_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_TestData_2eproto();
-void protobuf_AssignDesc_TestData_2eproto();
-void protobuf_ShutdownFile_TestData_2eproto();
-
 class TestData;
+struct TestDataDefaultTypeInternal;
+extern TestDataDefaultTypeInternal _TestData_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::TestData* Arena::CreateMaybeMessage<::doppia_protobuf::TestData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
 // ===================================================================
 
-class TestData : public ::google::protobuf::Message {
+class TestData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.TestData) */ {
  public:
-  TestData();
-  virtual ~TestData();
-  
+  inline TestData() : TestData(nullptr) {}
+  ~TestData() override;
+  explicit PROTOBUF_CONSTEXPR TestData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   TestData(const TestData& from);
-  
+  TestData(TestData&& from) noexcept
+    : TestData() {
+    *this = ::std::move(from);
+  }
+
   inline TestData& operator=(const TestData& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TestData& operator=(TestData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TestData& default_instance();
-  
-  void Swap(TestData* other);
-  
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TestData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TestData* internal_default_instance() {
+    return reinterpret_cast<const TestData*>(
+               &_TestData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TestData& a, TestData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TestData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TestData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  TestData* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  TestData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TestData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TestData& from);
-  void MergeFrom(const TestData& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TestData& from) {
+    TestData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TestData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.TestData";
+  }
+  protected:
+  explicit TestData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kStringValueFieldNumber = 3,
+    kIntValueFieldNumber = 1,
+    kFloatValueFieldNumber = 2,
+  };
+  // optional string string_value = 3;
+  bool has_string_value() const;
+  private:
+  bool _internal_has_string_value() const;
+  public:
+  void clear_string_value();
+  const std::string& string_value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_string_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_string_value();
+  PROTOBUF_NODISCARD std::string* release_string_value();
+  void set_allocated_string_value(std::string* string_value);
+  private:
+  const std::string& _internal_string_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_string_value(const std::string& value);
+  std::string* _internal_mutable_string_value();
+  public:
+
   // optional int32 int_value = 1;
-  inline bool has_int_value() const;
-  inline void clear_int_value();
-  static const int kIntValueFieldNumber = 1;
-  inline ::google::protobuf::int32 int_value() const;
-  inline void set_int_value(::google::protobuf::int32 value);
-  
+  bool has_int_value() const;
+  private:
+  bool _internal_has_int_value() const;
+  public:
+  void clear_int_value();
+  int32_t int_value() const;
+  void set_int_value(int32_t value);
+  private:
+  int32_t _internal_int_value() const;
+  void _internal_set_int_value(int32_t value);
+  public:
+
   // optional float float_value = 2;
-  inline bool has_float_value() const;
-  inline void clear_float_value();
-  static const int kFloatValueFieldNumber = 2;
-  inline float float_value() const;
-  inline void set_float_value(float value);
-  
-  // optional string string_value = 3;
-  inline bool has_string_value() const;
-  inline void clear_string_value();
-  static const int kStringValueFieldNumber = 3;
-  inline const ::std::string& string_value() const;
-  inline void set_string_value(const ::std::string& value);
-  inline void set_string_value(const char* value);
-  inline void set_string_value(const char* value, size_t size);
-  inline ::std::string* mutable_string_value();
-  
+  bool has_float_value() const;
+  private:
+  bool _internal_has_float_value() const;
+  public:
+  void clear_float_value();
+  float float_value() const;
+  void set_float_value(float value);
+  private:
+  float _internal_float_value() const;
+  void _internal_set_float_value(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.TestData)
  private:
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  mutable int _cached_size_;
-  
-  ::google::protobuf::int32 int_value_;
-  float float_value_;
-  ::std::string* string_value_;
-  static const ::std::string _default_string_value_;
-  friend void  protobuf_AddDesc_TestData_2eproto();
-  friend void protobuf_AssignDesc_TestData_2eproto();
-  friend void protobuf_ShutdownFile_TestData_2eproto();
-  
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  // WHY DOES & HAVE LOWER PRECEDENCE THAN != !?
-  inline bool _has_bit(int index) const {
-    return (_has_bits_[index / 32] & (1u << (index % 32))) != 0;
-  }
-  inline void _set_bit(int index) {
-    _has_bits_[index / 32] |= (1u << (index % 32));
-  }
-  inline void _clear_bit(int index) {
-    _has_bits_[index / 32] &= ~(1u << (index % 32));
-  }
-  
-  void InitAsDefaultInstance();
-  static TestData* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr string_value_;
+    int32_t int_value_;
+    float float_value_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_TestData_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // TestData
 
 // optional int32 int_value = 1;
+inline bool TestData::_internal_has_int_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool TestData::has_int_value() const {
-  return _has_bit(0);
+  return _internal_has_int_value();
 }
 inline void TestData::clear_int_value() {
-  int_value_ = 0;
-  _clear_bit(0);
+  _impl_.int_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t TestData::_internal_int_value() const {
+  return _impl_.int_value_;
+}
+inline int32_t TestData::int_value() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TestData.int_value)
+  return _internal_int_value();
 }
-inline ::google::protobuf::int32 TestData::int_value() const {
-  return int_value_;
+inline void TestData::_internal_set_int_value(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.int_value_ = value;
 }
-inline void TestData::set_int_value(::google::protobuf::int32 value) {
-  _set_bit(0);
-  int_value_ = value;
+inline void TestData::set_int_value(int32_t value) {
+  _internal_set_int_value(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TestData.int_value)
 }
 
 // optional float float_value = 2;
+inline bool TestData::_internal_has_float_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool TestData::has_float_value() const {
-  return _has_bit(1);
+  return _internal_has_float_value();
 }
 inline void TestData::clear_float_value() {
-  float_value_ = 0;
-  _clear_bit(1);
+  _impl_.float_value_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float TestData::_internal_float_value() const {
+  return _impl_.float_value_;
 }
 inline float TestData::float_value() const {
-  return float_value_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TestData.float_value)
+  return _internal_float_value();
+}
+inline void TestData::_internal_set_float_value(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.float_value_ = value;
 }
 inline void TestData::set_float_value(float value) {
-  _set_bit(1);
-  float_value_ = value;
+  _internal_set_float_value(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TestData.float_value)
 }
 
 // optional string string_value = 3;
+inline bool TestData::_internal_has_string_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool TestData::has_string_value() const {
-  return _has_bit(2);
+  return _internal_has_string_value();
 }
 inline void TestData::clear_string_value() {
-  if (string_value_ != &_default_string_value_) {
-    string_value_->clear();
-  }
-  _clear_bit(2);
+  _impl_.string_value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const ::std::string& TestData::string_value() const {
-  return *string_value_;
+inline const std::string& TestData::string_value() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TestData.string_value)
+  return _internal_string_value();
 }
-inline void TestData::set_string_value(const ::std::string& value) {
-  _set_bit(2);
-  if (string_value_ == &_default_string_value_) {
-    string_value_ = new ::std::string;
-  }
-  string_value_->assign(value);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TestData::set_string_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.string_value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TestData.string_value)
 }
-inline void TestData::set_string_value(const char* value) {
-  _set_bit(2);
-  if (string_value_ == &_default_string_value_) {
-    string_value_ = new ::std::string;
-  }
-  string_value_->assign(value);
+inline std::string* TestData::mutable_string_value() {
+  std::string* _s = _internal_mutable_string_value();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.TestData.string_value)
+  return _s;
+}
+inline const std::string& TestData::_internal_string_value() const {
+  return _impl_.string_value_.Get();
+}
+inline void TestData::_internal_set_string_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.string_value_.Set(value, GetArenaForAllocation());
 }
-inline void TestData::set_string_value(const char* value, size_t size) {
-  _set_bit(2);
-  if (string_value_ == &_default_string_value_) {
-    string_value_ = new ::std::string;
+inline std::string* TestData::_internal_mutable_string_value() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.string_value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TestData::release_string_value() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.TestData.string_value)
+  if (!_internal_has_string_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.string_value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_value_.IsDefault()) {
+    _impl_.string_value_.Set("", GetArenaForAllocation());
   }
-  string_value_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* TestData::mutable_string_value() {
-  _set_bit(2);
-  if (string_value_ == &_default_string_value_) {
-    string_value_ = new ::std::string;
+inline void TestData::set_allocated_string_value(std::string* string_value) {
+  if (string_value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  return string_value_;
+  _impl_.string_value_.SetAllocated(string_value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.string_value_.IsDefault()) {
+    _impl_.string_value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.TestData.string_value)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace doppia_protobuf
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
-
-
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
-
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_TestData_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_TestData_2eproto
@@ -12,6 +12,7 @@
 #include "TestData.pb.h"
 
 #include <string>
+#include <vector>
 #include <cstdio>
 #include <iostream>
 
@@ -93,4 +94,130 @@ BOOST_AUTO_TEST_CASE(WriteAndReadSmallSequenceTestCase)
 } // end of "BOOST_AUTO_TEST_CASE"
 
 
+BOOST_AUTO_TEST_CASE(AsynchronousWriteTestCase)
+{
+    const string test_filename = "test_async.sequence";
+    boost::filesystem::remove(test_filename);
+
+    TestDataSequence::attributes_t attributes;
+    attributes.insert(std::make_pair("name", "test_async_data_sequence"));
 
+    const int num_messages = 1000;
+
+    // write output data --
+    {
+        // small queue, to exercise the blocking on overflow
+        TestDataSequence output_sequence(test_filename, attributes);
+        output_sequence.enable_asynchronous_writes(4);
+
+        for(int i=0; i < num_messages; i+=1)
+        {
+            TestData data;
+            data.set_int_value(i);
+            output_sequence << data;
+
+            if(i == num_messages / 2)
+            {
+                output_sequence.flush();
+                BOOST_REQUIRE(boost::filesystem::file_size(test_filename) > 0);
+            }
+        }
+
+        BOOST_CHECK_EQUAL(output_sequence.get_num_dropped_messages(), 0u);
+    }
+
+    // read input data --
+    {
+        TestDataSequence input_sequence(test_filename);
+        BOOST_CHECK(input_sequence.get_attributes() == attributes);
+
+        for(int i=0; i < num_messages; i+=1)
+        {
+            TestData read_data;
+            input_sequence >> read_data;
+            BOOST_REQUIRE_EQUAL(read_data.int_value(), i);
+        }
+    }
+
+    return;
+} // end of "BOOST_AUTO_TEST_CASE"
+
+
+/// marks each message as visited, used by IndexedReadTestCase
+struct VisitMessagesFunctor
+{
+    std::vector<int> &visited_int_values;
+
+    VisitMessagesFunctor(std::vector<int> &visited_int_values_)
+        : visited_int_values(visited_int_values_)
+    {
+        // nothing to do here
+        return;
+    }
+
+    void operator()(const size_t message_index, const TestData &data)
+    {
+        visited_int_values[message_index] = data.int_value();
+        return;
+    }
+};
+
+
+BOOST_AUTO_TEST_CASE(IndexedReadTestCase)
+{
+    const string indexed_filename = "test_indexed.sequence", not_indexed_filename = "test_not_indexed.sequence";
+
+    TestDataSequence::attributes_t attributes;
+    attributes.insert(std::make_pair("name", "test_indexed_data_sequence"));
+
+    const int num_messages = 500;
+
+    // write output data, with and without index --
+    {
+        TestDataSequence indexed_sequence(indexed_filename, attributes), not_indexed_sequence(not_indexed_filename, attributes);
+        indexed_sequence.enable_index_footer();
+
+        for(int i=0; i < num_messages; i+=1)
+        {
+            TestData data;
+            data.set_int_value(i);
+            data.set_string_value(string(i % 17, 'x'));
+            indexed_sequence << data;
+            not_indexed_sequence << data;
+        }
+    }
+
+    BOOST_REQUIRE(boost::filesystem::file_size(indexed_filename) > boost::filesystem::file_size(not_indexed_filename));
+
+    const string filenames[2] = { indexed_filename, not_indexed_filename };
+    for(int file_index = 0; file_index < 2; file_index += 1)
+    {
+        TestDataSequence input_sequence(filenames[file_index]);
+        BOOST_CHECK(input_sequence.get_attributes() == attributes);
+        BOOST_REQUIRE_EQUAL(input_sequence.get_num_messages(), static_cast<size_t>(num_messages));
+
+        TestData data;
+        input_sequence.read_at(321, data);
+        BOOST_CHECK_EQUAL(data.int_value(), 321);
+        BOOST_CHECK_EQUAL(data.string_value(), string(321 % 17, 'x'));
+        BOOST_CHECK_THROW(input_sequence.read_at(num_messages, data), std::out_of_range);
+
+        // random access does not modify the sequential reading
+        for(int i=0; i < num_messages; i+=1)
+        {
+            input_sequence >> data;
+            BOOST_REQUIRE_EQUAL(data.int_value(), i);
+        }
+        BOOST_CHECK_THROW(input_sequence >> data, std::runtime_error);
+
+        std::vector<int> visited_int_values(num_messages, -1);
+        VisitMessagesFunctor functor(visited_int_values);
+        input_sequence.for_each_in_parallel(functor);
+        for(int i=0; i < num_messages; i+=1)
+        {
+            BOOST_REQUIRE_EQUAL(visited_int_values[i], i);
+        }
+    }
+
+    return;
+} // end of "BOOST_AUTO_TEST_CASE"
@@ -12,7 +12,16 @@
 
 #include "applications/objects_detection/ObjectsDetectionApplication.hpp"
 #include "objects_detection/integral_channels/AngleBinComputer.hpp"
-
+#include "objects_detection/IntegralChannelsDetector.hpp"
+#include "objects_detection/ObjectsDetectorFactory.hpp"
+#include "objects_detection/CompiledSoftCascadeOverIntegralChannels.hpp"
+#include "objects_detection/compiled_detector_model.pb.h"
+#include "objects_detection/integral_channels/IntegralChannelsForPedestrians.hpp"
+#include "objects_detection/integral_channels/IntegralChannelsPyramid.hpp"
+#include "objects_detection/non_maximal_suppression/GreedyNonMaximalSuppression.hpp"
+#include "objects_detection/non_maximal_suppression/IndexedGreedyNonMaximalSuppression.hpp"
+
+#include <boost/gil/image.hpp>
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/image_view_factory.hpp>
 #include <boost/gil/extension/opencv/ipl_image_wrapper.hpp>
@@ -29,6 +38,8 @@
 
 #include <omp.h>
 
+#include <cmath>
+
 using namespace doppia;
 using namespace boost;
 
@@ -92,6 +103,55 @@ BOOST_AUTO_TEST_CASE(TestIntegrate)
 } // end of "BOOST_AUTO_TEST_CASE TestIntegrate"
 
 
+BOOST_AUTO_TEST_CASE(IntegrateSpeedTestCase)
+{
+    // compares the original scalar integrate (integrate_v0) with the SSE2 version,
+    // on the channels sizes used at the different pyramid levels
+    const int num_repetitions = 50;
+    const size_t channels_sizes[][2] = { {120, 160}, {121, 163}, {480, 640}, {960, 1280} };
+
+    for(size_t size_index=0; size_index < sizeof(channels_sizes)/sizeof(channels_sizes[0]); size_index+=1)
+    {
+        const size_t height = channels_sizes[size_index][0], width = channels_sizes[size_index][1];
+
+        multi_array<uint16_t, 2> random_channel(extents[height][width]);
+        for(size_t y=0; y < height; y+=1 )
+        {
+            for(size_t x=0; x < width; x+=1 )
+            {
+                random_channel[y][x] = pixel_value_generator()*4;
+            } // end of "for each col"
+        } // end of "for each row"
+
+        multi_array<uint32_t, 2>
+                channel_integral_v0(extents[height + 1][width + 1]),
+                channel_integral(extents[height + 1][width + 1]);
+
+        double start_wall_time = omp_get_wtime();
+        for(int i=0; i < num_repetitions; i+=1)
+        {
+            doppia::integrate_v0(random_channel, channel_integral_v0);
+        }
+        const double v0_time = (omp_get_wtime() - start_wall_time) / num_repetitions;
+
+        start_wall_time = omp_get_wtime();
+        for(int i=0; i < num_repetitions; i+=1)
+        {
+            doppia::integrate(random_channel, channel_integral);
+        }
+        const double time = (omp_get_wtime() - start_wall_time) / num_repetitions;
+
+        printf("Integrating a %zix%zi channel took %.3f [ms] with integrate_v0 and %.3f [ms] with integrate (%.2fx)\n",
+               width, height, v0_time*1000, time*1000, v0_time/time);
+
+        BOOST_REQUIRE(channel_integral_v0 == channel_integral);
+    } // end of "for each channel size"
+
+    printf("IntegrateSpeedTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE IntegrateSpeedTestCase"
+
+
 
 BOOST_AUTO_TEST_CASE(FpdwVsChnFtrsTestCase)
 {
@@ -467,3 +527,777 @@ BOOST_AUTO_TEST_CASE(CpuResizeTestCase)
 
 } // end of "BOOST_AUTO_TEST_CASE CpuResizeTestCase"
 
+
+
+/// fills the integral channels with the integral of random channels
+void create_random_integral_channels(IntegralChannelsForPedestrians::integral_channels_t &integral_channels)
+{
+    const int
+            num_channels = integral_channels.shape()[0],
+            channel_height = integral_channels.shape()[1] - 1,
+            channel_width = integral_channels.shape()[2] - 1;
+
+    multi_array<uint8_t, 2> random_channel(extents[channel_height][channel_width]);
+    multi_array<uint32_t, 2> channel_integral(extents[channel_height + 1][channel_width + 1]);
+
+    for(int channel_index=0; channel_index < num_channels; channel_index +=1)
+    {
+        for(int y=0; y < channel_height; y+=1 )
+        {
+            for(int x=0; x < channel_width; x+=1 )
+            {
+                random_channel[y][x] = pixel_value_generator();
+            } // end of "for each col"
+        } // end of "for each row"
+
+        doppia::integrate(random_channel, channel_integral);
+        integral_channels[channel_index] = channel_integral;
+    } // end of "for each channel"
+
+    return;
+}
+
+
+/// leaves weights have a positive drift, the cascade thresholds follow it,
+/// so that a fraction of the windows is rejected at each depth of the cascade
+void create_random_cascade(const int num_channels, const int window_width, const int window_height,
+                           IntegralChannelsDetector::cascade_stages_t &cascade_stages)
+{
+    typedef IntegralChannelsFeature::rectangle_t rectangle_t;
+
+    uniform_real<float> unit_distribution(0, 1);
+    variate_generator<mt19937&, uniform_real<float> > unit_generator(random_generator, unit_distribution);
+    uniform_int<> x_distribution(0, window_width - 1), y_distribution(0, window_height - 1),
+            channel_distribution(0, num_channels - 1);
+    variate_generator<mt19937&, uniform_int<> >
+            x_generator(random_generator, x_distribution),
+            y_generator(random_generator, y_distribution),
+            channel_generator(random_generator, channel_distribution);
+
+    for(size_t stage_index=0; stage_index < cascade_stages.size(); stage_index +=1)
+    {
+        SoftCascadeOverIntegralChannelsFastStage &stage = cascade_stages[stage_index];
+        Level2DecisionTreeWithWeights &tree = stage.weak_classifier;
+
+        SimpleDecisionStump *nodes[3] = { &tree.level1_node, &tree.level2_true_node, &tree.level2_false_node };
+        for(int node_index = 0; node_index < 3; node_index +=1)
+        {
+            SimpleDecisionStump &node = *nodes[node_index];
+            node.feature.channel_index = channel_generator();
+
+            const int min_x = x_generator(), min_y = y_generator();
+            const int
+                    max_x = min_x + 1 + (x_generator() % (window_width - min_x)),
+                    max_y = min_y + 1 + (y_generator() % (window_height - min_y));
+            node.feature.box = rectangle_t(rectangle_t::point_type(min_x, min_y),
+                                           rectangle_t::point_type(max_x, max_y));
+
+            const float box_area = (max_x - min_x)*(max_y - min_y);
+            node.feature_threshold = box_area * 255 * unit_generator();
+        }
+
+        tree.level2_true_node.weight_true_leaf = unit_generator()*0.15f - 0.05f;
+        tree.level2_true_node.weight_false_leaf = unit_generator()*0.15f - 0.05f;
+        tree.level2_false_node.weight_true_leaf = unit_generator()*0.15f - 0.05f;
+        tree.level2_false_node.weight_false_leaf = unit_generator()*0.15f - 0.05f;
+        tree.compute_bounding_box();
+
+        stage.cascade_threshold = stage_index*0.025f - 1.5f;
+    } // end of "for each stage"
+
+    return;
+}
+
+
+/// search the whole integral channels at scale 1, with the given (shrunk) model window size
+void create_full_search_scale_data(const int channel_width, const int channel_height,
+                                   const int window_width, const int window_height,
+                                   const int x_stride,
+                                   ScaleData &scale_data)
+{
+    scale_data.scaled_input_image_size = ScaleData::image_size_t(channel_width, channel_height);
+    scale_data.scaled_detection_window_size =
+            AbstractObjectsDetector::detection_window_size_t(window_width, window_height);
+    scale_data.stride = ScaleData::stride_t(x_stride, 1);
+    scale_data.scaled_search_range.detection_window_scale = 1;
+    scale_data.scaled_search_range.detection_window_ratio = 1;
+    scale_data.scaled_search_range.range_scaling = 1;
+    scale_data.scaled_search_range.range_ratio = 1;
+    scale_data.scaled_search_range.min_x = 0;
+    scale_data.scaled_search_range.min_y = 0;
+    scale_data.scaled_search_range.max_x = channel_width - window_width;
+    scale_data.scaled_search_range.max_y = channel_height - window_height;
+    return;
+}
+
+
+/// scratch buffers and outputs of doppia::compute_detections_at_specific_scale
+struct ScaleEvaluationBuffers
+{
+    IntegralChannelsDetector::stages_left_in_the_row_t stages_left_in_the_row;
+    IntegralChannelsDetector::stages_left_t stages_left;
+    IntegralChannelsDetector::detections_scores_t detections_scores;
+    IntegralChannelsDetector::num_evaluated_stages_t num_evaluated_stages;
+    IntegralChannelsDetector::detections_t detections;
+};
+
+
+void allocate_scale_evaluation_buffers(const int channel_width, const int channel_height,
+                                       ScaleEvaluationBuffers &buffers)
+{
+    buffers.stages_left_in_the_row.resize(channel_height + 1);
+    buffers.stages_left.resize(extents[channel_height + 1][channel_width + 1]);
+    buffers.detections_scores.resize(extents[channel_height + 1][channel_width + 1]);
+    buffers.num_evaluated_stages.resize(extents[channel_height + 1][channel_width + 1]);
+    buffers.detections.clear();
+    return;
+}
+
+
+BOOST_AUTO_TEST_CASE(WindowMajorVsStageMajorCascadeTestCase)
+{
+    typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
+    typedef IntegralChannelsDetector::cascade_stages_t cascade_stages_t;
+
+    const int
+            num_channels = 10,
+            channel_height = 60, channel_width = 80,
+            // (shrunk) model window size
+            window_height = 32, window_width = 16,
+            num_stages = 1000,
+            // we also collect the partial detections (at the image bottom and right borders)
+            min_evaluated_stages = 0;
+
+    // create random integral channels --
+    integral_channels_t integral_channels(extents[num_channels][channel_height + 1][channel_width + 1]);
+    create_random_integral_channels(integral_channels);
+
+    // create a random cascade --
+    cascade_stages_t cascade_stages(num_stages);
+    create_random_cascade(num_channels, window_width, window_height, cascade_stages);
+
+    ScaleData scale_data;
+    create_full_search_scale_data(channel_width, channel_height, window_width, window_height, 2, scale_data);
+
+    const AbstractObjectsDetector::detection_window_size_t detection_window_size(64, 128);
+    const float score_threshold = 0;
+
+    // compute both versions --
+    ScaleEvaluationBuffers stage_major, window_major;
+    allocate_scale_evaluation_buffers(channel_width, channel_height, stage_major);
+    allocate_scale_evaluation_buffers(channel_width, channel_height, window_major);
+
+    double start_wall_time = omp_get_wtime();
+    doppia::compute_detections_at_specific_scale(
+                stage_major.stages_left_in_the_row, stage_major.stages_left,
+                stage_major.detections_scores, stage_major.num_evaluated_stages,
+                integral_channels, detection_window_size, 1.0f,
+                stage_major.detections, NULL,
+                cascade_stages, score_threshold, min_evaluated_stages, scale_data,
+                false, false, false, true);
+    const double stage_major_time = omp_get_wtime() - start_wall_time;
+
+    start_wall_time = omp_get_wtime();
+    doppia::compute_detections_at_specific_scale_window_major(
+                window_major.stages_left_in_the_row, window_major.stages_left,
+                window_major.detections_scores, window_major.num_evaluated_stages,
+                integral_channels, detection_window_size, 1.0f,
+                window_major.detections, NULL,
+                cascade_stages, score_threshold, min_evaluated_stages, scale_data,
+                false, false, false, true);
+    const double window_major_time = omp_get_wtime() - start_wall_time;
+
+    printf("Stage-major evaluation took %.3f [ms], window-major evaluation took %.3f [ms]\n",
+           stage_major_time*1000, window_major_time*1000);
+
+    // compare the results --
+    const DetectorSearchRange &search_range = scale_data.scaled_search_range;
+    for(size_t y=search_range.min_y; y < search_range.max_y; y+=scale_data.stride.y())
+    {
+        for(size_t x=search_range.min_x; x < search_range.max_x; x+=scale_data.stride.x())
+        {
+            // we expect the exact same scores
+            BOOST_REQUIRE_EQUAL(stage_major.detections_scores[y][x], window_major.detections_scores[y][x]);
+            BOOST_REQUIRE_EQUAL(stage_major.num_evaluated_stages[y][x], window_major.num_evaluated_stages[y][x]);
+        } // end of "for each col"
+    } // end of "for each row"
+
+    printf("Found %zi detections\n", stage_major.detections.size());
+    BOOST_REQUIRE_EQUAL(stage_major.detections.size(), window_major.detections.size());
+    for(size_t i=0; i < stage_major.detections.size(); i+=1)
+    {
+        BOOST_REQUIRE_EQUAL(stage_major.detections[i].score, window_major.detections[i].score);
+        BOOST_REQUIRE(stage_major.detections[i].bounding_box == window_major.detections[i].bounding_box);
+    }
+
+    // the compiled cascade read from a file should be identical to the freshly compiled one --
+    {
+        const CompiledSoftCascadeOverIntegralChannels compiled_cascade(cascade_stages);
+        doppia_protobuf::CompiledSoftCascade compiled_cascade_message;
+        compiled_cascade.to_protobuf(1.0f, window_width, window_height, compiled_cascade_message);
+
+        std::string serialized_message;
+        BOOST_REQUIRE(compiled_cascade_message.SerializeToString(&serialized_message));
+        BOOST_REQUIRE(compiled_cascade_message.ParseFromString(serialized_message));
+        const CompiledSoftCascadeOverIntegralChannels loaded_cascade(compiled_cascade_message);
+
+        BOOST_REQUIRE_EQUAL(loaded_cascade.get_source_checksum(),
+                            CompiledSoftCascadeOverIntegralChannels::compute_checksum(cascade_stages));
+        BOOST_REQUIRE_EQUAL(loaded_cascade.get_num_stages(), cascade_stages.size());
+        BOOST_REQUIRE(loaded_cascade.nodes_channel_index == compiled_cascade.nodes_channel_index);
+        BOOST_REQUIRE(loaded_cascade.nodes_min_x == compiled_cascade.nodes_min_x);
+        BOOST_REQUIRE(loaded_cascade.nodes_min_y == compiled_cascade.nodes_min_y);
+        BOOST_REQUIRE(loaded_cascade.nodes_max_x == compiled_cascade.nodes_max_x);
+        BOOST_REQUIRE(loaded_cascade.nodes_max_y == compiled_cascade.nodes_max_y);
+        BOOST_REQUIRE(loaded_cascade.nodes_threshold == compiled_cascade.nodes_threshold);
+        BOOST_REQUIRE(loaded_cascade.leaves_weights == compiled_cascade.leaves_weights);
+        BOOST_REQUIRE(loaded_cascade.cascade_thresholds == compiled_cascade.cascade_thresholds);
+    }
+
+    printf("WindowMajorVsStageMajorCascadeTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE WindowMajorVsStageMajorCascadeTestCase"
+
+
+/// reads a color image from disk, the returned view points to the data of input_image
+gil::rgb8c_view_t read_rgb_image(const std::string &image_path, cv::Mat &input_image)
+{
+    input_image = cv::imread(image_path);
+    if(input_image.empty())
+    {
+        printf("Failed to read %s (the test should be launched from the tests/objects_detection folder)\n",
+               image_path.c_str());
+    }
+    BOOST_REQUIRE(input_image.empty() == false);
+    cv::cvtColor(input_image, input_image, CV_BGR2RGB);
+
+    return gil::interleaved_view(input_image.cols, input_image.rows,
+                                 reinterpret_cast<gil::rgb8c_pixel_t*>(input_image.data),
+                                 static_cast<size_t>(input_image.step));
+}
+
+
+/// computes the integral channels of a color image read from disk
+void compute_integral_channels_from_file(const std::string &image_path,
+                                         IntegralChannelsForPedestrians::integral_channels_t &integral_channels)
+{
+    cv::Mat input_image;
+    const gil::rgb8c_view_t input_view = read_rgb_image(image_path, input_image);
+
+    IntegralChannelsForPedestrians integral_channels_computer;
+    integral_channels_computer.set_image(input_view);
+    integral_channels_computer.compute();
+
+    const IntegralChannelsForPedestrians::integral_channels_t &computed_integral_channels =
+            integral_channels_computer.get_integral_channels();
+    integral_channels.resize(extents[computed_integral_channels.shape()[0]]
+                             [computed_integral_channels.shape()[1]]
+                             [computed_integral_channels.shape()[2]]);
+    integral_channels = computed_integral_channels;
+    return;
+}
+
+
+BOOST_AUTO_TEST_CASE(IntegerVsFloatFeaturesTestCase)
+{
+    typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
+    typedef IntegralChannelsDetector::cascade_stages_t cascade_stages_t;
+
+    const int
+            num_channels = 10,
+            // (shrunk) model window size
+            window_height = 32, window_width = 16,
+            num_stages = 1000,
+            min_evaluated_stages = 0;
+
+    cascade_stages_t cascade_stages(num_stages);
+    create_random_cascade(num_channels, window_width, window_height, cascade_stages);
+
+    // the thresholds obtained from the FPDW rescaling are usually not integers,
+    // we also check the integer (and half integer) values
+    for(int stage_index=0; stage_index < num_stages; stage_index +=1)
+    {
+        Level2DecisionTreeWithWeights &tree = cascade_stages[stage_index].weak_classifier;
+        if((stage_index % 3) == 0)
+        {
+            tree.level1_node.feature_threshold = std::floor(tree.level1_node.feature_threshold);
+            tree.level2_true_node.feature_threshold = std::floor(tree.level2_true_node.feature_threshold);
+        }
+        else if((stage_index % 3) == 1)
+        {
+            tree.level2_false_node.feature_threshold = std::floor(tree.level2_false_node.feature_threshold) + 0.5f;
+        }
+    }
+
+    // the channels values of real images are far from uniform (large flat areas, strong edges),
+    // which is where the float and integer comparisons could disagree
+    std::vector<std::string> images_paths;
+    images_paths.push_back("../../../data/sample_test_images/bahnhof/image_00000000_0.png");
+    images_paths.push_back("../../../data/sample_test_images/inria/person_009.png");
+
+    for(size_t image_index=0; image_index < images_paths.size(); image_index+=1)
+    {
+        integral_channels_t integral_channels;
+        compute_integral_channels_from_file(images_paths[image_index], integral_channels);
+        BOOST_REQUIRE_EQUAL(integral_channels.shape()[0], static_cast<size_t>(num_channels));
+
+        const int
+                channel_height = integral_channels.shape()[1] - 1,
+                channel_width = integral_channels.shape()[2] - 1;
+
+        ScaleData scale_data;
+        create_full_search_scale_data(channel_width, channel_height, window_width, window_height, 1, scale_data);
+
+        const AbstractObjectsDetector::detection_window_size_t detection_window_size(64, 128);
+        const float score_threshold = 0;
+
+        ScaleEvaluationBuffers float_features, integer_features;
+        allocate_scale_evaluation_buffers(channel_width, channel_height, float_features);
+        allocate_scale_evaluation_buffers(channel_width, channel_height, integer_features);
+
+        double start_wall_time = omp_get_wtime();
+        doppia::compute_detections_at_specific_scale(
+                    float_features.stages_left_in_the_row, float_features.stages_left,
+                    float_features.detections_scores, float_features.num_evaluated_stages,
+                    integral_channels, detection_window_size, 1.0f,
+                    float_features.detections, NULL,
+                    cascade_stages, score_threshold, min_evaluated_stages, scale_data,
+                    false, false, false, true, false); // float features
+        const double float_time = omp_get_wtime() - start_wall_time;
+
+        start_wall_time = omp_get_wtime();
+        doppia::compute_detections_at_specific_scale(
+                    integer_features.stages_left_in_the_row, integer_features.stages_left,
+                    integer_features.detections_scores, integer_features.num_evaluated_stages,
+                    integral_channels, detection_window_size, 1.0f,
+                    integer_features.detections, NULL,
+                    cascade_stages, score_threshold, min_evaluated_stages, scale_data,
+                    false, false, false, true, true); // integer features
+        const double integer_time = omp_get_wtime() - start_wall_time;
+
+        printf("%s: float features evaluation took %.3f [ms], integer features evaluation took %.3f [ms]\n",
+               images_paths[image_index].c_str(), float_time*1000, integer_time*1000);
+
+        // we expect the exact same scores, including the partial detections rows and columns
+        for(int y=0; y < channel_height; y+=1)
+        {
+            for(int x=0; x < channel_width; x+=1)
+            {
+                BOOST_REQUIRE_EQUAL(float_features.detections_scores[y][x],
+                                    integer_features.detections_scores[y][x]);
+                BOOST_REQUIRE_EQUAL(float_features.num_evaluated_stages[y][x],
+                                    integer_features.num_evaluated_stages[y][x]);
+            } // end of "for each col"
+        } // end of "for each row"
+
+        printf("Found %zi detections\n", float_features.detections.size());
+        BOOST_REQUIRE_EQUAL(float_features.detections.size(), integer_features.detections.size());
+        for(size_t i=0; i < float_features.detections.size(); i+=1)
+        {
+            BOOST_REQUIRE_EQUAL(float_features.detections[i].score, integer_features.detections[i].score);
+            BOOST_REQUIRE(float_features.detections[i].bounding_box == integer_features.detections[i].bounding_box);
+        }
+    } // end of "for each test image"
+
+    printf("IntegerVsFloatFeaturesTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE IntegerVsFloatFeaturesTestCase"
+
+
+/// creates the options of a cpu_channels detector running the multiscales model of the repository
+void create_multiscales_detector_options(const bool use_integer_features,
+                                         program_options::variables_map &options)
+{
+    std::vector<std::string> args;
+    args.push_back("--objects_detector.method");
+    args.push_back("cpu_channels");
+    args.push_back("--objects_detector.model");
+    args.push_back("../../../data/trained_models/"
+                   "2012_04_04_1417_trained_model_multiscales_synthetic_softcascade.proto.bin");
+    // we compare the raw detections
+    args.push_back("--objects_detector.non_maximal_suppression_method");
+    args.push_back("none");
+    args.push_back("--objects_detector.integer_features");
+    args.push_back(use_integer_features? "true" : "false");
+
+    options.clear();
+    program_options::store(program_options::command_line_parser(args)
+                           .options(ObjectsDetectorFactory::get_args_options()).run(), options);
+    program_options::notify(options);
+    return;
+}
+
+
+BOOST_AUTO_TEST_CASE(MultiscalesIntegerVsFloatFeaturesTestCase)
+{
+    // same as IntegerVsFloatFeaturesTestCase, but running the full detector,
+    // over all the scales of a trained multiscales model.
+    // With model scales 0.5 to 8 and min_scale 0.3, a VGA image is upscaled at most 1/0.6 times,
+    // the integral channels values stay below 2^24, so the float features are exact
+    program_options::variables_map float_features_options, integer_features_options;
+    create_multiscales_detector_options(false, float_features_options);
+    create_multiscales_detector_options(true, integer_features_options);
+
+    const boost::shared_ptr<const SharedDetectorModel>
+            model_p = ObjectsDetectorFactory::new_shared_model(float_features_options);
+
+    scoped_ptr<AbstractObjectsDetector>
+            float_features_detector_p(ObjectsDetectorFactory::new_instance(float_features_options, *model_p)),
+            integer_features_detector_p(ObjectsDetectorFactory::new_instance(integer_features_options, *model_p));
+
+    std::vector<std::string> images_paths;
+    images_paths.push_back("../../../data/sample_test_images/bahnhof/image_00000000_0.png");
+    images_paths.push_back("../../../data/sample_test_images/inria/person_009.png");
+
+    for(size_t image_index=0; image_index < images_paths.size(); image_index+=1)
+    {
+        cv::Mat input_image;
+        const gil::rgb8c_view_t input_view = read_rgb_image(images_paths[image_index], input_image);
+
+        float_features_detector_p->set_image(input_view);
+        double start_wall_time = omp_get_wtime();
+        float_features_detector_p->compute();
+        const double float_time = omp_get_wtime() - start_wall_time;
+
+        integer_features_detector_p->set_image(input_view);
+        start_wall_time = omp_get_wtime();
+        integer_features_detector_p->compute();
+        const double integer_time = omp_get_wtime() - start_wall_time;
+
+        printf("%s: float features detector took %.3f [ms], integer features detector took %.3f [ms]\n",
+               images_paths[image_index].c_str(), float_time*1000, integer_time*1000);
+
+        const AbstractObjectsDetector::detections_t
+                &float_features_detections = float_features_detector_p->get_detections(),
+                &integer_features_detections = integer_features_detector_p->get_detections();
+
+        printf("Found %zi detections\n", float_features_detections.size());
+        BOOST_REQUIRE_EQUAL(float_features_detections.size(), integer_features_detections.size());
+        for(size_t i=0; i < float_features_detections.size(); i+=1)
+        {
+            BOOST_REQUIRE_EQUAL(float_features_detections[i].score, integer_features_detections[i].score);
+            BOOST_REQUIRE(float_features_detections[i].bounding_box == integer_features_detections[i].bounding_box);
+        }
+    } // end of "for each test image"
+
+    printf("MultiscalesIntegerVsFloatFeaturesTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE MultiscalesIntegerVsFloatFeaturesTestCase"
+
+
+/// gives access to the different IntegralChannelsForPedestrians implementations
+class IntegralChannelsForPedestriansVersions: public IntegralChannelsForPedestrians
+{
+public:
+    using IntegralChannelsForPedestrians::compute_v1;
+    using IntegralChannelsForPedestrians::compute_v2;
+};
+
+
+BOOST_AUTO_TEST_CASE(SinglePassVsSeparateIntegralChannelsTestCase)
+{
+    typedef IntegralChannelsForPedestrians::channels_t channels_t;
+    typedef IntegralChannelsForPedestrians::integral_channels_t integral_channels_t;
+
+    const int input_width = 641, input_height = 479; // not multiples of the shrinking factor
+
+    gil::rgb8_image_t input_image(input_width, input_height);
+    gil::rgb8_view_t input_view = gil::view(input_image);
+    for(int y=0; y < input_height; y+=1)
+    {
+        for(int x=0; x < input_width; x+=1)
+        {
+            // random noise over a smooth gradient, to have both strong and weak edges
+            gil::rgb8_pixel_t &pixel = input_view(x, y);
+            pixel[0] = pixel_value_generator();
+            pixel[1] = (x + y) % 256;
+            pixel[2] = (x % 32 < 16)? pixel_value_generator() : y % 256;
+        } // end of "for each col"
+    } // end of "for each row"
+
+    IntegralChannelsForPedestriansVersions integral_channels_computer;
+    integral_channels_computer.set_image(gil::const_view(input_image));
+
+    double start_wall_time = omp_get_wtime();
+    integral_channels_computer.compute_v1();
+    const double v1_time = omp_get_wtime() - start_wall_time;
+    const channels_t channels_v1 = integral_channels_computer.get_channels();
+
+    // compute_v1 is the default, compute_v2 is only used when requested
+    integral_channels_computer.compute();
+    BOOST_REQUIRE(integral_channels_computer.get_channels() == channels_v1);
+
+    start_wall_time = omp_get_wtime();
+    integral_channels_computer.compute_v2();
+    const double v2_time = omp_get_wtime() - start_wall_time;
+    const channels_t &channels_v2 = integral_channels_computer.get_channels();
+    const integral_channels_t &integral_channels_v2 = integral_channels_computer.get_integral_channels();
+
+    printf("compute_v1 took %.3f [ms], compute_v2 took %.3f [ms]\n", v1_time*1000, v2_time*1000);
+
+    BOOST_REQUIRE(std::equal(channels_v1.shape(), channels_v1.shape() + 3, channels_v2.shape()));
+
+    const int
+            num_channels = channels_v2.shape()[0],
+            channels_height = channels_v2.shape()[1],
+            channels_width = channels_v2.shape()[2];
+
+    // the gradient orientation may differ on the bins frontiers (floating point rounding),
+    // and the last row and column of the shrunk channels use plain averages instead of opencv's area weights,
+    // so we only expect small differences
+    size_t num_different_values = 0;
+    for(int c=0; c < num_channels; c+=1)
+    {
+        for(int y=0; y < channels_height; y+=1)
+        {
+            for(int x=0; x < channels_width; x+=1)
+            {
+                const int difference = std::abs(channels_v1[c][y][x] - channels_v2[c][y][x]);
+                if(difference > 0)
+                {
+                    num_different_values += 1;
+                }
+
+                const bool is_orientation_channel = (c < 6);
+                if((is_orientation_channel == false)
+                   and (y < (channels_height - 1)) and (x < (channels_width - 1)))
+                {
+                    BOOST_REQUIRE_LE(difference, 1);
+                }
+            } // end of "for each col"
+        } // end of "for each row"
+    } // end of "for each channel"
+
+    const float fraction_of_different_values =
+            static_cast<float>(num_different_values) / channels_v2.num_elements();
+    printf("%.2f%% of the channels values differ\n", fraction_of_different_values*100);
+    BOOST_REQUIRE_LT(fraction_of_different_values, 0.05f);
+
+    // the integral channels are consistent with the channels
+    for(int c=0; c < num_channels; c+=1)
+    {
+        integral_channels_t::element expected_sum = 0;
+        for(int y=0; y < channels_height; y+=1)
+        {
+            for(int x=0; x < channels_width; x+=1)
+            {
+                expected_sum += channels_v2[c][y][x];
+            }
+        }
+        BOOST_REQUIRE_EQUAL(integral_channels_v2[c][channels_height][channels_width], expected_sum);
+        BOOST_REQUIRE_EQUAL(integral_channels_v2[c][0][channels_width], 0);
+        BOOST_REQUIRE_EQUAL(integral_channels_v2[c][channels_height][0], 0);
+    } // end of "for each channel"
+
+    printf("SinglePassVsSeparateIntegralChannelsTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE SinglePassVsSeparateIntegralChannelsTestCase"
+
+
+BOOST_AUTO_TEST_CASE(IntegralChannelsPyramidTestCase)
+{
+    typedef IntegralChannelsPyramid::input_size_t input_size_t;
+    typedef IntegralChannelsPyramid::integral_channels_t integral_channels_t;
+
+    const int input_width = 640, input_height = 480;
+
+    gil::rgb8_image_t input_image(input_width, input_height);
+    gil::rgb8_view_t input_view = gil::view(input_image);
+    for(int y=0; y < input_height; y+=1)
+    {
+        for(int x=0; x < input_width; x+=1)
+        {
+            // smooth content with a few edges, the channels approximation assumes natural images statistics
+            gil::rgb8_pixel_t &pixel = input_view(x, y);
+            pixel[0] = ((x / 40 + y / 30) % 2)? 200 : 50;
+            pixel[1] = (x + y) % 256;
+            pixel[2] = (y * 255) / input_height;
+        } // end of "for each col"
+    } // end of "for each row"
+
+    // one octave, 8 scales, with a repeated size
+    std::vector<input_size_t> scaled_input_sizes;
+    for(int i=0; i < 8; i+=1)
+    {
+        const float scale = std::pow(2.0f, -i/8.0f);
+        scaled_input_sizes.push_back(input_size_t(input_width*scale, input_height*scale));
+    }
+    scaled_input_sizes.push_back(scaled_input_sizes.back());
+
+    const float gradients_exponent = 0.11, luv_exponent = 0;
+    std::vector<float> channels_scaling_exponents(10, gradients_exponent);
+    std::fill(channels_scaling_exponents.begin() + 7, channels_scaling_exponents.end(), luv_exponent);
+
+    const gil::rgb8c_view_t input_const_view = gil::const_view(input_image);
+
+    IntegralChannelsPyramid real_pyramid(0, channels_scaling_exponents);
+    real_pyramid.set_scales(scaled_input_sizes);
+    real_pyramid.compute(input_const_view);
+    BOOST_REQUIRE_EQUAL(real_pyramid.get_num_levels(), 8);
+    BOOST_REQUIRE_EQUAL(real_pyramid.get_num_real_levels(), 8);
+
+    IntegralChannelsPyramid approximated_pyramid(2, channels_scaling_exponents);
+    approximated_pyramid.set_scales(scaled_input_sizes);
+    approximated_pyramid.compute(input_const_view);
+    BOOST_REQUIRE_EQUAL(approximated_pyramid.get_num_real_levels(), 2);
+
+    // the levels buffers are reused when the scales do not change
+    const boost::uint32_t *first_level_data_p = approximated_pyramid.get_integral_channels(0).data();
+    approximated_pyramid.set_scales(scaled_input_sizes);
+    approximated_pyramid.compute(input_const_view);
+    BOOST_REQUIRE_EQUAL(approximated_pyramid.get_integral_channels(0).data(), first_level_data_p);
+
+    // the real levels match the direct computation
+    IntegralChannelsForPedestrians integral_channels_computer;
+    {
+        cv::Mat scaled_input;
+        const gil::opencv::ipl_image_wrapper input_ipl = gil::opencv::create_ipl_image(input_const_view);
+        const cv::Mat input_mat(input_ipl.get());
+        cv::resize(input_mat, scaled_input,
+                   cv::Size(scaled_input_sizes[1].x, scaled_input_sizes[1].y), 0, 0, cv::INTER_AREA);
+        integral_channels_computer.set_image(
+                    gil::interleaved_view(scaled_input.cols, scaled_input.rows,
+                                          reinterpret_cast<gil::rgb8c_pixel_t*>(scaled_input.data),
+                                          static_cast<size_t>(scaled_input.step)));
+        integral_channels_computer.compute();
+
+        const integral_channels_t &integral_channels = real_pyramid.get_integral_channels(1);
+        BOOST_REQUIRE(integral_channels == integral_channels_computer.get_integral_channels());
+    }
+
+    for(size_t scale_index=0; scale_index < scaled_input_sizes.size(); scale_index+=1)
+    {
+        const integral_channels_t
+                &real_integral_channels = real_pyramid.get_integral_channels(scale_index),
+                &approximated_integral_channels = approximated_pyramid.get_integral_channels(scale_index);
+
+        // same sizes as the direct computation
+        const input_size_t channel_size =
+                IntegralChannelsForPedestrians::get_channel_size(scaled_input_sizes[scale_index]);
+        BOOST_REQUIRE_EQUAL(approximated_integral_channels.shape()[1], channel_size.y + 1);
+        BOOST_REQUIRE_EQUAL(approximated_integral_channels.shape()[2], channel_size.x + 1);
+        BOOST_REQUIRE(std::equal(real_integral_channels.shape(), real_integral_channels.shape() + 3,
+                                 approximated_integral_channels.shape()));
+
+        // the colors are scale invariant, the approximated mean values should be close to the real ones
+        for(size_t channel_index = 7; channel_index < 10; channel_index +=1)
+        {
+            const float
+                    real_sum = real_integral_channels[channel_index][channel_size.y][channel_size.x],
+                    approximated_sum = approximated_integral_channels[channel_index][channel_size.y][channel_size.x];
+            BOOST_REQUIRE_CLOSE(approximated_sum, real_sum, 2.0f); // percent
+        }
+    } // end of "for each scale"
+
+    printf("IntegralChannelsPyramidTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE IntegralChannelsPyramidTestCase"
+
+
+/// raw detections similar to the detector output, clusters of windows around each object
+/// (over neighbouring positions and scales), plus isolated false positives
+void create_random_detections(const size_t num_detections, AbstractObjectsDetector::detections_t &detections)
+{
+    typedef AbstractObjectsDetector::detection_t detection_t;
+
+    uniform_real<float> unit_distribution(0, 1);
+    variate_generator<mt19937&, uniform_real<float> > unit_generator(random_generator, unit_distribution);
+
+    const int image_width = 1280, image_height = 960;
+    const float min_height = 48, max_height = 600;
+
+    detections.clear();
+    while(detections.size() < num_detections)
+    {
+        const bool is_false_positive = (detections.size() % 10) == 0;
+        const int num_windows = is_false_positive? 1 : 200;
+
+        const float
+                object_height = min_height + (max_height - min_height)*unit_generator()*unit_generator(),
+                object_x = unit_generator()*image_width,
+                object_y = unit_generator()*image_height;
+
+        for(int i=0; (i < num_windows) and (detections.size() < num_detections); i+=1)
+        {
+            const float
+                    height = object_height * (0.8f + 0.4f*unit_generator()),
+                    x = object_x + height*(unit_generator() - 0.5f)*0.2f,
+                    y = object_y + height*(unit_generator() - 0.5f)*0.2f;
+
+            detection_t detection;
+            detection.object_class = detection_t::Pedestrian;
+            detection.bounding_box.min_corner().x(x - height/4);
+            detection.bounding_box.min_corner().y(y - height/2);
+            detection.bounding_box.max_corner().x(x + height/4);
+            detection.bounding_box.max_corner().y(y + height/2);
+            // quantized scores (positive and negative), so that some detections have the same score
+            detection.score = static_cast<int>(unit_generator()*1000) / 100.0f - 5;
+#if defined(TESTING)
+            detection.detector_index = 0;
+#endif
+            detections.push_back(detection);
+        } // end of "for each window"
+    } // end of "while not enough detections"
+
+    return;
+}
+
+
+BOOST_AUTO_TEST_CASE(IndexedVsGreedyNonMaximalSuppressionTestCase)
+{
+    typedef AbstractObjectsDetector::detections_t detections_t;
+
+    const size_t num_detections = 10000;
+    const int num_repetitions = 5;
+    const float overlap_thresholds[] = { 0.65f, 0.3f, 0.9f };
+
+    detections_t detections;
+    create_random_detections(num_detections, detections);
+
+    for(size_t threshold_index=0; threshold_index < sizeof(overlap_thresholds)/sizeof(overlap_thresholds[0]);
+        threshold_index+=1)
+    {
+        const float overlap_threshold = overlap_thresholds[threshold_index];
+        GreedyNonMaximalSuppression greedy_non_maximal_suppression(overlap_threshold);
+        IndexedGreedyNonMaximalSuppression indexed_non_maximal_suppression(overlap_threshold);
+
+        double start_wall_time = omp_get_wtime();
+        for(int i=0; i < num_repetitions; i+=1)
+        {
+            greedy_non_maximal_suppression.set_detections(detections);
+            greedy_non_maximal_suppression.compute();
+        }
+        const double greedy_time = (omp_get_wtime() - start_wall_time) / num_repetitions;
+
+        start_wall_time = omp_get_wtime();
+        for(int i=0; i < num_repetitions; i+=1)
+        {
+            indexed_non_maximal_suppression.set_detections(detections);
+            indexed_non_maximal_suppression.compute();
+        }
+        const double indexed_time = (omp_get_wtime() - start_wall_time) / num_repetitions;
+
+        const detections_t
+                &greedy_detections = greedy_non_maximal_suppression.get_detections(),
+                &indexed_detections = indexed_non_maximal_suppression.get_detections();
+
+        printf("Non maximal suppression of %zi detections (overlap threshold %.2f, %zi kept) "
+               "took %.3f [ms] with greedy and %.3f [ms] with greedy_indexed (%.2fx)\n",
+               detections.size(), overlap_threshold, greedy_detections.size(),
+               greedy_time*1000, indexed_time*1000, greedy_time/indexed_time);
+
+        BOOST_REQUIRE_EQUAL(greedy_detections.size(), indexed_detections.size());
+        for(size_t i=0; i < greedy_detections.size(); i+=1)
+        {
+            const AbstractObjectsDetector::detection_t &a = greedy_detections[i], &b = indexed_detections[i];
+            BOOST_REQUIRE_EQUAL(a.score, b.score);
+            BOOST_REQUIRE_EQUAL(a.bounding_box.min_corner().x(), b.bounding_box.min_corner().x());
+            BOOST_REQUIRE_EQUAL(a.bounding_box.min_corner().y(), b.bounding_box.min_corner().y());
+            BOOST_REQUIRE_EQUAL(a.bounding_box.max_corner().x(), b.bounding_box.max_corner().x());
+            BOOST_REQUIRE_EQUAL(a.bounding_box.max_corner().y(), b.bounding_box.max_corner().y());
+        }
+    } // end of "for each overlap threshold"
+
+    printf("IndexedVsGreedyNonMaximalSuppressionTestCase passed. Yey!\n\n");
+
+} // end of "BOOST_AUTO_TEST_CASE IndexedVsGreedyNonMaximalSuppressionTestCase"
@@ -0,0 +1,221 @@
+
+/// To be used as
+/// cmake ./ && make -j2 && ./test_objects_tracking
+
+#define BOOST_TEST_MODULE TestObjectsTracking
+#include <boost/test/unit_test.hpp>
+
+#include "objects_tracking/DummyObjectsTracker.hpp"
+#include "objects_tracking/IndexedObjectsTracker.hpp"
+
+#include <boost/program_options.hpp>
+#include <boost/random.hpp>
+#include <boost/foreach.hpp>
+
+#include <vector>
+#include <string>
+#include <cstdio>
+
+using namespace doppia;
+using namespace std;
+
+typedef AbstractObjectsTracker::detection_t detection_t;
+typedef AbstractObjectsTracker::detections_t detections_t;
+typedef AbstractObjectsTracker::predicted_regions_t predicted_regions_t;
+typedef detection_t::rectangle_t rectangle_t;
+
+const int image_width = 640, image_height = 480;
+
+
+/// one moving object, the detections are noisy samples of its trajectory
+struct SyntheticObject
+{
+    float x, y, height, delta_x, delta_y, delta_height;
+    detection_t::ObjectClasses object_class;
+};
+
+
+/// creates the detections of num_frames frames,
+/// objects move with constant speed (and scale change), cross each other, enter and leave the image,
+/// and are sometimes missed by the "detector". Some false positives are added too.
+void create_synthetic_detections_sequence(const int num_frames, const int num_objects,
+                                          const boost::uint32_t random_seed,
+                                          std::vector<detections_t> &detections_per_frame)
+{
+    boost::mt19937 random_generator(random_seed);
+    boost::uniform_real<float> unit_distribution(0, 1);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<float> >
+            unit_generator(random_generator, unit_distribution);
+
+    std::vector<SyntheticObject> objects(num_objects);
+    BOOST_FOREACH(SyntheticObject &object, objects)
+    {
+        object.height = 50 + 150*unit_generator();
+        object.x = (image_width + 100)*unit_generator() - 50;
+        object.y = (image_height - object.height)*unit_generator();
+        object.delta_x = 12*unit_generator() - 6;
+        object.delta_y = 2*unit_generator() - 1;
+        object.delta_height = 0.02f*unit_generator() - 0.01f;
+        object.object_class = (unit_generator() < 0.8)? detection_t::Pedestrian : detection_t::Car;
+    }
+
+    const float miss_probability = 0.15, false_positive_probability = 0.3, position_noise = 3;
+
+    detections_per_frame.resize(num_frames);
+    for(int frame_index=0; frame_index < num_frames; frame_index+=1)
+    {
+        detections_t &detections = detections_per_frame[frame_index];
+        detections.clear();
+
+        BOOST_FOREACH(SyntheticObject &object, objects)
+        {
+            object.x += object.delta_x;
+            object.y += object.delta_y;
+            object.height *= (1 + object.delta_height);
+
+            if(unit_generator() < miss_probability)
+            {
+                continue;
+            }
+
+            const float
+                    width = object.height*0.41f,
+                    min_x = object.x + position_noise*(2*unit_generator() - 1),
+                    min_y = object.y + position_noise*(2*unit_generator() - 1);
+
+            detection_t detection;
+            detection.object_class = object.object_class;
+            detection.score = unit_generator();
+            detection.bounding_box.min_corner().x(min_x);
+            detection.bounding_box.min_corner().y(min_y);
+            detection.bounding_box.max_corner().x(min_x + width);
+            detection.bounding_box.max_corner().y(min_y + object.height);
+            detections.push_back(detection);
+        } // end of "for each object"
+
+        while(unit_generator() < false_positive_probability)
+        {
+            const float
+                    height = 50 + 150*unit_generator(),
+                    min_x = (image_width - height*0.41f)*unit_generator(),
+                    min_y = (image_height - height)*unit_generator();
+
+            detection_t detection;
+            detection.object_class = detection_t::Pedestrian;
+            detection.score = unit_generator();
+            detection.bounding_box.min_corner().x(min_x);
+            detection.bounding_box.min_corner().y(min_y);
+            detection.bounding_box.max_corner().x(min_x + height*0.41f);
+            detection.bounding_box.max_corner().y(min_y + height);
+            detections.push_back(detection);
+        }
+    } // end of "for each frame"
+
+    return;
+}
+
+
+void require_equal_detections(const detection_t &a, const detection_t &b)
+{
+    BOOST_REQUIRE_EQUAL(a.object_class, b.object_class);
+    BOOST_REQUIRE_EQUAL(a.score, b.score);
+    BOOST_REQUIRE(a.bounding_box == b.bounding_box);
+    return;
+}
+
+
+/// runs both trackers over the same sequence, and checks that they provide the same tracks at every frame
+void compare_trackers(const std::vector<detections_t> &detections_per_frame,
+                      size_t &num_tracks_sum, size_t &max_num_tracks)
+{
+    using namespace boost::program_options;
+
+    const options_description desc = DummyObjectsTracker::get_args_options();
+    variables_map options;
+    store(command_line_parser(std::vector<std::string>()).options(desc).run(), options);
+    notify(options);
+
+    DummyObjectsTracker dummy_tracker(options);
+    IndexedObjectsTracker indexed_tracker(options);
+    dummy_tracker.set_image_size(image_width, image_height);
+    indexed_tracker.set_image_size(image_width, image_height);
+
+    for(size_t frame_index=0; frame_index < detections_per_frame.size(); frame_index+=1)
+    {
+        dummy_tracker.set_detections(detections_per_frame[frame_index]);
+        dummy_tracker.compute();
+        indexed_tracker.set_detections(detections_per_frame[frame_index]);
+        indexed_tracker.compute();
+
+        // same tracks, in the same order --
+        const DummyObjectsTracker::tracks_t &dummy_tracks = dummy_tracker.get_tracks();
+        const IndexedObjectsTracker::tracks_t &indexed_tracks = indexed_tracker.get_tracks();
+        BOOST_REQUIRE_EQUAL(dummy_tracks.size(), indexed_tracks.size());
+
+        DummyObjectsTracker::tracks_t::const_iterator dummy_tracks_it = dummy_tracks.begin();
+        for(size_t i=0; i < indexed_tracks.size(); i+=1, ++dummy_tracks_it)
+        {
+            const TrackedDetection2d &dummy_track = *dummy_tracks_it, &indexed_track = indexed_tracks[i];
+            BOOST_REQUIRE_EQUAL(dummy_track.get_id(), indexed_track.get_id());
+            BOOST_REQUIRE_EQUAL(dummy_track.get_length(), indexed_track.get_length());
+            BOOST_REQUIRE_EQUAL(dummy_track.get_extrapolation_length(), indexed_track.get_extrapolation_length());
+            BOOST_REQUIRE(dummy_track.get_current_bounding_box() == indexed_track.get_current_bounding_box());
+            require_equal_detections(dummy_track.get_current_detection(), indexed_track.get_current_detection());
+        }
+
+        num_tracks_sum += indexed_tracks.size();
+        max_num_tracks = std::max(max_num_tracks, indexed_tracks.size());
+
+        // same current detections and predicted regions --
+        const detections_t
+                &dummy_detections = dummy_tracker.get_current_detections(),
+                &indexed_detections = indexed_tracker.get_current_detections();
+        BOOST_REQUIRE_EQUAL(dummy_detections.size(), indexed_detections.size());
+        for(size_t i=0; i < dummy_detections.size(); i+=1)
+        {
+            require_equal_detections(dummy_detections[i], indexed_detections[i]);
+        }
+
+        const predicted_regions_t
+                &dummy_regions = dummy_tracker.get_predicted_regions(),
+                &indexed_regions = indexed_tracker.get_predicted_regions();
+        BOOST_REQUIRE_EQUAL(dummy_regions.size(), indexed_regions.size());
+        for(size_t i=0; i < dummy_regions.size(); i+=1)
+        {
+            BOOST_REQUIRE(dummy_regions[i].bounding_box == indexed_regions[i].bounding_box);
+            BOOST_REQUIRE_EQUAL(dummy_regions[i].position_uncertainty, indexed_regions[i].position_uncertainty);
+            BOOST_REQUIRE_EQUAL(dummy_regions[i].scale_uncertainty, indexed_regions[i].scale_uncertainty);
+        }
+    } // end of "for each frame"
+
+    return;
+}
+
+
+BOOST_AUTO_TEST_CASE(IndexedVsDummyObjectsTrackerTestCase)
+{
+    const int num_frames = 200;
+
+    // from a few isolated objects to crowded scenes (many candidate pairs per grid cell)
+    const int num_objects_per_sequence[] = { 1, 5, 20, 60 };
+    const int num_sequences = sizeof(num_objects_per_sequence) / sizeof(num_objects_per_sequence[0]);
+
+    for(int sequence_index=0; sequence_index < num_sequences; sequence_index+=1)
+    {
+        const int num_objects = num_objects_per_sequence[sequence_index];
+
+        std::vector<detections_t> detections_per_frame;
+        create_synthetic_detections_sequence(num_frames, num_objects, 42 + sequence_index, detections_per_frame);
+
+        size_t num_tracks_sum = 0, max_num_tracks = 0;
+        compare_trackers(detections_per_frame, num_tracks_sum, max_num_tracks);
+
+        printf("%i synthetic objects, %.1f tracks per frame on average, %zi at most\n",
+               num_objects, static_cast<float>(num_tracks_sum) / num_frames, max_num_tracks);
+        BOOST_REQUIRE(max_num_tracks > 0);
+    } // end of "for each sequence"
+
+    printf("IndexedVsDummyObjectsTrackerTestCase passed. Yey!\n\n");
+    return;
+} // end of "BOOST_AUTO_TEST_CASE IndexedVsDummyObjectsTrackerTestCase"
+
@@ -89,6 +89,20 @@ ImagesFromDirectory::~ImagesFromDirectory()
 }
 
 bool ImagesFromDirectory::next_frame()
+{
+    if(next_image_path() == false)
+    {
+        return false;
+    }
+
+    // read the image, set the image view
+    input_image_view = open_image(input_image_path, input_image);
+    log_debug() << "read file " << input_image_path << std::endl;
+
+    return true;
+}
+
+bool ImagesFromDirectory::next_image_path()
 {
     filesystem::directory_iterator directory_end_it;
     if(the_directory_iterator == directory_end_it)
@@ -105,10 +119,6 @@ bool ImagesFromDirectory::next_frame()
     input_image_name = the_directory_iterator->path().filename().string();
 #endif
 
-    // read the image, set the image view
-    input_image_view = open_image(the_directory_iterator->path().string(), input_image);
-    log_debug() << "read file " << the_directory_iterator->path() << std::endl;
-
     // move iterator to next image
     ++the_directory_iterator;
     frames_counter+=1;
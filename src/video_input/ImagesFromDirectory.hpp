@@ -32,6 +32,11 @@ public:
     ~ImagesFromDirectory();
 
     bool next_frame();
+
+    /// moves to the next file without reading it (get_image is not updated),
+    /// the image can then be read in another thread via open_image(get_image_path(), image)
+    bool next_image_path();
+
     const input_image_view_t &get_image() const;
     const std::string &get_image_name() const;
     const std::string &get_image_path() const;
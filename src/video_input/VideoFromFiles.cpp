@@ -6,8 +6,10 @@
 #include "helpers/get_option_value.hpp"
 
 #include <limits>
+#include <algorithm>
 
 #include <boost/filesystem.hpp>
+#include <boost/bind.hpp>
 
 #include <boost/gil/image_view.hpp>
 #include <boost/gil/extension/io/png_io.hpp>
@@ -51,6 +53,15 @@ program_options::options_description VideoFromFiles::get_args_options()
 
             ("video_input.end_frame",
              program_options::value<int>(), "last image to read, if omited will read all files matching the masks")
+
+            ("video_input.prefetch_frames",
+             program_options::value<int>()->default_value(3),
+             "number of future frames decoded in advance by background threads. "
+             "0 disables the prefetching (the images are read when requested)")
+
+            ("video_input.prefetch_threads",
+             program_options::value<int>()->default_value(2),
+             "number of threads used to decode the prefetched images (left and right images are decoded in parallel)")
             ;
 
 
@@ -61,8 +72,8 @@ program_options::options_description VideoFromFiles::get_args_options()
 VideoFromFiles::VideoFromFiles(const program_options::variables_map &options,
                                const shared_ptr<StereoCameraCalibration> &stereo_calibration_p)
     : AbstractVideoInput(options),
-      read_future_frame_start_barrier(2), // only two threads are involved
-      read_future_frame_ended_barrier(2)
+      prefetch_request_counter(0),
+      stop_prefetch_threads(false)
 {
 
     total_number_of_frames = -1;
@@ -98,10 +109,33 @@ VideoFromFiles::VideoFromFiles(const program_options::variables_map &options,
     start_frame = get_option_value<int>(options, "video_input.start_frame");
     end_frame = get_option_value<int>(options, "video_input.end_frame");
 
-    future_image_frame_number = -1;
-    found_future_image = false;
+    const int num_prefetch_frames = get_option_value<int>(options, "video_input.prefetch_frames");
+    const int num_prefetch_threads = get_option_value<int>(options, "video_input.prefetch_threads");
+
+    if(num_prefetch_frames < 0)
+    {
+        throw std::invalid_argument("video_input.prefetch_frames should be >= 0");
+    }
+
+    if(num_prefetch_frames > 0)
+    {
+        if(num_prefetch_threads <= 0)
+        {
+            throw std::invalid_argument("video_input.prefetch_threads should be > 0 when prefetching frames");
+        }
+
+        PrefetchSlot free_slot;
+        free_slot.frame_number = -1;
+        free_slot.request_id = -1;
+        free_slot.num_pending_images = 0;
+        free_slot.read_failed = false;
+        prefetch_slots.resize(num_prefetch_frames, free_slot);
 
-    image_reading_thread = boost::thread(&VideoFromFiles::read_future_frame_thead, this);
+        for(int i=0; i < num_prefetch_threads; i+=1)
+        {
+            prefetch_threads.create_thread(boost::bind(&VideoFromFiles::prefetch_thread_function, this));
+        }
+    }
 
     // do the first acquisition
     const bool found_frames = this->set_frame(start_frame);
@@ -126,8 +160,14 @@ VideoFromFiles::VideoFromFiles(const program_options::variables_map &options,
 
 VideoFromFiles::~VideoFromFiles()
 {
-    // we stop the reading thread, before destroying the object
-    image_reading_thread.interrupt();
+    // we stop the reading threads, before destroying the object
+    {
+        boost::mutex::scoped_lock lock(prefetch_mutex);
+        stop_prefetch_threads = true;
+        prefetch_tasks.clear();
+    }
+    prefetch_task_available.notify_all();
+    prefetch_threads.join_all();
     return;
 }
 
@@ -231,12 +271,8 @@ int VideoFromFiles::get_number_of_frames()
 /// Set current absolute frame
 bool VideoFromFiles::set_frame(const int frame_number)
 {
-    //const bool enable_parallel_read = true;
-    const bool enable_parallel_read = false;
-
-    if( (future_image_frame_number != frame_number) or
-        (enable_parallel_read == false) )
-    { // no future was launched to retrieve the images before hand
+    if(prefetch_slots.empty())
+    { // no prefetching, read the images right away
 
         const bool return_value  = read_frame_from_disk(frame_number,
                                                         left_image, right_image,
@@ -250,37 +286,16 @@ bool VideoFromFiles::set_frame(const int frame_number)
         {
             // we continue
         }
-
-        this->current_frame_number = frame_number;
-
     }
     else
-    { // launched a future to read the images before hand --
-        assert(frame_number == future_image_frame_number);
-
-        // make sure future image reading has finished
-        read_future_frame_ended_barrier.wait();
-
-        this->current_frame_number = frame_number;
-        if(found_future_image == false)
+    {
+        if(set_frame_from_prefetch(frame_number) == false)
         {
-            // the reading failed
             return false;
         }
-        else
-        {
-            // copy the data from the future to the present
-            boost::gil::copy_pixels(future_left_image_view, boost::gil::view(left_image));
-            boost::gil::copy_pixels(future_right_image_view, boost::gil::view(right_image));
-        }
-
     }
 
-    // launch right away the reading of the next frame ---
-    if(enable_parallel_read)
-    {
-        read_future_frame_start_barrier.wait();
-    }
+    this->current_frame_number = frame_number;
 
     // preprocess the acquired images ---
     if(this->preprocessor_p.get() != NULL)
@@ -310,23 +325,17 @@ bool VideoFromFiles::set_frame(const int frame_number)
 }
 
 
-bool VideoFromFiles::read_frame_from_disk(const int frame_number,
-                                          input_image_t &left_image, input_image_t &right_image,
-                                          input_image_view_t &left_view, input_image_view_t &right_view)
+bool VideoFromFiles::get_frame_paths(const int frame_number,
+                                     boost::filesystem::path &left_image_path,
+                                     boost::filesystem::path &right_image_path) const
 {
-
-    using namespace boost::filesystem;
     using boost::format;
 
     if(frame_number < start_frame || frame_number > end_frame )
     {
-        printf("Requested frame number %i but frames should be in range (%i, %i)\n", frame_number, start_frame, end_frame);
         return false;
     }
 
-    // frame_number is in a correct range --
-    path left_image_path, right_image_path;
-
 #if BOOST_VERSION >= 104400 
     // expected_args was only defined in version 1.44
     if(left_filename_format.expected_args() == 1)
@@ -343,7 +352,26 @@ bool VideoFromFiles::read_frame_from_disk(const int frame_number,
         right_image_path = str( format(right_filename_format) );
     }
 
+    return true;
+}
+
+
+bool VideoFromFiles::read_frame_from_disk(const int frame_number,
+                                          input_image_t &left_image, input_image_t &right_image,
+                                          input_image_view_t &left_view, input_image_view_t &right_view)
+{
+
+    using namespace boost::filesystem;
+
+    path left_image_path, right_image_path;
 
+    if(get_frame_paths(frame_number, left_image_path, right_image_path) == false)
+    {
+        printf("Requested frame number %i but frames should be in range (%i, %i)\n", frame_number, start_frame, end_frame);
+        return false;
+    }
+
+    // frame_number is in a correct range --
     if ((exists(left_image_path) == false) || (exists(right_image_path) == false) )
     {
         const bool print_not_found = true;
@@ -397,21 +425,199 @@ bool VideoFromFiles::read_frame_from_disk(const int frame_number,
 }
 
 
-void VideoFromFiles::read_future_frame_thead()
+int VideoFromFiles::find_prefetch_slot(const int frame_number) const
 {
-    while(true)
-    { // the thread will end by a call to thread::interrupt
+    for(size_t i=0; i < prefetch_slots.size(); i+=1)
+    {
+        if(prefetch_slots[i].frame_number == frame_number)
+        {
+            return i;
+        }
+    }
 
-        read_future_frame_start_barrier.wait();
+    return -1;
+}
 
-        future_image_frame_number = this->current_frame_number + 1;
 
-        found_future_image = read_frame_from_disk(future_image_frame_number,
-                                                  future_left_image, future_right_image,
-                                                  future_left_image_view, future_right_image_view);
+void VideoFromFiles::schedule_prefetch(const int first_frame, const int last_frame)
+{
+    // recycle the slots outside of the range --
+    for(size_t slot_index=0; slot_index < prefetch_slots.size(); slot_index+=1)
+    {
+        PrefetchSlot &slot = prefetch_slots[slot_index];
+        if((slot.frame_number >= first_frame) and (slot.frame_number <= last_frame))
+        {
+            continue;
+        }
+
+        slot.frame_number = -1;
+        slot.request_id = -1; // the images being decoded for this slot will be discarded
+        slot.num_pending_images = 0;
 
-        read_future_frame_ended_barrier.wait();
+        std::deque<PrefetchTask>::iterator tasks_it = prefetch_tasks.begin();
+        while(tasks_it != prefetch_tasks.end())
+        {
+            if(tasks_it->slot_index == slot_index)
+            {
+                tasks_it = prefetch_tasks.erase(tasks_it);
+            }
+            else
+            {
+                ++tasks_it;
+            }
+        }
+    } // end of "for each slot"
+
+    // assign the free slots to the missing frames, nearest frames first --
+    const int last_valid_frame = std::min(last_frame, end_frame);
+    for(int frame_number = std::max(first_frame, start_frame); frame_number <= last_valid_frame; frame_number +=1)
+    {
+        if(find_prefetch_slot(frame_number) >= 0)
+        {
+            continue;
+        }
+
+        const int slot_index = find_prefetch_slot(-1);
+        if(slot_index < 0)
+        {
+            break; // no more free slots
+        }
+
+        PrefetchSlot &slot = prefetch_slots[slot_index];
+        slot.frame_number = frame_number;
+        slot.request_id = prefetch_request_counter;
+        prefetch_request_counter += 1;
+        slot.num_pending_images = 2;
+        slot.read_failed = false;
+
+        for(int side = 0; side < 2; side += 1)
+        {
+            PrefetchTask task;
+            task.slot_index = slot_index;
+            task.request_id = slot.request_id;
+            task.frame_number = frame_number;
+            task.side = side;
+            prefetch_tasks.push_back(task);
+        }
+    } // end of "for each frame in the range"
+
+    prefetch_task_available.notify_all();
+    return;
+}
+
+
+bool VideoFromFiles::set_frame_from_prefetch(const int frame_number)
+{
+    const int num_slots = prefetch_slots.size();
+
+    boost::mutex::scoped_lock lock(prefetch_mutex);
+
+    // on a seek (e.g. previous_frame) the frame is not yet scheduled
+    schedule_prefetch(frame_number, frame_number + num_slots - 1);
+
+    const int slot_index = find_prefetch_slot(frame_number);
+    if(slot_index < 0)
+    {
+        printf("Requested frame number %i but frames should be in range (%i, %i)\n", frame_number, start_frame, end_frame);
+        return false;
+    }
+
+    PrefetchSlot &slot = prefetch_slots[slot_index];
+    while(slot.num_pending_images > 0)
+    {
+        prefetch_image_decoded.wait(lock);
+    }
+
+    if(slot.read_failed)
+    {
+        printf("Failed to read the images of frame %i\n", frame_number);
+        return false;
+    }
+
+    if(frame_number == start_frame)
+    {
+        boost::filesystem::path left_image_path, right_image_path;
+        get_frame_paths(frame_number, left_image_path, right_image_path);
+        printf("Reading files:\n%s\n%s\n", left_image_path.string().c_str(), right_image_path.string().c_str());
     }
+
+    // hand over the decoded images without copy,
+    // the previous images buffers go back into the ring buffer
+    left_image.swap(slot.images[0]);
+    right_image.swap(slot.images[1]);
+    left_image_view = boost::gil::const_view(left_image);
+    right_image_view = boost::gil::const_view(right_image);
+
+    slot.frame_number = -1;
+    schedule_prefetch(frame_number + 1, frame_number + num_slots);
+
+    return true;
+}
+
+
+void VideoFromFiles::prefetch_thread_function()
+{
+    // images are decoded outside of the ring buffer, then swapped in
+    input_image_t decoded_image;
+
+    while(true)
+    {
+        PrefetchTask task;
+        {
+            boost::mutex::scoped_lock lock(prefetch_mutex);
+            while(prefetch_tasks.empty() and (stop_prefetch_threads == false))
+            {
+                prefetch_task_available.wait(lock);
+            }
+
+            if(stop_prefetch_threads)
+            {
+                break;
+            }
+
+            task = prefetch_tasks.front();
+            prefetch_tasks.pop_front();
+        }
+
+        bool read_succeeded = false;
+        boost::filesystem::path image_paths[2];
+        if(get_frame_paths(task.frame_number, image_paths[0], image_paths[1])
+           and boost::filesystem::exists(image_paths[task.side]))
+        {
+            try
+            {
+                boost::gil::png_read_and_convert_image(image_paths[task.side].string(), decoded_image);
+                read_succeeded = (decoded_image.width() > 0) and (decoded_image.height() > 0);
+            }
+            catch(std::exception &e)
+            {
+                printf("Failed to read %s: %s\n", image_paths[task.side].string().c_str(), e.what());
+            }
+        }
+
+        {
+            boost::mutex::scoped_lock lock(prefetch_mutex);
+            PrefetchSlot &slot = prefetch_slots[task.slot_index];
+            if(slot.request_id == task.request_id)
+            {
+                if(read_succeeded)
+                {
+                    slot.images[task.side].swap(decoded_image);
+                }
+                else
+                {
+                    slot.read_failed = true;
+                }
+                slot.num_pending_images -= 1;
+            }
+            else
+            {
+                // the slot was recycled while decoding (seek), the result is discarded
+            }
+        }
+        prefetch_image_decoded.notify_all();
+    } // end of "while not stopped"
+
     return;
 }
 
@@ -8,9 +8,13 @@
 
 #include <boost/shared_ptr.hpp>
 #include <boost/format.hpp>
+#include <boost/filesystem/path.hpp>
 
 #include <boost/thread.hpp>
 
+#include <deque>
+#include <vector>
+
 
 namespace doppia
 {
@@ -21,6 +25,9 @@ using boost::shared_ptr;
 /// Loads images from a video stream stored as a set of images.
 /// Supports a preprocessor object for things like unbayering, rectification, etc ...
 ///
+/// The next video_input.prefetch_frames frames are decoded in advance by worker threads
+/// (left and right images in parallel), and handed over without copy when requested.
+///
 /// Based on Andreas Ess code
 ///
 class VideoFromFiles : public AbstractVideoInput
@@ -58,8 +65,9 @@ protected:
                               input_image_t &left_image, input_image_t &right_image,
                               input_image_view_t &left_view, input_image_view_t &right_view);
 
-
-    void read_future_frame_thead();
+    /// @returns false if frame_number is out of the start_frame, end_frame range
+    bool get_frame_paths(const int frame_number,
+                         boost::filesystem::path &left_image_path, boost::filesystem::path &right_image_path) const;
 
     /// Base for directory and filename
     std::string left_filename_mask, right_filename_mask;
@@ -75,15 +83,47 @@ protected:
     input_image_t left_image, right_image;
     input_image_view_t left_image_view, right_image_view;
 
-    boost::barrier read_future_frame_start_barrier, read_future_frame_ended_barrier;
-    boost::thread image_reading_thread;
-
-    /// shared_future instead of unique_future to work around lack of move support in pre C++0x compilers
-    boost::shared_future<bool> read_next_image_future;
-    bool found_future_image;
-    int future_image_frame_number;
-    input_image_t future_left_image, future_right_image;
-    input_image_view_t future_left_image_view, future_right_image_view;
+    /// frames prefetching --
+    /// @{
+
+    /// one entry of the decoded frames ring buffer
+    struct PrefetchSlot
+    {
+        int frame_number; ///< -1 if the slot is free
+        int request_id; ///< changes each time the slot is assigned, used to discard outdated decodings
+        int num_pending_images;
+        bool read_failed;
+        input_image_t images[2]; ///< left and right
+    };
+
+    /// decoding of one image (left or right) of one frame
+    struct PrefetchTask
+    {
+        size_t slot_index;
+        int request_id, frame_number, side;
+    };
+
+    bool set_frame_from_prefetch(const int frame_number);
+
+    /// makes sure the frames [first_frame, last_frame] are assigned to a slot,
+    /// the slots of the frames outside this range are recycled
+    /// (prefetch_mutex must be locked)
+    void schedule_prefetch(const int first_frame, const int last_frame);
+
+    /// @returns the index of the slot assigned to the frame, or -1 if not found
+    int find_prefetch_slot(const int frame_number) const;
+
+    void prefetch_thread_function();
+
+    std::vector<PrefetchSlot> prefetch_slots;
+    std::deque<PrefetchTask> prefetch_tasks;
+    int prefetch_request_counter;
+    bool stop_prefetch_threads;
+
+    boost::mutex prefetch_mutex;
+    boost::condition_variable prefetch_task_available, prefetch_image_decoded;
+    boost::thread_group prefetch_threads;
+    /// @}
 
 };
 
@@ -1,3201 +1,3242 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: calibration.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "calibration.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace doppia_protobuf {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* CameraInternalParameters_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CameraInternalParameters_reflection_ = NULL;
-const ::google::protobuf::Descriptor* RadialDistortion_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  RadialDistortion_reflection_ = NULL;
-const ::google::protobuf::Descriptor* TangentialDistortion_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TangentialDistortion_reflection_ = NULL;
-const ::google::protobuf::Descriptor* RotationMatrix_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  RotationMatrix_reflection_ = NULL;
-const ::google::protobuf::Descriptor* TranslationVector_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  TranslationVector_reflection_ = NULL;
-const ::google::protobuf::Descriptor* Pose_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Pose_reflection_ = NULL;
-const ::google::protobuf::Descriptor* CameraCalibration_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  CameraCalibration_reflection_ = NULL;
-const ::google::protobuf::Descriptor* StereoCameraCalibration_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  StereoCameraCalibration_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_calibration_2eproto() {
-  protobuf_AddDesc_calibration_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "calibration.proto");
-  GOOGLE_CHECK(file != NULL);
-  CameraInternalParameters_descriptor_ = file->message_type(0);
-  static const int CameraInternalParameters_offsets_[9] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k11_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k12_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k13_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k21_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k22_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k23_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k31_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k32_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, k33_),
+namespace doppia_protobuf {
+PROTOBUF_CONSTEXPR CameraInternalParameters::CameraInternalParameters(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.k11_)*/0
+  , /*decltype(_impl_.k12_)*/0
+  , /*decltype(_impl_.k13_)*/0
+  , /*decltype(_impl_.k21_)*/0
+  , /*decltype(_impl_.k22_)*/0
+  , /*decltype(_impl_.k23_)*/0
+  , /*decltype(_impl_.k31_)*/0
+  , /*decltype(_impl_.k32_)*/0
+  , /*decltype(_impl_.k33_)*/0} {}
+struct CameraInternalParametersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CameraInternalParametersDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CameraInternalParametersDefaultTypeInternal() {}
+  union {
+    CameraInternalParameters _instance;
   };
-  CameraInternalParameters_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CameraInternalParameters_descriptor_,
-      CameraInternalParameters::default_instance_,
-      CameraInternalParameters_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraInternalParameters, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CameraInternalParameters));
-  RadialDistortion_descriptor_ = file->message_type(1);
-  static const int RadialDistortion_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RadialDistortion, k1_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RadialDistortion, k2_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RadialDistortion, k3_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraInternalParametersDefaultTypeInternal _CameraInternalParameters_default_instance_;
+PROTOBUF_CONSTEXPR RadialDistortion::RadialDistortion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.k1_)*/0
+  , /*decltype(_impl_.k2_)*/0
+  , /*decltype(_impl_.k3_)*/0} {}
+struct RadialDistortionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RadialDistortionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RadialDistortionDefaultTypeInternal() {}
+  union {
+    RadialDistortion _instance;
   };
-  RadialDistortion_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      RadialDistortion_descriptor_,
-      RadialDistortion::default_instance_,
-      RadialDistortion_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RadialDistortion, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RadialDistortion, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(RadialDistortion));
-  TangentialDistortion_descriptor_ = file->message_type(2);
-  static const int TangentialDistortion_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TangentialDistortion, k1_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TangentialDistortion, k2_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TangentialDistortion, k3_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RadialDistortionDefaultTypeInternal _RadialDistortion_default_instance_;
+PROTOBUF_CONSTEXPR TangentialDistortion::TangentialDistortion(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.k1_)*/0
+  , /*decltype(_impl_.k2_)*/0
+  , /*decltype(_impl_.k3_)*/0} {}
+struct TangentialDistortionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TangentialDistortionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TangentialDistortionDefaultTypeInternal() {}
+  union {
+    TangentialDistortion _instance;
   };
-  TangentialDistortion_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TangentialDistortion_descriptor_,
-      TangentialDistortion::default_instance_,
-      TangentialDistortion_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TangentialDistortion, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TangentialDistortion, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TangentialDistortion));
-  RotationMatrix_descriptor_ = file->message_type(3);
-  static const int RotationMatrix_offsets_[9] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r11_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r12_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r13_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r21_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r22_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r23_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r31_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r32_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, r33_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TangentialDistortionDefaultTypeInternal _TangentialDistortion_default_instance_;
+PROTOBUF_CONSTEXPR RotationMatrix::RotationMatrix(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.r11_)*/0
+  , /*decltype(_impl_.r12_)*/0
+  , /*decltype(_impl_.r13_)*/0
+  , /*decltype(_impl_.r21_)*/0
+  , /*decltype(_impl_.r22_)*/0
+  , /*decltype(_impl_.r23_)*/0
+  , /*decltype(_impl_.r31_)*/0
+  , /*decltype(_impl_.r32_)*/0
+  , /*decltype(_impl_.r33_)*/0} {}
+struct RotationMatrixDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RotationMatrixDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RotationMatrixDefaultTypeInternal() {}
+  union {
+    RotationMatrix _instance;
   };
-  RotationMatrix_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      RotationMatrix_descriptor_,
-      RotationMatrix::default_instance_,
-      RotationMatrix_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(RotationMatrix, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(RotationMatrix));
-  TranslationVector_descriptor_ = file->message_type(4);
-  static const int TranslationVector_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TranslationVector, t1_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TranslationVector, t2_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TranslationVector, t3_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RotationMatrixDefaultTypeInternal _RotationMatrix_default_instance_;
+PROTOBUF_CONSTEXPR TranslationVector::TranslationVector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.t1_)*/0
+  , /*decltype(_impl_.t2_)*/0
+  , /*decltype(_impl_.t3_)*/0} {}
+struct TranslationVectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TranslationVectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TranslationVectorDefaultTypeInternal() {}
+  union {
+    TranslationVector _instance;
   };
-  TranslationVector_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      TranslationVector_descriptor_,
-      TranslationVector::default_instance_,
-      TranslationVector_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TranslationVector, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(TranslationVector, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(TranslationVector));
-  Pose_descriptor_ = file->message_type(5);
-  static const int Pose_offsets_[2] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Pose, rotation_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Pose, translation_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TranslationVectorDefaultTypeInternal _TranslationVector_default_instance_;
+PROTOBUF_CONSTEXPR Pose::Pose(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rotation_)*/nullptr
+  , /*decltype(_impl_.translation_)*/nullptr} {}
+struct PoseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PoseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PoseDefaultTypeInternal() {}
+  union {
+    Pose _instance;
   };
-  Pose_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Pose_descriptor_,
-      Pose::default_instance_,
-      Pose_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Pose, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Pose, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Pose));
-  CameraCalibration_descriptor_ = file->message_type(6);
-  static const int CameraCalibration_offsets_[5] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, internal_parameters_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, radial_distortion_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, tangential_distortion_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, pose_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PoseDefaultTypeInternal _Pose_default_instance_;
+PROTOBUF_CONSTEXPR CameraCalibration::CameraCalibration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.internal_parameters_)*/nullptr
+  , /*decltype(_impl_.radial_distortion_)*/nullptr
+  , /*decltype(_impl_.tangential_distortion_)*/nullptr
+  , /*decltype(_impl_.pose_)*/nullptr} {}
+struct CameraCalibrationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CameraCalibrationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CameraCalibrationDefaultTypeInternal() {}
+  union {
+    CameraCalibration _instance;
   };
-  CameraCalibration_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      CameraCalibration_descriptor_,
-      CameraCalibration::default_instance_,
-      CameraCalibration_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(CameraCalibration, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(CameraCalibration));
-  StereoCameraCalibration_descriptor_ = file->message_type(7);
-  static const int StereoCameraCalibration_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoCameraCalibration, name_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoCameraCalibration, left_camera_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoCameraCalibration, right_camera_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CameraCalibrationDefaultTypeInternal _CameraCalibration_default_instance_;
+PROTOBUF_CONSTEXPR StereoCameraCalibration::StereoCameraCalibration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.left_camera_)*/nullptr
+  , /*decltype(_impl_.right_camera_)*/nullptr} {}
+struct StereoCameraCalibrationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StereoCameraCalibrationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StereoCameraCalibrationDefaultTypeInternal() {}
+  union {
+    StereoCameraCalibration _instance;
   };
-  StereoCameraCalibration_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      StereoCameraCalibration_descriptor_,
-      StereoCameraCalibration::default_instance_,
-      StereoCameraCalibration_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoCameraCalibration, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(StereoCameraCalibration, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(StereoCameraCalibration));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_calibration_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CameraInternalParameters_descriptor_, &CameraInternalParameters::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    RadialDistortion_descriptor_, &RadialDistortion::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TangentialDistortion_descriptor_, &TangentialDistortion::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    RotationMatrix_descriptor_, &RotationMatrix::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    TranslationVector_descriptor_, &TranslationVector::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Pose_descriptor_, &Pose::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    CameraCalibration_descriptor_, &CameraCalibration::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    StereoCameraCalibration_descriptor_, &StereoCameraCalibration::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_calibration_2eproto() {
-  delete CameraInternalParameters::default_instance_;
-  delete CameraInternalParameters_reflection_;
-  delete RadialDistortion::default_instance_;
-  delete RadialDistortion_reflection_;
-  delete TangentialDistortion::default_instance_;
-  delete TangentialDistortion_reflection_;
-  delete RotationMatrix::default_instance_;
-  delete RotationMatrix_reflection_;
-  delete TranslationVector::default_instance_;
-  delete TranslationVector_reflection_;
-  delete Pose::default_instance_;
-  delete Pose_reflection_;
-  delete CameraCalibration::default_instance_;
-  delete CameraCalibration_reflection_;
-  delete StereoCameraCalibration::default_instance_;
-  delete StereoCameraCalibration_reflection_;
-}
-
-void protobuf_AddDesc_calibration_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\021calibration.proto\022\017doppia_protobuf\"\217\001\n"
-    "\030CameraInternalParameters\022\013\n\003k11\030\001 \002(\002\022\013"
-    "\n\003k12\030\002 \002(\002\022\013\n\003k13\030\003 \002(\002\022\013\n\003k21\030\004 \002(\002\022\013\n"
-    "\003k22\030\005 \002(\002\022\013\n\003k23\030\006 \002(\002\022\013\n\003k31\030\007 \002(\002\022\013\n\003"
-    "k32\030\010 \002(\002\022\013\n\003k33\030\t \002(\002\"6\n\020RadialDistorti"
-    "on\022\n\n\002k1\030\001 \002(\002\022\n\n\002k2\030\002 \001(\002\022\n\n\002k3\030\003 \001(\002\":"
-    "\n\024TangentialDistortion\022\n\n\002k1\030\001 \002(\002\022\n\n\002k2"
-    "\030\002 \002(\002\022\n\n\002k3\030\003 \001(\002\"\205\001\n\016RotationMatrix\022\013\n"
-    "\003r11\030\001 \002(\002\022\013\n\003r12\030\002 \002(\002\022\013\n\003r13\030\003 \002(\002\022\013\n\003"
-    "r21\030\004 \002(\002\022\013\n\003r22\030\005 \002(\002\022\013\n\003r23\030\006 \002(\002\022\013\n\003r"
-    "31\030\007 \002(\002\022\013\n\003r32\030\010 \002(\002\022\013\n\003r33\030\t \002(\002\"7\n\021Tr"
-    "anslationVector\022\n\n\002t1\030\001 \002(\002\022\n\n\002t2\030\002 \002(\002\022"
-    "\n\n\002t3\030\003 \002(\002\"r\n\004Pose\0221\n\010rotation\030\001 \002(\0132\037."
-    "doppia_protobuf.RotationMatrix\0227\n\013transl"
-    "ation\030\002 \002(\0132\".doppia_protobuf.Translatio"
-    "nVector\"\222\002\n\021CameraCalibration\022\014\n\004name\030\001 "
-    "\001(\t\022F\n\023internal_parameters\030\002 \002(\0132).doppi"
-    "a_protobuf.CameraInternalParameters\022<\n\021r"
-    "adial_distortion\030\003 \001(\0132!.doppia_protobuf"
-    ".RadialDistortion\022D\n\025tangential_distorti"
-    "on\030\004 \001(\0132%.doppia_protobuf.TangentialDis"
-    "tortion\022#\n\004pose\030\005 \001(\0132\025.doppia_protobuf."
-    "Pose\"\232\001\n\027StereoCameraCalibration\022\014\n\004name"
-    "\030\001 \001(\t\0227\n\013left_camera\030\002 \002(\0132\".doppia_pro"
-    "tobuf.CameraCalibration\0228\n\014right_camera\030"
-    "\003 \002(\0132\".doppia_protobuf.CameraCalibratio"
-    "n", 1041);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "calibration.proto", &protobuf_RegisterTypes);
-  CameraInternalParameters::default_instance_ = new CameraInternalParameters();
-  RadialDistortion::default_instance_ = new RadialDistortion();
-  TangentialDistortion::default_instance_ = new TangentialDistortion();
-  RotationMatrix::default_instance_ = new RotationMatrix();
-  TranslationVector::default_instance_ = new TranslationVector();
-  Pose::default_instance_ = new Pose();
-  CameraCalibration::default_instance_ = new CameraCalibration();
-  StereoCameraCalibration::default_instance_ = new StereoCameraCalibration();
-  CameraInternalParameters::default_instance_->InitAsDefaultInstance();
-  RadialDistortion::default_instance_->InitAsDefaultInstance();
-  TangentialDistortion::default_instance_->InitAsDefaultInstance();
-  RotationMatrix::default_instance_->InitAsDefaultInstance();
-  TranslationVector::default_instance_->InitAsDefaultInstance();
-  Pose::default_instance_->InitAsDefaultInstance();
-  CameraCalibration::default_instance_->InitAsDefaultInstance();
-  StereoCameraCalibration::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_calibration_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_calibration_2eproto {
-  StaticDescriptorInitializer_calibration_2eproto() {
-    protobuf_AddDesc_calibration_2eproto();
-  }
-} static_descriptor_initializer_calibration_2eproto_;
-
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StereoCameraCalibrationDefaultTypeInternal _StereoCameraCalibration_default_instance_;
+}  // namespace doppia_protobuf
+static ::_pb::Metadata file_level_metadata_calibration_2eproto[8];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_calibration_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_calibration_2eproto = nullptr;
+
+const uint32_t TableStruct_calibration_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k11_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k12_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k13_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k21_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k22_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k23_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k31_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k32_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraInternalParameters, _impl_.k33_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RadialDistortion, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RadialDistortion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RadialDistortion, _impl_.k1_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RadialDistortion, _impl_.k2_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RadialDistortion, _impl_.k3_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TangentialDistortion, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TangentialDistortion, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TangentialDistortion, _impl_.k1_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TangentialDistortion, _impl_.k2_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TangentialDistortion, _impl_.k3_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r11_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r12_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r13_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r21_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r22_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r23_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r31_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r32_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::RotationMatrix, _impl_.r33_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  5,
+  6,
+  7,
+  8,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TranslationVector, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TranslationVector, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TranslationVector, _impl_.t1_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TranslationVector, _impl_.t2_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::TranslationVector, _impl_.t3_),
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Pose, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Pose, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Pose, _impl_.rotation_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::Pose, _impl_.translation_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_.internal_parameters_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_.radial_distortion_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_.tangential_distortion_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::CameraCalibration, _impl_.pose_),
+  0,
+  1,
+  2,
+  3,
+  4,
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::StereoCameraCalibration, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::StereoCameraCalibration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::StereoCameraCalibration, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::StereoCameraCalibration, _impl_.left_camera_),
+  PROTOBUF_FIELD_OFFSET(::doppia_protobuf::StereoCameraCalibration, _impl_.right_camera_),
+  0,
+  1,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 15, -1, sizeof(::doppia_protobuf::CameraInternalParameters)},
+  { 24, 33, -1, sizeof(::doppia_protobuf::RadialDistortion)},
+  { 36, 45, -1, sizeof(::doppia_protobuf::TangentialDistortion)},
+  { 48, 63, -1, sizeof(::doppia_protobuf::RotationMatrix)},
+  { 72, 81, -1, sizeof(::doppia_protobuf::TranslationVector)},
+  { 84, 92, -1, sizeof(::doppia_protobuf::Pose)},
+  { 94, 105, -1, sizeof(::doppia_protobuf::CameraCalibration)},
+  { 110, 119, -1, sizeof(::doppia_protobuf::StereoCameraCalibration)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::doppia_protobuf::_CameraInternalParameters_default_instance_._instance,
+  &::doppia_protobuf::_RadialDistortion_default_instance_._instance,
+  &::doppia_protobuf::_TangentialDistortion_default_instance_._instance,
+  &::doppia_protobuf::_RotationMatrix_default_instance_._instance,
+  &::doppia_protobuf::_TranslationVector_default_instance_._instance,
+  &::doppia_protobuf::_Pose_default_instance_._instance,
+  &::doppia_protobuf::_CameraCalibration_default_instance_._instance,
+  &::doppia_protobuf::_StereoCameraCalibration_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_calibration_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\021calibration.proto\022\017doppia_protobuf\"\217\001\n"
+  "\030CameraInternalParameters\022\013\n\003k11\030\001 \002(\002\022\013"
+  "\n\003k12\030\002 \002(\002\022\013\n\003k13\030\003 \002(\002\022\013\n\003k21\030\004 \002(\002\022\013\n"
+  "\003k22\030\005 \002(\002\022\013\n\003k23\030\006 \002(\002\022\013\n\003k31\030\007 \002(\002\022\013\n\003"
+  "k32\030\010 \002(\002\022\013\n\003k33\030\t \002(\002\"6\n\020RadialDistorti"
+  "on\022\n\n\002k1\030\001 \002(\002\022\n\n\002k2\030\002 \001(\002\022\n\n\002k3\030\003 \001(\002\":"
+  "\n\024TangentialDistortion\022\n\n\002k1\030\001 \002(\002\022\n\n\002k2"
+  "\030\002 \002(\002\022\n\n\002k3\030\003 \001(\002\"\205\001\n\016RotationMatrix\022\013\n"
+  "\003r11\030\001 \002(\002\022\013\n\003r12\030\002 \002(\002\022\013\n\003r13\030\003 \002(\002\022\013\n\003"
+  "r21\030\004 \002(\002\022\013\n\003r22\030\005 \002(\002\022\013\n\003r23\030\006 \002(\002\022\013\n\003r"
+  "31\030\007 \002(\002\022\013\n\003r32\030\010 \002(\002\022\013\n\003r33\030\t \002(\002\"7\n\021Tr"
+  "anslationVector\022\n\n\002t1\030\001 \002(\002\022\n\n\002t2\030\002 \002(\002\022"
+  "\n\n\002t3\030\003 \002(\002\"r\n\004Pose\0221\n\010rotation\030\001 \002(\0132\037."
+  "doppia_protobuf.RotationMatrix\0227\n\013transl"
+  "ation\030\002 \002(\0132\".doppia_protobuf.Translatio"
+  "nVector\"\222\002\n\021CameraCalibration\022\014\n\004name\030\001 "
+  "\001(\t\022F\n\023internal_parameters\030\002 \002(\0132).doppi"
+  "a_protobuf.CameraInternalParameters\022<\n\021r"
+  "adial_distortion\030\003 \001(\0132!.doppia_protobuf"
+  ".RadialDistortion\022D\n\025tangential_distorti"
+  "on\030\004 \001(\0132%.doppia_protobuf.TangentialDis"
+  "tortion\022#\n\004pose\030\005 \001(\0132\025.doppia_protobuf."
+  "Pose\"\232\001\n\027StereoCameraCalibration\022\014\n\004name"
+  "\030\001 \001(\t\0227\n\013left_camera\030\002 \002(\0132\".doppia_pro"
+  "tobuf.CameraCalibration\0228\n\014right_camera\030"
+  "\003 \002(\0132\".doppia_protobuf.CameraCalibratio"
+  "n"
+  ;
+static ::_pbi::once_flag descriptor_table_calibration_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_calibration_2eproto = {
+    false, false, 1041, descriptor_table_protodef_calibration_2eproto,
+    "calibration.proto",
+    &descriptor_table_calibration_2eproto_once, nullptr, 0, 8,
+    schemas, file_default_instances, TableStruct_calibration_2eproto::offsets,
+    file_level_metadata_calibration_2eproto, file_level_enum_descriptors_calibration_2eproto,
+    file_level_service_descriptors_calibration_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_calibration_2eproto_getter() {
+  return &descriptor_table_calibration_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_calibration_2eproto(&descriptor_table_calibration_2eproto);
+namespace doppia_protobuf {
 
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CameraInternalParameters::kK11FieldNumber;
-const int CameraInternalParameters::kK12FieldNumber;
-const int CameraInternalParameters::kK13FieldNumber;
-const int CameraInternalParameters::kK21FieldNumber;
-const int CameraInternalParameters::kK22FieldNumber;
-const int CameraInternalParameters::kK23FieldNumber;
-const int CameraInternalParameters::kK31FieldNumber;
-const int CameraInternalParameters::kK32FieldNumber;
-const int CameraInternalParameters::kK33FieldNumber;
-#endif  // !_MSC_VER
-
-CameraInternalParameters::CameraInternalParameters()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class CameraInternalParameters::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CameraInternalParameters>()._impl_._has_bits_);
+  static void set_has_k11(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_k12(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_k13(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_k21(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_k22(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_k23(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_k31(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_k32(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_k33(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000001ff) ^ 0x000001ff) != 0;
+  }
+};
 
-void CameraInternalParameters::InitAsDefaultInstance() {
+CameraInternalParameters::CameraInternalParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.CameraInternalParameters)
 }
-
 CameraInternalParameters::CameraInternalParameters(const CameraInternalParameters& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void CameraInternalParameters::SharedCtor() {
-  _cached_size_ = 0;
-  k11_ = 0;
-  k12_ = 0;
-  k13_ = 0;
-  k21_ = 0;
-  k22_ = 0;
-  k23_ = 0;
-  k31_ = 0;
-  k32_ = 0;
-  k33_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CameraInternalParameters* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k11_){}
+    , decltype(_impl_.k12_){}
+    , decltype(_impl_.k13_){}
+    , decltype(_impl_.k21_){}
+    , decltype(_impl_.k22_){}
+    , decltype(_impl_.k23_){}
+    , decltype(_impl_.k31_){}
+    , decltype(_impl_.k32_){}
+    , decltype(_impl_.k33_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.k11_, &from._impl_.k11_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.k33_) -
+    reinterpret_cast<char*>(&_impl_.k11_)) + sizeof(_impl_.k33_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.CameraInternalParameters)
+}
+
+inline void CameraInternalParameters::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k11_){0}
+    , decltype(_impl_.k12_){0}
+    , decltype(_impl_.k13_){0}
+    , decltype(_impl_.k21_){0}
+    , decltype(_impl_.k22_){0}
+    , decltype(_impl_.k23_){0}
+    , decltype(_impl_.k31_){0}
+    , decltype(_impl_.k32_){0}
+    , decltype(_impl_.k33_){0}
+  };
 }
 
 CameraInternalParameters::~CameraInternalParameters() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.CameraInternalParameters)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CameraInternalParameters::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void CameraInternalParameters::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void CameraInternalParameters::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CameraInternalParameters::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CameraInternalParameters_descriptor_;
-}
-
-const CameraInternalParameters& CameraInternalParameters::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-CameraInternalParameters* CameraInternalParameters::default_instance_ = NULL;
-
-CameraInternalParameters* CameraInternalParameters::New() const {
-  return new CameraInternalParameters;
+  _impl_._cached_size_.Set(size);
 }
 
 void CameraInternalParameters::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    k11_ = 0;
-    k12_ = 0;
-    k13_ = 0;
-    k21_ = 0;
-    k22_ = 0;
-    k23_ = 0;
-    k31_ = 0;
-    k32_ = 0;
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    k33_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool CameraInternalParameters::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.CameraInternalParameters)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.k11_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.k32_) -
+        reinterpret_cast<char*>(&_impl_.k11_)) + sizeof(_impl_.k32_));
+  }
+  _impl_.k33_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CameraInternalParameters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float k11 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k11_)));
-          set_has_k11();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_k12;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_k11(&has_bits);
+          _impl_.k11_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k12 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k12:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k12_)));
-          set_has_k12();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_k13;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_k12(&has_bits);
+          _impl_.k12_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k13 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k13:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k13_)));
-          set_has_k13();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_k21;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_k13(&has_bits);
+          _impl_.k13_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k21 = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k21:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k21_)));
-          set_has_k21();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_k22;
-        break;
-      }
-      
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_k21(&has_bits);
+          _impl_.k21_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k22 = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k22:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k22_)));
-          set_has_k22();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(53)) goto parse_k23;
-        break;
-      }
-      
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_k22(&has_bits);
+          _impl_.k22_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k23 = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k23:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k23_)));
-          set_has_k23();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(61)) goto parse_k31;
-        break;
-      }
-      
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_k23(&has_bits);
+          _impl_.k23_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k31 = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k31:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k31_)));
-          set_has_k31();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(69)) goto parse_k32;
-        break;
-      }
-      
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_k31(&has_bits);
+          _impl_.k31_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k32 = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k32:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k32_)));
-          set_has_k32();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(77)) goto parse_k33;
-        break;
-      }
-      
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_k32(&has_bits);
+          _impl_.k32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k33 = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k33:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k33_)));
-          set_has_k33();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void CameraInternalParameters::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_k33(&has_bits);
+          _impl_.k33_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CameraInternalParameters::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.CameraInternalParameters)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float k11 = 1;
-  if (has_k11()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->k11(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_k11(), target);
   }
-  
+
   // required float k12 = 2;
-  if (has_k12()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->k12(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_k12(), target);
   }
-  
+
   // required float k13 = 3;
-  if (has_k13()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->k13(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_k13(), target);
   }
-  
+
   // required float k21 = 4;
-  if (has_k21()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->k21(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_k21(), target);
   }
-  
+
   // required float k22 = 5;
-  if (has_k22()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->k22(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_k22(), target);
   }
-  
+
   // required float k23 = 6;
-  if (has_k23()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->k23(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_k23(), target);
   }
-  
+
   // required float k31 = 7;
-  if (has_k31()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(7, this->k31(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_k31(), target);
   }
-  
+
   // required float k32 = 8;
-  if (has_k32()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(8, this->k32(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_k32(), target);
   }
-  
+
   // required float k33 = 9;
-  if (has_k33()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(9, this->k33(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_k33(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.CameraInternalParameters)
+  return target;
 }
 
-::google::protobuf::uint8* CameraInternalParameters::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required float k11 = 1;
-  if (has_k11()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->k11(), target);
-  }
-  
-  // required float k12 = 2;
-  if (has_k12()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->k12(), target);
+size_t CameraInternalParameters::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.CameraInternalParameters)
+  size_t total_size = 0;
+
+  if (_internal_has_k11()) {
+    // required float k11 = 1;
+    total_size += 1 + 4;
   }
-  
-  // required float k13 = 3;
-  if (has_k13()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->k13(), target);
+
+  if (_internal_has_k12()) {
+    // required float k12 = 2;
+    total_size += 1 + 4;
   }
-  
-  // required float k21 = 4;
-  if (has_k21()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->k21(), target);
+
+  if (_internal_has_k13()) {
+    // required float k13 = 3;
+    total_size += 1 + 4;
   }
-  
-  // required float k22 = 5;
-  if (has_k22()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->k22(), target);
+
+  if (_internal_has_k21()) {
+    // required float k21 = 4;
+    total_size += 1 + 4;
   }
-  
-  // required float k23 = 6;
-  if (has_k23()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->k23(), target);
+
+  if (_internal_has_k22()) {
+    // required float k22 = 5;
+    total_size += 1 + 4;
   }
-  
-  // required float k31 = 7;
-  if (has_k31()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(7, this->k31(), target);
+
+  if (_internal_has_k23()) {
+    // required float k23 = 6;
+    total_size += 1 + 4;
   }
-  
-  // required float k32 = 8;
-  if (has_k32()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(8, this->k32(), target);
+
+  if (_internal_has_k31()) {
+    // required float k31 = 7;
+    total_size += 1 + 4;
   }
-  
-  // required float k33 = 9;
-  if (has_k33()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(9, this->k33(), target);
+
+  if (_internal_has_k32()) {
+    // required float k32 = 8;
+    total_size += 1 + 4;
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_k33()) {
+    // required float k33 = 9;
+    total_size += 1 + 4;
   }
-  return target;
+
+  return total_size;
 }
+size_t CameraInternalParameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.CameraInternalParameters)
+  size_t total_size = 0;
 
-int CameraInternalParameters::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x000001ff) ^ 0x000001ff) == 0) {  // All required fields are present.
     // required float k11 = 1;
-    if (has_k11()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k12 = 2;
-    if (has_k12()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k13 = 3;
-    if (has_k13()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k21 = 4;
-    if (has_k21()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k22 = 5;
-    if (has_k22()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k23 = 6;
-    if (has_k23()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k31 = 7;
-    if (has_k31()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float k32 = 8;
-    if (has_k32()) {
-      total_size += 1 + 4;
-    }
-    
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    total_size += 1 + 4;
+
     // required float k33 = 9;
-    if (has_k33()) {
-      total_size += 1 + 4;
-    }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += 1 + 4;
 
-void CameraInternalParameters::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CameraInternalParameters* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CameraInternalParameters*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CameraInternalParameters::MergeFrom(const CameraInternalParameters& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_k11()) {
-      set_k11(from.k11());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CameraInternalParameters::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CameraInternalParameters::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CameraInternalParameters::GetClassData() const { return &_class_data_; }
+
+
+void CameraInternalParameters::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CameraInternalParameters*>(&to_msg);
+  auto& from = static_cast<const CameraInternalParameters&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.CameraInternalParameters)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.k11_ = from._impl_.k11_;
     }
-    if (from.has_k12()) {
-      set_k12(from.k12());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.k12_ = from._impl_.k12_;
     }
-    if (from.has_k13()) {
-      set_k13(from.k13());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.k13_ = from._impl_.k13_;
     }
-    if (from.has_k21()) {
-      set_k21(from.k21());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.k21_ = from._impl_.k21_;
     }
-    if (from.has_k22()) {
-      set_k22(from.k22());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.k22_ = from._impl_.k22_;
     }
-    if (from.has_k23()) {
-      set_k23(from.k23());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.k23_ = from._impl_.k23_;
     }
-    if (from.has_k31()) {
-      set_k31(from.k31());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.k31_ = from._impl_.k31_;
     }
-    if (from.has_k32()) {
-      set_k32(from.k32());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.k32_ = from._impl_.k32_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_k33()) {
-      set_k33(from.k33());
-    }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_k33(from._internal_k33());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CameraInternalParameters::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CameraInternalParameters::CopyFrom(const CameraInternalParameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.CameraInternalParameters)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CameraInternalParameters::IsInitialized() const {
-  if ((_has_bits_[0] & 0x000001ff) != 0x000001ff) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void CameraInternalParameters::Swap(CameraInternalParameters* other) {
-  if (other != this) {
-    std::swap(k11_, other->k11_);
-    std::swap(k12_, other->k12_);
-    std::swap(k13_, other->k13_);
-    std::swap(k21_, other->k21_);
-    std::swap(k22_, other->k22_);
-    std::swap(k23_, other->k23_);
-    std::swap(k31_, other->k31_);
-    std::swap(k32_, other->k32_);
-    std::swap(k33_, other->k33_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CameraInternalParameters::InternalSwap(CameraInternalParameters* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CameraInternalParameters, _impl_.k33_)
+      + sizeof(CameraInternalParameters::_impl_.k33_)
+      - PROTOBUF_FIELD_OFFSET(CameraInternalParameters, _impl_.k11_)>(
+          reinterpret_cast<char*>(&_impl_.k11_),
+          reinterpret_cast<char*>(&other->_impl_.k11_));
 }
 
-::google::protobuf::Metadata CameraInternalParameters::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CameraInternalParameters_descriptor_;
-  metadata.reflection = CameraInternalParameters_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CameraInternalParameters::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[0]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int RadialDistortion::kK1FieldNumber;
-const int RadialDistortion::kK2FieldNumber;
-const int RadialDistortion::kK3FieldNumber;
-#endif  // !_MSC_VER
-
-RadialDistortion::RadialDistortion()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class RadialDistortion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RadialDistortion>()._impl_._has_bits_);
+  static void set_has_k1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_k2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_k3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
 
-void RadialDistortion::InitAsDefaultInstance() {
+RadialDistortion::RadialDistortion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.RadialDistortion)
 }
-
 RadialDistortion::RadialDistortion(const RadialDistortion& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void RadialDistortion::SharedCtor() {
-  _cached_size_ = 0;
-  k1_ = 0;
-  k2_ = 0;
-  k3_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RadialDistortion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k1_){}
+    , decltype(_impl_.k2_){}
+    , decltype(_impl_.k3_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.k1_, &from._impl_.k1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.k3_) -
+    reinterpret_cast<char*>(&_impl_.k1_)) + sizeof(_impl_.k3_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.RadialDistortion)
+}
+
+inline void RadialDistortion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k1_){0}
+    , decltype(_impl_.k2_){0}
+    , decltype(_impl_.k3_){0}
+  };
 }
 
 RadialDistortion::~RadialDistortion() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.RadialDistortion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RadialDistortion::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void RadialDistortion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void RadialDistortion::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* RadialDistortion::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return RadialDistortion_descriptor_;
-}
-
-const RadialDistortion& RadialDistortion::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-RadialDistortion* RadialDistortion::default_instance_ = NULL;
-
-RadialDistortion* RadialDistortion::New() const {
-  return new RadialDistortion;
+  _impl_._cached_size_.Set(size);
 }
 
 void RadialDistortion::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    k1_ = 0;
-    k2_ = 0;
-    k3_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool RadialDistortion::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.RadialDistortion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.k1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.k3_) -
+        reinterpret_cast<char*>(&_impl_.k1_)) + sizeof(_impl_.k3_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RadialDistortion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float k1 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k1_)));
-          set_has_k1();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_k2;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_k1(&has_bits);
+          _impl_.k1_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float k2 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k2:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k2_)));
-          set_has_k2();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_k3;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_k2(&has_bits);
+          _impl_.k2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float k3 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k3:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k3_)));
-          set_has_k3();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void RadialDistortion::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_k3(&has_bits);
+          _impl_.k3_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RadialDistortion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.RadialDistortion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float k1 = 1;
-  if (has_k1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->k1(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_k1(), target);
   }
-  
+
   // optional float k2 = 2;
-  if (has_k2()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->k2(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_k2(), target);
   }
-  
+
   // optional float k3 = 3;
-  if (has_k3()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->k3(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_k3(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.RadialDistortion)
+  return target;
 }
 
-::google::protobuf::uint8* RadialDistortion::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
+size_t RadialDistortion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.RadialDistortion)
+  size_t total_size = 0;
+
   // required float k1 = 1;
-  if (has_k1()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->k1(), target);
-  }
-  
-  // optional float k2 = 2;
-  if (has_k2()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->k2(), target);
-  }
-  
-  // optional float k3 = 3;
-  if (has_k3()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->k3(), target);
+  if (_internal_has_k1()) {
+    total_size += 1 + 4;
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-int RadialDistortion::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required float k1 = 1;
-    if (has_k1()) {
-      total_size += 1 + 4;
-    }
-    
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000006u) {
     // optional float k2 = 2;
-    if (has_k2()) {
+    if (cached_has_bits & 0x00000002u) {
       total_size += 1 + 4;
     }
-    
+
     // optional float k3 = 3;
-    if (has_k3()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 + 4;
     }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void RadialDistortion::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const RadialDistortion* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const RadialDistortion*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RadialDistortion::MergeFrom(const RadialDistortion& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_k1()) {
-      set_k1(from.k1());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RadialDistortion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RadialDistortion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RadialDistortion::GetClassData() const { return &_class_data_; }
+
+
+void RadialDistortion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RadialDistortion*>(&to_msg);
+  auto& from = static_cast<const RadialDistortion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.RadialDistortion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.k1_ = from._impl_.k1_;
     }
-    if (from.has_k2()) {
-      set_k2(from.k2());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.k2_ = from._impl_.k2_;
     }
-    if (from.has_k3()) {
-      set_k3(from.k3());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.k3_ = from._impl_.k3_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void RadialDistortion::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RadialDistortion::CopyFrom(const RadialDistortion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.RadialDistortion)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool RadialDistortion::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000001) != 0x00000001) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void RadialDistortion::Swap(RadialDistortion* other) {
-  if (other != this) {
-    std::swap(k1_, other->k1_);
-    std::swap(k2_, other->k2_);
-    std::swap(k3_, other->k3_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void RadialDistortion::InternalSwap(RadialDistortion* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RadialDistortion, _impl_.k3_)
+      + sizeof(RadialDistortion::_impl_.k3_)
+      - PROTOBUF_FIELD_OFFSET(RadialDistortion, _impl_.k1_)>(
+          reinterpret_cast<char*>(&_impl_.k1_),
+          reinterpret_cast<char*>(&other->_impl_.k1_));
 }
 
-::google::protobuf::Metadata RadialDistortion::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = RadialDistortion_descriptor_;
-  metadata.reflection = RadialDistortion_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata RadialDistortion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int TangentialDistortion::kK1FieldNumber;
-const int TangentialDistortion::kK2FieldNumber;
-const int TangentialDistortion::kK3FieldNumber;
-#endif  // !_MSC_VER
-
-TangentialDistortion::TangentialDistortion()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class TangentialDistortion::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TangentialDistortion>()._impl_._has_bits_);
+  static void set_has_k1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_k2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_k3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-void TangentialDistortion::InitAsDefaultInstance() {
+TangentialDistortion::TangentialDistortion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.TangentialDistortion)
 }
-
 TangentialDistortion::TangentialDistortion(const TangentialDistortion& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void TangentialDistortion::SharedCtor() {
-  _cached_size_ = 0;
-  k1_ = 0;
-  k2_ = 0;
-  k3_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TangentialDistortion* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k1_){}
+    , decltype(_impl_.k2_){}
+    , decltype(_impl_.k3_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.k1_, &from._impl_.k1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.k3_) -
+    reinterpret_cast<char*>(&_impl_.k1_)) + sizeof(_impl_.k3_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.TangentialDistortion)
+}
+
+inline void TangentialDistortion::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.k1_){0}
+    , decltype(_impl_.k2_){0}
+    , decltype(_impl_.k3_){0}
+  };
 }
 
 TangentialDistortion::~TangentialDistortion() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.TangentialDistortion)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TangentialDistortion::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void TangentialDistortion::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void TangentialDistortion::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TangentialDistortion::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TangentialDistortion_descriptor_;
-}
-
-const TangentialDistortion& TangentialDistortion::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-TangentialDistortion* TangentialDistortion::default_instance_ = NULL;
-
-TangentialDistortion* TangentialDistortion::New() const {
-  return new TangentialDistortion;
+  _impl_._cached_size_.Set(size);
 }
 
 void TangentialDistortion::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    k1_ = 0;
-    k2_ = 0;
-    k3_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool TangentialDistortion::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.TangentialDistortion)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.k1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.k3_) -
+        reinterpret_cast<char*>(&_impl_.k1_)) + sizeof(_impl_.k3_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TangentialDistortion::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float k1 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k1_)));
-          set_has_k1();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_k2;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_k1(&has_bits);
+          _impl_.k1_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float k2 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k2:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k2_)));
-          set_has_k2();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_k3;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_k2(&has_bits);
+          _impl_.k2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // optional float k3 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_k3:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &k3_)));
-          set_has_k3();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void TangentialDistortion::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_k3(&has_bits);
+          _impl_.k3_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TangentialDistortion::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.TangentialDistortion)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float k1 = 1;
-  if (has_k1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->k1(), output);
-  }
-  
-  // required float k2 = 2;
-  if (has_k2()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->k2(), output);
-  }
-  
-  // optional float k3 = 3;
-  if (has_k3()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->k3(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_k1(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
 
-::google::protobuf::uint8* TangentialDistortion::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required float k1 = 1;
-  if (has_k1()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->k1(), target);
-  }
-  
   // required float k2 = 2;
-  if (has_k2()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->k2(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_k2(), target);
   }
-  
+
   // optional float k3 = 3;
-  if (has_k3()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->k3(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_k3(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.TangentialDistortion)
   return target;
 }
 
-int TangentialDistortion::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t TangentialDistortion::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.TangentialDistortion)
+  size_t total_size = 0;
+
+  if (_internal_has_k1()) {
     // required float k1 = 1;
-    if (has_k1()) {
-      total_size += 1 + 4;
-    }
-    
-    // required float k2 = 2;
-    if (has_k2()) {
-      total_size += 1 + 4;
-    }
-    
-    // optional float k3 = 3;
-    if (has_k3()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_k2()) {
+    // required float k2 = 2;
+    total_size += 1 + 4;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t TangentialDistortion::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.TangentialDistortion)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required float k1 = 1;
+    total_size += 1 + 4;
+
+    // required float k2 = 2;
+    total_size += 1 + 4;
 
-void TangentialDistortion::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TangentialDistortion* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TangentialDistortion*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional float k3 = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 + 4;
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TangentialDistortion::MergeFrom(const TangentialDistortion& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_k1()) {
-      set_k1(from.k1());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TangentialDistortion::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TangentialDistortion::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TangentialDistortion::GetClassData() const { return &_class_data_; }
+
+
+void TangentialDistortion::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TangentialDistortion*>(&to_msg);
+  auto& from = static_cast<const TangentialDistortion&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.TangentialDistortion)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.k1_ = from._impl_.k1_;
     }
-    if (from.has_k2()) {
-      set_k2(from.k2());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.k2_ = from._impl_.k2_;
     }
-    if (from.has_k3()) {
-      set_k3(from.k3());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.k3_ = from._impl_.k3_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void TangentialDistortion::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TangentialDistortion::CopyFrom(const TangentialDistortion& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.TangentialDistortion)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TangentialDistortion::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void TangentialDistortion::Swap(TangentialDistortion* other) {
-  if (other != this) {
-    std::swap(k1_, other->k1_);
-    std::swap(k2_, other->k2_);
-    std::swap(k3_, other->k3_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void TangentialDistortion::InternalSwap(TangentialDistortion* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TangentialDistortion, _impl_.k3_)
+      + sizeof(TangentialDistortion::_impl_.k3_)
+      - PROTOBUF_FIELD_OFFSET(TangentialDistortion, _impl_.k1_)>(
+          reinterpret_cast<char*>(&_impl_.k1_),
+          reinterpret_cast<char*>(&other->_impl_.k1_));
 }
 
-::google::protobuf::Metadata TangentialDistortion::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TangentialDistortion_descriptor_;
-  metadata.reflection = TangentialDistortion_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata TangentialDistortion::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[2]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int RotationMatrix::kR11FieldNumber;
-const int RotationMatrix::kR12FieldNumber;
-const int RotationMatrix::kR13FieldNumber;
-const int RotationMatrix::kR21FieldNumber;
-const int RotationMatrix::kR22FieldNumber;
-const int RotationMatrix::kR23FieldNumber;
-const int RotationMatrix::kR31FieldNumber;
-const int RotationMatrix::kR32FieldNumber;
-const int RotationMatrix::kR33FieldNumber;
-#endif  // !_MSC_VER
-
-RotationMatrix::RotationMatrix()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class RotationMatrix::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RotationMatrix>()._impl_._has_bits_);
+  static void set_has_r11(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_r12(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_r13(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_r21(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_r22(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_r23(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_r31(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_r32(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_r33(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000001ff) ^ 0x000001ff) != 0;
+  }
+};
 
-void RotationMatrix::InitAsDefaultInstance() {
+RotationMatrix::RotationMatrix(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.RotationMatrix)
 }
-
 RotationMatrix::RotationMatrix(const RotationMatrix& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void RotationMatrix::SharedCtor() {
-  _cached_size_ = 0;
-  r11_ = 0;
-  r12_ = 0;
-  r13_ = 0;
-  r21_ = 0;
-  r22_ = 0;
-  r23_ = 0;
-  r31_ = 0;
-  r32_ = 0;
-  r33_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RotationMatrix* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.r11_){}
+    , decltype(_impl_.r12_){}
+    , decltype(_impl_.r13_){}
+    , decltype(_impl_.r21_){}
+    , decltype(_impl_.r22_){}
+    , decltype(_impl_.r23_){}
+    , decltype(_impl_.r31_){}
+    , decltype(_impl_.r32_){}
+    , decltype(_impl_.r33_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.r11_, &from._impl_.r11_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.r33_) -
+    reinterpret_cast<char*>(&_impl_.r11_)) + sizeof(_impl_.r33_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.RotationMatrix)
+}
+
+inline void RotationMatrix::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.r11_){0}
+    , decltype(_impl_.r12_){0}
+    , decltype(_impl_.r13_){0}
+    , decltype(_impl_.r21_){0}
+    , decltype(_impl_.r22_){0}
+    , decltype(_impl_.r23_){0}
+    , decltype(_impl_.r31_){0}
+    , decltype(_impl_.r32_){0}
+    , decltype(_impl_.r33_){0}
+  };
 }
 
 RotationMatrix::~RotationMatrix() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.RotationMatrix)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void RotationMatrix::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void RotationMatrix::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void RotationMatrix::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* RotationMatrix::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return RotationMatrix_descriptor_;
-}
-
-const RotationMatrix& RotationMatrix::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-RotationMatrix* RotationMatrix::default_instance_ = NULL;
-
-RotationMatrix* RotationMatrix::New() const {
-  return new RotationMatrix;
+  _impl_._cached_size_.Set(size);
 }
 
 void RotationMatrix::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    r11_ = 0;
-    r12_ = 0;
-    r13_ = 0;
-    r21_ = 0;
-    r22_ = 0;
-    r23_ = 0;
-    r31_ = 0;
-    r32_ = 0;
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    r33_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool RotationMatrix::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.RotationMatrix)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    ::memset(&_impl_.r11_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.r32_) -
+        reinterpret_cast<char*>(&_impl_.r11_)) + sizeof(_impl_.r32_));
+  }
+  _impl_.r33_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RotationMatrix::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float r11 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r11_)));
-          set_has_r11();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_r12;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_r11(&has_bits);
+          _impl_.r11_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r12 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r12:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r12_)));
-          set_has_r12();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_r13;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_r12(&has_bits);
+          _impl_.r12_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r13 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r13:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r13_)));
-          set_has_r13();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(37)) goto parse_r21;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_r13(&has_bits);
+          _impl_.r13_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r21 = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r21:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r21_)));
-          set_has_r21();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(45)) goto parse_r22;
-        break;
-      }
-      
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 37)) {
+          _Internal::set_has_r21(&has_bits);
+          _impl_.r21_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r22 = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r22:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r22_)));
-          set_has_r22();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(53)) goto parse_r23;
-        break;
-      }
-      
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 45)) {
+          _Internal::set_has_r22(&has_bits);
+          _impl_.r22_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r23 = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r23:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r23_)));
-          set_has_r23();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(61)) goto parse_r31;
-        break;
-      }
-      
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 53)) {
+          _Internal::set_has_r23(&has_bits);
+          _impl_.r23_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r31 = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r31:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r31_)));
-          set_has_r31();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(69)) goto parse_r32;
-        break;
-      }
-      
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 61)) {
+          _Internal::set_has_r31(&has_bits);
+          _impl_.r31_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r32 = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r32:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r32_)));
-          set_has_r32();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(77)) goto parse_r33;
-        break;
-      }
-      
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 69)) {
+          _Internal::set_has_r32(&has_bits);
+          _impl_.r32_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float r33 = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_r33:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &r33_)));
-          set_has_r33();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void RotationMatrix::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 77)) {
+          _Internal::set_has_r33(&has_bits);
+          _impl_.r33_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RotationMatrix::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.RotationMatrix)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float r11 = 1;
-  if (has_r11()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->r11(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_r11(), target);
   }
-  
+
   // required float r12 = 2;
-  if (has_r12()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->r12(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_r12(), target);
   }
-  
+
   // required float r13 = 3;
-  if (has_r13()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->r13(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_r13(), target);
   }
-  
+
   // required float r21 = 4;
-  if (has_r21()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(4, this->r21(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(4, this->_internal_r21(), target);
   }
-  
+
   // required float r22 = 5;
-  if (has_r22()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(5, this->r22(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(5, this->_internal_r22(), target);
   }
-  
+
   // required float r23 = 6;
-  if (has_r23()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(6, this->r23(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(6, this->_internal_r23(), target);
   }
-  
+
   // required float r31 = 7;
-  if (has_r31()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(7, this->r31(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(7, this->_internal_r31(), target);
   }
-  
+
   // required float r32 = 8;
-  if (has_r32()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(8, this->r32(), output);
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(8, this->_internal_r32(), target);
   }
-  
+
   // required float r33 = 9;
-  if (has_r33()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(9, this->r33(), output);
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(9, this->_internal_r33(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.RotationMatrix)
+  return target;
 }
 
-::google::protobuf::uint8* RotationMatrix::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required float r11 = 1;
-  if (has_r11()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->r11(), target);
-  }
-  
-  // required float r12 = 2;
-  if (has_r12()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->r12(), target);
+size_t RotationMatrix::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.RotationMatrix)
+  size_t total_size = 0;
+
+  if (_internal_has_r11()) {
+    // required float r11 = 1;
+    total_size += 1 + 4;
   }
-  
-  // required float r13 = 3;
-  if (has_r13()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->r13(), target);
+
+  if (_internal_has_r12()) {
+    // required float r12 = 2;
+    total_size += 1 + 4;
   }
-  
-  // required float r21 = 4;
-  if (has_r21()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(4, this->r21(), target);
+
+  if (_internal_has_r13()) {
+    // required float r13 = 3;
+    total_size += 1 + 4;
   }
-  
-  // required float r22 = 5;
-  if (has_r22()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(5, this->r22(), target);
+
+  if (_internal_has_r21()) {
+    // required float r21 = 4;
+    total_size += 1 + 4;
   }
-  
-  // required float r23 = 6;
-  if (has_r23()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(6, this->r23(), target);
+
+  if (_internal_has_r22()) {
+    // required float r22 = 5;
+    total_size += 1 + 4;
   }
-  
-  // required float r31 = 7;
-  if (has_r31()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(7, this->r31(), target);
+
+  if (_internal_has_r23()) {
+    // required float r23 = 6;
+    total_size += 1 + 4;
   }
-  
-  // required float r32 = 8;
-  if (has_r32()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(8, this->r32(), target);
+
+  if (_internal_has_r31()) {
+    // required float r31 = 7;
+    total_size += 1 + 4;
   }
-  
-  // required float r33 = 9;
-  if (has_r33()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(9, this->r33(), target);
+
+  if (_internal_has_r32()) {
+    // required float r32 = 8;
+    total_size += 1 + 4;
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (_internal_has_r33()) {
+    // required float r33 = 9;
+    total_size += 1 + 4;
   }
-  return target;
+
+  return total_size;
 }
+size_t RotationMatrix::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.RotationMatrix)
+  size_t total_size = 0;
 
-int RotationMatrix::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+  if (((_impl_._has_bits_[0] & 0x000001ff) ^ 0x000001ff) == 0) {  // All required fields are present.
     // required float r11 = 1;
-    if (has_r11()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r12 = 2;
-    if (has_r12()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r13 = 3;
-    if (has_r13()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r21 = 4;
-    if (has_r21()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r22 = 5;
-    if (has_r22()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r23 = 6;
-    if (has_r23()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r31 = 7;
-    if (has_r31()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+
     // required float r32 = 8;
-    if (has_r32()) {
-      total_size += 1 + 4;
-    }
-    
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
+    total_size += 1 + 4;
+
     // required float r33 = 9;
-    if (has_r33()) {
-      total_size += 1 + 4;
-    }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
+    total_size += 1 + 4;
 
-void RotationMatrix::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const RotationMatrix* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const RotationMatrix*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void RotationMatrix::MergeFrom(const RotationMatrix& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_r11()) {
-      set_r11(from.r11());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RotationMatrix::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RotationMatrix::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RotationMatrix::GetClassData() const { return &_class_data_; }
+
+
+void RotationMatrix::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RotationMatrix*>(&to_msg);
+  auto& from = static_cast<const RotationMatrix&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.RotationMatrix)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.r11_ = from._impl_.r11_;
     }
-    if (from.has_r12()) {
-      set_r12(from.r12());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.r12_ = from._impl_.r12_;
     }
-    if (from.has_r13()) {
-      set_r13(from.r13());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.r13_ = from._impl_.r13_;
     }
-    if (from.has_r21()) {
-      set_r21(from.r21());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.r21_ = from._impl_.r21_;
     }
-    if (from.has_r22()) {
-      set_r22(from.r22());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.r22_ = from._impl_.r22_;
     }
-    if (from.has_r23()) {
-      set_r23(from.r23());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.r23_ = from._impl_.r23_;
     }
-    if (from.has_r31()) {
-      set_r31(from.r31());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.r31_ = from._impl_.r31_;
     }
-    if (from.has_r32()) {
-      set_r32(from.r32());
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.r32_ = from._impl_.r32_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_r33()) {
-      set_r33(from.r33());
-    }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_r33(from._internal_r33());
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void RotationMatrix::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void RotationMatrix::CopyFrom(const RotationMatrix& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.RotationMatrix)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool RotationMatrix::IsInitialized() const {
-  if ((_has_bits_[0] & 0x000001ff) != 0x000001ff) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void RotationMatrix::Swap(RotationMatrix* other) {
-  if (other != this) {
-    std::swap(r11_, other->r11_);
-    std::swap(r12_, other->r12_);
-    std::swap(r13_, other->r13_);
-    std::swap(r21_, other->r21_);
-    std::swap(r22_, other->r22_);
-    std::swap(r23_, other->r23_);
-    std::swap(r31_, other->r31_);
-    std::swap(r32_, other->r32_);
-    std::swap(r33_, other->r33_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void RotationMatrix::InternalSwap(RotationMatrix* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RotationMatrix, _impl_.r33_)
+      + sizeof(RotationMatrix::_impl_.r33_)
+      - PROTOBUF_FIELD_OFFSET(RotationMatrix, _impl_.r11_)>(
+          reinterpret_cast<char*>(&_impl_.r11_),
+          reinterpret_cast<char*>(&other->_impl_.r11_));
 }
 
-::google::protobuf::Metadata RotationMatrix::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = RotationMatrix_descriptor_;
-  metadata.reflection = RotationMatrix_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata RotationMatrix::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[3]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int TranslationVector::kT1FieldNumber;
-const int TranslationVector::kT2FieldNumber;
-const int TranslationVector::kT3FieldNumber;
-#endif  // !_MSC_VER
-
-TranslationVector::TranslationVector()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class TranslationVector::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TranslationVector>()._impl_._has_bits_);
+  static void set_has_t1(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_t2(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_t3(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
 
-void TranslationVector::InitAsDefaultInstance() {
+TranslationVector::TranslationVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.TranslationVector)
 }
-
 TranslationVector::TranslationVector(const TranslationVector& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void TranslationVector::SharedCtor() {
-  _cached_size_ = 0;
-  t1_ = 0;
-  t2_ = 0;
-  t3_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TranslationVector* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.t1_){}
+    , decltype(_impl_.t2_){}
+    , decltype(_impl_.t3_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.t1_, &from._impl_.t1_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.t3_) -
+    reinterpret_cast<char*>(&_impl_.t1_)) + sizeof(_impl_.t3_));
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.TranslationVector)
+}
+
+inline void TranslationVector::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.t1_){0}
+    , decltype(_impl_.t2_){0}
+    , decltype(_impl_.t3_){0}
+  };
 }
 
 TranslationVector::~TranslationVector() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.TranslationVector)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void TranslationVector::SharedDtor() {
-  if (this != default_instance_) {
-  }
+inline void TranslationVector::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
 void TranslationVector::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* TranslationVector::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return TranslationVector_descriptor_;
-}
-
-const TranslationVector& TranslationVector::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-TranslationVector* TranslationVector::default_instance_ = NULL;
-
-TranslationVector* TranslationVector::New() const {
-  return new TranslationVector;
+  _impl_._cached_size_.Set(size);
 }
 
 void TranslationVector::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    t1_ = 0;
-    t2_ = 0;
-    t3_ = 0;
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool TranslationVector::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.TranslationVector)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.t1_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.t3_) -
+        reinterpret_cast<char*>(&_impl_.t1_)) + sizeof(_impl_.t3_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TranslationVector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required float t1 = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &t1_)));
-          set_has_t1();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(21)) goto parse_t2;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _Internal::set_has_t1(&has_bits);
+          _impl_.t1_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float t2 = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_t2:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &t2_)));
-          set_has_t2();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(29)) goto parse_t3;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _Internal::set_has_t2(&has_bits);
+          _impl_.t2_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       // required float t3 = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_FIXED32) {
-         parse_t3:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
-                 input, &t3_)));
-          set_has_t3();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void TranslationVector::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _Internal::set_has_t3(&has_bits);
+          _impl_.t3_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TranslationVector::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.TranslationVector)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required float t1 = 1;
-  if (has_t1()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(1, this->t1(), output);
-  }
-  
-  // required float t2 = 2;
-  if (has_t2()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(2, this->t2(), output);
-  }
-  
-  // required float t3 = 3;
-  if (has_t3()) {
-    ::google::protobuf::internal::WireFormatLite::WriteFloat(3, this->t3(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_t1(), target);
   }
-}
 
-::google::protobuf::uint8* TranslationVector::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required float t1 = 1;
-  if (has_t1()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(1, this->t1(), target);
-  }
-  
   // required float t2 = 2;
-  if (has_t2()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(2, this->t2(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_t2(), target);
   }
-  
+
   // required float t3 = 3;
-  if (has_t3()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteFloatToArray(3, this->t3(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_t3(), target);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.TranslationVector)
   return target;
 }
 
-int TranslationVector::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t TranslationVector::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.TranslationVector)
+  size_t total_size = 0;
+
+  if (_internal_has_t1()) {
     // required float t1 = 1;
-    if (has_t1()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
+  }
+
+  if (_internal_has_t2()) {
     // required float t2 = 2;
-    if (has_t2()) {
-      total_size += 1 + 4;
-    }
-    
-    // required float t3 = 3;
-    if (has_t3()) {
-      total_size += 1 + 4;
-    }
-    
+    total_size += 1 + 4;
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_t3()) {
+    // required float t3 = 3;
+    total_size += 1 + 4;
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t TranslationVector::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.TranslationVector)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required float t1 = 1;
+    total_size += 1 + 4;
+
+    // required float t2 = 2;
+    total_size += 1 + 4;
+
+    // required float t3 = 3;
+    total_size += 1 + 4;
 
-void TranslationVector::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const TranslationVector* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const TranslationVector*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void TranslationVector::MergeFrom(const TranslationVector& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_t1()) {
-      set_t1(from.t1());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TranslationVector::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TranslationVector::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TranslationVector::GetClassData() const { return &_class_data_; }
+
+
+void TranslationVector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TranslationVector*>(&to_msg);
+  auto& from = static_cast<const TranslationVector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.TranslationVector)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.t1_ = from._impl_.t1_;
     }
-    if (from.has_t2()) {
-      set_t2(from.t2());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.t2_ = from._impl_.t2_;
     }
-    if (from.has_t3()) {
-      set_t3(from.t3());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.t3_ = from._impl_.t3_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void TranslationVector::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void TranslationVector::CopyFrom(const TranslationVector& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.TranslationVector)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool TranslationVector::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-  
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void TranslationVector::Swap(TranslationVector* other) {
-  if (other != this) {
-    std::swap(t1_, other->t1_);
-    std::swap(t2_, other->t2_);
-    std::swap(t3_, other->t3_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void TranslationVector::InternalSwap(TranslationVector* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TranslationVector, _impl_.t3_)
+      + sizeof(TranslationVector::_impl_.t3_)
+      - PROTOBUF_FIELD_OFFSET(TranslationVector, _impl_.t1_)>(
+          reinterpret_cast<char*>(&_impl_.t1_),
+          reinterpret_cast<char*>(&other->_impl_.t1_));
 }
 
-::google::protobuf::Metadata TranslationVector::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = TranslationVector_descriptor_;
-  metadata.reflection = TranslationVector_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata TranslationVector::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[4]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Pose::kRotationFieldNumber;
-const int Pose::kTranslationFieldNumber;
-#endif  // !_MSC_VER
+class Pose::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Pose>()._impl_._has_bits_);
+  static const ::doppia_protobuf::RotationMatrix& rotation(const Pose* msg);
+  static void set_has_rotation(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::TranslationVector& translation(const Pose* msg);
+  static void set_has_translation(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
 
-Pose::Pose()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::RotationMatrix&
+Pose::_Internal::rotation(const Pose* msg) {
+  return *msg->_impl_.rotation_;
 }
-
-void Pose::InitAsDefaultInstance() {
-  rotation_ = const_cast< ::doppia_protobuf::RotationMatrix*>(&::doppia_protobuf::RotationMatrix::default_instance());
-  translation_ = const_cast< ::doppia_protobuf::TranslationVector*>(&::doppia_protobuf::TranslationVector::default_instance());
+const ::doppia_protobuf::TranslationVector&
+Pose::_Internal::translation(const Pose* msg) {
+  return *msg->_impl_.translation_;
 }
-
-Pose::Pose(const Pose& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+Pose::Pose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.Pose)
 }
-
-void Pose::SharedCtor() {
-  _cached_size_ = 0;
-  rotation_ = NULL;
-  translation_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+Pose::Pose(const Pose& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pose* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.translation_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_rotation()) {
+    _this->_impl_.rotation_ = new ::doppia_protobuf::RotationMatrix(*from._impl_.rotation_);
+  }
+  if (from._internal_has_translation()) {
+    _this->_impl_.translation_ = new ::doppia_protobuf::TranslationVector(*from._impl_.translation_);
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.Pose)
+}
+
+inline void Pose::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rotation_){nullptr}
+    , decltype(_impl_.translation_){nullptr}
+  };
 }
 
 Pose::~Pose() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.Pose)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Pose::SharedDtor() {
-  if (this != default_instance_) {
-    delete rotation_;
-    delete translation_;
-  }
+inline void Pose::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.rotation_;
+  if (this != internal_default_instance()) delete _impl_.translation_;
 }
 
 void Pose::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Pose::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Pose_descriptor_;
-}
-
-const Pose& Pose::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-Pose* Pose::default_instance_ = NULL;
-
-Pose* Pose::New() const {
-  return new Pose;
+  _impl_._cached_size_.Set(size);
 }
 
 void Pose::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_rotation()) {
-      if (rotation_ != NULL) rotation_->::doppia_protobuf::RotationMatrix::Clear();
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.Pose)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.rotation_ != nullptr);
+      _impl_.rotation_->Clear();
     }
-    if (has_translation()) {
-      if (translation_ != NULL) translation_->::doppia_protobuf::TranslationVector::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.translation_ != nullptr);
+      _impl_.translation_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Pose::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Pose::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required .doppia_protobuf.RotationMatrix rotation = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_rotation()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_translation;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rotation(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.TranslationVector translation = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_translation:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_translation()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Pose::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_translation(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Pose::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.Pose)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required .doppia_protobuf.RotationMatrix rotation = 1;
-  if (has_rotation()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      1, this->rotation(), output);
-  }
-  
-  // required .doppia_protobuf.TranslationVector translation = 2;
-  if (has_translation()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->translation(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rotation(this),
+        _Internal::rotation(this).GetCachedSize(), target, stream);
   }
-}
 
-::google::protobuf::uint8* Pose::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required .doppia_protobuf.RotationMatrix rotation = 1;
-  if (has_rotation()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        1, this->rotation(), target);
-  }
-  
   // required .doppia_protobuf.TranslationVector translation = 2;
-  if (has_translation()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->translation(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::translation(this),
+        _Internal::translation(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.Pose)
   return target;
 }
 
-int Pose::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
+size_t Pose::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.Pose)
+  size_t total_size = 0;
+
+  if (_internal_has_rotation()) {
     // required .doppia_protobuf.RotationMatrix rotation = 1;
-    if (has_rotation()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->rotation());
-    }
-    
-    // required .doppia_protobuf.TranslationVector translation = 2;
-    if (has_translation()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->translation());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rotation_);
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_translation()) {
+    // required .doppia_protobuf.TranslationVector translation = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.translation_);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t Pose::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.Pose)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required .doppia_protobuf.RotationMatrix rotation = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rotation_);
+
+    // required .doppia_protobuf.TranslationVector translation = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.translation_);
 
-void Pose::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Pose* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Pose*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Pose::MergeFrom(const Pose& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_rotation()) {
-      mutable_rotation()->::doppia_protobuf::RotationMatrix::MergeFrom(from.rotation());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pose::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pose::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pose::GetClassData() const { return &_class_data_; }
+
+
+void Pose::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pose*>(&to_msg);
+  auto& from = static_cast<const Pose&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.Pose)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_rotation()->::doppia_protobuf::RotationMatrix::MergeFrom(
+          from._internal_rotation());
     }
-    if (from.has_translation()) {
-      mutable_translation()->::doppia_protobuf::TranslationVector::MergeFrom(from.translation());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_translation()->::doppia_protobuf::TranslationVector::MergeFrom(
+          from._internal_translation());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Pose::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Pose::CopyFrom(const Pose& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.Pose)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Pose::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
-  
-  if (has_rotation()) {
-    if (!this->rotation().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_rotation()) {
+    if (!_impl_.rotation_->IsInitialized()) return false;
   }
-  if (has_translation()) {
-    if (!this->translation().IsInitialized()) return false;
+  if (_internal_has_translation()) {
+    if (!_impl_.translation_->IsInitialized()) return false;
   }
   return true;
 }
 
-void Pose::Swap(Pose* other) {
-  if (other != this) {
-    std::swap(rotation_, other->rotation_);
-    std::swap(translation_, other->translation_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Pose::InternalSwap(Pose* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Pose, _impl_.translation_)
+      + sizeof(Pose::_impl_.translation_)
+      - PROTOBUF_FIELD_OFFSET(Pose, _impl_.rotation_)>(
+          reinterpret_cast<char*>(&_impl_.rotation_),
+          reinterpret_cast<char*>(&other->_impl_.rotation_));
 }
 
-::google::protobuf::Metadata Pose::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Pose_descriptor_;
-  metadata.reflection = Pose_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Pose::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[5]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int CameraCalibration::kNameFieldNumber;
-const int CameraCalibration::kInternalParametersFieldNumber;
-const int CameraCalibration::kRadialDistortionFieldNumber;
-const int CameraCalibration::kTangentialDistortionFieldNumber;
-const int CameraCalibration::kPoseFieldNumber;
-#endif  // !_MSC_VER
+class CameraCalibration::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CameraCalibration>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::CameraInternalParameters& internal_parameters(const CameraCalibration* msg);
+  static void set_has_internal_parameters(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::RadialDistortion& radial_distortion(const CameraCalibration* msg);
+  static void set_has_radial_distortion(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::doppia_protobuf::TangentialDistortion& tangential_distortion(const CameraCalibration* msg);
+  static void set_has_tangential_distortion(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::doppia_protobuf::Pose& pose(const CameraCalibration* msg);
+  static void set_has_pose(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
 
-CameraCalibration::CameraCalibration()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::CameraInternalParameters&
+CameraCalibration::_Internal::internal_parameters(const CameraCalibration* msg) {
+  return *msg->_impl_.internal_parameters_;
 }
-
-void CameraCalibration::InitAsDefaultInstance() {
-  internal_parameters_ = const_cast< ::doppia_protobuf::CameraInternalParameters*>(&::doppia_protobuf::CameraInternalParameters::default_instance());
-  radial_distortion_ = const_cast< ::doppia_protobuf::RadialDistortion*>(&::doppia_protobuf::RadialDistortion::default_instance());
-  tangential_distortion_ = const_cast< ::doppia_protobuf::TangentialDistortion*>(&::doppia_protobuf::TangentialDistortion::default_instance());
-  pose_ = const_cast< ::doppia_protobuf::Pose*>(&::doppia_protobuf::Pose::default_instance());
+const ::doppia_protobuf::RadialDistortion&
+CameraCalibration::_Internal::radial_distortion(const CameraCalibration* msg) {
+  return *msg->_impl_.radial_distortion_;
 }
-
-CameraCalibration::CameraCalibration(const CameraCalibration& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+const ::doppia_protobuf::TangentialDistortion&
+CameraCalibration::_Internal::tangential_distortion(const CameraCalibration* msg) {
+  return *msg->_impl_.tangential_distortion_;
 }
-
-void CameraCalibration::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  internal_parameters_ = NULL;
-  radial_distortion_ = NULL;
-  tangential_distortion_ = NULL;
-  pose_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+const ::doppia_protobuf::Pose&
+CameraCalibration::_Internal::pose(const CameraCalibration* msg) {
+  return *msg->_impl_.pose_;
+}
+CameraCalibration::CameraCalibration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.CameraCalibration)
+}
+CameraCalibration::CameraCalibration(const CameraCalibration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CameraCalibration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.internal_parameters_){nullptr}
+    , decltype(_impl_.radial_distortion_){nullptr}
+    , decltype(_impl_.tangential_distortion_){nullptr}
+    , decltype(_impl_.pose_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_internal_parameters()) {
+    _this->_impl_.internal_parameters_ = new ::doppia_protobuf::CameraInternalParameters(*from._impl_.internal_parameters_);
+  }
+  if (from._internal_has_radial_distortion()) {
+    _this->_impl_.radial_distortion_ = new ::doppia_protobuf::RadialDistortion(*from._impl_.radial_distortion_);
+  }
+  if (from._internal_has_tangential_distortion()) {
+    _this->_impl_.tangential_distortion_ = new ::doppia_protobuf::TangentialDistortion(*from._impl_.tangential_distortion_);
+  }
+  if (from._internal_has_pose()) {
+    _this->_impl_.pose_ = new ::doppia_protobuf::Pose(*from._impl_.pose_);
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.CameraCalibration)
+}
+
+inline void CameraCalibration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.internal_parameters_){nullptr}
+    , decltype(_impl_.radial_distortion_){nullptr}
+    , decltype(_impl_.tangential_distortion_){nullptr}
+    , decltype(_impl_.pose_){nullptr}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 CameraCalibration::~CameraCalibration() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.CameraCalibration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void CameraCalibration::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-    delete internal_parameters_;
-    delete radial_distortion_;
-    delete tangential_distortion_;
-    delete pose_;
-  }
+inline void CameraCalibration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.internal_parameters_;
+  if (this != internal_default_instance()) delete _impl_.radial_distortion_;
+  if (this != internal_default_instance()) delete _impl_.tangential_distortion_;
+  if (this != internal_default_instance()) delete _impl_.pose_;
 }
 
 void CameraCalibration::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* CameraCalibration::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return CameraCalibration_descriptor_;
-}
-
-const CameraCalibration& CameraCalibration::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-CameraCalibration* CameraCalibration::default_instance_ = NULL;
-
-CameraCalibration* CameraCalibration::New() const {
-  return new CameraCalibration;
+  _impl_._cached_size_.Set(size);
 }
 
 void CameraCalibration::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.CameraCalibration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
     }
-    if (has_internal_parameters()) {
-      if (internal_parameters_ != NULL) internal_parameters_->::doppia_protobuf::CameraInternalParameters::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.internal_parameters_ != nullptr);
+      _impl_.internal_parameters_->Clear();
     }
-    if (has_radial_distortion()) {
-      if (radial_distortion_ != NULL) radial_distortion_->::doppia_protobuf::RadialDistortion::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.radial_distortion_ != nullptr);
+      _impl_.radial_distortion_->Clear();
     }
-    if (has_tangential_distortion()) {
-      if (tangential_distortion_ != NULL) tangential_distortion_->::doppia_protobuf::TangentialDistortion::Clear();
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.tangential_distortion_ != nullptr);
+      _impl_.tangential_distortion_->Clear();
     }
-    if (has_pose()) {
-      if (pose_ != NULL) pose_->::doppia_protobuf::Pose::Clear();
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.pose_ != nullptr);
+      _impl_.pose_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool CameraCalibration::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* CameraCalibration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_internal_parameters;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.CameraCalibration.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_internal_parameters:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_internal_parameters()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_radial_distortion;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_internal_parameters(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_radial_distortion:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_radial_distortion()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_tangential_distortion;
-        break;
-      }
-      
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_radial_distortion(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_tangential_distortion:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_tangential_distortion()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_pose;
-        break;
-      }
-      
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_tangential_distortion(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .doppia_protobuf.Pose pose = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_pose:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_pose()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pose(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CameraCalibration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.CameraCalibration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional string name = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.CameraCalibration.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
-  return true;
-#undef DO_
-}
 
-void CameraCalibration::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-  
   // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-  if (has_internal_parameters()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->internal_parameters(), output);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::internal_parameters(this),
+        _Internal::internal_parameters(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-  if (has_radial_distortion()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->radial_distortion(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::radial_distortion(this),
+        _Internal::radial_distortion(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-  if (has_tangential_distortion()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      4, this->tangential_distortion(), output);
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::tangential_distortion(this),
+        _Internal::tangential_distortion(this).GetCachedSize(), target, stream);
   }
-  
+
   // optional .doppia_protobuf.Pose pose = 5;
-  if (has_pose()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      5, this->pose(), output);
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::pose(this),
+        _Internal::pose(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.CameraCalibration)
+  return target;
 }
 
-::google::protobuf::uint8* CameraCalibration::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-  
+size_t CameraCalibration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.CameraCalibration)
+  size_t total_size = 0;
+
   // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-  if (has_internal_parameters()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->internal_parameters(), target);
-  }
-  
-  // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-  if (has_radial_distortion()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->radial_distortion(), target);
-  }
-  
-  // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-  if (has_tangential_distortion()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        4, this->tangential_distortion(), target);
-  }
-  
-  // optional .doppia_protobuf.Pose pose = 5;
-  if (has_pose()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        5, this->pose(), target);
+  if (_internal_has_internal_parameters()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.internal_parameters_);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
-  return target;
-}
 
-int CameraCalibration::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
-    
-    // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-    if (has_internal_parameters()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->internal_parameters());
-    }
-    
+  if (cached_has_bits & 0x0000001cu) {
     // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-    if (has_radial_distortion()) {
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->radial_distortion());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.radial_distortion_);
     }
-    
+
     // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-    if (has_tangential_distortion()) {
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->tangential_distortion());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.tangential_distortion_);
     }
-    
+
     // optional .doppia_protobuf.Pose pose = 5;
-    if (has_pose()) {
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->pose());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pose_);
     }
-    
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void CameraCalibration::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const CameraCalibration* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const CameraCalibration*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
   }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void CameraCalibration::MergeFrom(const CameraCalibration& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CameraCalibration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CameraCalibration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CameraCalibration::GetClassData() const { return &_class_data_; }
+
+
+void CameraCalibration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CameraCalibration*>(&to_msg);
+  auto& from = static_cast<const CameraCalibration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.CameraCalibration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_internal_parameters()) {
-      mutable_internal_parameters()->::doppia_protobuf::CameraInternalParameters::MergeFrom(from.internal_parameters());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_internal_parameters()->::doppia_protobuf::CameraInternalParameters::MergeFrom(
+          from._internal_internal_parameters());
     }
-    if (from.has_radial_distortion()) {
-      mutable_radial_distortion()->::doppia_protobuf::RadialDistortion::MergeFrom(from.radial_distortion());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_radial_distortion()->::doppia_protobuf::RadialDistortion::MergeFrom(
+          from._internal_radial_distortion());
     }
-    if (from.has_tangential_distortion()) {
-      mutable_tangential_distortion()->::doppia_protobuf::TangentialDistortion::MergeFrom(from.tangential_distortion());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_tangential_distortion()->::doppia_protobuf::TangentialDistortion::MergeFrom(
+          from._internal_tangential_distortion());
     }
-    if (from.has_pose()) {
-      mutable_pose()->::doppia_protobuf::Pose::MergeFrom(from.pose());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_pose()->::doppia_protobuf::Pose::MergeFrom(
+          from._internal_pose());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void CameraCalibration::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void CameraCalibration::CopyFrom(const CameraCalibration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.CameraCalibration)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool CameraCalibration::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000002) != 0x00000002) return false;
-  
-  if (has_internal_parameters()) {
-    if (!this->internal_parameters().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_internal_parameters()) {
+    if (!_impl_.internal_parameters_->IsInitialized()) return false;
   }
-  if (has_radial_distortion()) {
-    if (!this->radial_distortion().IsInitialized()) return false;
+  if (_internal_has_radial_distortion()) {
+    if (!_impl_.radial_distortion_->IsInitialized()) return false;
   }
-  if (has_tangential_distortion()) {
-    if (!this->tangential_distortion().IsInitialized()) return false;
+  if (_internal_has_tangential_distortion()) {
+    if (!_impl_.tangential_distortion_->IsInitialized()) return false;
   }
-  if (has_pose()) {
-    if (!this->pose().IsInitialized()) return false;
+  if (_internal_has_pose()) {
+    if (!_impl_.pose_->IsInitialized()) return false;
   }
   return true;
 }
 
-void CameraCalibration::Swap(CameraCalibration* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(internal_parameters_, other->internal_parameters_);
-    std::swap(radial_distortion_, other->radial_distortion_);
-    std::swap(tangential_distortion_, other->tangential_distortion_);
-    std::swap(pose_, other->pose_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void CameraCalibration::InternalSwap(CameraCalibration* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CameraCalibration, _impl_.pose_)
+      + sizeof(CameraCalibration::_impl_.pose_)
+      - PROTOBUF_FIELD_OFFSET(CameraCalibration, _impl_.internal_parameters_)>(
+          reinterpret_cast<char*>(&_impl_.internal_parameters_),
+          reinterpret_cast<char*>(&other->_impl_.internal_parameters_));
 }
 
-::google::protobuf::Metadata CameraCalibration::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = CameraCalibration_descriptor_;
-  metadata.reflection = CameraCalibration_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata CameraCalibration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[6]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int StereoCameraCalibration::kNameFieldNumber;
-const int StereoCameraCalibration::kLeftCameraFieldNumber;
-const int StereoCameraCalibration::kRightCameraFieldNumber;
-#endif  // !_MSC_VER
+class StereoCameraCalibration::_Internal {
+ public:
+  using HasBits = decltype(std::declval<StereoCameraCalibration>()._impl_._has_bits_);
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::doppia_protobuf::CameraCalibration& left_camera(const StereoCameraCalibration* msg);
+  static void set_has_left_camera(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::doppia_protobuf::CameraCalibration& right_camera(const StereoCameraCalibration* msg);
+  static void set_has_right_camera(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000006) ^ 0x00000006) != 0;
+  }
+};
 
-StereoCameraCalibration::StereoCameraCalibration()
-  : ::google::protobuf::Message() {
-  SharedCtor();
+const ::doppia_protobuf::CameraCalibration&
+StereoCameraCalibration::_Internal::left_camera(const StereoCameraCalibration* msg) {
+  return *msg->_impl_.left_camera_;
 }
-
-void StereoCameraCalibration::InitAsDefaultInstance() {
-  left_camera_ = const_cast< ::doppia_protobuf::CameraCalibration*>(&::doppia_protobuf::CameraCalibration::default_instance());
-  right_camera_ = const_cast< ::doppia_protobuf::CameraCalibration*>(&::doppia_protobuf::CameraCalibration::default_instance());
+const ::doppia_protobuf::CameraCalibration&
+StereoCameraCalibration::_Internal::right_camera(const StereoCameraCalibration* msg) {
+  return *msg->_impl_.right_camera_;
 }
-
-StereoCameraCalibration::StereoCameraCalibration(const StereoCameraCalibration& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+StereoCameraCalibration::StereoCameraCalibration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:doppia_protobuf.StereoCameraCalibration)
 }
-
-void StereoCameraCalibration::SharedCtor() {
-  _cached_size_ = 0;
-  name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  left_camera_ = NULL;
-  right_camera_ = NULL;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+StereoCameraCalibration::StereoCameraCalibration(const StereoCameraCalibration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StereoCameraCalibration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.left_camera_){nullptr}
+    , decltype(_impl_.right_camera_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_left_camera()) {
+    _this->_impl_.left_camera_ = new ::doppia_protobuf::CameraCalibration(*from._impl_.left_camera_);
+  }
+  if (from._internal_has_right_camera()) {
+    _this->_impl_.right_camera_ = new ::doppia_protobuf::CameraCalibration(*from._impl_.right_camera_);
+  }
+  // @@protoc_insertion_point(copy_constructor:doppia_protobuf.StereoCameraCalibration)
+}
+
+inline void StereoCameraCalibration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.left_camera_){nullptr}
+    , decltype(_impl_.right_camera_){nullptr}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 StereoCameraCalibration::~StereoCameraCalibration() {
+  // @@protoc_insertion_point(destructor:doppia_protobuf.StereoCameraCalibration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void StereoCameraCalibration::SharedDtor() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
-  }
-  if (this != default_instance_) {
-    delete left_camera_;
-    delete right_camera_;
-  }
+inline void StereoCameraCalibration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.left_camera_;
+  if (this != internal_default_instance()) delete _impl_.right_camera_;
 }
 
 void StereoCameraCalibration::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* StereoCameraCalibration::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return StereoCameraCalibration_descriptor_;
-}
-
-const StereoCameraCalibration& StereoCameraCalibration::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_calibration_2eproto();  return *default_instance_;
-}
-
-StereoCameraCalibration* StereoCameraCalibration::default_instance_ = NULL;
-
-StereoCameraCalibration* StereoCameraCalibration::New() const {
-  return new StereoCameraCalibration;
+  _impl_._cached_size_.Set(size);
 }
 
 void StereoCameraCalibration::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (has_name()) {
-      if (name_ != &::google::protobuf::internal::kEmptyString) {
-        name_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:doppia_protobuf.StereoCameraCalibration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
     }
-    if (has_left_camera()) {
-      if (left_camera_ != NULL) left_camera_->::doppia_protobuf::CameraCalibration::Clear();
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.left_camera_ != nullptr);
+      _impl_.left_camera_->Clear();
     }
-    if (has_right_camera()) {
-      if (right_camera_ != NULL) right_camera_->::doppia_protobuf::CameraCalibration::Clear();
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.right_camera_ != nullptr);
+      _impl_.right_camera_->Clear();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool StereoCameraCalibration::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* StereoCameraCalibration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name().data(), this->name().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_left_camera;
-        break;
-      }
-      
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "doppia_protobuf.StereoCameraCalibration.name");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.CameraCalibration left_camera = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_left_camera:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_left_camera()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_right_camera;
-        break;
-      }
-      
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_left_camera(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required .doppia_protobuf.CameraCalibration right_camera = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_right_camera:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-               input, mutable_right_camera()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-      
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void StereoCameraCalibration::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_right_camera(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StereoCameraCalibration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:doppia_protobuf.StereoCameraCalibration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(), output);
-  }
-  
-  // required .doppia_protobuf.CameraCalibration left_camera = 2;
-  if (has_left_camera()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      2, this->left_camera(), output);
-  }
-  
-  // required .doppia_protobuf.CameraCalibration right_camera = 3;
-  if (has_right_camera()) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->right_camera(), output);
-  }
-  
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "doppia_protobuf.StereoCameraCalibration.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
   }
-}
 
-::google::protobuf::uint8* StereoCameraCalibration::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional string name = 1;
-  if (has_name()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name().data(), this->name().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        1, this->name(), target);
-  }
-  
   // required .doppia_protobuf.CameraCalibration left_camera = 2;
-  if (has_left_camera()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        2, this->left_camera(), target);
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::left_camera(this),
+        _Internal::left_camera(this).GetCachedSize(), target, stream);
   }
-  
+
   // required .doppia_protobuf.CameraCalibration right_camera = 3;
-  if (has_right_camera()) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->right_camera(), target);
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::right_camera(this),
+        _Internal::right_camera(this).GetCachedSize(), target, stream);
   }
-  
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:doppia_protobuf.StereoCameraCalibration)
   return target;
 }
 
-int StereoCameraCalibration::ByteSize() const {
-  int total_size = 0;
-  
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional string name = 1;
-    if (has_name()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->name());
-    }
-    
+size_t StereoCameraCalibration::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:doppia_protobuf.StereoCameraCalibration)
+  size_t total_size = 0;
+
+  if (_internal_has_left_camera()) {
     // required .doppia_protobuf.CameraCalibration left_camera = 2;
-    if (has_left_camera()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->left_camera());
-    }
-    
-    // required .doppia_protobuf.CameraCalibration right_camera = 3;
-    if (has_right_camera()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-          this->right_camera());
-    }
-    
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.left_camera_);
   }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+
+  if (_internal_has_right_camera()) {
+    // required .doppia_protobuf.CameraCalibration right_camera = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.right_camera_);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
   return total_size;
 }
+size_t StereoCameraCalibration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:doppia_protobuf.StereoCameraCalibration)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000006) ^ 0x00000006) == 0) {  // All required fields are present.
+    // required .doppia_protobuf.CameraCalibration left_camera = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.left_camera_);
+
+    // required .doppia_protobuf.CameraCalibration right_camera = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.right_camera_);
 
-void StereoCameraCalibration::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const StereoCameraCalibration* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const StereoCameraCalibration*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
   } else {
-    MergeFrom(*source);
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string name = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void StereoCameraCalibration::MergeFrom(const StereoCameraCalibration& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_name()) {
-      set_name(from.name());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StereoCameraCalibration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StereoCameraCalibration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StereoCameraCalibration::GetClassData() const { return &_class_data_; }
+
+
+void StereoCameraCalibration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StereoCameraCalibration*>(&to_msg);
+  auto& from = static_cast<const StereoCameraCalibration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:doppia_protobuf.StereoCameraCalibration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name(from._internal_name());
     }
-    if (from.has_left_camera()) {
-      mutable_left_camera()->::doppia_protobuf::CameraCalibration::MergeFrom(from.left_camera());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_left_camera()->::doppia_protobuf::CameraCalibration::MergeFrom(
+          from._internal_left_camera());
     }
-    if (from.has_right_camera()) {
-      mutable_right_camera()->::doppia_protobuf::CameraCalibration::MergeFrom(from.right_camera());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_right_camera()->::doppia_protobuf::CameraCalibration::MergeFrom(
+          from._internal_right_camera());
     }
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void StereoCameraCalibration::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void StereoCameraCalibration::CopyFrom(const StereoCameraCalibration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:doppia_protobuf.StereoCameraCalibration)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool StereoCameraCalibration::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000006) != 0x00000006) return false;
-  
-  if (has_left_camera()) {
-    if (!this->left_camera().IsInitialized()) return false;
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_left_camera()) {
+    if (!_impl_.left_camera_->IsInitialized()) return false;
   }
-  if (has_right_camera()) {
-    if (!this->right_camera().IsInitialized()) return false;
+  if (_internal_has_right_camera()) {
+    if (!_impl_.right_camera_->IsInitialized()) return false;
   }
   return true;
 }
 
-void StereoCameraCalibration::Swap(StereoCameraCalibration* other) {
-  if (other != this) {
-    std::swap(name_, other->name_);
-    std::swap(left_camera_, other->left_camera_);
-    std::swap(right_camera_, other->right_camera_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void StereoCameraCalibration::InternalSwap(StereoCameraCalibration* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StereoCameraCalibration, _impl_.right_camera_)
+      + sizeof(StereoCameraCalibration::_impl_.right_camera_)
+      - PROTOBUF_FIELD_OFFSET(StereoCameraCalibration, _impl_.left_camera_)>(
+          reinterpret_cast<char*>(&_impl_.left_camera_),
+          reinterpret_cast<char*>(&other->_impl_.left_camera_));
 }
 
-::google::protobuf::Metadata StereoCameraCalibration::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = StereoCameraCalibration_descriptor_;
-  metadata.reflection = StereoCameraCalibration_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata StereoCameraCalibration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_calibration_2eproto_getter, &descriptor_table_calibration_2eproto_once,
+      file_level_metadata_calibration_2eproto[7]);
 }
 
-
 // @@protoc_insertion_point(namespace_scope)
-
 }  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::CameraInternalParameters*
+Arena::CreateMaybeMessage< ::doppia_protobuf::CameraInternalParameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::CameraInternalParameters >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::RadialDistortion*
+Arena::CreateMaybeMessage< ::doppia_protobuf::RadialDistortion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::RadialDistortion >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::TangentialDistortion*
+Arena::CreateMaybeMessage< ::doppia_protobuf::TangentialDistortion >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::TangentialDistortion >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::RotationMatrix*
+Arena::CreateMaybeMessage< ::doppia_protobuf::RotationMatrix >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::RotationMatrix >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::TranslationVector*
+Arena::CreateMaybeMessage< ::doppia_protobuf::TranslationVector >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::TranslationVector >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::Pose*
+Arena::CreateMaybeMessage< ::doppia_protobuf::Pose >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::Pose >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::CameraCalibration*
+Arena::CreateMaybeMessage< ::doppia_protobuf::CameraCalibration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::CameraCalibration >(arena);
+}
+template<> PROTOBUF_NOINLINE ::doppia_protobuf::StereoCameraCalibration*
+Arena::CreateMaybeMessage< ::doppia_protobuf::StereoCameraCalibration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::doppia_protobuf::StereoCameraCalibration >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
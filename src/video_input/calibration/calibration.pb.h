@@ -1,1211 +1,2131 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: calibration.proto
 
-#ifndef PROTOBUF_calibration_2eproto__INCLUDED
-#define PROTOBUF_calibration_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_calibration_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_calibration_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2004000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2004001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_calibration_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_calibration_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_calibration_2eproto;
 namespace doppia_protobuf {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_calibration_2eproto();
-void protobuf_AssignDesc_calibration_2eproto();
-void protobuf_ShutdownFile_calibration_2eproto();
-
+class CameraCalibration;
+struct CameraCalibrationDefaultTypeInternal;
+extern CameraCalibrationDefaultTypeInternal _CameraCalibration_default_instance_;
 class CameraInternalParameters;
+struct CameraInternalParametersDefaultTypeInternal;
+extern CameraInternalParametersDefaultTypeInternal _CameraInternalParameters_default_instance_;
+class Pose;
+struct PoseDefaultTypeInternal;
+extern PoseDefaultTypeInternal _Pose_default_instance_;
 class RadialDistortion;
-class TangentialDistortion;
+struct RadialDistortionDefaultTypeInternal;
+extern RadialDistortionDefaultTypeInternal _RadialDistortion_default_instance_;
 class RotationMatrix;
-class TranslationVector;
-class Pose;
-class CameraCalibration;
+struct RotationMatrixDefaultTypeInternal;
+extern RotationMatrixDefaultTypeInternal _RotationMatrix_default_instance_;
 class StereoCameraCalibration;
+struct StereoCameraCalibrationDefaultTypeInternal;
+extern StereoCameraCalibrationDefaultTypeInternal _StereoCameraCalibration_default_instance_;
+class TangentialDistortion;
+struct TangentialDistortionDefaultTypeInternal;
+extern TangentialDistortionDefaultTypeInternal _TangentialDistortion_default_instance_;
+class TranslationVector;
+struct TranslationVectorDefaultTypeInternal;
+extern TranslationVectorDefaultTypeInternal _TranslationVector_default_instance_;
+}  // namespace doppia_protobuf
+PROTOBUF_NAMESPACE_OPEN
+template<> ::doppia_protobuf::CameraCalibration* Arena::CreateMaybeMessage<::doppia_protobuf::CameraCalibration>(Arena*);
+template<> ::doppia_protobuf::CameraInternalParameters* Arena::CreateMaybeMessage<::doppia_protobuf::CameraInternalParameters>(Arena*);
+template<> ::doppia_protobuf::Pose* Arena::CreateMaybeMessage<::doppia_protobuf::Pose>(Arena*);
+template<> ::doppia_protobuf::RadialDistortion* Arena::CreateMaybeMessage<::doppia_protobuf::RadialDistortion>(Arena*);
+template<> ::doppia_protobuf::RotationMatrix* Arena::CreateMaybeMessage<::doppia_protobuf::RotationMatrix>(Arena*);
+template<> ::doppia_protobuf::StereoCameraCalibration* Arena::CreateMaybeMessage<::doppia_protobuf::StereoCameraCalibration>(Arena*);
+template<> ::doppia_protobuf::TangentialDistortion* Arena::CreateMaybeMessage<::doppia_protobuf::TangentialDistortion>(Arena*);
+template<> ::doppia_protobuf::TranslationVector* Arena::CreateMaybeMessage<::doppia_protobuf::TranslationVector>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace doppia_protobuf {
 
 // ===================================================================
 
-class CameraInternalParameters : public ::google::protobuf::Message {
+class CameraInternalParameters final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.CameraInternalParameters) */ {
  public:
-  CameraInternalParameters();
-  virtual ~CameraInternalParameters();
-  
+  inline CameraInternalParameters() : CameraInternalParameters(nullptr) {}
+  ~CameraInternalParameters() override;
+  explicit PROTOBUF_CONSTEXPR CameraInternalParameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   CameraInternalParameters(const CameraInternalParameters& from);
-  
+  CameraInternalParameters(CameraInternalParameters&& from) noexcept
+    : CameraInternalParameters() {
+    *this = ::std::move(from);
+  }
+
   inline CameraInternalParameters& operator=(const CameraInternalParameters& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CameraInternalParameters& operator=(CameraInternalParameters&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const CameraInternalParameters& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CameraInternalParameters& default_instance();
-  
-  void Swap(CameraInternalParameters* other);
-  
+  static inline const CameraInternalParameters* internal_default_instance() {
+    return reinterpret_cast<const CameraInternalParameters*>(
+               &_CameraInternalParameters_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(CameraInternalParameters& a, CameraInternalParameters& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CameraInternalParameters* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CameraInternalParameters* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  CameraInternalParameters* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  CameraInternalParameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CameraInternalParameters>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CameraInternalParameters& from);
-  void MergeFrom(const CameraInternalParameters& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CameraInternalParameters& from) {
+    CameraInternalParameters::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CameraInternalParameters* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.CameraInternalParameters";
+  }
+  protected:
+  explicit CameraInternalParameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kK11FieldNumber = 1,
+    kK12FieldNumber = 2,
+    kK13FieldNumber = 3,
+    kK21FieldNumber = 4,
+    kK22FieldNumber = 5,
+    kK23FieldNumber = 6,
+    kK31FieldNumber = 7,
+    kK32FieldNumber = 8,
+    kK33FieldNumber = 9,
+  };
   // required float k11 = 1;
-  inline bool has_k11() const;
-  inline void clear_k11();
-  static const int kK11FieldNumber = 1;
-  inline float k11() const;
-  inline void set_k11(float value);
-  
+  bool has_k11() const;
+  private:
+  bool _internal_has_k11() const;
+  public:
+  void clear_k11();
+  float k11() const;
+  void set_k11(float value);
+  private:
+  float _internal_k11() const;
+  void _internal_set_k11(float value);
+  public:
+
   // required float k12 = 2;
-  inline bool has_k12() const;
-  inline void clear_k12();
-  static const int kK12FieldNumber = 2;
-  inline float k12() const;
-  inline void set_k12(float value);
-  
+  bool has_k12() const;
+  private:
+  bool _internal_has_k12() const;
+  public:
+  void clear_k12();
+  float k12() const;
+  void set_k12(float value);
+  private:
+  float _internal_k12() const;
+  void _internal_set_k12(float value);
+  public:
+
   // required float k13 = 3;
-  inline bool has_k13() const;
-  inline void clear_k13();
-  static const int kK13FieldNumber = 3;
-  inline float k13() const;
-  inline void set_k13(float value);
-  
+  bool has_k13() const;
+  private:
+  bool _internal_has_k13() const;
+  public:
+  void clear_k13();
+  float k13() const;
+  void set_k13(float value);
+  private:
+  float _internal_k13() const;
+  void _internal_set_k13(float value);
+  public:
+
   // required float k21 = 4;
-  inline bool has_k21() const;
-  inline void clear_k21();
-  static const int kK21FieldNumber = 4;
-  inline float k21() const;
-  inline void set_k21(float value);
-  
+  bool has_k21() const;
+  private:
+  bool _internal_has_k21() const;
+  public:
+  void clear_k21();
+  float k21() const;
+  void set_k21(float value);
+  private:
+  float _internal_k21() const;
+  void _internal_set_k21(float value);
+  public:
+
   // required float k22 = 5;
-  inline bool has_k22() const;
-  inline void clear_k22();
-  static const int kK22FieldNumber = 5;
-  inline float k22() const;
-  inline void set_k22(float value);
-  
+  bool has_k22() const;
+  private:
+  bool _internal_has_k22() const;
+  public:
+  void clear_k22();
+  float k22() const;
+  void set_k22(float value);
+  private:
+  float _internal_k22() const;
+  void _internal_set_k22(float value);
+  public:
+
   // required float k23 = 6;
-  inline bool has_k23() const;
-  inline void clear_k23();
-  static const int kK23FieldNumber = 6;
-  inline float k23() const;
-  inline void set_k23(float value);
-  
+  bool has_k23() const;
+  private:
+  bool _internal_has_k23() const;
+  public:
+  void clear_k23();
+  float k23() const;
+  void set_k23(float value);
+  private:
+  float _internal_k23() const;
+  void _internal_set_k23(float value);
+  public:
+
   // required float k31 = 7;
-  inline bool has_k31() const;
-  inline void clear_k31();
-  static const int kK31FieldNumber = 7;
-  inline float k31() const;
-  inline void set_k31(float value);
-  
+  bool has_k31() const;
+  private:
+  bool _internal_has_k31() const;
+  public:
+  void clear_k31();
+  float k31() const;
+  void set_k31(float value);
+  private:
+  float _internal_k31() const;
+  void _internal_set_k31(float value);
+  public:
+
   // required float k32 = 8;
-  inline bool has_k32() const;
-  inline void clear_k32();
-  static const int kK32FieldNumber = 8;
-  inline float k32() const;
-  inline void set_k32(float value);
-  
+  bool has_k32() const;
+  private:
+  bool _internal_has_k32() const;
+  public:
+  void clear_k32();
+  float k32() const;
+  void set_k32(float value);
+  private:
+  float _internal_k32() const;
+  void _internal_set_k32(float value);
+  public:
+
   // required float k33 = 9;
-  inline bool has_k33() const;
-  inline void clear_k33();
-  static const int kK33FieldNumber = 9;
-  inline float k33() const;
-  inline void set_k33(float value);
-  
+  bool has_k33() const;
+  private:
+  bool _internal_has_k33() const;
+  public:
+  void clear_k33();
+  float k33() const;
+  void set_k33(float value);
+  private:
+  float _internal_k33() const;
+  void _internal_set_k33(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.CameraInternalParameters)
  private:
-  inline void set_has_k11();
-  inline void clear_has_k11();
-  inline void set_has_k12();
-  inline void clear_has_k12();
-  inline void set_has_k13();
-  inline void clear_has_k13();
-  inline void set_has_k21();
-  inline void clear_has_k21();
-  inline void set_has_k22();
-  inline void clear_has_k22();
-  inline void set_has_k23();
-  inline void clear_has_k23();
-  inline void set_has_k31();
-  inline void clear_has_k31();
-  inline void set_has_k32();
-  inline void clear_has_k32();
-  inline void set_has_k33();
-  inline void clear_has_k33();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float k11_;
-  float k12_;
-  float k13_;
-  float k21_;
-  float k22_;
-  float k23_;
-  float k31_;
-  float k32_;
-  float k33_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static CameraInternalParameters* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float k11_;
+    float k12_;
+    float k13_;
+    float k21_;
+    float k22_;
+    float k23_;
+    float k31_;
+    float k32_;
+    float k33_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RadialDistortion : public ::google::protobuf::Message {
+class RadialDistortion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.RadialDistortion) */ {
  public:
-  RadialDistortion();
-  virtual ~RadialDistortion();
-  
+  inline RadialDistortion() : RadialDistortion(nullptr) {}
+  ~RadialDistortion() override;
+  explicit PROTOBUF_CONSTEXPR RadialDistortion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   RadialDistortion(const RadialDistortion& from);
-  
+  RadialDistortion(RadialDistortion&& from) noexcept
+    : RadialDistortion() {
+    *this = ::std::move(from);
+  }
+
   inline RadialDistortion& operator=(const RadialDistortion& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline RadialDistortion& operator=(RadialDistortion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RadialDistortion& default_instance();
-  
-  void Swap(RadialDistortion* other);
-  
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RadialDistortion& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RadialDistortion* internal_default_instance() {
+    return reinterpret_cast<const RadialDistortion*>(
+               &_RadialDistortion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RadialDistortion& a, RadialDistortion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RadialDistortion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RadialDistortion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  RadialDistortion* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  RadialDistortion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RadialDistortion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RadialDistortion& from);
-  void MergeFrom(const RadialDistortion& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RadialDistortion& from) {
+    RadialDistortion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RadialDistortion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.RadialDistortion";
+  }
+  protected:
+  explicit RadialDistortion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kK1FieldNumber = 1,
+    kK2FieldNumber = 2,
+    kK3FieldNumber = 3,
+  };
   // required float k1 = 1;
-  inline bool has_k1() const;
-  inline void clear_k1();
-  static const int kK1FieldNumber = 1;
-  inline float k1() const;
-  inline void set_k1(float value);
-  
+  bool has_k1() const;
+  private:
+  bool _internal_has_k1() const;
+  public:
+  void clear_k1();
+  float k1() const;
+  void set_k1(float value);
+  private:
+  float _internal_k1() const;
+  void _internal_set_k1(float value);
+  public:
+
   // optional float k2 = 2;
-  inline bool has_k2() const;
-  inline void clear_k2();
-  static const int kK2FieldNumber = 2;
-  inline float k2() const;
-  inline void set_k2(float value);
-  
+  bool has_k2() const;
+  private:
+  bool _internal_has_k2() const;
+  public:
+  void clear_k2();
+  float k2() const;
+  void set_k2(float value);
+  private:
+  float _internal_k2() const;
+  void _internal_set_k2(float value);
+  public:
+
   // optional float k3 = 3;
-  inline bool has_k3() const;
-  inline void clear_k3();
-  static const int kK3FieldNumber = 3;
-  inline float k3() const;
-  inline void set_k3(float value);
-  
+  bool has_k3() const;
+  private:
+  bool _internal_has_k3() const;
+  public:
+  void clear_k3();
+  float k3() const;
+  void set_k3(float value);
+  private:
+  float _internal_k3() const;
+  void _internal_set_k3(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.RadialDistortion)
  private:
-  inline void set_has_k1();
-  inline void clear_has_k1();
-  inline void set_has_k2();
-  inline void clear_has_k2();
-  inline void set_has_k3();
-  inline void clear_has_k3();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float k1_;
-  float k2_;
-  float k3_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static RadialDistortion* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float k1_;
+    float k2_;
+    float k3_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TangentialDistortion : public ::google::protobuf::Message {
+class TangentialDistortion final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.TangentialDistortion) */ {
  public:
-  TangentialDistortion();
-  virtual ~TangentialDistortion();
-  
+  inline TangentialDistortion() : TangentialDistortion(nullptr) {}
+  ~TangentialDistortion() override;
+  explicit PROTOBUF_CONSTEXPR TangentialDistortion(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   TangentialDistortion(const TangentialDistortion& from);
-  
+  TangentialDistortion(TangentialDistortion&& from) noexcept
+    : TangentialDistortion() {
+    *this = ::std::move(from);
+  }
+
   inline TangentialDistortion& operator=(const TangentialDistortion& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TangentialDistortion& operator=(TangentialDistortion&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const TangentialDistortion& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TangentialDistortion& default_instance();
-  
-  void Swap(TangentialDistortion* other);
-  
+  static inline const TangentialDistortion* internal_default_instance() {
+    return reinterpret_cast<const TangentialDistortion*>(
+               &_TangentialDistortion_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TangentialDistortion& a, TangentialDistortion& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TangentialDistortion* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TangentialDistortion* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  TangentialDistortion* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  TangentialDistortion* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TangentialDistortion>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TangentialDistortion& from);
-  void MergeFrom(const TangentialDistortion& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TangentialDistortion& from) {
+    TangentialDistortion::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TangentialDistortion* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.TangentialDistortion";
+  }
+  protected:
+  explicit TangentialDistortion(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kK1FieldNumber = 1,
+    kK2FieldNumber = 2,
+    kK3FieldNumber = 3,
+  };
   // required float k1 = 1;
-  inline bool has_k1() const;
-  inline void clear_k1();
-  static const int kK1FieldNumber = 1;
-  inline float k1() const;
-  inline void set_k1(float value);
-  
+  bool has_k1() const;
+  private:
+  bool _internal_has_k1() const;
+  public:
+  void clear_k1();
+  float k1() const;
+  void set_k1(float value);
+  private:
+  float _internal_k1() const;
+  void _internal_set_k1(float value);
+  public:
+
   // required float k2 = 2;
-  inline bool has_k2() const;
-  inline void clear_k2();
-  static const int kK2FieldNumber = 2;
-  inline float k2() const;
-  inline void set_k2(float value);
-  
+  bool has_k2() const;
+  private:
+  bool _internal_has_k2() const;
+  public:
+  void clear_k2();
+  float k2() const;
+  void set_k2(float value);
+  private:
+  float _internal_k2() const;
+  void _internal_set_k2(float value);
+  public:
+
   // optional float k3 = 3;
-  inline bool has_k3() const;
-  inline void clear_k3();
-  static const int kK3FieldNumber = 3;
-  inline float k3() const;
-  inline void set_k3(float value);
-  
+  bool has_k3() const;
+  private:
+  bool _internal_has_k3() const;
+  public:
+  void clear_k3();
+  float k3() const;
+  void set_k3(float value);
+  private:
+  float _internal_k3() const;
+  void _internal_set_k3(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.TangentialDistortion)
  private:
-  inline void set_has_k1();
-  inline void clear_has_k1();
-  inline void set_has_k2();
-  inline void clear_has_k2();
-  inline void set_has_k3();
-  inline void clear_has_k3();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float k1_;
-  float k2_;
-  float k3_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static TangentialDistortion* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float k1_;
+    float k2_;
+    float k3_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RotationMatrix : public ::google::protobuf::Message {
+class RotationMatrix final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.RotationMatrix) */ {
  public:
-  RotationMatrix();
-  virtual ~RotationMatrix();
-  
+  inline RotationMatrix() : RotationMatrix(nullptr) {}
+  ~RotationMatrix() override;
+  explicit PROTOBUF_CONSTEXPR RotationMatrix(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   RotationMatrix(const RotationMatrix& from);
-  
+  RotationMatrix(RotationMatrix&& from) noexcept
+    : RotationMatrix() {
+    *this = ::std::move(from);
+  }
+
   inline RotationMatrix& operator=(const RotationMatrix& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline RotationMatrix& operator=(RotationMatrix&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RotationMatrix& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RotationMatrix* internal_default_instance() {
+    return reinterpret_cast<const RotationMatrix*>(
+               &_RotationMatrix_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(RotationMatrix& a, RotationMatrix& b) {
+    a.Swap(&b);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RotationMatrix& default_instance();
-  
-  void Swap(RotationMatrix* other);
-  
+  inline void Swap(RotationMatrix* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RotationMatrix* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  RotationMatrix* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  RotationMatrix* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RotationMatrix>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RotationMatrix& from);
-  void MergeFrom(const RotationMatrix& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RotationMatrix& from) {
+    RotationMatrix::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RotationMatrix* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.RotationMatrix";
+  }
+  protected:
+  explicit RotationMatrix(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kR11FieldNumber = 1,
+    kR12FieldNumber = 2,
+    kR13FieldNumber = 3,
+    kR21FieldNumber = 4,
+    kR22FieldNumber = 5,
+    kR23FieldNumber = 6,
+    kR31FieldNumber = 7,
+    kR32FieldNumber = 8,
+    kR33FieldNumber = 9,
+  };
   // required float r11 = 1;
-  inline bool has_r11() const;
-  inline void clear_r11();
-  static const int kR11FieldNumber = 1;
-  inline float r11() const;
-  inline void set_r11(float value);
-  
+  bool has_r11() const;
+  private:
+  bool _internal_has_r11() const;
+  public:
+  void clear_r11();
+  float r11() const;
+  void set_r11(float value);
+  private:
+  float _internal_r11() const;
+  void _internal_set_r11(float value);
+  public:
+
   // required float r12 = 2;
-  inline bool has_r12() const;
-  inline void clear_r12();
-  static const int kR12FieldNumber = 2;
-  inline float r12() const;
-  inline void set_r12(float value);
-  
+  bool has_r12() const;
+  private:
+  bool _internal_has_r12() const;
+  public:
+  void clear_r12();
+  float r12() const;
+  void set_r12(float value);
+  private:
+  float _internal_r12() const;
+  void _internal_set_r12(float value);
+  public:
+
   // required float r13 = 3;
-  inline bool has_r13() const;
-  inline void clear_r13();
-  static const int kR13FieldNumber = 3;
-  inline float r13() const;
-  inline void set_r13(float value);
-  
+  bool has_r13() const;
+  private:
+  bool _internal_has_r13() const;
+  public:
+  void clear_r13();
+  float r13() const;
+  void set_r13(float value);
+  private:
+  float _internal_r13() const;
+  void _internal_set_r13(float value);
+  public:
+
   // required float r21 = 4;
-  inline bool has_r21() const;
-  inline void clear_r21();
-  static const int kR21FieldNumber = 4;
-  inline float r21() const;
-  inline void set_r21(float value);
-  
+  bool has_r21() const;
+  private:
+  bool _internal_has_r21() const;
+  public:
+  void clear_r21();
+  float r21() const;
+  void set_r21(float value);
+  private:
+  float _internal_r21() const;
+  void _internal_set_r21(float value);
+  public:
+
   // required float r22 = 5;
-  inline bool has_r22() const;
-  inline void clear_r22();
-  static const int kR22FieldNumber = 5;
-  inline float r22() const;
-  inline void set_r22(float value);
-  
+  bool has_r22() const;
+  private:
+  bool _internal_has_r22() const;
+  public:
+  void clear_r22();
+  float r22() const;
+  void set_r22(float value);
+  private:
+  float _internal_r22() const;
+  void _internal_set_r22(float value);
+  public:
+
   // required float r23 = 6;
-  inline bool has_r23() const;
-  inline void clear_r23();
-  static const int kR23FieldNumber = 6;
-  inline float r23() const;
-  inline void set_r23(float value);
-  
+  bool has_r23() const;
+  private:
+  bool _internal_has_r23() const;
+  public:
+  void clear_r23();
+  float r23() const;
+  void set_r23(float value);
+  private:
+  float _internal_r23() const;
+  void _internal_set_r23(float value);
+  public:
+
   // required float r31 = 7;
-  inline bool has_r31() const;
-  inline void clear_r31();
-  static const int kR31FieldNumber = 7;
-  inline float r31() const;
-  inline void set_r31(float value);
-  
+  bool has_r31() const;
+  private:
+  bool _internal_has_r31() const;
+  public:
+  void clear_r31();
+  float r31() const;
+  void set_r31(float value);
+  private:
+  float _internal_r31() const;
+  void _internal_set_r31(float value);
+  public:
+
   // required float r32 = 8;
-  inline bool has_r32() const;
-  inline void clear_r32();
-  static const int kR32FieldNumber = 8;
-  inline float r32() const;
-  inline void set_r32(float value);
-  
+  bool has_r32() const;
+  private:
+  bool _internal_has_r32() const;
+  public:
+  void clear_r32();
+  float r32() const;
+  void set_r32(float value);
+  private:
+  float _internal_r32() const;
+  void _internal_set_r32(float value);
+  public:
+
   // required float r33 = 9;
-  inline bool has_r33() const;
-  inline void clear_r33();
-  static const int kR33FieldNumber = 9;
-  inline float r33() const;
-  inline void set_r33(float value);
-  
+  bool has_r33() const;
+  private:
+  bool _internal_has_r33() const;
+  public:
+  void clear_r33();
+  float r33() const;
+  void set_r33(float value);
+  private:
+  float _internal_r33() const;
+  void _internal_set_r33(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.RotationMatrix)
  private:
-  inline void set_has_r11();
-  inline void clear_has_r11();
-  inline void set_has_r12();
-  inline void clear_has_r12();
-  inline void set_has_r13();
-  inline void clear_has_r13();
-  inline void set_has_r21();
-  inline void clear_has_r21();
-  inline void set_has_r22();
-  inline void clear_has_r22();
-  inline void set_has_r23();
-  inline void clear_has_r23();
-  inline void set_has_r31();
-  inline void clear_has_r31();
-  inline void set_has_r32();
-  inline void clear_has_r32();
-  inline void set_has_r33();
-  inline void clear_has_r33();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float r11_;
-  float r12_;
-  float r13_;
-  float r21_;
-  float r22_;
-  float r23_;
-  float r31_;
-  float r32_;
-  float r33_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(9 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static RotationMatrix* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float r11_;
+    float r12_;
+    float r13_;
+    float r21_;
+    float r22_;
+    float r23_;
+    float r31_;
+    float r32_;
+    float r33_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class TranslationVector : public ::google::protobuf::Message {
+class TranslationVector final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.TranslationVector) */ {
  public:
-  TranslationVector();
-  virtual ~TranslationVector();
-  
+  inline TranslationVector() : TranslationVector(nullptr) {}
+  ~TranslationVector() override;
+  explicit PROTOBUF_CONSTEXPR TranslationVector(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   TranslationVector(const TranslationVector& from);
-  
+  TranslationVector(TranslationVector&& from) noexcept
+    : TranslationVector() {
+    *this = ::std::move(from);
+  }
+
   inline TranslationVector& operator=(const TranslationVector& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline TranslationVector& operator=(TranslationVector&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const TranslationVector& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const TranslationVector& default_instance();
-  
-  void Swap(TranslationVector* other);
-  
+  static inline const TranslationVector* internal_default_instance() {
+    return reinterpret_cast<const TranslationVector*>(
+               &_TranslationVector_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TranslationVector& a, TranslationVector& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TranslationVector* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TranslationVector* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  TranslationVector* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  TranslationVector* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TranslationVector>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const TranslationVector& from);
-  void MergeFrom(const TranslationVector& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TranslationVector& from) {
+    TranslationVector::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TranslationVector* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.TranslationVector";
+  }
+  protected:
+  explicit TranslationVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kT1FieldNumber = 1,
+    kT2FieldNumber = 2,
+    kT3FieldNumber = 3,
+  };
   // required float t1 = 1;
-  inline bool has_t1() const;
-  inline void clear_t1();
-  static const int kT1FieldNumber = 1;
-  inline float t1() const;
-  inline void set_t1(float value);
-  
+  bool has_t1() const;
+  private:
+  bool _internal_has_t1() const;
+  public:
+  void clear_t1();
+  float t1() const;
+  void set_t1(float value);
+  private:
+  float _internal_t1() const;
+  void _internal_set_t1(float value);
+  public:
+
   // required float t2 = 2;
-  inline bool has_t2() const;
-  inline void clear_t2();
-  static const int kT2FieldNumber = 2;
-  inline float t2() const;
-  inline void set_t2(float value);
-  
+  bool has_t2() const;
+  private:
+  bool _internal_has_t2() const;
+  public:
+  void clear_t2();
+  float t2() const;
+  void set_t2(float value);
+  private:
+  float _internal_t2() const;
+  void _internal_set_t2(float value);
+  public:
+
   // required float t3 = 3;
-  inline bool has_t3() const;
-  inline void clear_t3();
-  static const int kT3FieldNumber = 3;
-  inline float t3() const;
-  inline void set_t3(float value);
-  
+  bool has_t3() const;
+  private:
+  bool _internal_has_t3() const;
+  public:
+  void clear_t3();
+  float t3() const;
+  void set_t3(float value);
+  private:
+  float _internal_t3() const;
+  void _internal_set_t3(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.TranslationVector)
  private:
-  inline void set_has_t1();
-  inline void clear_has_t1();
-  inline void set_has_t2();
-  inline void clear_has_t2();
-  inline void set_has_t3();
-  inline void clear_has_t3();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  float t1_;
-  float t2_;
-  float t3_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static TranslationVector* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    float t1_;
+    float t2_;
+    float t3_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Pose : public ::google::protobuf::Message {
+class Pose final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.Pose) */ {
  public:
-  Pose();
-  virtual ~Pose();
-  
+  inline Pose() : Pose(nullptr) {}
+  ~Pose() override;
+  explicit PROTOBUF_CONSTEXPR Pose(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   Pose(const Pose& from);
-  
+  Pose(Pose&& from) noexcept
+    : Pose() {
+    *this = ::std::move(from);
+  }
+
   inline Pose& operator=(const Pose& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Pose& operator=(Pose&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  static const Pose& default_instance() {
+    return *internal_default_instance();
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Pose& default_instance();
-  
-  void Swap(Pose* other);
-  
+  static inline const Pose* internal_default_instance() {
+    return reinterpret_cast<const Pose*>(
+               &_Pose_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Pose& a, Pose& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Pose* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Pose* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
   // implements Message ----------------------------------------------
-  
-  Pose* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  Pose* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Pose>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Pose& from);
-  void MergeFrom(const Pose& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Pose& from) {
+    Pose::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Pose* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.Pose";
+  }
+  protected:
+  explicit Pose(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kRotationFieldNumber = 1,
+    kTranslationFieldNumber = 2,
+  };
   // required .doppia_protobuf.RotationMatrix rotation = 1;
-  inline bool has_rotation() const;
-  inline void clear_rotation();
-  static const int kRotationFieldNumber = 1;
-  inline const ::doppia_protobuf::RotationMatrix& rotation() const;
-  inline ::doppia_protobuf::RotationMatrix* mutable_rotation();
-  inline ::doppia_protobuf::RotationMatrix* release_rotation();
-  
+  bool has_rotation() const;
+  private:
+  bool _internal_has_rotation() const;
+  public:
+  void clear_rotation();
+  const ::doppia_protobuf::RotationMatrix& rotation() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::RotationMatrix* release_rotation();
+  ::doppia_protobuf::RotationMatrix* mutable_rotation();
+  void set_allocated_rotation(::doppia_protobuf::RotationMatrix* rotation);
+  private:
+  const ::doppia_protobuf::RotationMatrix& _internal_rotation() const;
+  ::doppia_protobuf::RotationMatrix* _internal_mutable_rotation();
+  public:
+  void unsafe_arena_set_allocated_rotation(
+      ::doppia_protobuf::RotationMatrix* rotation);
+  ::doppia_protobuf::RotationMatrix* unsafe_arena_release_rotation();
+
   // required .doppia_protobuf.TranslationVector translation = 2;
-  inline bool has_translation() const;
-  inline void clear_translation();
-  static const int kTranslationFieldNumber = 2;
-  inline const ::doppia_protobuf::TranslationVector& translation() const;
-  inline ::doppia_protobuf::TranslationVector* mutable_translation();
-  inline ::doppia_protobuf::TranslationVector* release_translation();
-  
+  bool has_translation() const;
+  private:
+  bool _internal_has_translation() const;
+  public:
+  void clear_translation();
+  const ::doppia_protobuf::TranslationVector& translation() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::TranslationVector* release_translation();
+  ::doppia_protobuf::TranslationVector* mutable_translation();
+  void set_allocated_translation(::doppia_protobuf::TranslationVector* translation);
+  private:
+  const ::doppia_protobuf::TranslationVector& _internal_translation() const;
+  ::doppia_protobuf::TranslationVector* _internal_mutable_translation();
+  public:
+  void unsafe_arena_set_allocated_translation(
+      ::doppia_protobuf::TranslationVector* translation);
+  ::doppia_protobuf::TranslationVector* unsafe_arena_release_translation();
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.Pose)
  private:
-  inline void set_has_rotation();
-  inline void clear_has_rotation();
-  inline void set_has_translation();
-  inline void clear_has_translation();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::doppia_protobuf::RotationMatrix* rotation_;
-  ::doppia_protobuf::TranslationVector* translation_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static Pose* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::doppia_protobuf::RotationMatrix* rotation_;
+    ::doppia_protobuf::TranslationVector* translation_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class CameraCalibration : public ::google::protobuf::Message {
+class CameraCalibration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.CameraCalibration) */ {
  public:
-  CameraCalibration();
-  virtual ~CameraCalibration();
-  
+  inline CameraCalibration() : CameraCalibration(nullptr) {}
+  ~CameraCalibration() override;
+  explicit PROTOBUF_CONSTEXPR CameraCalibration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   CameraCalibration(const CameraCalibration& from);
-  
+  CameraCalibration(CameraCalibration&& from) noexcept
+    : CameraCalibration() {
+    *this = ::std::move(from);
+  }
+
   inline CameraCalibration& operator=(const CameraCalibration& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline CameraCalibration& operator=(CameraCalibration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CameraCalibration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CameraCalibration* internal_default_instance() {
+    return reinterpret_cast<const CameraCalibration*>(
+               &_CameraCalibration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(CameraCalibration& a, CameraCalibration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CameraCalibration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  void UnsafeArenaSwap(CameraCalibration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const CameraCalibration& default_instance();
-  
-  void Swap(CameraCalibration* other);
-  
+
   // implements Message ----------------------------------------------
-  
-  CameraCalibration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  CameraCalibration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CameraCalibration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const CameraCalibration& from);
-  void MergeFrom(const CameraCalibration& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CameraCalibration& from) {
+    CameraCalibration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CameraCalibration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.CameraCalibration";
+  }
+  protected:
+  explicit CameraCalibration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kInternalParametersFieldNumber = 2,
+    kRadialDistortionFieldNumber = 3,
+    kTangentialDistortionFieldNumber = 4,
+    kPoseFieldNumber = 5,
+  };
   // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
   // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-  inline bool has_internal_parameters() const;
-  inline void clear_internal_parameters();
-  static const int kInternalParametersFieldNumber = 2;
-  inline const ::doppia_protobuf::CameraInternalParameters& internal_parameters() const;
-  inline ::doppia_protobuf::CameraInternalParameters* mutable_internal_parameters();
-  inline ::doppia_protobuf::CameraInternalParameters* release_internal_parameters();
-  
+  bool has_internal_parameters() const;
+  private:
+  bool _internal_has_internal_parameters() const;
+  public:
+  void clear_internal_parameters();
+  const ::doppia_protobuf::CameraInternalParameters& internal_parameters() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::CameraInternalParameters* release_internal_parameters();
+  ::doppia_protobuf::CameraInternalParameters* mutable_internal_parameters();
+  void set_allocated_internal_parameters(::doppia_protobuf::CameraInternalParameters* internal_parameters);
+  private:
+  const ::doppia_protobuf::CameraInternalParameters& _internal_internal_parameters() const;
+  ::doppia_protobuf::CameraInternalParameters* _internal_mutable_internal_parameters();
+  public:
+  void unsafe_arena_set_allocated_internal_parameters(
+      ::doppia_protobuf::CameraInternalParameters* internal_parameters);
+  ::doppia_protobuf::CameraInternalParameters* unsafe_arena_release_internal_parameters();
+
   // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-  inline bool has_radial_distortion() const;
-  inline void clear_radial_distortion();
-  static const int kRadialDistortionFieldNumber = 3;
-  inline const ::doppia_protobuf::RadialDistortion& radial_distortion() const;
-  inline ::doppia_protobuf::RadialDistortion* mutable_radial_distortion();
-  inline ::doppia_protobuf::RadialDistortion* release_radial_distortion();
-  
+  bool has_radial_distortion() const;
+  private:
+  bool _internal_has_radial_distortion() const;
+  public:
+  void clear_radial_distortion();
+  const ::doppia_protobuf::RadialDistortion& radial_distortion() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::RadialDistortion* release_radial_distortion();
+  ::doppia_protobuf::RadialDistortion* mutable_radial_distortion();
+  void set_allocated_radial_distortion(::doppia_protobuf::RadialDistortion* radial_distortion);
+  private:
+  const ::doppia_protobuf::RadialDistortion& _internal_radial_distortion() const;
+  ::doppia_protobuf::RadialDistortion* _internal_mutable_radial_distortion();
+  public:
+  void unsafe_arena_set_allocated_radial_distortion(
+      ::doppia_protobuf::RadialDistortion* radial_distortion);
+  ::doppia_protobuf::RadialDistortion* unsafe_arena_release_radial_distortion();
+
   // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-  inline bool has_tangential_distortion() const;
-  inline void clear_tangential_distortion();
-  static const int kTangentialDistortionFieldNumber = 4;
-  inline const ::doppia_protobuf::TangentialDistortion& tangential_distortion() const;
-  inline ::doppia_protobuf::TangentialDistortion* mutable_tangential_distortion();
-  inline ::doppia_protobuf::TangentialDistortion* release_tangential_distortion();
-  
+  bool has_tangential_distortion() const;
+  private:
+  bool _internal_has_tangential_distortion() const;
+  public:
+  void clear_tangential_distortion();
+  const ::doppia_protobuf::TangentialDistortion& tangential_distortion() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::TangentialDistortion* release_tangential_distortion();
+  ::doppia_protobuf::TangentialDistortion* mutable_tangential_distortion();
+  void set_allocated_tangential_distortion(::doppia_protobuf::TangentialDistortion* tangential_distortion);
+  private:
+  const ::doppia_protobuf::TangentialDistortion& _internal_tangential_distortion() const;
+  ::doppia_protobuf::TangentialDistortion* _internal_mutable_tangential_distortion();
+  public:
+  void unsafe_arena_set_allocated_tangential_distortion(
+      ::doppia_protobuf::TangentialDistortion* tangential_distortion);
+  ::doppia_protobuf::TangentialDistortion* unsafe_arena_release_tangential_distortion();
+
   // optional .doppia_protobuf.Pose pose = 5;
-  inline bool has_pose() const;
-  inline void clear_pose();
-  static const int kPoseFieldNumber = 5;
-  inline const ::doppia_protobuf::Pose& pose() const;
-  inline ::doppia_protobuf::Pose* mutable_pose();
-  inline ::doppia_protobuf::Pose* release_pose();
-  
+  bool has_pose() const;
+  private:
+  bool _internal_has_pose() const;
+  public:
+  void clear_pose();
+  const ::doppia_protobuf::Pose& pose() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::Pose* release_pose();
+  ::doppia_protobuf::Pose* mutable_pose();
+  void set_allocated_pose(::doppia_protobuf::Pose* pose);
+  private:
+  const ::doppia_protobuf::Pose& _internal_pose() const;
+  ::doppia_protobuf::Pose* _internal_mutable_pose();
+  public:
+  void unsafe_arena_set_allocated_pose(
+      ::doppia_protobuf::Pose* pose);
+  ::doppia_protobuf::Pose* unsafe_arena_release_pose();
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.CameraCalibration)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_internal_parameters();
-  inline void clear_has_internal_parameters();
-  inline void set_has_radial_distortion();
-  inline void clear_has_radial_distortion();
-  inline void set_has_tangential_distortion();
-  inline void clear_has_tangential_distortion();
-  inline void set_has_pose();
-  inline void clear_has_pose();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* name_;
-  ::doppia_protobuf::CameraInternalParameters* internal_parameters_;
-  ::doppia_protobuf::RadialDistortion* radial_distortion_;
-  ::doppia_protobuf::TangentialDistortion* tangential_distortion_;
-  ::doppia_protobuf::Pose* pose_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static CameraCalibration* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::doppia_protobuf::CameraInternalParameters* internal_parameters_;
+    ::doppia_protobuf::RadialDistortion* radial_distortion_;
+    ::doppia_protobuf::TangentialDistortion* tangential_distortion_;
+    ::doppia_protobuf::Pose* pose_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StereoCameraCalibration : public ::google::protobuf::Message {
+class StereoCameraCalibration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:doppia_protobuf.StereoCameraCalibration) */ {
  public:
-  StereoCameraCalibration();
-  virtual ~StereoCameraCalibration();
-  
+  inline StereoCameraCalibration() : StereoCameraCalibration(nullptr) {}
+  ~StereoCameraCalibration() override;
+  explicit PROTOBUF_CONSTEXPR StereoCameraCalibration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
   StereoCameraCalibration(const StereoCameraCalibration& from);
-  
+  StereoCameraCalibration(StereoCameraCalibration&& from) noexcept
+    : StereoCameraCalibration() {
+    *this = ::std::move(from);
+  }
+
   inline StereoCameraCalibration& operator=(const StereoCameraCalibration& from) {
     CopyFrom(from);
     return *this;
   }
-  
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline StereoCameraCalibration& operator=(StereoCameraCalibration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StereoCameraCalibration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StereoCameraCalibration* internal_default_instance() {
+    return reinterpret_cast<const StereoCameraCalibration*>(
+               &_StereoCameraCalibration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(StereoCameraCalibration& a, StereoCameraCalibration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StereoCameraCalibration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  void UnsafeArenaSwap(StereoCameraCalibration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const StereoCameraCalibration& default_instance();
-  
-  void Swap(StereoCameraCalibration* other);
-  
+
   // implements Message ----------------------------------------------
-  
-  StereoCameraCalibration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+
+  StereoCameraCalibration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StereoCameraCalibration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const StereoCameraCalibration& from);
-  void MergeFrom(const StereoCameraCalibration& from);
-  void Clear();
-  bool IsInitialized() const;
-  
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StereoCameraCalibration& from) {
+    StereoCameraCalibration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StereoCameraCalibration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "doppia_protobuf.StereoCameraCalibration";
+  }
+  protected:
+  explicit StereoCameraCalibration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
-  
-  ::google::protobuf::Metadata GetMetadata() const;
-  
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
   // nested types ----------------------------------------------------
-  
+
   // accessors -------------------------------------------------------
-  
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kLeftCameraFieldNumber = 2,
+    kRightCameraFieldNumber = 3,
+  };
   // optional string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
   // required .doppia_protobuf.CameraCalibration left_camera = 2;
-  inline bool has_left_camera() const;
-  inline void clear_left_camera();
-  static const int kLeftCameraFieldNumber = 2;
-  inline const ::doppia_protobuf::CameraCalibration& left_camera() const;
-  inline ::doppia_protobuf::CameraCalibration* mutable_left_camera();
-  inline ::doppia_protobuf::CameraCalibration* release_left_camera();
-  
+  bool has_left_camera() const;
+  private:
+  bool _internal_has_left_camera() const;
+  public:
+  void clear_left_camera();
+  const ::doppia_protobuf::CameraCalibration& left_camera() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::CameraCalibration* release_left_camera();
+  ::doppia_protobuf::CameraCalibration* mutable_left_camera();
+  void set_allocated_left_camera(::doppia_protobuf::CameraCalibration* left_camera);
+  private:
+  const ::doppia_protobuf::CameraCalibration& _internal_left_camera() const;
+  ::doppia_protobuf::CameraCalibration* _internal_mutable_left_camera();
+  public:
+  void unsafe_arena_set_allocated_left_camera(
+      ::doppia_protobuf::CameraCalibration* left_camera);
+  ::doppia_protobuf::CameraCalibration* unsafe_arena_release_left_camera();
+
   // required .doppia_protobuf.CameraCalibration right_camera = 3;
-  inline bool has_right_camera() const;
-  inline void clear_right_camera();
-  static const int kRightCameraFieldNumber = 3;
-  inline const ::doppia_protobuf::CameraCalibration& right_camera() const;
-  inline ::doppia_protobuf::CameraCalibration* mutable_right_camera();
-  inline ::doppia_protobuf::CameraCalibration* release_right_camera();
-  
+  bool has_right_camera() const;
+  private:
+  bool _internal_has_right_camera() const;
+  public:
+  void clear_right_camera();
+  const ::doppia_protobuf::CameraCalibration& right_camera() const;
+  PROTOBUF_NODISCARD ::doppia_protobuf::CameraCalibration* release_right_camera();
+  ::doppia_protobuf::CameraCalibration* mutable_right_camera();
+  void set_allocated_right_camera(::doppia_protobuf::CameraCalibration* right_camera);
+  private:
+  const ::doppia_protobuf::CameraCalibration& _internal_right_camera() const;
+  ::doppia_protobuf::CameraCalibration* _internal_mutable_right_camera();
+  public:
+  void unsafe_arena_set_allocated_right_camera(
+      ::doppia_protobuf::CameraCalibration* right_camera);
+  ::doppia_protobuf::CameraCalibration* unsafe_arena_release_right_camera();
+
   // @@protoc_insertion_point(class_scope:doppia_protobuf.StereoCameraCalibration)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_left_camera();
-  inline void clear_has_left_camera();
-  inline void set_has_right_camera();
-  inline void clear_has_right_camera();
-  
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-  
-  ::std::string* name_;
-  ::doppia_protobuf::CameraCalibration* left_camera_;
-  ::doppia_protobuf::CameraCalibration* right_camera_;
-  
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-  
-  friend void  protobuf_AddDesc_calibration_2eproto();
-  friend void protobuf_AssignDesc_calibration_2eproto();
-  friend void protobuf_ShutdownFile_calibration_2eproto();
-  
-  void InitAsDefaultInstance();
-  static StereoCameraCalibration* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::doppia_protobuf::CameraCalibration* left_camera_;
+    ::doppia_protobuf::CameraCalibration* right_camera_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_calibration_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // CameraInternalParameters
 
 // required float k11 = 1;
-inline bool CameraInternalParameters::has_k11() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void CameraInternalParameters::set_has_k11() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool CameraInternalParameters::_internal_has_k11() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::clear_has_k11() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CameraInternalParameters::has_k11() const {
+  return _internal_has_k11();
 }
 inline void CameraInternalParameters::clear_k11() {
-  k11_ = 0;
-  clear_has_k11();
+  _impl_.k11_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float CameraInternalParameters::_internal_k11() const {
+  return _impl_.k11_;
 }
 inline float CameraInternalParameters::k11() const {
-  return k11_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k11)
+  return _internal_k11();
+}
+inline void CameraInternalParameters::_internal_set_k11(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.k11_ = value;
 }
 inline void CameraInternalParameters::set_k11(float value) {
-  set_has_k11();
-  k11_ = value;
+  _internal_set_k11(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k11)
 }
 
 // required float k12 = 2;
-inline bool CameraInternalParameters::has_k12() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool CameraInternalParameters::_internal_has_k12() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::set_has_k12() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CameraInternalParameters::clear_has_k12() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CameraInternalParameters::has_k12() const {
+  return _internal_has_k12();
 }
 inline void CameraInternalParameters::clear_k12() {
-  k12_ = 0;
-  clear_has_k12();
+  _impl_.k12_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float CameraInternalParameters::_internal_k12() const {
+  return _impl_.k12_;
 }
 inline float CameraInternalParameters::k12() const {
-  return k12_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k12)
+  return _internal_k12();
+}
+inline void CameraInternalParameters::_internal_set_k12(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.k12_ = value;
 }
 inline void CameraInternalParameters::set_k12(float value) {
-  set_has_k12();
-  k12_ = value;
+  _internal_set_k12(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k12)
 }
 
 // required float k13 = 3;
-inline bool CameraInternalParameters::has_k13() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void CameraInternalParameters::set_has_k13() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool CameraInternalParameters::_internal_has_k13() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::clear_has_k13() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CameraInternalParameters::has_k13() const {
+  return _internal_has_k13();
 }
 inline void CameraInternalParameters::clear_k13() {
-  k13_ = 0;
-  clear_has_k13();
+  _impl_.k13_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float CameraInternalParameters::_internal_k13() const {
+  return _impl_.k13_;
 }
 inline float CameraInternalParameters::k13() const {
-  return k13_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k13)
+  return _internal_k13();
+}
+inline void CameraInternalParameters::_internal_set_k13(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.k13_ = value;
 }
 inline void CameraInternalParameters::set_k13(float value) {
-  set_has_k13();
-  k13_ = value;
+  _internal_set_k13(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k13)
 }
 
 // required float k21 = 4;
-inline bool CameraInternalParameters::has_k21() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool CameraInternalParameters::_internal_has_k21() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::set_has_k21() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void CameraInternalParameters::clear_has_k21() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CameraInternalParameters::has_k21() const {
+  return _internal_has_k21();
 }
 inline void CameraInternalParameters::clear_k21() {
-  k21_ = 0;
-  clear_has_k21();
+  _impl_.k21_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float CameraInternalParameters::_internal_k21() const {
+  return _impl_.k21_;
 }
 inline float CameraInternalParameters::k21() const {
-  return k21_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k21)
+  return _internal_k21();
+}
+inline void CameraInternalParameters::_internal_set_k21(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.k21_ = value;
 }
 inline void CameraInternalParameters::set_k21(float value) {
-  set_has_k21();
-  k21_ = value;
+  _internal_set_k21(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k21)
 }
 
 // required float k22 = 5;
-inline bool CameraInternalParameters::has_k22() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
-}
-inline void CameraInternalParameters::set_has_k22() {
-  _has_bits_[0] |= 0x00000010u;
+inline bool CameraInternalParameters::_internal_has_k22() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::clear_has_k22() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CameraInternalParameters::has_k22() const {
+  return _internal_has_k22();
 }
 inline void CameraInternalParameters::clear_k22() {
-  k22_ = 0;
-  clear_has_k22();
+  _impl_.k22_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float CameraInternalParameters::_internal_k22() const {
+  return _impl_.k22_;
 }
 inline float CameraInternalParameters::k22() const {
-  return k22_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k22)
+  return _internal_k22();
+}
+inline void CameraInternalParameters::_internal_set_k22(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.k22_ = value;
 }
 inline void CameraInternalParameters::set_k22(float value) {
-  set_has_k22();
-  k22_ = value;
+  _internal_set_k22(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k22)
 }
 
 // required float k23 = 6;
-inline bool CameraInternalParameters::has_k23() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+inline bool CameraInternalParameters::_internal_has_k23() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::set_has_k23() {
-  _has_bits_[0] |= 0x00000020u;
-}
-inline void CameraInternalParameters::clear_has_k23() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool CameraInternalParameters::has_k23() const {
+  return _internal_has_k23();
 }
 inline void CameraInternalParameters::clear_k23() {
-  k23_ = 0;
-  clear_has_k23();
+  _impl_.k23_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float CameraInternalParameters::_internal_k23() const {
+  return _impl_.k23_;
 }
 inline float CameraInternalParameters::k23() const {
-  return k23_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k23)
+  return _internal_k23();
+}
+inline void CameraInternalParameters::_internal_set_k23(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.k23_ = value;
 }
 inline void CameraInternalParameters::set_k23(float value) {
-  set_has_k23();
-  k23_ = value;
+  _internal_set_k23(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k23)
 }
 
 // required float k31 = 7;
-inline bool CameraInternalParameters::has_k31() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
-}
-inline void CameraInternalParameters::set_has_k31() {
-  _has_bits_[0] |= 0x00000040u;
+inline bool CameraInternalParameters::_internal_has_k31() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::clear_has_k31() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool CameraInternalParameters::has_k31() const {
+  return _internal_has_k31();
 }
 inline void CameraInternalParameters::clear_k31() {
-  k31_ = 0;
-  clear_has_k31();
+  _impl_.k31_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline float CameraInternalParameters::_internal_k31() const {
+  return _impl_.k31_;
 }
 inline float CameraInternalParameters::k31() const {
-  return k31_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k31)
+  return _internal_k31();
+}
+inline void CameraInternalParameters::_internal_set_k31(float value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.k31_ = value;
 }
 inline void CameraInternalParameters::set_k31(float value) {
-  set_has_k31();
-  k31_ = value;
+  _internal_set_k31(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k31)
 }
 
 // required float k32 = 8;
-inline bool CameraInternalParameters::has_k32() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+inline bool CameraInternalParameters::_internal_has_k32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::set_has_k32() {
-  _has_bits_[0] |= 0x00000080u;
-}
-inline void CameraInternalParameters::clear_has_k32() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool CameraInternalParameters::has_k32() const {
+  return _internal_has_k32();
 }
 inline void CameraInternalParameters::clear_k32() {
-  k32_ = 0;
-  clear_has_k32();
+  _impl_.k32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float CameraInternalParameters::_internal_k32() const {
+  return _impl_.k32_;
 }
 inline float CameraInternalParameters::k32() const {
-  return k32_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k32)
+  return _internal_k32();
+}
+inline void CameraInternalParameters::_internal_set_k32(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.k32_ = value;
 }
 inline void CameraInternalParameters::set_k32(float value) {
-  set_has_k32();
-  k32_ = value;
+  _internal_set_k32(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k32)
 }
 
 // required float k33 = 9;
-inline bool CameraInternalParameters::has_k33() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
-}
-inline void CameraInternalParameters::set_has_k33() {
-  _has_bits_[0] |= 0x00000100u;
+inline bool CameraInternalParameters::_internal_has_k33() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void CameraInternalParameters::clear_has_k33() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool CameraInternalParameters::has_k33() const {
+  return _internal_has_k33();
 }
 inline void CameraInternalParameters::clear_k33() {
-  k33_ = 0;
-  clear_has_k33();
+  _impl_.k33_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline float CameraInternalParameters::_internal_k33() const {
+  return _impl_.k33_;
 }
 inline float CameraInternalParameters::k33() const {
-  return k33_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraInternalParameters.k33)
+  return _internal_k33();
+}
+inline void CameraInternalParameters::_internal_set_k33(float value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.k33_ = value;
 }
 inline void CameraInternalParameters::set_k33(float value) {
-  set_has_k33();
-  k33_ = value;
+  _internal_set_k33(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraInternalParameters.k33)
 }
 
 // -------------------------------------------------------------------
@@ -1213,69 +2133,87 @@ inline void CameraInternalParameters::set_k33(float value) {
 // RadialDistortion
 
 // required float k1 = 1;
-inline bool RadialDistortion::has_k1() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool RadialDistortion::_internal_has_k1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void RadialDistortion::set_has_k1() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void RadialDistortion::clear_has_k1() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool RadialDistortion::has_k1() const {
+  return _internal_has_k1();
 }
 inline void RadialDistortion::clear_k1() {
-  k1_ = 0;
-  clear_has_k1();
+  _impl_.k1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float RadialDistortion::_internal_k1() const {
+  return _impl_.k1_;
 }
 inline float RadialDistortion::k1() const {
-  return k1_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RadialDistortion.k1)
+  return _internal_k1();
+}
+inline void RadialDistortion::_internal_set_k1(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.k1_ = value;
 }
 inline void RadialDistortion::set_k1(float value) {
-  set_has_k1();
-  k1_ = value;
+  _internal_set_k1(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RadialDistortion.k1)
 }
 
 // optional float k2 = 2;
-inline bool RadialDistortion::has_k2() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void RadialDistortion::set_has_k2() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool RadialDistortion::_internal_has_k2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void RadialDistortion::clear_has_k2() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool RadialDistortion::has_k2() const {
+  return _internal_has_k2();
 }
 inline void RadialDistortion::clear_k2() {
-  k2_ = 0;
-  clear_has_k2();
+  _impl_.k2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float RadialDistortion::_internal_k2() const {
+  return _impl_.k2_;
 }
 inline float RadialDistortion::k2() const {
-  return k2_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RadialDistortion.k2)
+  return _internal_k2();
+}
+inline void RadialDistortion::_internal_set_k2(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.k2_ = value;
 }
 inline void RadialDistortion::set_k2(float value) {
-  set_has_k2();
-  k2_ = value;
+  _internal_set_k2(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RadialDistortion.k2)
 }
 
 // optional float k3 = 3;
-inline bool RadialDistortion::has_k3() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool RadialDistortion::_internal_has_k3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void RadialDistortion::set_has_k3() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void RadialDistortion::clear_has_k3() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool RadialDistortion::has_k3() const {
+  return _internal_has_k3();
 }
 inline void RadialDistortion::clear_k3() {
-  k3_ = 0;
-  clear_has_k3();
+  _impl_.k3_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float RadialDistortion::_internal_k3() const {
+  return _impl_.k3_;
 }
 inline float RadialDistortion::k3() const {
-  return k3_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RadialDistortion.k3)
+  return _internal_k3();
+}
+inline void RadialDistortion::_internal_set_k3(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.k3_ = value;
 }
 inline void RadialDistortion::set_k3(float value) {
-  set_has_k3();
-  k3_ = value;
+  _internal_set_k3(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RadialDistortion.k3)
 }
 
 // -------------------------------------------------------------------
@@ -1283,69 +2221,87 @@ inline void RadialDistortion::set_k3(float value) {
 // TangentialDistortion
 
 // required float k1 = 1;
-inline bool TangentialDistortion::has_k1() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TangentialDistortion::set_has_k1() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TangentialDistortion::_internal_has_k1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TangentialDistortion::clear_has_k1() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TangentialDistortion::has_k1() const {
+  return _internal_has_k1();
 }
 inline void TangentialDistortion::clear_k1() {
-  k1_ = 0;
-  clear_has_k1();
+  _impl_.k1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float TangentialDistortion::_internal_k1() const {
+  return _impl_.k1_;
 }
 inline float TangentialDistortion::k1() const {
-  return k1_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TangentialDistortion.k1)
+  return _internal_k1();
+}
+inline void TangentialDistortion::_internal_set_k1(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.k1_ = value;
 }
 inline void TangentialDistortion::set_k1(float value) {
-  set_has_k1();
-  k1_ = value;
+  _internal_set_k1(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TangentialDistortion.k1)
 }
 
 // required float k2 = 2;
-inline bool TangentialDistortion::has_k2() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TangentialDistortion::_internal_has_k2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TangentialDistortion::set_has_k2() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TangentialDistortion::clear_has_k2() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TangentialDistortion::has_k2() const {
+  return _internal_has_k2();
 }
 inline void TangentialDistortion::clear_k2() {
-  k2_ = 0;
-  clear_has_k2();
+  _impl_.k2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float TangentialDistortion::_internal_k2() const {
+  return _impl_.k2_;
 }
 inline float TangentialDistortion::k2() const {
-  return k2_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TangentialDistortion.k2)
+  return _internal_k2();
+}
+inline void TangentialDistortion::_internal_set_k2(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.k2_ = value;
 }
 inline void TangentialDistortion::set_k2(float value) {
-  set_has_k2();
-  k2_ = value;
+  _internal_set_k2(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TangentialDistortion.k2)
 }
 
 // optional float k3 = 3;
-inline bool TangentialDistortion::has_k3() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TangentialDistortion::set_has_k3() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TangentialDistortion::_internal_has_k3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TangentialDistortion::clear_has_k3() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TangentialDistortion::has_k3() const {
+  return _internal_has_k3();
 }
 inline void TangentialDistortion::clear_k3() {
-  k3_ = 0;
-  clear_has_k3();
+  _impl_.k3_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float TangentialDistortion::_internal_k3() const {
+  return _impl_.k3_;
 }
 inline float TangentialDistortion::k3() const {
-  return k3_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TangentialDistortion.k3)
+  return _internal_k3();
+}
+inline void TangentialDistortion::_internal_set_k3(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.k3_ = value;
 }
 inline void TangentialDistortion::set_k3(float value) {
-  set_has_k3();
-  k3_ = value;
+  _internal_set_k3(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TangentialDistortion.k3)
 }
 
 // -------------------------------------------------------------------
@@ -1353,201 +2309,255 @@ inline void TangentialDistortion::set_k3(float value) {
 // RotationMatrix
 
 // required float r11 = 1;
-inline bool RotationMatrix::has_r11() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool RotationMatrix::_internal_has_r11() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void RotationMatrix::set_has_r11() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void RotationMatrix::clear_has_r11() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool RotationMatrix::has_r11() const {
+  return _internal_has_r11();
 }
 inline void RotationMatrix::clear_r11() {
-  r11_ = 0;
-  clear_has_r11();
+  _impl_.r11_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float RotationMatrix::_internal_r11() const {
+  return _impl_.r11_;
 }
 inline float RotationMatrix::r11() const {
-  return r11_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r11)
+  return _internal_r11();
+}
+inline void RotationMatrix::_internal_set_r11(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.r11_ = value;
 }
 inline void RotationMatrix::set_r11(float value) {
-  set_has_r11();
-  r11_ = value;
+  _internal_set_r11(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r11)
 }
 
 // required float r12 = 2;
-inline bool RotationMatrix::has_r12() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void RotationMatrix::set_has_r12() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool RotationMatrix::_internal_has_r12() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void RotationMatrix::clear_has_r12() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool RotationMatrix::has_r12() const {
+  return _internal_has_r12();
 }
 inline void RotationMatrix::clear_r12() {
-  r12_ = 0;
-  clear_has_r12();
+  _impl_.r12_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float RotationMatrix::_internal_r12() const {
+  return _impl_.r12_;
 }
 inline float RotationMatrix::r12() const {
-  return r12_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r12)
+  return _internal_r12();
+}
+inline void RotationMatrix::_internal_set_r12(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.r12_ = value;
 }
 inline void RotationMatrix::set_r12(float value) {
-  set_has_r12();
-  r12_ = value;
+  _internal_set_r12(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r12)
 }
 
 // required float r13 = 3;
-inline bool RotationMatrix::has_r13() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool RotationMatrix::_internal_has_r13() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void RotationMatrix::set_has_r13() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void RotationMatrix::clear_has_r13() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool RotationMatrix::has_r13() const {
+  return _internal_has_r13();
 }
 inline void RotationMatrix::clear_r13() {
-  r13_ = 0;
-  clear_has_r13();
+  _impl_.r13_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float RotationMatrix::_internal_r13() const {
+  return _impl_.r13_;
 }
 inline float RotationMatrix::r13() const {
-  return r13_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r13)
+  return _internal_r13();
+}
+inline void RotationMatrix::_internal_set_r13(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.r13_ = value;
 }
 inline void RotationMatrix::set_r13(float value) {
-  set_has_r13();
-  r13_ = value;
+  _internal_set_r13(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r13)
 }
 
 // required float r21 = 4;
-inline bool RotationMatrix::has_r21() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
-}
-inline void RotationMatrix::set_has_r21() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool RotationMatrix::_internal_has_r21() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void RotationMatrix::clear_has_r21() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool RotationMatrix::has_r21() const {
+  return _internal_has_r21();
 }
 inline void RotationMatrix::clear_r21() {
-  r21_ = 0;
-  clear_has_r21();
+  _impl_.r21_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline float RotationMatrix::_internal_r21() const {
+  return _impl_.r21_;
 }
 inline float RotationMatrix::r21() const {
-  return r21_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r21)
+  return _internal_r21();
+}
+inline void RotationMatrix::_internal_set_r21(float value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.r21_ = value;
 }
 inline void RotationMatrix::set_r21(float value) {
-  set_has_r21();
-  r21_ = value;
+  _internal_set_r21(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r21)
 }
 
 // required float r22 = 5;
-inline bool RotationMatrix::has_r22() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool RotationMatrix::_internal_has_r22() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void RotationMatrix::set_has_r22() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void RotationMatrix::clear_has_r22() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool RotationMatrix::has_r22() const {
+  return _internal_has_r22();
 }
 inline void RotationMatrix::clear_r22() {
-  r22_ = 0;
-  clear_has_r22();
+  _impl_.r22_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline float RotationMatrix::_internal_r22() const {
+  return _impl_.r22_;
 }
 inline float RotationMatrix::r22() const {
-  return r22_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r22)
+  return _internal_r22();
+}
+inline void RotationMatrix::_internal_set_r22(float value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.r22_ = value;
 }
 inline void RotationMatrix::set_r22(float value) {
-  set_has_r22();
-  r22_ = value;
+  _internal_set_r22(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r22)
 }
 
 // required float r23 = 6;
-inline bool RotationMatrix::has_r23() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
-}
-inline void RotationMatrix::set_has_r23() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool RotationMatrix::_internal_has_r23() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
 }
-inline void RotationMatrix::clear_has_r23() {
-  _has_bits_[0] &= ~0x00000020u;
+inline bool RotationMatrix::has_r23() const {
+  return _internal_has_r23();
 }
 inline void RotationMatrix::clear_r23() {
-  r23_ = 0;
-  clear_has_r23();
+  _impl_.r23_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline float RotationMatrix::_internal_r23() const {
+  return _impl_.r23_;
 }
 inline float RotationMatrix::r23() const {
-  return r23_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r23)
+  return _internal_r23();
+}
+inline void RotationMatrix::_internal_set_r23(float value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.r23_ = value;
 }
 inline void RotationMatrix::set_r23(float value) {
-  set_has_r23();
-  r23_ = value;
+  _internal_set_r23(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r23)
 }
 
 // required float r31 = 7;
-inline bool RotationMatrix::has_r31() const {
-  return (_has_bits_[0] & 0x00000040u) != 0;
+inline bool RotationMatrix::_internal_has_r31() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
 }
-inline void RotationMatrix::set_has_r31() {
-  _has_bits_[0] |= 0x00000040u;
-}
-inline void RotationMatrix::clear_has_r31() {
-  _has_bits_[0] &= ~0x00000040u;
+inline bool RotationMatrix::has_r31() const {
+  return _internal_has_r31();
 }
 inline void RotationMatrix::clear_r31() {
-  r31_ = 0;
-  clear_has_r31();
+  _impl_.r31_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline float RotationMatrix::_internal_r31() const {
+  return _impl_.r31_;
 }
 inline float RotationMatrix::r31() const {
-  return r31_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r31)
+  return _internal_r31();
+}
+inline void RotationMatrix::_internal_set_r31(float value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.r31_ = value;
 }
 inline void RotationMatrix::set_r31(float value) {
-  set_has_r31();
-  r31_ = value;
+  _internal_set_r31(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r31)
 }
 
 // required float r32 = 8;
-inline bool RotationMatrix::has_r32() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
-}
-inline void RotationMatrix::set_has_r32() {
-  _has_bits_[0] |= 0x00000080u;
+inline bool RotationMatrix::_internal_has_r32() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
 }
-inline void RotationMatrix::clear_has_r32() {
-  _has_bits_[0] &= ~0x00000080u;
+inline bool RotationMatrix::has_r32() const {
+  return _internal_has_r32();
 }
 inline void RotationMatrix::clear_r32() {
-  r32_ = 0;
-  clear_has_r32();
+  _impl_.r32_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline float RotationMatrix::_internal_r32() const {
+  return _impl_.r32_;
 }
 inline float RotationMatrix::r32() const {
-  return r32_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r32)
+  return _internal_r32();
+}
+inline void RotationMatrix::_internal_set_r32(float value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.r32_ = value;
 }
 inline void RotationMatrix::set_r32(float value) {
-  set_has_r32();
-  r32_ = value;
+  _internal_set_r32(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r32)
 }
 
 // required float r33 = 9;
-inline bool RotationMatrix::has_r33() const {
-  return (_has_bits_[0] & 0x00000100u) != 0;
+inline bool RotationMatrix::_internal_has_r33() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void RotationMatrix::set_has_r33() {
-  _has_bits_[0] |= 0x00000100u;
-}
-inline void RotationMatrix::clear_has_r33() {
-  _has_bits_[0] &= ~0x00000100u;
+inline bool RotationMatrix::has_r33() const {
+  return _internal_has_r33();
 }
 inline void RotationMatrix::clear_r33() {
-  r33_ = 0;
-  clear_has_r33();
+  _impl_.r33_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline float RotationMatrix::_internal_r33() const {
+  return _impl_.r33_;
 }
 inline float RotationMatrix::r33() const {
-  return r33_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.RotationMatrix.r33)
+  return _internal_r33();
+}
+inline void RotationMatrix::_internal_set_r33(float value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.r33_ = value;
 }
 inline void RotationMatrix::set_r33(float value) {
-  set_has_r33();
-  r33_ = value;
+  _internal_set_r33(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.RotationMatrix.r33)
 }
 
 // -------------------------------------------------------------------
@@ -1555,69 +2565,87 @@ inline void RotationMatrix::set_r33(float value) {
 // TranslationVector
 
 // required float t1 = 1;
-inline bool TranslationVector::has_t1() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void TranslationVector::set_has_t1() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool TranslationVector::_internal_has_t1() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void TranslationVector::clear_has_t1() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool TranslationVector::has_t1() const {
+  return _internal_has_t1();
 }
 inline void TranslationVector::clear_t1() {
-  t1_ = 0;
-  clear_has_t1();
+  _impl_.t1_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline float TranslationVector::_internal_t1() const {
+  return _impl_.t1_;
 }
 inline float TranslationVector::t1() const {
-  return t1_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TranslationVector.t1)
+  return _internal_t1();
+}
+inline void TranslationVector::_internal_set_t1(float value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.t1_ = value;
 }
 inline void TranslationVector::set_t1(float value) {
-  set_has_t1();
-  t1_ = value;
+  _internal_set_t1(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TranslationVector.t1)
 }
 
 // required float t2 = 2;
-inline bool TranslationVector::has_t2() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool TranslationVector::_internal_has_t2() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void TranslationVector::set_has_t2() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void TranslationVector::clear_has_t2() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool TranslationVector::has_t2() const {
+  return _internal_has_t2();
 }
 inline void TranslationVector::clear_t2() {
-  t2_ = 0;
-  clear_has_t2();
+  _impl_.t2_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline float TranslationVector::_internal_t2() const {
+  return _impl_.t2_;
 }
 inline float TranslationVector::t2() const {
-  return t2_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TranslationVector.t2)
+  return _internal_t2();
+}
+inline void TranslationVector::_internal_set_t2(float value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.t2_ = value;
 }
 inline void TranslationVector::set_t2(float value) {
-  set_has_t2();
-  t2_ = value;
+  _internal_set_t2(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TranslationVector.t2)
 }
 
 // required float t3 = 3;
-inline bool TranslationVector::has_t3() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void TranslationVector::set_has_t3() {
-  _has_bits_[0] |= 0x00000004u;
+inline bool TranslationVector::_internal_has_t3() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void TranslationVector::clear_has_t3() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool TranslationVector::has_t3() const {
+  return _internal_has_t3();
 }
 inline void TranslationVector::clear_t3() {
-  t3_ = 0;
-  clear_has_t3();
+  _impl_.t3_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline float TranslationVector::_internal_t3() const {
+  return _impl_.t3_;
 }
 inline float TranslationVector::t3() const {
-  return t3_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.TranslationVector.t3)
+  return _internal_t3();
+}
+inline void TranslationVector::_internal_set_t3(float value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.t3_ = value;
 }
 inline void TranslationVector::set_t3(float value) {
-  set_has_t3();
-  t3_ = value;
+  _internal_set_t3(value);
+  // @@protoc_insertion_point(field_set:doppia_protobuf.TranslationVector.t3)
 }
 
 // -------------------------------------------------------------------
@@ -1625,375 +2653,892 @@ inline void TranslationVector::set_t3(float value) {
 // Pose
 
 // required .doppia_protobuf.RotationMatrix rotation = 1;
-inline bool Pose::has_rotation() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Pose::_internal_has_rotation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rotation_ != nullptr);
+  return value;
 }
-inline void Pose::set_has_rotation() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Pose::clear_has_rotation() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Pose::has_rotation() const {
+  return _internal_has_rotation();
 }
 inline void Pose::clear_rotation() {
-  if (rotation_ != NULL) rotation_->::doppia_protobuf::RotationMatrix::Clear();
-  clear_has_rotation();
+  if (_impl_.rotation_ != nullptr) _impl_.rotation_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::doppia_protobuf::RotationMatrix& Pose::_internal_rotation() const {
+  const ::doppia_protobuf::RotationMatrix* p = _impl_.rotation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::RotationMatrix&>(
+      ::doppia_protobuf::_RotationMatrix_default_instance_);
 }
 inline const ::doppia_protobuf::RotationMatrix& Pose::rotation() const {
-  return rotation_ != NULL ? *rotation_ : *default_instance_->rotation_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Pose.rotation)
+  return _internal_rotation();
 }
-inline ::doppia_protobuf::RotationMatrix* Pose::mutable_rotation() {
-  set_has_rotation();
-  if (rotation_ == NULL) rotation_ = new ::doppia_protobuf::RotationMatrix;
-  return rotation_;
+inline void Pose::unsafe_arena_set_allocated_rotation(
+    ::doppia_protobuf::RotationMatrix* rotation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rotation_);
+  }
+  _impl_.rotation_ = rotation;
+  if (rotation) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Pose.rotation)
 }
 inline ::doppia_protobuf::RotationMatrix* Pose::release_rotation() {
-  clear_has_rotation();
-  ::doppia_protobuf::RotationMatrix* temp = rotation_;
-  rotation_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::RotationMatrix* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::RotationMatrix* Pose::unsafe_arena_release_rotation() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Pose.rotation)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::doppia_protobuf::RotationMatrix* temp = _impl_.rotation_;
+  _impl_.rotation_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::RotationMatrix* Pose::_internal_mutable_rotation() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.rotation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::RotationMatrix>(GetArenaForAllocation());
+    _impl_.rotation_ = p;
+  }
+  return _impl_.rotation_;
+}
+inline ::doppia_protobuf::RotationMatrix* Pose::mutable_rotation() {
+  ::doppia_protobuf::RotationMatrix* _msg = _internal_mutable_rotation();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Pose.rotation)
+  return _msg;
+}
+inline void Pose::set_allocated_rotation(::doppia_protobuf::RotationMatrix* rotation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rotation_;
+  }
+  if (rotation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rotation);
+    if (message_arena != submessage_arena) {
+      rotation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rotation, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rotation_ = rotation;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Pose.rotation)
+}
 
 // required .doppia_protobuf.TranslationVector translation = 2;
-inline bool Pose::has_translation() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Pose::_internal_has_translation() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.translation_ != nullptr);
+  return value;
 }
-inline void Pose::set_has_translation() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Pose::clear_has_translation() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Pose::has_translation() const {
+  return _internal_has_translation();
 }
 inline void Pose::clear_translation() {
-  if (translation_ != NULL) translation_->::doppia_protobuf::TranslationVector::Clear();
-  clear_has_translation();
+  if (_impl_.translation_ != nullptr) _impl_.translation_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::doppia_protobuf::TranslationVector& Pose::_internal_translation() const {
+  const ::doppia_protobuf::TranslationVector* p = _impl_.translation_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::TranslationVector&>(
+      ::doppia_protobuf::_TranslationVector_default_instance_);
 }
 inline const ::doppia_protobuf::TranslationVector& Pose::translation() const {
-  return translation_ != NULL ? *translation_ : *default_instance_->translation_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.Pose.translation)
+  return _internal_translation();
 }
-inline ::doppia_protobuf::TranslationVector* Pose::mutable_translation() {
-  set_has_translation();
-  if (translation_ == NULL) translation_ = new ::doppia_protobuf::TranslationVector;
-  return translation_;
+inline void Pose::unsafe_arena_set_allocated_translation(
+    ::doppia_protobuf::TranslationVector* translation) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.translation_);
+  }
+  _impl_.translation_ = translation;
+  if (translation) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.Pose.translation)
 }
 inline ::doppia_protobuf::TranslationVector* Pose::release_translation() {
-  clear_has_translation();
-  ::doppia_protobuf::TranslationVector* temp = translation_;
-  translation_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::TranslationVector* temp = _impl_.translation_;
+  _impl_.translation_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::TranslationVector* Pose::unsafe_arena_release_translation() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.Pose.translation)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::TranslationVector* temp = _impl_.translation_;
+  _impl_.translation_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::TranslationVector* Pose::_internal_mutable_translation() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.translation_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::TranslationVector>(GetArenaForAllocation());
+    _impl_.translation_ = p;
+  }
+  return _impl_.translation_;
+}
+inline ::doppia_protobuf::TranslationVector* Pose::mutable_translation() {
+  ::doppia_protobuf::TranslationVector* _msg = _internal_mutable_translation();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.Pose.translation)
+  return _msg;
+}
+inline void Pose::set_allocated_translation(::doppia_protobuf::TranslationVector* translation) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.translation_;
+  }
+  if (translation) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(translation);
+    if (message_arena != submessage_arena) {
+      translation = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, translation, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.translation_ = translation;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.Pose.translation)
+}
 
 // -------------------------------------------------------------------
 
 // CameraCalibration
 
 // optional string name = 1;
-inline bool CameraCalibration::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool CameraCalibration::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void CameraCalibration::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void CameraCalibration::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool CameraCalibration::has_name() const {
+  return _internal_has_name();
 }
 inline void CameraCalibration::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CameraCalibration::name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraCalibration.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CameraCalibration::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.CameraCalibration.name)
+}
+inline std::string* CameraCalibration::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CameraCalibration.name)
+  return _s;
+}
+inline const std::string& CameraCalibration::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CameraCalibration::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CameraCalibration::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CameraCalibration::release_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.CameraCalibration.name)
+  if (!_internal_has_name()) {
+    return nullptr;
   }
-  clear_has_name();
-}
-inline const ::std::string& CameraCalibration::name() const {
-  return *name_;
-}
-inline void CameraCalibration::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void CameraCalibration::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void CameraCalibration::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* CameraCalibration::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  return name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* CameraCalibration::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void CameraCalibration::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.CameraCalibration.name)
 }
 
 // required .doppia_protobuf.CameraInternalParameters internal_parameters = 2;
-inline bool CameraCalibration::has_internal_parameters() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool CameraCalibration::_internal_has_internal_parameters() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.internal_parameters_ != nullptr);
+  return value;
 }
-inline void CameraCalibration::set_has_internal_parameters() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void CameraCalibration::clear_has_internal_parameters() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool CameraCalibration::has_internal_parameters() const {
+  return _internal_has_internal_parameters();
 }
 inline void CameraCalibration::clear_internal_parameters() {
-  if (internal_parameters_ != NULL) internal_parameters_->::doppia_protobuf::CameraInternalParameters::Clear();
-  clear_has_internal_parameters();
+  if (_impl_.internal_parameters_ != nullptr) _impl_.internal_parameters_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::doppia_protobuf::CameraInternalParameters& CameraCalibration::_internal_internal_parameters() const {
+  const ::doppia_protobuf::CameraInternalParameters* p = _impl_.internal_parameters_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::CameraInternalParameters&>(
+      ::doppia_protobuf::_CameraInternalParameters_default_instance_);
 }
 inline const ::doppia_protobuf::CameraInternalParameters& CameraCalibration::internal_parameters() const {
-  return internal_parameters_ != NULL ? *internal_parameters_ : *default_instance_->internal_parameters_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraCalibration.internal_parameters)
+  return _internal_internal_parameters();
 }
-inline ::doppia_protobuf::CameraInternalParameters* CameraCalibration::mutable_internal_parameters() {
-  set_has_internal_parameters();
-  if (internal_parameters_ == NULL) internal_parameters_ = new ::doppia_protobuf::CameraInternalParameters;
-  return internal_parameters_;
+inline void CameraCalibration::unsafe_arena_set_allocated_internal_parameters(
+    ::doppia_protobuf::CameraInternalParameters* internal_parameters) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.internal_parameters_);
+  }
+  _impl_.internal_parameters_ = internal_parameters;
+  if (internal_parameters) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.CameraCalibration.internal_parameters)
 }
 inline ::doppia_protobuf::CameraInternalParameters* CameraCalibration::release_internal_parameters() {
-  clear_has_internal_parameters();
-  ::doppia_protobuf::CameraInternalParameters* temp = internal_parameters_;
-  internal_parameters_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::CameraInternalParameters* temp = _impl_.internal_parameters_;
+  _impl_.internal_parameters_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::CameraInternalParameters* CameraCalibration::unsafe_arena_release_internal_parameters() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.CameraCalibration.internal_parameters)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::CameraInternalParameters* temp = _impl_.internal_parameters_;
+  _impl_.internal_parameters_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::CameraInternalParameters* CameraCalibration::_internal_mutable_internal_parameters() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.internal_parameters_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::CameraInternalParameters>(GetArenaForAllocation());
+    _impl_.internal_parameters_ = p;
+  }
+  return _impl_.internal_parameters_;
+}
+inline ::doppia_protobuf::CameraInternalParameters* CameraCalibration::mutable_internal_parameters() {
+  ::doppia_protobuf::CameraInternalParameters* _msg = _internal_mutable_internal_parameters();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CameraCalibration.internal_parameters)
+  return _msg;
+}
+inline void CameraCalibration::set_allocated_internal_parameters(::doppia_protobuf::CameraInternalParameters* internal_parameters) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.internal_parameters_;
+  }
+  if (internal_parameters) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(internal_parameters);
+    if (message_arena != submessage_arena) {
+      internal_parameters = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, internal_parameters, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.internal_parameters_ = internal_parameters;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.CameraCalibration.internal_parameters)
+}
 
 // optional .doppia_protobuf.RadialDistortion radial_distortion = 3;
-inline bool CameraCalibration::has_radial_distortion() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool CameraCalibration::_internal_has_radial_distortion() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.radial_distortion_ != nullptr);
+  return value;
 }
-inline void CameraCalibration::set_has_radial_distortion() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void CameraCalibration::clear_has_radial_distortion() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool CameraCalibration::has_radial_distortion() const {
+  return _internal_has_radial_distortion();
 }
 inline void CameraCalibration::clear_radial_distortion() {
-  if (radial_distortion_ != NULL) radial_distortion_->::doppia_protobuf::RadialDistortion::Clear();
-  clear_has_radial_distortion();
+  if (_impl_.radial_distortion_ != nullptr) _impl_.radial_distortion_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::doppia_protobuf::RadialDistortion& CameraCalibration::_internal_radial_distortion() const {
+  const ::doppia_protobuf::RadialDistortion* p = _impl_.radial_distortion_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::RadialDistortion&>(
+      ::doppia_protobuf::_RadialDistortion_default_instance_);
 }
 inline const ::doppia_protobuf::RadialDistortion& CameraCalibration::radial_distortion() const {
-  return radial_distortion_ != NULL ? *radial_distortion_ : *default_instance_->radial_distortion_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraCalibration.radial_distortion)
+  return _internal_radial_distortion();
 }
-inline ::doppia_protobuf::RadialDistortion* CameraCalibration::mutable_radial_distortion() {
-  set_has_radial_distortion();
-  if (radial_distortion_ == NULL) radial_distortion_ = new ::doppia_protobuf::RadialDistortion;
-  return radial_distortion_;
+inline void CameraCalibration::unsafe_arena_set_allocated_radial_distortion(
+    ::doppia_protobuf::RadialDistortion* radial_distortion) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.radial_distortion_);
+  }
+  _impl_.radial_distortion_ = radial_distortion;
+  if (radial_distortion) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.CameraCalibration.radial_distortion)
 }
 inline ::doppia_protobuf::RadialDistortion* CameraCalibration::release_radial_distortion() {
-  clear_has_radial_distortion();
-  ::doppia_protobuf::RadialDistortion* temp = radial_distortion_;
-  radial_distortion_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::RadialDistortion* temp = _impl_.radial_distortion_;
+  _impl_.radial_distortion_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::RadialDistortion* CameraCalibration::unsafe_arena_release_radial_distortion() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.CameraCalibration.radial_distortion)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::RadialDistortion* temp = _impl_.radial_distortion_;
+  _impl_.radial_distortion_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::RadialDistortion* CameraCalibration::_internal_mutable_radial_distortion() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.radial_distortion_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::RadialDistortion>(GetArenaForAllocation());
+    _impl_.radial_distortion_ = p;
+  }
+  return _impl_.radial_distortion_;
+}
+inline ::doppia_protobuf::RadialDistortion* CameraCalibration::mutable_radial_distortion() {
+  ::doppia_protobuf::RadialDistortion* _msg = _internal_mutable_radial_distortion();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CameraCalibration.radial_distortion)
+  return _msg;
+}
+inline void CameraCalibration::set_allocated_radial_distortion(::doppia_protobuf::RadialDistortion* radial_distortion) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.radial_distortion_;
+  }
+  if (radial_distortion) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(radial_distortion);
+    if (message_arena != submessage_arena) {
+      radial_distortion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, radial_distortion, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.radial_distortion_ = radial_distortion;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.CameraCalibration.radial_distortion)
+}
 
 // optional .doppia_protobuf.TangentialDistortion tangential_distortion = 4;
-inline bool CameraCalibration::has_tangential_distortion() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+inline bool CameraCalibration::_internal_has_tangential_distortion() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.tangential_distortion_ != nullptr);
+  return value;
 }
-inline void CameraCalibration::set_has_tangential_distortion() {
-  _has_bits_[0] |= 0x00000008u;
-}
-inline void CameraCalibration::clear_has_tangential_distortion() {
-  _has_bits_[0] &= ~0x00000008u;
+inline bool CameraCalibration::has_tangential_distortion() const {
+  return _internal_has_tangential_distortion();
 }
 inline void CameraCalibration::clear_tangential_distortion() {
-  if (tangential_distortion_ != NULL) tangential_distortion_->::doppia_protobuf::TangentialDistortion::Clear();
-  clear_has_tangential_distortion();
+  if (_impl_.tangential_distortion_ != nullptr) _impl_.tangential_distortion_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::doppia_protobuf::TangentialDistortion& CameraCalibration::_internal_tangential_distortion() const {
+  const ::doppia_protobuf::TangentialDistortion* p = _impl_.tangential_distortion_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::TangentialDistortion&>(
+      ::doppia_protobuf::_TangentialDistortion_default_instance_);
 }
 inline const ::doppia_protobuf::TangentialDistortion& CameraCalibration::tangential_distortion() const {
-  return tangential_distortion_ != NULL ? *tangential_distortion_ : *default_instance_->tangential_distortion_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraCalibration.tangential_distortion)
+  return _internal_tangential_distortion();
 }
-inline ::doppia_protobuf::TangentialDistortion* CameraCalibration::mutable_tangential_distortion() {
-  set_has_tangential_distortion();
-  if (tangential_distortion_ == NULL) tangential_distortion_ = new ::doppia_protobuf::TangentialDistortion;
-  return tangential_distortion_;
+inline void CameraCalibration::unsafe_arena_set_allocated_tangential_distortion(
+    ::doppia_protobuf::TangentialDistortion* tangential_distortion) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.tangential_distortion_);
+  }
+  _impl_.tangential_distortion_ = tangential_distortion;
+  if (tangential_distortion) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.CameraCalibration.tangential_distortion)
 }
 inline ::doppia_protobuf::TangentialDistortion* CameraCalibration::release_tangential_distortion() {
-  clear_has_tangential_distortion();
-  ::doppia_protobuf::TangentialDistortion* temp = tangential_distortion_;
-  tangential_distortion_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::doppia_protobuf::TangentialDistortion* temp = _impl_.tangential_distortion_;
+  _impl_.tangential_distortion_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::TangentialDistortion* CameraCalibration::unsafe_arena_release_tangential_distortion() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.CameraCalibration.tangential_distortion)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::doppia_protobuf::TangentialDistortion* temp = _impl_.tangential_distortion_;
+  _impl_.tangential_distortion_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::TangentialDistortion* CameraCalibration::_internal_mutable_tangential_distortion() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.tangential_distortion_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::TangentialDistortion>(GetArenaForAllocation());
+    _impl_.tangential_distortion_ = p;
+  }
+  return _impl_.tangential_distortion_;
+}
+inline ::doppia_protobuf::TangentialDistortion* CameraCalibration::mutable_tangential_distortion() {
+  ::doppia_protobuf::TangentialDistortion* _msg = _internal_mutable_tangential_distortion();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CameraCalibration.tangential_distortion)
+  return _msg;
+}
+inline void CameraCalibration::set_allocated_tangential_distortion(::doppia_protobuf::TangentialDistortion* tangential_distortion) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.tangential_distortion_;
+  }
+  if (tangential_distortion) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(tangential_distortion);
+    if (message_arena != submessage_arena) {
+      tangential_distortion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, tangential_distortion, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.tangential_distortion_ = tangential_distortion;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.CameraCalibration.tangential_distortion)
+}
 
 // optional .doppia_protobuf.Pose pose = 5;
-inline bool CameraCalibration::has_pose() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+inline bool CameraCalibration::_internal_has_pose() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pose_ != nullptr);
+  return value;
 }
-inline void CameraCalibration::set_has_pose() {
-  _has_bits_[0] |= 0x00000010u;
-}
-inline void CameraCalibration::clear_has_pose() {
-  _has_bits_[0] &= ~0x00000010u;
+inline bool CameraCalibration::has_pose() const {
+  return _internal_has_pose();
 }
 inline void CameraCalibration::clear_pose() {
-  if (pose_ != NULL) pose_->::doppia_protobuf::Pose::Clear();
-  clear_has_pose();
+  if (_impl_.pose_ != nullptr) _impl_.pose_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::doppia_protobuf::Pose& CameraCalibration::_internal_pose() const {
+  const ::doppia_protobuf::Pose* p = _impl_.pose_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::Pose&>(
+      ::doppia_protobuf::_Pose_default_instance_);
 }
 inline const ::doppia_protobuf::Pose& CameraCalibration::pose() const {
-  return pose_ != NULL ? *pose_ : *default_instance_->pose_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.CameraCalibration.pose)
+  return _internal_pose();
 }
-inline ::doppia_protobuf::Pose* CameraCalibration::mutable_pose() {
-  set_has_pose();
-  if (pose_ == NULL) pose_ = new ::doppia_protobuf::Pose;
-  return pose_;
+inline void CameraCalibration::unsafe_arena_set_allocated_pose(
+    ::doppia_protobuf::Pose* pose) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pose_);
+  }
+  _impl_.pose_ = pose;
+  if (pose) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.CameraCalibration.pose)
 }
 inline ::doppia_protobuf::Pose* CameraCalibration::release_pose() {
-  clear_has_pose();
-  ::doppia_protobuf::Pose* temp = pose_;
-  pose_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::doppia_protobuf::Pose* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::Pose* CameraCalibration::unsafe_arena_release_pose() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.CameraCalibration.pose)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::doppia_protobuf::Pose* temp = _impl_.pose_;
+  _impl_.pose_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::Pose* CameraCalibration::_internal_mutable_pose() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pose_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::Pose>(GetArenaForAllocation());
+    _impl_.pose_ = p;
+  }
+  return _impl_.pose_;
+}
+inline ::doppia_protobuf::Pose* CameraCalibration::mutable_pose() {
+  ::doppia_protobuf::Pose* _msg = _internal_mutable_pose();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.CameraCalibration.pose)
+  return _msg;
+}
+inline void CameraCalibration::set_allocated_pose(::doppia_protobuf::Pose* pose) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pose_;
+  }
+  if (pose) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pose);
+    if (message_arena != submessage_arena) {
+      pose = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.pose_ = pose;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.CameraCalibration.pose)
+}
 
 // -------------------------------------------------------------------
 
 // StereoCameraCalibration
 
 // optional string name = 1;
-inline bool StereoCameraCalibration::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool StereoCameraCalibration::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void StereoCameraCalibration::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void StereoCameraCalibration::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool StereoCameraCalibration::has_name() const {
+  return _internal_has_name();
 }
 inline void StereoCameraCalibration::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& StereoCameraCalibration::name() const {
-  return *name_;
-}
-inline void StereoCameraCalibration::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void StereoCameraCalibration::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void StereoCameraCalibration::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& StereoCameraCalibration::name() const {
+  // @@protoc_insertion_point(field_get:doppia_protobuf.StereoCameraCalibration.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void StereoCameraCalibration::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:doppia_protobuf.StereoCameraCalibration.name)
+}
+inline std::string* StereoCameraCalibration::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.StereoCameraCalibration.name)
+  return _s;
+}
+inline const std::string& StereoCameraCalibration::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void StereoCameraCalibration::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* StereoCameraCalibration::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* StereoCameraCalibration::release_name() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.StereoCameraCalibration.name)
+  if (!_internal_has_name()) {
+    return nullptr;
   }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* StereoCameraCalibration::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
-  return name_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* StereoCameraCalibration::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline void StereoCameraCalibration::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.StereoCameraCalibration.name)
 }
 
 // required .doppia_protobuf.CameraCalibration left_camera = 2;
-inline bool StereoCameraCalibration::has_left_camera() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool StereoCameraCalibration::_internal_has_left_camera() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.left_camera_ != nullptr);
+  return value;
 }
-inline void StereoCameraCalibration::set_has_left_camera() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void StereoCameraCalibration::clear_has_left_camera() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool StereoCameraCalibration::has_left_camera() const {
+  return _internal_has_left_camera();
 }
 inline void StereoCameraCalibration::clear_left_camera() {
-  if (left_camera_ != NULL) left_camera_->::doppia_protobuf::CameraCalibration::Clear();
-  clear_has_left_camera();
+  if (_impl_.left_camera_ != nullptr) _impl_.left_camera_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::doppia_protobuf::CameraCalibration& StereoCameraCalibration::_internal_left_camera() const {
+  const ::doppia_protobuf::CameraCalibration* p = _impl_.left_camera_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::CameraCalibration&>(
+      ::doppia_protobuf::_CameraCalibration_default_instance_);
 }
 inline const ::doppia_protobuf::CameraCalibration& StereoCameraCalibration::left_camera() const {
-  return left_camera_ != NULL ? *left_camera_ : *default_instance_->left_camera_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.StereoCameraCalibration.left_camera)
+  return _internal_left_camera();
 }
-inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::mutable_left_camera() {
-  set_has_left_camera();
-  if (left_camera_ == NULL) left_camera_ = new ::doppia_protobuf::CameraCalibration;
-  return left_camera_;
+inline void StereoCameraCalibration::unsafe_arena_set_allocated_left_camera(
+    ::doppia_protobuf::CameraCalibration* left_camera) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.left_camera_);
+  }
+  _impl_.left_camera_ = left_camera;
+  if (left_camera) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.StereoCameraCalibration.left_camera)
 }
 inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::release_left_camera() {
-  clear_has_left_camera();
-  ::doppia_protobuf::CameraCalibration* temp = left_camera_;
-  left_camera_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::CameraCalibration* temp = _impl_.left_camera_;
+  _impl_.left_camera_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::unsafe_arena_release_left_camera() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.StereoCameraCalibration.left_camera)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::doppia_protobuf::CameraCalibration* temp = _impl_.left_camera_;
+  _impl_.left_camera_ = nullptr;
   return temp;
 }
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::_internal_mutable_left_camera() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.left_camera_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::CameraCalibration>(GetArenaForAllocation());
+    _impl_.left_camera_ = p;
+  }
+  return _impl_.left_camera_;
+}
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::mutable_left_camera() {
+  ::doppia_protobuf::CameraCalibration* _msg = _internal_mutable_left_camera();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.StereoCameraCalibration.left_camera)
+  return _msg;
+}
+inline void StereoCameraCalibration::set_allocated_left_camera(::doppia_protobuf::CameraCalibration* left_camera) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.left_camera_;
+  }
+  if (left_camera) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(left_camera);
+    if (message_arena != submessage_arena) {
+      left_camera = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, left_camera, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.left_camera_ = left_camera;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.StereoCameraCalibration.left_camera)
+}
 
 // required .doppia_protobuf.CameraCalibration right_camera = 3;
-inline bool StereoCameraCalibration::has_right_camera() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool StereoCameraCalibration::_internal_has_right_camera() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.right_camera_ != nullptr);
+  return value;
 }
-inline void StereoCameraCalibration::set_has_right_camera() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void StereoCameraCalibration::clear_has_right_camera() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool StereoCameraCalibration::has_right_camera() const {
+  return _internal_has_right_camera();
 }
 inline void StereoCameraCalibration::clear_right_camera() {
-  if (right_camera_ != NULL) right_camera_->::doppia_protobuf::CameraCalibration::Clear();
-  clear_has_right_camera();
+  if (_impl_.right_camera_ != nullptr) _impl_.right_camera_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::doppia_protobuf::CameraCalibration& StereoCameraCalibration::_internal_right_camera() const {
+  const ::doppia_protobuf::CameraCalibration* p = _impl_.right_camera_;
+  return p != nullptr ? *p : reinterpret_cast<const ::doppia_protobuf::CameraCalibration&>(
+      ::doppia_protobuf::_CameraCalibration_default_instance_);
 }
 inline const ::doppia_protobuf::CameraCalibration& StereoCameraCalibration::right_camera() const {
-  return right_camera_ != NULL ? *right_camera_ : *default_instance_->right_camera_;
+  // @@protoc_insertion_point(field_get:doppia_protobuf.StereoCameraCalibration.right_camera)
+  return _internal_right_camera();
 }
-inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::mutable_right_camera() {
-  set_has_right_camera();
-  if (right_camera_ == NULL) right_camera_ = new ::doppia_protobuf::CameraCalibration;
-  return right_camera_;
+inline void StereoCameraCalibration::unsafe_arena_set_allocated_right_camera(
+    ::doppia_protobuf::CameraCalibration* right_camera) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.right_camera_);
+  }
+  _impl_.right_camera_ = right_camera;
+  if (right_camera) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:doppia_protobuf.StereoCameraCalibration.right_camera)
 }
 inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::release_right_camera() {
-  clear_has_right_camera();
-  ::doppia_protobuf::CameraCalibration* temp = right_camera_;
-  right_camera_ = NULL;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::CameraCalibration* temp = _impl_.right_camera_;
+  _impl_.right_camera_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::unsafe_arena_release_right_camera() {
+  // @@protoc_insertion_point(field_release:doppia_protobuf.StereoCameraCalibration.right_camera)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::doppia_protobuf::CameraCalibration* temp = _impl_.right_camera_;
+  _impl_.right_camera_ = nullptr;
+  return temp;
+}
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::_internal_mutable_right_camera() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.right_camera_ == nullptr) {
+    auto* p = CreateMaybeMessage<::doppia_protobuf::CameraCalibration>(GetArenaForAllocation());
+    _impl_.right_camera_ = p;
+  }
+  return _impl_.right_camera_;
+}
+inline ::doppia_protobuf::CameraCalibration* StereoCameraCalibration::mutable_right_camera() {
+  ::doppia_protobuf::CameraCalibration* _msg = _internal_mutable_right_camera();
+  // @@protoc_insertion_point(field_mutable:doppia_protobuf.StereoCameraCalibration.right_camera)
+  return _msg;
+}
+inline void StereoCameraCalibration::set_allocated_right_camera(::doppia_protobuf::CameraCalibration* right_camera) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.right_camera_;
+  }
+  if (right_camera) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(right_camera);
+    if (message_arena != submessage_arena) {
+      right_camera = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, right_camera, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.right_camera_ = right_camera;
+  // @@protoc_insertion_point(field_set_allocated:doppia_protobuf.StereoCameraCalibration.right_camera)
+}
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
-// @@protoc_insertion_point(namespace_scope)
+// -------------------------------------------------------------------
 
-}  // namespace doppia_protobuf
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
 
+// @@protoc_insertion_point(namespace_scope)
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+}  // namespace doppia_protobuf
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_calibration_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_calibration_2eproto
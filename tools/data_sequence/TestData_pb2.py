@@ -1,67 +1,25 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
-
-from google.protobuf import descriptor
-from google.protobuf import message
-from google.protobuf import reflection
-from google.protobuf import descriptor_pb2
+# source: TestData.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
-
-DESCRIPTOR = descriptor.FileDescriptor(
-  name='TestData.proto',
-  package='doppia_protobuf',
-  serialized_pb='\n\x0eTestData.proto\x12\x0f\x62iclop_protobuf\"H\n\x08TestData\x12\x11\n\tint_value\x18\x01 \x01(\x05\x12\x13\n\x0b\x66loat_value\x18\x02 \x01(\x02\x12\x14\n\x0cstring_value\x18\x03 \x01(\t')
-
-
+_sym_db = _symbol_database.Default()
 
 
-_TESTDATA = descriptor.Descriptor(
-  name='TestData',
-  full_name='doppia_protobuf.TestData',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='int_value', full_name='doppia_protobuf.TestData.int_value', index=0,
-      number=1, type=5, cpp_type=1, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='float_value', full_name='doppia_protobuf.TestData.float_value', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='string_value', full_name='doppia_protobuf.TestData.string_value', index=2,
-      number=3, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=unicode("", "utf-8"),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=35,
-  serialized_end=107,
-)
 
 
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0eTestData.proto\x12\x0f\x64oppia_protobuf\"H\n\x08TestData\x12\x11\n\tint_value\x18\x01 \x01(\x05\x12\x13\n\x0b\x66loat_value\x18\x02 \x01(\x02\x12\x14\n\x0cstring_value\x18\x03 \x01(\t')
 
-class TestData(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _TESTDATA
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.TestData)
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'TestData_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
 
+  DESCRIPTOR._options = None
+  _TESTDATA._serialized_start=35
+  _TESTDATA._serialized_end=107
 # @@protoc_insertion_point(module_scope)
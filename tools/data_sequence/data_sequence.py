@@ -6,18 +6,22 @@ from __future__ import print_function
 from DataSequenceHeader_pb2 import DataSequenceHeader
 from google.protobuf.message import DecodeError
 
-import os.path
+import os, os.path
 from struct import pack, unpack
 
+# see doppia/src/helpers/data/DataSequenceIndex.hpp
+index_magic = b"DSINDEX1"
+
 class DataSequence:
     """
     This is the python mirror of the c++ DataSequence class
     See doppia/src/helpers/data/DataSequence.hpp for more information
     """
-    def __init__(self, filename, data_type, attributes = {}):
+    def __init__(self, filename, data_type, attributes = {}, write_index = False):
         """
         if no attributes are given then the file is opened in read more,
         else it is opened in write mode
+        if write_index is True, the index footer is written when calling close()
         """
 
         self.data_type = data_type
@@ -26,6 +30,8 @@ class DataSequence:
             # write mode
             self.file = open(filename, "wb")
             self.attributes = attributes
+            self.write_index = write_index
+            self.messages_offsets = []
             self._write_header()
         else:
             # read mode
@@ -33,6 +39,7 @@ class DataSequence:
             self.file = open(filename, "rb")
             self.attributes = {}
             self._read_header()
+            self._read_index()
 
         return
 
@@ -53,6 +60,70 @@ class DataSequence:
         for attribute in self.header.attributes:
             self.attributes[attribute.name] = attribute.value     
 
+        self.first_message_offset = 8 + size
+        return
+
+    def _read_index(self):
+        """
+        Reads the index footer (if present),
+        sets the messages offsets (None if there is no index) and the end of the messages data
+        """
+
+        self.file.seek(0, os.SEEK_END)
+        file_size = self.file.tell()
+        self.data_end_offset = file_size
+        self.messages_offsets = None
+
+        footer_size = 8 + len(index_magic)
+        if file_size >= self.first_message_offset + footer_size:
+            self.file.seek(file_size - footer_size)
+            num_messages = unpack("<Q", self.file.read(8))[0]
+            magic = self.file.read(len(index_magic))
+            index_offset = file_size - footer_size - num_messages*8
+            if magic == index_magic and index_offset >= self.first_message_offset:
+                self.file.seek(index_offset)
+                offsets = list(unpack("<%iQ" % num_messages, self.file.read(num_messages*8)))
+                if self._index_is_valid(offsets, index_offset):
+                    self.messages_offsets = offsets
+                    self.data_end_offset = index_offset
+
+        self.file.seek(self.first_message_offset)
+        return
+
+    def _index_is_valid(self, offsets, index_offset):
+        """
+        Same check as the c++ read_data_sequence_index,
+        a message ending with the magic bytes should not be mistaken for an index
+        """
+        if not offsets:
+            return index_offset == self.first_message_offset
+
+        if offsets[0] != self.first_message_offset:
+            return False
+
+        self.file.seek(offsets[-1])
+        raw_little_endian_int64 = self.file.read(8)
+        if len(raw_little_endian_int64) != 8:
+            return False
+        last_message_size = unpack("<Q", raw_little_endian_int64)[0]
+        return offsets[-1] + 8 + last_message_size == index_offset
+
+    def _scan_offsets(self):
+        """
+        Builds the messages offsets for files without index,
+        by jumping from one message size to the next
+        """
+
+        self.messages_offsets = []
+        offset = self.first_message_offset
+        while offset + 8 <= self.data_end_offset:
+            self.file.seek(offset)
+            size = unpack("<Q", self.file.read(8))[0]
+            if size > self.data_end_offset - offset - 8:
+                break # truncated message
+            self.messages_offsets.append(offset)
+            offset += 8 + size
+
         return
 
     def _write_header(self):
@@ -92,6 +163,10 @@ class DataSequence:
         # size is saved using WriteLittleEndian64, 64 / 8 == 8
         # see http://docs.python.org/library/struct.html#byte-order-size-and-alignment
 
+        if self.file.tell() + 8 > self.data_end_offset:
+            # end of the messages data (the index footer is not a message)
+            return None
+
         raw_little_endian_int64 = self.file.read(8)        
         if not raw_little_endian_int64:
             # end of file
@@ -112,6 +187,39 @@ class DataSequence:
             data = None
         return data
 
+    def num_messages(self):
+        """
+        Number of messages in the file (read mode only)
+        """
+        assert self.file.mode == "rb"
+
+        if self.messages_offsets is None:
+            self._scan_offsets()
+        return len(self.messages_offsets)
+
+    def read_at(self, index):
+        """
+        Reads the message number index (starting from zero),
+        does not change the position used by read()
+        O(1) if the file has an index footer
+        """
+
+        assert self.file.mode == "rb"
+
+        if self.messages_offsets is None:
+            self._scan_offsets()
+
+        if index < 0 or index >= len(self.messages_offsets):
+            raise IndexError("DataSequence.read_at index out of range")
+
+        current_position = self.file.tell()
+        self.file.seek(self.messages_offsets[index])
+        size = unpack("<Q", self.file.read(8))[0]
+        data = self.data_type()
+        data.ParseFromString(self.file.read(size))
+        self.file.seek(current_position)
+        return data
+
     def write(self, data):
         """
         Writes a new message into the data sequence file
@@ -126,6 +234,8 @@ class DataSequence:
         raw_little_endian_int64 = pack("<Q", size)
         
         # write the data to the file --
+        if self.write_index:
+            self.messages_offsets.append(self.file.tell())
         self.file.write(raw_little_endian_int64)
         self.file.write(data_string)
         
@@ -135,3 +245,17 @@ class DataSequence:
         self.file.flush()
         return
 
+    def close(self):
+        """
+        Closes the file, in write mode also writes the index footer (if requested)
+        """
+
+        if self.file.mode == "wb" and self.write_index:
+            num_messages = len(self.messages_offsets)
+            self.file.write(pack("<%iQ" % num_messages, *self.messages_offsets))
+            self.file.write(pack("<Q", num_messages))
+            self.file.write(index_magic)
+
+        self.file.close()
+        return
+
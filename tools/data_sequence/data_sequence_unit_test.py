@@ -85,6 +85,50 @@ class TestDataSequence(unittest.TestCase):
         self.read_and_check()
         return
             
+    def test_read_cpp_indexed_sequence(self):
+        """
+        Test that python can use the index footer of a file created via cpp
+        """
+        self.test_filename = "../../src/tests/data_sequence/test_indexed.sequence"
+        self.assertTrue(os.path.exists(self.test_filename))
+
+        data_sequence_in = DataSequence(self.test_filename, TestData)
+        self.assertTrue(data_sequence_in.messages_offsets is not None)
+        self.assertEqual(data_sequence_in.num_messages(), 500)
+        self.assertEqual(data_sequence_in.read_at(321).int_value, 321)
+        return
+
+    def test_indexed_read_write_sequence(self):
+        """
+        Test data sequence creation and reading, with index footer
+        """
+
+        if os.path.exists(self.test_filename):
+            os.remove(self.test_filename)
+
+        data_sequence_out = \
+            DataSequence(self.test_filename, TestData, self.attributes, write_index = True)
+
+        data_sequence_out.write(self.data1)
+        data_sequence_out.write(self.data2)
+        data_sequence_out.write(self.data3)
+
+        data_sequence_out.close()
+
+        self.read_and_check()
+
+        data_sequence_in = DataSequence(self.test_filename, TestData)
+        self.assertEqual(data_sequence_in.num_messages(), 3)
+        self.assertEqual(data_sequence_in.read_at(1), self.data2)
+        self.assertEqual(data_sequence_in.read_at(0), self.data1)
+        self.assertEqual(data_sequence_in.read(), self.data1)
+
+        # the index footer is not read as a message
+        data_sequence_in.read()
+        data_sequence_in.read()
+        self.assertEqual(data_sequence_in.read(), None)
+        return
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -0,0 +1,43 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: compiled_detector_model.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x1d\x63ompiled_detector_model.proto\x12\x0f\x64oppia_protobuf\"\xf9\x02\n\x13\x43ompiledSoftCascade\x12\x16\n\x0erelative_scale\x18\x01 \x02(\x02\x12\x1e\n\x16\x64\x65tection_window_width\x18\x02 \x02(\r\x12\x1f\n\x17\x64\x65tection_window_height\x18\x03 \x02(\r\x12\x12\n\nuse_stumps\x18\x04 \x02(\x08\x12\x17\n\x0fsource_checksum\x18\x05 \x02(\x04\x12\x1f\n\x13nodes_channel_index\x18\n \x03(\rB\x02\x10\x01\x12\x17\n\x0bnodes_min_x\x18\x0b \x03(\x05\x42\x02\x10\x01\x12\x17\n\x0bnodes_min_y\x18\x0c \x03(\x05\x42\x02\x10\x01\x12\x17\n\x0bnodes_max_x\x18\r \x03(\x05\x42\x02\x10\x01\x12\x17\n\x0bnodes_max_y\x18\x0e \x03(\x05\x42\x02\x10\x01\x12\x1b\n\x0fnodes_threshold\x18\x0f \x03(\x05\x42\x02\x10\x01\x12\x1a\n\x0eleaves_weights\x18\x14 \x03(\x02\x42\x02\x10\x01\x12\x1e\n\x12\x63\x61scade_thresholds\x18\x15 \x03(\x02\x42\x02\x10\x01\"S\n\x19\x43ompiledSoftCascadesModel\x12\x36\n\x08\x63\x61scades\x18\x01 \x03(\x0b\x32$.doppia_protobuf.CompiledSoftCascade')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'compiled_detector_model_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_channel_index']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_channel_index']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_min_x']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_min_x']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_min_y']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_min_y']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_max_x']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_max_x']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_max_y']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_max_y']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_threshold']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['nodes_threshold']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['leaves_weights']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['leaves_weights']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE.fields_by_name['cascade_thresholds']._options = None
+  _COMPILEDSOFTCASCADE.fields_by_name['cascade_thresholds']._serialized_options = b'\020\001'
+  _COMPILEDSOFTCASCADE._serialized_start=51
+  _COMPILEDSOFTCASCADE._serialized_end=428
+  _COMPILEDSOFTCASCADESMODEL._serialized_start=430
+  _COMPILEDSOFTCASCADESMODEL._serialized_end=513
+# @@protoc_insertion_point(module_scope)
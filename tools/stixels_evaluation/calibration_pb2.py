@@ -1,510 +1,39 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
-
-from google.protobuf import descriptor
-from google.protobuf import message
-from google.protobuf import reflection
-from google.protobuf import descriptor_pb2
+# source: calibration.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
+_sym_db = _symbol_database.Default()
 
 
-DESCRIPTOR = descriptor.FileDescriptor(
-  name='calibration.proto',
-  package='doppia_protobuf',
-  serialized_pb='\n\x11\x63\x61libration.proto\x12\x0f\x64oppia_protobuf\"\x8f\x01\n\x18\x43\x61meraInternalParameters\x12\x0b\n\x03k11\x18\x01 \x02(\x02\x12\x0b\n\x03k12\x18\x02 \x02(\x02\x12\x0b\n\x03k13\x18\x03 \x02(\x02\x12\x0b\n\x03k21\x18\x04 \x02(\x02\x12\x0b\n\x03k22\x18\x05 \x02(\x02\x12\x0b\n\x03k23\x18\x06 \x02(\x02\x12\x0b\n\x03k31\x18\x07 \x02(\x02\x12\x0b\n\x03k32\x18\x08 \x02(\x02\x12\x0b\n\x03k33\x18\t \x02(\x02\"6\n\x10RadialDistortion\x12\n\n\x02k1\x18\x01 \x02(\x02\x12\n\n\x02k2\x18\x02 \x01(\x02\x12\n\n\x02k3\x18\x03 \x01(\x02\":\n\x14TangentialDistortion\x12\n\n\x02k1\x18\x01 \x02(\x02\x12\n\n\x02k2\x18\x02 \x02(\x02\x12\n\n\x02k3\x18\x03 \x01(\x02\"\x85\x01\n\x0eRotationMatrix\x12\x0b\n\x03r11\x18\x01 \x02(\x02\x12\x0b\n\x03r12\x18\x02 \x02(\x02\x12\x0b\n\x03r13\x18\x03 \x02(\x02\x12\x0b\n\x03r21\x18\x04 \x02(\x02\x12\x0b\n\x03r22\x18\x05 \x02(\x02\x12\x0b\n\x03r23\x18\x06 \x02(\x02\x12\x0b\n\x03r31\x18\x07 \x02(\x02\x12\x0b\n\x03r32\x18\x08 \x02(\x02\x12\x0b\n\x03r33\x18\t \x02(\x02\"7\n\x11TranslationVector\x12\n\n\x02t1\x18\x01 \x02(\x02\x12\n\n\x02t2\x18\x02 \x02(\x02\x12\n\n\x02t3\x18\x03 \x02(\x02\"r\n\x04Pose\x12\x31\n\x08rotation\x18\x01 \x02(\x0b\x32\x1f.doppia_protobuf.RotationMatrix\x12\x37\n\x0btranslation\x18\x02 \x02(\x0b\x32\".doppia_protobuf.TranslationVector\"\x92\x02\n\x11\x43\x61meraCalibration\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x46\n\x13internal_parameters\x18\x02 \x02(\x0b\x32).doppia_protobuf.CameraInternalParameters\x12<\n\x11radial_distortion\x18\x03 \x01(\x0b\x32!.doppia_protobuf.RadialDistortion\x12\x44\n\x15tangential_distortion\x18\x04 \x01(\x0b\x32%.doppia_protobuf.TangentialDistortion\x12#\n\x04pose\x18\x05 \x01(\x0b\x32\x15.doppia_protobuf.Pose\"\x9a\x01\n\x17StereoCameraCalibration\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x37\n\x0bleft_camera\x18\x02 \x02(\x0b\x32\".doppia_protobuf.CameraCalibration\x12\x38\n\x0cright_camera\x18\x03 \x02(\x0b\x32\".doppia_protobuf.CameraCalibration')
-
-
-
-
-_CAMERAINTERNALPARAMETERS = descriptor.Descriptor(
-  name='CameraInternalParameters',
-  full_name='doppia_protobuf.CameraInternalParameters',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='k11', full_name='doppia_protobuf.CameraInternalParameters.k11', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k12', full_name='doppia_protobuf.CameraInternalParameters.k12', index=1,
-      number=2, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k13', full_name='doppia_protobuf.CameraInternalParameters.k13', index=2,
-      number=3, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k21', full_name='doppia_protobuf.CameraInternalParameters.k21', index=3,
-      number=4, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k22', full_name='doppia_protobuf.CameraInternalParameters.k22', index=4,
-      number=5, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k23', full_name='doppia_protobuf.CameraInternalParameters.k23', index=5,
-      number=6, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k31', full_name='doppia_protobuf.CameraInternalParameters.k31', index=6,
-      number=7, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k32', full_name='doppia_protobuf.CameraInternalParameters.k32', index=7,
-      number=8, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k33', full_name='doppia_protobuf.CameraInternalParameters.k33', index=8,
-      number=9, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=39,
-  serialized_end=182,
-)
-
-
-_RADIALDISTORTION = descriptor.Descriptor(
-  name='RadialDistortion',
-  full_name='doppia_protobuf.RadialDistortion',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='k1', full_name='doppia_protobuf.RadialDistortion.k1', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k2', full_name='doppia_protobuf.RadialDistortion.k2', index=1,
-      number=2, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k3', full_name='doppia_protobuf.RadialDistortion.k3', index=2,
-      number=3, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=184,
-  serialized_end=238,
-)
-
-
-_TANGENTIALDISTORTION = descriptor.Descriptor(
-  name='TangentialDistortion',
-  full_name='doppia_protobuf.TangentialDistortion',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='k1', full_name='doppia_protobuf.TangentialDistortion.k1', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k2', full_name='doppia_protobuf.TangentialDistortion.k2', index=1,
-      number=2, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='k3', full_name='doppia_protobuf.TangentialDistortion.k3', index=2,
-      number=3, type=2, cpp_type=6, label=1,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=240,
-  serialized_end=298,
-)
-
-
-_ROTATIONMATRIX = descriptor.Descriptor(
-  name='RotationMatrix',
-  full_name='doppia_protobuf.RotationMatrix',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='r11', full_name='doppia_protobuf.RotationMatrix.r11', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r12', full_name='doppia_protobuf.RotationMatrix.r12', index=1,
-      number=2, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r13', full_name='doppia_protobuf.RotationMatrix.r13', index=2,
-      number=3, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r21', full_name='doppia_protobuf.RotationMatrix.r21', index=3,
-      number=4, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r22', full_name='doppia_protobuf.RotationMatrix.r22', index=4,
-      number=5, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r23', full_name='doppia_protobuf.RotationMatrix.r23', index=5,
-      number=6, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r31', full_name='doppia_protobuf.RotationMatrix.r31', index=6,
-      number=7, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r32', full_name='doppia_protobuf.RotationMatrix.r32', index=7,
-      number=8, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='r33', full_name='doppia_protobuf.RotationMatrix.r33', index=8,
-      number=9, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=301,
-  serialized_end=434,
-)
-
-
-_TRANSLATIONVECTOR = descriptor.Descriptor(
-  name='TranslationVector',
-  full_name='doppia_protobuf.TranslationVector',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='t1', full_name='doppia_protobuf.TranslationVector.t1', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='t2', full_name='doppia_protobuf.TranslationVector.t2', index=1,
-      number=2, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='t3', full_name='doppia_protobuf.TranslationVector.t3', index=2,
-      number=3, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=436,
-  serialized_end=491,
-)
-
-
-_POSE = descriptor.Descriptor(
-  name='Pose',
-  full_name='doppia_protobuf.Pose',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='rotation', full_name='doppia_protobuf.Pose.rotation', index=0,
-      number=1, type=11, cpp_type=10, label=2,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='translation', full_name='doppia_protobuf.Pose.translation', index=1,
-      number=2, type=11, cpp_type=10, label=2,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=493,
-  serialized_end=607,
-)
-
-
-_CAMERACALIBRATION = descriptor.Descriptor(
-  name='CameraCalibration',
-  full_name='doppia_protobuf.CameraCalibration',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='name', full_name='doppia_protobuf.CameraCalibration.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=unicode("", "utf-8"),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='internal_parameters', full_name='doppia_protobuf.CameraCalibration.internal_parameters', index=1,
-      number=2, type=11, cpp_type=10, label=2,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='radial_distortion', full_name='doppia_protobuf.CameraCalibration.radial_distortion', index=2,
-      number=3, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='tangential_distortion', full_name='doppia_protobuf.CameraCalibration.tangential_distortion', index=3,
-      number=4, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='pose', full_name='doppia_protobuf.CameraCalibration.pose', index=4,
-      number=5, type=11, cpp_type=10, label=1,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=610,
-  serialized_end=884,
-)
-
-
-_STEREOCAMERACALIBRATION = descriptor.Descriptor(
-  name='StereoCameraCalibration',
-  full_name='doppia_protobuf.StereoCameraCalibration',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='name', full_name='doppia_protobuf.StereoCameraCalibration.name', index=0,
-      number=1, type=9, cpp_type=9, label=1,
-      has_default_value=False, default_value=unicode("", "utf-8"),
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='left_camera', full_name='doppia_protobuf.StereoCameraCalibration.left_camera', index=1,
-      number=2, type=11, cpp_type=10, label=2,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='right_camera', full_name='doppia_protobuf.StereoCameraCalibration.right_camera', index=2,
-      number=3, type=11, cpp_type=10, label=2,
-      has_default_value=False, default_value=None,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=887,
-  serialized_end=1041,
-)
-
-_POSE.fields_by_name['rotation'].message_type = _ROTATIONMATRIX
-_POSE.fields_by_name['translation'].message_type = _TRANSLATIONVECTOR
-_CAMERACALIBRATION.fields_by_name['internal_parameters'].message_type = _CAMERAINTERNALPARAMETERS
-_CAMERACALIBRATION.fields_by_name['radial_distortion'].message_type = _RADIALDISTORTION
-_CAMERACALIBRATION.fields_by_name['tangential_distortion'].message_type = _TANGENTIALDISTORTION
-_CAMERACALIBRATION.fields_by_name['pose'].message_type = _POSE
-_STEREOCAMERACALIBRATION.fields_by_name['left_camera'].message_type = _CAMERACALIBRATION
-_STEREOCAMERACALIBRATION.fields_by_name['right_camera'].message_type = _CAMERACALIBRATION
-DESCRIPTOR.message_types_by_name['CameraInternalParameters'] = _CAMERAINTERNALPARAMETERS
-DESCRIPTOR.message_types_by_name['RadialDistortion'] = _RADIALDISTORTION
-DESCRIPTOR.message_types_by_name['TangentialDistortion'] = _TANGENTIALDISTORTION
-DESCRIPTOR.message_types_by_name['RotationMatrix'] = _ROTATIONMATRIX
-DESCRIPTOR.message_types_by_name['TranslationVector'] = _TRANSLATIONVECTOR
-DESCRIPTOR.message_types_by_name['Pose'] = _POSE
-DESCRIPTOR.message_types_by_name['CameraCalibration'] = _CAMERACALIBRATION
-DESCRIPTOR.message_types_by_name['StereoCameraCalibration'] = _STEREOCAMERACALIBRATION
-
-class CameraInternalParameters(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _CAMERAINTERNALPARAMETERS
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.CameraInternalParameters)
-
-class RadialDistortion(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _RADIALDISTORTION
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.RadialDistortion)
-
-class TangentialDistortion(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _TANGENTIALDISTORTION
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.TangentialDistortion)
-
-class RotationMatrix(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _ROTATIONMATRIX
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.RotationMatrix)
-
-class TranslationVector(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _TRANSLATIONVECTOR
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.TranslationVector)
 
-class Pose(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _POSE
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.Pose)
 
-class CameraCalibration(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _CAMERACALIBRATION
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.CameraCalibration)
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x11\x63\x61libration.proto\x12\x0f\x64oppia_protobuf\"\x8f\x01\n\x18\x43\x61meraInternalParameters\x12\x0b\n\x03k11\x18\x01 \x02(\x02\x12\x0b\n\x03k12\x18\x02 \x02(\x02\x12\x0b\n\x03k13\x18\x03 \x02(\x02\x12\x0b\n\x03k21\x18\x04 \x02(\x02\x12\x0b\n\x03k22\x18\x05 \x02(\x02\x12\x0b\n\x03k23\x18\x06 \x02(\x02\x12\x0b\n\x03k31\x18\x07 \x02(\x02\x12\x0b\n\x03k32\x18\x08 \x02(\x02\x12\x0b\n\x03k33\x18\t \x02(\x02\"6\n\x10RadialDistortion\x12\n\n\x02k1\x18\x01 \x02(\x02\x12\n\n\x02k2\x18\x02 \x01(\x02\x12\n\n\x02k3\x18\x03 \x01(\x02\":\n\x14TangentialDistortion\x12\n\n\x02k1\x18\x01 \x02(\x02\x12\n\n\x02k2\x18\x02 \x02(\x02\x12\n\n\x02k3\x18\x03 \x01(\x02\"\x85\x01\n\x0eRotationMatrix\x12\x0b\n\x03r11\x18\x01 \x02(\x02\x12\x0b\n\x03r12\x18\x02 \x02(\x02\x12\x0b\n\x03r13\x18\x03 \x02(\x02\x12\x0b\n\x03r21\x18\x04 \x02(\x02\x12\x0b\n\x03r22\x18\x05 \x02(\x02\x12\x0b\n\x03r23\x18\x06 \x02(\x02\x12\x0b\n\x03r31\x18\x07 \x02(\x02\x12\x0b\n\x03r32\x18\x08 \x02(\x02\x12\x0b\n\x03r33\x18\t \x02(\x02\"7\n\x11TranslationVector\x12\n\n\x02t1\x18\x01 \x02(\x02\x12\n\n\x02t2\x18\x02 \x02(\x02\x12\n\n\x02t3\x18\x03 \x02(\x02\"r\n\x04Pose\x12\x31\n\x08rotation\x18\x01 \x02(\x0b\x32\x1f.doppia_protobuf.RotationMatrix\x12\x37\n\x0btranslation\x18\x02 \x02(\x0b\x32\".doppia_protobuf.TranslationVector\"\x92\x02\n\x11\x43\x61meraCalibration\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x46\n\x13internal_parameters\x18\x02 \x02(\x0b\x32).doppia_protobuf.CameraInternalParameters\x12<\n\x11radial_distortion\x18\x03 \x01(\x0b\x32!.doppia_protobuf.RadialDistortion\x12\x44\n\x15tangential_distortion\x18\x04 \x01(\x0b\x32%.doppia_protobuf.TangentialDistortion\x12#\n\x04pose\x18\x05 \x01(\x0b\x32\x15.doppia_protobuf.Pose\"\x9a\x01\n\x17StereoCameraCalibration\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x37\n\x0bleft_camera\x18\x02 \x02(\x0b\x32\".doppia_protobuf.CameraCalibration\x12\x38\n\x0cright_camera\x18\x03 \x02(\x0b\x32\".doppia_protobuf.CameraCalibration')
 
-class StereoCameraCalibration(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _STEREOCAMERACALIBRATION
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.StereoCameraCalibration)
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'calibration_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
 
+  DESCRIPTOR._options = None
+  _CAMERAINTERNALPARAMETERS._serialized_start=39
+  _CAMERAINTERNALPARAMETERS._serialized_end=182
+  _RADIALDISTORTION._serialized_start=184
+  _RADIALDISTORTION._serialized_end=238
+  _TANGENTIALDISTORTION._serialized_start=240
+  _TANGENTIALDISTORTION._serialized_end=298
+  _ROTATIONMATRIX._serialized_start=301
+  _ROTATIONMATRIX._serialized_end=434
+  _TRANSLATIONVECTOR._serialized_start=436
+  _TRANSLATIONVECTOR._serialized_end=491
+  _POSE._serialized_start=493
+  _POSE._serialized_end=607
+  _CAMERACALIBRATION._serialized_start=610
+  _CAMERACALIBRATION._serialized_end=884
+  _STEREOCAMERACALIBRATION._serialized_start=887
+  _STEREOCAMERACALIBRATION._serialized_end=1041
 # @@protoc_insertion_point(module_scope)
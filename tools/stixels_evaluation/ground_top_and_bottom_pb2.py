@@ -1,97 +1,27 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
-
-from google.protobuf import descriptor
-from google.protobuf import message
-from google.protobuf import reflection
-from google.protobuf import descriptor_pb2
+# source: ground_top_and_bottom.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
+_sym_db = _symbol_database.Default()
 
 
-DESCRIPTOR = descriptor.FileDescriptor(
-  name='ground_top_and_bottom.proto',
-  package='doppia_protobuf',
-  serialized_pb='\n\x1bground_top_and_bottom.proto\x12\x0f\x64oppia_protobuf\"/\n\x0cTopAndBottom\x12\r\n\x05top_y\x18\x01 \x02(\r\x12\x10\n\x08\x62ottom_y\x18\x02 \x02(\r\"K\n\x12GroundTopAndBottom\x12\x35\n\x0etop_and_bottom\x18\x01 \x03(\x0b\x32\x1d.doppia_protobuf.TopAndBottom')
-
-
-
-
-_TOPANDBOTTOM = descriptor.Descriptor(
-  name='TopAndBottom',
-  full_name='doppia_protobuf.TopAndBottom',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='top_y', full_name='doppia_protobuf.TopAndBottom.top_y', index=0,
-      number=1, type=13, cpp_type=3, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='bottom_y', full_name='doppia_protobuf.TopAndBottom.bottom_y', index=1,
-      number=2, type=13, cpp_type=3, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=48,
-  serialized_end=95,
-)
-
-
-_GROUNDTOPANDBOTTOM = descriptor.Descriptor(
-  name='GroundTopAndBottom',
-  full_name='doppia_protobuf.GroundTopAndBottom',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='top_and_bottom', full_name='doppia_protobuf.GroundTopAndBottom.top_and_bottom', index=0,
-      number=1, type=11, cpp_type=10, label=3,
-      has_default_value=False, default_value=[],
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=97,
-  serialized_end=172,
-)
 
-_GROUNDTOPANDBOTTOM.fields_by_name['top_and_bottom'].message_type = _TOPANDBOTTOM
-DESCRIPTOR.message_types_by_name['TopAndBottom'] = _TOPANDBOTTOM
-DESCRIPTOR.message_types_by_name['GroundTopAndBottom'] = _GROUNDTOPANDBOTTOM
 
-class TopAndBottom(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _TOPANDBOTTOM
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.TopAndBottom)
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x1bground_top_and_bottom.proto\x12\x0f\x64oppia_protobuf\"/\n\x0cTopAndBottom\x12\r\n\x05top_y\x18\x01 \x02(\r\x12\x10\n\x08\x62ottom_y\x18\x02 \x02(\r\"K\n\x12GroundTopAndBottom\x12\x35\n\x0etop_and_bottom\x18\x01 \x03(\x0b\x32\x1d.doppia_protobuf.TopAndBottom')
 
-class GroundTopAndBottom(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _GROUNDTOPANDBOTTOM
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.GroundTopAndBottom)
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'ground_top_and_bottom_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
 
+  DESCRIPTOR._options = None
+  _TOPANDBOTTOM._serialized_start=48
+  _TOPANDBOTTOM._serialized_end=95
+  _GROUNDTOPANDBOTTOM._serialized_start=97
+  _GROUNDTOPANDBOTTOM._serialized_end=172
 # @@protoc_insertion_point(module_scope)
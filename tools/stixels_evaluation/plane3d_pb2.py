@@ -1,75 +1,25 @@
+# -*- coding: utf-8 -*-
 # Generated by the protocol buffer compiler.  DO NOT EDIT!
-
-from google.protobuf import descriptor
-from google.protobuf import message
-from google.protobuf import reflection
-from google.protobuf import descriptor_pb2
+# source: plane3d.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
 # @@protoc_insertion_point(imports)
 
-
-
-DESCRIPTOR = descriptor.FileDescriptor(
-  name='plane3d.proto',
-  package='doppia_protobuf',
-  serialized_pb='\n\rplane3d.proto\x12\x0f\x64oppia_protobuf\"O\n\x07Plane3d\x12\x0e\n\x06offset\x18\x01 \x02(\x02\x12\x10\n\x08normal_x\x18\x02 \x02(\x02\x12\x10\n\x08normal_y\x18\x03 \x02(\x02\x12\x10\n\x08normal_z\x18\x04 \x02(\x02')
-
+_sym_db = _symbol_database.Default()
 
 
 
-_PLANE3D = descriptor.Descriptor(
-  name='Plane3d',
-  full_name='doppia_protobuf.Plane3d',
-  filename=None,
-  file=DESCRIPTOR,
-  containing_type=None,
-  fields=[
-    descriptor.FieldDescriptor(
-      name='offset', full_name='doppia_protobuf.Plane3d.offset', index=0,
-      number=1, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='normal_x', full_name='doppia_protobuf.Plane3d.normal_x', index=1,
-      number=2, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='normal_y', full_name='doppia_protobuf.Plane3d.normal_y', index=2,
-      number=3, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-    descriptor.FieldDescriptor(
-      name='normal_z', full_name='doppia_protobuf.Plane3d.normal_z', index=3,
-      number=4, type=2, cpp_type=6, label=2,
-      has_default_value=False, default_value=0,
-      message_type=None, enum_type=None, containing_type=None,
-      is_extension=False, extension_scope=None,
-      options=None),
-  ],
-  extensions=[
-  ],
-  nested_types=[],
-  enum_types=[
-  ],
-  options=None,
-  is_extendable=False,
-  extension_ranges=[],
-  serialized_start=34,
-  serialized_end=113,
-)
 
-DESCRIPTOR.message_types_by_name['Plane3d'] = _PLANE3D
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rplane3d.proto\x12\x0f\x64oppia_protobuf\"O\n\x07Plane3d\x12\x0e\n\x06offset\x18\x01 \x02(\x02\x12\x10\n\x08normal_x\x18\x02 \x02(\x02\x12\x10\n\x08normal_y\x18\x03 \x02(\x02\x12\x10\n\x08normal_z\x18\x04 \x02(\x02')
 
-class Plane3d(message.Message):
-  __metaclass__ = reflection.GeneratedProtocolMessageType
-  DESCRIPTOR = _PLANE3D
-  
-  # @@protoc_insertion_point(class_scope:doppia_protobuf.Plane3d)
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'plane3d_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
 
+  DESCRIPTOR._options = None
+  _PLANE3D._serialized_start=34
+  _PLANE3D._serialized_end=113
 # @@protoc_insertion_point(module_scope)
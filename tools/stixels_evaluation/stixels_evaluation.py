@@ -18,6 +18,7 @@ from idl_parsing import open_idl_file, IdlLineData
 
 import types
 import os, os.path
+import collections
 import re
 from itertools import izip
 
@@ -238,9 +239,11 @@ class StixelsEvaluationApplication:
         parser.add_option("-g", "--ground_truth", dest="ground_truth_path",
                            metavar="IDL_FILE", type="string",
                            help="path to the ground truth idl file")
-        parser.add_option("-r", "--recording", dest="recording_directory", 
-                          metavar="DIRECTORY", type="string",
-                          help="path to the recording directory containing the stixels data sequence")
+        parser.add_option("-r", "--recording", dest="recording_directories",
+                          metavar="DIRECTORY", type="string", action="append",
+                          help="path to the recording directory containing the stixels data sequence. " \
+                               "Can be used multiple times to compare recordings of the same sequence " \
+                               "(e.g. stixel_world with and without stixel_world.temporal_band)")
         
         parser.add_option("-d", "--detections", dest="detections_path", 
                           metavar="DETECTIONS_FILE", type="string",
@@ -282,27 +285,39 @@ class StixelsEvaluationApplication:
         self.should_render_example_result = options.example_result_frame > -1
     
         if not self.should_render_example_result:
-            if not (options.ground_truth_path and options.recording_directory):
+            if not (options.ground_truth_path and options.recording_directories):
                 parser.error("'ground_truth' and 'recording' options are required to run this program")
-        elif not options.recording_directory:
+        elif not options.recording_directories:
             parser.error("'recording' option is required to run this program")
+        elif len(options.recording_directories) > 1:
+            parser.error("only one 'recording' can be used to render an example result frame")
     
         if options.ground_truth_path:
             if not os.path.exists(options.ground_truth_path):
                 parser.error("Could not find the ground_truth file")
 
-        if not os.path.exists(options.recording_directory):
-            parser.error("Could not find the recording directory")
-                        
-        if not os.path.isdir(options.recording_directory):
-            parser.error("The --recording option expects to receive a directory, not a file")
+        for recording_directory in options.recording_directories:
+            if not os.path.exists(recording_directory):
+                parser.error("Could not find the recording directory %s" % recording_directory)
+                            
+            if not os.path.isdir(recording_directory):
+                parser.error("The --recording option expects to receive a directory, not a file")
     
         
     
-        options.recordings = dict()
-        options.recordings["the_recording"] = Recording(
-            directory = options.recording_directory, 
-            frontmost_bboxes_only = False)
+        options.recordings = collections.OrderedDict()
+        if len(options.recording_directories) == 1:
+            options.recordings["the_recording"] = Recording(
+                directory = options.recording_directories[0], 
+                frontmost_bboxes_only = False)
+        else:
+            for recording_directory in options.recording_directories:
+                name = os.path.basename(os.path.normpath(recording_directory))
+                if options.recordings.has_key(name):
+                    parser.error("Two recordings directories are named %s" % name)
+                options.recordings[name] = Recording(
+                    directory = recording_directory, 
+                    frontmost_bboxes_only = False)
     
         self.options = options    
     
@@ -737,6 +752,14 @@ class StixelsEvaluationApplication:
         print("\tpercent_occluded_stixel_bounding_boxes == %.2f%%" % 
               (percent_occluded_stixel_bounding_boxes*100))
         
+        if hasattr(recording, "stixel_bottom_error_cumsum"):
+            # the numbers used to compare recordings, without reading the graphs
+            for max_error in [5, 10, 20]:
+                max_error_index = min(max_error, len(recording.stixel_bottom_error_cumsum) - 1)
+                print("\tbounding boxes with absolute error <= %i pixels: bottom %.2f%%, top %.2f%%" % 
+                      (max_error,
+                       recording.stixel_bottom_error_cumsum[max_error_index]*100,
+                       recording.stixel_top_error_cumsum[max_error_index]*100))
 
         return
 